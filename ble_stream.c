@@ -0,0 +1,323 @@
+/**
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @file    ble_stream.c
+ * @date    Oct 18, 2026
+ * @brief   Batching of BLE notifications into MTU-sized packets
+ */
+
+/**********************************************************************************/
+/* system header includes */
+/**********************************************************************************/
+#include <string.h>
+
+/**********************************************************************************/
+/* own header files */
+/**********************************************************************************/
+#include "ble_stream.h"
+
+/**********************************************************************************/
+/* macro definitions */
+/**********************************************************************************/
+/*! Slot of a free running packet count */
+#define SLOT_POS(stream, count)  ((uint8_t)((count) & ((stream)->n_slots - 1)))
+
+/**********************************************************************************/
+/* static function declarations */
+/**********************************************************************************/
+
+/*!
+ * @brief Queues the packet being filled.
+ */
+static void queue_fill_slot(struct ble_stream *stream);
+
+/**********************************************************************************/
+/* functions */
+/**********************************************************************************/
+
+/*!
+ * @brief This API initializes a stream over the given storage.
+ */
+int8_t ble_stream_init(uint8_t *buf,
+                       uint16_t slot_size,
+                       uint8_t n_slots,
+                       uint32_t max_latency_us,
+                       ble_stream_send_fptr_t send,
+                       void *intf_ptr,
+                       struct ble_stream *stream)
+{
+    int8_t rslt = BLE_STREAM_OK;
+
+    if ((buf == NULL) || (send == NULL) || (stream == NULL))
+    {
+        rslt = BLE_STREAM_E_NULL_PTR;
+    }
+    else if ((slot_size == 0) || (n_slots < 2) || (n_slots > BLE_STREAM_MAX_SLOTS) ||
+             ((n_slots & (n_slots - 1)) != 0))
+    {
+        rslt = BLE_STREAM_E_INVALID_CFG;
+    }
+    else
+    {
+        memset(stream, 0, sizeof(*stream));
+        stream->buf = buf;
+        stream->slot_size = slot_size;
+        stream->packet_size = slot_size;
+        stream->n_slots = n_slots;
+        stream->max_latency_us = max_latency_us;
+        stream->send = send;
+        stream->intf_ptr = intf_ptr;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets the packet size after an MTU exchange.
+ */
+int8_t ble_stream_set_packet_size(uint16_t packet_size, struct ble_stream *stream)
+{
+    if (stream == NULL)
+    {
+        return BLE_STREAM_E_NULL_PTR;
+    }
+
+    if ((packet_size == 0) || (packet_size > stream->slot_size))
+    {
+        return BLE_STREAM_E_INVALID_CFG;
+    }
+
+    /* A packet already past the new size goes as it is, the service splits it */
+    if ((stream->fill_len >= packet_size) && ((uint16_t)(stream->head - stream->tail) < stream->n_slots))
+    {
+        queue_fill_slot(stream);
+    }
+
+    stream->packet_size = packet_size;
+
+    return BLE_STREAM_OK;
+}
+
+/*!
+ * @brief This API adds data to the stream and sends the packets it fills.
+ */
+int8_t ble_stream_write(const uint8_t *data, uint16_t len, uint32_t now_us, struct ble_stream *stream)
+{
+    uint16_t queued;
+    uint16_t done = 0;
+    uint16_t chunk;
+    uint32_t avail = 0;
+    uint8_t idx;
+
+    if ((data == NULL) || (stream == NULL) || (stream->buf == NULL))
+    {
+        return BLE_STREAM_E_NULL_PTR;
+    }
+
+    /* Packets the link refused before may go now */
+    (void)ble_stream_process(now_us, stream);
+
+    /* A packet left past a smaller packet size while every slot was in use */
+    if ((stream->fill_len >= stream->packet_size) && ((uint16_t)(stream->head - stream->tail) < stream->n_slots))
+    {
+        queue_fill_slot(stream);
+    }
+
+    queued = (uint16_t)(stream->head - stream->tail);
+    if ((queued < stream->n_slots) && (stream->fill_len < stream->packet_size))
+    {
+        avail = (uint32_t)(stream->packet_size - stream->fill_len) +
+                (uint32_t)(stream->n_slots - queued - 1) * stream->packet_size;
+    }
+
+    /* Whole or nothing, the receiver never gets a cut frame */
+    if (len > avail)
+    {
+        stream->stats.n_dropped_writes++;
+        stream->stats.n_dropped_bytes += len;
+
+        return BLE_STREAM_W_DROPPED;
+    }
+
+    while (done < len)
+    {
+        idx = SLOT_POS(stream, stream->head);
+        if (stream->fill_len == 0)
+        {
+            stream->slot_time_us[idx] = now_us;
+        }
+
+        chunk = stream->packet_size - stream->fill_len;
+        if (chunk > (len - done))
+        {
+            chunk = len - done;
+        }
+
+        memcpy(&stream->buf[idx * stream->slot_size + stream->fill_len], &data[done], chunk);
+        stream->fill_len += chunk;
+        done += chunk;
+
+        if (stream->fill_len == stream->packet_size)
+        {
+            queue_fill_slot(stream);
+        }
+    }
+
+    stream->stats.n_bytes += len;
+    (void)ble_stream_process(now_us, stream);
+
+    return BLE_STREAM_OK;
+}
+
+/*!
+ * @brief This API sends the queued packets, and the partial packet once it has
+ * waited max_latency_us.
+ */
+uint8_t ble_stream_process(uint32_t now_us, struct ble_stream *stream)
+{
+    uint8_t n_sent = 0;
+    uint32_t latency_us;
+    uint16_t len;
+    uint8_t idx;
+    int8_t rslt;
+
+    if ((stream == NULL) || (stream->buf == NULL))
+    {
+        return 0;
+    }
+
+    for (;;)
+    {
+        if (stream->head == stream->tail)
+        {
+            /* Wrap safe: the partial packet is due once it has waited long enough */
+            if ((stream->fill_len == 0) ||
+                ((now_us - stream->slot_time_us[SLOT_POS(stream, stream->head)]) < stream->max_latency_us))
+            {
+                break;
+            }
+
+            queue_fill_slot(stream);
+        }
+
+        idx = SLOT_POS(stream, stream->tail);
+        len = stream->slot_len[idx];
+        rslt = stream->send(&stream->buf[idx * stream->slot_size], len, stream->intf_ptr);
+        if (rslt == BLE_STREAM_W_BUSY)
+        {
+            stream->stats.n_busy++;
+            break;
+        }
+
+        if (rslt < BLE_STREAM_OK)
+        {
+            stream->stats.n_send_errors++;
+            stream->stats.n_dropped_bytes += len;
+        }
+        else
+        {
+            latency_us = now_us - stream->slot_time_us[idx];
+            if (latency_us > stream->stats.max_latency_us)
+            {
+                stream->stats.max_latency_us = latency_us;
+            }
+
+            if (stream->stats.n_packets == 0)
+            {
+                stream->stats.first_send_us = now_us;
+            }
+
+            stream->stats.sum_latency_us += latency_us;
+            stream->stats.last_send_us = now_us;
+            stream->stats.n_packets++;
+            stream->stats.n_bytes_sent += len;
+            if (len >= stream->packet_size)
+            {
+                stream->stats.n_full_packets++;
+            }
+
+            n_sent++;
+        }
+
+        stream->tail++;
+    }
+
+    return n_sent;
+}
+
+/*!
+ * @brief This API sends everything written, the partial packet included.
+ */
+int8_t ble_stream_flush(uint32_t now_us, struct ble_stream *stream)
+{
+    if ((stream == NULL) || (stream->buf == NULL))
+    {
+        return BLE_STREAM_E_NULL_PTR;
+    }
+
+    /* The queued packets go first, freeing a slot for the partial one */
+    (void)ble_stream_process(now_us, stream);
+    if ((stream->fill_len > 0) && ((uint16_t)(stream->head - stream->tail) < stream->n_slots))
+    {
+        queue_fill_slot(stream);
+        (void)ble_stream_process(now_us, stream);
+    }
+
+    return ((stream->head == stream->tail) && (stream->fill_len == 0)) ? BLE_STREAM_OK : BLE_STREAM_W_BUSY;
+}
+
+/*!
+ * @brief This API drops everything written and not sent.
+ */
+void ble_stream_discard(struct ble_stream *stream)
+{
+    if (stream != NULL)
+    {
+        for (; stream->tail != stream->head; stream->tail++)
+        {
+            stream->stats.n_dropped_bytes += stream->slot_len[SLOT_POS(stream, stream->tail)];
+        }
+
+        stream->stats.n_dropped_bytes += stream->fill_len;
+        stream->fill_len = 0;
+    }
+}
+
+/*!
+ * @brief This API returns the throughput between the first and the last packet.
+ */
+uint32_t ble_stream_throughput(const struct ble_stream *stream)
+{
+    uint32_t elapsed_us;
+
+    if ((stream == NULL) || (stream->stats.n_packets < 2))
+    {
+        return 0;
+    }
+
+    elapsed_us = stream->stats.last_send_us - stream->stats.first_send_us;
+    if (elapsed_us == 0)
+    {
+        return 0;
+    }
+
+    return (uint32_t)(((uint64_t)stream->stats.n_bytes_sent * 1000000) / elapsed_us);
+}
+
+/*!
+ * @brief Queues the packet being filled.
+ */
+static void queue_fill_slot(struct ble_stream *stream)
+{
+    uint16_t queued;
+
+    stream->slot_len[SLOT_POS(stream, stream->head)] = stream->fill_len;
+    stream->fill_len = 0;
+    stream->head++;
+
+    queued = (uint16_t)(stream->head - stream->tail);
+    if (queued > stream->stats.max_queued)
+    {
+        stream->stats.max_queued = (uint8_t)queued;
+    }
+}
@@ -0,0 +1,232 @@
+/**
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @file    ble_stream.h
+ * @date    Oct 18, 2026
+ * @brief   Batching of BLE notifications into MTU-sized packets
+ *
+ * Every write to the NUS service costs a notification, and a connection event
+ * carries only a few of them whatever their size. Writes are therefore
+ * coalesced into packets of packet_size bytes, the ATT payload of the
+ * negotiated MTU. A full packet is sent right away, a partial one once its
+ * first byte has waited max_latency_us, so a slow stream is not held back.
+ *
+ * A write is taken whole or dropped whole: a sample_stream frame is never cut,
+ * and the host decoder sees a dropped frame as a sequence gap.
+ *
+ * The module has no platform dependency, the link is reached only through the
+ * send callback and the time is passed in. Calls must not preempt each other:
+ * a caller running ble_stream_process from an interrupt, so a partial packet
+ * goes out while the main loop is busy, masks that interrupt around the other
+ * calls.
+ */
+#ifndef BLE_STREAM_H_
+#define BLE_STREAM_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**********************************************************************************/
+/* macro definitions */
+/**********************************************************************************/
+/*! Maximum number of packets of a stream, a power of two */
+#ifndef BLE_STREAM_MAX_SLOTS
+#define BLE_STREAM_MAX_SLOTS     (16)
+#endif
+
+/*! Status codes */
+#define BLE_STREAM_OK            INT8_C(0)
+#define BLE_STREAM_E_NULL_PTR    INT8_C(-1)
+#define BLE_STREAM_E_INVALID_CFG INT8_C(-2)
+#define BLE_STREAM_E_COM_FAIL    INT8_C(-3)
+
+/*! Warnings: the write was dropped; the link has no buffer free, retry later */
+#define BLE_STREAM_W_DROPPED     INT8_C(1)
+#define BLE_STREAM_W_BUSY        INT8_C(2)
+
+/**********************************************************************************/
+/* data structure declarations  */
+/**********************************************************************************/
+
+/*!
+ * @brief Sends one packet as a notification
+ *
+ * @return BLE_STREAM_OK when sent, BLE_STREAM_W_BUSY to retry later,
+ *         < 0 if the link failed, the packet is then dropped
+ */
+typedef int8_t (*ble_stream_send_fptr_t)(const uint8_t *data, uint16_t len, void *intf_ptr);
+
+/*!
+ * @brief Counters of a stream
+ */
+struct ble_stream_stats
+{
+    /*! Bytes taken by ble_stream_write */
+    uint32_t n_bytes;
+
+    /*! Packets and bytes sent */
+    uint32_t n_packets;
+    uint32_t n_bytes_sent;
+
+    /*! Packets sent completely filled */
+    uint32_t n_full_packets;
+
+    /*! Writes and bytes dropped because the packets were all in use */
+    uint32_t n_dropped_writes;
+    uint32_t n_dropped_bytes;
+
+    /*! Sends the link refused for lack of buffers, and sends which failed */
+    uint32_t n_busy;
+    uint32_t n_send_errors;
+
+    /*! Time from the first byte of a packet to its sending, most and sum */
+    uint32_t max_latency_us;
+    uint64_t sum_latency_us;
+
+    /*! Time of the first and of the last packet sent */
+    uint32_t first_send_us;
+    uint32_t last_send_us;
+
+    /*! Most packets waiting at once */
+    uint8_t max_queued;
+};
+
+/*!
+ * @brief BLE stream
+ */
+struct ble_stream
+{
+    /*! Packet storage, n_slots * slot_size bytes */
+    uint8_t *buf;
+
+    /*! Slot size and the packet size in use, at most slot_size */
+    uint16_t slot_size;
+    uint16_t packet_size;
+
+    /*! Number of slots, a power of two */
+    uint8_t n_slots;
+
+    /*! Length of the queued packets and time of their first byte */
+    uint16_t slot_len[BLE_STREAM_MAX_SLOTS];
+    uint32_t slot_time_us[BLE_STREAM_MAX_SLOTS];
+
+    /*! Free running counts of queued and of sent packets; n_slots divides
+     * 65536, so the slot of a count stays in order when the count wraps
+     */
+    uint16_t head;
+    uint16_t tail;
+
+    /*! Bytes in the packet being filled, slot head */
+    uint16_t fill_len;
+
+    /*! Longest time a partial packet is held */
+    uint32_t max_latency_us;
+
+    /*! Sends a packet */
+    ble_stream_send_fptr_t send;
+
+    /*! Passed to send */
+    void *intf_ptr;
+
+    /*! Counters */
+    struct ble_stream_stats stats;
+};
+
+/**********************************************************************************/
+/* functions */
+/**********************************************************************************/
+
+/*!
+ * @brief This API initializes a stream over the given storage.
+ *
+ * @param[in] buf            : Packet storage of n_slots * slot_size bytes.
+ * @param[in] slot_size      : Largest packet, the ATT payload of the largest MTU.
+ * @param[in] n_slots        : Number of packets, a power of two from 2 to
+ *                             BLE_STREAM_MAX_SLOTS.
+ * @param[in] max_latency_us : Longest time a partial packet is held.
+ * @param[in] send           : Sends a packet.
+ * @param[in] intf_ptr       : Passed to send.
+ * @param[out] stream        : Stream.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t ble_stream_init(uint8_t *buf,
+                       uint16_t slot_size,
+                       uint8_t n_slots,
+                       uint32_t max_latency_us,
+                       ble_stream_send_fptr_t send,
+                       void *intf_ptr,
+                       struct ble_stream *stream);
+
+/*!
+ * @brief This API sets the packet size after an MTU exchange. Queued packets
+ * are left as they are.
+ *
+ * @param[in] packet_size : ATT payload of the MTU, 1 to slot_size.
+ * @param[in,out] stream  : Stream.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t ble_stream_set_packet_size(uint16_t packet_size, struct ble_stream *stream);
+
+/*!
+ * @brief This API adds data to the stream and sends the packets it fills.
+ *
+ * @param[in] data       : Data.
+ * @param[in] len        : Length of data.
+ * @param[in] now_us     : Current time.
+ * @param[in,out] stream : Stream.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval > 0 -> Warning, BLE_STREAM_W_DROPPED: the data did not fit and was dropped
+ * @retval < 0 -> Fail
+ */
+int8_t ble_stream_write(const uint8_t *data, uint16_t len, uint32_t now_us, struct ble_stream *stream);
+
+/*!
+ * @brief This API sends the queued packets, and the partial packet once it has
+ * waited max_latency_us. Called periodically, e.g. from a timer or a low
+ * priority software interrupt.
+ *
+ * @param[in] now_us     : Current time.
+ * @param[in,out] stream : Stream.
+ *
+ * @return Number of packets sent
+ */
+uint8_t ble_stream_process(uint32_t now_us, struct ble_stream *stream);
+
+/*!
+ * @brief This API sends everything written, the partial packet included.
+ *
+ * @param[in] now_us     : Current time.
+ * @param[in,out] stream : Stream.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval > 0 -> Warning, BLE_STREAM_W_BUSY: packets are still waiting for the link
+ * @retval < 0 -> Fail
+ */
+int8_t ble_stream_flush(uint32_t now_us, struct ble_stream *stream);
+
+/*!
+ * @brief This API drops everything written and not sent, e.g. on disconnection.
+ *
+ * @param[in,out] stream : Stream.
+ */
+void ble_stream_discard(struct ble_stream *stream);
+
+/*!
+ * @brief This API returns the throughput between the first and the last packet.
+ *
+ * @param[in] stream : Stream.
+ *
+ * @return Bytes per second, 0 before two packets were sent
+ */
+uint32_t ble_stream_throughput(const struct ble_stream *stream);
+
+#endif /* BLE_STREAM_H_ */
@@ -48,6 +48,27 @@ static int8_t read_variant_id(struct bme68x_dev *dev);
 /* This internal API is used to calculate the gas wait */
 static uint8_t calc_gas_wait(uint16_t dur);
 
+/* This internal API is used to calculate the fine temperature in integer */
+static int32_t calc_t_fine_int(uint32_t temp_adc, const struct bme68x_calib_data *calib);
+
+/* This internal API is used to calculate the pressure in integer */
+static uint32_t calc_pressure_int(uint32_t pres_adc, int32_t t_fine, const struct bme68x_calib_data *calib);
+
+/* This internal API is used to calculate the humidity in integer */
+static uint32_t calc_humidity_int(uint16_t hum_adc, int32_t t_fine, const struct bme68x_calib_data *calib);
+
+/* This internal API is used to calculate the gas range dependent terms of the low gas variant */
+static void calc_gas_range_low_int(uint8_t gas_range, int8_t range_sw_err, int64_t *var1, int64_t *var3);
+
+/* This internal API is used to calculate the gas resistance of the low gas variant in integer */
+static uint32_t calc_gas_resistance_low_int(uint16_t gas_res_adc, int64_t var1, int64_t var3);
+
+/* This internal API is used to calculate the gas resistance of the high gas variant in integer */
+static uint32_t calc_gas_resistance_high_int(uint16_t gas_res_adc, uint8_t gas_range);
+
+/* This internal API is used to move the arrays of a batch to the next chunk of samples */
+static void advance_batch(struct bme68x_raw_batch *raw, struct bme68x_comp_batch *comp, uint32_t n_samples);
+
 #ifndef BME68X_USE_FPU
 
 /* This internal API is used to calculate the temperature in integer */
@@ -105,8 +126,14 @@ static int8_t get_mem_page(struct bme68x_dev *dev);
 /* This internal API is used to check the bme68x_dev for null pointers */
 static int8_t null_ptr_check(const struct bme68x_dev *dev);
 
-/* This internal API is used to set heater configurations */
-static int8_t set_conf(const struct bme68x_heatr_conf *conf, uint8_t op_mode, uint8_t *nb_conv, struct bme68x_dev *dev);
+/* This internal API is used to calculate the heater register values of a heater configuration */
+static int8_t calc_heatr_prof(const struct bme68x_heatr_conf *conf,
+                              uint8_t op_mode,
+                              struct bme68x_heatr_prof *prof,
+                              struct bme68x_dev *dev);
+
+/* This internal API is used to write the heater register values in a single transaction */
+static int8_t write_heatr_prof(const struct bme68x_heatr_prof *prof, struct bme68x_dev *dev);
 
 /* This internal API is used to limit the max value of a parameter */
 static int8_t boundary_check(uint8_t *value, uint8_t max, struct bme68x_dev *dev);
@@ -279,6 +306,9 @@ int8_t bme68x_soft_reset(struct bme68x_dev *dev)
     rslt = null_ptr_check(dev);
     if (rslt == BME68X_OK)
     {
+        /* Heater registers are reset along with the device */
+        dev->heatr_cache.len = 0;
+
         if (dev->intf == BME68X_SPI_INTF)
         {
             rslt = get_mem_page(dev);
@@ -532,6 +562,40 @@ uint32_t bme68x_get_meas_dur(const uint8_t op_mode, struct bme68x_conf *conf, st
     return meas_dur;
 }
 
+/*
+ * @brief This API waits for the expected measurement duration and then polls
+ * the new data bit until the measurement is complete.
+ */
+int8_t bme68x_wait_data(uint32_t meas_dur, struct bme68x_dev *dev)
+{
+    int8_t rslt;
+    uint8_t meas_status = 0;
+    uint32_t polls = (BME68X_PERIOD_POLL * 5) / BME68X_PERIOD_DATA_POLL;
+
+    rslt = null_ptr_check(dev);
+    if (rslt == BME68X_OK)
+    {
+        /* Nothing to poll for before the measurement is expected to be done */
+        dev->delay_us(meas_dur, dev->intf_ptr);
+
+        /* Poll the status byte of field 0 only, the sample is read once it is ready */
+        rslt = bme68x_get_regs(BME68X_REG_FIELD0, &meas_status, 1, dev);
+        while ((rslt == BME68X_OK) && !(meas_status & BME68X_NEW_DATA_MSK) && polls)
+        {
+            dev->delay_us(BME68X_PERIOD_DATA_POLL, dev->intf_ptr);
+            rslt = bme68x_get_regs(BME68X_REG_FIELD0, &meas_status, 1, dev);
+            polls--;
+        }
+
+        if ((rslt == BME68X_OK) && !(meas_status & BME68X_NEW_DATA_MSK))
+        {
+            rslt = BME68X_W_NO_NEW_DATA;
+        }
+    }
+
+    return rslt;
+}
+
 /*
  * @brief This API reads the pressure, temperature and humidity and gas data
  * from the sensor, compensates the data and store it in the bme68x_data
@@ -625,53 +689,413 @@ int8_t bme68x_get_data(uint8_t op_mode, struct bme68x_data *data, uint8_t *n_dat
 }
 
 /*
- * @brief This API is used to set the gas configuration of the sensor.
+ * @brief This API initializes a stream of parallel or sequential mode samples.
  */
-int8_t bme68x_set_heatr_conf(uint8_t op_mode, const struct bme68x_heatr_conf *conf, struct bme68x_dev *dev)
+int8_t bme68x_stream_init(uint8_t op_mode,
+                          struct bme68x_conf *conf,
+                          const struct bme68x_heatr_conf *heatr_conf,
+                          struct bme68x_stream *stream,
+                          struct bme68x_dev *dev)
 {
     int8_t rslt;
-    uint8_t nb_conv = 0;
-    uint8_t hctrl, run_gas = 0;
-    uint8_t ctrl_gas_data[2];
-    uint8_t ctrl_gas_addr[2] = { BME68X_REG_CTRL_GAS_0, BME68X_REG_CTRL_GAS_1 };
+    uint8_t i;
+    uint16_t heatr_dur = 0;
 
-    if (conf != NULL)
+    rslt = null_ptr_check(dev);
+    if ((rslt == BME68X_OK) && (conf != NULL) && (heatr_conf != NULL) && (stream != NULL))
     {
-        rslt = bme68x_set_op_mode(BME68X_SLEEP_MODE, dev);
-        if (rslt == BME68X_OK)
+        if (op_mode == BME68X_PARALLEL_MODE)
         {
-            rslt = set_conf(conf, op_mode, &nb_conv, dev);
+            heatr_dur = heatr_conf->shared_heatr_dur;
         }
-
-        if (rslt == BME68X_OK)
+        else if (op_mode == BME68X_SEQUENTIAL_MODE)
         {
-            rslt = bme68x_get_regs(BME68X_REG_CTRL_GAS_0, ctrl_gas_data, 2, dev);
-            if (rslt == BME68X_OK)
+            if (heatr_conf->heatr_dur_prof != NULL)
             {
-                if (conf->enable == BME68X_ENABLE)
+                /* A new field can not be ready earlier than the shortest heater step */
+                heatr_dur = UINT16_C(0xFFFF);
+                for (i = 0; i < heatr_conf->profile_len; i++)
                 {
-                    hctrl = BME68X_ENABLE_HEATER;
-                    if (dev->variant_id == BME68X_VARIANT_GAS_HIGH)
+                    if (heatr_conf->heatr_dur_prof[i] < heatr_dur)
                     {
-                        run_gas = BME68X_ENABLE_GAS_MEAS_H;
+                        heatr_dur = heatr_conf->heatr_dur_prof[i];
                     }
-                    else
+                }
+
+                if (heatr_conf->profile_len == 0)
+                {
+                    heatr_dur = 0;
+                }
+            }
+            else
+            {
+                rslt = BME68X_E_NULL_PTR;
+            }
+        }
+        else
+        {
+            rslt = BME68X_W_DEFINE_OP_MODE;
+        }
+
+        if (rslt == BME68X_OK)
+        {
+            stream->op_mode = op_mode;
+            stream->field_period = bme68x_get_meas_dur(op_mode, conf, dev) + ((uint32_t)heatr_dur * 1000);
+            stream->next_read = 0;
+            stream->last_meas_index = 0;
+            stream->started = BME68X_DISABLE;
+            stream->n_lost = 0;
+            stream->n_reads = 0;
+        }
+    }
+    else
+    {
+        rslt = BME68X_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API reads the samples of a parallel or sequential mode stream
+ * which were not delivered yet, ordered by measurement index.
+ */
+int8_t bme68x_stream_read(uint32_t now_us,
+                          struct bme68x_data *data,
+                          uint8_t *n_data,
+                          struct bme68x_stream *stream,
+                          struct bme68x_dev *dev)
+{
+    int8_t rslt;
+    uint8_t i, j;
+    uint8_t new_fields = 0;
+    uint8_t age[3];
+    uint8_t gap;
+    uint8_t oldest;
+    uint8_t first_read = BME68X_DISABLE;
+    struct bme68x_data *field_ptr[3];
+    struct bme68x_data field_data[3] = { { 0 } };
+    struct bme68x_data *tmp_ptr;
+
+    rslt = null_ptr_check(dev);
+    if ((rslt == BME68X_OK) && (data != NULL) && (n_data != NULL) && (stream != NULL))
+    {
+        *n_data = 0;
+
+        /* Nothing to read before the next field is expected */
+        if ((stream->started == BME68X_ENABLE) && ((int32_t)(now_us - stream->next_read) < 0))
+        {
+            return BME68X_W_NO_NEW_DATA;
+        }
+
+        for (i = 0; i < 3; i++)
+        {
+            field_ptr[i] = &field_data[i];
+        }
+
+        rslt = read_all_field_data(field_ptr, dev);
+        stream->n_reads++;
+
+        /* Keep the fields which are newer than the last delivered one */
+        for (i = 0; (i < 3) && (rslt == BME68X_OK); i++)
+        {
+            age[new_fields] = (uint8_t)(field_data[i].meas_index - stream->last_meas_index);
+            if ((field_data[i].status & BME68X_NEW_DATA_MSK) &&
+                ((stream->started == BME68X_DISABLE) || ((age[new_fields] > 0) && (age[new_fields] < 0x80))))
+            {
+                field_ptr[new_fields++] = &field_data[i];
+            }
+        }
+
+        /* On the first read there is no last index, ages count from the oldest field */
+        if (stream->started == BME68X_DISABLE)
+        {
+            first_read = BME68X_ENABLE;
+            oldest = 0;
+            for (i = 0; i < new_fields; i++)
+            {
+                for (j = 0; j < new_fields; j++)
+                {
+                    if ((uint8_t)(field_ptr[j]->meas_index - field_ptr[i]->meas_index) >= 0x80)
                     {
-                        run_gas = BME68X_ENABLE_GAS_MEAS_L;
+                        break;
                     }
                 }
-                else
+
+                if (j == new_fields)
                 {
-                    hctrl = BME68X_DISABLE_HEATER;
-                    run_gas = BME68X_DISABLE_GAS_MEAS;
+                    oldest = field_ptr[i]->meas_index;
+                    break;
                 }
+            }
 
-                ctrl_gas_data[0] = BME68X_SET_BITS(ctrl_gas_data[0], BME68X_HCTRL, hctrl);
-                ctrl_gas_data[1] = BME68X_SET_BITS_POS_0(ctrl_gas_data[1], BME68X_NBCONV, nb_conv);
-                ctrl_gas_data[1] = BME68X_SET_BITS(ctrl_gas_data[1], BME68X_RUN_GAS, run_gas);
-                rslt = bme68x_set_regs(ctrl_gas_addr, ctrl_gas_data, 2, dev);
+            for (i = 0; i < new_fields; i++)
+            {
+                age[i] = (uint8_t)(field_ptr[i]->meas_index - oldest);
             }
         }
+
+        /* Order by measurement index, oldest first */
+        for (i = 0; (i + 1) < new_fields; i++)
+        {
+            for (j = i + 1; j < new_fields; j++)
+            {
+                if (age[j] < age[i])
+                {
+                    tmp_ptr = field_ptr[i];
+                    field_ptr[i] = field_ptr[j];
+                    field_ptr[j] = tmp_ptr;
+                    gap = age[i];
+                    age[i] = age[j];
+                    age[j] = gap;
+                }
+            }
+        }
+
+        for (i = 0; i < new_fields; i++)
+        {
+            if (first_read == BME68X_DISABLE)
+            {
+                /* Missing measurement indices were overwritten before being read */
+                gap = (uint8_t)(field_ptr[i]->meas_index - stream->last_meas_index - 1);
+                if (gap)
+                {
+                    stream->n_lost += gap;
+                    rslt = BME68X_W_STREAM_GAP;
+                }
+            }
+
+            stream->started = BME68X_ENABLE;
+            stream->last_meas_index = field_ptr[i]->meas_index;
+            data[i] = *field_ptr[i];
+        }
+
+        *n_data = new_fields;
+        if (new_fields)
+        {
+            stream->next_read = now_us + stream->field_period;
+        }
+        else if (rslt == BME68X_OK)
+        {
+            stream->next_read = now_us + BME68X_PERIOD_DATA_POLL;
+            rslt = BME68X_W_NO_NEW_DATA;
+        }
+    }
+    else
+    {
+        rslt = BME68X_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API compensates arrays of raw ADC values with the integer
+ * compensation formulas.
+ */
+int8_t bme68x_compensate_batch(const struct bme68x_raw_batch *raw,
+                               const struct bme68x_comp_batch *comp,
+                               uint32_t n_samples,
+                               const struct bme68x_dev *dev)
+{
+    int8_t rslt = BME68X_OK;
+    uint32_t base;
+    uint32_t n;
+    uint32_t i;
+    uint32_t n_todo = 0;
+    uint8_t gas_range;
+    int32_t t_fine[BME68X_COMP_BATCH_CHUNK];
+    int64_t gas_var1[16];
+    int64_t gas_var3[16];
+
+    /* Local copies, so the output stores can not alias the inputs of the loops */
+    struct bme68x_raw_batch in = { 0 };
+    struct bme68x_comp_batch out = { 0 };
+    struct bme68x_calib_data calib = { 0 };
+
+    if ((raw == NULL) || (comp == NULL) || (dev == NULL) || (raw->temp_adc == NULL))
+    {
+        rslt = BME68X_E_NULL_PTR;
+    }
+    else if (((comp->pressure != NULL) && (raw->pres_adc == NULL)) ||
+             ((comp->humidity != NULL) && (raw->hum_adc == NULL)) ||
+             ((comp->gas_resistance != NULL) && ((raw->gas_adc == NULL) || (raw->gas_range == NULL))))
+    {
+        rslt = BME68X_E_NULL_PTR;
+    }
+    else
+    {
+        in = *raw;
+        out = *comp;
+        calib = dev->calib;
+        n_todo = n_samples;
+    }
+
+    /* The gas range dependent terms only depend on the calibration */
+    if ((out.gas_resistance != NULL) && (dev->variant_id != BME68X_VARIANT_GAS_HIGH))
+    {
+        for (gas_range = 0; gas_range < 16; gas_range++)
+        {
+            calc_gas_range_low_int(gas_range, calib.range_sw_err, &gas_var1[gas_range], &gas_var3[gas_range]);
+        }
+    }
+
+    /* Each quantity is compensated in its own loop over a chunk, so every
+     * loop body is straight-line code the compiler can vectorize
+     */
+    for (base = 0; base < n_todo; base += n)
+    {
+        n = n_todo - base;
+        if (n > BME68X_COMP_BATCH_CHUNK)
+        {
+            n = BME68X_COMP_BATCH_CHUNK;
+        }
+
+        if (base != 0)
+        {
+            advance_batch(&in, &out, BME68X_COMP_BATCH_CHUNK);
+        }
+
+        for (i = 0; i < n; i++)
+        {
+            t_fine[i] = calc_t_fine_int(in.temp_adc[i], &calib);
+        }
+
+        if (out.temperature != NULL)
+        {
+            for (i = 0; i < n; i++)
+            {
+                /*lint -save -e702 */
+                out.temperature[i] = (int16_t)(((t_fine[i] * 5) + 128) >> 8);
+
+                /*lint -restore */
+            }
+        }
+
+        if (out.pressure != NULL)
+        {
+            for (i = 0; i < n; i++)
+            {
+                out.pressure[i] = calc_pressure_int(in.pres_adc[i], t_fine[i], &calib);
+            }
+        }
+
+        if (out.humidity != NULL)
+        {
+            for (i = 0; i < n; i++)
+            {
+                out.humidity[i] = calc_humidity_int(in.hum_adc[i], t_fine[i], &calib);
+            }
+        }
+
+        if (out.gas_resistance == NULL)
+        {
+            /* Gas resistance not requested */
+        }
+        else if (dev->variant_id == BME68X_VARIANT_GAS_HIGH)
+        {
+            for (i = 0; i < n; i++)
+            {
+                gas_range = in.gas_range[i] & BME68X_GAS_RANGE_MSK;
+                out.gas_resistance[i] = calc_gas_resistance_high_int(in.gas_adc[i], gas_range);
+            }
+        }
+        else
+        {
+            for (i = 0; i < n; i++)
+            {
+                gas_range = in.gas_range[i] & BME68X_GAS_RANGE_MSK;
+                out.gas_resistance[i] = calc_gas_resistance_low_int(in.gas_adc[i],
+                                                                           gas_var1[gas_range],
+                                                                           gas_var3[gas_range]);
+            }
+        }
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API is used to set the gas configuration of the sensor.
+ */
+int8_t bme68x_set_heatr_conf(uint8_t op_mode, const struct bme68x_heatr_conf *conf, struct bme68x_dev *dev)
+{
+    int8_t rslt;
+    struct bme68x_heatr_prof prof;
+
+    if (conf != NULL)
+    {
+        rslt = bme68x_set_op_mode(BME68X_SLEEP_MODE, dev);
+        if (rslt == BME68X_OK)
+        {
+            rslt = calc_heatr_prof(conf, op_mode, &prof, dev);
+        }
+
+        if (rslt == BME68X_OK)
+        {
+            rslt = write_heatr_prof(&prof, dev);
+        }
+    }
+    else
+    {
+        rslt = BME68X_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API is used to precompute the heater register values of a
+ * heater configuration for the current calibration and ambient temperature.
+ */
+int8_t bme68x_compile_heatr_prof(uint8_t op_mode,
+                                 const struct bme68x_heatr_conf *conf,
+                                 struct bme68x_heatr_prof *prof,
+                                 struct bme68x_dev *dev)
+{
+    int8_t rslt;
+
+    rslt = null_ptr_check(dev);
+    if ((rslt == BME68X_OK) && (conf != NULL) && (prof != NULL))
+    {
+        rslt = calc_heatr_prof(conf, op_mode, prof, dev);
+    }
+    else
+    {
+        rslt = BME68X_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API is used to switch the sensor to a compiled heater profile.
+ */
+int8_t bme68x_apply_heatr_prof(struct bme68x_heatr_prof *prof, struct bme68x_dev *dev)
+{
+    int8_t rslt;
+    int16_t amb_drift;
+
+    rslt = null_ptr_check(dev);
+    if ((rslt == BME68X_OK) && (prof != NULL))
+    {
+        /* Heater resistance depends on the ambient temperature, recompile if it drifted too far */
+        amb_drift = (int16_t)dev->amb_temp - (int16_t)prof->amb_temp;
+        if ((prof->conf != NULL) &&
+            ((amb_drift > BME68X_HEATR_PROF_AMB_DRIFT) || (amb_drift < -BME68X_HEATR_PROF_AMB_DRIFT)))
+        {
+            rslt = calc_heatr_prof(prof->conf, prof->op_mode, prof, dev);
+        }
+
+        if (rslt == BME68X_OK)
+        {
+            rslt = bme68x_set_op_mode(BME68X_SLEEP_MODE, dev);
+        }
+
+        if (rslt == BME68X_OK)
+        {
+            rslt = write_heatr_prof(prof, dev);
+        }
     }
     else
     {
@@ -734,6 +1158,7 @@ int8_t bme68x_selftest_check(const struct bme68x_dev *dev)
 
     /* Copy required parameters from reference bme68x_dev struct */
     t_dev.amb_temp = 25;
+    t_dev.skip_idac_read = BME68X_DISABLE;
     t_dev.read = dev->read;
     t_dev.write = dev->write;
     t_dev.intf = dev->intf;
@@ -825,153 +1250,40 @@ int8_t bme68x_selftest_check(const struct bme68x_dev *dev)
 /* @brief This internal API is used to calculate the temperature value. */
 static int16_t calc_temperature(uint32_t temp_adc, struct bme68x_dev *dev)
 {
-    int64_t var1;
-    int64_t var2;
-    int64_t var3;
-    int16_t calc_temp;
-
-    /*lint -save -e701 -e702 -e704 */
-    var1 = ((int32_t)temp_adc >> 3) - ((int32_t)dev->calib.par_t1 << 1);
-    var2 = (var1 * (int32_t)dev->calib.par_t2) >> 11;
-    var3 = ((var1 >> 1) * (var1 >> 1)) >> 12;
-    var3 = ((var3) * ((int32_t)dev->calib.par_t3 << 4)) >> 14;
-    dev->calib.t_fine = (int32_t)(var2 + var3);
-    calc_temp = (int16_t)(((dev->calib.t_fine * 5) + 128) >> 8);
+    /*lint -save -e702 */
+    dev->calib.t_fine = calc_t_fine_int(temp_adc, &dev->calib);
 
     /*lint -restore */
-    return calc_temp;
+    return (int16_t)(((dev->calib.t_fine * 5) + 128) >> 8);
 }
 
 /* @brief This internal API is used to calculate the pressure value. */
 static uint32_t calc_pressure(uint32_t pres_adc, const struct bme68x_dev *dev)
 {
-    int32_t var1;
-    int32_t var2;
-    int32_t var3;
-    int32_t pressure_comp;
-
-    /* This value is used to check precedence to multiplication or division
-     * in the pressure compensation equation to achieve least loss of precision and
-     * avoiding overflows.
-     * i.e Comparing value, pres_ovf_check = (1 << 31) >> 1
-     */
-    const int32_t pres_ovf_check = INT32_C(0x40000000);
-
-    /*lint -save -e701 -e702 -e713 */
-    var1 = (((int32_t)dev->calib.t_fine) >> 1) - 64000;
-    var2 = ((((var1 >> 2) * (var1 >> 2)) >> 11) * (int32_t)dev->calib.par_p6) >> 2;
-    var2 = var2 + ((var1 * (int32_t)dev->calib.par_p5) << 1);
-    var2 = (var2 >> 2) + ((int32_t)dev->calib.par_p4 << 16);
-    var1 = (((((var1 >> 2) * (var1 >> 2)) >> 13) * ((int32_t)dev->calib.par_p3 << 5)) >> 3) +
-           (((int32_t)dev->calib.par_p2 * var1) >> 1);
-    var1 = var1 >> 18;
-    var1 = ((32768 + var1) * (int32_t)dev->calib.par_p1) >> 15;
-    pressure_comp = 1048576 - pres_adc;
-    pressure_comp = (int32_t)((pressure_comp - (var2 >> 12)) * ((uint32_t)3125));
-    if (pressure_comp >= pres_ovf_check)
-    {
-        pressure_comp = ((pressure_comp / var1) << 1);
-    }
-    else
-    {
-        pressure_comp = ((pressure_comp << 1) / var1);
-    }
-
-    var1 = ((int32_t)dev->calib.par_p9 * (int32_t)(((pressure_comp >> 3) * (pressure_comp >> 3)) >> 13)) >> 12;
-    var2 = ((int32_t)(pressure_comp >> 2) * (int32_t)dev->calib.par_p8) >> 13;
-    var3 =
-        ((int32_t)(pressure_comp >> 8) * (int32_t)(pressure_comp >> 8) * (int32_t)(pressure_comp >> 8) *
-         (int32_t)dev->calib.par_p10) >> 17;
-    pressure_comp = (int32_t)(pressure_comp) + ((var1 + var2 + var3 + ((int32_t)dev->calib.par_p7 << 7)) >> 4);
-
-    /*lint -restore */
-    return (uint32_t)pressure_comp;
+    return calc_pressure_int(pres_adc, dev->calib.t_fine, &dev->calib);
 }
 
 /* This internal API is used to calculate the humidity in integer */
 static uint32_t calc_humidity(uint16_t hum_adc, const struct bme68x_dev *dev)
 {
-    int32_t var1;
-    int32_t var2;
-    int32_t var3;
-    int32_t var4;
-    int32_t var5;
-    int32_t var6;
-    int32_t temp_scaled;
-    int32_t calc_hum;
-
-    /*lint -save -e702 -e704 */
-    temp_scaled = (((int32_t)dev->calib.t_fine * 5) + 128) >> 8;
-    var1 = (int32_t)(hum_adc - ((int32_t)((int32_t)dev->calib.par_h1 * 16))) -
-           (((temp_scaled * (int32_t)dev->calib.par_h3) / ((int32_t)100)) >> 1);
-    var2 =
-        ((int32_t)dev->calib.par_h2 *
-         (((temp_scaled * (int32_t)dev->calib.par_h4) / ((int32_t)100)) +
-          (((temp_scaled * ((temp_scaled * (int32_t)dev->calib.par_h5) / ((int32_t)100))) >> 6) / ((int32_t)100)) +
-          (int32_t)(1 << 14))) >> 10;
-    var3 = var1 * var2;
-    var4 = (int32_t)dev->calib.par_h6 << 7;
-    var4 = ((var4) + ((temp_scaled * (int32_t)dev->calib.par_h7) / ((int32_t)100))) >> 4;
-    var5 = ((var3 >> 14) * (var3 >> 14)) >> 10;
-    var6 = (var4 * var5) >> 1;
-    calc_hum = (((var3 + var6) >> 10) * ((int32_t)1000)) >> 12;
-    if (calc_hum > 100000) /* Cap at 100%rH */
-    {
-        calc_hum = 100000;
-    }
-    else if (calc_hum < 0)
-    {
-        calc_hum = 0;
-    }
-
-    /*lint -restore */
-    return (uint32_t)calc_hum;
+    return calc_humidity_int(hum_adc, dev->calib.t_fine, &dev->calib);
 }
 
 /* This internal API is used to calculate the gas resistance low */
 static uint32_t calc_gas_resistance_low(uint16_t gas_res_adc, uint8_t gas_range, const struct bme68x_dev *dev)
 {
     int64_t var1;
-    uint64_t var2;
     int64_t var3;
-    uint32_t calc_gas_res;
-    uint32_t lookup_table1[16] = {
-        UINT32_C(2147483647), UINT32_C(2147483647), UINT32_C(2147483647), UINT32_C(2147483647), UINT32_C(2147483647),
-        UINT32_C(2126008810), UINT32_C(2147483647), UINT32_C(2130303777), UINT32_C(2147483647), UINT32_C(2147483647),
-        UINT32_C(2143188679), UINT32_C(2136746228), UINT32_C(2147483647), UINT32_C(2126008810), UINT32_C(2147483647),
-        UINT32_C(2147483647)
-    };
-    uint32_t lookup_table2[16] = {
-        UINT32_C(4096000000), UINT32_C(2048000000), UINT32_C(1024000000), UINT32_C(512000000), UINT32_C(255744255),
-        UINT32_C(127110228), UINT32_C(64000000), UINT32_C(32258064), UINT32_C(16016016), UINT32_C(8000000), UINT32_C(
-            4000000), UINT32_C(2000000), UINT32_C(1000000), UINT32_C(500000), UINT32_C(250000), UINT32_C(125000)
-    };
 
-    /*lint -save -e704 */
-    var1 = (int64_t)((1340 + (5 * (int64_t)dev->calib.range_sw_err)) * ((int64_t)lookup_table1[gas_range])) >> 16;
-    var2 = (((int64_t)((int64_t)gas_res_adc << 15) - (int64_t)(16777216)) + var1);
-    var3 = (((int64_t)lookup_table2[gas_range] * (int64_t)var1) >> 9);
-    calc_gas_res = (uint32_t)((var3 + ((int64_t)var2 >> 1)) / (int64_t)var2);
+    calc_gas_range_low_int(gas_range, dev->calib.range_sw_err, &var1, &var3);
 
-    /*lint -restore */
-    return calc_gas_res;
+    return calc_gas_resistance_low_int(gas_res_adc, var1, var3);
 }
 
 /* This internal API is used to calculate the gas resistance */
 static uint32_t calc_gas_resistance_high(uint16_t gas_res_adc, uint8_t gas_range)
 {
-    uint32_t calc_gas_res;
-    uint32_t var1 = UINT32_C(262144) >> gas_range;
-    int32_t var2 = (int32_t)gas_res_adc - INT32_C(512);
-
-    var2 *= INT32_C(3);
-    var2 = INT32_C(4096) + var2;
-
-    /* multiplying 10000 then dividing then multiplying by 100 instead of multiplying by 1000000 to prevent overflow */
-    calc_gas_res = (UINT32_C(10000) * var1) / (uint32_t)var2;
-    calc_gas_res = calc_gas_res * 100;
-
-    return calc_gas_res;
+    return calc_gas_resistance_high_int(gas_res_adc, gas_range);
 }
 
 /* This internal API is used to calculate the heater resistance value using float */
@@ -1163,6 +1475,171 @@ static uint8_t calc_res_heat(uint16_t temp, const struct bme68x_dev *dev)
 
 #endif
 
+/* Gas range dependent constants of the low gas variant */
+static const uint32_t gas_range_lookup1[16] = {
+    UINT32_C(2147483647), UINT32_C(2147483647), UINT32_C(2147483647), UINT32_C(2147483647), UINT32_C(2147483647),
+    UINT32_C(2126008810), UINT32_C(2147483647), UINT32_C(2130303777), UINT32_C(2147483647), UINT32_C(2147483647),
+    UINT32_C(2143188679), UINT32_C(2136746228), UINT32_C(2147483647), UINT32_C(2126008810), UINT32_C(2147483647),
+    UINT32_C(2147483647)
+};
+static const uint32_t gas_range_lookup2[16] = {
+    UINT32_C(4096000000), UINT32_C(2048000000), UINT32_C(1024000000), UINT32_C(512000000), UINT32_C(255744255),
+    UINT32_C(127110228), UINT32_C(64000000), UINT32_C(32258064), UINT32_C(16016016), UINT32_C(8000000), UINT32_C(
+        4000000), UINT32_C(2000000), UINT32_C(1000000), UINT32_C(500000), UINT32_C(250000), UINT32_C(125000)
+};
+
+/* This internal API is used to calculate the fine temperature in integer */
+static int32_t calc_t_fine_int(uint32_t temp_adc, const struct bme68x_calib_data *calib)
+{
+    int64_t var1;
+    int64_t var2;
+    int64_t var3;
+
+    /*lint -save -e701 -e702 -e704 */
+    var1 = ((int32_t)temp_adc >> 3) - ((int32_t)calib->par_t1 << 1);
+    var2 = (var1 * (int32_t)calib->par_t2) >> 11;
+    var3 = ((var1 >> 1) * (var1 >> 1)) >> 12;
+    var3 = ((var3) * ((int32_t)calib->par_t3 << 4)) >> 14;
+
+    /*lint -restore */
+    return (int32_t)(var2 + var3);
+}
+
+/* This internal API is used to calculate the pressure in integer */
+static uint32_t calc_pressure_int(uint32_t pres_adc, int32_t t_fine, const struct bme68x_calib_data *calib)
+{
+    int32_t var1;
+    int32_t var2;
+    int32_t var3;
+    int32_t pressure_comp;
+
+    /* This value is used to check precedence to multiplication or division
+     * in the pressure compensation equation to achieve least loss of precision and
+     * avoiding overflows.
+     * i.e Comparing value, pres_ovf_check = (1 << 31) >> 1
+     */
+    const int32_t pres_ovf_check = INT32_C(0x40000000);
+
+    /*lint -save -e701 -e702 -e713 */
+    var1 = (t_fine >> 1) - 64000;
+    var2 = ((((var1 >> 2) * (var1 >> 2)) >> 11) * (int32_t)calib->par_p6) >> 2;
+    var2 = var2 + ((var1 * (int32_t)calib->par_p5) << 1);
+    var2 = (var2 >> 2) + ((int32_t)calib->par_p4 << 16);
+    var1 = (((((var1 >> 2) * (var1 >> 2)) >> 13) * ((int32_t)calib->par_p3 << 5)) >> 3) +
+           (((int32_t)calib->par_p2 * var1) >> 1);
+    var1 = var1 >> 18;
+    var1 = ((32768 + var1) * (int32_t)calib->par_p1) >> 15;
+    pressure_comp = 1048576 - pres_adc;
+    pressure_comp = (int32_t)((pressure_comp - (var2 >> 12)) * ((uint32_t)3125));
+    if (pressure_comp >= pres_ovf_check)
+    {
+        pressure_comp = ((pressure_comp / var1) << 1);
+    }
+    else
+    {
+        pressure_comp = ((pressure_comp << 1) / var1);
+    }
+
+    var1 = ((int32_t)calib->par_p9 * (int32_t)(((pressure_comp >> 3) * (pressure_comp >> 3)) >> 13)) >> 12;
+    var2 = ((int32_t)(pressure_comp >> 2) * (int32_t)calib->par_p8) >> 13;
+    var3 =
+        ((int32_t)(pressure_comp >> 8) * (int32_t)(pressure_comp >> 8) * (int32_t)(pressure_comp >> 8) *
+         (int32_t)calib->par_p10) >> 17;
+    pressure_comp = (int32_t)(pressure_comp) + ((var1 + var2 + var3 + ((int32_t)calib->par_p7 << 7)) >> 4);
+
+    /*lint -restore */
+    return (uint32_t)pressure_comp;
+}
+
+/* This internal API is used to calculate the humidity in integer */
+static uint32_t calc_humidity_int(uint16_t hum_adc, int32_t t_fine, const struct bme68x_calib_data *calib)
+{
+    int32_t var1;
+    int32_t var2;
+    int32_t var3;
+    int32_t var4;
+    int32_t var5;
+    int32_t var6;
+    int32_t temp_scaled;
+    int32_t calc_hum;
+
+    /*lint -save -e702 -e704 */
+    temp_scaled = ((t_fine * 5) + 128) >> 8;
+    var1 = (int32_t)(hum_adc - ((int32_t)((int32_t)calib->par_h1 * 16))) -
+           (((temp_scaled * (int32_t)calib->par_h3) / ((int32_t)100)) >> 1);
+    var2 =
+        ((int32_t)calib->par_h2 *
+         (((temp_scaled * (int32_t)calib->par_h4) / ((int32_t)100)) +
+          (((temp_scaled * ((temp_scaled * (int32_t)calib->par_h5) / ((int32_t)100))) >> 6) / ((int32_t)100)) +
+          (int32_t)(1 << 14))) >> 10;
+    var3 = var1 * var2;
+    var4 = (int32_t)calib->par_h6 << 7;
+    var4 = ((var4) + ((temp_scaled * (int32_t)calib->par_h7) / ((int32_t)100))) >> 4;
+    var5 = ((var3 >> 14) * (var3 >> 14)) >> 10;
+    var6 = (var4 * var5) >> 1;
+    calc_hum = (((var3 + var6) >> 10) * ((int32_t)1000)) >> 12;
+
+    /* Cap at 100%rH, written as selects so batch loops stay branch free */
+    calc_hum = (calc_hum > 100000) ? 100000 : calc_hum;
+    calc_hum = (calc_hum < 0) ? 0 : calc_hum;
+
+    /*lint -restore */
+    return (uint32_t)calc_hum;
+}
+
+/* This internal API is used to calculate the gas range dependent terms of the low gas variant */
+static void calc_gas_range_low_int(uint8_t gas_range, int8_t range_sw_err, int64_t *var1, int64_t *var3)
+{
+    /*lint -save -e704 */
+    *var1 = (int64_t)((1340 + (5 * (int64_t)range_sw_err)) * ((int64_t)gas_range_lookup1[gas_range])) >> 16;
+    *var3 = (((int64_t)gas_range_lookup2[gas_range] * (int64_t)*var1) >> 9);
+
+    /*lint -restore */
+}
+
+/* This internal API is used to calculate the gas resistance of the low gas variant in integer */
+static uint32_t calc_gas_resistance_low_int(uint16_t gas_res_adc, int64_t var1, int64_t var3)
+{
+    uint64_t var2;
+
+    /*lint -save -e704 */
+    var2 = (((int64_t)((int64_t)gas_res_adc << 15) - (int64_t)(16777216)) + var1);
+
+    /*lint -restore */
+    return (uint32_t)((var3 + ((int64_t)var2 >> 1)) / (int64_t)var2);
+}
+
+/* This internal API is used to calculate the gas resistance of the high gas variant in integer */
+static uint32_t calc_gas_resistance_high_int(uint16_t gas_res_adc, uint8_t gas_range)
+{
+    uint32_t calc_gas_res;
+    uint32_t var1 = UINT32_C(262144) >> gas_range;
+    int32_t var2 = (int32_t)gas_res_adc - INT32_C(512);
+
+    var2 *= INT32_C(3);
+    var2 = INT32_C(4096) + var2;
+
+    /* multiplying 10000 then dividing then multiplying by 100 instead of multiplying by 1000000 to prevent overflow */
+    calc_gas_res = (UINT32_C(10000) * var1) / (uint32_t)var2;
+    calc_gas_res = calc_gas_res * 100;
+
+    return calc_gas_res;
+}
+
+/* This internal API is used to move the arrays of a batch to the next chunk of samples */
+static void advance_batch(struct bme68x_raw_batch *raw, struct bme68x_comp_batch *comp, uint32_t n_samples)
+{
+    raw->temp_adc += n_samples;
+    raw->pres_adc = (raw->pres_adc != NULL) ? (raw->pres_adc + n_samples) : NULL;
+    raw->hum_adc = (raw->hum_adc != NULL) ? (raw->hum_adc + n_samples) : NULL;
+    raw->gas_adc = (raw->gas_adc != NULL) ? (raw->gas_adc + n_samples) : NULL;
+    raw->gas_range = (raw->gas_range != NULL) ? (raw->gas_range + n_samples) : NULL;
+    comp->temperature = (comp->temperature != NULL) ? (comp->temperature + n_samples) : NULL;
+    comp->pressure = (comp->pressure != NULL) ? (comp->pressure + n_samples) : NULL;
+    comp->humidity = (comp->humidity != NULL) ? (comp->humidity + n_samples) : NULL;
+    comp->gas_resistance = (comp->gas_resistance != NULL) ? (comp->gas_resistance + n_samples) : NULL;
+}
+
 /* This internal API is used to calculate the gas wait */
 static uint8_t calc_gas_wait(uint16_t dur)
 {
@@ -1236,15 +1713,25 @@ static int8_t read_field_data(uint8_t index, struct bme68x_data *data, struct bm
 
         if ((data->status & BME68X_NEW_DATA_MSK) && (rslt == BME68X_OK))
         {
-            rslt = bme68x_get_regs(BME68X_REG_RES_HEAT0 + data->gas_index, &data->res_heat, 1, dev);
-            if (rslt == BME68X_OK)
+            if (data->gas_index < dev->heatr_cache.len)
             {
-                rslt = bme68x_get_regs(BME68X_REG_IDAC_HEAT0 + data->gas_index, &data->idac, 1, dev);
+                /* Heater settings were written by the driver, no need to read them back */
+                data->res_heat = dev->heatr_cache.res_heat[data->gas_index];
+                data->gas_wait = dev->heatr_cache.gas_wait[data->gas_index];
+            }
+            else
+            {
+                rslt = bme68x_get_regs(BME68X_REG_RES_HEAT0 + data->gas_index, &data->res_heat, 1, dev);
+                if (rslt == BME68X_OK)
+                {
+                    rslt = bme68x_get_regs(BME68X_REG_GAS_WAIT0 + data->gas_index, &data->gas_wait, 1, dev);
+                }
             }
 
-            if (rslt == BME68X_OK)
+            data->idac = 0;
+            if ((rslt == BME68X_OK) && (dev->skip_idac_read != BME68X_ENABLE))
             {
-                rslt = bme68x_get_regs(BME68X_REG_GAS_WAIT0 + data->gas_index, &data->gas_wait, 1, dev);
+                rslt = bme68x_get_regs(BME68X_REG_IDAC_HEAT0 + data->gas_index, &data->idac, 1, dev);
             }
 
             if (rslt == BME68X_OK)
@@ -1289,6 +1776,7 @@ static int8_t read_all_field_data(struct bme68x_data * const data[], struct bme6
     uint8_t off;
     uint8_t set_val[30] = { 0 }; /* idac, res_heat, gas_wait */
     uint8_t i;
+    uint8_t read_set_val = (dev->skip_idac_read == BME68X_ENABLE) ? BME68X_DISABLE : BME68X_ENABLE;
 
     if (!data[0] && !data[1] && !data[2])
     {
@@ -1300,10 +1788,27 @@ static int8_t read_all_field_data(struct bme68x_data * const data[], struct bme6
         rslt = bme68x_get_regs(BME68X_REG_FIELD0, buff, (uint32_t) BME68X_LEN_FIELD * 3, dev);
     }
 
-    if (rslt == BME68X_OK)
+    /* Heater settings only need to be read back if they are not cached */
+    for (i = 0; ((i < 3) && (rslt == BME68X_OK)); i++)
+    {
+        if ((buff[i * BME68X_LEN_FIELD] & BME68X_GAS_INDEX_MSK) >= dev->heatr_cache.len)
+        {
+            read_set_val = BME68X_ENABLE;
+        }
+    }
+
+    if ((rslt == BME68X_OK) && (read_set_val == BME68X_ENABLE))
     {
         rslt = bme68x_get_regs(BME68X_REG_IDAC_HEAT0, set_val, 30, dev);
     }
+    else
+    {
+        for (i = 0; i < dev->heatr_cache.len; i++)
+        {
+            set_val[10 + i] = dev->heatr_cache.res_heat[i];
+            set_val[20 + i] = dev->heatr_cache.gas_wait[i];
+        }
+    }
 
     for (i = 0; ((i < 3) && (rslt == BME68X_OK)); i++)
     {
@@ -1461,47 +1966,30 @@ static int8_t null_ptr_check(const struct bme68x_dev *dev)
     return rslt;
 }
 
-/* This internal API is used to set heater configurations */
-static int8_t set_conf(const struct bme68x_heatr_conf *conf, uint8_t op_mode, uint8_t *nb_conv, struct bme68x_dev *dev)
+/* This internal API is used to calculate the heater register values of a heater configuration */
+static int8_t calc_heatr_prof(const struct bme68x_heatr_conf *conf,
+                              uint8_t op_mode,
+                              struct bme68x_heatr_prof *prof,
+                              struct bme68x_dev *dev)
 {
     int8_t rslt = BME68X_OK;
     uint8_t i;
-    uint8_t shared_dur;
-    uint8_t write_len = 0;
-    uint8_t heater_dur_shared_addr = BME68X_REG_SHD_HEATR_DUR;
-    uint8_t rh_reg_addr[10] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
-    uint8_t rh_reg_data[10] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
-    uint8_t gw_reg_addr[10] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
-    uint8_t gw_reg_data[10] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+    prof->conf = conf;
+    prof->op_mode = op_mode;
+    prof->amb_temp = dev->amb_temp;
+    prof->enable = conf->enable;
+    prof->shared_dur = 0;
 
     switch (op_mode)
     {
         case BME68X_FORCED_MODE:
-            rh_reg_addr[0] = BME68X_REG_RES_HEAT0;
-            rh_reg_data[0] = calc_res_heat(conf->heatr_temp, dev);
-            gw_reg_addr[0] = BME68X_REG_GAS_WAIT0;
-            gw_reg_data[0] = calc_gas_wait(conf->heatr_dur);
-            (*nb_conv) = 0;
-            write_len = 1;
+            prof->res_heat[0] = calc_res_heat(conf->heatr_temp, dev);
+            prof->gas_wait[0] = calc_gas_wait(conf->heatr_dur);
+            prof->nb_conv = 0;
+            prof->len = 1;
             break;
         case BME68X_SEQUENTIAL_MODE:
-            if ((!conf->heatr_dur_prof) || (!conf->heatr_temp_prof))
-            {
-                rslt = BME68X_E_NULL_PTR;
-                break;
-            }
-
-            for (i = 0; i < conf->profile_len; i++)
-            {
-                rh_reg_addr[i] = BME68X_REG_RES_HEAT0 + i;
-                rh_reg_data[i] = calc_res_heat(conf->heatr_temp_prof[i], dev);
-                gw_reg_addr[i] = BME68X_REG_GAS_WAIT0 + i;
-                gw_reg_data[i] = calc_gas_wait(conf->heatr_dur_prof[i]);
-            }
-
-            (*nb_conv) = conf->profile_len;
-            write_len = conf->profile_len;
-            break;
         case BME68X_PARALLEL_MODE:
             if ((!conf->heatr_dur_prof) || (!conf->heatr_temp_prof))
             {
@@ -1509,25 +1997,36 @@ static int8_t set_conf(const struct bme68x_heatr_conf *conf, uint8_t op_mode, ui
                 break;
             }
 
-            if (conf->shared_heatr_dur == 0)
+            if (conf->profile_len > BME68X_LEN_HEATR_PROF)
             {
-                rslt = BME68X_W_DEFINE_SHD_HEATR_DUR;
+                rslt = BME68X_E_INVALID_LENGTH;
+                break;
             }
 
             for (i = 0; i < conf->profile_len; i++)
             {
-                rh_reg_addr[i] = BME68X_REG_RES_HEAT0 + i;
-                rh_reg_data[i] = calc_res_heat(conf->heatr_temp_prof[i], dev);
-                gw_reg_addr[i] = BME68X_REG_GAS_WAIT0 + i;
-                gw_reg_data[i] = (uint8_t) conf->heatr_dur_prof[i];
+                prof->res_heat[i] = calc_res_heat(conf->heatr_temp_prof[i], dev);
+                if (op_mode == BME68X_SEQUENTIAL_MODE)
+                {
+                    prof->gas_wait[i] = calc_gas_wait(conf->heatr_dur_prof[i]);
+                }
+                else
+                {
+                    /* Parallel mode durations are multiples of the shared heater duration */
+                    prof->gas_wait[i] = (uint8_t) conf->heatr_dur_prof[i];
+                }
             }
 
-            (*nb_conv) = conf->profile_len;
-            write_len = conf->profile_len;
-            shared_dur = calc_heatr_dur_shared(conf->shared_heatr_dur);
-            if (rslt == BME68X_OK)
+            prof->nb_conv = conf->profile_len;
+            prof->len = conf->profile_len;
+            if (op_mode == BME68X_PARALLEL_MODE)
             {
-                rslt = bme68x_set_regs(&heater_dur_shared_addr, &shared_dur, 1, dev);
+                if (conf->shared_heatr_dur == 0)
+                {
+                    rslt = BME68X_W_DEFINE_SHD_HEATR_DUR;
+                }
+
+                prof->shared_dur = calc_heatr_dur_shared(conf->shared_heatr_dur);
             }
 
             break;
@@ -1535,14 +2034,84 @@ static int8_t set_conf(const struct bme68x_heatr_conf *conf, uint8_t op_mode, ui
             rslt = BME68X_W_DEFINE_OP_MODE;
     }
 
+    return rslt;
+}
+
+/* This internal API is used to write the heater register values in a single transaction */
+static int8_t write_heatr_prof(const struct bme68x_heatr_prof *prof, struct bme68x_dev *dev)
+{
+    int8_t rslt;
+    uint8_t i;
+    uint8_t len = 0;
+    uint8_t hctrl, run_gas;
+    uint8_t ctrl_gas_data[2];
+    uint8_t reg_addr[BME68X_LEN_INTERLEAVE_BUFF / 2];
+    uint8_t reg_data[BME68X_LEN_INTERLEAVE_BUFF / 2];
+
+    /* The heater control bits share their registers with other settings */
+    rslt = bme68x_get_regs(BME68X_REG_CTRL_GAS_0, ctrl_gas_data, 2, dev);
     if (rslt == BME68X_OK)
     {
-        rslt = bme68x_set_regs(rh_reg_addr, rh_reg_data, write_len, dev);
+        if (prof->enable == BME68X_ENABLE)
+        {
+            hctrl = BME68X_ENABLE_HEATER;
+            if (dev->variant_id == BME68X_VARIANT_GAS_HIGH)
+            {
+                run_gas = BME68X_ENABLE_GAS_MEAS_H;
+            }
+            else
+            {
+                run_gas = BME68X_ENABLE_GAS_MEAS_L;
+            }
+        }
+        else
+        {
+            hctrl = BME68X_DISABLE_HEATER;
+            run_gas = BME68X_DISABLE_GAS_MEAS;
+        }
+
+        ctrl_gas_data[0] = BME68X_SET_BITS(ctrl_gas_data[0], BME68X_HCTRL, hctrl);
+        ctrl_gas_data[1] = BME68X_SET_BITS_POS_0(ctrl_gas_data[1], BME68X_NBCONV, prof->nb_conv);
+        ctrl_gas_data[1] = BME68X_SET_BITS(ctrl_gas_data[1], BME68X_RUN_GAS, run_gas);
+
+        /* Interleave all heater registers into one burst */
+        for (i = 0; i < prof->len; i++)
+        {
+            reg_addr[len] = BME68X_REG_RES_HEAT0 + i;
+            reg_data[len++] = prof->res_heat[i];
+        }
+
+        for (i = 0; i < prof->len; i++)
+        {
+            reg_addr[len] = BME68X_REG_GAS_WAIT0 + i;
+            reg_data[len++] = prof->gas_wait[i];
+        }
+
+        if (prof->op_mode == BME68X_PARALLEL_MODE)
+        {
+            reg_addr[len] = BME68X_REG_SHD_HEATR_DUR;
+            reg_data[len++] = prof->shared_dur;
+        }
+
+        reg_addr[len] = BME68X_REG_CTRL_GAS_0;
+        reg_data[len++] = ctrl_gas_data[0];
+        reg_addr[len] = BME68X_REG_CTRL_GAS_1;
+        reg_data[len++] = ctrl_gas_data[1];
+
+        /* Cache is not valid until the heater registers are written */
+        dev->heatr_cache.len = 0;
+        rslt = bme68x_set_regs(reg_addr, reg_data, len, dev);
     }
 
     if (rslt == BME68X_OK)
     {
-        rslt = bme68x_set_regs(gw_reg_addr, gw_reg_data, write_len, dev);
+        for (i = 0; i < prof->len; i++)
+        {
+            dev->heatr_cache.res_heat[i] = prof->res_heat[i];
+            dev->heatr_cache.gas_wait[i] = prof->gas_wait[i];
+        }
+
+        dev->heatr_cache.len = prof->len;
     }
 
     return rslt;
@@ -204,6 +204,28 @@ uint32_t bme68x_get_meas_dur(const uint8_t op_mode, struct bme68x_conf *conf, st
  * @brief Read our data from the sensor
  */
 
+/*!
+ * \ingroup bme68xApiData
+ * \page bme68x_api_bme68x_wait_data bme68x_wait_data
+ * \code
+ * int8_t bme68x_wait_data(uint32_t meas_dur, struct bme68x_dev *dev);
+ * \endcode
+ * @details This API waits for a forced mode measurement to complete. It sleeps
+ * for the expected measurement duration and then polls the new data bit every
+ * BME68X_PERIOD_DATA_POLL microseconds, so bme68x_get_data finds the data on
+ * its first read.
+ *
+ * @param[in] meas_dur : Expected duration in microseconds, i.e. the value of
+ *                       bme68x_get_meas_dur plus the heater duration.
+ * @param[in,out] dev  : Structure instance of bme68x_dev
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval 2 -> BME68X_W_NO_NEW_DATA
+ * @retval < 0 -> Fail
+ */
+int8_t bme68x_wait_data(uint32_t meas_dur, struct bme68x_dev *dev);
+
 /*!
  * \ingroup bme68xApiData
  * \page bme68x_api_bme68x_get_data bme68x_get_data
@@ -225,6 +247,100 @@ uint32_t bme68x_get_meas_dur(const uint8_t op_mode, struct bme68x_conf *conf, st
  */
 int8_t bme68x_get_data(uint8_t op_mode, struct bme68x_data *data, uint8_t *n_data, struct bme68x_dev *dev);
 
+/*!
+ * \ingroup bme68xApiData
+ * \page bme68x_api_bme68x_compensate_batch bme68x_compensate_batch
+ * \code
+ * int8_t bme68x_compensate_batch(const struct bme68x_raw_batch *raw,
+ *                                const struct bme68x_comp_batch *comp,
+ *                                uint32_t n_samples,
+ *                                const struct bme68x_dev *dev);
+ * \endcode
+ * @details This API compensates arrays of raw ADC values, e.g. logged data
+ * being reprocessed offline. The results are identical to those of the
+ * integer compensation of bme68x_get_data, also when BME68X_USE_FPU is
+ * defined. Only the calibration data and variant of the device are used,
+ * so no bus access is made.
+ *
+ * @param[in] raw       : Raw ADC value arrays.
+ * @param[out] comp     : Compensated value arrays. NULL arrays are skipped.
+ * @param[in] n_samples : Number of samples in each array.
+ * @param[in] dev       : Structure instance of bme68x_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bme68x_compensate_batch(const struct bme68x_raw_batch *raw,
+                               const struct bme68x_comp_batch *comp,
+                               uint32_t n_samples,
+                               const struct bme68x_dev *dev);
+
+/*!
+ * \ingroup bme68xApiData
+ * \page bme68x_api_bme68x_stream_init bme68x_stream_init
+ * \code
+ * int8_t bme68x_stream_init(uint8_t op_mode,
+ *                           struct bme68x_conf *conf,
+ *                           const struct bme68x_heatr_conf *heatr_conf,
+ *                           struct bme68x_stream *stream,
+ *                           struct bme68x_dev *dev);
+ * \endcode
+ * @details This API initializes a stream of parallel or sequential mode
+ * samples and derives the time between two new data fields from the
+ * measurement and heater durations.
+ *
+ * @param[in] op_mode    : BME68X_PARALLEL_MODE or BME68X_SEQUENTIAL_MODE.
+ * @param[in] conf       : Sensor configuration in use.
+ * @param[in] heatr_conf : Heating configuration in use.
+ * @param[out] stream    : Stream to be initialized.
+ * @param[in] dev        : Structure instance of bme68x_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval > 0 -> Warning
+ * @retval < 0 -> Fail
+ */
+int8_t bme68x_stream_init(uint8_t op_mode,
+                          struct bme68x_conf *conf,
+                          const struct bme68x_heatr_conf *heatr_conf,
+                          struct bme68x_stream *stream,
+                          struct bme68x_dev *dev);
+
+/*!
+ * \ingroup bme68xApiData
+ * \page bme68x_api_bme68x_stream_read bme68x_stream_read
+ * \code
+ * int8_t bme68x_stream_read(uint32_t now_us,
+ *                           struct bme68x_data *data,
+ *                           uint8_t *n_data,
+ *                           struct bme68x_stream *stream,
+ *                           struct bme68x_dev *dev);
+ * \endcode
+ * @details This API returns the samples of the stream which were not
+ * delivered yet, oldest first. No bus access is made before the next field
+ * is expected, and the heater settings are taken from the heater cache
+ * instead of being read back. Samples which were overwritten in the sensor
+ * before being read are counted in stream->n_lost.
+ *
+ * @param[in] now_us     : Current time in microseconds. It may wrap around.
+ * @param[out] data      : Structure array of 3 elements holding the samples.
+ * @param[out] n_data    : Number of samples delivered.
+ * @param[in,out] stream : Stream initialized with bme68x_stream_init.
+ * @param[in,out] dev    : Structure instance of bme68x_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval BME68X_W_NO_NEW_DATA -> No new sample is available
+ * @retval BME68X_W_STREAM_GAP -> Samples were delivered but some were lost
+ * @retval < 0 -> Fail
+ */
+int8_t bme68x_stream_read(uint32_t now_us,
+                          struct bme68x_data *data,
+                          uint8_t *n_data,
+                          struct bme68x_stream *stream,
+                          struct bme68x_dev *dev);
+
 /**
  * \ingroup bme68x
  * \defgroup bme68xApiConfig Configuration
@@ -284,6 +400,57 @@ int8_t bme68x_get_conf(struct bme68x_conf *conf, struct bme68x_dev *dev);
  */
 int8_t bme68x_set_heatr_conf(uint8_t op_mode, const struct bme68x_heatr_conf *conf, struct bme68x_dev *dev);
 
+/*!
+ * \ingroup bme68xApiConfig
+ * \page bme68x_api_bme68x_compile_heatr_prof bme68x_compile_heatr_prof
+ * \code
+ * int8_t bme68x_compile_heatr_prof(uint8_t op_mode,
+ *                                  const struct bme68x_heatr_conf *conf,
+ *                                  struct bme68x_heatr_prof *prof,
+ *                                  struct bme68x_dev *dev);
+ * \endcode
+ * @details This API precomputes the heater register values of a heating
+ * configuration for the current calibration data and ambient temperature,
+ * so the profile can later be switched to with bme68x_apply_heatr_prof.
+ * Nothing is written to the sensor.
+ *
+ * @param[in] op_mode : Expected operation mode of the sensor.
+ * @param[in] conf    : Heating configuration. It is referenced by the profile
+ *                      and must stay valid while the profile is in use.
+ * @param[out] prof   : Compiled heater profile.
+ * @param[in] dev     : Structure instance of bme68x_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval > 0 -> Warning
+ * @retval < 0 -> Fail
+ */
+int8_t bme68x_compile_heatr_prof(uint8_t op_mode,
+                                 const struct bme68x_heatr_conf *conf,
+                                 struct bme68x_heatr_prof *prof,
+                                 struct bme68x_dev *dev);
+
+/*!
+ * \ingroup bme68xApiConfig
+ * \page bme68x_api_bme68x_apply_heatr_prof bme68x_apply_heatr_prof
+ * \code
+ * int8_t bme68x_apply_heatr_prof(struct bme68x_heatr_prof *prof, struct bme68x_dev *dev);
+ * \endcode
+ * @details This API puts the sensor to sleep and writes a compiled heater
+ * profile, including the gas control bits, in a single burst. The profile is
+ * recompiled first if bme68x_dev.amb_temp drifted by more than
+ * BME68X_HEATR_PROF_AMB_DRIFT from the temperature it was compiled for.
+ *
+ * @param[in,out] prof : Compiled heater profile.
+ * @param[in,out] dev  : Structure instance of bme68x_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval > 0 -> Warning
+ * @retval < 0 -> Fail
+ */
+int8_t bme68x_apply_heatr_prof(struct bme68x_heatr_prof *prof, struct bme68x_dev *dev);
+
 /*!
  * \ingroup bme68xApiConfig
  * \page bme68x_api_bme68x_get_heatr_conf bme68x_get_heatr_conf
@@ -97,6 +97,21 @@
 #define BME68X_PERIOD_POLL                        UINT32_C(10000)
 #endif
 
+/* Poll period while waiting for new data after the expected measurement duration */
+#ifndef BME68X_PERIOD_DATA_POLL
+#define BME68X_PERIOD_DATA_POLL                   UINT32_C(1000)
+#endif
+
+/* Ambient temperature drift in degree C after which a compiled heater profile is recompiled */
+#ifndef BME68X_HEATR_PROF_AMB_DRIFT
+#define BME68X_HEATR_PROF_AMB_DRIFT               INT8_C(3)
+#endif
+
+/* Number of samples compensated per chunk by bme68x_compensate_batch */
+#ifndef BME68X_COMP_BATCH_CHUNK
+#define BME68X_COMP_BATCH_CHUNK                   UINT8_C(32)
+#endif
+
 /* BME68X unique chip identifier */
 #define BME68X_CHIP_ID                            UINT8_C(0x61)
 
@@ -142,6 +157,9 @@
 /* Define the shared heating duration */
 #define BME68X_W_DEFINE_SHD_HEATR_DUR             INT8_C(3)
 
+/* Samples were overwritten in the sensor before being read */
+#define BME68X_W_STREAM_GAP                       INT8_C(4)
+
 /* Information - only available via bme68x_dev.info_msg */
 #define BME68X_I_PARAM_CORR                       UINT8_C(1)
 
@@ -336,8 +354,11 @@
 /* Length of the configuration register */
 #define BME68X_LEN_CONFIG                         UINT8_C(5)
 
-/* Length of the interleaved buffer */
-#define BME68X_LEN_INTERLEAVE_BUFF                UINT8_C(20)
+/* Length of the interleaved buffer, fits a full heater profile with its control registers */
+#define BME68X_LEN_INTERLEAVE_BUFF                UINT8_C(46)
+
+/* Number of heater profile steps */
+#define BME68X_LEN_HEATR_PROF                     UINT8_C(10)
 
 /* Coefficient index macros */
 
@@ -913,6 +934,121 @@ struct bme68x_heatr_conf
     uint16_t shared_heatr_dur;
 };
 
+/*
+ * @brief BME68X heater profile compiled into register values
+ */
+struct bme68x_heatr_prof
+{
+    /*! Heater configuration the profile is compiled from, kept for recompilation */
+    const struct bme68x_heatr_conf *conf;
+
+    /*! Operation mode the profile is compiled for */
+    uint8_t op_mode;
+
+    /*! Ambient temperature in degree C the profile is compiled for */
+    int8_t amb_temp;
+
+    /*! Enable gas measurement. Refer @ref en_dis */
+    uint8_t enable;
+
+    /*! Number of heater steps */
+    uint8_t len;
+
+    /*! Number of conversions written to nb_conv */
+    uint8_t nb_conv;
+
+    /*! Heater resistance register values */
+    uint8_t res_heat[BME68X_LEN_HEATR_PROF];
+
+    /*! Gas wait register values */
+    uint8_t gas_wait[BME68X_LEN_HEATR_PROF];
+
+    /*! Shared heater duration register value, parallel mode only */
+    uint8_t shared_dur;
+};
+
+/*
+ * @brief BME68X heater register values last written by the driver
+ */
+struct bme68x_heatr_cache
+{
+    /*! Heater resistance register values, indexed by gas_index */
+    uint8_t res_heat[BME68X_LEN_HEATR_PROF];
+
+    /*! Gas wait register values, indexed by gas_index */
+    uint8_t gas_wait[BME68X_LEN_HEATR_PROF];
+
+    /*! Number of valid heater steps, 0 if the cache is not valid */
+    uint8_t len;
+};
+
+/*
+ * @brief BME68X raw ADC values of a batch of samples, one array per quantity
+ */
+struct bme68x_raw_batch
+{
+    /*! Temperature ADC values */
+    const uint32_t *temp_adc;
+
+    /*! Pressure ADC values */
+    const uint32_t *pres_adc;
+
+    /*! Humidity ADC values */
+    const uint16_t *hum_adc;
+
+    /*! Gas resistance ADC values of the variant in use */
+    const uint16_t *gas_adc;
+
+    /*! Gas ranges of the variant in use */
+    const uint8_t *gas_range;
+};
+
+/*
+ * @brief BME68X integer compensated values of a batch of samples, one array
+ * per quantity. A NULL array skips the quantity.
+ */
+struct bme68x_comp_batch
+{
+    /*! Temperature in degree celsius x100 */
+    int16_t *temperature;
+
+    /*! Pressure in Pascal */
+    uint32_t *pressure;
+
+    /*! Humidity in % relative humidity x1000 */
+    uint32_t *humidity;
+
+    /*! Gas resistance in Ohms */
+    uint32_t *gas_resistance;
+};
+
+/*
+ * @brief BME68X parallel or sequential mode sample stream
+ */
+struct bme68x_stream
+{
+    /*! Operation mode being streamed */
+    uint8_t op_mode;
+
+    /*! Time in microseconds between two new data fields */
+    uint32_t field_period;
+
+    /*! Time in microseconds at which the next field is expected */
+    uint32_t next_read;
+
+    /*! Measurement index of the last delivered sample */
+    uint8_t last_meas_index;
+
+    /*! Set once the first sample was delivered. Refer @ref en_dis */
+    uint8_t started;
+
+    /*! Number of samples lost because they were overwritten before being read */
+    uint32_t n_lost;
+
+    /*! Number of field reads issued */
+    uint32_t n_reads;
+};
+
 /*
  * @brief BME68X device structure
  */
@@ -966,6 +1102,16 @@ struct bme68x_dev
 
     /*! Store the info messages */
     uint8_t info_msg;
+
+    /*! Heater settings written by the driver, saves reading them back with every sample */
+    struct bme68x_heatr_cache heatr_cache;
+
+    /*!
+     * Skip reading back the heater current DAC with every sample, bme68x_data.idac
+     * is then 0. Refer @ref en_dis. The DAC is updated by the sensor, so reading it
+     * costs an extra bus transaction; it is read when left at 0.
+     */
+    uint8_t skip_idac_read;
 };
 
 #endif /* BME68X_DEFS_H_ */
@@ -0,0 +1,253 @@
+/**
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * Checks bme68x_compensate_batch against the scalar compensation of
+ * bme68x_get_data, without a sensor: a register image in RAM serves the data
+ * field, so every raw sample goes through calc_temperature, calc_pressure,
+ * calc_humidity and calc_gas_resistance_*. Built with BME68X_DO_NOT_USE_FPU the
+ * results must match bit for bit; with the floating point compensation they
+ * are compared within the rounding of the integer formulas.
+ *
+ *   gcc -I../.. batch_compensation.c ../../bme68x.c -o batch_compensation
+ *   gcc -I../.. -DBME68X_DO_NOT_USE_FPU batch_compensation.c ../../bme68x.c -o batch_compensation
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "bme68x.h"
+
+/***********************************************************************/
+/*                         Macros                                      */
+/***********************************************************************/
+
+/* Macro for count of raw samples to be compensated */
+#define SAMPLE_COUNT      UINT16_C(2048)
+
+/* Macro for count of times the compensation is repeated for timing */
+#define LOOP_COUNT        UINT8_C(20)
+
+/* Macro for count of calibration sets */
+#define CALIB_COUNT       UINT8_C(3)
+
+#ifdef BME68X_USE_FPU
+
+/* Floating point results differ from the integer formulas by their rounding:
+ * the integer gas resistance of the high gas variant is truncated to 100 Ohm
+ */
+#define TEMP_TOL_DEGC     (0.01f)
+#define PRES_TOL_PA       (10.0f)
+#define HUM_TOL_PERCENT   (0.1f)
+#define GAS_TOL_RELATIVE  (0.01f)
+#define GAS_TOL_OHM       (100.0f)
+#endif
+
+/***********************************************************************/
+/*                         Static variables                            */
+/***********************************************************************/
+
+static uint32_t temp_adc[SAMPLE_COUNT];
+static uint32_t pres_adc[SAMPLE_COUNT];
+static uint16_t hum_adc[SAMPLE_COUNT];
+static uint16_t gas_adc[SAMPLE_COUNT];
+static uint8_t gas_range[SAMPLE_COUNT];
+
+static int16_t temperature[SAMPLE_COUNT];
+static uint32_t pressure[SAMPLE_COUNT];
+static uint32_t humidity[SAMPLE_COUNT];
+static uint32_t gas_resistance[SAMPLE_COUNT];
+
+/* Register image of the data field being read */
+static uint8_t field_regs[BME68X_LEN_FIELD];
+
+/* Calibration of a few sensors, spread around typical parts */
+static const struct bme68x_calib_data calib_set[CALIB_COUNT] = {
+    { .par_h1 = 783, .par_h2 = 1013, .par_h3 = 0, .par_h4 = 45, .par_h5 = 20, .par_h6 = 120, .par_h7 = -100,
+      .par_t1 = 26159, .par_t2 = 26411, .par_t3 = 3, .par_p1 = 36393, .par_p2 = -10424, .par_p3 = 88,
+      .par_p4 = 7654, .par_p5 = -166, .par_p6 = 30, .par_p7 = 66, .par_p8 = -3177, .par_p9 = -2563,
+      .par_p10 = 30, .range_sw_err = -1 },
+    { .par_h1 = 851, .par_h2 = 989, .par_h3 = 0, .par_h4 = 45, .par_h5 = 20, .par_h6 = 120, .par_h7 = -100,
+      .par_t1 = 25893, .par_t2 = 26720, .par_t3 = 3, .par_p1 = 37050, .par_p2 = -10323, .par_p3 = 88,
+      .par_p4 = 7108, .par_p5 = -154, .par_p6 = 30, .par_p7 = 44, .par_p8 = -3556, .par_p9 = -2419,
+      .par_p10 = 30, .range_sw_err = 2 },
+    { .par_h1 = 712, .par_h2 = 1040, .par_h3 = 0, .par_h4 = 45, .par_h5 = 20, .par_h6 = 120, .par_h7 = -100,
+      .par_t1 = 26402, .par_t2 = 26061, .par_t3 = 3, .par_p1 = 35829, .par_p2 = -10583, .par_p3 = 88,
+      .par_p4 = 8021, .par_p5 = -191, .par_p6 = 30, .par_p7 = 77, .par_p8 = -2873, .par_p9 = -2688,
+      .par_p10 = 30, .range_sw_err = 0 }
+};
+
+/***********************************************************************/
+/*                         Static functions                            */
+/***********************************************************************/
+
+/* Serves the register image, heater registers read as zero */
+static BME68X_INTF_RET_TYPE field_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    (void)intf_ptr;
+
+    memset(reg_data, 0, len);
+    if ((reg_addr == BME68X_REG_FIELD0) && (len <= BME68X_LEN_FIELD))
+    {
+        memcpy(reg_data, field_regs, len);
+    }
+
+    return BME68X_INTF_RET_SUCCESS;
+}
+
+static BME68X_INTF_RET_TYPE field_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    (void)reg_addr;
+    (void)reg_data;
+    (void)len;
+    (void)intf_ptr;
+
+    return BME68X_INTF_RET_SUCCESS;
+}
+
+static void field_delay_us(uint32_t period, void *intf_ptr)
+{
+    (void)period;
+    (void)intf_ptr;
+}
+
+/* Encodes a raw sample as the sensor presents it in field 0 */
+static void put_field(uint16_t i)
+{
+    uint8_t gas_lsb = (uint8_t)(((gas_adc[i] & 0x03) << 6) | BME68X_GASM_VALID_MSK | BME68X_HEAT_STAB_MSK |
+                                (gas_range[i] & BME68X_GAS_RANGE_MSK));
+
+    memset(field_regs, 0, sizeof(field_regs));
+    field_regs[0] = BME68X_NEW_DATA_MSK;
+    field_regs[1] = (uint8_t)i;
+    field_regs[2] = (uint8_t)(pres_adc[i] >> 12);
+    field_regs[3] = (uint8_t)(pres_adc[i] >> 4);
+    field_regs[4] = (uint8_t)(pres_adc[i] << 4);
+    field_regs[5] = (uint8_t)(temp_adc[i] >> 12);
+    field_regs[6] = (uint8_t)(temp_adc[i] >> 4);
+    field_regs[7] = (uint8_t)(temp_adc[i] << 4);
+    field_regs[8] = (uint8_t)(hum_adc[i] >> 8);
+    field_regs[9] = (uint8_t)hum_adc[i];
+    field_regs[13] = (uint8_t)(gas_adc[i] >> 2);
+    field_regs[14] = gas_lsb;
+    field_regs[15] = (uint8_t)(gas_adc[i] >> 2);
+    field_regs[16] = gas_lsb;
+}
+
+/* Compares a sample of the batch with the scalar compensation */
+static uint8_t sample_matches(uint16_t i, const struct bme68x_data *data)
+{
+#ifndef BME68X_USE_FPU
+    return (uint8_t)((data->temperature == temperature[i]) && (data->pressure == pressure[i]) &&
+                     (data->humidity == humidity[i]) && (data->gas_resistance == gas_resistance[i]));
+#else
+    float gas_diff = data->gas_resistance - (float)gas_resistance[i];
+    float temp_diff = data->temperature - ((float)temperature[i] / 100.0f);
+    float pres_diff = data->pressure - (float)pressure[i];
+    float hum_diff = data->humidity - ((float)humidity[i] / 1000.0f);
+
+    return (uint8_t)((temp_diff <= TEMP_TOL_DEGC) && (temp_diff >= -TEMP_TOL_DEGC) &&
+                     (pres_diff <= PRES_TOL_PA) && (pres_diff >= -PRES_TOL_PA) &&
+                     (hum_diff <= HUM_TOL_PERCENT) && (hum_diff >= -HUM_TOL_PERCENT) &&
+                     (gas_diff <= ((GAS_TOL_RELATIVE * data->gas_resistance) + GAS_TOL_OHM)) &&
+                     (gas_diff >= -((GAS_TOL_RELATIVE * data->gas_resistance) + GAS_TOL_OHM)));
+#endif
+}
+
+/***********************************************************************/
+/*                         Test code                                   */
+/***********************************************************************/
+
+int main(void)
+{
+    struct bme68x_dev bme;
+    struct bme68x_data data;
+    int8_t rslt = BME68X_OK;
+    uint16_t i;
+    uint8_t n_data;
+    uint8_t loop;
+    uint8_t set;
+    uint8_t variant;
+    uint32_t mismatch = 0;
+    clock_t start;
+    clock_t batch_clk = 0;
+    struct bme68x_raw_batch raw;
+    struct bme68x_comp_batch comp;
+
+    memset(&bme, 0, sizeof(bme));
+    bme.read = field_read;
+    bme.write = field_write;
+    bme.delay_us = field_delay_us;
+    bme.intf = BME68X_I2C_INTF;
+    bme.amb_temp = 25;
+
+    /* Sweep of raw ADC values covering the usual operating range, every gas range */
+    for (i = 0; i < SAMPLE_COUNT; i++)
+    {
+        temp_adc[i] = UINT32_C(350000) + ((uint32_t)i * 97);
+        pres_adc[i] = UINT32_C(300000) + ((uint32_t)i * 113);
+        hum_adc[i] = (uint16_t)(UINT16_C(15000) + (i * 13));
+        gas_adc[i] = (uint16_t)((i * 7) % 1024);
+        gas_range[i] = (uint8_t)(i % 16);
+    }
+
+    raw.temp_adc = temp_adc;
+    raw.pres_adc = pres_adc;
+    raw.hum_adc = hum_adc;
+    raw.gas_adc = gas_adc;
+    raw.gas_range = gas_range;
+    comp.temperature = temperature;
+    comp.pressure = pressure;
+    comp.humidity = humidity;
+    comp.gas_resistance = gas_resistance;
+
+    for (set = 0; (set < CALIB_COUNT) && (rslt == BME68X_OK); set++)
+    {
+        for (variant = BME68X_VARIANT_GAS_LOW; (variant <= BME68X_VARIANT_GAS_HIGH) && (rslt == BME68X_OK); variant++)
+        {
+            bme.calib = calib_set[set];
+            bme.variant_id = variant;
+
+            start = clock();
+            for (loop = 0; (loop < LOOP_COUNT) && (rslt == BME68X_OK); loop++)
+            {
+                rslt = bme68x_compensate_batch(&raw, &comp, SAMPLE_COUNT, &bme);
+            }
+
+            batch_clk += clock() - start;
+
+            for (i = 0; (i < SAMPLE_COUNT) && (rslt == BME68X_OK); i++)
+            {
+                put_field(i);
+                rslt = bme68x_get_data(BME68X_FORCED_MODE, &data, &n_data, &bme);
+                if ((rslt == BME68X_OK) && !sample_matches(i, &data))
+                {
+                    mismatch++;
+                }
+            }
+        }
+    }
+
+#ifdef BME68X_USE_FPU
+    printf("Scalar compensation : floating point\n");
+#else
+    printf("Scalar compensation : integer\n");
+#endif
+    printf("Samples compared    : %u x %u calibrations x 2 variants\n", SAMPLE_COUNT, CALIB_COUNT);
+    if (batch_clk != 0)
+    {
+        printf("Batch throughput    : %lu samples/s\n",
+               (long unsigned int)(((double)SAMPLE_COUNT * LOOP_COUNT * CALIB_COUNT * 2 * CLOCKS_PER_SEC) / batch_clk));
+    }
+
+    printf("Mismatching samples : %lu\n", (long unsigned int)mismatch);
+    if (rslt != BME68X_OK)
+    {
+        printf("Compensation failed : %d\n", rslt);
+    }
+
+    return ((mismatch == 0) && (rslt == BME68X_OK)) ? 0 : -1;
+}
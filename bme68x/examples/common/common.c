@@ -98,6 +98,9 @@ void bme68x_check_rslt(const char api_name[], int8_t rslt)
         case BME68X_W_NO_NEW_DATA:
             printf("API name [%s]  Warning [%d] : No new data found\r\n", api_name, rslt);
             break;
+        case BME68X_W_STREAM_GAP:
+            printf("API name [%s]  Warning [%d] : Samples lost before being read\r\n", api_name, rslt);
+            break;
         default:
             printf("API name [%s]  Error [%d] : Unknown error code\r\n", api_name, rslt);
             break;
@@ -180,6 +183,7 @@ int8_t bme68x_interface_init(struct bme68x_dev *bme, uint8_t intf)
         bme->delay_us = bme68x_delay_us;
         bme->intf_ptr = &dev_addr;
         bme->amb_temp = 25; /* The ambient temperature in deg C is used for defining the heater temperature */
+        bme->skip_idac_read = BME68X_ENABLE; /* Heater current DAC is not needed with every sample */
     }
     else
     {
@@ -69,7 +69,8 @@ int main(void)
 
         /* Calculate delay period in microseconds */
         del_period = bme68x_get_meas_dur(BME68X_FORCED_MODE, &conf, &bme) + (heatr_conf.heatr_dur * 1000);
-        bme.delay_us(del_period, bme.intf_ptr);
+        rslt = bme68x_wait_data(del_period, &bme);
+        bme68x_check_rslt("bme68x_wait_data", rslt);
 
         time_ms = coines_get_millis();
 
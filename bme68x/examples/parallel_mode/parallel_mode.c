@@ -35,7 +35,7 @@ int main(void)
     struct bme68x_conf conf;
     struct bme68x_heatr_conf heatr_conf;
     struct bme68x_data data[3];
-    uint32_t del_period;
+    struct bme68x_stream stream;
     uint8_t n_fields;
     uint32_t time_ms = 0;
     uint16_t sample_count = 1;
@@ -81,6 +81,10 @@ int main(void)
     rslt = bme68x_set_heatr_conf(BME68X_PARALLEL_MODE, &heatr_conf, &bme);
     bme68x_check_rslt("bme68x_set_heatr_conf", rslt);
 
+    /* Check if rslt == BME68X_OK, report or handle if otherwise */
+    rslt = bme68x_stream_init(BME68X_PARALLEL_MODE, &conf, &heatr_conf, &stream, &bme);
+    bme68x_check_rslt("bme68x_stream_init", rslt);
+
     /* Check if rslt == BME68X_OK, report or handle if otherwise */
     rslt = bme68x_set_op_mode(BME68X_PARALLEL_MODE, &bme);
     bme68x_check_rslt("bme68x_set_op_mode", rslt);
@@ -93,14 +97,13 @@ int main(void)
         "Sample, TimeStamp(ms), Temperature(deg C), Pressure(Pa), Humidity(%%), Gas resistance(ohm), Status, Gas index, Meas index\n");
     while (sample_count <= SAMPLE_COUNT)
     {
-        /* Calculate delay period in microseconds */
-        del_period = bme68x_get_meas_dur(BME68X_PARALLEL_MODE, &conf, &bme) + (heatr_conf.shared_heatr_dur * 1000);
-        bme.delay_us(del_period, bme.intf_ptr);
+        /* Wait for the next field; the stream does not touch the bus before it is due */
+        bme.delay_us(stream.field_period, bme.intf_ptr);
 
         time_ms = coines_get_millis();
 
-        rslt = bme68x_get_data(BME68X_PARALLEL_MODE, data, &n_fields, &bme);
-        bme68x_check_rslt("bme68x_get_data", rslt);
+        rslt = bme68x_stream_read((uint32_t)coines_get_micro_sec(), data, &n_fields, &stream, &bme);
+        bme68x_check_rslt("bme68x_stream_read", rslt);
 
         /* Check if rslt == BME68X_OK, report or handle if otherwise */
         for (uint8_t i = 0; i < n_fields; i++)
@@ -135,6 +138,10 @@ int main(void)
         }
     }
 
+    printf("\nField reads: %lu, samples lost: %lu\n",
+           (long unsigned int)stream.n_reads,
+           (long unsigned int)stream.n_lost);
+
     bme68x_coines_deinit();
 
     return 0;
@@ -101,6 +101,33 @@ struct bmi2_accel_offset
 
 /******************************************************************************/
 
+/*!         Global Variable Definitions
+ ****************************************************************************/
+
+/*! @name Fields of the any-motion and no-motion configurations, which share
+ * the same layout
+ */
+const struct bmi2_feat_field bmi2_any_no_mot_fields[BMI2_ANY_NO_MOT_N_FIELDS] = {
+    BMI2_FEAT_FIELD_POS0(0, BMI2_ANY_NO_MOT_DUR, struct bmi2_any_motion_config, duration),
+    BMI2_FEAT_FIELD(0, BMI2_ANY_NO_MOT_X_SEL, struct bmi2_any_motion_config, select_x),
+    BMI2_FEAT_FIELD(0, BMI2_ANY_NO_MOT_Y_SEL, struct bmi2_any_motion_config, select_y),
+    BMI2_FEAT_FIELD(0, BMI2_ANY_NO_MOT_Z_SEL, struct bmi2_any_motion_config, select_z),
+    BMI2_FEAT_FIELD_POS0(1, BMI2_ANY_NO_MOT_THRES, struct bmi2_any_motion_config, threshold)
+};
+
+/*! @name Fields of the sig-motion configuration */
+const struct bmi2_feat_field bmi2_sig_mot_fields[BMI2_SIG_MOT_N_FIELDS] = {
+    BMI2_FEAT_FIELD_POS0(0, BMI2_SIG_MOT_PARAM_1, struct bmi2_sig_motion_config, block_size)
+};
+
+/*! @name Fields of the step counter/detector/activity configuration */
+const struct bmi2_feat_field bmi2_step_fields[BMI2_STEP_N_FIELDS] = {
+    BMI2_FEAT_FIELD_POS0(0, BMI2_STEP_COUNT_WM_LEVEL, struct bmi2_step_config, watermark_level),
+    BMI2_FEAT_FIELD(0, BMI2_STEP_COUNT_RST_CNT, struct bmi2_step_config, reset_counter)
+};
+
+/******************************************************************************/
+
 /*!         Local Function Prototypes
  ******************************************************************************/
 
@@ -128,6 +155,19 @@ static int8_t write_config_file(struct bmi2_dev *dev);
  */
 static int8_t set_config_load(uint8_t enable, struct bmi2_dev *dev);
 
+/*!
+ * @brief This internal API polls the internal status until the ASIC reports
+ * the result of loading the configuration file.
+ *
+ * @param[out] load_status  : Configuration load status, 0 if not reported in time.
+ * @param[in] dev           : Structure instance of bmi2_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t wait_config_load(uint8_t *load_status, struct bmi2_dev *dev);
+
 /*!
  * @brief This internal API loads the configuration file.
  *
@@ -141,6 +181,45 @@ static int8_t set_config_load(uint8_t enable, struct bmi2_dev *dev);
  */
 static int8_t upload_file(const uint8_t *config_data, uint16_t index, uint16_t write_len, struct bmi2_dev *dev);
 
+/*!
+ * @brief This internal API loads a part of the configuration file, decoding
+ * it chunk by chunk when the configuration file is kept compressed.
+ *
+ * @param[in] index         : Index of the part in the configuration file.
+ * @param[in] write_len     : Length of the part in bytes.
+ * @param[in] dev           : Structure instance of bmi2_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t upload_config_chunk(uint16_t index, uint16_t write_len, struct bmi2_dev *dev);
+
+/*!
+ * @brief This internal API decodes a part of the compressed configuration
+ * file, continuing from the decode position of the previous part.
+ *
+ * @param[out] chunk        : Buffer to store the decoded part.
+ * @param[in] index         : Index of the part in the configuration file.
+ * @param[in] len           : Length of the part in bytes.
+ * @param[in] dev           : Structure instance of bmi2_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t decode_config_blob(uint8_t *chunk, uint16_t index, uint16_t len, struct bmi2_dev *dev);
+
+/*!
+ * @brief This internal API rewinds the decode position to the start of the
+ * compressed configuration file.
+ *
+ * @param[in] dev           : Structure instance of bmi2_dev.
+ *
+ * @return None
+ */
+static void reset_config_cursor(struct bmi2_dev *dev);
+
 /*!
  * @brief  This internal API sets accelerometer configurations like ODR,
  * bandwidth, performance mode and g-range.
@@ -1029,18 +1108,6 @@ static int8_t unpack_sensortime_frame(uint16_t *data_index, struct bmi2_fifo_fra
  */
 static int8_t unpack_skipped_frame(uint16_t *data_index, struct bmi2_fifo_frame *fifo);
 
-/*!
- * @brief This internal API enables and configures the accelerometer which is
- * needed for self-test operation. It also sets the amplitude for the self-test.
- *
- * @param[in]  dev      : Structure instance of bmi2_dev.
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t pre_self_test_config(struct bmi2_dev *dev);
-
 /*!
  * @brief This internal API performs the steps needed for self-test operation
  * before reading the accelerometer self-test data.
@@ -1320,16 +1387,57 @@ static int8_t perform_accel_foc(const struct bmi2_accel_foc_g_value *accel_g_val
                                 const struct bmi2_accel_config *acc_cfg,
                                 struct bmi2_dev *dev);
 
+/*!
+ * @brief This internal API computes the accelerometer offsets from the sum of
+ * the FOC samples, writes and enables them.
+ *
+ * @param[in] accel_g_value : This parameter selects the accel foc
+ * axis to be performed
+ * @param[in] acc_cfg       : Accelerometer configuration value
+ * @param[in] temp          : Sum of BMI2_FOC_SAMPLE_LIMIT samples
+ * @param[in] dev           : Structure instance of bmi2_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t write_accel_foc_offset(const struct bmi2_accel_foc_g_value *accel_g_value,
+                                     const struct bmi2_accel_config *acc_cfg,
+                                     const struct bmi2_foc_temp_value *temp,
+                                     struct bmi2_dev *dev);
+
 /*!
  * @brief This internal sets configurations for performing accelerometer FOC.
  *
+ * @param[in] acc_conf  : Accelerometer configuration register value
+ * @param[in] dev       : Structure instance of bmi2_dev
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t set_accel_foc_config(uint8_t acc_conf, struct bmi2_dev *dev);
+
+/*!
+ * @brief This internal API collects BMI2_FOC_SAMPLE_LIMIT samples of a
+ * sensor in the FIFO, reads them in one burst and sums them. Dummy frames
+ * are not summed, as many samples are read again in their place. The FIFO
+ * configuration is restored and the FIFO flushed afterwards.
+ *
+ * @param[in] fifo_en   : BMI2_FIFO_ACC_EN or BMI2_FIFO_GYR_EN
+ * @param[in] conf_val  : Configuration register value of the sensor, for
+ *                        the output data rate
+ * @param[out] temp     : Sum of the samples
  * @param[in] dev       : Structure instance of bmi2_dev
  *
  * @return Result of API execution status
  * @retval 0 -> Success
  * @retval < 0 -> Fail
  */
-static int8_t set_accel_foc_config(struct bmi2_dev *dev);
+static int8_t read_foc_fifo_samples(uint16_t fifo_en,
+                                    uint8_t conf_val,
+                                    struct bmi2_foc_temp_value *temp,
+                                    struct bmi2_dev *dev);
 
 /*!
  * @brief This internal API enables/disables the offset compensation for
@@ -1460,13 +1568,27 @@ static int8_t save_gyro_config(struct bmi2_gyro_config *gyr_cfg, uint8_t *aps, u
 /*!
  * @brief This internal sets configurations for performing gyroscope FOC.
  *
+ * @param[in] gyr_conf  : Gyroscope configuration register value
+ * @param[in] dev       : Structure instance of bmi2_dev
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t set_gyro_foc_config(uint8_t gyr_conf, struct bmi2_dev *dev);
+
+/*!
+ * @brief This internal API computes the gyroscope offsets from the sum of
+ * the FOC samples, writes and enables them.
+ *
+ * @param[in] temp  : Sum of BMI2_FOC_SAMPLE_LIMIT samples
  * @param[in] dev   : Structure instance of bmi2_dev
  *
  * @return Result of API execution status
  * @retval 0 -> Success
  * @retval < 0 -> Fail
  */
-static int8_t set_gyro_foc_config(struct bmi2_dev *dev);
+static int8_t write_gyro_foc_offset(const struct bmi2_foc_temp_value *temp, struct bmi2_dev *dev);
 
 /*!
  * @brief This internal API inverts the gyroscope offset data.
@@ -1578,31 +1700,6 @@ static int8_t get_st_running(uint8_t *st_status, struct bmi2_dev *dev);
  */
 static int8_t set_st_running(uint8_t st_status, struct bmi2_dev *dev);
 
-/*!
- * @brief This function is to make the initial changes for CRT.
- * Disable the gyro, OIS, aps
- * Note: For the purpose of preparing CRT Gyro, OIS and APS are disabled
- *
- * @param[in] dev   : Structure instance of bmi2_dev
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t crt_prepare_setup(struct bmi2_dev *dev);
-
-/*!
- * @brief This API is to run the crt process for both max burst length 0 and non zero condition.
- *
- * @param[in] gyro_st_crt   : Update the gyro self-test crt enable bit
- * @param[in] dev           : Structure instance of bmi2_dev
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t do_gtrigger_test(uint8_t gyro_st_crt, struct bmi2_dev *dev);
-
 /*!
  * @brief This function is to get the rdy for dl bit status
  * this will toggle from 0 to 1 and visevers according to the
@@ -1617,38 +1714,6 @@ static int8_t do_gtrigger_test(uint8_t gyro_st_crt, struct bmi2_dev *dev);
  */
 static int8_t get_rdy_for_dl(uint8_t *rdy_for_dl, struct bmi2_dev *dev);
 
-/*!
- * @brief This function is to write the config file in the given location for crt.
- * which inter checks the status of the rdy_for_dl bit and also the crt running, and
- * wirtes the given size.
- *
- * @param[in] write_len: length of the words to be written
- * @param[in] config_file_size: length of the words to be written
- * @param[in] start_index: provide the start index from where config file has to written
- * @param[in] dev   : Structure instance of bmi2_dev
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t write_crt_config_file(uint16_t write_len,
-                                    uint16_t config_file_size,
-                                    uint16_t start_index,
-                                    struct bmi2_dev *dev);
-
-/*!
- * @brief This function is to check for rdy_for_dl bit to toggle for CRT process
- *
- * @param[in] retry_complete: wait for given time to toggle
- * @param[in] download_ready:  get the status for rdy_for_dl
- * @param[in] dev   : Structure instance of bmi2_dev
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t wait_rdy_for_dl_toggle(uint8_t retry_complete, uint8_t download_ready, struct bmi2_dev *dev);
-
 /*!
  * @brief This function is to wait till the CRT or gyro self-test process is completed
  *
@@ -1661,19 +1726,6 @@ static int8_t wait_rdy_for_dl_toggle(uint8_t retry_complete, uint8_t download_re
  */
 static int8_t wait_st_running(uint8_t retry_complete, struct bmi2_dev *dev);
 
-/*!
- * @brief This function is to complete the crt process if max burst length is not zero
- * this checks for the crt status and rdy_for_dl bit to toggle
- *
- * @param[in] last_byte_flag: to provide the last toggled state
- * @param[in] dev   : Structure instance of bmi2_dev
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t process_crt_download(uint8_t last_byte_flag, struct bmi2_dev *dev);
-
 /*!
  * @brief This api is used to enable the gyro self-test or crt.
  *
@@ -1786,17 +1838,122 @@ static int8_t sensor_enable(uint64_t sensor_sel, struct bmi2_dev *dev);
 static int8_t sensor_disable(uint64_t sensor_sel, struct bmi2_dev *dev);
 
 /*!
- * @brief This internal API is used to test gyro CRT.
+ * @brief This internal API runs a procedure of the self-test state machine to
+ * the end, waiting with dev->delay_us between the steps.
+ *
+ * @param[in] op    : Procedure, BMI2_TEST_SM_GYRO_SELF_TEST to BMI2_TEST_SM_NVM_PROG.
+ * @param[in] dev   : Structure instance of bmi2_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t run_test_sm(uint8_t op, struct bmi2_dev *dev);
+
+/*!
+ * @brief This internal API sets the time of the next step of the procedure.
+ *
+ * @param[in] period_us : Time from now to the next step.
+ * @param[in] now_us    : Current time in microseconds.
+ * @param[in, out] sm   : Context of the procedure.
+ *
+ * @return BMI2_W_STEP_PENDING
+ */
+static int8_t wait_test_sm(uint32_t period_us, uint32_t now_us, struct bmi2_test_sm *sm);
+
+/*!
+ * @brief This internal API schedules the next poll of a status bit, or fails
+ * once the polls of the current wait are used up.
+ *
+ * @param[in] period_us     : Time from now to the next poll.
+ * @param[in] timeout_rslt  : Error returned once the polls are used up.
+ * @param[in] now_us        : Current time in microseconds.
+ * @param[in, out] sm       : Context of the procedure.
+ *
+ * @return BMI2_W_STEP_PENDING or timeout_rslt
+ */
+static int8_t retry_test_sm(uint32_t period_us, int8_t timeout_rslt, uint32_t now_us, struct bmi2_test_sm *sm);
+
+/*!
+ * @brief This internal API polls the rdy_for_dl bit once for the toggle
+ * which acknowledges the last G_TRIGGER command.
+ *
+ * @param[in] now_us    : Current time in microseconds.
+ * @param[in, out] sm   : Context of the procedure.
+ * @param[in] dev       : Structure instance of bmi2_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Toggled
+ * @retval BMI2_W_STEP_PENDING -> Not toggled yet
+ * @retval < 0 -> Fail
+ */
+static int8_t poll_rdy_for_dl_toggle(uint32_t now_us, struct bmi2_test_sm *sm, struct bmi2_dev *dev);
+
+/*!
+ * @brief This internal API writes the next burst of the CRT configuration
+ * and triggers its download.
+ *
+ * @param[in, out] sm   : Context of the procedure.
+ * @param[in] dev       : Structure instance of bmi2_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t write_crt_chunk(struct bmi2_test_sm *sm, struct bmi2_dev *dev);
+
+/*!
+ * @brief This internal API moves on to the next burst of the CRT
+ * configuration, or to the wait for the end of the CRT.
+ *
+ * @param[in] now_us    : Current time in microseconds.
+ * @param[in, out] sm   : Context of the procedure.
+ *
+ * @return BMI2_W_STEP_PENDING
+ */
+static int8_t next_crt_chunk(uint32_t now_us, struct bmi2_test_sm *sm);
+
+/*!
+ * @brief This internal API runs a step of the gyro self-test or CRT.
+ *
+ * @param[in] now_us    : Current time in microseconds.
+ * @param[in, out] sm   : Context of the procedure.
+ * @param[in] dev       : Structure instance of bmi2_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval BMI2_W_STEP_PENDING -> Next step is due at sm->next_us
+ * @retval < 0 -> Fail
+ */
+static int8_t step_gtrigger(uint32_t now_us, struct bmi2_test_sm *sm, struct bmi2_dev *dev);
+
+/*!
+ * @brief This internal API runs a step of the accelerometer self-test.
+ *
+ * @param[in] now_us    : Current time in microseconds.
+ * @param[in, out] sm   : Context of the procedure.
+ * @param[in] dev       : Structure instance of bmi2_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval BMI2_W_STEP_PENDING -> Next step is due at sm->next_us
+ * @retval < 0 -> Fail
+ */
+static int8_t step_accel_self_test(uint32_t now_us, struct bmi2_test_sm *sm, struct bmi2_dev *dev);
+
+/*!
+ * @brief This internal API runs a step of the NVM programming.
  *
- * @param[in]  max_burst_length  : Variable to store maximum burst length.
- * @param[in]  gyro_st_crt       : Update the gyro self-test crt enable bit.
- * @param[in, out]  dev          : Structure instance of bmi2_dev.
+ * @param[in] now_us    : Current time in microseconds.
+ * @param[in, out] sm   : Context of the procedure.
+ * @param[in] dev       : Structure instance of bmi2_dev.
  *
  * @return Result of API execution status
  * @retval 0 -> Success
+ * @retval BMI2_W_STEP_PENDING -> Next step is due at sm->next_us
  * @retval < 0 -> Fail
  */
-static int8_t gyro_crt_test(uint8_t max_burst_length, uint8_t gyro_st_crt, struct bmi2_dev *dev);
+static int8_t step_nvm_prog(uint32_t now_us, struct bmi2_test_sm *sm, struct bmi2_dev *dev);
 
 /*!
  * @brief This internal API is used to unpack virtual auxillary sensortime data.
@@ -1819,6 +1976,65 @@ static void unpack_virtual_aux_data(struct bmi2_aux_fifo_data *aux,
                                     const struct bmi2_fifo_frame *fifo,
                                     const struct bmi2_dev *dev);
 
+/*!
+ * @brief This internal API looks up the encoder of a feature and locates its
+ * input configuration in the feature pages.
+ *
+ * @param[out] feat_enc : Encoder of the feature, NULL if the type is not in
+ *                        the encoder table.
+ * @param[out] cfg      : Page and start address of the feature.
+ * @param[in]  type     : Type of feature or sensor.
+ * @param[in]  enc      : Encoder table of the variant.
+ * @param[in]  n_enc    : Number of entries in the encoder table.
+ * @param[in]  dev      : Structure instance of bmi2_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t locate_encoded_feat(const struct bmi2_feat_encoder **feat_enc,
+                                  struct bmi2_feature_config *cfg,
+                                  uint8_t type,
+                                  const struct bmi2_feat_encoder *enc,
+                                  uint8_t n_enc,
+                                  const struct bmi2_dev *dev);
+
+/*!
+ * @brief This internal API packs the fields of a feature configuration into
+ * the image of its feature page.
+ *
+ * @param[in,out] feat_config : Image of the feature page.
+ * @param[in]     start_addr  : Start address of the feature in the page.
+ * @param[in]     feat_enc    : Encoder of the feature.
+ * @param[in]     config      : Feature configuration structure.
+ *
+ * @return None
+ *
+ * @retval None
+ */
+static void pack_feat_fields(uint8_t *feat_config,
+                             uint8_t start_addr,
+                             const struct bmi2_feat_encoder *feat_enc,
+                             const void *config);
+
+/*!
+ * @brief This internal API unpacks the fields of a feature configuration from
+ * the image of its feature page.
+ *
+ * @param[in]  feat_config : Image of the feature page.
+ * @param[in]  start_addr  : Start address of the feature in the page.
+ * @param[in]  feat_enc    : Encoder of the feature.
+ * @param[out] config      : Feature configuration structure.
+ *
+ * @return None
+ *
+ * @retval None
+ */
+static void unpack_feat_fields(const uint8_t *feat_config,
+                               uint8_t start_addr,
+                               const struct bmi2_feat_encoder *feat_enc,
+                               void *config);
+
 /******************************************************************************/
 /*!  @name      User Interface Definitions                            */
 /******************************************************************************/
@@ -2196,9 +2412,7 @@ int8_t bmi2_write_config_file(struct bmi2_dev *dev)
         if (rslt == BMI2_OK)
         {
             /* Check the configuration load status */
-            rslt = bmi2_get_internal_status(&load_status, dev);
-
-            load_status &= BMI2_CONFIG_LOAD_STATUS_MASK;
+            rslt = wait_config_load(&load_status, dev);
 
             dev->load_status = load_status;
 
@@ -3099,40 +3313,255 @@ int8_t bmi2_extract_gyro(struct bmi2_sens_axes_data *gyro_data,
 }
 
 /*!
- * @brief This API parses and extracts the auxiliary frames from FIFO data
- * read by the "bmi2_read_fifo_data" API and stores it in "aux_data" buffer.
+ * @brief This API parses the accelerometer and gyroscope frames from FIFO data
+ * read by the "bmi2_read_fifo_data" API in a single pass over the data.
  */
-int8_t bmi2_extract_aux(struct bmi2_aux_fifo_data *aux,
-                        uint16_t *aux_length,
-                        struct bmi2_fifo_frame *fifo,
-                        const struct bmi2_dev *dev)
+int8_t bmi2_extract_accel_gyro(struct bmi2_sens_axes_data *accel_data,
+                               uint16_t *accel_length,
+                               struct bmi2_sens_axes_data *gyro_data,
+                               uint16_t *gyro_length,
+                               struct bmi2_fifo_frame *fifo,
+                               const struct bmi2_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
 
+    /* Variable to index the data bytes */
+    uint16_t data_index;
+
+    /* Variables to index accelerometer and gyroscope frames */
+    uint16_t accel_index = 0;
+    uint16_t gyro_index = 0;
+
+    /* Variable to define header frame */
+    uint8_t frame;
+
+    /* Variable to define the length of the current frame */
+    uint8_t frame_len;
+
+    /* Variable to define the length of the frame header */
+    uint8_t header_len;
+
+    /* Variable to index the words of an over-read frame */
+    uint8_t word;
+
     /* Null-pointer check */
     rslt = null_ptr_check(dev);
-    if ((rslt == BMI2_OK) && (aux != NULL) && (aux_length != NULL) && (fifo != NULL))
+
+    if ((rslt == BMI2_OK) && (accel_data != NULL) && (accel_length != NULL) && (gyro_data != NULL) &&
+        (gyro_length != NULL) && (fifo != NULL))
     {
-        /* Check if this is the first iteration of data unpacking
-         * if yes, then consider dummy byte on SPI
-         */
-        if (fifo->aux_byte_start_idx == 0)
+        /* Dummy byte included on the first iteration */
+        if (fifo->acc_byte_start_idx == 0)
         {
-            /* Dummy byte included */
-            fifo->aux_byte_start_idx = dev->dummy_byte;
+            fifo->acc_byte_start_idx = dev->dummy_byte;
         }
 
-        /* Parsing the FIFO data in header-less mode */
-        if (fifo->header_enable == 0)
+        data_index = fifo->acc_byte_start_idx;
+        header_len = (fifo->header_enable != 0) ? 1 : 0;
+
+        /* In header-less mode every frame carries the enabled sensors, map
+         * them to the equivalent frame header
+         */
+        frame = BMI2_FIFO_HEAD_OVER_READ_MSB;
+        if (fifo->data_enable & BMI2_FIFO_ACC_EN)
         {
-            /* Parsing the FIFO data in headerless mode */
-            rslt = extract_aux_headerless_mode(aux, aux_length, fifo, dev);
+            frame |= BMI2_FIFO_HEADER_ACC_FRM;
         }
-        else
+
+        if (fifo->data_enable & BMI2_FIFO_GYR_EN)
         {
-            /* Parsing the FIFO data in header mode */
-            rslt = extract_aux_header_mode(aux, aux_length, fifo, dev);
+            frame |= BMI2_FIFO_HEADER_GYR_FRM;
+        }
+
+        if (fifo->data_enable & BMI2_FIFO_AUX_EN)
+        {
+            frame |= BMI2_FIFO_HEADER_AUX_FRM;
+        }
+
+        while ((rslt == BMI2_OK) && (data_index < fifo->length))
+        {
+            if (header_len != 0)
+            {
+                frame = fifo->data[data_index] & BMI2_FIFO_TAG_INTR_MASK;
+            }
+
+            switch (frame)
+            {
+                case BMI2_FIFO_HEADER_ACC_FRM:
+                case BMI2_FIFO_HEADER_GYR_FRM:
+                case BMI2_FIFO_HEADER_AUX_FRM:
+                case BMI2_FIFO_HEADER_GYR_ACC_FRM:
+                case BMI2_FIFO_HEADER_AUX_ACC_FRM:
+                case BMI2_FIFO_HEADER_AUX_GYR_FRM:
+                case BMI2_FIFO_HEADER_ALL_FRM:
+                    frame_len = header_len;
+                    if ((frame & BMI2_FIFO_HEADER_AUX_FRM) == BMI2_FIFO_HEADER_AUX_FRM)
+                    {
+                        frame_len += BMI2_FIFO_AUX_LENGTH;
+                    }
+
+                    if ((frame & BMI2_FIFO_HEADER_GYR_FRM) == BMI2_FIFO_HEADER_GYR_FRM)
+                    {
+                        frame_len += BMI2_FIFO_GYR_LENGTH;
+                    }
+
+                    if ((frame & BMI2_FIFO_HEADER_ACC_FRM) == BMI2_FIFO_HEADER_ACC_FRM)
+                    {
+                        frame_len += BMI2_FIFO_ACC_LENGTH;
+                    }
+
+                    /* Partially read frame is re-sent by the sensor on the next read */
+                    if ((data_index + frame_len) > fifo->length)
+                    {
+                        data_index = fifo->length;
+                        break;
+                    }
+
+                    /* Stop before the output buffers overflow */
+                    if ((((frame & BMI2_FIFO_HEADER_ACC_FRM) == BMI2_FIFO_HEADER_ACC_FRM) &&
+                         (accel_index >= (*accel_length))) ||
+                        (((frame & BMI2_FIFO_HEADER_GYR_FRM) == BMI2_FIFO_HEADER_GYR_FRM) &&
+                         (gyro_index >= (*gyro_length))))
+                    {
+                        rslt = BMI2_W_PARTIAL_READ;
+                        break;
+                    }
+
+                    if (header_len == 0)
+                    {
+                        /* Check for the over-read pattern of an empty FIFO */
+                        for (word = 0; (word + 1) < frame_len; word += 2)
+                        {
+                            if ((fifo->data[data_index + word] != BMI2_FIFO_LSB_CONFIG_CHECK) ||
+                                (fifo->data[data_index + word + 1] != BMI2_FIFO_MSB_CONFIG_CHECK))
+                            {
+                                break;
+                            }
+                        }
+
+                        if ((word + 1) >= frame_len)
+                        {
+                            rslt = BMI2_W_FIFO_EMPTY;
+                            break;
+                        }
+
+                        /* Skip dummy frames */
+                        if ((fifo->data[data_index] >= BMI2_FIFO_HEADERLESS_DUMMY_ACC) &&
+                            (fifo->data[data_index] <= BMI2_FIFO_HEADERLESS_DUMMY_AUX) &&
+                            (fifo->data[data_index + 1] == BMI2_FIFO_HEADERLESS_DUMMY_BYTE_1) &&
+                            (fifo->data[data_index + 2] == BMI2_FIFO_HEADERLESS_DUMMY_BYTE_2) &&
+                            (fifo->data[data_index + 3] == BMI2_FIFO_HEADERLESS_DUMMY_BYTE_3))
+                        {
+                            data_index += frame_len;
+                            break;
+                        }
+                    }
+
+                    /* Frame payload is ordered auxiliary, gyroscope, accelerometer */
+                    data_index += header_len;
+                    if ((frame & BMI2_FIFO_HEADER_AUX_FRM) == BMI2_FIFO_HEADER_AUX_FRM)
+                    {
+                        data_index += BMI2_FIFO_AUX_LENGTH;
+                    }
+
+                    if ((frame & BMI2_FIFO_HEADER_GYR_FRM) == BMI2_FIFO_HEADER_GYR_FRM)
+                    {
+                        unpack_gyro_data(&gyro_data[gyro_index], data_index, fifo, dev);
+                        gyro_index++;
+                        data_index += BMI2_FIFO_GYR_LENGTH;
+                    }
+
+                    if ((frame & BMI2_FIFO_HEADER_ACC_FRM) == BMI2_FIFO_HEADER_ACC_FRM)
+                    {
+                        unpack_accel_data(&accel_data[accel_index], data_index, fifo, dev);
+                        accel_index++;
+                        data_index += BMI2_FIFO_ACC_LENGTH;
+                    }
+
+                    break;
+
+                case BMI2_FIFO_HEADER_SENS_TIME_FRM:
+                    data_index++;
+                    (void)unpack_sensortime_frame(&data_index, fifo);
+                    break;
+
+                case BMI2_FIFO_HEADER_SKIP_FRM:
+                    data_index++;
+                    (void)unpack_skipped_frame(&data_index, fifo);
+                    break;
+
+                case BMI2_FIFO_HEADER_INPUT_CFG_FRM:
+                    data_index++;
+                    (void)move_next_frame(&data_index, BMI2_FIFO_INPUT_CFG_LENGTH, fifo);
+                    break;
+
+                case BMI2_FIFO_HEAD_OVER_READ_MSB:
+
+                    /* Header of an empty FIFO, or no sensor enabled in header-less mode */
+                    rslt = (header_len != 0) ? BMI2_W_FIFO_EMPTY : BMI2_OK;
+                    data_index = fifo->length;
+                    break;
+
+                default:
+
+                    /* Move the data index to the last byte in case of invalid values */
+                    data_index = fifo->length;
+                    break;
+            }
+        }
+
+        /* Update number of frames parsed */
+        (*accel_length) = accel_index;
+        (*gyro_length) = gyro_index;
+
+        /* Update the byte index to resume from */
+        fifo->acc_byte_start_idx = data_index;
+        fifo->gyr_byte_start_idx = data_index;
+    }
+    else
+    {
+        rslt = BMI2_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API parses and extracts the auxiliary frames from FIFO data
+ * read by the "bmi2_read_fifo_data" API and stores it in "aux_data" buffer.
+ */
+int8_t bmi2_extract_aux(struct bmi2_aux_fifo_data *aux,
+                        uint16_t *aux_length,
+                        struct bmi2_fifo_frame *fifo,
+                        const struct bmi2_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+    if ((rslt == BMI2_OK) && (aux != NULL) && (aux_length != NULL) && (fifo != NULL))
+    {
+        /* Check if this is the first iteration of data unpacking
+         * if yes, then consider dummy byte on SPI
+         */
+        if (fifo->aux_byte_start_idx == 0)
+        {
+            /* Dummy byte included */
+            fifo->aux_byte_start_idx = dev->dummy_byte;
+        }
+
+        /* Parsing the FIFO data in header-less mode */
+        if (fifo->header_enable == 0)
+        {
+            /* Parsing the FIFO data in headerless mode */
+            rslt = extract_aux_headerless_mode(aux, aux_length, fifo, dev);
+        }
+        else
+        {
+            /* Parsing the FIFO data in header mode */
+            rslt = extract_aux_header_mode(aux, aux_length, fifo, dev);
         }
     }
     else
@@ -3752,102 +4181,7 @@ int8_t bmi2_perform_accel_self_test(struct bmi2_dev *dev)
     /* Variable to define error */
     int8_t rslt;
 
-    /* Variable to store self-test result */
-    int8_t st_rslt = 0;
-
-    /* Structure to define positive accelerometer axes */
-    struct bmi2_sens_axes_data positive = { 0, 0, 0, 0 };
-
-    /* Structure to define negative accelerometer axes */
-    struct bmi2_sens_axes_data negative = { 0, 0, 0, 0 };
-
-    /* Structure for difference of accelerometer values in g */
-    struct bmi2_selftest_delta_limit accel_data_diff = { 0, 0, 0 };
-
-    /* Structure for difference of accelerometer values in mg */
-    struct bmi2_selftest_delta_limit accel_data_diff_mg = { 0, 0, 0 };
-
-    /* Initialize the polarity of self-test as positive */
-    int8_t sign = BMI2_ENABLE;
-
-    /* Null-pointer check */
-    rslt = null_ptr_check(dev);
-    if (rslt == BMI2_OK)
-    {
-        /* Sets the configuration required before enabling self-test */
-        rslt = pre_self_test_config(dev);
-
-        /* Wait for greater than 2 milliseconds */
-        dev->delay_us(3000, dev->intf_ptr);
-        if (rslt == BMI2_OK)
-        {
-            do
-            {
-                /* Select positive first, then negative polarity
-                 * after enabling self-test
-                 */
-                rslt = self_test_config((uint8_t) sign, dev);
-                if (rslt == BMI2_OK)
-                {
-                    /* Wait for greater than 50 milli-sec */
-                    dev->delay_us(51000, dev->intf_ptr);
-
-                    /* If polarity is positive */
-                    if (sign == BMI2_ENABLE)
-                    {
-                        /* Read and store positive acceleration value */
-                        rslt = read_accel_xyz(&positive, dev);
-                    }
-                    /* If polarity is negative */
-                    else if (sign == BMI2_DISABLE)
-                    {
-                        /* Read and store negative acceleration value */
-                        rslt = read_accel_xyz(&negative, dev);
-                    }
-                }
-                else
-                {
-                    /* Break if error */
-                    break;
-                }
-
-                /* Break if error */
-                if (rslt != BMI2_OK)
-                {
-                    break;
-                }
-
-                /* Turn the polarity of self-test negative */
-                sign--;
-            } while (sign >= 0);
-            if (rslt == BMI2_OK)
-            {
-                /* Subtract -ve acceleration values from that of +ve values */
-                accel_data_diff.x = (positive.x) - (negative.x);
-                accel_data_diff.y = (positive.y) - (negative.y);
-                accel_data_diff.z = (positive.z) - (negative.z);
-
-                /* Convert differences of acceleration values
-                 * from 'g' to 'mg'
-                 */
-                convert_lsb_g(&accel_data_diff, &accel_data_diff_mg, dev);
-
-                /* Validate self-test for acceleration values
-                 * in mg and get the self-test result
-                 */
-                st_rslt = validate_self_test(&accel_data_diff_mg);
-
-                /* Trigger a soft reset after performing self-test */
-                rslt = bmi2_soft_reset(dev);
-
-                /* Return the self-test result */
-                if (rslt == BMI2_OK)
-                {
-                    rslt = st_rslt;
-                }
-            }
-        }
-    }
+    rslt = run_test_sm(BMI2_TEST_SM_ACCEL_SELF_TEST, dev);
 
     return rslt;
 }
@@ -4578,7 +4912,7 @@ int8_t bmi2_perform_accel_foc(const struct bmi2_accel_foc_g_value *accel_g_value
             /* Set configurations for FOC */
             if (rslt == BMI2_OK)
             {
-                rslt = set_accel_foc_config(dev);
+                rslt = set_accel_foc_config(BMI2_FOC_ACC_CONF_VAL, dev);
             }
 
             /* Perform accelerometer FOC */
@@ -4635,9 +4969,6 @@ int8_t bmi2_perform_gyro_foc(struct bmi2_dev *dev)
     /* Variable to define count */
     uint8_t loop = 0;
 
-    /* Structure to store the offset values to be stored in the register */
-    struct bmi2_sens_axes_data gyro_offset = { 0, 0, 0, 0 };
-
     /* Null-pointer check */
     rslt = null_ptr_check(dev);
     if (rslt == BMI2_OK)
@@ -4650,7 +4981,7 @@ int8_t bmi2_perform_gyro_foc(struct bmi2_dev *dev)
         /* Set configurations for gyroscope FOC */
         if (rslt == BMI2_OK)
         {
-            rslt = set_gyro_foc_config(dev);
+            rslt = set_gyro_foc_config(BMI2_FOC_GYR_CONF_VAL, dev);
         }
 
         /* Perform FOC */
@@ -4690,33 +5021,7 @@ int8_t bmi2_perform_gyro_foc(struct bmi2_dev *dev)
 
             if (rslt == BMI2_OK)
             {
-                /* Take average of x, y and z data for lesser
-                 * noise. It is same as offset data since lsb/dps
-                 * is same for both data and offset register
-                 */
-                gyro_offset.x = (int16_t)(temp.x / 128);
-                gyro_offset.y = (int16_t)(temp.y / 128);
-                gyro_offset.z = (int16_t)(temp.z / 128);
-
-                /* Saturate gyroscope data since the offset
-                 * registers are of 10 bit value where as the
-                 * gyroscope data is of 16 bit value
-                 */
-                saturate_gyro_data(&gyro_offset);
-
-                /* Invert the gyroscope offset  data */
-                invert_gyro_offset(&gyro_offset);
-
-                /* Write offset data in the gyroscope offset
-                 * compensation register
-                 */
-                rslt = bmi2_write_gyro_offset_comp_axes(&gyro_offset, dev);
-            }
-
-            /* Enable gyroscope offset compensation */
-            if (rslt == BMI2_OK)
-            {
-                rslt = bmi2_set_gyro_offset_comp(BMI2_ENABLE, dev);
+                rslt = write_gyro_foc_offset(&temp, dev);
             }
 
             /* Restore the saved gyroscope configurations */
@@ -4731,71 +5036,200 @@ int8_t bmi2_perform_gyro_foc(struct bmi2_dev *dev)
 }
 
 /*!
- * @brief This API is used to get the feature configuration from the
- * selected page.
+ * @brief This API performs Fast Offset Compensation for accelerometer with the
+ * samples collected in the FIFO.
  */
-int8_t bmi2_get_feat_config(uint8_t sw_page, uint8_t *feat_config, struct bmi2_dev *dev)
+int8_t bmi2_perform_accel_foc_fifo(const struct bmi2_accel_foc_g_value *accel_g_value, struct bmi2_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    /* Variable to define bytes remaining to read */
-    uint8_t bytes_remain = BMI2_FEAT_SIZE_IN_BYTES;
+    /* Structure to define the accelerometer configurations */
+    struct bmi2_accel_config acc_cfg = { 0, 0, 0, 0 };
 
-    /* Variable to define the read-write length */
-    uint8_t read_write_len = 0;
+    /* Variable to store status of advance power save */
+    uint8_t aps = 0;
 
-    /* Variable to define the feature configuration address */
-    uint8_t addr = BMI2_FEATURES_REG_ADDR;
+    /* Variable to store status of accelerometer enable */
+    uint8_t acc_en = 0;
 
-    /* Variable to define index */
-    uint8_t index = 0;
+    /* Structure to store the sum of accelerometer data */
+    struct bmi2_foc_temp_value temp = { 0, 0, 0 };
 
-    if ((feat_config == NULL) || (dev == NULL))
-    {
-        rslt = BMI2_E_NULL_PTR;
-    }
-    else
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+    if ((rslt == BMI2_OK) && (accel_g_value != NULL))
     {
-        /* Check whether the page is valid */
-        if (sw_page < dev->page_max)
+        /* Check for input validity */
+        if ((((BMI2_ABS(accel_g_value->x)) + (BMI2_ABS(accel_g_value->y)) + (BMI2_ABS(accel_g_value->z))) == 1) &&
+            ((accel_g_value->sign == 1) || (accel_g_value->sign == 0)))
         {
-            /* Switch page */
-            rslt = bmi2_set_regs(BMI2_FEAT_PAGE_ADDR, &sw_page, 1, dev);
+            /* Save accelerometer configurations, accelerometer
+             * enable status and advance power save status
+             */
+            rslt = save_accel_foc_config(&acc_cfg, &aps, &acc_en, dev);
 
-            /* If user length is less than feature length */
-            if ((rslt == BMI2_OK) && (dev->read_write_len < BMI2_FEAT_SIZE_IN_BYTES))
+            /* Set configurations for FOC */
+            if (rslt == BMI2_OK)
             {
-                /* Read-write should be even */
-                if ((dev->read_write_len % 2) != 0)
-                {
-                    dev->read_write_len--;
-                }
-
-                while (bytes_remain > 0)
-                {
-                    if (bytes_remain >= dev->read_write_len)
-                    {
-                        /* Read from the page */
-                        rslt = bmi2_get_regs(addr, &feat_config[index], dev->read_write_len, dev);
-
-                        /* Update index */
-                        index += (uint8_t) dev->read_write_len;
-
-                        /* Update address */
-                        addr += (uint8_t) dev->read_write_len;
+                rslt = set_accel_foc_config(BMI2_FOC_FIFO_ACC_CONF_VAL, dev);
+            }
 
-                        /* Update read-write length */
-                        read_write_len += (uint8_t) dev->read_write_len;
-                    }
-                    else
-                    {
-                        /* Read from the page */
-                        rslt = bmi2_get_regs(addr, (uint8_t *) (feat_config + index), (uint16_t) bytes_remain, dev);
+            /* Collect the samples in the FIFO */
+            if (rslt == BMI2_OK)
+            {
+                rslt = read_foc_fifo_samples(BMI2_FIFO_ACC_EN, BMI2_FOC_FIFO_ACC_CONF_VAL, &temp, dev);
+            }
 
-                        /* Update read-write length */
-                        read_write_len += bytes_remain;
-                    }
+            /* Write and enable the offsets */
+            if (rslt == BMI2_OK)
+            {
+                rslt = write_accel_foc_offset(accel_g_value, &acc_cfg, &temp, dev);
+            }
+
+            /* Restore the saved configurations */
+            if (rslt == BMI2_OK)
+            {
+                rslt = restore_accel_foc_config(&acc_cfg, aps, acc_en, dev);
+            }
+        }
+        else
+        {
+            rslt = BMI2_E_INVALID_INPUT;
+        }
+    }
+    else
+    {
+        rslt = BMI2_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API performs Fast Offset Compensation for gyroscope with the
+ * samples collected in the FIFO.
+ */
+int8_t bmi2_perform_gyro_foc_fifo(struct bmi2_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Structure to define the gyroscope configurations */
+    struct bmi2_gyro_config gyr_cfg = { 0, 0, 0, 0, 0, 0 };
+
+    /* Variable to store status of advance power save */
+    uint8_t aps = 0;
+
+    /* Variable to store status of gyroscope enable */
+    uint8_t gyr_en = 0;
+
+    /* Structure to store the sum of gyroscope data */
+    struct bmi2_foc_temp_value temp = { 0, 0, 0 };
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+    if (rslt == BMI2_OK)
+    {
+        /* Save gyroscope configurations, gyroscope enable
+         * status and advance power save status
+         */
+        rslt = save_gyro_config(&gyr_cfg, &aps, &gyr_en, dev);
+
+        /* Set configurations for gyroscope FOC */
+        if (rslt == BMI2_OK)
+        {
+            rslt = set_gyro_foc_config(BMI2_FOC_FIFO_GYR_CONF_VAL, dev);
+        }
+
+        /* Collect the samples in the FIFO */
+        if (rslt == BMI2_OK)
+        {
+            rslt = read_foc_fifo_samples(BMI2_FIFO_GYR_EN, BMI2_FOC_FIFO_GYR_CONF_VAL, &temp, dev);
+        }
+
+        /* Write and enable the offsets */
+        if (rslt == BMI2_OK)
+        {
+            rslt = write_gyro_foc_offset(&temp, dev);
+        }
+
+        /* Restore the saved gyroscope configurations */
+        if (rslt == BMI2_OK)
+        {
+            rslt = restore_gyro_config(&gyr_cfg, aps, gyr_en, dev);
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is used to get the feature configuration from the
+ * selected page.
+ */
+int8_t bmi2_get_feat_config(uint8_t sw_page, uint8_t *feat_config, struct bmi2_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Variable to define bytes remaining to read */
+    uint8_t bytes_remain = BMI2_FEAT_SIZE_IN_BYTES;
+
+    /* Variable to define the read-write length */
+    uint8_t read_write_len = 0;
+
+    /* Variable to define the feature configuration address */
+    uint8_t addr = BMI2_FEATURES_REG_ADDR;
+
+    /* Variable to define index */
+    uint8_t index = 0;
+
+    if ((feat_config == NULL) || (dev == NULL))
+    {
+        rslt = BMI2_E_NULL_PTR;
+    }
+    else
+    {
+        /* Check whether the page is valid */
+        if (sw_page < dev->page_max)
+        {
+            /* Switch page */
+            rslt = bmi2_set_regs(BMI2_FEAT_PAGE_ADDR, &sw_page, 1, dev);
+
+            /* If user length is less than feature length */
+            if ((rslt == BMI2_OK) && (dev->read_write_len < BMI2_FEAT_SIZE_IN_BYTES))
+            {
+                /* Read-write should be even */
+                if ((dev->read_write_len % 2) != 0)
+                {
+                    dev->read_write_len--;
+                }
+
+                while (bytes_remain > 0)
+                {
+                    if (bytes_remain >= dev->read_write_len)
+                    {
+                        /* Read from the page */
+                        rslt = bmi2_get_regs(addr, &feat_config[index], dev->read_write_len, dev);
+
+                        /* Update index */
+                        index += (uint8_t) dev->read_write_len;
+
+                        /* Update address */
+                        addr += (uint8_t) dev->read_write_len;
+
+                        /* Update read-write length */
+                        read_write_len += (uint8_t) dev->read_write_len;
+                    }
+                    else
+                    {
+                        /* Read from the page */
+                        rslt = bmi2_get_regs(addr, (uint8_t *) (feat_config + index), (uint16_t) bytes_remain, dev);
+
+                        /* Update read-write length */
+                        read_write_len += bytes_remain;
+                    }
 
                     /* Remaining bytes */
                     bytes_remain = BMI2_FEAT_SIZE_IN_BYTES - read_write_len;
@@ -4851,6 +5285,165 @@ uint8_t bmi2_extract_input_feat_config(struct bmi2_feature_config *feat_config,
     return feat_found;
 }
 
+/*!
+ * @brief This API writes the configurations of the features described by an
+ * encoder table, reading and writing each feature page at most once.
+ */
+int8_t bmi2_set_feat_config_batch(const struct bmi2_sens_config *sens_cfg,
+                                  uint8_t n_sens,
+                                  const struct bmi2_feat_encoder *enc,
+                                  uint8_t n_enc,
+                                  struct bmi2_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Variables to define loop */
+    uint8_t loop;
+    uint8_t idx;
+
+    /* Bit mask of the feature pages already written */
+    uint8_t pages_done = 0;
+
+    /* Array to define the feature page image */
+    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
+
+    /* Encoders of the features */
+    const struct bmi2_feat_encoder *feat_enc = NULL;
+    const struct bmi2_feat_encoder *page_enc = NULL;
+
+    /* Input configurations of the features */
+    struct bmi2_feature_config cfg = { 0, 0, 0 };
+    struct bmi2_feature_config page_cfg = { 0, 0, 0 };
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+    if ((rslt == BMI2_OK) && (sens_cfg != NULL) && (enc != NULL))
+    {
+        for (loop = 0; (loop < n_sens) && (rslt == BMI2_OK); loop++)
+        {
+            rslt = locate_encoded_feat(&feat_enc, &cfg, sens_cfg[loop].type, enc, n_enc, dev);
+            if ((rslt == BMI2_OK) && (feat_enc != NULL) && ((pages_done & (UINT8_C(1) << cfg.page)) == 0))
+            {
+                rslt = bmi2_get_feat_config(cfg.page, feat_config, dev);
+
+                /* Pack every configuration of the batch residing in this page */
+                for (idx = loop; (idx < n_sens) && (rslt == BMI2_OK); idx++)
+                {
+                    rslt = locate_encoded_feat(&page_enc, &page_cfg, sens_cfg[idx].type, enc, n_enc, dev);
+                    if ((rslt == BMI2_OK) && (page_enc != NULL) && (page_cfg.page == cfg.page))
+                    {
+                        pack_feat_fields(feat_config, page_cfg.start_addr, page_enc, &sens_cfg[idx].cfg);
+                    }
+                }
+
+                if (rslt == BMI2_OK)
+                {
+                    /* Set the configuration back to the page */
+                    rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
+                }
+
+                pages_done |= (uint8_t)(UINT8_C(1) << cfg.page);
+            }
+        }
+    }
+    else if (rslt == BMI2_OK)
+    {
+        rslt = BMI2_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the configurations of the features described by an
+ * encoder table, reading each feature page at most once.
+ */
+int8_t bmi2_get_feat_config_batch(struct bmi2_sens_config *sens_cfg,
+                                  uint8_t n_sens,
+                                  const struct bmi2_feat_encoder *enc,
+                                  uint8_t n_enc,
+                                  struct bmi2_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Variables to define loop */
+    uint8_t loop;
+    uint8_t idx;
+
+    /* Bit mask of the feature pages already read */
+    uint8_t pages_done = 0;
+
+    /* Array to define the feature page image */
+    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
+
+    /* Encoders of the features */
+    const struct bmi2_feat_encoder *feat_enc = NULL;
+    const struct bmi2_feat_encoder *page_enc = NULL;
+
+    /* Input configurations of the features */
+    struct bmi2_feature_config cfg = { 0, 0, 0 };
+    struct bmi2_feature_config page_cfg = { 0, 0, 0 };
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+    if ((rslt == BMI2_OK) && (sens_cfg != NULL) && (enc != NULL))
+    {
+        for (loop = 0; (loop < n_sens) && (rslt == BMI2_OK); loop++)
+        {
+            rslt = locate_encoded_feat(&feat_enc, &cfg, sens_cfg[loop].type, enc, n_enc, dev);
+            if ((rslt == BMI2_OK) && (feat_enc != NULL) && ((pages_done & (UINT8_C(1) << cfg.page)) == 0))
+            {
+                rslt = bmi2_get_feat_config(cfg.page, feat_config, dev);
+
+                /* Unpack every configuration of the batch residing in this page */
+                for (idx = loop; (idx < n_sens) && (rslt == BMI2_OK); idx++)
+                {
+                    rslt = locate_encoded_feat(&page_enc, &page_cfg, sens_cfg[idx].type, enc, n_enc, dev);
+                    if ((rslt == BMI2_OK) && (page_enc != NULL) && (page_cfg.page == cfg.page))
+                    {
+                        unpack_feat_fields(feat_config, page_cfg.start_addr, page_enc, &sens_cfg[idx].cfg);
+                    }
+                }
+
+                pages_done |= (uint8_t)(UINT8_C(1) << cfg.page);
+            }
+        }
+    }
+    else if (rslt == BMI2_OK)
+    {
+        rslt = BMI2_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API searches the encoder table for a feature.
+ */
+const struct bmi2_feat_encoder *bmi2_find_feat_encoder(uint8_t type,
+                                                       const struct bmi2_feat_encoder *enc,
+                                                       uint8_t n_enc)
+{
+    /* Variable to define loop */
+    uint8_t loop;
+
+    /* Encoder of the feature */
+    const struct bmi2_feat_encoder *feat_enc = NULL;
+
+    for (loop = 0; (loop < n_enc) && (enc != NULL); loop++)
+    {
+        if (enc[loop].type == type)
+        {
+            feat_enc = &enc[loop];
+            break;
+        }
+    }
+
+    return feat_enc;
+}
+
 /***************************************************************************/
 
 /*!         Local Function Definitions
@@ -4884,6 +5477,9 @@ static int8_t write_config_file(struct bmi2_dev *dev)
     /* Variable to define temporary read/write length */
     uint16_t read_write_len = 0;
 
+    /* Decode a compressed configuration file from its start */
+    reset_config_cursor(dev);
+
     /* Disable advanced power save mode */
     rslt = bmi2_set_adv_power_save(BMI2_DISABLE, dev);
     if (rslt == BMI2_OK)
@@ -4897,7 +5493,7 @@ static int8_t write_config_file(struct bmi2_dev *dev)
                 /* Write the configuration file */
                 for (index = 0; (index < config_size) && (rslt == BMI2_OK); index += dev->read_write_len)
                 {
-                    rslt = upload_file((dev->config_file_ptr + index), index, dev->read_write_len, dev);
+                    rslt = upload_config_chunk(index, dev->read_write_len, dev);
                 }
             }
             else
@@ -4908,7 +5504,7 @@ static int8_t write_config_file(struct bmi2_dev *dev)
                 /* Write the configuration file for the balancem bytes */
                 for (index = 0; (index < bal_byte) && (rslt == BMI2_OK); index += dev->read_write_len)
                 {
-                    rslt = upload_file((dev->config_file_ptr + index), index, dev->read_write_len, dev);
+                    rslt = upload_config_chunk(index, dev->read_write_len, dev);
                 }
 
                 if (rslt == BMI2_OK)
@@ -4924,7 +5520,7 @@ static int8_t write_config_file(struct bmi2_dev *dev)
                          (index < config_size) && (rslt == BMI2_OK);
                          index += dev->read_write_len)
                     {
-                        rslt = upload_file((dev->config_file_ptr + index), index, dev->read_write_len, dev);
+                        rslt = upload_config_chunk(index, dev->read_write_len, dev);
                     }
 
                     /* Restore the user set length back from the temporary variable */
@@ -4949,61 +5545,248 @@ static int8_t write_config_file(struct bmi2_dev *dev)
     return rslt;
 }
 
-/*!
- * @brief This internal API enables/disables the loading of the configuration
- * file.
- */
-static int8_t set_config_load(uint8_t enable, struct bmi2_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt;
+/*!
+ * @brief This internal API enables/disables the loading of the configuration
+ * file.
+ */
+static int8_t set_config_load(uint8_t enable, struct bmi2_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Variable to store data */
+    uint8_t reg_data = 0;
+
+    rslt = bmi2_get_regs(BMI2_INIT_CTRL_ADDR, &reg_data, 1, dev);
+    if (rslt == BMI2_OK)
+    {
+        reg_data = BMI2_SET_BIT_POS0(reg_data, BMI2_CONF_LOAD_EN, enable);
+        rslt = bmi2_set_regs(BMI2_INIT_CTRL_ADDR, &reg_data, 1, dev);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API polls the internal status until the ASIC reports
+ * the result of loading the configuration file.
+ */
+static int8_t wait_config_load(uint8_t *load_status, struct bmi2_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt = BMI2_OK;
+
+    /* Variable to define the time waited */
+    uint32_t waited_us = 0;
+
+    *load_status = 0;
+
+    /* The load usually completes well before the longest wait */
+    while ((rslt == BMI2_OK) && (*load_status == 0) && (waited_us < BMI2_INTERNAL_STATUS_READ_DELAY_MS))
+    {
+        dev->delay_us(BMI2_CONFIG_LOAD_POLL_US, dev->intf_ptr);
+        waited_us += BMI2_CONFIG_LOAD_POLL_US;
+
+        rslt = bmi2_get_regs(BMI2_INTERNAL_STATUS_ADDR, load_status, 1, dev);
+        *load_status &= BMI2_CONFIG_LOAD_STATUS_MASK;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API loads the configuration file.
+ */
+static int8_t upload_file(const uint8_t *config_data, uint16_t index, uint16_t write_len, struct bmi2_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Array to store address */
+    uint8_t addr_array[2] = { 0 };
+
+    if (config_data != NULL)
+    {
+        /* Store 0 to 3 bits of address in first byte */
+        addr_array[0] = (uint8_t)((index / 2) & 0x0F);
+
+        /* Store 4 to 11 bits of address in the second byte */
+        addr_array[1] = (uint8_t)((index / 2) >> 4);
+
+        /* Write the 2 bytes of address in consecutive locations */
+        rslt = bmi2_set_regs(BMI2_INIT_ADDR_0, addr_array, 2, dev);
+        if (rslt == BMI2_OK)
+        {
+            /* Burst write configuration file data corresponding to user set length */
+            rslt = bmi2_set_regs(BMI2_INIT_DATA_ADDR, (uint8_t *)config_data, write_len, dev);
+        }
+    }
+    else
+    {
+        rslt = BMI2_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API loads a part of the configuration file, decoding
+ * it chunk by chunk when the configuration file is kept compressed.
+ */
+static int8_t upload_config_chunk(uint16_t index, uint16_t write_len, struct bmi2_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt = BMI2_OK;
+
+    /* Buffer to store the decoded chunk */
+    uint8_t chunk[BMI2_CONFIG_CHUNK_SIZE];
+
+    /* Variables to define the offset and length of the chunk */
+    uint16_t offset;
+    uint16_t len;
+
+    if (dev->config_blob == NULL)
+    {
+        rslt = upload_file((dev->config_file_ptr + index), index, write_len, dev);
+    }
+    else
+    {
+        /* Bursts longer than the chunk buffer are split, each chunk at its own address */
+        for (offset = 0; (offset < write_len) && (rslt == BMI2_OK); offset += len)
+        {
+            len = write_len - offset;
+            if (len > BMI2_CONFIG_CHUNK_SIZE)
+            {
+                len = BMI2_CONFIG_CHUNK_SIZE;
+            }
+
+            rslt = decode_config_blob(chunk, index + offset, len, dev);
+            if (rslt == BMI2_OK)
+            {
+                rslt = upload_file(chunk, index + offset, len, dev);
+            }
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API decodes a part of the compressed configuration
+ * file, continuing from the decode position of the previous part.
+ */
+static int8_t decode_config_blob(uint8_t *chunk, uint16_t index, uint16_t len, struct bmi2_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt = BMI2_OK;
+
+    /* Compressed configuration file and its decode position */
+    const struct bmi2_config_blob *blob = dev->config_blob;
+    struct bmi2_config_cursor *cursor = &dev->config_cursor;
+
+    /* Variable to define the end of the part */
+    uint32_t end = (uint32_t)index + len;
+
+    /* Variable to define the count of decoded bytes stored */
+    uint16_t count = 0;
+
+    /* Variables to store the control and decoded bytes */
+    uint8_t ctrl;
+    uint8_t byte;
+
+    /* The stream is only decoded forward, so restart it to go back */
+    if (index < cursor->out_pos)
+    {
+        reset_config_cursor(dev);
+    }
+
+    if (end > blob->raw_size)
+    {
+        rslt = BMI2_E_CONFIG_LOAD;
+    }
+
+    while ((rslt == BMI2_OK) && (cursor->out_pos < end))
+    {
+        if (cursor->run == 0)
+        {
+            /* Start the next literal run or dictionary copy */
+            if (cursor->in_pos >= blob->size)
+            {
+                rslt = BMI2_E_CONFIG_LOAD;
+            }
+            else
+            {
+                ctrl = blob->data[cursor->in_pos++];
+                if (ctrl & BMI2_CONFIG_BLOB_COPY)
+                {
+                    cursor->run = (uint8_t)((ctrl & BMI2_CONFIG_BLOB_LEN_MASK) + BMI2_CONFIG_BLOB_MIN_COPY);
+                    cursor->copy = BMI2_TRUE;
+
+                    if (((uint32_t)cursor->in_pos + 2) > blob->size)
+                    {
+                        rslt = BMI2_E_CONFIG_LOAD;
+                    }
+                    else
+                    {
+                        cursor->dict_pos = (uint16_t)(blob->data[cursor->in_pos] |
+                                                      ((uint16_t)blob->data[cursor->in_pos + 1] << 8));
+                        cursor->in_pos += 2;
+
+                        if (((uint32_t)cursor->dict_pos + cursor->run) > blob->dict_size)
+                        {
+                            rslt = BMI2_E_CONFIG_LOAD;
+                        }
+                    }
+                }
+                else
+                {
+                    cursor->run = (uint8_t)(ctrl + 1);
+                    cursor->copy = BMI2_FALSE;
+
+                    if (((uint32_t)cursor->in_pos + cursor->run) > blob->size)
+                    {
+                        rslt = BMI2_E_CONFIG_LOAD;
+                    }
+                }
+            }
+        }
+        else
+        {
+            if (cursor->copy == BMI2_TRUE)
+            {
+                byte = blob->dict[cursor->dict_pos++];
+            }
+            else
+            {
+                byte = blob->data[cursor->in_pos++];
+            }
+
+            cursor->run--;
 
-    /* Variable to store data */
-    uint8_t reg_data = 0;
+            /* Bytes before the part are decoded only to move forward */
+            if (cursor->out_pos >= index)
+            {
+                chunk[count++] = byte;
+            }
 
-    rslt = bmi2_get_regs(BMI2_INIT_CTRL_ADDR, &reg_data, 1, dev);
-    if (rslt == BMI2_OK)
-    {
-        reg_data = BMI2_SET_BIT_POS0(reg_data, BMI2_CONF_LOAD_EN, enable);
-        rslt = bmi2_set_regs(BMI2_INIT_CTRL_ADDR, &reg_data, 1, dev);
+            cursor->out_pos++;
+        }
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API loads the configuration file.
+ * @brief This internal API rewinds the decode position to the start of the
+ * compressed configuration file.
  */
-static int8_t upload_file(const uint8_t *config_data, uint16_t index, uint16_t write_len, struct bmi2_dev *dev)
+static void reset_config_cursor(struct bmi2_dev *dev)
 {
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to store address */
-    uint8_t addr_array[2] = { 0 };
-
-    if (config_data != NULL)
-    {
-        /* Store 0 to 3 bits of address in first byte */
-        addr_array[0] = (uint8_t)((index / 2) & 0x0F);
-
-        /* Store 4 to 11 bits of address in the second byte */
-        addr_array[1] = (uint8_t)((index / 2) >> 4);
-
-        /* Write the 2 bytes of address in consecutive locations */
-        rslt = bmi2_set_regs(BMI2_INIT_ADDR_0, addr_array, 2, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Burst write configuration file data corresponding to user set length */
-            rslt = bmi2_set_regs(BMI2_INIT_DATA_ADDR, (uint8_t *)config_data, write_len, dev);
-        }
-    }
-    else
-    {
-        rslt = BMI2_E_NULL_PTR;
-    }
-
-    return rslt;
+    dev->config_cursor.in_pos = 0;
+    dev->config_cursor.out_pos = 0;
+    dev->config_cursor.dict_pos = 0;
+    dev->config_cursor.run = 0;
+    dev->config_cursor.copy = BMI2_FALSE;
 }
 
 /*!
@@ -8082,48 +8865,146 @@ static int8_t unpack_skipped_frame(uint16_t *data_index, struct bmi2_fifo_frame
 }
 
 /*!
- * @brief This internal API enables and configures the accelerometer which is
- * needed for self-test operation. It also sets the amplitude for the self-test.
+ * @brief This internal API runs a step of the accelerometer self-test.
  */
-static int8_t pre_self_test_config(struct bmi2_dev *dev)
+static int8_t step_accel_self_test(uint32_t now_us, struct bmi2_test_sm *sm, struct bmi2_dev *dev)
 {
     /* Variable to define error */
-    int8_t rslt;
+    int8_t rslt = BMI2_OK;
 
-    /* Structure to define sensor configurations */
-    struct bmi2_sens_config sens_cfg;
+    /* Variable to store self-test result */
+    int8_t st_rslt;
 
     /* List the sensors to be selected */
     uint8_t sens_sel = BMI2_ACCEL;
 
-    /* Enable accelerometer */
-    rslt = bmi2_sensor_enable(&sens_sel, 1, dev);
-    dev->delay_us(1000, dev->intf_ptr);
+    /* Structure to define sensor configurations */
+    struct bmi2_sens_config sens_cfg;
 
-    /* Enable self-test amplitude */
-    if (rslt == BMI2_OK)
-    {
-        rslt = set_accel_self_test_amp(BMI2_ENABLE, dev);
-    }
+    /* Structure to define negative accelerometer axes */
+    struct bmi2_sens_axes_data negative = { 0, 0, 0, 0 };
 
-    if (rslt == BMI2_OK)
+    /* Structure for difference of accelerometer values in g */
+    struct bmi2_selftest_delta_limit accel_data_diff = { 0, 0, 0 };
+
+    /* Structure for difference of accelerometer values in mg */
+    struct bmi2_selftest_delta_limit accel_data_diff_mg = { 0, 0, 0 };
+
+    switch (sm->state)
     {
-        /* Select accelerometer for sensor configurations */
-        sens_cfg.type = BMI2_ACCEL;
+        case BMI2_TEST_SM_ACC_START:
 
-        /* Get the default values */
-        rslt = bmi2_get_sensor_config(&sens_cfg, 1, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Set the configurations required for self-test */
-            sens_cfg.cfg.acc.odr = BMI2_ACC_ODR_1600HZ;
-            sens_cfg.cfg.acc.bwp = BMI2_ACC_NORMAL_AVG4;
-            sens_cfg.cfg.acc.filter_perf = BMI2_PERF_OPT_MODE;
-            sens_cfg.cfg.acc.range = BMI2_ACC_RANGE_16G;
+            /* Enable accelerometer */
+            rslt = bmi2_sensor_enable(&sens_sel, 1, dev);
+            if (rslt == BMI2_OK)
+            {
+                sm->state = BMI2_TEST_SM_ACC_SETUP;
+                rslt = wait_test_sm(BMI2_ACC_SELF_TEST_ENABLE_US, now_us, sm);
+            }
 
-            /* Set accelerometer configurations */
-            rslt = bmi2_set_sensor_config(&sens_cfg, 1, dev);
-        }
+            break;
+
+        case BMI2_TEST_SM_ACC_SETUP:
+
+            /* Enable self-test amplitude */
+            rslt = set_accel_self_test_amp(BMI2_ENABLE, dev);
+            if (rslt == BMI2_OK)
+            {
+                /* Select accelerometer for sensor configurations */
+                sens_cfg.type = BMI2_ACCEL;
+
+                /* Get the default values */
+                rslt = bmi2_get_sensor_config(&sens_cfg, 1, dev);
+            }
+
+            if (rslt == BMI2_OK)
+            {
+                /* Set the configurations required for self-test */
+                sens_cfg.cfg.acc.odr = BMI2_ACC_ODR_1600HZ;
+                sens_cfg.cfg.acc.bwp = BMI2_ACC_NORMAL_AVG4;
+                sens_cfg.cfg.acc.filter_perf = BMI2_PERF_OPT_MODE;
+                sens_cfg.cfg.acc.range = BMI2_ACC_RANGE_16G;
+
+                /* Set accelerometer configurations */
+                rslt = bmi2_set_sensor_config(&sens_cfg, 1, dev);
+            }
+
+            /* Wait for greater than 2 milliseconds */
+            if (rslt == BMI2_OK)
+            {
+                sm->state = BMI2_TEST_SM_ACC_SIGN;
+                rslt = wait_test_sm(BMI2_ACC_SELF_TEST_CONFIG_US, now_us, sm);
+            }
+
+            break;
+
+        case BMI2_TEST_SM_ACC_SIGN:
+
+            /* Select positive first, then negative polarity after enabling
+             * self-test
+             */
+            rslt = self_test_config(sm->sign, dev);
+
+            /* Wait for greater than 50 milli-sec */
+            if (rslt == BMI2_OK)
+            {
+                sm->state = BMI2_TEST_SM_ACC_READ;
+                rslt = wait_test_sm(BMI2_ACC_SELF_TEST_SETTLE_US, now_us, sm);
+            }
+
+            break;
+
+        case BMI2_TEST_SM_ACC_READ:
+            if (sm->sign == BMI2_ENABLE)
+            {
+                /* Read and store positive acceleration value */
+                rslt = read_accel_xyz(&sm->positive, dev);
+
+                /* Turn the polarity of self-test negative */
+                if (rslt == BMI2_OK)
+                {
+                    sm->sign = BMI2_DISABLE;
+                    sm->state = BMI2_TEST_SM_ACC_SIGN;
+                    rslt = wait_test_sm(0, now_us, sm);
+                }
+            }
+            else
+            {
+                /* Read negative acceleration value */
+                rslt = read_accel_xyz(&negative, dev);
+                if (rslt == BMI2_OK)
+                {
+                    /* Subtract -ve acceleration values from that of +ve values */
+                    accel_data_diff.x = (sm->positive.x) - (negative.x);
+                    accel_data_diff.y = (sm->positive.y) - (negative.y);
+                    accel_data_diff.z = (sm->positive.z) - (negative.z);
+
+                    /* Convert differences of acceleration values
+                     * from 'g' to 'mg'
+                     */
+                    convert_lsb_g(&accel_data_diff, &accel_data_diff_mg, dev);
+
+                    /* Validate self-test for acceleration values
+                     * in mg and get the self-test result
+                     */
+                    st_rslt = validate_self_test(&accel_data_diff_mg);
+
+                    /* Trigger a soft reset after performing self-test */
+                    rslt = bmi2_soft_reset(dev);
+
+                    /* Return the self-test result */
+                    if (rslt == BMI2_OK)
+                    {
+                        rslt = st_rslt;
+                    }
+                }
+            }
+
+            break;
+
+        default:
+            rslt = BMI2_E_INVALID_STATUS;
+            break;
     }
 
     return rslt;
@@ -8673,7 +9554,7 @@ static int8_t save_accel_foc_config(struct bmi2_accel_config *acc_cfg,
 /*!
  * @brief This internal sets configurations for performing accelerometer FOC.
  */
-static int8_t set_accel_foc_config(struct bmi2_dev *dev)
+static int8_t set_accel_foc_config(uint8_t acc_conf, struct bmi2_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
@@ -8681,15 +9562,12 @@ static int8_t set_accel_foc_config(struct bmi2_dev *dev)
     /* Variable to select the sensor */
     uint8_t sens_list = BMI2_ACCEL;
 
-    /* Variable to set the accelerometer configuration value */
-    uint8_t acc_conf_data = BMI2_FOC_ACC_CONF_VAL;
-
     /* Disabling offset compensation */
     rslt = set_accel_offset_comp(BMI2_DISABLE, dev);
     if (rslt == BMI2_OK)
     {
-        /* Set accelerometer configurations to 50Hz, continuous mode, CIC mode */
-        rslt = bmi2_set_regs(BMI2_ACC_CONF_ADDR, &acc_conf_data, 1, dev);
+        /* Set accelerometer configurations, e.g. 50Hz, continuous mode, CIC mode */
+        rslt = bmi2_set_regs(BMI2_ACC_CONF_ADDR, &acc_conf, 1, dev);
         if (rslt == BMI2_OK)
         {
             /* Set accelerometer to normal mode by enabling it */
@@ -8728,21 +9606,6 @@ static int8_t perform_accel_foc(const struct bmi2_accel_foc_g_value *accel_g_val
     /* Structure to store accelerometer data temporarily */
     struct bmi2_foc_temp_value temp = { 0, 0, 0 };
 
-    /* Structure to store the average of accelerometer data */
-    struct bmi2_sens_axes_data accel_avg = { 0, 0, 0, 0 };
-
-    /* Variable to define LSB per g value */
-    uint16_t lsb_per_g = 0;
-
-    /* Variable to define range */
-    uint8_t range = 0;
-
-    /* Structure to store accelerometer data deviation from ideal value */
-    struct bmi2_offset_delta delta = { 0, 0, 0 };
-
-    /* Structure to store accelerometer offset values */
-    struct bmi2_accel_offset offset = { 0, 0, 0 };
-
     /* Variable tries max 5 times for interrupt then generates timeout */
     uint8_t try_cnt;
 
@@ -8782,34 +9645,215 @@ static int8_t perform_accel_foc(const struct bmi2_accel_foc_g_value *accel_g_val
 
     if (rslt == BMI2_OK)
     {
-        /* Take average of x, y and z data for lesser noise */
-        accel_avg.x = (int16_t)(temp.x / 128);
-        accel_avg.y = (int16_t)(temp.y / 128);
-        accel_avg.z = (int16_t)(temp.z / 128);
+        rslt = write_accel_foc_offset(accel_g_value, acc_cfg, &temp, dev);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API computes the accelerometer offsets from the sum of
+ * the FOC samples, writes and enables them.
+ */
+static int8_t write_accel_foc_offset(const struct bmi2_accel_foc_g_value *accel_g_value,
+                                     const struct bmi2_accel_config *acc_cfg,
+                                     const struct bmi2_foc_temp_value *temp,
+                                     struct bmi2_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Structure to store the average of accelerometer data */
+    struct bmi2_sens_axes_data accel_avg = { 0, 0, 0, 0 };
+
+    /* Variable to define LSB per g value */
+    uint16_t lsb_per_g = 0;
+
+    /* Variable to define range */
+    uint8_t range = 0;
+
+    /* Structure to store accelerometer data deviation from ideal value */
+    struct bmi2_offset_delta delta = { 0, 0, 0 };
+
+    /* Structure to store accelerometer offset values */
+    struct bmi2_accel_offset offset = { 0, 0, 0 };
+
+    /* Take average of x, y and z data for lesser noise */
+    accel_avg.x = (int16_t)(temp->x / BMI2_FOC_SAMPLE_LIMIT);
+    accel_avg.y = (int16_t)(temp->y / BMI2_FOC_SAMPLE_LIMIT);
+    accel_avg.z = (int16_t)(temp->z / BMI2_FOC_SAMPLE_LIMIT);
+
+    /* Get the exact range value */
+    map_accel_range(acc_cfg->range, &range);
+
+    /* Get the smallest possible measurable acceleration level given the range and
+     * resolution */
+    lsb_per_g = (uint16_t)(power(2, dev->resolution) / (2 * range));
+
+    /* Compensate acceleration data against gravity */
+    comp_for_gravity(lsb_per_g, accel_g_value, &accel_avg, &delta);
+
+    /* Scale according to offset register resolution */
+    scale_accel_offset(range, &delta, &offset);
+
+    /* Invert the accelerometer offset data */
+    invert_accel_offset(&offset);
+
+    /* Write offset data in the offset compensation register */
+    rslt = write_accel_offset(&offset, dev);
+
+    /* Enable offset compensation */
+    if (rslt == BMI2_OK)
+    {
+        rslt = set_accel_offset_comp(BMI2_ENABLE, dev);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API collects the FOC samples of a sensor in the FIFO,
+ * reads them in one burst and sums them.
+ */
+static int8_t read_foc_fifo_samples(uint16_t fifo_en,
+                                    uint8_t conf_val,
+                                    struct bmi2_foc_temp_value *temp,
+                                    struct bmi2_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Variable to define the result of restoring the FIFO */
+    int8_t rslt_restore;
+
+    /* Arrays to store the FIFO registers of the user and for FOC */
+    uint8_t fifo_regs[BMI2_FOC_FIFO_REG_LEN] = { 0 };
+    uint8_t foc_regs[BMI2_FOC_FIFO_REG_LEN] = { 0 };
+
+    /* Array to store the samples, with room for the dummy byte */
+    uint8_t fifo_data[(BMI2_FOC_SAMPLE_LIMIT * BMI2_FIFO_ACC_LENGTH) + 1] = { 0 };
+
+    /* Number of bytes of the samples still missing, gyroscope frames are
+     * as long as accelerometer frames
+     */
+    uint16_t sample_bytes = (uint16_t)(BMI2_FOC_SAMPLE_LIMIT * BMI2_FIFO_ACC_LENGTH);
+
+    /* Number of samples summed */
+    uint16_t n_samples = 0;
+
+    /* Output data period in microseconds */
+    uint32_t period_us;
+
+    /* Variable to store the FIFO fill level */
+    uint16_t fifo_length = 0;
+
+    /* Variable tries max 8 times for the samples then generates timeout */
+    uint8_t try_cnt = 8;
+
+    /* Variable to index the bytes */
+    uint16_t index;
+
+    /* Initialize FIFO frame structure */
+    struct bmi2_fifo_frame fifo = { 0 };
+
+    /* Output data period from the ODR field, 100Hz at ODR 8 */
+    if ((conf_val & BMI2_ACC_ODR_MASK) <= BMI2_ACC_ODR_100HZ)
+    {
+        period_us = UINT32_C(10000) << (BMI2_ACC_ODR_100HZ - (conf_val & BMI2_ACC_ODR_MASK));
+    }
+    else
+    {
+        period_us = UINT32_C(10000) >> ((conf_val & BMI2_ACC_ODR_MASK) - BMI2_ACC_ODR_100HZ);
+    }
 
-        /* Get the exact range value */
-        map_accel_range(acc_cfg->range, &range);
+    /* Save the FIFO configuration of the user */
+    rslt = bmi2_get_regs(BMI2_FIFO_DOWNS_ADDR, fifo_regs, BMI2_FOC_FIFO_REG_LEN, dev);
+    if (rslt == BMI2_OK)
+    {
+        /* Filtered data without down-sampling, watermark kept,
+         * header-less frames of the sensor only, no sensor time
+         */
+        foc_regs[0] = BMI2_ACC_FIFO_FILT_DATA_MASK | BMI2_GYR_FIFO_FILT_DATA_MASK;
+        foc_regs[1] = fifo_regs[1];
+        foc_regs[2] = fifo_regs[2];
+        foc_regs[3] = (uint8_t)BMI2_FIFO_STOP_ON_FULL;
+        foc_regs[4] = (uint8_t)(fifo_en >> 8);
+        rslt = bmi2_set_regs(BMI2_FIFO_DOWNS_ADDR, foc_regs, BMI2_FOC_FIFO_REG_LEN, dev);
+
+        /* Drop samples taken before the FOC configuration */
+        if (rslt == BMI2_OK)
+        {
+            rslt = bmi2_set_command_register(BMI2_FIFO_FLUSH_CMD, dev);
+        }
 
-        /* Get the smallest possible measurable acceleration level given the range and
-         * resolution */
-        lsb_per_g = (uint16_t)(power(2, dev->resolution) / (2 * range));
+        /* Wait for the samples */
+        if (rslt == BMI2_OK)
+        {
+            dev->delay_us(BMI2_FOC_SAMPLE_LIMIT * period_us, dev->intf_ptr);
+        }
 
-        /* Compensate acceleration data against gravity */
-        comp_for_gravity(lsb_per_g, accel_g_value, &accel_avg, &delta);
+        /* Read the samples in one burst, then once more for as many as were
+         * dummy frames
+         */
+        while ((rslt == BMI2_OK) && (n_samples < BMI2_FOC_SAMPLE_LIMIT) && (try_cnt > 0))
+        {
+            sample_bytes = (uint16_t)((BMI2_FOC_SAMPLE_LIMIT - n_samples) * BMI2_FIFO_ACC_LENGTH);
+            try_cnt--;
+            rslt = bmi2_get_fifo_length(&fifo_length, dev);
+            if ((rslt == BMI2_OK) && (fifo_length < sample_bytes))
+            {
+                dev->delay_us(period_us * 2, dev->intf_ptr);
+            }
+            else if (rslt == BMI2_OK)
+            {
+                fifo.data = fifo_data;
+                fifo.length = (uint16_t)(sample_bytes + dev->dummy_byte);
+                rslt = bmi2_read_fifo_data(&fifo, dev);
+                for (index = dev->dummy_byte; (rslt == BMI2_OK) && (index < fifo.length);
+                     index += BMI2_FIFO_ACC_LENGTH)
+                {
+                    /* Skip dummy frames, 0x7F01/0x7F02 0x8000, and frames read
+                     * past the end of the data, 0x8000
+                     */
+                    if (((fifo_data[index] >= BMI2_FIFO_HEADERLESS_DUMMY_ACC) &&
+                         (fifo_data[index] <= BMI2_FIFO_HEADERLESS_DUMMY_AUX) &&
+                         (fifo_data[index + 1] == BMI2_FIFO_HEADERLESS_DUMMY_BYTE_1) &&
+                         (fifo_data[index + 2] == BMI2_FIFO_HEADERLESS_DUMMY_BYTE_2) &&
+                         (fifo_data[index + 3] == BMI2_FIFO_HEADERLESS_DUMMY_BYTE_3)) ||
+                        ((fifo_data[index] == BMI2_FIFO_LSB_CONFIG_CHECK) &&
+                         (fifo_data[index + 1] == BMI2_FIFO_MSB_CONFIG_CHECK) &&
+                         (fifo_data[index + 2] == BMI2_FIFO_LSB_CONFIG_CHECK) &&
+                         (fifo_data[index + 3] == BMI2_FIFO_MSB_CONFIG_CHECK) &&
+                         (fifo_data[index + 4] == BMI2_FIFO_LSB_CONFIG_CHECK) &&
+                         (fifo_data[index + 5] == BMI2_FIFO_MSB_CONFIG_CHECK)))
+                    {
+                        continue;
+                    }
 
-        /* Scale according to offset register resolution */
-        scale_accel_offset(range, &delta, &offset);
+                    /* The sum of BMI2_FOC_SAMPLE_LIMIT 16 bit samples fits in 32 bit */
+                    temp->x += (int16_t)(((uint16_t)fifo_data[index + 1] << 8) | fifo_data[index]);
+                    temp->y += (int16_t)(((uint16_t)fifo_data[index + 3] << 8) | fifo_data[index + 2]);
+                    temp->z += (int16_t)(((uint16_t)fifo_data[index + 5] << 8) | fifo_data[index + 4]);
+                    n_samples++;
+                }
+            }
+        }
 
-        /* Invert the accelerometer offset data */
-        invert_accel_offset(&offset);
+        if ((rslt == BMI2_OK) && (n_samples < BMI2_FOC_SAMPLE_LIMIT))
+        {
+            rslt = BMI2_E_INVALID_STATUS;
+        }
 
-        /* Write offset data in the offset compensation register */
-        rslt = write_accel_offset(&offset, dev);
+        /* Restore the FIFO configuration of the user, without the FOC samples */
+        rslt_restore = bmi2_set_regs(BMI2_FIFO_DOWNS_ADDR, fifo_regs, BMI2_FOC_FIFO_REG_LEN, dev);
+        if (rslt_restore == BMI2_OK)
+        {
+            rslt_restore = bmi2_set_command_register(BMI2_FIFO_FLUSH_CMD, dev);
+        }
 
-        /* Enable offset compensation */
         if (rslt == BMI2_OK)
         {
-            rslt = set_accel_offset_comp(BMI2_ENABLE, dev);
+            rslt = rslt_restore;
         }
     }
 
@@ -9178,7 +10222,7 @@ static int8_t save_gyro_config(struct bmi2_gyro_config *gyr_cfg, uint8_t *aps, u
 /*!
  * @brief This internal sets configurations for performing gyroscope FOC.
  */
-static int8_t set_gyro_foc_config(struct bmi2_dev *dev)
+static int8_t set_gyro_foc_config(uint8_t gyr_conf, struct bmi2_dev *dev)
 {
     int8_t rslt;
 
@@ -9188,13 +10232,15 @@ static int8_t set_gyro_foc_config(struct bmi2_dev *dev)
     /* Array to set the gyroscope configuration value (ODR, Performance mode
      * and bandwidth) and gyroscope range
      */
-    uint8_t gyr_conf_data[2] = { BMI2_FOC_GYR_CONF_VAL, BMI2_GYR_RANGE_2000 };
+    uint8_t gyr_conf_data[2] = { 0, BMI2_GYR_RANGE_2000 };
+
+    gyr_conf_data[0] = gyr_conf;
 
     /* Disabling gyroscope offset compensation */
     rslt = bmi2_set_gyro_offset_comp(BMI2_DISABLE, dev);
     if (rslt == BMI2_OK)
     {
-        /* Set gyroscope configurations to 25Hz, continuous mode,
+        /* Set gyroscope configurations, e.g. 25Hz, continuous mode,
          * CIC mode, and 2000 dps range
          */
         rslt = bmi2_set_regs(BMI2_GYR_CONF_ADDR, gyr_conf_data, 2, dev);
@@ -9214,6 +10260,49 @@ static int8_t set_gyro_foc_config(struct bmi2_dev *dev)
     return rslt;
 }
 
+/*!
+ * @brief This internal API computes the gyroscope offsets from the sum of the
+ * FOC samples, writes and enables them.
+ */
+static int8_t write_gyro_foc_offset(const struct bmi2_foc_temp_value *temp, struct bmi2_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Structure to store the offset values to be stored in the register */
+    struct bmi2_sens_axes_data gyro_offset = { 0, 0, 0, 0 };
+
+    /* Take average of x, y and z data for lesser
+     * noise. It is same as offset data since lsb/dps
+     * is same for both data and offset register
+     */
+    gyro_offset.x = (int16_t)(temp->x / BMI2_FOC_SAMPLE_LIMIT);
+    gyro_offset.y = (int16_t)(temp->y / BMI2_FOC_SAMPLE_LIMIT);
+    gyro_offset.z = (int16_t)(temp->z / BMI2_FOC_SAMPLE_LIMIT);
+
+    /* Saturate gyroscope data since the offset
+     * registers are of 10 bit value where as the
+     * gyroscope data is of 16 bit value
+     */
+    saturate_gyro_data(&gyro_offset);
+
+    /* Invert the gyroscope offset  data */
+    invert_gyro_offset(&gyro_offset);
+
+    /* Write offset data in the gyroscope offset
+     * compensation register
+     */
+    rslt = bmi2_write_gyro_offset_comp_axes(&gyro_offset, dev);
+
+    /* Enable gyroscope offset compensation */
+    if (rslt == BMI2_OK)
+    {
+        rslt = bmi2_set_gyro_offset_comp(BMI2_ENABLE, dev);
+    }
+
+    return rslt;
+}
+
 /*!
  * @brief This internal API inverts the gyroscope offset data.
  */
@@ -9385,137 +10474,248 @@ static int8_t get_rdy_for_dl(uint8_t *rdy_for_dl, struct bmi2_dev *dev)
 }
 
 /*!
- * @brief This API does the crt process if max burst length is not zero.
+ * @brief This API is to wait till crt status complete.
  */
-static int8_t process_crt_download(uint8_t last_byte_flag, struct bmi2_dev *dev)
+static int8_t wait_st_running(uint8_t retry_complete, struct bmi2_dev *dev)
 {
-    int8_t rslt;
-    uint8_t rdy_for_dl = 0;
-    uint8_t cmd = BMI2_G_TRIGGER_CMD;
+    uint8_t st_status = 1;
+    int8_t rslt = BMI2_OK;
 
-    rslt = null_ptr_check(dev);
-    if (rslt == BMI2_OK)
+    while (retry_complete--)
     {
-        rslt = get_rdy_for_dl(&rdy_for_dl, dev);
-    }
+        rslt = get_st_running(&st_status, dev);
+        if ((rslt == BMI2_OK) && (st_status == 0))
+        {
+            break;
+        }
 
-    /* Trigger next CRT command */
-    if (rslt == BMI2_OK)
-    {
-        rslt = bmi2_set_regs(BMI2_CMD_REG_ADDR, &cmd, 1, dev);
+        dev->delay_us(BMI2_CRT_WAIT_RUNNING_US, dev->intf_ptr);
     }
 
-    if ((!last_byte_flag) && (rslt == BMI2_OK))
+    if ((rslt == BMI2_OK) && (st_status == 1))
     {
-        rslt = wait_rdy_for_dl_toggle(BMI2_CRT_READY_FOR_DOWNLOAD_RETRY, rdy_for_dl, dev);
+        rslt = BMI2_E_ST_ALREADY_RUNNING;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API to write the 2kb size of crt configuration
+ * @brief This api is used to perform gyroscope self-test.
  */
-static int8_t write_crt_config_file(uint16_t write_len,
-                                    uint16_t config_file_size,
-                                    uint16_t start_index,
-                                    struct bmi2_dev *dev)
+int8_t bmi2_do_gyro_st(struct bmi2_dev *dev)
 {
-    int8_t rslt = BMI2_OK;
-    uint16_t index = 0;
-    uint8_t last_byte_flag = 0;
-    uint8_t remain = (uint8_t)(config_file_size % write_len);
-    uint16_t balance_byte = 0;
+    int8_t rslt;
 
-    if (!remain)
-    {
+    rslt = run_test_sm(BMI2_TEST_SM_GYRO_SELF_TEST, dev);
 
-        /* Write the configuration file */
-        for (index = start_index;
-             (index < (start_index + config_file_size)) && (rslt == BMI2_OK);
-             index += write_len)
-        {
-            rslt = upload_file((dev->config_file_ptr + index), index, write_len, dev);
-            if (index >= ((start_index + config_file_size) - (write_len)))
-            {
-                last_byte_flag = 1;
-            }
+    return rslt;
+}
 
-            if (rslt == BMI2_OK)
-            {
-                rslt = process_crt_download(last_byte_flag, dev);
-            }
+/*!
+ * @brief This API is to run the CRT process for both max burst length 0 and non zero condition.
+ */
+int8_t bmi2_do_crt(struct bmi2_dev *dev)
+{
+    int8_t rslt;
+
+    rslt = run_test_sm(BMI2_TEST_SM_CRT, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API starts a gyro self-test, CRT, accel self-test or NVM
+ * programming procedure, which is then run by bmi2_test_sm_step.
+ */
+int8_t bmi2_test_sm_start(uint8_t op, uint32_t now_us, struct bmi2_test_sm *sm, struct bmi2_dev *dev)
+{
+    int8_t rslt;
+
+    rslt = null_ptr_check(dev);
+    if ((rslt == BMI2_OK) && (sm != NULL))
+    {
+        sm->op = op;
+        sm->aps_stat = BMI2_DISABLE;
+        sm->retry = 0;
+        sm->max_burst_len = 0;
+        sm->rdy_for_dl = 0;
+        sm->last_byte_flag = 0;
+        sm->sign = BMI2_ENABLE;
+        sm->dl_index = 0;
+        sm->dl_len = 0;
+        sm->dl_balance = 0;
+        sm->next_us = now_us;
+        sm->rslt = BMI2_W_STEP_PENDING;
+
+        switch (op)
+        {
+            case BMI2_TEST_SM_GYRO_SELF_TEST:
+            case BMI2_TEST_SM_CRT:
+                sm->state = BMI2_TEST_SM_GT_START;
+                break;
+
+            case BMI2_TEST_SM_ACCEL_SELF_TEST:
+                sm->state = BMI2_TEST_SM_ACC_START;
+                break;
+
+            case BMI2_TEST_SM_NVM_PROG:
+                sm->state = BMI2_TEST_SM_NVM_START;
+                break;
+
+            default:
+                sm->state = BMI2_TEST_SM_DONE;
+                sm->rslt = BMI2_E_INVALID_INPUT;
+                rslt = BMI2_E_INVALID_INPUT;
+                break;
         }
     }
     else
     {
-        /* Get the balance bytes */
-        balance_byte = (uint16_t)start_index + (uint16_t)config_file_size - (uint16_t)remain;
+        rslt = BMI2_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API runs the next step of the procedure started by
+ * bmi2_test_sm_start.
+ */
+int8_t bmi2_test_sm_step(uint32_t now_us, struct bmi2_test_sm *sm, struct bmi2_dev *dev)
+{
+    int8_t rslt;
 
-        /* Write the configuration file for the balance bytes */
-        for (index = start_index; (index < balance_byte) && (rslt == BMI2_OK); index += write_len)
+    rslt = null_ptr_check(dev);
+    if ((rslt == BMI2_OK) && (sm != NULL))
+    {
+        if (sm->state == BMI2_TEST_SM_DONE)
         {
-            rslt = upload_file((dev->config_file_ptr + index), index, write_len, dev);
-            if (rslt == BMI2_OK)
-            {
-                rslt = process_crt_download(last_byte_flag, dev);
-            }
+            rslt = sm->rslt;
         }
-
-        if (rslt == BMI2_OK)
+        /* Not due yet, also across a wrap around of the time base */
+        else if ((int32_t)(now_us - sm->next_us) < 0)
+        {
+            rslt = BMI2_W_STEP_PENDING;
+        }
+        else
         {
-            /* Write the remaining bytes in 2 bytes length */
-            write_len = 2;
-            rslt = set_maxburst_len(write_len, dev);
+            if (sm->op == BMI2_TEST_SM_ACCEL_SELF_TEST)
+            {
+                rslt = step_accel_self_test(now_us, sm, dev);
+            }
+            else if (sm->op == BMI2_TEST_SM_NVM_PROG)
+            {
+                rslt = step_nvm_prog(now_us, sm, dev);
+            }
+            else
+            {
+                rslt = step_gtrigger(now_us, sm, dev);
+            }
 
-            /* Write the configuration file for the remaining bytes */
-            for (index = balance_byte;
-                 (index < (start_index + config_file_size)) && (rslt == BMI2_OK);
-                 index += write_len)
+            if (rslt != BMI2_W_STEP_PENDING)
             {
-                rslt = upload_file((dev->config_file_ptr + index), index, write_len, dev);
-                if (index < ((start_index + config_file_size) - write_len))
+                /* Enable Advance power save if disabled while running and
+                 * not when already disabled
+                 */
+                if ((sm->aps_stat == BMI2_ENABLE) && (rslt == BMI2_OK))
                 {
-                    last_byte_flag = 1;
+                    rslt = bmi2_set_adv_power_save(BMI2_ENABLE, dev);
                 }
 
-                if (rslt == BMI2_OK)
-                {
-                    rslt = process_crt_download(last_byte_flag, dev);
-                }
+                sm->state = BMI2_TEST_SM_DONE;
+                sm->rslt = rslt;
             }
         }
     }
+    else
+    {
+        rslt = BMI2_E_NULL_PTR;
+    }
 
     return rslt;
 }
 
 /*!
- * @brief This API is to wait till the rdy for dl bit toggles after every pack of bytes.
+ * @brief This internal API runs a procedure of the state machine to the end,
+ * waiting with dev->delay_us between the steps.
  */
-static int8_t wait_rdy_for_dl_toggle(uint8_t retry_complete, uint8_t download_ready, struct bmi2_dev *dev)
+static int8_t run_test_sm(uint8_t op, struct bmi2_dev *dev)
 {
-    int8_t rslt = BMI2_OK;
-    uint8_t dl_ready = 0;
-    uint8_t st_status = 0;
+    int8_t rslt;
+
+    /* Context of the procedure */
+    struct bmi2_test_sm sm;
+
+    /* Time base of the procedure, advanced by the waits */
+    uint32_t now_us = 0;
 
-    while ((rslt == BMI2_OK) && (retry_complete--))
+    rslt = bmi2_test_sm_start(op, now_us, &sm, dev);
+    while ((rslt == BMI2_OK) || (rslt == BMI2_W_STEP_PENDING))
     {
-        rslt = get_rdy_for_dl(&dl_ready, dev);
-        if (download_ready != dl_ready)
+        rslt = bmi2_test_sm_step(now_us, &sm, dev);
+        if (rslt != BMI2_W_STEP_PENDING)
         {
             break;
         }
 
-        dev->delay_us(BMI2_CRT_READY_FOR_DOWNLOAD_US, dev->intf_ptr);
+        if (sm.next_us != now_us)
+        {
+            dev->delay_us(sm.next_us - now_us, dev->intf_ptr);
+            now_us = sm.next_us;
+        }
     }
 
-    if ((rslt == BMI2_OK) && (download_ready == dl_ready))
+    return rslt;
+}
+
+/*!
+ * @brief This internal API sets the time of the next step of the procedure.
+ */
+static int8_t wait_test_sm(uint32_t period_us, uint32_t now_us, struct bmi2_test_sm *sm)
+{
+    sm->next_us = now_us + period_us;
+
+    return BMI2_W_STEP_PENDING;
+}
+
+/*!
+ * @brief This internal API schedules the next poll of a status bit, or fails
+ * once the polls of the current wait are used up.
+ */
+static int8_t retry_test_sm(uint32_t period_us, int8_t timeout_rslt, uint32_t now_us, struct bmi2_test_sm *sm)
+{
+    int8_t rslt;
+
+    if (sm->retry > 1)
     {
-        rslt = BMI2_E_CRT_READY_FOR_DL_FAIL_ABORT;
+        sm->retry--;
+        rslt = wait_test_sm(period_us, now_us, sm);
+    }
+    else
+    {
+        rslt = timeout_rslt;
     }
 
-    if (rslt == BMI2_OK)
+    return rslt;
+}
+
+/*!
+ * @brief This internal API polls the rdy_for_dl bit once for the toggle
+ * which acknowledges the last G_TRIGGER command.
+ */
+static int8_t poll_rdy_for_dl_toggle(uint32_t now_us, struct bmi2_test_sm *sm, struct bmi2_dev *dev)
+{
+    int8_t rslt;
+    uint8_t dl_ready = 0;
+    uint8_t st_status = 0;
+
+    rslt = get_rdy_for_dl(&dl_ready, dev);
+    if ((rslt == BMI2_OK) && (dl_ready == sm->rdy_for_dl))
+    {
+        rslt = retry_test_sm(BMI2_CRT_READY_FOR_DOWNLOAD_US, BMI2_E_CRT_READY_FOR_DL_FAIL_ABORT, now_us, sm);
+    }
+    else if (rslt == BMI2_OK)
     {
         rslt = get_st_running(&st_status, dev);
         if ((rslt == BMI2_OK) && (st_status == 0))
@@ -9528,166 +10728,290 @@ static int8_t wait_rdy_for_dl_toggle(uint8_t retry_complete, uint8_t download_re
 }
 
 /*!
- * @brief This API is to wait till crt status complete.
+ * @brief This internal API writes the next burst of the CRT configuration
+ * and triggers its download.
  */
-static int8_t wait_st_running(uint8_t retry_complete, struct bmi2_dev *dev)
+static int8_t write_crt_chunk(struct bmi2_test_sm *sm, struct bmi2_dev *dev)
 {
-    uint8_t st_status = 1;
     int8_t rslt = BMI2_OK;
+    uint8_t cmd = BMI2_G_TRIGGER_CMD;
+    uint16_t end = BMI2_CRT_CONFIG_FILE_START + BMI2_CRT_CONFIG_FILE_SIZE;
 
-    while (retry_complete--)
+    if ((sm->dl_index >= sm->dl_balance) && (sm->dl_len != 2))
     {
-        rslt = get_st_running(&st_status, dev);
-        if ((rslt == BMI2_OK) && (st_status == 0))
+        /* Write the remaining bytes in 2 bytes length */
+        sm->dl_len = 2;
+        rslt = set_maxburst_len(sm->dl_len, dev);
+    }
+
+    if (rslt == BMI2_OK)
+    {
+        rslt = upload_config_chunk(sm->dl_index, sm->dl_len, dev);
+    }
+
+    if (sm->dl_balance == end)
+    {
+        if (sm->dl_index >= (end - sm->dl_len))
         {
-            break;
+            sm->last_byte_flag = 1;
         }
+    }
+    else if ((sm->dl_index >= sm->dl_balance) && (sm->dl_index < (end - sm->dl_len)))
+    {
+        sm->last_byte_flag = 1;
+    }
 
-        dev->delay_us(BMI2_CRT_WAIT_RUNNING_US, dev->intf_ptr);
+    if (rslt == BMI2_OK)
+    {
+        rslt = get_rdy_for_dl(&sm->rdy_for_dl, dev);
     }
 
-    if ((rslt == BMI2_OK) && (st_status == 1))
+    /* Trigger next CRT command */
+    if (rslt == BMI2_OK)
     {
-        rslt = BMI2_E_ST_ALREADY_RUNNING;
+        rslt = bmi2_set_regs(BMI2_CMD_REG_ADDR, &cmd, 1, dev);
     }
 
     return rslt;
 }
 
 /*!
- * @brief This api is used to perform gyroscope self-test.
+ * @brief This internal API moves on to the next burst of the CRT
+ * configuration, or to the wait for the end of the CRT.
  */
-int8_t bmi2_do_gyro_st(struct bmi2_dev *dev)
+static int8_t next_crt_chunk(uint32_t now_us, struct bmi2_test_sm *sm)
 {
-    int8_t rslt;
-
-    rslt = do_gtrigger_test(BMI2_SELECT_GYRO_SELF_TEST, dev);
+    sm->dl_index += sm->dl_len;
+    if (sm->dl_index < (BMI2_CRT_CONFIG_FILE_START + BMI2_CRT_CONFIG_FILE_SIZE))
+    {
+        sm->state = BMI2_TEST_SM_GT_DL_CHUNK;
+    }
+    else
+    {
+        sm->retry = BMI2_CRT_WAIT_RUNNING_RETRY_EXECUTION;
+        sm->state = BMI2_TEST_SM_GT_RUNNING;
+    }
 
-    return rslt;
+    /* One burst per step */
+    return wait_test_sm(0, now_us, sm);
 }
 
 /*!
- * @brief This API is to run the CRT process for both max burst length 0 and non zero condition.
+ * @brief This internal API runs a step of the gyro self-test or CRT.
  */
-int8_t bmi2_do_crt(struct bmi2_dev *dev)
+static int8_t step_gtrigger(uint32_t now_us, struct bmi2_test_sm *sm, struct bmi2_dev *dev)
 {
-    int8_t rslt;
+    int8_t rslt = BMI2_OK;
+    int8_t rslt_crt;
+    uint8_t st_status = 0;
+    uint8_t sens_list = BMI2_GYRO;
+    uint8_t cmd = BMI2_G_TRIGGER_CMD;
+    struct bmi2_gyro_self_test_status gyro_st_result = { 0 };
+
+    switch (sm->state)
+    {
+        case BMI2_TEST_SM_GT_START:
+
+            /* Check if the variant supports this feature */
+            if (dev->variant_feature & BMI2_CRT_RTOSK_ENABLE)
+            {
+                /* Get status of advance power save mode */
+                sm->aps_stat = dev->aps_status;
+                if (sm->aps_stat == BMI2_ENABLE)
+                {
+                    /* Disable advance power save if enabled */
+                    rslt = bmi2_set_adv_power_save(BMI2_DISABLE, dev);
+                }
+
+                /* Get max burst length */
+                if (rslt == BMI2_OK)
+                {
+                    rslt = get_maxburst_len(&sm->max_burst_len, dev);
+                }
+
+                /* Checking for CRT running status */
+                if (rslt == BMI2_OK)
+                {
+                    rslt = get_st_running(&st_status, dev);
+                    if ((rslt == BMI2_OK) && (st_status != 0))
+                    {
+                        rslt = BMI2_E_ST_ALREADY_RUNNING;
+                    }
+                }
+
+                if (rslt == BMI2_OK)
+                {
+                    rslt = set_st_running(BMI2_ENABLE, dev);
+                }
+
+                /* Preparing the setup: disable gyroscope and FIFO, enable accelerometer */
+                if (rslt == BMI2_OK)
+                {
+                    rslt = bmi2_sensor_disable(&sens_list, 1, dev);
+                }
+
+                if (rslt == BMI2_OK)
+                {
+                    rslt = bmi2_set_fifo_config(BMI2_FIFO_ALL_EN, BMI2_DISABLE, dev);
+                }
+
+                if (rslt == BMI2_OK)
+                {
+                    sens_list = BMI2_ACCEL;
+                    rslt = bmi2_sensor_enable(&sens_list, 1, dev);
+                }
+
+                /* Disable Abort after 1 msec */
+                if (rslt == BMI2_OK)
+                {
+                    sm->state = BMI2_TEST_SM_GT_SETUP;
+                    rslt = wait_test_sm(1000, now_us, sm);
+                }
+            }
+            else
+            {
+                rslt = BMI2_E_INVALID_SENSOR;
+            }
+
+            break;
+
+        case BMI2_TEST_SM_GT_SETUP:
+            rslt = abort_bmi2(BMI2_DISABLE, dev);
+
+            /* Enable the gyro self-test, CRT */
+            if (rslt == BMI2_OK)
+            {
+                rslt = select_self_test((sm->op == BMI2_TEST_SM_CRT) ? BMI2_SELECT_CRT : BMI2_SELECT_GYRO_SELF_TEST,
+                                        dev);
+            }
+
+            /* Check if FIFO is unchanged by checking the max burst length */
+            if ((rslt == BMI2_OK) && (sm->max_burst_len == 0))
+            {
+                /* Trigger CRT */
+                rslt = bmi2_set_regs(BMI2_CMD_REG_ADDR, &cmd, 1, dev);
+                if (rslt == BMI2_OK)
+                {
+                    /* Wait until st_status = 0 or time out is 2 seconds */
+                    sm->retry = BMI2_CRT_WAIT_RUNNING_RETRY_EXECUTION;
+                    sm->state = BMI2_TEST_SM_GT_RUNNING;
+                    rslt = wait_test_sm(0, now_us, sm);
+                }
+            }
+            else if (rslt == BMI2_OK)
+            {
+                /* FIFO may be used */
+                if (dev->read_write_len < 2)
+                {
+                    dev->read_write_len = 2;
+                }
+
+                if (dev->read_write_len > (BMI2_CRT_MAX_BURST_WORD_LENGTH * 2))
+                {
+                    dev->read_write_len = BMI2_CRT_MAX_BURST_WORD_LENGTH * 2;
+                }
+
+                /* Keep each CRT download burst within one decoded chunk */
+                if ((dev->config_blob != NULL) && (dev->read_write_len > BMI2_CONFIG_CHUNK_SIZE))
+                {
+                    dev->read_write_len = BMI2_CONFIG_CHUNK_SIZE;
+                }
+
+                /* Reset the max burst length to default value */
+                rslt = set_maxburst_len(dev->read_write_len, dev);
 
-    rslt = do_gtrigger_test(BMI2_SELECT_CRT, dev);
+                if (rslt == BMI2_OK)
+                {
+                    rslt = get_rdy_for_dl(&sm->rdy_for_dl, dev);
+                }
 
-    return rslt;
-}
+                /* Trigger CRT  */
+                if (rslt == BMI2_OK)
+                {
+                    rslt = bmi2_set_regs(BMI2_CMD_REG_ADDR, &cmd, 1, dev);
+                }
 
-/*!
- * @brief This API is to run the crt process for both max burst length 0 and non zero condition.
- */
-static int8_t do_gtrigger_test(uint8_t gyro_st_crt, struct bmi2_dev *dev)
-{
-    int8_t rslt;
-    uint8_t st_status = 0;
-    uint8_t max_burst_length = 0;
-    struct bmi2_gyro_self_test_status gyro_st_result = { 0 };
+                /* Wait till either ready for download toggle or crt running = 0 */
+                if (rslt == BMI2_OK)
+                {
+                    sm->retry = BMI2_CRT_READY_FOR_DOWNLOAD_RETRY;
+                    sm->state = BMI2_TEST_SM_GT_DL_READY;
+                    rslt = wait_test_sm(0, now_us, sm);
+                }
+            }
 
-    /* Variable to get the status of advance power save */
-    uint8_t aps_stat = 0;
+            break;
 
-    rslt = null_ptr_check(dev);
-    if (rslt == BMI2_OK)
-    {
-        /* Check if the variant supports this feature */
-        if (dev->variant_feature & BMI2_CRT_RTOSK_ENABLE)
-        {
-            /* Get status of advance power save mode */
-            aps_stat = dev->aps_status;
-            if (aps_stat == BMI2_ENABLE)
+        case BMI2_TEST_SM_GT_DL_READY:
+            rslt = poll_rdy_for_dl_toggle(now_us, sm, dev);
+            if (rslt == BMI2_OK)
             {
-                /* Disable advance power save if enabled */
-                rslt = bmi2_set_adv_power_save(BMI2_DISABLE, dev);
+                /* Decode a compressed configuration file from its start */
+                reset_config_cursor(dev);
+
+                sm->dl_index = BMI2_CRT_CONFIG_FILE_START;
+                sm->dl_len = dev->read_write_len;
+                sm->dl_balance =
+                    (uint16_t)(BMI2_CRT_CONFIG_FILE_START + BMI2_CRT_CONFIG_FILE_SIZE -
+                               (BMI2_CRT_CONFIG_FILE_SIZE % sm->dl_len));
+                sm->last_byte_flag = 0;
+                sm->state = BMI2_TEST_SM_GT_DL_CHUNK;
+                rslt = wait_test_sm(0, now_us, sm);
             }
 
-            /* Get max burst length */
-            if (rslt == BMI2_OK)
+            break;
+
+        case BMI2_TEST_SM_GT_DL_CHUNK:
+            rslt = write_crt_chunk(sm, dev);
+            if ((rslt == BMI2_OK) && (!sm->last_byte_flag))
             {
-                rslt = get_maxburst_len(&max_burst_length, dev);
+                sm->retry = BMI2_CRT_READY_FOR_DOWNLOAD_RETRY;
+                sm->state = BMI2_TEST_SM_GT_DL_ACK;
+                rslt = wait_test_sm(0, now_us, sm);
             }
-
-            /* Checking for CRT running status */
-            if (rslt == BMI2_OK)
+            else if (rslt == BMI2_OK)
             {
-                rslt = get_st_running(&st_status, dev);
+                rslt = next_crt_chunk(now_us, sm);
             }
 
-            /* CRT is not running and Max burst length is zero */
-            if (st_status == 0)
+            break;
+
+        case BMI2_TEST_SM_GT_DL_ACK:
+            rslt = poll_rdy_for_dl_toggle(now_us, sm, dev);
+            if (rslt == BMI2_OK)
             {
-                rslt = gyro_crt_test(max_burst_length, gyro_st_crt, dev);
+                rslt = next_crt_chunk(now_us, sm);
             }
-            else
+
+            break;
+
+        case BMI2_TEST_SM_GT_RUNNING:
+            rslt = get_st_running(&st_status, dev);
+            if ((rslt == BMI2_OK) && (st_status != 0))
             {
-                rslt = BMI2_E_ST_ALREADY_RUNNING;
+                rslt = retry_test_sm(BMI2_CRT_WAIT_RUNNING_US, BMI2_E_ST_ALREADY_RUNNING, now_us, sm);
             }
 
-            if (rslt == BMI2_OK)
+            /* After a download the result is read also on time out, it sets the max burst length */
+            if ((rslt != BMI2_W_STEP_PENDING) && ((rslt == BMI2_OK) || (sm->dl_len != 0)))
             {
-                if (gyro_st_crt == BMI2_SELECT_GYRO_SELF_TEST)
+                rslt_crt = crt_gyro_st_update_result(dev);
+                if (rslt == BMI2_OK)
                 {
-                    rslt = gyro_self_test_completed(&gyro_st_result, dev);
+                    rslt = rslt_crt;
                 }
             }
 
-            /* Enable Advance power save if disabled while configuring and
-             * not when already disabled
-             */
-            if ((aps_stat == BMI2_ENABLE) && (rslt == BMI2_OK))
+            if ((rslt == BMI2_OK) && (sm->op == BMI2_TEST_SM_GYRO_SELF_TEST))
             {
-                rslt = bmi2_set_adv_power_save(BMI2_ENABLE, dev);
+                rslt = gyro_self_test_completed(&gyro_st_result, dev);
             }
-        }
-        else
-        {
-            rslt = BMI2_E_INVALID_SENSOR;
-        }
-    }
-
-    return rslt;
-}
-
-/*!
- * @brief This API to set up environment for processing the crt.
- */
-static int8_t crt_prepare_setup(struct bmi2_dev *dev)
-{
-    int8_t rslt;
-
-    /* Variable to select the sensor */
-    uint8_t sens_list = BMI2_GYRO;
-
-    rslt = null_ptr_check(dev);
-
-    if (rslt == BMI2_OK)
-    {
-        /* Disable gyroscope */
-        rslt = bmi2_sensor_disable(&sens_list, 1, dev);
-    }
-
-    /* Disable FIFO for all sensors */
-    if (rslt == BMI2_OK)
-    {
-        rslt = bmi2_set_fifo_config(BMI2_FIFO_ALL_EN, BMI2_DISABLE, dev);
-    }
 
-    if (rslt == BMI2_OK)
-    {
-        /* Enable accelerometer */
-        sens_list = BMI2_ACCEL;
-        rslt = bmi2_sensor_enable(&sens_list, 1, dev);
-    }
+            break;
 
-    if (rslt == BMI2_OK)
-    {
-        /* Disable Abort after 1 msec */
-        dev->delay_us(1000, dev->intf_ptr);
-        rslt = abort_bmi2(BMI2_DISABLE, dev);
+        default:
+            rslt = BMI2_E_INVALID_STATUS;
+            break;
     }
 
     return rslt;
@@ -10153,92 +11477,106 @@ static int8_t gyro_self_test_completed(struct bmi2_gyro_self_test_status *gyro_s
 /*! @brief This api is used for programming the non volatile memory(nvm) */
 int8_t bmi2_nvm_prog(struct bmi2_dev *dev)
 {
-    int8_t rslt = BMI2_OK;
+    int8_t rslt;
 
-    /* Variable to get the status of advance power save */
-    uint8_t aps_stat;
-    uint8_t status;
+    rslt = run_test_sm(BMI2_TEST_SM_NVM_PROG, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API runs a step of the NVM programming.
+ */
+static int8_t step_nvm_prog(uint32_t now_us, struct bmi2_test_sm *sm, struct bmi2_dev *dev)
+{
+    int8_t rslt = BMI2_OK;
+    uint8_t status = 0;
     uint8_t cmd_rdy;
     uint8_t reg_data;
-    uint8_t write_timeout = 100;
 
-    /* Get status of advance power save mode */
-    aps_stat = dev->aps_status;
-    if (aps_stat == BMI2_ENABLE)
+    switch (sm->state)
     {
-        /* Disable advance power save if enabled */
-        rslt = bmi2_set_adv_power_save(BMI2_DISABLE, dev);
-    }
+        case BMI2_TEST_SM_NVM_START:
 
-    /* Check the Write status and proceed only if there is no ongoing write cycle */
-    if (rslt == BMI2_OK)
-    {
-        rslt = bmi2_get_status(&status, dev);
+            /* Get status of advance power save mode */
+            sm->aps_stat = dev->aps_status;
+            if (sm->aps_stat == BMI2_ENABLE)
+            {
+                /* Disable advance power save if enabled */
+                rslt = bmi2_set_adv_power_save(BMI2_DISABLE, dev);
+            }
 
-        cmd_rdy = BMI2_GET_BITS(status, BMI2_CMD_RDY);
-        if (cmd_rdy)
-        {
-            rslt = set_nvm_prep_prog(BMI2_ENABLE, dev);
+            /* Check the Write status and proceed only if there is no ongoing write cycle */
             if (rslt == BMI2_OK)
             {
-                dev->delay_us(40000, dev->intf_ptr);
+                rslt = bmi2_get_status(&status, dev);
+            }
 
-                /* Set the NVM_CONF.nvm_prog_en bit in order to enable the NVM
-                 * programming */
-                reg_data = BMI2_NVM_UNLOCK_ENABLE;
-                rslt = bmi2_set_regs(BMI2_NVM_CONF_ADDR, &reg_data, 1, dev);
-                if (rslt == BMI2_OK)
+            if (rslt == BMI2_OK)
+            {
+                cmd_rdy = BMI2_GET_BITS(status, BMI2_CMD_RDY);
+                if (cmd_rdy)
                 {
-                    /* Send NVM prog command to command register */
-                    reg_data = BMI2_NVM_PROG_CMD;
-                    rslt = bmi2_set_regs(BMI2_CMD_REG_ADDR, &reg_data, 1, dev);
+                    rslt = set_nvm_prep_prog(BMI2_ENABLE, dev);
+                    if (rslt == BMI2_OK)
+                    {
+                        sm->state = BMI2_TEST_SM_NVM_PROG_CMD;
+                        rslt = wait_test_sm(BMI2_NVM_PREP_US, now_us, sm);
+                    }
                 }
-
-                /* Wait till write operation is completed */
-                if (rslt == BMI2_OK)
+                else
                 {
-                    while (write_timeout--)
-                    {
-                        rslt = bmi2_get_status(&status, dev);
-                        if (rslt == BMI2_OK)
-                        {
-                            cmd_rdy = BMI2_GET_BITS(status, BMI2_CMD_RDY);
+                    rslt = BMI2_E_WRITE_CYCLE_ONGOING;
+                }
+            }
 
-                            /* Nvm is complete once cmd_rdy is 1, break if 1 */
-                            if (cmd_rdy)
-                            {
-                                break;
-                            }
+            break;
 
-                            /* Wait till cmd_rdy becomes 1 indicating
-                             * nvm process completes */
-                            dev->delay_us(20000, dev->intf_ptr);
-                        }
-                    }
-                }
+        case BMI2_TEST_SM_NVM_PROG_CMD:
+
+            /* Set the NVM_CONF.nvm_prog_en bit in order to enable the NVM
+             * programming */
+            reg_data = BMI2_NVM_UNLOCK_ENABLE;
+            rslt = bmi2_set_regs(BMI2_NVM_CONF_ADDR, &reg_data, 1, dev);
+            if (rslt == BMI2_OK)
+            {
+                /* Send NVM prog command to command register */
+                reg_data = BMI2_NVM_PROG_CMD;
+                rslt = bmi2_set_regs(BMI2_CMD_REG_ADDR, &reg_data, 1, dev);
+            }
 
-                if ((rslt == BMI2_OK) && (cmd_rdy != BMI2_TRUE))
+            /* Wait till write operation is completed */
+            if (rslt == BMI2_OK)
+            {
+                sm->retry = BMI2_NVM_PROG_RETRY;
+                sm->state = BMI2_TEST_SM_NVM_WAIT;
+                rslt = wait_test_sm(0, now_us, sm);
+            }
+
+            break;
+
+        case BMI2_TEST_SM_NVM_WAIT:
+            rslt = bmi2_get_status(&status, dev);
+            if (rslt == BMI2_OK)
+            {
+                /* Nvm is complete once cmd_rdy is 1 */
+                cmd_rdy = BMI2_GET_BITS(status, BMI2_CMD_RDY);
+                if (cmd_rdy)
                 {
-                    rslt = BMI2_E_WRITE_CYCLE_ONGOING;
+                    /* perform soft reset */
+                    rslt = bmi2_soft_reset(dev);
+                }
+                else
+                {
+                    rslt = retry_test_sm(BMI2_NVM_PROG_POLL_US, BMI2_E_WRITE_CYCLE_ONGOING, now_us, sm);
                 }
             }
-        }
-        else
-        {
-            rslt = BMI2_E_WRITE_CYCLE_ONGOING;
-        }
-    }
 
-    if (rslt == BMI2_OK)
-    {
-        /* perform soft reset */
-        rslt = bmi2_soft_reset(dev);
-    }
+            break;
 
-    /* Enable Advance power save if disabled while configuring and not when already disabled */
-    if ((aps_stat == BMI2_ENABLE) && (rslt == BMI2_OK))
-    {
-        rslt = bmi2_set_adv_power_save(BMI2_ENABLE, dev);
+        default:
+            rslt = BMI2_E_INVALID_STATUS;
+            break;
     }
 
     return rslt;
@@ -10645,98 +11983,124 @@ static int8_t sensor_disable(uint64_t sensor_sel, struct bmi2_dev *dev)
 }
 
 /*!
- * @brief This internal API is used to test gyro CRT.
+ * @brief This internal API looks up the encoder of a feature and locates its
+ * input configuration in the feature pages.
  */
-static int8_t gyro_crt_test(uint8_t max_burst_length, uint8_t gyro_st_crt, struct bmi2_dev *dev)
+static int8_t locate_encoded_feat(const struct bmi2_feat_encoder **feat_enc,
+                                  struct bmi2_feature_config *cfg,
+                                  uint8_t type,
+                                  const struct bmi2_feat_encoder *enc,
+                                  uint8_t n_enc,
+                                  const struct bmi2_dev *dev)
 {
-    int8_t rslt;
-    int8_t rslt_crt = BMI2_OK;
-    uint8_t cmd = BMI2_G_TRIGGER_CMD;
-    uint8_t download_ready = 0;
-
-    rslt = set_st_running(BMI2_ENABLE, dev);
-
-    /* Preparing the setup */
-    if (rslt == BMI2_OK)
-    {
-        rslt = crt_prepare_setup(dev);
-    }
+    /* Variable to define error */
+    int8_t rslt = BMI2_OK;
 
-    /* Enable the gyro self-test, CRT */
-    if (rslt == BMI2_OK)
-    {
-        rslt = select_self_test(gyro_st_crt, dev);
-    }
+    /* Variable to define loop */
+    uint8_t loop;
 
-    /* Check if FIFO is unchanged by checking the max burst length */
-    if ((rslt == BMI2_OK) && (max_burst_length == 0))
+    *feat_enc = bmi2_find_feat_encoder(type, enc, n_enc);
+    if (*feat_enc != NULL)
     {
-        /* Trigger CRT */
-        rslt = bmi2_set_regs(BMI2_CMD_REG_ADDR, &cmd, 1, dev);
-        if (rslt == BMI2_OK)
+        if (!bmi2_extract_input_feat_config(cfg, (*feat_enc)->feat, dev) || (cfg->page > BMI2_PAGE_7))
         {
-            /* Wait until st_status = 0 or time out is 2 seconds */
-            rslt = wait_st_running(BMI2_CRT_WAIT_RUNNING_RETRY_EXECUTION, dev);
+            rslt = BMI2_E_INVALID_SENSOR;
+        }
 
-            /* CRT Running wait & check is successful */
-            if (rslt == BMI2_OK)
+        /* Every field has to reside in the page of the feature */
+        for (loop = 0; (loop < (*feat_enc)->n_fields) && (rslt == BMI2_OK); loop++)
+        {
+            if ((cfg->start_addr + ((*feat_enc)->fields[loop].word * 2) + 1) >= BMI2_FEAT_SIZE_IN_BYTES)
             {
-                rslt = crt_gyro_st_update_result(dev);
+                rslt = BMI2_E_INVALID_SENSOR;
             }
         }
     }
-    else
-    {
-        /* FIFO may be used */
-        if (rslt == BMI2_OK)
-        {
-            if (dev->read_write_len < 2)
-            {
-                dev->read_write_len = 2;
-            }
 
-            if (dev->read_write_len > (BMI2_CRT_MAX_BURST_WORD_LENGTH * 2))
-            {
-                dev->read_write_len = BMI2_CRT_MAX_BURST_WORD_LENGTH * 2;
-            }
+    return rslt;
+}
 
-            /* Reset the max burst length to default value */
-            rslt = set_maxburst_len(dev->read_write_len, dev);
-        }
+/*!
+ * @brief This internal API packs the fields of a feature configuration into
+ * the image of its feature page.
+ */
+static void pack_feat_fields(uint8_t *feat_config,
+                             uint8_t start_addr,
+                             const struct bmi2_feat_encoder *feat_enc,
+                             const void *config)
+{
+    /* Variable to define loop */
+    uint8_t loop;
 
-        if (rslt == BMI2_OK)
+    /* Variable to define the array offset */
+    uint8_t idx;
+
+    /* Variable to define a word */
+    uint16_t lsb_msb;
+
+    /* Value of the field */
+    uint16_t value;
+
+    const struct bmi2_feat_field *field;
+
+    for (loop = 0; loop < feat_enc->n_fields; loop++)
+    {
+        field = &feat_enc->fields[loop];
+        idx = (uint8_t)(start_addr + (field->word * 2));
+        if (field->size == 1)
         {
-            rslt = get_rdy_for_dl(&download_ready, dev);
+            value = *((const uint8_t *)config + field->member);
         }
-
-        /* Trigger CRT  */
-        if (rslt == BMI2_OK)
+        else
         {
-            rslt = bmi2_set_regs(BMI2_CMD_REG_ADDR, &cmd, 1, dev);
+            value = *(const uint16_t *)(const void *)((const uint8_t *)config + field->member);
         }
 
-        /* Wait till either ready for download toggle or crt running = 0 */
-        if (rslt == BMI2_OK)
-        {
-            rslt = wait_rdy_for_dl_toggle(BMI2_CRT_READY_FOR_DOWNLOAD_RETRY, download_ready, dev);
-            if (rslt == BMI2_OK)
-            {
-                rslt = write_crt_config_file(dev->read_write_len, BMI2_CRT_CONFIG_FILE_SIZE, 0x1800, dev);
-            }
+        lsb_msb = (uint16_t)(feat_config[idx] | ((uint16_t)feat_config[idx + 1] << 8));
+        lsb_msb = (uint16_t)((lsb_msb & ~field->mask) | ((uint16_t)(value << field->pos) & field->mask));
 
-            if (rslt == BMI2_OK)
-            {
-                rslt = wait_st_running(BMI2_CRT_WAIT_RUNNING_RETRY_EXECUTION, dev);
-                rslt_crt = crt_gyro_st_update_result(dev);
-                if (rslt == BMI2_OK)
-                {
-                    rslt = rslt_crt;
-                }
-            }
-        }
+        feat_config[idx] = BMI2_GET_LSB(lsb_msb);
+        feat_config[idx + 1] = BMI2_GET_MSB(lsb_msb);
     }
+}
 
-    return rslt;
+/*!
+ * @brief This internal API unpacks the fields of a feature configuration from
+ * the image of its feature page.
+ */
+static void unpack_feat_fields(const uint8_t *feat_config,
+                               uint8_t start_addr,
+                               const struct bmi2_feat_encoder *feat_enc,
+                               void *config)
+{
+    /* Variable to define loop */
+    uint8_t loop;
+
+    /* Variable to define the array offset */
+    uint8_t idx;
+
+    /* Variable to define a word */
+    uint16_t lsb_msb;
+
+    const struct bmi2_feat_field *field;
+
+    for (loop = 0; loop < feat_enc->n_fields; loop++)
+    {
+        field = &feat_enc->fields[loop];
+        idx = (uint8_t)(start_addr + (field->word * 2));
+
+        lsb_msb = (uint16_t)(feat_config[idx] | ((uint16_t)feat_config[idx + 1] << 8));
+        lsb_msb = (uint16_t)((lsb_msb & field->mask) >> field->pos);
+
+        if (field->size == 1)
+        {
+            *((uint8_t *)config + field->member) = (uint8_t)lsb_msb;
+        }
+        else
+        {
+            *(uint16_t *)(void *)((uint8_t *)config + field->member) = lsb_msb;
+        }
+    }
 }
 
 /*! @endcond */
@@ -696,6 +696,48 @@ int8_t bmi2_extract_gyro(struct bmi2_sens_axes_data *gyro_data,
                          struct bmi2_fifo_frame *fifo,
                          const struct bmi2_dev *dev);
 
+/*!
+ * \ingroup bmi2ApiFIFO
+ * \page bmi2_api_bmi2_extract_accel_gyro bmi2_extract_accel_gyro
+ * \code
+ * int8_t bmi2_extract_accel_gyro(struct bmi2_sens_axes_data *accel_data,
+ *                              uint16_t *accel_length,
+ *                              struct bmi2_sens_axes_data *gyro_data,
+ *                              uint16_t *gyro_length,
+ *                              struct bmi2_fifo_frame *fifo,
+ *                              const struct bmi2_dev *dev);
+ * \endcode
+ * @details This API parses and extracts the accelerometer and gyroscope frames
+ * from FIFO data read by the "bmi2_read_fifo_data" API in a single pass, where
+ * "bmi2_extract_accel" and "bmi2_extract_gyro" parse the data once each.
+ * Sensor time and skipped frame count are updated in the "fifo" structure
+ * instance, auxiliary data is skipped.
+ *
+ * @note Parsing stops at a partially read frame, which the sensor sends again
+ * on the next FIFO read. Virtual frames (S4S) are not supported.
+ *
+ * @param[out]    accel_data   : Structure instance of bmi2_sens_axes_data
+ *                               where the parsed accelerometer data is stored.
+ * @param[in,out] accel_length : Number of accelerometer frames.
+ * @param[out]    gyro_data    : Structure instance of bmi2_sens_axes_data
+ *                               where the parsed gyroscope data is stored.
+ * @param[in,out] gyro_length  : Number of gyroscope frames.
+ * @param[in,out] fifo         : Structure instance of bmi2_fifo_frame.
+ * @param[in]     dev          : Structure instance of bmi2_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval BMI2_W_PARTIAL_READ -> Output buffers full, call again to continue
+ * @retval BMI2_W_FIFO_EMPTY -> End of FIFO data reached
+ * @retval < 0 -> Fail
+ */
+int8_t bmi2_extract_accel_gyro(struct bmi2_sens_axes_data *accel_data,
+                               uint16_t *accel_length,
+                               struct bmi2_sens_axes_data *gyro_data,
+                               uint16_t *gyro_length,
+                               struct bmi2_fifo_frame *fifo,
+                               const struct bmi2_dev *dev);
+
 /**
  * \ingroup bmi2
  * \defgroup bmi2ApiCmd Command Register
@@ -1381,6 +1423,56 @@ int8_t bmi2_perform_accel_foc(const struct bmi2_accel_foc_g_value *accel_g_value
  */
 int8_t bmi2_perform_gyro_foc(struct bmi2_dev *dev);
 
+/*!
+ * \ingroup bmi2ApiFOC
+ * \page bmi2_api_bmi2_perform_accel_foc_fifo bmi2_perform_accel_foc_fifo
+ * \code
+ * int8_t bmi2_perform_accel_foc_fifo(const struct bmi2_accel_foc_g_value *accel_g_value, struct bmi2_dev *dev);
+ * \endcode
+ * @details This API performs Fast Offset Compensation for accelerometer like
+ * "bmi2_perform_accel_foc", but collects the samples in the FIFO at
+ * BMI2_FOC_FIFO_ACC_CONF_VAL and reads them in one burst instead of polling
+ * the data registers.
+ *
+ * @note The FIFO configuration is restored and the FIFO is flushed afterwards.
+ *
+ * @param[in] accel_g_value : This parameter selects the accel foc
+ * axis to be performed
+ *
+ * input format is {x, y, z, sign}. '1' to enable. '0' to disable
+ *
+ * eg to choose x axis  {1, 0, 0, 0}
+ * eg to choose -x axis {1, 0, 0, 1}
+ *
+ * @param[in]  dev              : Structure instance of bmi2_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi2_perform_accel_foc_fifo(const struct bmi2_accel_foc_g_value *accel_g_value, struct bmi2_dev *dev);
+
+/*!
+ * \ingroup bmi2ApiFOC
+ * \page bmi2_api_bmi2_perform_gyro_foc_fifo bmi2_perform_gyro_foc_fifo
+ * \code
+ * int8_t bmi2_perform_gyro_foc_fifo(struct bmi2_dev *dev);
+ * \endcode
+ * @details This API performs Fast Offset Compensation for gyroscope like
+ * "bmi2_perform_gyro_foc", but collects the samples in the FIFO at
+ * BMI2_FOC_FIFO_GYR_CONF_VAL and reads them in one burst instead of polling
+ * the data registers.
+ *
+ * @note The FIFO configuration is restored and the FIFO is flushed afterwards.
+ *
+ * @param[in]  dev              : Structure instance of bmi2_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi2_perform_gyro_foc_fifo(struct bmi2_dev *dev);
+
 /**
  * \ingroup bmi2
  * \defgroup bmi2ApiCRT CRT
@@ -1402,7 +1494,8 @@ int8_t bmi2_perform_gyro_foc(struct bmi2_dev *dev);
  * @retval 0 -> Success
  * @retval < 0 -> Fail
  *
- * @note CRT calibration takes approximately 500ms & maximum time out configured as 2 seconds
+ * @note CRT calibration takes approximately 500ms & maximum time out configured as 2 seconds.
+ * Use bmi2_test_sm_start with BMI2_TEST_SM_CRT to run it without blocking.
  */
 int8_t bmi2_do_crt(struct bmi2_dev *dev);
 
@@ -1466,6 +1559,76 @@ int8_t bmi2_do_gyro_st(struct bmi2_dev *dev);
  */
 int8_t bmi2_nvm_prog(struct bmi2_dev *dev);
 
+/**
+ * \ingroup bmi2
+ * \defgroup bmi2ApiTestSm Resumable self-test
+ * @brief Self-tests, CRT and NVM programming run step by step
+ */
+
+/*!
+ * \ingroup bmi2ApiTestSm
+ * \page bmi2_api_bmi2_test_sm_start bmi2_test_sm_start
+ * \code
+ * int8_t bmi2_test_sm_start(uint8_t op, uint32_t now_us, struct bmi2_test_sm *sm, struct bmi2_dev *dev);
+ * \endcode
+ * @details This API starts a gyro self-test, CRT, accel self-test or NVM
+ * programming, which is then run by bmi2_test_sm_step. No register is
+ * accessed until the first step.
+ *
+ * @param[in] op        : Procedure to be run.
+ *
+ *@verbatim
+ *    op                             |  Procedure
+ * ----------------------------------|---------------------------------
+ *  BMI2_TEST_SM_GYRO_SELF_TEST      |  bmi2_do_gyro_st
+ *  BMI2_TEST_SM_CRT                 |  bmi2_do_crt
+ *  BMI2_TEST_SM_ACCEL_SELF_TEST     |  bmi2_perform_accel_self_test
+ *  BMI2_TEST_SM_NVM_PROG            |  bmi2_nvm_prog
+ *@endverbatim
+ *
+ * @param[in] now_us    : Current time in microseconds, the first step is due
+ *                        at this time.
+ * @param[out] sm       : Context of the procedure, kept by the caller until
+ *                        the procedure is done.
+ * @param[in] dev       : Structure instance of bmi2_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi2_test_sm_start(uint8_t op, uint32_t now_us, struct bmi2_test_sm *sm, struct bmi2_dev *dev);
+
+/*!
+ * \ingroup bmi2ApiTestSm
+ * \page bmi2_api_bmi2_test_sm_step bmi2_test_sm_step
+ * \code
+ * int8_t bmi2_test_sm_step(uint32_t now_us, struct bmi2_test_sm *sm, struct bmi2_dev *dev);
+ * \endcode
+ * @details This API runs the next step of the procedure started by
+ * bmi2_test_sm_start. A step does not wait: every delay and status poll of
+ * the blocking API becomes a return with the time of the next step in
+ * sm->next_us, so procedures on several sensors can be interleaved and the
+ * caller can do other work in between. A call before sm->next_us returns at
+ * once without accessing the sensor. The soft reset which ends the accel
+ * self-test and the NVM programming is run within one step.
+ *
+ * @param[in] now_us    : Current time in microseconds. The time base may
+ *                        wrap around.
+ * @param[in, out] sm   : Context of the procedure.
+ * @param[in] dev       : Structure instance of bmi2_dev.
+ *
+ * @return Result of API execution status
+ * @retval BMI2_W_STEP_PENDING -> Procedure in progress, next step is due at
+ *                                sm->next_us
+ * @retval 0 -> Procedure completed successfully
+ * @retval < 0 -> Procedure failed, same errors as the blocking API
+ *
+ * @note Once the procedure is done, further calls return its result.
+ * bmi2_abort_crt_gyro_st may be called between the steps of a CRT or gyro
+ * self-test, the procedure then ends with an error.
+ */
+int8_t bmi2_test_sm_step(uint32_t now_us, struct bmi2_test_sm *sm, struct bmi2_dev *dev);
+
 /*!
  * @brief This API extracts the input feature configuration
  * details like page and start address from the look-up table.
@@ -1496,6 +1659,67 @@ uint8_t bmi2_extract_input_feat_config(struct bmi2_feature_config *feat_config,
  */
 int8_t bmi2_get_feat_config(uint8_t sw_page, uint8_t *feat_config, struct bmi2_dev *dev);
 
+/*! @name Fields of the feature configurations shared across variants */
+extern const struct bmi2_feat_field bmi2_any_no_mot_fields[BMI2_ANY_NO_MOT_N_FIELDS];
+extern const struct bmi2_feat_field bmi2_sig_mot_fields[BMI2_SIG_MOT_N_FIELDS];
+extern const struct bmi2_feat_field bmi2_step_fields[BMI2_STEP_N_FIELDS];
+
+/*!
+ * @brief This API writes the configurations of the features described by an
+ * encoder table. The features are grouped by the page they reside in, so
+ * each page is read and written at most once. Types which are not in the
+ * encoder table are skipped.
+ *
+ * @param[in] sens_cfg : Structure instance of bmi2_sens_config.
+ * @param[in] n_sens   : Number of configurations.
+ * @param[in] enc      : Encoder table of the variant.
+ * @param[in] n_enc    : Number of entries in the encoder table.
+ * @param[in] dev      : Structure instance of bmi2_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi2_set_feat_config_batch(const struct bmi2_sens_config *sens_cfg,
+                                  uint8_t n_sens,
+                                  const struct bmi2_feat_encoder *enc,
+                                  uint8_t n_enc,
+                                  struct bmi2_dev *dev);
+
+/*!
+ * @brief This API reads the configurations of the features described by an
+ * encoder table, reading each page at most once. Types which are not in the
+ * encoder table are skipped.
+ *
+ * @param[in,out] sens_cfg : Structure instance of bmi2_sens_config.
+ * @param[in]     n_sens   : Number of configurations.
+ * @param[in]     enc      : Encoder table of the variant.
+ * @param[in]     n_enc    : Number of entries in the encoder table.
+ * @param[in]     dev      : Structure instance of bmi2_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi2_get_feat_config_batch(struct bmi2_sens_config *sens_cfg,
+                                  uint8_t n_sens,
+                                  const struct bmi2_feat_encoder *enc,
+                                  uint8_t n_enc,
+                                  struct bmi2_dev *dev);
+
+/*!
+ * @brief This API searches the encoder table for a feature.
+ *
+ * @param[in] type  : Type of feature or sensor.
+ * @param[in] enc   : Encoder table of the variant.
+ * @param[in] n_enc : Number of entries in the encoder table.
+ *
+ * @return Pointer to the encoder, NULL if the feature is not in the table.
+ */
+const struct bmi2_feat_encoder *bmi2_find_feat_encoder(uint8_t type,
+                                                       const struct bmi2_feat_encoder *enc,
+                                                       uint8_t n_enc);
+
 #ifdef __cplusplus
 }
 #endif /* End of CPP guard */
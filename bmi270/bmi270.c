@@ -527,6 +527,44 @@ struct bmi2_map_int bmi270_map_int[BMI270_MAX_INT_MAP] = {
     { .type = BMI2_NO_MOTION, .sens_map_int = BMI270_INT_NO_MOT_MASK },
 };
 
+/*! @name  Fields of the wrist gesture configuration of BMI270 */
+static const struct bmi2_feat_field bmi270_wrist_gest_fields[BMI270_WRIST_GEST_N_FIELDS] = {
+    BMI2_FEAT_FIELD(0, BMI2_WRIST_GEST_WEAR_ARM, struct bmi2_wrist_gest_config, wearable_arm),
+    BMI2_FEAT_FIELD_WORD(1, struct bmi2_wrist_gest_config, min_flick_peak),
+    BMI2_FEAT_FIELD_WORD(2, struct bmi2_wrist_gest_config, min_flick_samples),
+    BMI2_FEAT_FIELD_WORD(3, struct bmi2_wrist_gest_config, max_duration)
+};
+
+/*! @name  Fields of the wrist wear wake-up configuration of BMI270 */
+static const struct bmi2_feat_field bmi270_wrist_wear_wake_up_fields[BMI270_WRIST_WEAR_WAKE_UP_N_FIELDS] = {
+    BMI2_FEAT_FIELD_WORD(1, struct bmi2_wrist_wear_wake_up_config, min_angle_focus),
+    BMI2_FEAT_FIELD_WORD(2, struct bmi2_wrist_wear_wake_up_config, min_angle_nonfocus),
+    BMI2_FEAT_FIELD_WORD(3, struct bmi2_wrist_wear_wake_up_config, max_tilt_lr),
+    BMI2_FEAT_FIELD_WORD(4, struct bmi2_wrist_wear_wake_up_config, max_tilt_ll),
+    BMI2_FEAT_FIELD_WORD(5, struct bmi2_wrist_wear_wake_up_config, max_tilt_pd),
+    BMI2_FEAT_FIELD_WORD(6, struct bmi2_wrist_wear_wake_up_config, max_tilt_pu)
+};
+
+/*! @name  Global array that stores the feature configuration encoders of BMI270 */
+const struct bmi2_feat_encoder bmi270_feat_enc[BMI270_MAX_FEAT_ENC] = {
+    { .type = BMI2_ANY_MOTION, .feat = BMI2_ANY_MOTION, .fields = bmi2_any_no_mot_fields,
+      .n_fields = BMI2_ANY_NO_MOT_N_FIELDS },
+    { .type = BMI2_NO_MOTION, .feat = BMI2_NO_MOTION, .fields = bmi2_any_no_mot_fields,
+      .n_fields = BMI2_ANY_NO_MOT_N_FIELDS },
+    { .type = BMI2_SIG_MOTION, .feat = BMI2_SIG_MOTION, .fields = bmi2_sig_mot_fields,
+      .n_fields = BMI2_SIG_MOT_N_FIELDS },
+    { .type = BMI2_STEP_DETECTOR, .feat = BMI2_STEP_COUNTER, .fields = bmi2_step_fields,
+      .n_fields = BMI2_STEP_N_FIELDS },
+    { .type = BMI2_STEP_COUNTER, .feat = BMI2_STEP_COUNTER, .fields = bmi2_step_fields,
+      .n_fields = BMI2_STEP_N_FIELDS },
+    { .type = BMI2_STEP_ACTIVITY, .feat = BMI2_STEP_COUNTER, .fields = bmi2_step_fields,
+      .n_fields = BMI2_STEP_N_FIELDS },
+    { .type = BMI2_WRIST_GESTURE, .feat = BMI2_WRIST_GESTURE, .fields = bmi270_wrist_gest_fields,
+      .n_fields = BMI270_WRIST_GEST_N_FIELDS },
+    { .type = BMI2_WRIST_WEAR_WAKE_UP, .feat = BMI2_WRIST_WEAR_WAKE_UP, .fields = bmi270_wrist_wear_wake_up_fields,
+      .n_fields = BMI270_WRIST_WEAR_WAKE_UP_N_FIELDS }
+};
+
 /******************************************************************************/
 
 /*!         Local Function Prototypes
@@ -544,6 +582,16 @@ struct bmi2_map_int bmi270_map_int[BMI270_MAX_INT_MAP] = {
  */
 static int8_t null_ptr_check(const struct bmi2_dev *dev);
 
+/*!
+ * @brief This internal API assigns the feature configuration of BMI270 to the
+ * device structure.
+ *
+ * @param[in, out] dev : Structure instance of bmi2_dev.
+ *
+ * @return None
+ */
+static void assign_variant_tables(struct bmi2_dev *dev);
+
 /*!
  * @brief This internal API enables the selected sensor/features.
  *
@@ -754,94 +802,6 @@ static int8_t set_wrist_gesture(uint8_t enable, struct bmi2_dev *dev);
  */
 static int8_t set_wrist_wear_wake_up(uint8_t enable, struct bmi2_dev *dev);
 
-/*!
- * @brief This internal API sets any-motion configurations like axes select,
- * duration, threshold and output-configuration.
- *
- * @param[in]      config      : Structure instance of bmi2_any_motion_config.
- * @param[in, out] dev         : Structure instance of bmi2_dev.
- *
- * @verbatim
- *----------------------------------------------------------------------------
- *  bmi2_any_motion_config  |
- *  Structure parameters    |                   Description
- *--------------------------|--------------------------------------------------
- *                          | Defines the number of  consecutive data points for
- *                          | which the threshold condition must be respected,
- *                          | for interrupt assertion. It is expressed in  50 Hz
- *  duration                | samples (20 msec).
- *                          | Range is 0 to 163sec.
- *                          | Default value is 5 = 100ms.
- * -------------------------|---------------------------------------------------
- *                          | Slope threshold value for in 5.11g format.
- *  threshold               | Range is 0 to 1g.
- *                          | Default value is 0xAA = 83mg.
- * -------------------------|---------------------------------------------------
- *  x_sel, y_sel, z_sel     |  Selects the feature on a per-axis basis
- * -------------------------|---------------------------------------------------
- * @endverbatim
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t set_any_motion_config(const struct bmi2_any_motion_config *config, struct bmi2_dev *dev);
-
-/*!
- * @brief This internal API sets no-motion configurations like axes select,
- * duration, threshold and output-configuration.
- *
- * @param[in]      config       : Structure instance of bmi2_no_motion_config.
- * @param[in, out] dev          : Structure instance of bmi2_dev.
- *
- * @verbatim
- *----------------------------------------------------------------------------
- *  bmi2_no_motion_config   |
- *  Structure parameters    |                   Description
- *--------------------------|--------------------------------------------------
- *                          | Defines the number of  consecutive data points for
- *                          | which the threshold condition must be respected,
- *                          | for interrupt assertion. It is expressed in  50 Hz
- *  duration                | samples (20 msec).
- *                          | Range is 0 to 163sec.
- *                          | Default value is 5 = 100ms.
- * -------------------------|---------------------------------------------------
- *                          | Slope threshold value for in 5.11g format.
- *  threshold               | Range is 0 to 1g.
- *                          | Default value is 0xAA = 83mg.
- * -------------------------|---------------------------------------------------
- *  x_sel, y_sel, z_sel     |  Selects the feature on a per-axis basis
- * -------------------------|---------------------------------------------------
- * @endverbatim
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t set_no_motion_config(const struct bmi2_no_motion_config *config, struct bmi2_dev *dev);
-
-/*!
- * @brief This internal API sets sig-motion configurations like block-size,
- * output-configuration and other parameters.
- *
- * @param[in]      config        : Structure instance of bmi2_sig_motion_config.
- * @param[in, out] dev           : Structure instance of bmi2_dev.
- *
- *----------------------------------------------------------------------------
- *  bmi2_sig_motion_config  |
- *  Structure parameters    |                   Description
- * -------------------------|---------------------------------------------------
- *                          | Defines the duration after which the significant
- *  block_size              | motion interrupt is triggered. It is expressed in
- *                          | 50 Hz samples (20 ms). Default value is 0xFA=5sec.
- *--------------------------|---------------------------------------------------
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t set_sig_motion_config(const struct bmi2_sig_motion_config *config, struct bmi2_dev *dev);
-
 /*!
  * @brief This internal API sets step counter parameter configurations.
  *
@@ -854,187 +814,6 @@ static int8_t set_sig_motion_config(const struct bmi2_sig_motion_config *config,
  */
 static int8_t set_step_count_params_config(const uint16_t *step_count_params, struct bmi2_dev *dev);
 
-/*!
- * @brief This internal API sets step counter/detector/activity configurations.
- *
- * @param[in] config      : Structure instance of bmi2_step_config.
- * @param[in] dev         : Structure instance of bmi2_dev.
- *
- *---------------------------------------------------------------------------
- *    bmi2_step_config      |
- *  Structure parameters    |                 Description
- *--------------------------|--------------------------------------------------
- *                          | The Step-counter will trigger output every time
- *                          | the number of steps are counted. Holds implicitly
- *  water-mark level        | a 20x factor, so the range is 0 to 10230,
- *                          | with resolution of 20 steps.
- * -------------------------|---------------------------------------------------
- *  reset counter           | Flag to reset the counted steps.
- * -------------------------|---------------------------------------------------
- * @endverbatim
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t set_step_config(const struct bmi2_step_config *config, struct bmi2_dev *dev);
-
-/*!
- * @brief This internal API sets wrist gesture configurations like wearable-arm,
- * and output-configuration.
- *
- * @param[in]       config    : Structure instance of bmi2_wrist_gest_config.
- * @param[in, out]  dev       : Structure instance of bmi2_dev.
- *
- * @verbatim
- * --------------------------------------------------------------------------------------------
- *  bmi2_wrist_gest_config  |
- *  Structure parameters    |               Description
- * --------------------------------------------------------------------------------------------
- *                          | Device in left (0) or right (1) arm. By default,
- *  wearable_arm            | the wearable device is assumed to be in left arm
- *                          | i.e. default value is 0.
- * --------------------------------------------------------------------------------------------
- *                          | Sine of the minimum tilt angle in portrait down
- *                          | direction of the device when wrist is rolled away
- *                          | (roll-out) from user.
- *  min_flick_peak          | The configuration parameter is scaled by 2048
- *                          | i.e. 2048 * sin(angle).
- *                          | Range is 1448 to 1774. Default value is 1774.
- * --------------------------------------------------------------------------------------------
- *                          | Value of minimum time difference between wrist
- *                          | roll-out and roll-in movement during flick gesture.
- *  min_flick_samples       | Range is 3 to 5 samples at 50Hz (i.e. 0.06 to 0.1 seconds).
- *                          | Default value is 4 (i.e. 0.08 seconds).
- * --------------------------------------------------------------------------------------------
- *                          | Maximum time within which gesture movement has to be completed.
- *  max_duration            | Range is 150 to 250 samples at 50Hz (i.e. 3 to 5 seconds).
- *                          | Default value is 200 (i.e. 4 seconds).
- * --------------------------------------------------------------------------------------------
- * @endverbatim
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t set_wrist_gest_config(const struct bmi2_wrist_gest_config *config, struct bmi2_dev *dev);
-
-/*!
- * @brief This internal API sets wrist wear wake-up configurations like
- * output-configuration.
- *
- * @param[in]       config    : Structure instance of
- *                              bmi2_wrist_wear_wake_up_config.
- * @param[in, out]  dev       : Structure instance of bmi2_dev.
- *
- * @verbatim
- *-----------------------------------------------------------------------------
- * bmi2_wrist_wear_wake_up_config   |
- *  Structure parameters            |               Description
- *----------------------------------|-------------------------------------------
- *                                  | To set the wrist wear wake-up parameters like
- *                                  | min_angle_focus, min_angle_nonfocus,
- *  wrist_wear_wakeup_params        | max_tilt_lr, max_tilt_ll,
- *                                  | max_tilt_pd and max_tilt_pu.
- * ---------------------------------|-------------------------------------------
- * @endverbatim
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t set_wrist_wear_wake_up_config(const struct bmi2_wrist_wear_wake_up_config *config, struct bmi2_dev *dev);
-
-/*!
- * @brief This internal API gets any-motion configurations like axes select,
- * duration, threshold and output-configuration.
- *
- * @param[out] config        : Structure instance of bmi2_any_motion_config.
- * @param[in, out]  dev      : Structure instance of bmi2_dev.
- *
- * @verbatim
- *----------------------------------------------------------------------------
- *  bmi2_any_motion_config  |
- *  Structure parameters    |                   Description
- *--------------------------|--------------------------------------------------
- *                          | Defines the number of  consecutive data points for
- *                          | which the threshold condition must be respected,
- *                          | for interrupt assertion. It is expressed in  50 Hz
- *  duration                | samples (20 msec).
- *                          | Range is 0 to 163sec.
- *                          | Default value is 5 = 100ms.
- * -------------------------|---------------------------------------------------
- *                          | Slope threshold value for in 5.11g format.
- *  threshold               | Range is 0 to 1g.
- *                          | Default value is 0xAA = 83mg.
- * -------------------------|---------------------------------------------------
- *  select_x, select_y,     |
- *       select_z           |  Selects the feature on a per-axis basis
- * -------------------------|---------------------------------------------------
- * @endverbatim
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t get_any_motion_config(struct bmi2_any_motion_config *config, struct bmi2_dev *dev);
-
-/*!
- * @brief This internal API gets no-motion configurations like axes select,
- * duration, threshold and output-configuration.
- *
- * @param[out]      config    : Structure instance of bmi2_no_motion_config.
- * @param[in, out]  dev       : Structure instance of bmi2_dev.
- *
- * @verbatim
- *----------------------------------------------------------------------------
- *  bmi2_no_motion_config   |
- *  Structure parameters    |                   Description
- *--------------------------|--------------------------------------------------
- *                          | Defines the number of  consecutive data points for
- *                          | which the threshold condition must be respected,
- *                          | for interrupt assertion. It is expressed in  50 Hz
- *  duration                | samples (20 msec).
- *                          | Range is 0 to 163sec.
- *                          | Default value is 5 = 100ms.
- * -------------------------|---------------------------------------------------
- *                          | Slope threshold value for in 5.11g format.
- *  threshold               | Range is 0 to 1g.
- *                          | Default value is 0xAA = 83mg.
- * -------------------------|---------------------------------------------------
- *  select_x, select_y,     |
- *       select_z           |  Selects the feature on a per-axis basis
- * -------------------------|---------------------------------------------------
- * @endverbatim
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t get_no_motion_config(struct bmi2_no_motion_config *config, struct bmi2_dev *dev);
-
-/*!
- * @brief This internal API gets sig-motion configurations like block-size,
- * output-configuration and other parameters.
- *
- * @param[out]      config    : Structure instance of bmi2_sig_motion_config.
- * @param[in, out]  dev       : Structure instance of bmi2_dev.
- *
- *----------------------------------------------------------------------------
- *  bmi2_sig_motion_config  |
- *  Structure parameters    |                   Description
- * -------------------------|---------------------------------------------------
- *                          | Defines the duration after which the significant
- *  block_size              | motion interrupt is triggered. It is expressed in
- *                          | 50 Hz samples (20 ms). Default value is 0xFA=5sec.
- *--------------------------|---------------------------------------------------
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t get_sig_motion_config(struct bmi2_sig_motion_config *config, struct bmi2_dev *dev);
-
 /*!
  * @brief This internal API gets step counter parameter configurations.
  *
@@ -1048,102 +827,11 @@ static int8_t get_sig_motion_config(struct bmi2_sig_motion_config *config, struc
 static int8_t get_step_count_params_config(uint16_t *step_count_params, struct bmi2_dev *dev);
 
 /*!
- * @brief This internal API gets step counter/detector/activity configurations.
- *
- * @param[out] config      : Structure instance of bmi2_step_config.
- * @param[in]  dev         : Structure instance of bmi2_dev.
- *
- * @verbatim
- *----------------------------------------------------------------------------
- *    bmi2_step_config      |
- *  Structure parameters    |                 Description
- *--------------------------|--------------------------------------------------
- *                          | The Step-counter will trigger output every time
- *                          | the number of steps are counted. Holds implicitly
- *  water-mark level        | a 20x factor, so the range is 0 to 20460,
- *                          | with resolution of 20 steps.
- * -------------------------|---------------------------------------------------
- *  reset counter           | Flag to reset the counted steps.
- * -------------------------|---------------------------------------------------
- * @endverbatim
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t get_step_config(struct bmi2_step_config *config, struct bmi2_dev *dev);
-
-/*!
- * @brief This internal API gets wrist gesture configurations like wearable-arm,
- * and output-configuration.
- *
- * @param[out]      config    : Structure instance of bmi2_wrist_gest_config.
- * @param[in, out]  dev       : Structure instance of bmi2_dev.
- *
- * @verbatim
- * --------------------------------------------------------------------------------------------
- *  bmi2_wrist_gest_config  |
- *  Structure parameters    |               Description
- * --------------------------------------------------------------------------------------------
- *                          | Device in left (0) or right (1) arm. By default,
- *  wearable_arm            | the wearable device is assumed to be in left arm
- *                          | i.e. default value is 0.
- * --------------------------------------------------------------------------------------------
- *                          | Sine of the minimum tilt angle in portrait down
- *                          | direction of the device when wrist is rolled away
- *                          | (roll-out) from user.
- *  min_flick_peak          | The configuration parameter is scaled by 2048
- *                          | i.e. 2048 * sin(angle).
- *                          | Range is 1448 to 1774. Default value is 1774.
- * --------------------------------------------------------------------------------------------
- *                          | Value of minimum time difference between wrist
- *                          | roll-out and roll-in movement during flick gesture.
- *  min_flick_samples       | Range is 3 to 5 samples at 50Hz (i.e. 0.06 to 0.1 seconds).
- *                          | Default value is 4 (i.e. 0.08 seconds).
- * --------------------------------------------------------------------------------------------
- *                          | Maximum time within which gesture movement has to be completed.
- *  max_duration            | Range is 150 to 250 samples at 50Hz (i.e. 3 to 5 seconds).
- *                          | Default value is 200 (i.e. 4 seconds).
- * --------------------------------------------------------------------------------------------
- * @endverbatim
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t get_wrist_gest_config(struct bmi2_wrist_gest_config *config, struct bmi2_dev *dev);
-
-/*!
- * @brief This internal API gets wrist wear wake-up configurations like
- * output-configuration.
- *
- * @param[out]      config    : Structure instance of
- *                              bmi2_wrist_wear_wake_up_config.
- * @param[in, out]  dev       : Structure instance of bmi2_dev.
- *
- * @verbatim
- *-----------------------------------------------------------------------------
- * bmi2_wrist_wear_wake_up_config   |
- *  Structure parameters            |               Description
- *----------------------------------|-------------------------------------------
- *                                  | To set the wrist wear wake-up parameters like
- *                                  | min_angle_focus, min_angle_nonfocus,
- *  wrist_wear_wakeup_params        | max_tilt_lr, max_tilt_ll,
- *                                  | max_tilt_pd and max_tilt_pu.
- * ---------------------------------|-------------------------------------------
- * @endverbatim
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t get_wrist_wear_wake_up_config(struct bmi2_wrist_wear_wake_up_config *config, struct bmi2_dev *dev);
-
-/*!
- * @brief This internal API gets the output values of wrist gesture.
+ * @brief This internal API decodes the output values of wrist gesture.
  *
  * @param[out] wrist_gest   : Pointer to the stored wrist gesture.
- * @param[in]  dev          : Structure instance of bmi2_dev.
+ * @param[in]  feat_config  : Image of the feature page holding the output.
+ * @param[in]  idx          : Offset of the output in the feature page.
  *
  * *wrist_gest  |  Output
  * -------------|------------
@@ -1153,18 +841,15 @@ static int8_t get_wrist_wear_wake_up_config(struct bmi2_wrist_wear_wake_up_confi
  * 0x03         |  WRIST_SHAKE_JIGGLE
  * 0x04         |  FLICK_IN
  * 0x05         |  FLICK_OUT
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
  */
-static int8_t get_wrist_gest_status(uint8_t *wrist_gest, struct bmi2_dev *dev);
+static void get_wrist_gest_status(uint8_t *wrist_gest, const uint8_t *feat_config, uint8_t idx);
 
 /*!
- * @brief This internal API gets the output values of step activity.
+ * @brief This internal API decodes the output values of step activity.
  *
- * @param[out] step_act         : Pointer to the stored step activity data.
- * @param[in]  dev      : Structure instance of bmi2_dev.
+ * @param[out] step_act     : Pointer to the stored step activity data.
+ * @param[in]  feat_config  : Image of the feature page holding the output.
+ * @param[in]  idx          : Offset of the output in the feature page.
  *
  * *step_act  |  Output
  * -----------|------------
@@ -1172,48 +857,51 @@ static int8_t get_wrist_gest_status(uint8_t *wrist_gest, struct bmi2_dev *dev);
  * 0x01       |  WALKING
  * 0x02       |  RUNNING
  * 0x03       |  UNKNOWN
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fails
  */
-static int8_t get_step_activity_output(uint8_t *step_act, struct bmi2_dev *dev);
+static void get_step_activity_output(uint8_t *step_act, const uint8_t *feat_config, uint8_t idx);
 
 /*!
- * @brief This internal API gets the output values of step counter.
+ * @brief This internal API decodes the output values of step counter.
  *
- * @param[out] step_count       : Pointer to the stored step counter data.
- * @param[in]  dev              : Structure instance of bmi2_dev.
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
+ * @param[out] step_count   : Pointer to the stored step counter data.
+ * @param[in]  feat_config  : Image of the feature page holding the output.
+ * @param[in]  idx          : Offset of the output in the feature page.
  */
-static int8_t get_step_counter_output(uint32_t *step_count, struct bmi2_dev *dev);
+static void get_step_counter_output(uint32_t *step_count, const uint8_t *feat_config, uint8_t idx);
 
 /*!
- * @brief This internal API gets the error status related to NVM.
+ * @brief This internal API decodes the error status related to NVM.
  *
- * @param[out] nvm_err_stat     : Stores the NVM error status.
- * @param[in]  dev              : Structure instance of bmi2_dev.
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
+ * @param[out] nvm_err_stat : Stores the NVM error status.
+ * @param[in]  feat_config  : Image of the feature page holding the output.
+ * @param[in]  idx          : Offset of the output in the feature page.
  */
-static int8_t get_nvm_error_status(struct bmi2_nvm_err_status *nvm_err_stat, struct bmi2_dev *dev);
+static void get_nvm_error_status(struct bmi2_nvm_err_status *nvm_err_stat, const uint8_t *feat_config, uint8_t idx);
 
 /*!
- * @brief This internal API gets the error status related to virtual frames.
+ * @brief This internal API decodes the error status related to virtual frames.
  *
- * @param[out] vfrm_err_stat    : Stores the VFRM related error status.
- * @param[in]  dev              : Structure instance of bmi2_dev.
+ * @param[out] vfrm_err_stat : Stores the VFRM related error status.
+ * @param[in]  feat_config   : Image of the feature page holding the output.
+ * @param[in]  idx           : Offset of the output in the feature page.
+ */
+static void get_vfrm_error_status(struct bmi2_vfrm_err_status *vfrm_err_stat, const uint8_t *feat_config, uint8_t idx);
+
+/*!
+ * @brief This internal API decodes the outputs of all requested features
+ * residing in a feature page from its image.
  *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
+ * @param[in,out] feature_data : Structure instance of bmi2_feat_sensor_data.
+ * @param[in]     n_sens       : Number of features requested.
+ * @param[in]     page         : Feature page of the image.
+ * @param[in]     feat_config  : Image of the feature page.
+ * @param[in]     dev          : Structure instance of bmi2_dev.
  */
-static int8_t get_vfrm_error_status(struct bmi2_vfrm_err_status *vfrm_err_stat, struct bmi2_dev *dev);
+static void decode_page_feat_outputs(struct bmi2_feat_sensor_data *feature_data,
+                                     uint8_t n_sens,
+                                     uint8_t page,
+                                     const uint8_t *feat_config,
+                                     const struct bmi2_dev *dev);
 
 /*!
  * @brief This internal API is used to get enable status of gyroscope user gain
@@ -1379,6 +1067,9 @@ int8_t bmi270_init(struct bmi2_dev *dev)
             dev->dummy_byte = 0;
         }
 
+        /* A configuration file given by the caller is uploaded as it is */
+        dev->config_blob = NULL;
+
         /* If configuration file pointer is not assigned any address */
         if (!dev->config_file_ptr)
         {
@@ -1392,40 +1083,46 @@ int8_t bmi270_init(struct bmi2_dev *dev)
         rslt = bmi2_sec_init(dev);
         if (rslt == BMI2_OK)
         {
-            /* Assign the offsets of the feature input
-             * configuration to the device structure
-             */
-            dev->feat_config = bmi270_feat_in;
+            /* Assign the feature configuration of the variant to the device structure */
+            assign_variant_tables(dev);
 
-            /* Assign the offsets of the feature output to
-             * the device structure
-             */
-            dev->feat_output = bmi270_feat_out;
+            /* Get the gyroscope cross axis sensitivity */
+            rslt = bmi2_get_gyro_cross_sense(dev);
+        }
+    }
 
-            /* Assign the maximum number of pages to the
-             * device structure
-             */
-            dev->page_max = BMI270_MAX_PAGE_NUM;
+    return rslt;
+}
 
-            /* Assign maximum number of input sensors/
-             * features to device structure
-             */
-            dev->input_sens = BMI270_MAX_FEAT_IN;
+/*!
+ * @brief This API loads the configuration file of BMI270 into a sensor
+ * initialized with another BMI270 variant, without a soft-reset.
+ */
+int8_t bmi270_load_variant(struct bmi2_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
 
-            /* Assign maximum number of output sensors/
-             * features to device structure
-             */
-            dev->out_sens = BMI270_MAX_FEAT_OUT;
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+    if (rslt == BMI2_OK)
+    {
+        /* Get the size of config array */
+        dev->config_size = sizeof(bmi270_config_file);
 
-            /* Assign the offsets of the feature interrupt
-             * to the device structure
-             */
-            dev->map_int = bmi270_map_int;
+        /* Enable the variant specific features if any */
+        dev->variant_feature = BMI2_GYRO_CROSS_SENS_ENABLE | BMI2_CRT_RTOSK_ENABLE;
 
-            /* Assign maximum number of feature interrupts
-             * to device structure
-             */
-            dev->sens_int_map = BMI270_MAX_INT_MAP;
+        /* Replace the configuration file of the previous variant */
+        dev->config_file_ptr = bmi270_config_file;
+        dev->config_blob = NULL;
+
+        /* Write the configuration file */
+        rslt = bmi2_write_config_file(dev);
+        if (rslt == BMI2_OK)
+        {
+            /* Assign the feature configuration of the variant to the device structure */
+            assign_variant_tables(dev);
 
             /* Get the gyroscope cross axis sensitivity */
             rslt = bmi2_get_gyro_cross_sense(dev);
@@ -1509,47 +1206,46 @@ int8_t bmi270_set_sensor_config(struct bmi2_sens_config *sens_cfg, uint8_t n_sen
     uint8_t loop;
 
     /* Variable to get the status of advance power save */
-    uint8_t aps_stat = 0;
+    uint8_t aps_stat = BMI2_DISABLE;
 
     /* Null-pointer check */
     rslt = null_ptr_check(dev);
     if ((rslt == BMI2_OK) && (sens_cfg != NULL))
     {
-        /* Get status of advance power save mode */
-        aps_stat = dev->aps_status;
-
+        /* Disable advance power save once for all auxiliary and feature
+         * configurations
+         */
         for (loop = 0; loop < n_sens; loop++)
+        {
+            if ((sens_cfg[loop].type != BMI2_ACCEL) && (sens_cfg[loop].type != BMI2_GYRO) &&
+                (sens_cfg[loop].type != BMI2_AUX) && (sens_cfg[loop].type != BMI2_GYRO_GAIN_UPDATE) &&
+                (dev->aps_status == BMI2_ENABLE))
+            {
+                aps_stat = BMI2_ENABLE;
+                rslt = bmi2_set_adv_power_save(BMI2_DISABLE, dev);
+                break;
+            }
+        }
+
+        for (loop = 0; (loop < n_sens) && (rslt == BMI2_OK); loop++)
         {
             if ((sens_cfg[loop].type == BMI2_ACCEL) || (sens_cfg[loop].type == BMI2_GYRO) ||
                 (sens_cfg[loop].type == BMI2_AUX) || (sens_cfg[loop].type == BMI2_GYRO_GAIN_UPDATE))
             {
                 rslt = bmi2_set_sensor_config(&sens_cfg[loop], 1, dev);
             }
-            else
+            else if (bmi2_find_feat_encoder(sens_cfg[loop].type, bmi270_feat_enc, BMI270_MAX_FEAT_ENC) == NULL)
             {
-                /* Disable Advance power save if enabled for auxiliary
-                 * and feature configurations
-                 */
-                if (aps_stat == BMI2_ENABLE)
-                {
-                    /* Disable advance power save if
-                     * enabled
-                     */
-                    rslt = bmi2_set_adv_power_save(BMI2_DISABLE, dev);
-                }
-
-                if (rslt == BMI2_OK)
-                {
-                    rslt = set_feat_config(sens_cfg, loop, dev);
-                }
-                /* Return error if any of the set configurations fail */
-                else
-                {
-                    break;
-                }
+                rslt = set_feat_config(sens_cfg, loop, dev);
             }
         }
 
+        /* Set the table driven feature configurations, writing each page once */
+        if (rslt == BMI2_OK)
+        {
+            rslt = bmi2_set_feat_config_batch(sens_cfg, n_sens, bmi270_feat_enc, BMI270_MAX_FEAT_ENC, dev);
+        }
+
         /* Enable Advance power save if disabled while configuring and
          * not when already disabled
          */
@@ -1578,50 +1274,43 @@ int8_t bmi270_get_sensor_config(struct bmi2_sens_config *sens_cfg, uint8_t n_sen
     uint8_t loop;
 
     /* Variable to get the status of advance power save */
-    uint8_t aps_stat = 0;
+    uint8_t aps_stat = BMI2_DISABLE;
 
     /* Null-pointer check */
     rslt = null_ptr_check(dev);
     if ((rslt == BMI2_OK) && (sens_cfg != NULL))
     {
-        /* Get status of advance power save mode */
-        aps_stat = dev->aps_status;
+        /* Disable advance power save once for all feature configurations */
         for (loop = 0; loop < n_sens; loop++)
+        {
+            if ((sens_cfg[loop].type >= BMI2_MAIN_SENS_MAX_NUM) && (sens_cfg[loop].type != BMI2_GYRO_GAIN_UPDATE) &&
+                (dev->aps_status == BMI2_ENABLE))
+            {
+                aps_stat = BMI2_ENABLE;
+                rslt = bmi2_set_adv_power_save(BMI2_DISABLE, dev);
+                break;
+            }
+        }
+
+        for (loop = 0; (loop < n_sens) && (rslt == BMI2_OK); loop++)
         {
             if ((sens_cfg[loop].type == BMI2_ACCEL) || (sens_cfg[loop].type == BMI2_GYRO) ||
                 (sens_cfg[loop].type == BMI2_AUX) || (sens_cfg[loop].type == BMI2_GYRO_GAIN_UPDATE))
             {
                 rslt = bmi2_get_sensor_config(&sens_cfg[loop], 1, dev);
             }
-            else
+            else if (bmi2_find_feat_encoder(sens_cfg[loop].type, bmi270_feat_enc, BMI270_MAX_FEAT_ENC) == NULL)
             {
-                /* Disable Advance power save if enabled for auxiliary
-                 * and feature configurations
-                 */
-                if ((sens_cfg[loop].type >= BMI2_MAIN_SENS_MAX_NUM) || (sens_cfg[loop].type == BMI2_AUX))
-                {
-
-                    if (aps_stat == BMI2_ENABLE)
-                    {
-                        /* Disable advance power save if
-                         * enabled
-                         */
-                        rslt = bmi2_set_adv_power_save(BMI2_DISABLE, dev);
-                    }
-                }
-
-                if (rslt == BMI2_OK)
-                {
-                    rslt = get_feat_config(sens_cfg, loop, dev);
-                }
-                /* Return error if any of the get configurations fail */
-                else
-                {
-                    break;
-                }
+                rslt = get_feat_config(sens_cfg, loop, dev);
             }
         }
 
+        /* Get the table driven feature configurations, reading each page once */
+        if (rslt == BMI2_OK)
+        {
+            rslt = bmi2_get_feat_config_batch(sens_cfg, n_sens, bmi270_feat_enc, BMI270_MAX_FEAT_ENC, dev);
+        }
+
         /* Enable Advance power save if disabled while configuring and
          * not when already disabled
          */
@@ -1650,88 +1339,72 @@ int8_t bmi270_get_feature_data(struct bmi2_feat_sensor_data *feature_data, uint8
     uint8_t loop;
 
     /* Variable to get the status of advance power save */
-    uint8_t aps_stat = 0;
+    uint8_t aps_stat = BMI2_DISABLE;
+
+    /* Bit mask of the feature pages already read */
+    uint8_t pages_read = 0;
+
+    /* Array to define the feature page image */
+    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
+
+    /* Output configuration of the feature */
+    struct bmi2_feature_config out_config = { 0, 0, 0 };
 
     /* Null-pointer check */
     rslt = null_ptr_check(dev);
     if ((rslt == BMI2_OK) && (feature_data != NULL))
     {
-        /* Get status of advance power save mode */
-        aps_stat = dev->aps_status;
+        /* Disable advance power save once for all feature pages read */
         for (loop = 0; loop < n_sens; loop++)
+        {
+            if ((feature_data[loop].type >= BMI2_MAIN_SENS_MAX_NUM) && (dev->aps_status == BMI2_ENABLE))
+            {
+                aps_stat = BMI2_ENABLE;
+                rslt = bmi2_set_adv_power_save(BMI2_DISABLE, dev);
+                break;
+            }
+        }
+
+        for (loop = 0; (loop < n_sens) && (rslt == BMI2_OK); loop++)
         {
             if ((feature_data[loop].type == BMI2_GYRO_GAIN_UPDATE) ||
                 (feature_data[loop].type == BMI2_GYRO_CROSS_SENSE))
             {
                 rslt = bmi2_get_feature_data(&feature_data[loop], 1, dev);
             }
-            else
+            else if (!extract_output_feat_config(&out_config, feature_data[loop].type, dev) ||
+                     (out_config.page > BMI2_PAGE_7))
             {
-                /* Disable Advance power save if enabled for feature
-                 * configurations
-                 */
-                if (feature_data[loop].type >= BMI2_MAIN_SENS_MAX_NUM)
-                {
-                    if (aps_stat == BMI2_ENABLE)
-                    {
-                        /* Disable advance power save if
-                         * enabled
-                         */
-                        rslt = bmi2_set_adv_power_save(BMI2_DISABLE, dev);
-                    }
-                }
-
+                rslt = BMI2_E_INVALID_SENSOR;
+            }
+            else if ((pages_read & (UINT8_C(1) << out_config.page)) == 0)
+            {
+                /* Read the page once and decode every requested output residing in it */
+                rslt = bmi2_get_feat_config(out_config.page, feat_config, dev);
                 if (rslt == BMI2_OK)
                 {
-                    switch (feature_data[loop].type)
-                    {
-                        case BMI2_STEP_COUNTER:
-
-                            /* Get step counter output */
-                            rslt = get_step_counter_output(&feature_data[loop].sens_data.step_counter_output, dev);
-                            break;
-                        case BMI2_STEP_ACTIVITY:
-
-                            /* Get step activity output */
-                            rslt = get_step_activity_output(&feature_data[loop].sens_data.activity_output, dev);
-                            break;
-                        case BMI2_NVM_STATUS:
-
-                            /* Get NVM error status  */
-                            rslt = get_nvm_error_status(&feature_data[loop].sens_data.nvm_status, dev);
-                            break;
-                        case BMI2_VFRM_STATUS:
-
-                            /* Get VFRM error status  */
-                            rslt = get_vfrm_error_status(&feature_data[loop].sens_data.vfrm_status, dev);
-                            break;
-                        case BMI2_WRIST_GESTURE:
-
-                            /* Get wrist gesture status  */
-                            rslt = get_wrist_gest_status(&feature_data[loop].sens_data.wrist_gesture_output, dev);
-                            break;
-                        default:
-                            rslt = BMI2_E_INVALID_SENSOR;
-                            break;
-                    }
-
-                    /* Return error if any of the get sensor data fails */
-                    if (rslt != BMI2_OK)
-                    {
-                        break;
-                    }
+                    pages_read |= (uint8_t)(UINT8_C(1) << out_config.page);
+                    decode_page_feat_outputs(&feature_data[loop],
+                                             (uint8_t)(n_sens - loop),
+                                             out_config.page,
+                                             feat_config,
+                                             dev);
                 }
             }
-
-            /* Enable Advance power save if disabled while
-             * configuring and not when already disabled
-             */
-            if ((aps_stat == BMI2_ENABLE) && (rslt == BMI2_OK))
+            else
             {
-                rslt = bmi2_set_adv_power_save(BMI2_ENABLE, dev);
+                /* Already decoded along with the first output of its page */
             }
         }
-    }
+
+        /* Enable Advance power save if disabled while
+         * configuring and not when already disabled
+         */
+        if ((aps_stat == BMI2_ENABLE) && (rslt == BMI2_OK))
+        {
+            rslt = bmi2_set_adv_power_save(BMI2_ENABLE, dev);
+        }
+    }
     else
     {
         rslt = BMI2_E_NULL_PTR;
@@ -1946,6 +1619,48 @@ static int8_t null_ptr_check(const struct bmi2_dev *dev)
     return rslt;
 }
 
+/*!
+ * @brief This internal API assigns the feature configuration of BMI270 to the
+ * device structure.
+ */
+static void assign_variant_tables(struct bmi2_dev *dev)
+{
+    /* Assign the offsets of the feature input
+     * configuration to the device structure
+     */
+    dev->feat_config = bmi270_feat_in;
+
+    /* Assign the offsets of the feature output to
+     * the device structure
+     */
+    dev->feat_output = bmi270_feat_out;
+
+    /* Assign the maximum number of pages to the
+     * device structure
+     */
+    dev->page_max = BMI270_MAX_PAGE_NUM;
+
+    /* Assign maximum number of input sensors/
+     * features to device structure
+     */
+    dev->input_sens = BMI270_MAX_FEAT_IN;
+
+    /* Assign maximum number of output sensors/
+     * features to device structure
+     */
+    dev->out_sens = BMI270_MAX_FEAT_OUT;
+
+    /* Assign the offsets of the feature interrupt
+     * to the device structure
+     */
+    dev->map_int = bmi270_map_int;
+
+    /* Assign maximum number of feature interrupts
+     * to device structure
+     */
+    dev->sens_int_map = BMI270_MAX_INT_MAP;
+}
+
 /*!
  * @brief This internal API selects the sensor/features to be enabled or
  * disabled.
@@ -2651,243 +2366,6 @@ static int8_t set_gyro_user_gain(uint8_t enable, struct bmi2_dev *dev)
     return rslt;
 }
 
-/*!
- * @brief This internal API sets any-motion configurations like axes select,
- * duration, threshold and output-configuration.
- */
-static int8_t set_any_motion_config(const struct bmi2_any_motion_config *config, struct bmi2_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
-
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
-
-    /* Variable to define count */
-    uint8_t index = 0;
-
-    /* Variable to set flag */
-    uint8_t feat_found;
-
-    /* Initialize feature configuration for any motion */
-    struct bmi2_feature_config any_mot_config = { 0, 0, 0 };
-
-    /* Copy the feature configuration address to a local pointer */
-    uint16_t *data_p = (uint16_t *) (void *)feat_config;
-
-    /* Search for any-motion feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&any_mot_config, BMI2_ANY_MOTION, dev);
-    if (feat_found)
-    {
-        /* Get the configuration from the page where any-motion feature resides */
-        rslt = bmi2_get_feat_config(any_mot_config.page, feat_config, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Define the offset in bytes for any-motion select */
-            idx = any_mot_config.start_addr;
-
-            /* Get offset in words since all the features are set in words length */
-            idx = idx / 2;
-
-            /* Set duration */
-            *(data_p + idx) = BMI2_SET_BIT_POS0(*(data_p + idx), BMI2_ANY_NO_MOT_DUR, config->duration);
-
-            /* Set x-select */
-            *(data_p + idx) = BMI2_SET_BITS(*(data_p + idx), BMI2_ANY_NO_MOT_X_SEL, config->select_x);
-
-            /* Set y-select */
-            *(data_p + idx) = BMI2_SET_BITS(*(data_p + idx), BMI2_ANY_NO_MOT_Y_SEL, config->select_y);
-
-            /* Set z-select */
-            *(data_p + idx) = BMI2_SET_BITS(*(data_p + idx), BMI2_ANY_NO_MOT_Z_SEL, config->select_z);
-
-            /* Increment offset by 1 word to set threshold and output configuration */
-            idx++;
-
-            /* Set threshold */
-            *(data_p + idx) = BMI2_SET_BIT_POS0(*(data_p + idx), BMI2_ANY_NO_MOT_THRES, config->threshold);
-
-            /* Increment offset by 1 more word to get the total length in words */
-            idx++;
-
-            /* Get total length in bytes to copy from local pointer to the array */
-            idx = (uint8_t)(idx * 2) - any_mot_config.start_addr;
-
-            /* Copy the bytes to be set back to the array */
-            for (index = 0; index < idx; index++)
-            {
-                feat_config[any_mot_config.start_addr +
-                            index] = *((uint8_t *) data_p + any_mot_config.start_addr + index);
-            }
-
-            /* Set the configuration back to the page */
-            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
-        }
-    }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
-
-    return rslt;
-}
-
-/*!
- * @brief This internal API sets no-motion configurations like axes select,
- * duration, threshold and output-configuration.
- */
-static int8_t set_no_motion_config(const struct bmi2_no_motion_config *config, struct bmi2_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
-
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
-
-    /* Variable to define count */
-    uint8_t index = 0;
-
-    /* Variable to set flag */
-    uint8_t feat_found;
-
-    /* Initialize feature configuration for no-motion */
-    struct bmi2_feature_config no_mot_config = { 0, 0, 0 };
-
-    /* Copy the feature configuration address to a local pointer */
-    uint16_t *data_p = (uint16_t *) (void *)feat_config;
-
-    /* Search for no-motion feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&no_mot_config, BMI2_NO_MOTION, dev);
-    if (feat_found)
-    {
-        /* Get the configuration from the page where no-motion feature resides */
-        rslt = bmi2_get_feat_config(no_mot_config.page, feat_config, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Define the offset in bytes for no-motion select */
-            idx = no_mot_config.start_addr;
-
-            /* Get offset in words since all the features are set in words length */
-            idx = idx / 2;
-
-            /* Set duration */
-            *(data_p + idx) = BMI2_SET_BIT_POS0(*(data_p + idx), BMI2_ANY_NO_MOT_DUR, config->duration);
-
-            /* Set x-select */
-            *(data_p + idx) = BMI2_SET_BITS(*(data_p + idx), BMI2_ANY_NO_MOT_X_SEL, config->select_x);
-
-            /* Set y-select */
-            *(data_p + idx) = BMI2_SET_BITS(*(data_p + idx), BMI2_ANY_NO_MOT_Y_SEL, config->select_y);
-
-            /* Set z-select */
-            *(data_p + idx) = BMI2_SET_BITS(*(data_p + idx), BMI2_ANY_NO_MOT_Z_SEL, config->select_z);
-
-            /* Increment offset by 1 word to set threshold and output configuration */
-            idx++;
-
-            /* Set threshold */
-            *(data_p + idx) = BMI2_SET_BIT_POS0(*(data_p + idx), BMI2_ANY_NO_MOT_THRES, config->threshold);
-
-            /* Increment offset by 1 more word to get the total length in words */
-            idx++;
-
-            /* Get total length in bytes to copy from local pointer to the array */
-            idx = (uint8_t)(idx * 2) - no_mot_config.start_addr;
-
-            /* Copy the bytes to be set back to the array */
-            for (index = 0; index < idx; index++)
-            {
-                feat_config[no_mot_config.start_addr +
-                            index] = *((uint8_t *) data_p + no_mot_config.start_addr + index);
-            }
-
-            /* Set the configuration back to the page */
-            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
-        }
-    }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
-
-    return rslt;
-}
-
-/*!
- * @brief This internal API sets sig-motion configurations like block-size,
- * output-configuration and other parameters.
- */
-static int8_t set_sig_motion_config(const struct bmi2_sig_motion_config *config, struct bmi2_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
-
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
-
-    /* Variable to define index */
-    uint8_t index = 0;
-
-    /* Variable to set flag */
-    uint8_t feat_found;
-
-    /* Initialize feature configuration for sig-motion */
-    struct bmi2_feature_config sig_mot_config = { 0, 0, 0 };
-
-    /* Copy the feature configuration address to a local pointer */
-    uint16_t *data_p = (uint16_t *) (void *)feat_config;
-
-    /* Search for sig-motion feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&sig_mot_config, BMI2_SIG_MOTION, dev);
-    if (feat_found)
-    {
-        /* Get the configuration from the page where sig-motion feature resides */
-        rslt = bmi2_get_feat_config(sig_mot_config.page, feat_config, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Define the offset in bytes for sig-motion select */
-            idx = sig_mot_config.start_addr;
-
-            /* Get offset in words since all the features are set in words length */
-            idx = idx / 2;
-
-            /* Set parameter 1 */
-            *(data_p + idx) = BMI2_SET_BIT_POS0(*(data_p + idx), BMI2_SIG_MOT_PARAM_1, config->block_size);
-
-            /* Increment offset by 1 more word to get the total length in words */
-            idx++;
-
-            /* Get total length in bytes to copy from local pointer to the array */
-            idx = (uint8_t)(idx * 2) - sig_mot_config.start_addr;
-
-            /* Copy the bytes to be set back to the array */
-            for (index = 0; index < idx; index++)
-            {
-                feat_config[sig_mot_config.start_addr +
-                            index] = *((uint8_t *) data_p + sig_mot_config.start_addr + index);
-            }
-
-            /* Set the configuration back to the page */
-            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
-        }
-    }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
-
-    return rslt;
-}
-
 /*!
  * @brief This internal API sets step counter parameter configurations.
  */
@@ -3013,762 +2491,115 @@ static int8_t set_step_count_params_config(const uint16_t *step_count_params, st
     return rslt;
 }
 
-/* @brief This internal API sets step counter configurations like water-mark
- * level, reset-counter and output-configuration step detector and activity.
+/*!
+ * @brief This internal API gets step counter parameter configurations.
  */
-static int8_t set_step_config(const struct bmi2_step_config *config, struct bmi2_dev *dev)
+static int8_t get_step_count_params_config(uint16_t *step_count_params, struct bmi2_dev *dev)
 {
     /* Variable to define error */
-    int8_t rslt;
+    int8_t rslt = BMI2_OK;
 
     /* Array to define the feature configuration */
     uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
 
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
-
-    /* Variable to define index */
-    uint8_t index = 0;
-
     /* Variable to set flag */
     uint8_t feat_found;
 
-    /* Initialize feature configuration for step counter 4 */
-    struct bmi2_feature_config step_count_config = { 0, 0, 0 };
-
-    /* Copy the feature configuration address to a local pointer */
-    uint16_t *data_p = (uint16_t *) (void *)feat_config;
+    /* Variable to define LSB */
+    uint16_t lsb = 0;
 
-    /* Search for step counter feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&step_count_config, BMI2_STEP_COUNTER, dev);
-    if (feat_found)
-    {
-        /* Get the configuration from the page where step counter resides */
-        rslt = bmi2_get_feat_config(step_count_config.page, feat_config, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Define the offset in bytes */
-            idx = step_count_config.start_addr;
+    /* Variable to define MSB */
+    uint16_t msb = 0;
 
-            /* Get offset in words since all the features are set in words length */
-            idx = idx / 2;
+    /* Variable to define a word */
+    uint16_t lsb_msb = 0;
 
-            /* Set water-mark level */
-            *(data_p + idx) = BMI2_SET_BIT_POS0(*(data_p + idx), BMI2_STEP_COUNT_WM_LEVEL, config->watermark_level);
+    /* Initialize feature configuration for step counter 1 */
+    struct bmi2_feature_config step_params_config = { 0, 0, 0 };
 
-            /* Set reset-counter */
-            *(data_p + idx) = BMI2_SET_BITS(*(data_p + idx), BMI2_STEP_COUNT_RST_CNT, config->reset_counter);
+    /* Variable to index the page number */
+    uint8_t page_idx;
 
-            /* Increment offset by 1 word  to set output
-             * configuration of step detector and step activity
-             */
-            idx++;
+    /* Variable to define the start page */
+    uint8_t start_page;
 
-            /* Get total length in bytes to copy from local pointer to the array */
-            idx = (uint8_t)(idx * 2) - step_count_config.start_addr;
+    /* Variable to define start address of the parameters */
+    uint8_t start_addr;
 
-            /* Copy the bytes to be set back to the array */
-            for (index = 0; index < idx; index++)
-            {
-                feat_config[step_count_config.start_addr +
-                            index] = *((uint8_t *) data_p + step_count_config.start_addr + index);
-            }
+    /* Variable to define number of bytes */
+    uint8_t n_bytes = (BMI2_STEP_CNT_N_PARAMS * 2);
 
-            /* Set the configuration back to the page */
-            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
-        }
-    }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
+    /* Variable to store number of pages */
+    uint8_t n_pages = (n_bytes / 16);
 
-    return rslt;
-}
+    /* Variable to define the end page */
+    uint8_t end_page;
 
-/*!
- * @brief This internal API sets wrist gesture configurations like wearable-arm,
- * and output-configuration.
- */
-static int8_t set_wrist_gest_config(const struct bmi2_wrist_gest_config *config, struct bmi2_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt;
+    /* Variable to define the remaining bytes to be read */
+    uint8_t remain_len;
 
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
+    /* Variable to define the maximum words to be read in a page */
+    uint8_t max_len = BMI2_FEAT_SIZE_IN_BYTES;
 
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
+    /* Variable index bytes in a page */
+    uint8_t page_byte_idx;
 
-    /* Variable to define index */
-    uint8_t index = 0;
+    /* Variable to index the parameters */
+    uint8_t param_idx = 0;
 
-    /* Variable to set flag */
-    uint8_t feat_found;
+    /* Search for step counter parameter feature and extract its configuration details */
+    feat_found = bmi2_extract_input_feat_config(&step_params_config, BMI2_STEP_COUNTER_PARAMS, dev);
+    if (feat_found)
+    {
+        /* Get the start page for the step counter parameters */
+        start_page = step_params_config.page;
 
-    /* Initialize feature configuration for wrist gesture */
-    struct bmi2_feature_config wrist_gest_config = { 0, 0, 0 };
-
-    /* Copy the feature configuration address to a local pointer */
-    uint16_t *data_p = (uint16_t *) (void *)feat_config;
-
-    /* Search for wrist gesture feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&wrist_gest_config, BMI2_WRIST_GESTURE, dev);
-    if (feat_found)
-    {
-        /* Get the configuration from the page where wrist gesture feature resides */
-        rslt = bmi2_get_feat_config(wrist_gest_config.page, feat_config, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Define the offset in bytes for gesture select */
-            idx = wrist_gest_config.start_addr;
-
-            /* Get offset in words since all the features are set in words length */
-            idx = idx / 2;
-
-            /* Set wearable arm */
-            *(data_p + idx) = BMI2_SET_BITS(*(data_p + idx), BMI2_WRIST_GEST_WEAR_ARM, config->wearable_arm);
-
-            /* Increment offset by 1 more word to set minimum tilt angle (min_flick_peak) */
-            idx++;
-            *(data_p + idx) = config->min_flick_peak;
-
-            /* Increment offset by 1 more word to set min_flick_samples */
-            idx++;
-            *(data_p + idx) = config->min_flick_samples;
-
-            /* Increment offset by 1 more word to set max time within gesture moment has to be completed */
-            idx++;
-            *(data_p + idx) = config->max_duration;
-
-            /* Increment offset by 1 more word to get the total length in words */
-            idx++;
-
-            /* Get total length in bytes to copy from local pointer to the array */
-            idx = (uint8_t)(idx * 2) - wrist_gest_config.start_addr;
-
-            /* Copy the bytes to be set back to the array */
-            for (index = 0; index < idx; index++)
-            {
-                feat_config[wrist_gest_config.start_addr +
-                            index] = *((uint8_t *) data_p + wrist_gest_config.start_addr + index);
-            }
-
-            /* Set the configuration back to the page */
-            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
-        }
-    }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
-
-    return rslt;
-}
-
-/*!
- * @brief This internal API sets wrist wear wake-up configurations like
- * output-configuration.
- */
-static int8_t set_wrist_wear_wake_up_config(const struct bmi2_wrist_wear_wake_up_config *config, struct bmi2_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
-
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
-
-    /* Variable to define index */
-    uint8_t index = 0;
-
-    /* Variable to set flag */
-    uint8_t feat_found;
-
-    /* Initialize feature configuration for wrist wear wake-up */
-    struct bmi2_feature_config wrist_wake_up_config = { 0, 0, 0 };
-
-    /* Copy the feature configuration address to a local pointer */
-    uint16_t *data_p = (uint16_t *) (void *)feat_config;
-
-    /* Search for wrist wear wake-up feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&wrist_wake_up_config, BMI2_WRIST_WEAR_WAKE_UP, dev);
-    if (feat_found)
-    {
-        /* Get the configuration from the page where wrist wear wake-up feature resides */
-        rslt = bmi2_get_feat_config(wrist_wake_up_config.page, feat_config, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Define the offset in bytes for wrist wear wake-up select */
-            idx = wrist_wake_up_config.start_addr;
-
-            /* Get offset in words since all the features are set in words length */
-            idx = idx / 2;
-
-            /* Increment offset by 1 more word to set min_angle_focus */
-            idx++;
-
-            *(data_p + idx) = config->min_angle_focus;
-
-            /* Increment offset by 1 more word to set min_angle_nonfocus */
-            idx++;
-            *(data_p + idx) = config->min_angle_nonfocus;
-
-            /* Increment offset by 1 more word to set max_tilt_lr */
-            idx++;
-            *(data_p + idx) = config->max_tilt_lr;
-
-            /* Increment offset by 1 more word to set max_tilt_ll */
-            idx++;
-            *(data_p + idx) = config->max_tilt_ll;
-
-            /* Increment offset by 1 more word to set max_tilt_pd */
-            idx++;
-            *(data_p + idx) = config->max_tilt_pd;
-
-            /* Increment offset by 1 more word to set max_tilt_pu */
-            idx++;
-            *(data_p + idx) = config->max_tilt_pu;
-
-            /* Increment offset by 1 more word to get the total length in words */
-            idx++;
-
-            /* Get total length in bytes to copy from local pointer to the array */
-            idx = (uint8_t)(idx * 2) - wrist_wake_up_config.start_addr;
-
-            /* Copy the bytes to be set back to the array */
-            for (index = 0; index < idx; index++)
-            {
-                feat_config[wrist_wake_up_config.start_addr +
-                            index] = *((uint8_t *) data_p + wrist_wake_up_config.start_addr + index);
-            }
-
-            /* Set the configuration back to the page */
-            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
-        }
-    }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
-
-    return rslt;
-}
-
-/*!
- * @brief This internal API gets any-motion configurations like axes select,
- * duration, threshold and output-configuration.
- */
-static int8_t get_any_motion_config(struct bmi2_any_motion_config *config, struct bmi2_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
-
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
-
-    /* Variable to define LSB */
-    uint16_t lsb;
-
-    /* Variable to define MSB */
-    uint16_t msb;
-
-    /* Variable to define a word */
-    uint16_t lsb_msb;
-
-    /* Variable to set flag */
-    uint8_t feat_found;
-
-    /* Initialize feature configuration for any-motion */
-    struct bmi2_feature_config any_mot_config = { 0, 0, 0 };
-
-    /* Search for any-motion feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&any_mot_config, BMI2_ANY_MOTION, dev);
-    if (feat_found)
-    {
-        /* Get the configuration from the page where any-motion feature resides */
-        rslt = bmi2_get_feat_config(any_mot_config.page, feat_config, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Define the offset for feature enable for any-motion */
-            idx = any_mot_config.start_addr;
-
-            /* Get word to calculate duration, x, y and z select */
-            lsb = (uint16_t) feat_config[idx++];
-            msb = ((uint16_t) feat_config[idx++] << 8);
-            lsb_msb = lsb | msb;
-
-            /* Get duration */
-            config->duration = lsb_msb & BMI2_ANY_NO_MOT_DUR_MASK;
-
-            /* Get x-select */
-            config->select_x = (lsb_msb & BMI2_ANY_NO_MOT_X_SEL_MASK) >> BMI2_ANY_NO_MOT_X_SEL_POS;
-
-            /* Get y-select */
-            config->select_y = (lsb_msb & BMI2_ANY_NO_MOT_Y_SEL_MASK) >> BMI2_ANY_NO_MOT_Y_SEL_POS;
-
-            /* Get z-select */
-            config->select_z = (lsb_msb & BMI2_ANY_NO_MOT_Z_SEL_MASK) >> BMI2_ANY_NO_MOT_Z_SEL_POS;
-
-            /* Get word to calculate threshold, output configuration from the same word */
-            lsb = (uint16_t) feat_config[idx++];
-            msb = ((uint16_t) feat_config[idx++] << 8);
-            lsb_msb = lsb | msb;
-
-            /* Get threshold */
-            config->threshold = lsb_msb & BMI2_ANY_NO_MOT_THRES_MASK;
-        }
-    }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
-
-    return rslt;
-}
-
-/*!
- * @brief This internal API gets no-motion configurations like axes select,
- * duration, threshold and output-configuration.
- */
-static int8_t get_no_motion_config(struct bmi2_no_motion_config *config, struct bmi2_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
-
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
-
-    /* Variable to define LSB */
-    uint16_t lsb = 0;
-
-    /* Variable to define MSB */
-    uint16_t msb = 0;
-
-    /* Variable to define a word */
-    uint16_t lsb_msb = 0;
-
-    /* Variable to set flag */
-    uint8_t feat_found;
-
-    /* Initialize feature configuration for no-motion */
-    struct bmi2_feature_config no_mot_config = { 0, 0, 0 };
-
-    /* Search for no-motion feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&no_mot_config, BMI2_NO_MOTION, dev);
-    if (feat_found)
-    {
-        /* Get the configuration from the page where no-motion feature resides */
-        rslt = bmi2_get_feat_config(no_mot_config.page, feat_config, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Define the offset for feature enable for no-motion */
-            idx = no_mot_config.start_addr;
-
-            /* Get word to calculate duration, x, y and z select */
-            lsb = (uint16_t) feat_config[idx++];
-            msb = ((uint16_t) feat_config[idx++] << 8);
-            lsb_msb = lsb | msb;
-
-            /* Get duration */
-            config->duration = lsb_msb & BMI2_ANY_NO_MOT_DUR_MASK;
-
-            /* Get x-select */
-            config->select_x = (lsb_msb & BMI2_ANY_NO_MOT_X_SEL_MASK) >> BMI2_ANY_NO_MOT_X_SEL_POS;
-
-            /* Get y-select */
-            config->select_y = (lsb_msb & BMI2_ANY_NO_MOT_Y_SEL_MASK) >> BMI2_ANY_NO_MOT_Y_SEL_POS;
-
-            /* Get z-select */
-            config->select_z = (lsb_msb & BMI2_ANY_NO_MOT_Z_SEL_MASK) >> BMI2_ANY_NO_MOT_Z_SEL_POS;
-
-            /* Get word to calculate threshold, output configuration from the same word */
-            lsb = (uint16_t) feat_config[idx++];
-            msb = ((uint16_t) feat_config[idx++] << 8);
-            lsb_msb = lsb | msb;
-
-            /* Get threshold */
-            config->threshold = lsb_msb & BMI2_ANY_NO_MOT_THRES_MASK;
-        }
-    }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
-
-    return rslt;
-}
-
-/*!
- * @brief This internal API gets sig-motion configurations like block-size,
- * output-configuration and other parameters.
- */
-static int8_t get_sig_motion_config(struct bmi2_sig_motion_config *config, struct bmi2_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
-
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
-
-    /* Variable to define LSB */
-    uint16_t lsb = 0;
-
-    /* Variable to define MSB */
-    uint16_t msb = 0;
-
-    /* Variable to define a word */
-    uint16_t lsb_msb = 0;
-
-    /* Variable to set flag */
-    uint8_t feat_found;
-
-    /* Initialize feature configuration sig-motion */
-    struct bmi2_feature_config sig_mot_config = { 0, 0, 0 };
-
-    /* Search for sig-motion feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&sig_mot_config, BMI2_SIG_MOTION, dev);
-    if (feat_found)
-    {
-        /* Get the configuration from the page where sig-motion feature resides */
-        rslt = bmi2_get_feat_config(sig_mot_config.page, feat_config, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Define the offset for feature enable for sig-motion */
-            idx = sig_mot_config.start_addr;
-
-            /* Get word to calculate parameter 1 */
-            lsb = (uint16_t) feat_config[idx++];
-            msb = ((uint16_t) feat_config[idx++] << 8);
-            lsb_msb = lsb | msb;
-
-            /* Get parameter 1  */
-            config->block_size = lsb_msb & BMI2_SIG_MOT_PARAM_1_MASK;
-        }
-    }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
-
-    return rslt;
-}
-
-/*!
- * @brief This internal API gets step counter parameter configurations.
- */
-static int8_t get_step_count_params_config(uint16_t *step_count_params, struct bmi2_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt = BMI2_OK;
-
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
-
-    /* Variable to set flag */
-    uint8_t feat_found;
-
-    /* Variable to define LSB */
-    uint16_t lsb = 0;
-
-    /* Variable to define MSB */
-    uint16_t msb = 0;
-
-    /* Variable to define a word */
-    uint16_t lsb_msb = 0;
-
-    /* Initialize feature configuration for step counter 1 */
-    struct bmi2_feature_config step_params_config = { 0, 0, 0 };
-
-    /* Variable to index the page number */
-    uint8_t page_idx;
-
-    /* Variable to define the start page */
-    uint8_t start_page;
-
-    /* Variable to define start address of the parameters */
-    uint8_t start_addr;
-
-    /* Variable to define number of bytes */
-    uint8_t n_bytes = (BMI2_STEP_CNT_N_PARAMS * 2);
-
-    /* Variable to store number of pages */
-    uint8_t n_pages = (n_bytes / 16);
-
-    /* Variable to define the end page */
-    uint8_t end_page;
-
-    /* Variable to define the remaining bytes to be read */
-    uint8_t remain_len;
-
-    /* Variable to define the maximum words to be read in a page */
-    uint8_t max_len = BMI2_FEAT_SIZE_IN_BYTES;
-
-    /* Variable index bytes in a page */
-    uint8_t page_byte_idx;
-
-    /* Variable to index the parameters */
-    uint8_t param_idx = 0;
-
-    /* Search for step counter parameter feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&step_params_config, BMI2_STEP_COUNTER_PARAMS, dev);
-    if (feat_found)
-    {
-        /* Get the start page for the step counter parameters */
-        start_page = step_params_config.page;
-
-        /* Get the end page for the step counter parameters */
-        end_page = start_page + n_pages;
-
-        /* Get the start address for the step counter parameters */
-        start_addr = step_params_config.start_addr;
-
-        /* Get the remaining length of bytes to be read */
-        remain_len = (uint8_t)((n_bytes - (n_pages * 16)) + start_addr);
-        for (page_idx = start_page; page_idx <= end_page; page_idx++)
-        {
-            /* Get the configuration from the respective page */
-            rslt = bmi2_get_feat_config(page_idx, feat_config, dev);
-            if (rslt == BMI2_OK)
-            {
-                /* Start from address 0x00 when switched to next page */
-                if (page_idx > start_page)
-                {
-                    start_addr = 0;
-                }
-
-                /* Remaining number of bytes to be read in the page  */
-                if (page_idx == end_page)
-                {
-                    max_len = remain_len;
-                }
-
-                /* Get the offset */
-                page_byte_idx = start_addr;
-                while (page_byte_idx < max_len)
-                {
-                    /* Get word to calculate the parameter*/
-                    lsb = (uint16_t) feat_config[page_byte_idx++];
-                    if (page_byte_idx < max_len)
-                    {
-                        msb = ((uint16_t) feat_config[page_byte_idx++] << 8);
-                    }
-
-                    lsb_msb = lsb | msb;
-
-                    /* Get parameters 1 to 25 */
-                    step_count_params[param_idx] = lsb_msb & BMI2_STEP_COUNT_PARAMS_MASK;
-
-                    /* Increment to next parameter */
-                    param_idx++;
-                }
-            }
-        }
-    }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
-
-    return rslt;
-}
-
-/*!
- * @brief This internal API gets step counter/detector/activity configurations.
- */
-static int8_t get_step_config(struct bmi2_step_config *config, struct bmi2_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
-
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
-
-    /* Variable to define LSB */
-    uint16_t lsb = 0;
-
-    /* Variable to define MSB */
-    uint16_t msb = 0;
-
-    /* Variable to define a word */
-    uint16_t lsb_msb = 0;
-
-    /* Variable to set flag */
-    uint8_t feat_found;
-
-    /* Initialize feature configuration for step counter */
-    struct bmi2_feature_config step_count_config = { 0, 0, 0 };
-
-    /* Search for step counter 4 feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&step_count_config, BMI2_STEP_COUNTER, dev);
-    if (feat_found)
-    {
-        /* Get the configuration from the page where step counter 4 parameter resides */
-        rslt = bmi2_get_feat_config(step_count_config.page, feat_config, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Define the offset for feature enable for step counter/detector/activity */
-            idx = step_count_config.start_addr;
-
-            /* Get word to calculate water-mark level and reset counter */
-            lsb = (uint16_t) feat_config[idx++];
-            msb = ((uint16_t) feat_config[idx++] << 8);
-            lsb_msb = lsb | msb;
-
-            /* Get water-mark level */
-            config->watermark_level = lsb_msb & BMI2_STEP_COUNT_WM_LEVEL_MASK;
-
-            /* Get reset counter */
-            config->reset_counter = (lsb_msb & BMI2_STEP_COUNT_RST_CNT_MASK) >> BMI2_STEP_COUNT_RST_CNT_POS;
-        }
-    }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
-
-    return rslt;
-}
-
-/*!
- * @brief This internal API gets wrist gesture configurations like wearable-arm,
- * and output-configuration.
- */
-static int8_t get_wrist_gest_config(struct bmi2_wrist_gest_config *config, struct bmi2_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
-
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
-
-    /* Variable to set flag */
-    uint8_t feat_found;
-
-    /* Initialize feature configuration for wrist gesture */
-    struct bmi2_feature_config wrist_gest_config = { 0, 0, 0 };
-
-    /* Copy the feature configuration address to a local pointer */
-    uint16_t *data_p = (uint16_t *) (void *)feat_config;
-
-    /* Search for wrist gesture feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&wrist_gest_config, BMI2_WRIST_GESTURE, dev);
-    if (feat_found)
-    {
-        /* Get the configuration from the page where wrist gesture feature  resides */
-        rslt = bmi2_get_feat_config(wrist_gest_config.page, feat_config, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Define the offset in bytes for wrist gesture select */
-            idx = wrist_gest_config.start_addr;
-
-            /* Get offset in words since all the features are set in words length */
-            idx = idx / 2;
-
-            /* Get wearable arm */
-            config->wearable_arm = (*(data_p + idx) & BMI2_WRIST_GEST_WEAR_ARM_MASK) >> BMI2_WRIST_GEST_WEAR_ARM_POS;
-
-            /* Increment the offset by 1 word to get min_flick_peak */
-            idx++;
-            config->min_flick_peak = *(data_p + idx);
-
-            /* Increment the offset by 1 word to get min_flick_samples */
-            idx++;
-            config->min_flick_samples = *(data_p + idx);
-
-            /* Increment the offset by 1 word to get max_duration */
-            idx++;
-            config->max_duration = *(data_p + idx);
-        }
-    }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
-
-    return rslt;
-}
-
-/*!
- * @brief This internal API gets wrist wear wake-up configurations like
- * output-configuration.
- */
-static int8_t get_wrist_wear_wake_up_config(struct bmi2_wrist_wear_wake_up_config *config, struct bmi2_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
-
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
-
-    /* Variable to set flag */
-    uint8_t feat_found;
-
-    /* Initialize feature configuration for wrist wear wake-up */
-    struct bmi2_feature_config wrist_wake_up_config = { 0, 0, 0 };
+        /* Get the end page for the step counter parameters */
+        end_page = start_page + n_pages;
 
-    /* Copy the feature configuration address to a local pointer */
-    uint16_t *data_p = (uint16_t *) (void *)feat_config;
+        /* Get the start address for the step counter parameters */
+        start_addr = step_params_config.start_addr;
 
-    /* Search for wrist wear wake-up feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&wrist_wake_up_config, BMI2_WRIST_WEAR_WAKE_UP, dev);
-    if (feat_found)
-    {
-        /* Get the configuration from the page where wrist wear wake-up feature  resides */
-        rslt = bmi2_get_feat_config(wrist_wake_up_config.page, feat_config, dev);
-        if (rslt == BMI2_OK)
+        /* Get the remaining length of bytes to be read */
+        remain_len = (uint8_t)((n_bytes - (n_pages * 16)) + start_addr);
+        for (page_idx = start_page; page_idx <= end_page; page_idx++)
         {
-            /* Define the offset in bytes for wrist wear wake-up select */
-            idx = wrist_wake_up_config.start_addr;
-
-            /* Get offset in words since all the features are set in words length */
-            idx = idx / 2;
-
-            /* Increment the offset value by 1 word to get min_angle_focus */
-            idx++;
-
-            config->min_angle_focus = *(data_p + idx);
+            /* Get the configuration from the respective page */
+            rslt = bmi2_get_feat_config(page_idx, feat_config, dev);
+            if (rslt == BMI2_OK)
+            {
+                /* Start from address 0x00 when switched to next page */
+                if (page_idx > start_page)
+                {
+                    start_addr = 0;
+                }
 
-            /* Increment the offset value by 1 word to get min_angle_nonfocus */
-            idx++;
-            config->min_angle_nonfocus = *(data_p + idx);
+                /* Remaining number of bytes to be read in the page  */
+                if (page_idx == end_page)
+                {
+                    max_len = remain_len;
+                }
 
-            /* Increment the offset value by 1 word to get max_tilt_lr */
-            idx++;
-            config->max_tilt_lr = *(data_p + idx);
+                /* Get the offset */
+                page_byte_idx = start_addr;
+                while (page_byte_idx < max_len)
+                {
+                    /* Get word to calculate the parameter*/
+                    lsb = (uint16_t) feat_config[page_byte_idx++];
+                    if (page_byte_idx < max_len)
+                    {
+                        msb = ((uint16_t) feat_config[page_byte_idx++] << 8);
+                    }
 
-            /* Increment the offset value by 1 word to get max_tilt_ll */
-            idx++;
-            config->max_tilt_ll = *(data_p + idx);
+                    lsb_msb = lsb | msb;
 
-            /* Increment the offset value by 1 word to get max_tilt_pd */
-            idx++;
-            config->max_tilt_pd = *(data_p + idx);
+                    /* Get parameters 1 to 25 */
+                    step_count_params[param_idx] = lsb_msb & BMI2_STEP_COUNT_PARAMS_MASK;
 
-            /* Increment the offset value by 1 word to get max_tilt_pu */
-            idx++;
-            config->max_tilt_pu = *(data_p + idx);
+                    /* Increment to next parameter */
+                    param_idx++;
+                }
+            }
         }
     }
     else
@@ -3780,150 +2611,48 @@ static int8_t get_wrist_wear_wake_up_config(struct bmi2_wrist_wear_wake_up_confi
 }
 
 /*!
- * @brief This internal API gets the output values of the wrist gesture.
+ * @brief This internal API decodes the output values of the wrist gesture.
  */
-static int8_t get_wrist_gest_status(uint8_t *wrist_gest, struct bmi2_dev *dev)
+static void get_wrist_gest_status(uint8_t *wrist_gest, const uint8_t *feat_config, uint8_t idx)
 {
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
-
-    /* Variables to define index */
-    uint8_t idx = 0;
-
-    /* Variable to set flag */
-    uint8_t feat_found;
-
-    /* Initialize feature output for wrist gesture */
-    struct bmi2_feature_config wrist_gest_out_config = { 0, 0, 0 };
-
-    /* Search for wrist gesture feature and extract its configuration details */
-    feat_found = extract_output_feat_config(&wrist_gest_out_config, BMI2_WRIST_GESTURE, dev);
-    if (feat_found)
-    {
-        /* Get the feature output configuration for wrist gesture */
-        rslt = bmi2_get_feat_config(wrist_gest_out_config.page, feat_config, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Define the offset in bytes for wrist gesture output */
-            idx = wrist_gest_out_config.start_addr;
-
-            /* Get the wrist gesture output */
-            *wrist_gest = feat_config[idx];
-        }
-    }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
-
-    return rslt;
+    /* Get the wrist gesture output */
+    *wrist_gest = feat_config[idx];
 }
 
 /*!
- * @brief This internal API gets the output values of step counter.
+ * @brief This internal API decodes the output values of step counter.
  */
-static int8_t get_step_counter_output(uint32_t *step_count, struct bmi2_dev *dev)
+static void get_step_counter_output(uint32_t *step_count, const uint8_t *feat_config, uint8_t idx)
 {
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
-
-    /* Variables to define index */
-    uint8_t idx = 0;
-
-    /* Variable to set flag */
-    uint8_t feat_found;
-
-    /* Initialize feature output for step counter */
-    struct bmi2_feature_config step_cnt_out_config = { 0, 0, 0 };
-
-    /* Search for step counter output feature and extract its configuration details */
-    feat_found = extract_output_feat_config(&step_cnt_out_config, BMI2_STEP_COUNTER, dev);
-    if (feat_found)
-    {
-        /* Get the feature output configuration for step-counter */
-        rslt = bmi2_get_feat_config(step_cnt_out_config.page, feat_config, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Define the offset in bytes for step counter output */
-            idx = step_cnt_out_config.start_addr;
-
-            /* Get the step counter output in 4 bytes */
-            *step_count = (uint32_t) feat_config[idx++];
-            *step_count |= ((uint32_t) feat_config[idx++] << 8);
-            *step_count |= ((uint32_t) feat_config[idx++] << 16);
-            *step_count |= ((uint32_t) feat_config[idx++] << 24);
-        }
-    }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
-
-    return rslt;
+    /* Get the step counter output in 4 bytes */
+    *step_count = (uint32_t) feat_config[idx++];
+    *step_count |= ((uint32_t) feat_config[idx++] << 8);
+    *step_count |= ((uint32_t) feat_config[idx++] << 16);
+    *step_count |= ((uint32_t) feat_config[idx++] << 24);
 }
 
 /*!
- * @brief This internal API gets the error status related to NVM.
+ * @brief This internal API decodes the error status related to NVM.
  */
-static int8_t get_nvm_error_status(struct bmi2_nvm_err_status *nvm_err_stat, struct bmi2_dev *dev)
+static void get_nvm_error_status(struct bmi2_nvm_err_status *nvm_err_stat, const uint8_t *feat_config, uint8_t idx)
 {
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
-
-    /* Variables to define index */
-    uint8_t idx = 0;
-
-    /* Variable to set flag */
-    uint8_t feat_found;
-
-    /* Initialize feature output for NVM error status */
-    struct bmi2_feature_config nvm_err_cfg = { 0, 0, 0 };
-
-    /* Search for NVM error status feature and extract its configuration details */
-    feat_found = extract_output_feat_config(&nvm_err_cfg, BMI2_NVM_STATUS, dev);
-    if (feat_found)
-    {
-        /* Get the feature output configuration for NVM error status */
-        rslt = bmi2_get_feat_config(nvm_err_cfg.page, feat_config, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Define the offset in bytes for NVM error status */
-            idx = nvm_err_cfg.start_addr;
-
-            /* Increment index to get the error status */
-            idx++;
+    /* Increment index to get the error status */
+    idx++;
 
-            /* Error when NVM load action fails */
-            nvm_err_stat->load_error = BMI2_GET_BIT_POS0(feat_config[idx], BMI2_NVM_LOAD_ERR_STATUS);
+    /* Error when NVM load action fails */
+    nvm_err_stat->load_error = BMI2_GET_BIT_POS0(feat_config[idx], BMI2_NVM_LOAD_ERR_STATUS);
 
-            /* Error when NVM program action fails */
-            nvm_err_stat->prog_error = BMI2_GET_BITS(feat_config[idx], BMI2_NVM_PROG_ERR_STATUS);
+    /* Error when NVM program action fails */
+    nvm_err_stat->prog_error = BMI2_GET_BITS(feat_config[idx], BMI2_NVM_PROG_ERR_STATUS);
 
-            /* Error when NVM erase action fails */
-            nvm_err_stat->erase_error = BMI2_GET_BITS(feat_config[idx], BMI2_NVM_ERASE_ERR_STATUS);
+    /* Error when NVM erase action fails */
+    nvm_err_stat->erase_error = BMI2_GET_BITS(feat_config[idx], BMI2_NVM_ERASE_ERR_STATUS);
 
-            /* Error when NVM program limit is exceeded */
-            nvm_err_stat->exceed_error = BMI2_GET_BITS(feat_config[idx], BMI2_NVM_END_EXCEED_STATUS);
-
-            /* Error when NVM privilege mode is not acquired */
-            nvm_err_stat->privil_error = BMI2_GET_BITS(feat_config[idx], BMI2_NVM_PRIV_ERR_STATUS);
-        }
-    }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
+    /* Error when NVM program limit is exceeded */
+    nvm_err_stat->exceed_error = BMI2_GET_BITS(feat_config[idx], BMI2_NVM_END_EXCEED_STATUS);
 
-    return rslt;
+    /* Error when NVM privilege mode is not acquired */
+    nvm_err_stat->privil_error = BMI2_GET_BITS(feat_config[idx], BMI2_NVM_PRIV_ERR_STATUS);
 }
 
 /*!
@@ -3990,98 +2719,95 @@ static int8_t get_user_gain_upd_status(uint8_t *status, struct bmi2_dev *dev)
 }
 
 /*!
- * @brief This internal API gets the output values of step activity.
+ * @brief This internal API decodes the output values of step activity.
  */
-static int8_t get_step_activity_output(uint8_t *step_act, struct bmi2_dev *dev)
+static void get_step_activity_output(uint8_t *step_act, const uint8_t *feat_config, uint8_t idx)
 {
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
-
-    /* Variables to define index */
-    uint8_t idx = 0;
-
-    /* Variable to set flag */
-    uint8_t feat_found;
+    /* Get the step activity output */
+    *step_act = feat_config[idx];
+}
 
-    /* Initialize feature output for step activity */
-    struct bmi2_feature_config step_act_out_config = { 0, 0, 0 };
+/*!
+ * @brief This internal API decodes the error status related to virtual frames.
+ */
+static void get_vfrm_error_status(struct bmi2_vfrm_err_status *vfrm_err_stat, const uint8_t *feat_config, uint8_t idx)
+{
+    /* Increment index to get the error status */
+    idx++;
 
-    /* Search for step activity output feature and extract its configuration details */
-    feat_found = extract_output_feat_config(&step_act_out_config, BMI2_STEP_ACTIVITY, dev);
-    if (feat_found)
-    {
-        /* Get the feature output configuration for step-activity */
-        rslt = bmi2_get_feat_config(step_act_out_config.page, feat_config, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Define the offset in bytes for step activity output */
-            idx = step_act_out_config.start_addr;
+    /* Internal error while acquiring lock for FIFO */
+    vfrm_err_stat->lock_error = BMI2_GET_BITS(feat_config[idx], BMI2_VFRM_LOCK_ERR_STATUS);
 
-            /* Get the step activity output */
-            *step_act = feat_config[idx];
-        }
-    }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
+    /* Internal error while writing byte into FIFO */
+    vfrm_err_stat->write_error = BMI2_GET_BITS(feat_config[idx], BMI2_VFRM_WRITE_ERR_STATUS);
 
-    return rslt;
+    /* Internal error while writing into FIFO */
+    vfrm_err_stat->fatal_error = BMI2_GET_BITS(feat_config[idx], BMI2_VFRM_FATAL_ERR_STATUS);
 }
 
 /*!
- * @brief This internal API gets the error status related to virtual frames.
+ * @brief This internal API decodes the outputs of all requested features
+ * residing in a feature page from its image.
  */
-static int8_t get_vfrm_error_status(struct bmi2_vfrm_err_status *vfrm_err_stat, struct bmi2_dev *dev)
+static void decode_page_feat_outputs(struct bmi2_feat_sensor_data *feature_data,
+                                     uint8_t n_sens,
+                                     uint8_t page,
+                                     const uint8_t *feat_config,
+                                     const struct bmi2_dev *dev)
 {
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
-
-    /* Variables to define index */
-    uint8_t idx = 0;
-
-    /* Variable to set flag */
-    uint8_t feat_found;
+    /* Variable to define loop */
+    uint8_t loop;
 
-    /* Initialize feature output for VFRM error status */
-    struct bmi2_feature_config vfrm_err_cfg = { 0, 0, 0 };
+    /* Output configuration of the feature */
+    struct bmi2_feature_config out_config = { 0, 0, 0 };
 
-    /* Search for VFRM error status feature and extract its configuration details */
-    feat_found = extract_output_feat_config(&vfrm_err_cfg, BMI2_VFRM_STATUS, dev);
-    if (feat_found)
+    for (loop = 0; loop < n_sens; loop++)
     {
-        /* Get the feature output configuration for VFRM error status */
-        rslt = bmi2_get_feat_config(vfrm_err_cfg.page, feat_config, dev);
-        if (rslt == BMI2_OK)
+        /* Only the outputs residing in this page */
+        if (extract_output_feat_config(&out_config, feature_data[loop].type, dev) && (out_config.page == page))
         {
-            /* Define the offset in bytes for VFRM error status */
-            idx = vfrm_err_cfg.start_addr;
+            switch (feature_data[loop].type)
+            {
+                case BMI2_STEP_COUNTER:
+
+                    /* Get step counter output */
+                    get_step_counter_output(&feature_data[loop].sens_data.step_counter_output,
+                                            feat_config,
+                                            out_config.start_addr);
+                    break;
+                case BMI2_STEP_ACTIVITY:
 
-            /* Increment index to get the error status */
-            idx++;
+                    /* Get step activity output */
+                    get_step_activity_output(&feature_data[loop].sens_data.activity_output,
+                                             feat_config,
+                                             out_config.start_addr);
+                    break;
+                case BMI2_NVM_STATUS:
+
+                    /* Get NVM error status  */
+                    get_nvm_error_status(&feature_data[loop].sens_data.nvm_status, feat_config, out_config.start_addr);
+                    break;
+                case BMI2_VFRM_STATUS:
 
-            /* Internal error while acquiring lock for FIFO */
-            vfrm_err_stat->lock_error = BMI2_GET_BITS(feat_config[idx], BMI2_VFRM_LOCK_ERR_STATUS);
+                    /* Get VFRM error status  */
+                    get_vfrm_error_status(&feature_data[loop].sens_data.vfrm_status,
+                                          feat_config,
+                                          out_config.start_addr);
+                    break;
+                case BMI2_WRIST_GESTURE:
 
-            /* Internal error while writing byte into FIFO */
-            vfrm_err_stat->write_error = BMI2_GET_BITS(feat_config[idx], BMI2_VFRM_WRITE_ERR_STATUS);
+                    /* Get wrist gesture status  */
+                    get_wrist_gest_status(&feature_data[loop].sens_data.wrist_gesture_output,
+                                          feat_config,
+                                          out_config.start_addr);
+                    break;
+                default:
 
-            /* Internal error while writing into FIFO */
-            vfrm_err_stat->fatal_error = BMI2_GET_BITS(feat_config[idx], BMI2_VFRM_FATAL_ERR_STATUS);
+                    /* Gyroscope user gain and cross sensitivity are read through bmi2_get_feature_data */
+                    break;
+            }
         }
     }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
-
-    return rslt;
 }
 
 /*!
@@ -4145,45 +2871,14 @@ static int8_t set_feat_config(const struct bmi2_sens_config *sens_cfg, uint8_t l
     /* Variable to define error */
     int8_t rslt;
 
+    /* Features described by bmi270_feat_enc are set by bmi2_set_feat_config_batch */
     switch (sens_cfg[loop].type)
     {
-        /* Set any motion configuration */
-        case BMI2_ANY_MOTION:
-            rslt = set_any_motion_config(&sens_cfg[loop].cfg.any_motion, dev);
-            break;
-
-        /* Set no motion configuration */
-        case BMI2_NO_MOTION:
-            rslt = set_no_motion_config(&sens_cfg[loop].cfg.no_motion, dev);
-            break;
-
-        /* Set sig-motion configuration */
-        case BMI2_SIG_MOTION:
-            rslt = set_sig_motion_config(&sens_cfg[loop].cfg.sig_motion, dev);
-            break;
-
         /* Set the step counter parameters */
         case BMI2_STEP_COUNTER_PARAMS:
             rslt = set_step_count_params_config(sens_cfg[loop].cfg.step_counter_params, dev);
             break;
 
-        /* Set step counter/detector/activity configuration */
-        case BMI2_STEP_DETECTOR:
-        case BMI2_STEP_COUNTER:
-        case BMI2_STEP_ACTIVITY:
-            rslt = set_step_config(&sens_cfg[loop].cfg.step_counter, dev);
-            break;
-
-        /* Set the wrist gesture configuration */
-        case BMI2_WRIST_GESTURE:
-            rslt = set_wrist_gest_config(&sens_cfg[loop].cfg.wrist_gest, dev);
-            break;
-
-        /* Set the wrist wear wake-up configuration */
-        case BMI2_WRIST_WEAR_WAKE_UP:
-            rslt = set_wrist_wear_wake_up_config(&sens_cfg[loop].cfg.wrist_wear_wake_up, dev);
-            break;
-
         default:
             rslt = BMI2_E_INVALID_SENSOR;
             break;
@@ -4200,45 +2895,14 @@ static int8_t get_feat_config(struct bmi2_sens_config *sens_cfg, uint8_t loop, s
     /* Variable to define error */
     int8_t rslt;
 
+    /* Features described by bmi270_feat_enc are read by bmi2_get_feat_config_batch */
     switch (sens_cfg[loop].type)
     {
-        /* Get sig-motion configuration */
-        case BMI2_SIG_MOTION:
-            rslt = get_sig_motion_config(&sens_cfg[loop].cfg.sig_motion, dev);
-            break;
-
-        /* Get any motion configuration */
-        case BMI2_ANY_MOTION:
-            rslt = get_any_motion_config(&sens_cfg[loop].cfg.any_motion, dev);
-            break;
-
-        /* Get no motion configuration */
-        case BMI2_NO_MOTION:
-            rslt = get_no_motion_config(&sens_cfg[loop].cfg.no_motion, dev);
-            break;
-
-        /* Set the step counter parameters */
+        /* Get the step counter parameters */
         case BMI2_STEP_COUNTER_PARAMS:
             rslt = get_step_count_params_config(sens_cfg[loop].cfg.step_counter_params, dev);
             break;
 
-        /* Get step counter/detector/activity configuration */
-        case BMI2_STEP_DETECTOR:
-        case BMI2_STEP_COUNTER:
-        case BMI2_STEP_ACTIVITY:
-            rslt = get_step_config(&sens_cfg[loop].cfg.step_counter, dev);
-            break;
-
-        /* Get the wrist gesture configuration */
-        case BMI2_WRIST_GESTURE:
-            rslt = get_wrist_gest_config(&sens_cfg[loop].cfg.wrist_gest, dev);
-            break;
-
-        /* Get the wrist wear wake-up configuration */
-        case BMI2_WRIST_WEAR_WAKE_UP:
-            rslt = get_wrist_wear_wake_up_config(&sens_cfg[loop].cfg.wrist_wear_wake_up, dev);
-            break;
-
         default:
             rslt = BMI2_E_INVALID_SENSOR;
             break;
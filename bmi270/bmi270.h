@@ -98,6 +98,13 @@ extern "C" {
 /*! @name Defines maximum number of feature outputs */
 #define BMI270_MAX_FEAT_OUT                  UINT8_C(7)
 
+/*! @name Defines maximum number of feature configuration encoders */
+#define BMI270_MAX_FEAT_ENC                  UINT8_C(8)
+
+/*! @name Defines number of fields of the feature configurations */
+#define BMI270_WRIST_GEST_N_FIELDS           UINT8_C(4)
+#define BMI270_WRIST_WEAR_WAKE_UP_N_FIELDS   UINT8_C(6)
+
 /*! @name Mask definitions for feature interrupt status bits */
 #define BMI270_SIG_MOT_STATUS_MASK           UINT8_C(0x01)
 #define BMI270_STEP_CNT_STATUS_MASK          UINT8_C(0x02)
@@ -152,6 +159,30 @@ extern "C" {
  */
 int8_t bmi270_init(struct bmi2_dev *dev);
 
+/*!
+ * \ingroup bmi270ApiInit
+ * \page bmi270_api_bmi270_load_variant bmi270_load_variant
+ * \code
+ * int8_t bmi270_load_variant(struct bmi2_dev *dev);
+ * \endcode
+ * @details This API switches a sensor initialized with another BMI270 variant
+ * to BMI270 without the soft-reset of bmi270_init:
+ *  1) updates the device structure with address of the configuration file.
+ *  2) Writes the configuration file.
+ *  3) Updates the feature offset parameters in the device structure.
+ *
+ * @note Register settings are kept across the switch, the features of the
+ * previous variant are not. A configuration file assigned by the user is
+ * replaced.
+ *
+ * @param[in, out] dev      : Structure instance of bmi2_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi270_load_variant(struct bmi2_dev *dev);
+
 /**
  * \ingroup bmi270
  * \defgroup bmi270ApiSensor Feature Set
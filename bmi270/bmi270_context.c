@@ -47,6 +47,295 @@
 /*!              Global Variable
  ****************************************************************************/
 
+#ifdef BMI2_COMPRESSED_CONFIG
+
+/*! @name  Configuration file of BMI270 which the compressed configuration file copies from */
+extern const uint8_t bmi270_config_file[];
+
+/*! @name  Global array that stores the configuration file of BMI270_CONTEXT compressed
+ * against the configuration file of BMI270
+ */
+static const uint8_t bmi270_context_config_blob_data[] = {
+    0x84, 0x18, 0x00, 0x80, 0x00, 0x00, 0x82, 0x00, 0x00, 0x05, 0xc9, 0x01, 0x80, 0x2e, 0xe2, 0x00, 0x82, 0x00, 0x00,
+    0x00, 0x77, 0x8b, 0x1f, 0x00, 0x00, 0xaf, 0x81, 0xf3, 0x00, 0x01, 0x07, 0x09, 0x80, 0x36, 0x00, 0x00, 0x76, 0x83,
+    0x3b, 0x00, 0x01, 0xcb, 0xa7, 0xa1, 0x44, 0x00, 0xff, 0x45, 0x00, 0x03, 0xfd, 0x2d, 0x2c, 0x56, 0x87, 0xf3, 0x00,
+    0x02, 0x02, 0x08, 0x02, 0x85, 0x9c, 0x01, 0x89, 0xa7, 0x01, 0x02, 0x01, 0x00, 0x02, 0xc3, 0xa9, 0x01, 0x82, 0x76,
+    0x06, 0x09, 0x48, 0x02, 0x01, 0x2e, 0x49, 0xf1, 0x0b, 0xbc, 0x10, 0x50, 0x80, 0xd4, 0x0a, 0x01, 0xfb, 0x7f, 0x80,
+    0x9c, 0x07, 0x03, 0x21, 0xf2, 0x02, 0x31, 0x80, 0x18, 0x19, 0x03, 0x21, 0xf2, 0x09, 0x2c, 0x80, 0x00, 0x0a, 0x09,
+    0x0e, 0xc7, 0x03, 0x2e, 0x21, 0xf2, 0xf2, 0x3e, 0x4a, 0x08, 0x80, 0xfe, 0x1d, 0x82, 0xb2, 0x07, 0x00, 0x13, 0x8d,
+    0x6b, 0x16, 0x91, 0x9a, 0x16, 0x91, 0x45, 0x07, 0x00, 0x84, 0x95, 0x5b, 0x07, 0x04, 0x80, 0x2e, 0xfb, 0x00, 0x00,
+    0x81, 0xf9, 0x07, 0x07, 0x8d, 0x00, 0x44, 0x47, 0x99, 0x00, 0xff, 0x3f, 0x86, 0x06, 0x02, 0x23, 0x90, 0x00, 0x1e,
+    0xf2, 0xfd, 0xf5, 0x8e, 0x00, 0x96, 0x00, 0x96, 0x00, 0xe0, 0x00, 0x19, 0xf4, 0x66, 0xf5, 0x00, 0x18, 0x64, 0xf5,
+    0x9d, 0x00, 0x7f, 0x00, 0x81, 0x00, 0xae, 0x00, 0xff, 0xfb, 0x21, 0x02, 0x00, 0x10, 0x82, 0xb2, 0x02, 0x02, 0xff,
+    0x7f, 0x54, 0x87, 0xb9, 0x02, 0x08, 0x4e, 0x0f, 0x42, 0x0f, 0x48, 0x0f, 0x80, 0x00, 0x67, 0x81, 0xcb, 0x02, 0x0a,
+    0x6a, 0x0f, 0x86, 0x00, 0x59, 0x0f, 0x6c, 0x0f, 0xc6, 0xf1, 0x66, 0x85, 0xdb, 0x02, 0x09, 0x6e, 0x0f, 0x71, 0x0f,
+    0xff, 0x03, 0x00, 0xfc, 0xf0, 0x3f, 0x82, 0xf2, 0x02, 0x22, 0x8a, 0x00, 0x00, 0x08, 0x71, 0x7d, 0xfe, 0xc0, 0x03,
+    0x3f, 0x05, 0x3e, 0x49, 0x01, 0x92, 0x02, 0xf5, 0xd6, 0xe8, 0x63, 0xd3, 0xf8, 0x2e, 0x07, 0x5c, 0xce, 0xa5, 0x67,
+    0x28, 0x02, 0x4e, 0x01, 0x00, 0xf0, 0x33, 0xb2, 0xaf, 0x06, 0xff, 0xfc, 0x02, 0x05, 0x15, 0x50, 0x10, 0x50, 0x17,
+    0x52, 0x80, 0xe0, 0x1c, 0x8a, 0xba, 0x16, 0x01, 0x91, 0x03, 0x82, 0xca, 0x16, 0x04, 0x89, 0x00, 0x00, 0xb2, 0x08,
+    0x87, 0xd7, 0x16, 0x02, 0x23, 0x2e, 0x89, 0x81, 0xe7, 0x16, 0x82, 0xb2, 0x07, 0x04, 0xa0, 0x50, 0x80, 0x7f, 0xe7,
+    0x83, 0x05, 0x08, 0x02, 0xa2, 0x7f, 0x91, 0x8b, 0x87, 0x09, 0x0a, 0xce, 0x00, 0x62, 0x6f, 0x01, 0x32, 0x91, 0x08,
+    0x80, 0xb2, 0x11, 0x81, 0xab, 0x09, 0x07, 0x05, 0x2e, 0x18, 0x00, 0x80, 0x90, 0x09, 0x2f, 0x80, 0x92, 0x09, 0x0f,
+    0xf9, 0x00, 0x23, 0x50, 0x01, 0x32, 0x01, 0x42, 0x02, 0x86, 0x60, 0x6f, 0x02, 0x30, 0xc2, 0x42, 0x80, 0x42, 0x0a,
+    0x02, 0x00, 0x90, 0x00, 0x81, 0x9f, 0x08, 0x04, 0x7a, 0x00, 0xf6, 0x6f, 0x91, 0x85, 0x57, 0x0b, 0x09, 0xe7, 0x6f,
+    0x7b, 0x6f, 0x80, 0x6f, 0x60, 0x5f, 0xc8, 0x2e, 0x8b, 0xff, 0x00, 0xb1, 0x2f, 0x01, 0x03, 0x01, 0x00, 0x07, 0x09,
+    0x86, 0x9c, 0x01, 0x06, 0xe1, 0x06, 0x66, 0x0a, 0x0a, 0x00, 0x0a, 0xb3, 0xa9, 0x01, 0x00, 0x10, 0x85, 0xd9, 0x03,
+    0x03, 0x48, 0x03, 0x10, 0x30, 0x81, 0x20, 0x1e, 0x00, 0x30, 0x86, 0xe8, 0x03, 0x06, 0x06, 0xa2, 0xfb, 0x2f, 0x01,
+    0x2e, 0x9c, 0x80, 0x47, 0x04, 0x85, 0x87, 0x08, 0x03, 0x01, 0x54, 0x03, 0x52, 0x80, 0xcc, 0x07, 0x05, 0xc2, 0xc0,
+    0x98, 0x2e, 0xf5, 0xb0, 0x80, 0xcc, 0x07, 0x03, 0xd5, 0xb6, 0x10, 0x30, 0x82, 0xfa, 0x03, 0x00, 0x84, 0x83, 0x83,
+    0x04, 0x00, 0x9c, 0x82, 0x01, 0x04, 0x84, 0x91, 0x04, 0x83, 0xf9, 0x09, 0x82, 0xf2, 0x09, 0x06, 0x90, 0x2e, 0x14,
+    0x03, 0x01, 0x2e, 0x87, 0x95, 0xad, 0x04, 0x00, 0x84, 0x8d, 0xc7, 0x04, 0x00, 0x84, 0x85, 0xd9, 0x04, 0x00, 0x48,
+    0x85, 0xe3, 0x04, 0x00, 0x78, 0x81, 0xed, 0x04, 0x04, 0x2c, 0x03, 0x01, 0x2e, 0x78, 0x80, 0x09, 0x05, 0x83, 0x11,
+    0x05, 0x04, 0x24, 0x02, 0x01, 0x2e, 0x84, 0x83, 0x1d, 0x05, 0x00, 0x0d, 0x81, 0x25, 0x05, 0x00, 0x07, 0x8f, 0x2b,
+    0x05, 0x00, 0x0d, 0x97, 0x3f, 0x05, 0x01, 0xaf, 0x03, 0x82, 0x5c, 0x05, 0x05, 0x84, 0x00, 0x98, 0x2e, 0xaf, 0x03,
+    0x84, 0x68, 0x05, 0x00, 0xf1, 0x81, 0x71, 0x05, 0x04, 0x48, 0x03, 0x0d, 0x52, 0x05, 0x81, 0x7b, 0x05, 0x00, 0x0b,
+    0x81, 0x81, 0x05, 0x00, 0xf2, 0x85, 0x87, 0x05, 0x00, 0x84, 0x81, 0x91, 0x05, 0x01, 0xaf, 0x03, 0x82, 0x98, 0x05,
+    0x04, 0x84, 0x00, 0x01, 0x2e, 0x84, 0x83, 0xa3, 0x05, 0x06, 0x77, 0x00, 0x09, 0x54, 0x05, 0x52, 0xf0, 0x81, 0xb1,
+    0x05, 0x00, 0xf1, 0x85, 0xb7, 0x05, 0x00, 0x84, 0x81, 0xc1, 0x05, 0x01, 0x9b, 0x03, 0x80, 0xde, 0x03, 0x00, 0x48,
+    0x87, 0xcd, 0x05, 0x00, 0x84, 0x81, 0xd9, 0x05, 0x00, 0x78, 0x81, 0xdf, 0x05, 0x00, 0x84, 0x87, 0xe5, 0x05, 0x00,
+    0x84, 0x8f, 0xf1, 0x05, 0x00, 0xba, 0x81, 0xe3, 0x04, 0x00, 0x79, 0x81, 0x0b, 0x06, 0x01, 0x48, 0x03, 0x82, 0x06,
+    0x04, 0x23, 0x10, 0x2f, 0x01, 0x2e, 0x85, 0x00, 0x21, 0x2e, 0x90, 0x00, 0x0f, 0x52, 0x7e, 0x82, 0x11, 0x50, 0x41,
+    0x40, 0x18, 0xb9, 0x11, 0x42, 0x02, 0x42, 0x02, 0x80, 0x00, 0x2e, 0x01, 0x40, 0x01, 0x42, 0x98, 0x2e, 0xaa, 0x01,
+    0x80, 0x3a, 0x04, 0x09, 0x19, 0x00, 0x21, 0x2e, 0x9c, 0x00, 0x80, 0x2e, 0x52, 0x02, 0x88, 0xf4, 0x07, 0x80, 0xfc,
+    0x17, 0xfe, 0xa0, 0x06, 0x02, 0x03, 0x2e, 0x7d, 0x8b, 0x4d, 0x17, 0x00, 0x7d, 0x81, 0x5d, 0x17, 0x04, 0x85, 0x00,
+    0x03, 0x2e, 0x85, 0x83, 0x67, 0x17, 0x00, 0x19, 0x83, 0x6f, 0x17, 0x00, 0x88, 0x89, 0x77, 0x17, 0x00, 0x89, 0xa3,
+    0x85, 0x17, 0x00, 0x78, 0x81, 0xad, 0x17, 0x01, 0xaf, 0x03, 0x80, 0xe8, 0x0e, 0x00, 0x84, 0x85, 0xb9, 0x17, 0x07,
+    0x9b, 0x03, 0x0b, 0x00, 0x94, 0x02, 0x14, 0x24, 0x80, 0xa6, 0x01, 0x12, 0x04, 0x30, 0x08, 0xb8, 0x94, 0x02, 0xc0,
+    0x2e, 0x28, 0xbd, 0x02, 0x0a, 0x0d, 0x82, 0x02, 0x30, 0x12, 0x42, 0x41, 0x81, 0xef, 0x07, 0x01, 0x95, 0x50, 0x80,
+    0xfa, 0x07, 0x0a, 0xa9, 0x01, 0x02, 0x30, 0x02, 0x2c, 0x41, 0x00, 0x12, 0x42, 0x41, 0x81, 0xef, 0x07, 0x0d, 0x13,
+    0x82, 0x02, 0x30, 0x12, 0x42, 0x41, 0x0e, 0xfc, 0x2f, 0x3f, 0x80, 0xa1, 0x30, 0x82, 0x20, 0x19, 0x94, 0x44, 0x00,
+    0x8a, 0x7a, 0x0a, 0x04, 0x78, 0x00, 0x0f, 0x2e, 0x78, 0x91, 0x8d, 0x0a, 0x00, 0x19, 0x97, 0xa3, 0x0a, 0x00, 0x78,
+    0x85, 0xbf, 0x0a, 0x05, 0x24, 0x02, 0x01, 0x2e, 0x24, 0x02, 0x88, 0xce, 0x0a, 0x00, 0x88, 0x85, 0xdb, 0x0a, 0x00,
+    0x84, 0x89, 0xe5, 0x0a, 0x00, 0x78, 0x9b, 0xf3, 0x0a, 0x00, 0x1b, 0x85, 0x13, 0x0b, 0x01, 0xce, 0x00, 0x86, 0x1e,
+    0x0b, 0x00, 0x84, 0x81, 0x29, 0x0b, 0x00, 0x9b, 0x81, 0xe3, 0x04, 0x00, 0x78, 0x8d, 0x35, 0x0b, 0x04, 0x79, 0x00,
+    0x23, 0x2e, 0x78, 0x99, 0x4b, 0x0b, 0x92, 0x00, 0x08, 0x00, 0xce, 0x80, 0x47, 0x04, 0x10, 0x30, 0x49, 0x2f, 0x05,
+    0x2e, 0x21, 0x02, 0x03, 0x2e, 0x2d, 0x02, 0x21, 0x56, 0x08, 0x08, 0x93, 0x08, 0x87, 0x66, 0x08, 0x0c, 0xbc, 0x05,
+    0x2e, 0x84, 0x00, 0x84, 0xa2, 0x0e, 0xb8, 0x31, 0x30, 0x88, 0x04, 0x86, 0x86, 0x08, 0x02, 0x1d, 0x50, 0x01, 0x80,
+    0x91, 0x0b, 0x06, 0x00, 0x05, 0x2e, 0x7a, 0x00, 0x80, 0x90, 0x82, 0x98, 0x04, 0x11, 0x7a, 0x00, 0x25, 0x2e, 0x9c,
+    0x00, 0x05, 0x2e, 0x18, 0x00, 0x80, 0xb2, 0x20, 0x2f, 0x01, 0x2e, 0xc0, 0xf5, 0x80, 0xfe, 0x11, 0x04, 0x07, 0xaa,
+    0x73, 0x30, 0x03, 0x80, 0xdd, 0x05, 0x02, 0x22, 0x41, 0x1a, 0x80, 0x90, 0x07, 0x02, 0x66, 0xf5, 0x9f, 0x81, 0xfb,
+    0x0a, 0x0d, 0x0c, 0x2f, 0x1f, 0x52, 0x03, 0x30, 0x53, 0x42, 0x2b, 0x30, 0x90, 0x04, 0x5b, 0x42, 0x80, 0xdc, 0x05,
+    0x07, 0x24, 0xbd, 0x7e, 0x80, 0x81, 0x84, 0x43, 0x42, 0x86, 0x26, 0x09, 0x00, 0x86, 0x81, 0x31, 0x09, 0x00, 0x86,
+    0x85, 0x37, 0x09, 0x03, 0x25, 0x02, 0x10, 0x30, 0xb0, 0x44, 0x09, 0x3a, 0x2f, 0x52, 0x90, 0x50, 0x53, 0x40, 0x4a,
+    0x25, 0x40, 0x40, 0x39, 0x8b, 0xfb, 0x7f, 0x0c, 0xbc, 0x21, 0x52, 0x37, 0x89, 0x0b, 0x30, 0x59, 0x08, 0x0c, 0xb8,
+    0xe0, 0x7f, 0x8b, 0x7f, 0x4b, 0x43, 0x0b, 0x43, 0x40, 0xb2, 0xd1, 0x7f, 0x6e, 0x2f, 0x01, 0x2e, 0x83, 0x00, 0x00,
+    0xb2, 0x0e, 0x2f, 0x25, 0x52, 0x01, 0x2e, 0x7e, 0x00, 0xc3, 0x7f, 0xb4, 0x7f, 0xa5, 0x81, 0x1d, 0x15, 0x80, 0x32,
+    0x0f, 0x15, 0x83, 0x00, 0xc3, 0x6f, 0xd1, 0x6f, 0xb4, 0x6f, 0xa5, 0x6f, 0x36, 0xbc, 0x06, 0xb9, 0x35, 0xbc, 0x0f,
+    0xb8, 0x94, 0xb0, 0xc6, 0x7f, 0x80, 0x8c, 0x08, 0x18, 0x27, 0x50, 0x29, 0x56, 0x0b, 0x30, 0x05, 0x2e, 0x21, 0x02,
+    0x2d, 0x5c, 0x1b, 0x42, 0xdb, 0x42, 0x96, 0x08, 0x25, 0x2e, 0x21, 0x02, 0x0b, 0x42, 0xcb, 0x80, 0x39, 0x13, 0x0b,
+    0x56, 0xcb, 0x08, 0x25, 0x52, 0x01, 0x2e, 0x7e, 0x00, 0x01, 0x54, 0x2b, 0x81, 0x83, 0x15, 0x14, 0xd2, 0x6f, 0x27,
+    0x5a, 0x94, 0x6f, 0xa4, 0xbc, 0x53, 0x41, 0x00, 0xb3, 0x1f, 0xb8, 0x44, 0x41, 0x01, 0x30, 0xd5, 0x7f, 0x05, 0x81,
+    0xab, 0x09, 0x08, 0x29, 0x5c, 0x11, 0x30, 0x93, 0x43, 0x84, 0x43, 0x23, 0x81, 0x51, 0x05, 0x31, 0x1c, 0x2f, 0x72,
+    0x6f, 0xda, 0x00, 0x82, 0x6f, 0x22, 0x03, 0x44, 0x43, 0x00, 0x90, 0x27, 0x2e, 0x7f, 0x00, 0x29, 0x5a, 0x12, 0x2f,
+    0x29, 0x54, 0x00, 0x2e, 0x90, 0x40, 0x82, 0x40, 0x18, 0x04, 0xa2, 0x06, 0x80, 0xaa, 0x04, 0x2f, 0x80, 0x90, 0x08,
+    0x2f, 0xc2, 0x6f, 0x50, 0x0f, 0x05, 0x2f, 0xc0, 0x6f, 0x80, 0x96, 0x04, 0x04, 0x53, 0x43, 0x44, 0x43, 0x11, 0x83,
+    0x11, 0x0d, 0x04, 0xd1, 0x6f, 0x15, 0x5a, 0x09, 0x81, 0x43, 0x0c, 0x06, 0x54, 0x43, 0x08, 0x2c, 0x41, 0x43, 0x15,
+    0x80, 0xfd, 0x0f, 0x00, 0x00, 0x80, 0x10, 0x0d, 0x84, 0x4a, 0x16, 0x1d, 0x70, 0x5f, 0xb8, 0x2e, 0x50, 0x86, 0xcd,
+    0x88, 0x34, 0x85, 0xc5, 0x40, 0x91, 0x40, 0x8c, 0x80, 0x06, 0x41, 0x13, 0x40, 0x50, 0x50, 0x6e, 0x01, 0x82, 0x40,
+    0x04, 0x40, 0x34, 0x8c, 0x80, 0x80, 0x06, 0x02, 0xce, 0x03, 0xe0, 0x81, 0x91, 0x1a, 0x01, 0x8c, 0x81, 0x7f, 0x82,
+    0x41, 0x13, 0x40, 0x04, 0x40, 0x34, 0x8e, 0x98, 0x2e, 0xce, 0x03, 0xc0, 0x7f, 0xd5, 0x7f, 0x13, 0x24, 0xff, 0x00,
+    0xd6, 0x41, 0xcc, 0x83, 0xc2, 0x41, 0x57, 0x40, 0x74, 0x80, 0x44, 0x40, 0x11, 0x40, 0x0c, 0x8a, 0xf7, 0x01, 0x94,
+    0x03, 0x12, 0x24, 0x80, 0x00, 0x3a, 0x01, 0x02, 0x30, 0xb2, 0x03, 0xce, 0x17, 0xfb, 0x08, 0x23, 0x01, 0xb2, 0x02,
+    0x48, 0xbb, 0x28, 0xbd, 0xf2, 0x0b, 0x53, 0x41, 0x02, 0x40, 0x44, 0x41, 0x74, 0x8d, 0xb7, 0x7f, 0x98, 0x2e, 0xce,
+    0x03, 0x50, 0x25, 0x91, 0x41, 0x8c, 0x81, 0x82, 0x41, 0x13, 0x40, 0x04, 0x40, 0x34, 0x8e, 0x98, 0x2e, 0xce, 0x03,
+    0x60, 0x25, 0xd1, 0x41, 0xcc, 0x81, 0xc2, 0x41, 0x13, 0x40, 0x04, 0x40, 0x98, 0x2e, 0xce, 0x03, 0x11, 0x24, 0xb3,
+    0x00, 0x71, 0x0e, 0xd3, 0x6f, 0xe1, 0x6f, 0x33, 0x2f, 0x12, 0x24, 0xdd, 0x00, 0x7f, 0xda, 0x0f, 0x2b, 0x2f, 0x12,
+    0x24, 0x8c, 0x00, 0x5a, 0x0e, 0x09, 0x2f, 0x10, 0x24, 0x83, 0x05, 0x48, 0x0e, 0x11, 0x24, 0x7f, 0x22, 0x10, 0x24,
+    0x18, 0x32, 0x08, 0x22, 0x80, 0x2e, 0xd7, 0xb4, 0x13, 0x24, 0xf4, 0x00, 0x73, 0x0e, 0x0f, 0x2f, 0x10, 0x24, 0x11,
+    0x10, 0x68, 0x0e, 0x10, 0x24, 0xa2, 0x30, 0x13, 0x24, 0x97, 0x23, 0x03, 0x22, 0x13, 0x24, 0x3b, 0x04, 0x4b, 0x0e,
+    0x11, 0x24, 0x0f, 0x30, 0x01, 0x22, 0x80, 0x2e, 0xd7, 0xb4, 0x11, 0x24, 0x53, 0x02, 0x41, 0x0e, 0x11, 0x24, 0xe7,
+    0x31, 0x10, 0x24, 0xfc, 0x25, 0x08, 0x22, 0x80, 0x2e, 0xd7, 0xb4, 0x10, 0x24, 0xe8, 0x40, 0x80, 0x2e, 0xd7, 0xb4,
+    0xf2, 0x37, 0x5a, 0x0e, 0x90, 0x2e, 0x50, 0xb3, 0x12, 0x24, 0xea, 0x00, 0x4a, 0x0e, 0x90, 0x2e, 0xc7, 0xb2, 0xc2,
+    0x6f, 0x14, 0x24, 0x4c, 0x0b, 0x54, 0x0e, 0x90, 0x2e, 0x7f, 0xab, 0xb2, 0x14, 0x24, 0x9b, 0x00, 0x5c, 0x0e, 0x90,
+    0x2e, 0xa1, 0xb2, 0x14, 0x24, 0x22, 0x01, 0x4c, 0x0e, 0x70, 0x2f, 0x82, 0xa3, 0x5e, 0x2f, 0x11, 0x24, 0xba, 0x0b,
+    0x51, 0x0e, 0x35, 0x2f, 0x11, 0x24, 0x03, 0x08, 0x69, 0x0e, 0x2d, 0x2f, 0xb1, 0x6f, 0x14, 0x24, 0x90, 0x00, 0x0c,
+    0x0e, 0x24, 0x2f, 0x11, 0x24, 0x31, 0x08, 0x69, 0x0e, 0x16, 0x2f, 0x11, 0x24, 0x7d, 0x01, 0x59, 0x0e, 0x0e, 0x2f,
+    0x11, 0x24, 0xd7, 0x0c, 0x51, 0x0e, 0x11, 0x24, 0x9f, 0x44, 0x13, 0x24, 0x41, 0x57, 0x4b, 0x22, 0x93, 0x35, 0x43,
+    0x0e, 0x10, 0x24, 0xbd, 0x42, 0x08, 0x22, 0x80, 0x2e, 0xd7, 0xb4, 0x10, 0x24, 0x1c, 0x42, 0x80, 0x2e, 0xd7, 0xb4,
+    0x11, 0x24, 0x47, 0x01, 0x59, 0x0e, 0x11, 0x24, 0xa2, 0x45, 0x10, 0x24, 0x31, 0x51, 0x08, 0x22, 0x80, 0x2e, 0xd7,
+    0xb4, 0x10, 0x24, 0x80, 0x41, 0x7f, 0x80, 0x2e, 0xd7, 0xb4, 0x10, 0x24, 0x67, 0x54, 0x80, 0x2e, 0xd7, 0xb4, 0x11,
+    0x24, 0x8c, 0x08, 0xe9, 0x0f, 0x10, 0x24, 0x0a, 0x48, 0x90, 0x2e, 0xd7, 0xb4, 0xb1, 0x6f, 0x13, 0x24, 0xe8, 0x03,
+    0x8b, 0x0f, 0x10, 0x24, 0xcd, 0x57, 0x90, 0x2e, 0xd7, 0xb4, 0x73, 0x35, 0x8b, 0x0f, 0x10, 0x24, 0x6f, 0x42, 0x90,
+    0x2e, 0xd7, 0xb4, 0x10, 0x24, 0xa0, 0xfe, 0x08, 0x0e, 0x10, 0x24, 0x38, 0x54, 0x13, 0x24, 0xa3, 0x46, 0x03, 0x22,
+    0x13, 0x24, 0x45, 0xfd, 0x0b, 0x0e, 0x11, 0x24, 0x04, 0x43, 0x08, 0x22, 0x80, 0x2e, 0xd7, 0xb4, 0xb1, 0x6f, 0x00,
+    0x3a, 0x08, 0x0e, 0x11, 0x24, 0x3d, 0x45, 0x10, 0x24, 0x52, 0x54, 0x48, 0x22, 0x10, 0x24, 0x8f, 0x01, 0x58, 0x0e,
+    0x10, 0x24, 0x48, 0x44, 0x01, 0x22, 0x80, 0x2e, 0xd7, 0xb4, 0xb1, 0x6f, 0x13, 0x24, 0xfa, 0x03, 0x0b, 0x0e, 0x11,
+    0x24, 0x7f, 0x85, 0x43, 0x13, 0x24, 0x35, 0x55, 0x4b, 0x22, 0x11, 0xa2, 0x10, 0x24, 0xf6, 0x57, 0x08, 0x22, 0x80,
+    0x2e, 0xd7, 0xb4, 0x11, 0x24, 0xa4, 0x0a, 0x69, 0x0e, 0x11, 0x24, 0x7b, 0x5a, 0x10, 0x24, 0x5e, 0x20, 0x08, 0x22,
+    0x80, 0x2e, 0xd7, 0xb4, 0x11, 0x24, 0x0f, 0x01, 0x59, 0x0e, 0x0d, 0x2f, 0x18, 0xa2, 0x11, 0x24, 0x2b, 0x47, 0x10,
+    0x24, 0xf4, 0x55, 0x48, 0x22, 0x10, 0x24, 0x16, 0x0b, 0x50, 0x0e, 0x10, 0x24, 0xc7, 0x51, 0x01, 0x22, 0x80, 0x2e,
+    0xd7, 0xb4, 0x11, 0x24, 0x72, 0x0a, 0x51, 0x0e, 0x11, 0x24, 0x85, 0x55, 0x10, 0x24, 0xb2, 0x47, 0x08, 0x22, 0x80,
+    0x2e, 0xd7, 0xb4, 0x10, 0x24, 0x83, 0x00, 0x48, 0x0e, 0x53, 0x2f, 0x11, 0x24, 0xe1, 0x07, 0x69, 0x0e, 0x2d, 0x2f,
+    0x95, 0xaf, 0x27, 0x2f, 0x82, 0xaf, 0x21, 0x2f, 0x11, 0x24, 0xd7, 0x00, 0x59, 0x0e, 0x19, 0x2f, 0x7f, 0xb1, 0x6f,
+    0x10, 0x24, 0xcc, 0x03, 0x88, 0x0f, 0x10, 0x2f, 0x10, 0x24, 0xe8, 0xfe, 0x08, 0x0e, 0x11, 0x24, 0x7e, 0x56, 0x10,
+    0x24, 0x94, 0x45, 0x48, 0x22, 0xc0, 0x6f, 0x13, 0x24, 0x06, 0x0b, 0x43, 0x0e, 0x10, 0x24, 0x2f, 0x51, 0x01, 0x22,
+    0x80, 0x2e, 0xd7, 0xb4, 0x10, 0x24, 0xde, 0x51, 0x80, 0x2e, 0xd7, 0xb4, 0x10, 0x24, 0xe8, 0x54, 0x80, 0x2e, 0xd7,
+    0xb4, 0x10, 0x24, 0xa4, 0x52, 0x80, 0x2e, 0xd7, 0xb4, 0x10, 0x24, 0xd0, 0x44, 0x80, 0x2e, 0xd7, 0xb4, 0x11, 0x24,
+    0xb8, 0x00, 0xd9, 0x0f, 0x19, 0x2f, 0xc1, 0x6f, 0x10, 0x24, 0xe7, 0x0c, 0xc8, 0x0f, 0x10, 0x2f, 0x11, 0x24, 0xc7,
+    0x07, 0x69, 0x0e, 0x11, 0x24, 0xf6, 0x52, 0x10, 0x24, 0x7a, 0x12, 0x48, 0x22, 0xb0, 0x6f, 0x13, 0x24, 0x5d, 0x02,
+    0x03, 0x0e, 0x10, 0x24, 0x7c, 0x54, 0x01, 0x22, 0x80, 0x2e, 0xd7, 0xb4, 0x7f, 0x10, 0x24, 0x8d, 0x51, 0x80, 0x2e,
+    0xd7, 0xb4, 0x10, 0x24, 0x28, 0x52, 0x80, 0x2e, 0xd7, 0xb4, 0x10, 0x24, 0xd2, 0x07, 0xe8, 0x0f, 0x28, 0x2f, 0x10,
+    0x24, 0xb0, 0x00, 0xd8, 0x0f, 0x20, 0x2f, 0x10, 0x24, 0xc6, 0x07, 0x68, 0x0e, 0x18, 0x2f, 0x50, 0x35, 0x48, 0x0e,
+    0x11, 0x2f, 0xb1, 0x6f, 0x10, 0x24, 0xf4, 0x01, 0x08, 0x0e, 0x11, 0x24, 0x35, 0x51, 0x10, 0x24, 0x22, 0x12, 0x48,
+    0x22, 0xc0, 0x6f, 0x13, 0x24, 0xe0, 0x0c, 0x43, 0x0e, 0x10, 0x24, 0x7b, 0x50, 0x08, 0x22, 0x80, 0x2e, 0xd7, 0xb4,
+    0x10, 0x24, 0x81, 0x52, 0x80, 0x2e, 0xd7, 0xb4, 0x10, 0x24, 0x3b, 0x53, 0x80, 0x2e, 0xd7, 0xb4, 0x10, 0x24, 0x63,
+    0x51, 0x80, 0x2e, 0xd7, 0xb4, 0x10, 0x24, 0x27, 0x51, 0x80, 0x2e, 0xd7, 0xb4, 0x18, 0xa2, 0x90, 0x2e, 0xdb, 0xb3,
+    0x12, 0x24, 0x08, 0x02, 0x4a, 0x0e, 0x37, 0x2f, 0x7f, 0x12, 0x24, 0x2a, 0x09, 0x6a, 0x0e, 0x1d, 0x2f, 0x13, 0x24,
+    0x8e, 0x00, 0x73, 0x0e, 0x09, 0x2f, 0x11, 0x24, 0xa5, 0x01, 0x41, 0x0e, 0x11, 0x24, 0x76, 0x32, 0x10, 0x24, 0x12,
+    0x25, 0x08, 0x22, 0x80, 0x2e, 0xd7, 0xb4, 0x10, 0x24, 0xa9, 0x0d, 0x68, 0x0e, 0x10, 0x24, 0x04, 0x27, 0x13, 0x24,
+    0x73, 0x20, 0x03, 0x22, 0x13, 0x24, 0x14, 0x04, 0x4b, 0x0e, 0x11, 0x24, 0x15, 0x2c, 0x01, 0x22, 0x80, 0x2e, 0xd7,
+    0xb4, 0x11, 0x24, 0xae, 0x08, 0x69, 0x0e, 0x08, 0x2f, 0xa1, 0x35, 0x71, 0x0e, 0x11, 0x24, 0x8b, 0x2b, 0x10, 0x24,
+    0x07, 0x35, 0x08, 0x22, 0x80, 0x2e, 0xd7, 0xb4, 0x91, 0x34, 0x59, 0x0e, 0x11, 0x24, 0x7b, 0x19, 0x10, 0x24, 0x50,
+    0x59, 0x08, 0x22, 0x80, 0x2e, 0xd7, 0xb4, 0x62, 0x32, 0x42, 0x0e, 0x22, 0x2f, 0xa2, 0x32, 0x5a, 0x0e, 0x1b, 0x2f,
+    0x12, 0x24, 0x0b, 0x08, 0x7f, 0x6a, 0x0e, 0x0e, 0x2f, 0xa3, 0x34, 0x43, 0x0e, 0x10, 0x24, 0x28, 0x2b, 0x13, 0x24,
+    0x20, 0x23, 0x03, 0x22, 0x13, 0x24, 0x8d, 0x01, 0x4b, 0x0e, 0x11, 0x24, 0x5c, 0x21, 0x08, 0x22, 0x80, 0x2e, 0xd7,
+    0xb4, 0x31, 0x36, 0x59, 0x0e, 0x11, 0x24, 0x43, 0x25, 0x10, 0x24, 0xfa, 0x49, 0x08, 0x22, 0x80, 0x2e, 0xd7, 0xb4,
+    0x10, 0x24, 0xc7, 0x2a, 0x80, 0x2e, 0xd7, 0xb4, 0x40, 0x36, 0x58, 0x0e, 0x09, 0x2f, 0x11, 0x24, 0x9e, 0x08, 0x69,
+    0x0e, 0x11, 0x24, 0xe3, 0x54, 0x10, 0x24, 0x73, 0x22, 0x08, 0x22, 0x80, 0x2e, 0xd7, 0xb4, 0x10, 0x24, 0x38, 0x01,
+    0xc8, 0x0f, 0x10, 0x2f, 0x11, 0x24, 0x11, 0x08, 0x69, 0x0e, 0x11, 0x24, 0x6e, 0x48, 0x10, 0x24, 0x2b, 0x28, 0x48,
+    0x22, 0xc0, 0x6f, 0x13, 0x24, 0xc1, 0x0a, 0x43, 0x0e, 0x10, 0x24, 0x0f, 0x23, 0x08, 0x22, 0x80, 0x2e, 0xd7, 0xb4,
+    0x7f, 0x10, 0x24, 0xd0, 0x1a, 0x80, 0x2e, 0xd7, 0xb4, 0xe2, 0x33, 0x5a, 0x0e, 0x77, 0x2f, 0x12, 0x24, 0x0c, 0x08,
+    0x6a, 0x0e, 0x2a, 0x2f, 0x12, 0x24, 0xc5, 0x00, 0x4a, 0x0e, 0x08, 0x2f, 0x11, 0x36, 0x59, 0x0e, 0x11, 0x24, 0xfd,
+    0x18, 0x10, 0x24, 0x75, 0x58, 0x08, 0x22, 0x80, 0x2e, 0xd7, 0xb4, 0xc2, 0x34, 0x5a, 0x0e, 0x0d, 0x2f, 0x11, 0x24,
+    0x36, 0x08, 0x69, 0x0e, 0x11, 0x24, 0x08, 0x58, 0x13, 0x24, 0x3b, 0x54, 0x4b, 0x22, 0x01, 0xa2, 0x10, 0x24, 0xc6,
+    0x52, 0x08, 0x22, 0x80, 0x2e, 0xd7, 0xb4, 0xb3, 0x36, 0x4b, 0x0e, 0x11, 0x24, 0x0e, 0x24, 0x13, 0x24, 0x7b, 0x50,
+    0x59, 0x22, 0x0e, 0xa2, 0x10, 0x24, 0xf7, 0x56, 0x01, 0x22, 0x80, 0x2e, 0xd7, 0xb4, 0xc2, 0x35, 0x5a, 0x0e, 0x12,
+    0x2f, 0x01, 0xa2, 0x0c, 0x2f, 0x84, 0xa3, 0x10, 0x24, 0xd4, 0x58, 0x13, 0x24, 0x76, 0x56, 0x7f, 0x03, 0x22, 0x73,
+    0x36, 0x4b, 0x0e, 0x11, 0x24, 0xeb, 0x52, 0x08, 0x22, 0x80, 0x2e, 0xd7, 0xb4, 0x10, 0x24, 0x87, 0x16, 0x80, 0x2e,
+    0xd7, 0xb4, 0xb0, 0x6f, 0x13, 0x24, 0x02, 0xfd, 0x03, 0x0e, 0x29, 0x2f, 0x84, 0xa3, 0xc0, 0x6f, 0x09, 0x2f, 0x11,
+    0x24, 0xe4, 0x0a, 0x41, 0x0e, 0x11, 0x24, 0x5d, 0x44, 0x10, 0x24, 0x2f, 0x5a, 0x08, 0x22, 0x80, 0x2e, 0xd7, 0xb4,
+    0x13, 0x24, 0x96, 0x0c, 0x43, 0x0e, 0x0e, 0x2f, 0x40, 0x33, 0x48, 0x0e, 0x10, 0x24, 0xf2, 0x18, 0x13, 0x24, 0x31,
+    0x49, 0x03, 0x22, 0x13, 0x24, 0x99, 0x00, 0x4b, 0x0e, 0x11, 0x24, 0xab, 0x18, 0x01, 0x22, 0x80, 0x2e, 0xd7, 0xb4,
+    0x11, 0x24, 0xc6, 0x07, 0x69, 0x0e, 0x11, 0x24, 0xb0, 0x49, 0x10, 0x24, 0xbf, 0x17, 0x08, 0x22, 0x80, 0x2e, 0xd7,
+    0xb4, 0x10, 0x24, 0x03, 0x15, 0x80, 0x2e, 0xd7, 0xb4, 0xb0, 0x32, 0x7f, 0x48, 0x0e, 0x57, 0x2f, 0xa0, 0x37, 0x48,
+    0x0e, 0x13, 0x2f, 0x83, 0xa3, 0x08, 0x2f, 0x10, 0x24, 0xe0, 0x00, 0x48, 0x0e, 0x11, 0x24, 0xf6, 0x25, 0x10, 0x24,
+    0x75, 0x17, 0x71, 0x2c, 0x08, 0x22, 0x10, 0x24, 0xa0, 0x00, 0x48, 0x0e, 0x11, 0x24, 0x7f, 0x18, 0x10, 0x24, 0xa6,
+    0x13, 0x68, 0x2c, 0x08, 0x22, 0x11, 0x24, 0xf9, 0x07, 0x69, 0x0e, 0x0d, 0x2f, 0x11, 0x24, 0x10, 0x08, 0x69, 0x0e,
+    0x11, 0x24, 0xb1, 0x14, 0x10, 0x24, 0x8e, 0x58, 0x48, 0x22, 0x90, 0x32, 0x58, 0x0e, 0x10, 0x24, 0x6d, 0x14, 0x56,
+    0x2c, 0x01, 0x22, 0xc1, 0x6f, 0x10, 0x24, 0x68, 0x0c, 0x48, 0x0e, 0xb1, 0x6f, 0x0c, 0x2f, 0xcd, 0xa2, 0x10, 0x24,
+    0x23, 0x14, 0x13, 0x24, 0x8d, 0x42, 0x03, 0x22, 0x13, 0x24, 0x2a, 0xfd, 0x0b, 0x0e, 0x11, 0x24, 0x53, 0x12, 0x43,
+    0x2c, 0x08, 0x22, 0x10, 0x24, 0xcc, 0x07, 0x7f, 0x68, 0x0e, 0x0e, 0x2f, 0x10, 0x24, 0x08, 0xfd, 0x08, 0x0e, 0x10,
+    0x24, 0x08, 0x16, 0x13, 0x24, 0x83, 0x45, 0x03, 0x22, 0x13, 0x24, 0xa1, 0xfd, 0x0b, 0x0e, 0x11, 0x24, 0xa6, 0x14,
+    0x30, 0x2c, 0x01, 0x22, 0x10, 0x24, 0x5b, 0x01, 0x08, 0x0e, 0x11, 0x24, 0x2f, 0x12, 0x10, 0x24, 0xdd, 0x44, 0x27,
+    0x2c, 0x08, 0x22, 0xdb, 0xa2, 0x0f, 0x2f, 0xc1, 0x6f, 0x10, 0x24, 0xb2, 0x0b, 0x48, 0x0e, 0x11, 0x24, 0x21, 0x55,
+    0x10, 0x24, 0xc8, 0x14, 0x48, 0x22, 0x10, 0x24, 0x4c, 0x08, 0x68, 0x0e, 0x10, 0x24, 0xe4, 0x57, 0x15, 0x2c, 0x01,
+    0x22, 0x44, 0xa2, 0x0f, 0x2f, 0xc1, 0x6f, 0x10, 0x24, 0xcb, 0x0b, 0x48, 0x0e, 0x11, 0x24, 0x09, 0x58, 0x10, 0x24,
+    0xe4, 0x10, 0x48, 0x22, 0x10, 0x24, 0x4d, 0x08, 0x68, 0x0e, 0x10, 0x24, 0x1a, 0x12, 0x03, 0x2c, 0x01, 0x22, 0x10,
+    0x24, 0x0c, 0x10, 0x82, 0x66, 0x1d, 0x7b, 0xa3, 0x32, 0xc3, 0x00, 0x60, 0x51, 0xc2, 0x40, 0x81, 0x84, 0xd3, 0x7f,
+    0xd2, 0x42, 0xe0, 0x7f, 0x00, 0x30, 0xc4, 0x40, 0x20, 0x02, 0xc3, 0x7f, 0xd0, 0x42, 0x42, 0x3d, 0xc0, 0x40, 0x01,
+    0x80, 0xc0, 0x42, 0xda, 0x00, 0x93, 0x7f, 0xb1, 0x7f, 0xab, 0x7f, 0x98, 0x2e, 0xb3, 0xc0, 0x91, 0x6f, 0xf3, 0x32,
+    0x40, 0x42, 0x00, 0xac, 0x8b, 0x00, 0x02, 0x2f, 0xe1, 0x6f, 0x39, 0x56, 0x43, 0x42, 0xa1, 0x82, 0x91, 0x7f, 0x33,
+    0x33, 0x4b, 0x00, 0x81, 0x7f, 0x13, 0x3c, 0x4b, 0x00, 0x80, 0x40, 0x53, 0x34, 0xb5, 0x6f, 0x8b, 0x00, 0x0d, 0xb0,
+    0x43, 0x87, 0x76, 0x7f, 0xb2, 0x7f, 0x63, 0x7f, 0x65, 0x25, 0xb5, 0x6f, 0x92, 0x41, 0x63, 0x41, 0x64, 0x41, 0x44,
+    0x81, 0x56, 0x7f, 0x41, 0x7f, 0x00, 0x2e, 0x26, 0x40, 0x27, 0x40, 0x45, 0x41, 0xf7, 0x7f, 0xb0, 0x7f, 0x80, 0x56,
+    0x0d, 0x73, 0x81, 0x6f, 0x0f, 0xa4, 0x43, 0x40, 0x72, 0x6f, 0x94, 0x6f, 0x05, 0x30, 0x01, 0x2f, 0xc0, 0xa0, 0x03,
+    0x2f, 0x31, 0xac, 0x07, 0x2f, 0xc0, 0xa4, 0x05, 0x2f, 0xa2, 0x00, 0xeb, 0x04, 0x80, 0x40, 0x01, 0x80, 0x43, 0x42,
+    0x80, 0x42, 0x41, 0x86, 0x56, 0x6f, 0x62, 0x6f, 0x41, 0x6f, 0x42, 0x82, 0x72, 0x0e, 0x83, 0x7f, 0xd5, 0x2f, 0x53,
+    0x32, 0x8b, 0x00, 0xa1, 0x86, 0x56, 0x25, 0xf0, 0x82, 0x82, 0x40, 0x8d, 0xb0, 0x52, 0x40, 0xde, 0x00, 0x91, 0x7f,
+    0xb3, 0x7f, 0x85, 0x7f, 0xb3, 0x30, 0x7b, 0x52, 0x98, 0x2e, 0x5a, 0xca, 0x1a, 0x25, 0x83, 0x6f, 0x6d, 0x82, 0xfd,
+    0x88, 0x50, 0x7f, 0x71, 0x7f, 0x81, 0x7f, 0x05, 0x30, 0x83, 0x30, 0x00, 0x30, 0x11, 0x41, 0x52, 0x6f, 0x25, 0x7f,
+    0x30, 0x7f, 0x44, 0x7f, 0x80, 0x5c, 0x0e, 0x63, 0x73, 0x6f, 0x20, 0x25, 0x90, 0x6f, 0x7d, 0x52, 0xd2, 0x42, 0x73,
+    0x7f, 0x12, 0x7f, 0x98, 0x2e, 0x86, 0xb7, 0x93, 0x6f, 0x11, 0x6f, 0xd2, 0x40, 0x0a, 0x18, 0x31, 0x6f, 0x0e, 0x00,
+    0x93, 0x7f, 0x83, 0x30, 0x44, 0x6f, 0x21, 0x6f, 0x62, 0x6f, 0x62, 0x0e, 0x4f, 0x03, 0xe1, 0x2f, 0x33, 0x52, 0x01,
+    0x00, 0x01, 0x30, 0x69, 0x03, 0x3a, 0x25, 0xea, 0x82, 0x92, 0x6f, 0xf0, 0x86, 0xd1, 0xbe, 0x0f, 0xb8, 0xbd, 0x84,
+    0x94, 0x7f, 0x05, 0x0a, 0x23, 0x7f, 0x52, 0x7f, 0x40, 0x7f, 0x31, 0x7f, 0x71, 0x7f, 0xd3, 0x30, 0x84, 0x6f, 0x55,
+    0x6f, 0x10, 0x41, 0x52, 0x41, 0x41, 0x6f, 0x55, 0x7f, 0x10, 0x7f, 0x04, 0x7f, 0x80, 0x5c, 0x0e, 0x02, 0x11, 0x6f,
+    0x20, 0x81, 0x67, 0x0d, 0x65, 0x31, 0x6f, 0x04, 0x6f, 0x50, 0x42, 0x31, 0x7f, 0xd3, 0x30, 0x21, 0x6f, 0x61, 0x0e,
+    0xea, 0x2f, 0xb1, 0x6f, 0x41, 0x84, 0x32, 0x25, 0x90, 0x40, 0x84, 0x40, 0x71, 0x6f, 0xb4, 0x7f, 0x72, 0x7f, 0x40,
+    0x7f, 0x33, 0x7f, 0x98, 0x2e, 0xb3, 0xc0, 0x53, 0x6f, 0xb1, 0x32, 0x99, 0x00, 0x83, 0xb9, 0x41, 0x6f, 0x4b, 0x00,
+    0xb0, 0x6f, 0x03, 0x30, 0xc3, 0x02, 0x84, 0x40, 0xb2, 0x7f, 0xa1, 0x84, 0x0d, 0xb1, 0x52, 0x7f, 0x56, 0x01, 0x74,
+    0x6f, 0x30, 0x6f, 0x92, 0x6f, 0x43, 0x8b, 0x03, 0x43, 0x01, 0x42, 0x95, 0x7f, 0xbd, 0x86, 0x51, 0x41, 0x41, 0x7f,
+    0x75, 0x7f, 0x00, 0x2e, 0xd1, 0x40, 0x42, 0x41, 0x32, 0x7f, 0x23, 0x7f, 0x82, 0x3e, 0x13, 0x11, 0xc8, 0x00, 0x90,
+    0x6f, 0x01, 0x30, 0x75, 0x6f, 0x32, 0x6f, 0x03, 0x42, 0x91, 0x02, 0x23, 0x6f, 0x61, 0x6f, 0x7f, 0x59, 0x0e, 0x62,
+    0x43, 0x95, 0x7f, 0xe7, 0x2f, 0xb2, 0x6f, 0x51, 0x6f, 0x82, 0x40, 0x8d, 0xb0, 0x8e, 0x00, 0xfd, 0x8a, 0xb2, 0x7f,
+    0x02, 0x30, 0x79, 0x52, 0x05, 0x25, 0x03, 0x30, 0x54, 0x40, 0xec, 0x01, 0x16, 0x40, 0x43, 0x89, 0xc7, 0x41, 0x37,
+    0x18, 0x3d, 0x8b, 0x96, 0x00, 0x44, 0x0e, 0xdf, 0x02, 0xf4, 0x2f, 0x09, 0x52, 0x51, 0x00, 0x02, 0x30, 0x9a, 0x02,
+    0xb5, 0x6f, 0x45, 0x87, 0x1b, 0xba, 0x25, 0xbc, 0x51, 0x6f, 0x4d, 0x8b, 0x7a, 0x82, 0xc6, 0x40, 0x20, 0x0a, 0x30,
+    0x00, 0xd0, 0x42, 0x2b, 0xb5, 0xc0, 0x40, 0x82, 0x02, 0x40, 0x34, 0x08, 0x00, 0xd2, 0x42, 0xb0, 0x7f, 0x75, 0x7f,
+    0x93, 0x7f, 0x00, 0x2e, 0xb5, 0x6f, 0xe2, 0x6f, 0x63, 0x41, 0x64, 0x41, 0x44, 0x8f, 0x82, 0x40, 0xe6, 0x41, 0xc0,
+    0x41, 0xc4, 0x8f, 0x45, 0x41, 0xf0, 0x7f, 0xb7, 0x7f, 0x61, 0x7f, 0x80, 0x56, 0x0d, 0x69, 0x00, 0x18, 0x09, 0x52,
+    0x71, 0x00, 0x03, 0x30, 0xbb, 0x02, 0x1b, 0xba, 0x93, 0x6f, 0x25, 0xbc, 0x61, 0x6f, 0xc5, 0x40, 0x42, 0x82, 0x20,
+    0x0a, 0x28, 0x00, 0xd0, 0x42, 0x2b, 0xb9, 0xc0, 0x40, 0x82, 0x02, 0xd2, 0x42, 0x93, 0x7f, 0x00, 0x2e, 0x72, 0x6f,
+    0x5a, 0x0e, 0xd9, 0x2f, 0xb1, 0x6f, 0xf3, 0x3c, 0xcb, 0x00, 0xda, 0x82, 0xc3, 0x40, 0x41, 0x40, 0x59, 0x0e, 0x50,
+    0x2f, 0xe1, 0x6f, 0xe3, 0x32, 0xcb, 0x00, 0xb3, 0x7f, 0x22, 0x30, 0xc0, 0x40, 0x01, 0x80, 0xc0, 0x42, 0x02, 0xa2,
+    0x30, 0x2f, 0xc2, 0x42, 0x98, 0x2e, 0x83, 0xb1, 0xe1, 0x6f, 0xb3, 0x35, 0xcb, 0x00, 0x24, 0x3d, 0xc2, 0x40, 0xdc,
+    0x00, 0x84, 0x40, 0x00, 0x91, 0x93, 0x7f, 0x80, 0xf8, 0x13, 0x6f, 0x06, 0x2c, 0x0c, 0xb8, 0x30, 0x25, 0x00, 0x33,
+    0x48, 0x00, 0x98, 0x2e, 0xf6, 0xb6, 0x91, 0x6f, 0x90, 0x7f, 0x00, 0x2e, 0x44, 0x40, 0x20, 0x1a, 0x15, 0x2f, 0xd3,
+    0x6f, 0xc1, 0x6f, 0xc3, 0x40, 0x35, 0x5a, 0x42, 0x40, 0xd3, 0x7e, 0x08, 0xbc, 0x25, 0x09, 0xe2, 0x7e, 0xc4, 0x0a,
+    0x42, 0x82, 0xf3, 0x7e, 0xd1, 0x7f, 0x34, 0x30, 0x83, 0x6f, 0x82, 0x30, 0x31, 0x30, 0x98, 0x2e, 0xb3, 0x00, 0xd1,
+    0x6f, 0x93, 0x6f, 0x43, 0x42, 0xf0, 0x32, 0xb1, 0x6f, 0x41, 0x82, 0xe2, 0x6f, 0x43, 0x40, 0xc1, 0x86, 0xc2, 0xa2,
+    0x43, 0x42, 0x03, 0x30, 0x02, 0x2f, 0x90, 0x00, 0x00, 0x2e, 0x83, 0x42, 0x61, 0x88, 0x42, 0x40, 0x8d, 0xb0, 0x26,
+    0x00, 0x98, 0x2e, 0xd9, 0x03, 0x1c, 0x83, 0x00, 0x2e, 0x80, 0x04, 0x19, 0x00, 0xab, 0x81, 0x29, 0x0c, 0x74, 0xb1,
+    0x35, 0x40, 0x51, 0x41, 0x01, 0x02, 0x30, 0x1a, 0x25, 0x13, 0x30, 0x40, 0x25, 0x12, 0x42, 0x45, 0x0e, 0xfc, 0x2f,
+    0x65, 0x34, 0x28, 0x80, 0x25, 0x01, 0x13, 0x42, 0x44, 0x0e, 0xfc, 0x2f, 0x27, 0x80, 0x65, 0x56, 0x03, 0x42, 0x15,
+    0x80, 0xa3, 0x30, 0x03, 0x42, 0x04, 0x80, 0x4d, 0x56, 0x7f, 0x58, 0x13, 0x42, 0xd4, 0x7e, 0xc2, 0x7e, 0xf2, 0x7e,
+    0x6c, 0x8c, 0x81, 0x56, 0x83, 0x58, 0xe3, 0x7e, 0x04, 0x7f, 0x71, 0x8a, 0x97, 0x41, 0x17, 0x42, 0x75, 0x0e, 0xfb,
+    0x2f, 0x85, 0x5c, 0x87, 0x5e, 0x16, 0x7f, 0x36, 0x7f, 0x27, 0x7f, 0x00, 0x2e, 0x89, 0x5c, 0x8b, 0x5e, 0x46, 0x7f,
+    0x57, 0x7f, 0x76, 0x8c, 0x57, 0x41, 0x17, 0x42, 0x6e, 0x0e, 0xfb, 0x2f, 0x8d, 0x5a, 0x8f, 0x5e, 0x65, 0x7f, 0x87,
+    0x7f, 0x72, 0x80, 0x91, 0x1a, 0x27, 0x5a, 0x93, 0x5e, 0x95, 0x7f, 0xa7, 0x7f, 0x7b, 0x8a, 0x97, 0x41, 0x17, 0x42,
+    0x75, 0x0e, 0xfb, 0x2f, 0x7f, 0x5c, 0xb2, 0x7f, 0xc6, 0x7f, 0xd3, 0x7f, 0xe2, 0x7f, 0xf4, 0x7f, 0x40, 0x82, 0x52,
+    0x41, 0x12, 0x42, 0x69, 0x0e, 0xfb, 0x2f, 0xc0, 0x81, 0x2b, 0x0c, 0x29, 0x2d, 0x02, 0x9f, 0xbc, 0x9f, 0xb8, 0x20,
+    0x50, 0x40, 0xb2, 0x14, 0x2f, 0x10, 0x25, 0x01, 0x2e, 0x8d, 0x00, 0x00, 0x90, 0x0b, 0x2f, 0x97, 0x50, 0xf1, 0x7f,
+    0xeb, 0x7f, 0x98, 0x2e, 0x83, 0xb6, 0x01, 0x2e, 0x8d, 0x00, 0x01, 0x80, 0x21, 0x2e, 0x8d, 0x00, 0x80, 0xa0, 0x1d,
+    0x07, 0xe0, 0x5f, 0x97, 0x50, 0x80, 0x2e, 0xda, 0xb4, 0x80, 0x3a, 0x04, 0x01, 0x8d, 0x00, 0x80, 0x36, 0x12, 0x2d,
+    0x41, 0x25, 0x42, 0x8a, 0x50, 0x50, 0x99, 0x52, 0x81, 0x80, 0x99, 0x09, 0xf5, 0x7f, 0x52, 0x25, 0x07, 0x52, 0x03,
+    0x8e, 0xd9, 0x08, 0x02, 0x40, 0x03, 0x81, 0x44, 0x83, 0x6c, 0xbb, 0xda, 0x0e, 0xe7, 0x7f, 0xdb, 0x7f, 0x20, 0x2f,
+    0x02, 0x41, 0x32, 0x1a, 0x1d, 0x2f, 0x42, 0x85, 0x80, 0x72, 0x0f, 0x09, 0xda, 0x0e, 0x03, 0x30, 0x05, 0x2f, 0xf1,
+    0x6f, 0x06, 0x30, 0x80, 0x1e, 0x1b, 0x18, 0x18, 0x2c, 0x42, 0x42, 0xbf, 0x85, 0x82, 0x00, 0x41, 0x40, 0x86, 0x40,
+    0x81, 0x8d, 0x86, 0x42, 0x20, 0x25, 0x13, 0x30, 0x06, 0x30, 0x97, 0x40, 0x81, 0x7f, 0x8d, 0xf9, 0x0f, 0x09, 0x2f,
+    0x85, 0xa3, 0xf9, 0x2f, 0x03, 0x30, 0x06, 0x2c, 0x06, 0x30, 0x9b, 0x52, 0xd9, 0x0e, 0x13, 0x30, 0x01, 0x30, 0xd9,
+    0x22, 0xc0, 0xb2, 0x12, 0x83, 0xc1, 0x7f, 0x03, 0x30, 0xb4, 0x7f, 0x06, 0x2f, 0x51, 0x30, 0x70, 0x25, 0x98, 0x2e,
+    0xe3, 0x03, 0xff, 0x81, 0x00, 0x2e, 0x03, 0x42, 0x43, 0x8b, 0xe0, 0x6f, 0xf1, 0x6f, 0x00, 0x40, 0x41, 0x40, 0xc8,
+    0x0f, 0x37, 0x2f, 0x00, 0x41, 0x80, 0xa7, 0x3c, 0x2f, 0x01, 0x83, 0x47, 0x8e, 0x42, 0x40, 0xfa, 0x01, 0x81, 0x84,
+    0x08, 0x89, 0x45, 0x41, 0x55, 0x0e, 0xc6, 0x43, 0x42, 0x42, 0xf4, 0x7f, 0x00, 0x2f, 0x43, 0x42, 0x51, 0x82, 0x70,
+    0x1a, 0x41, 0x40, 0x06, 0x2f, 0xc3, 0x6f, 0x41, 0x82, 0xc1, 0x42, 0xcd, 0x0e, 0x26, 0x2f, 0xc5, 0x42, 0x25, 0x2d,
+    0x7f, 0x82, 0x51, 0xbb, 0xa5, 0x00, 0xce, 0x0f, 0x12, 0x80, 0xbd, 0x1a, 0x3d, 0x30, 0xf7, 0x6f, 0x06, 0x30, 0x05,
+    0x2c, 0xe0, 0x7f, 0xd0, 0x41, 0x05, 0x1a, 0x23, 0x22, 0xb0, 0x01, 0x7a, 0x0e, 0xf9, 0x2f, 0x71, 0x0f, 0xe0, 0x6f,
+    0x28, 0x22, 0x41, 0x8b, 0x71, 0x22, 0x45, 0xa7, 0xee, 0x2f, 0xb3, 0x6f, 0xc2, 0x6f, 0xc0, 0x42, 0x81, 0x42, 0x08,
+    0x2d, 0x04, 0x25, 0xc4, 0x6f, 0x98, 0x2e, 0xea, 0x03, 0x00, 0x2e, 0x40, 0x41, 0x00, 0x43, 0x00, 0x30, 0xdb, 0x81,
+    0x67, 0x1d, 0x30, 0x10, 0x50, 0x03, 0x40, 0x19, 0x18, 0x37, 0x56, 0x19, 0x05, 0x36, 0x25, 0xf7, 0x7f, 0x4a, 0x17,
+    0x54, 0x18, 0xec, 0x18, 0x09, 0x17, 0x01, 0x30, 0x0c, 0x07, 0xe2, 0x18, 0xde, 0x00, 0xf2, 0x6f, 0x97, 0x02, 0x33,
+    0x58, 0xdc, 0x00, 0x91, 0x02, 0xbf, 0xb8, 0x21, 0xbd, 0x8a, 0x0a, 0xc0, 0x2e, 0x02, 0x80, 0x97, 0x06, 0xff, 0x45,
+    0x00, 0xde, 0xc4, 0x17, 0x00, 0x33, 0x93, 0x27, 0x18, 0x00, 0x35, 0x89, 0x3f, 0x18, 0x00, 0x37, 0xa5, 0x4d, 0x18,
+    0x00, 0x39, 0x89, 0x77, 0x18, 0x00, 0x37, 0x85, 0x85, 0x18, 0x02, 0x37, 0x52, 0x39, 0x8d, 0x91, 0x18, 0x02, 0x41,
+    0x56, 0x3b, 0x85, 0xa5, 0x18, 0x00, 0x41, 0x85, 0xaf, 0x18, 0x00, 0x43, 0x8d, 0xb9, 0x18, 0x00, 0x88, 0x91, 0xcb,
+    0x18, 0x00, 0x3f, 0x83, 0xe1, 0x18, 0x00, 0x3d, 0xc5, 0xe9, 0x18, 0x00, 0x45, 0xb9, 0x33, 0x19, 0x00, 0x4f, 0x85,
+    0x71, 0x19, 0x00, 0x47, 0x8f, 0x7b, 0x19, 0x02, 0x49, 0x52, 0x4b, 0xa0, 0x91, 0x19, 0xff, 0xb5, 0x19, 0x00, 0x37,
+    0xb7, 0x39, 0x1a, 0x00, 0x55, 0x89, 0x75, 0x1a, 0x00, 0x88, 0x81, 0x83, 0x1a, 0x00, 0x4f, 0xbf, 0x89, 0x1a, 0x00,
+    0x51, 0x99, 0xcd, 0x1a, 0x00, 0x53, 0x81, 0xeb, 0x1a, 0x00, 0x4d, 0x91, 0xf1, 0x1a, 0x00, 0x84, 0x8f, 0x07, 0x1b,
+    0x00, 0x5b, 0x8b, 0x1b, 0x1b, 0x02, 0x5d, 0x54, 0x5b, 0x9b, 0x2d, 0x1b, 0x00, 0x4d, 0x89, 0x4d, 0x1b, 0x00, 0x6c,
+    0x95, 0x5b, 0x1b, 0x04, 0xba, 0x03, 0x61, 0x52, 0x57, 0x83, 0x79, 0x1b, 0x00, 0x5f, 0x87, 0x81, 0x1b, 0x08, 0x87,
+    0x00, 0x37, 0x2e, 0x84, 0x00, 0x21, 0x2e, 0x86, 0x87, 0x95, 0x1b, 0x00, 0x84, 0x85, 0xa1, 0x1b, 0x00, 0x84, 0x89,
+    0xab, 0x1b, 0x00, 0x59, 0x83, 0xb9, 0x1b, 0x00, 0x84, 0x9b, 0xc1, 0x1b, 0x00, 0x35, 0x85, 0xe1, 0x1b, 0x00, 0x63,
+    0x8b, 0xeb, 0x1b, 0x02, 0x4f, 0x52, 0x65, 0x9d, 0xfd, 0x1b, 0x00, 0x55, 0xa5, 0x1f, 0x1c, 0x00, 0x84, 0x89, 0x49,
+    0x1c, 0x04, 0x86, 0x00, 0x21, 0x2e, 0x87, 0x81, 0x5b, 0x1c, 0x04, 0x87, 0x00, 0x03, 0x2e, 0x86, 0x87, 0x65, 0x1c,
+    0x00, 0x67, 0x95, 0x71, 0x1c, 0x00, 0x67, 0x83, 0x8b, 0x1c, 0x00, 0x69, 0x9f, 0x93, 0x1c, 0x00, 0x61, 0x83, 0xb7,
+    0x1c, 0x06, 0x3b, 0x52, 0x09, 0x2e, 0x57, 0x0f, 0x41, 0x8b, 0xc5, 0x1c, 0x00, 0x87, 0x89, 0xd5, 0x1c, 0x00, 0x79,
+    0x83, 0xe3, 0x1c, 0x01, 0x24, 0x02, 0x8c, 0xec, 0x1c, 0x00, 0x58, 0x85, 0xfd, 0x1c, 0x00, 0x3f, 0x87, 0x07, 0x1d,
+    0x00, 0x6b, 0x8b, 0x13, 0x1d, 0x00, 0x69, 0xad, 0x23, 0x1d, 0x00, 0x6d, 0x85, 0x55, 0x1d, 0x00, 0x6d, 0xa1, 0x5f,
+    0x1d, 0x00, 0x6f, 0x81, 0x85, 0x1d, 0x00, 0x71, 0x85, 0x8b, 0x1d, 0x00, 0x6d, 0x97, 0x95, 0x1d, 0x04, 0x75, 0x52,
+    0x93, 0x30, 0x53, 0x81, 0xb5, 0x1d, 0x0b, 0x4b, 0x42, 0x13, 0x30, 0x42, 0x82, 0x20, 0x33, 0x43, 0x42, 0xc8, 0x00,
+    0x80, 0xf6, 0x1d, 0x80, 0xe0, 0x1c, 0x06, 0x19, 0x52, 0xe2, 0x7f, 0xd0, 0x7f, 0xc3, 0x83, 0xd5, 0x1d, 0x07, 0x48,
+    0x0a, 0xd1, 0x7f, 0x3a, 0x25, 0xfb, 0x86, 0x86, 0xe4, 0x1d, 0x1b, 0x48, 0x0a, 0x40, 0xb2, 0x0d, 0x2f, 0xe0, 0x6f,
+    0x03, 0x2e, 0x80, 0x03, 0x53, 0x30, 0x07, 0x80, 0x27, 0x2e, 0x21, 0xf2, 0x98, 0xbc, 0x01, 0x42, 0x98, 0x2e, 0x91,
+    0x03, 0x82, 0xe8, 0x03, 0x10, 0xb1, 0x6f, 0x9b, 0xb8, 0x07, 0x2e, 0x1b, 0x00, 0x19, 0x1a, 0xb1, 0x7f, 0x71, 0x30,
+    0x04, 0x2f, 0x23, 0x8d, 0x21, 0x1e, 0x3a, 0x98, 0x2e, 0xdf, 0x03, 0x20, 0x26, 0xc1, 0x6f, 0x02, 0x31, 0x52, 0x42,
+    0xab, 0x30, 0x4b, 0x42, 0x20, 0x33, 0x77, 0x56, 0xf1, 0x37, 0xc4, 0x40, 0xa2, 0x0a, 0xc2, 0x42, 0xd8, 0x00, 0x01,
+    0x2e, 0x5e, 0xf7, 0x41, 0x08, 0x23, 0x2e, 0x94, 0x00, 0xe3, 0x7f, 0x98, 0x2e, 0xaa, 0x01, 0xe1, 0x6f, 0x83, 0x30,
+    0x43, 0x42, 0x03, 0x30, 0xfb, 0x6f, 0x73, 0x50, 0x02, 0x81, 0x9f, 0x1e, 0x02, 0x81, 0x84, 0x50, 0x83, 0xa7, 0x1e,
+    0x01, 0xb0, 0x5f, 0x80, 0xfe, 0x1d, 0x01, 0xb8, 0x2e, 0xec, 0xb6, 0x1e, 0xff, 0x46, 0x00, 0xff, 0x45, 0x00, 0x82,
+    0xfa, 0x01
+};
+
+/*! @name  Global structure that describes the compressed configuration file of BMI270_CONTEXT */
+const struct bmi2_config_blob bmi270_context_config_blob = {
+    .data = bmi270_context_config_blob_data,
+    .size = sizeof(bmi270_context_config_blob_data),
+    .raw_size = BMI2_CONFIG_FILE_SIZE,
+    .dict = bmi270_config_file,
+    .dict_size = BMI2_CONFIG_FILE_SIZE
+};
+#else
 /*! @name  Global array that stores the configuration file of BMI270_CONTEXT */
 const uint8_t bmi270_context_config_file[] = {
     0xc8, 0x2e, 0x00, 0x2e, 0x80, 0x2e, 0x00, 0xb0, 0xc8, 0x2e, 0x00, 0x2e, 0xc8, 0x2e, 0x00, 0x2e, 0x80, 0x2e, 0xc9,
@@ -482,6 +771,7 @@ const uint8_t bmi270_context_config_file[] = {
     0x80, 0x2e, 0x00, 0xc1, 0x80, 0x2e, 0x00, 0xc1, 0x80, 0x2e, 0x00, 0xc1, 0x80, 0x2e, 0x00, 0xc1, 0x80, 0x2e, 0x00,
     0xc1, 0xfd, 0x2d
 };
+#endif
 
 /*! @name  Global array that stores the feature input configuration of
  * BMI270_CONTEXT
@@ -515,6 +805,14 @@ struct bmi2_map_int bmi270_c_map_int[BMI270_C_MAX_INT_MAP] = {
     { .type = BMI2_STEP_DETECTOR, .sens_map_int = BMI270_C_INT_STEP_DETECTOR_MASK },
 };
 
+/*! @name  Global array that stores the feature configuration encoders of BMI270 context */
+const struct bmi2_feat_encoder bmi270_context_feat_enc[BMI270_CONTEXT_MAX_FEAT_ENC] = {
+    { .type = BMI2_STEP_DETECTOR, .feat = BMI2_STEP_COUNTER, .fields = bmi2_step_fields,
+      .n_fields = BMI2_STEP_N_FIELDS },
+    { .type = BMI2_STEP_COUNTER, .feat = BMI2_STEP_COUNTER, .fields = bmi2_step_fields,
+      .n_fields = BMI2_STEP_N_FIELDS }
+};
+
 /******************************************************************************/
 
 /*!         Local Function Prototypes
@@ -532,6 +830,16 @@ struct bmi2_map_int bmi270_c_map_int[BMI270_C_MAX_INT_MAP] = {
  */
 static int8_t null_ptr_check(const struct bmi2_dev *dev);
 
+/*!
+ * @brief This internal API assigns the feature configuration of BMI270_CONTEXT to the
+ * device structure.
+ *
+ * @param[in, out] dev : Structure instance of bmi2_dev.
+ *
+ * @return None
+ */
+static void assign_variant_tables(struct bmi2_dev *dev);
+
 /*!
  * @brief This internal API enables the selected sensor/features.
  *
@@ -633,31 +941,6 @@ static int8_t set_act_recog(uint8_t enable, struct bmi2_dev *dev);
  */
 static int8_t set_step_count_params_config(const uint16_t *step_count_params, struct bmi2_dev *dev);
 
-/*!
- * @brief This internal API sets step counter/detector/activity configurations.
- *
- * @param[in] config      : Structure instance of bmi2_step_config.
- * @param[in] dev         : Structure instance of bmi2_dev.
- *
- *---------------------------------------------------------------------------
- *    bmi2_step_config      |
- *  Structure parameters    |                 Description
- *--------------------------|--------------------------------------------------
- *                          | The Step-counter will trigger output every time
- *                          | the number of steps are counted. Holds implicitly
- *  water-mark level        | a 20x factor, so the range is 0 to 20460,
- *                          | with resolution of 20 steps.
- * -------------------------|---------------------------------------------------
- *  reset counter           | Flag to reset the counted steps.
- * -------------------------|---------------------------------------------------
- * @endverbatim
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t set_step_config(const struct bmi2_step_config *config, struct bmi2_dev *dev);
-
 /*!
  * @brief This internal API gets step counter parameter configurations.
  *
@@ -670,32 +953,6 @@ static int8_t set_step_config(const struct bmi2_step_config *config, struct bmi2
  */
 static int8_t get_step_count_params_config(uint16_t *step_count_params, struct bmi2_dev *dev);
 
-/*!
- * @brief This internal API gets step counter/detector/activity configurations.
- *
- * @param[out] config      : Structure instance of bmi2_step_config.
- * @param[in]  dev         : Structure instance of bmi2_dev.
- *
- * @verbatim
- *----------------------------------------------------------------------------
- *    bmi2_step_config      |
- *  Structure parameters    |                 Description
- *--------------------------|--------------------------------------------------
- *                          | The Step-counter will trigger output every time
- *                          | the number of steps are counted. Holds implicitly
- *  water-mark level        | a 20x factor, so the range is 0 to 20460,
- *                          | with resolution of 20 steps.
- * -------------------------|---------------------------------------------------
- *  reset counter           | Flag to reset the counted steps.
- * -------------------------|---------------------------------------------------
- * @endverbatim
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t get_step_config(struct bmi2_step_config *config, struct bmi2_dev *dev);
-
 /*!
  * @brief This internal API is used to parse and store the activity recognition
  * output from the FIFO data.
@@ -893,7 +1150,11 @@ int8_t bmi270_context_init(struct bmi2_dev *dev)
         dev->chip_id = BMI270_CONTEXT_CHIP_ID;
 
         /* Get the size of config array */
+#ifdef BMI2_COMPRESSED_CONFIG
+        dev->config_size = bmi270_context_config_blob.raw_size;
+#else
         dev->config_size = sizeof(bmi270_context_config_file);
+#endif
 
         /* Enable the variant specific features if any */
         dev->variant_feature = BMI2_CRT_RTOSK_ENABLE | BMI2_GYRO_CROSS_SENS_ENABLE;
@@ -908,53 +1169,72 @@ int8_t bmi270_context_init(struct bmi2_dev *dev)
             dev->dummy_byte = 0;
         }
 
+        /* A configuration file given by the caller is uploaded as it is */
+        dev->config_blob = NULL;
+
         /* If configuration file pointer is not assigned any address */
         if (!dev->config_file_ptr)
         {
             /* Give the address of the configuration file array to
              * the device pointer
              */
+#ifdef BMI2_COMPRESSED_CONFIG
+            dev->config_blob = &bmi270_context_config_blob;
+#else
             dev->config_file_ptr = bmi270_context_config_file;
+#endif
         }
 
         /* Initialize BMI2 sensor */
         rslt = bmi2_sec_init(dev);
         if (rslt == BMI2_OK)
         {
-            /* Assign the offsets of the feature input
-             * configuration to the device structure
-             */
-            dev->feat_config = bmi270_context_feat_in;
-
-            /* Assign the offsets of the feature output to
-             * the device structure
-             */
-            dev->feat_output = bmi270_context_feat_out;
+            /* Assign the feature configuration of the variant to the device structure */
+            assign_variant_tables(dev);
+        }
+    }
 
-            /* Assign the maximum number of pages to the
-             * device structure
-             */
-            dev->page_max = BMI270_CONTEXT_MAX_PAGE_NUM;
+    return rslt;
+}
 
-            /* Assign maximum number of input sensors/
-             * features to device structure
-             */
-            dev->input_sens = BMI270_CONTEXT_MAX_FEAT_IN;
+/*!
+ * @brief This API loads the configuration file of BMI270_CONTEXT into a sensor
+ * initialized with another BMI270 variant, without a soft-reset.
+ */
+int8_t bmi270_context_load_variant(struct bmi2_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
 
-            /* Assign maximum number of output sensors/
-             * features to device structure
-             */
-            dev->out_sens = BMI270_CONTEXT_MAX_FEAT_OUT;
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+    if (rslt == BMI2_OK)
+    {
+        /* Get the size of config array */
+#ifdef BMI2_COMPRESSED_CONFIG
+        dev->config_size = bmi270_context_config_blob.raw_size;
+#else
+        dev->config_size = sizeof(bmi270_context_config_file);
+#endif
 
-            /* Assign the offsets of the feature interrupt
-             * to the device structure
-             */
-            dev->map_int = bmi270_c_map_int;
+        /* Enable the variant specific features if any */
+        dev->variant_feature = BMI2_CRT_RTOSK_ENABLE | BMI2_GYRO_CROSS_SENS_ENABLE;
 
-            /* Assign maximum number of feature interrupts
-             * to device structure
-             */
-            dev->sens_int_map = BMI270_C_MAX_INT_MAP;
+        /* Replace the configuration file of the previous variant */
+#ifdef BMI2_COMPRESSED_CONFIG
+        dev->config_file_ptr = NULL;
+        dev->config_blob = &bmi270_context_config_blob;
+#else
+        dev->config_file_ptr = bmi270_context_config_file;
+        dev->config_blob = NULL;
+#endif
+
+        /* Write the configuration file */
+        rslt = bmi2_write_config_file(dev);
+        if (rslt == BMI2_OK)
+        {
+            /* Assign the feature configuration of the variant to the device structure */
+            assign_variant_tables(dev);
         }
     }
 
@@ -1035,64 +1315,61 @@ int8_t bmi270_context_set_sensor_config(struct bmi2_sens_config *sens_cfg, uint8
     uint8_t loop;
 
     /* Variable to get the status of advance power save */
-    uint8_t aps_stat = 0;
+    uint8_t aps_stat = BMI2_DISABLE;
 
     /* Null-pointer check */
     rslt = null_ptr_check(dev);
     if ((rslt == BMI2_OK) && (sens_cfg != NULL))
     {
-        /* Get status of advance power save mode */
-        aps_stat = dev->aps_status;
-
+        /* Disable advance power save once for all auxiliary and feature
+         * configurations
+         */
         for (loop = 0; loop < n_sens; loop++)
+        {
+            if ((sens_cfg[loop].type != BMI2_ACCEL) && (sens_cfg[loop].type != BMI2_GYRO) &&
+                (sens_cfg[loop].type != BMI2_AUX) && (sens_cfg[loop].type != BMI2_GYRO_GAIN_UPDATE) &&
+                (dev->aps_status == BMI2_ENABLE))
+            {
+                aps_stat = BMI2_ENABLE;
+                rslt = bmi2_set_adv_power_save(BMI2_DISABLE, dev);
+                break;
+            }
+        }
+
+        for (loop = 0; (loop < n_sens) && (rslt == BMI2_OK); loop++)
         {
             if ((sens_cfg[loop].type == BMI2_ACCEL) || (sens_cfg[loop].type == BMI2_GYRO) ||
                 (sens_cfg[loop].type == BMI2_AUX) || (sens_cfg[loop].type == BMI2_GYRO_GAIN_UPDATE))
             {
                 rslt = bmi2_set_sensor_config(&sens_cfg[loop], 1, dev);
             }
-            else
+            else if (bmi2_find_feat_encoder(sens_cfg[loop].type, bmi270_context_feat_enc,
+                                            BMI270_CONTEXT_MAX_FEAT_ENC) == NULL)
             {
-                /* Disable Advance power save if enabled for auxiliary
-                 * and feature configurations
-                 */
-                if (aps_stat == BMI2_ENABLE)
-                {
-                    /* Disable advance power save if
-                     * enabled
-                     */
-                    rslt = bmi2_set_adv_power_save(BMI2_DISABLE, dev);
-                }
-
-                if (rslt == BMI2_OK)
+                switch (sens_cfg[loop].type)
                 {
-                    switch (sens_cfg[loop].type)
-                    {
-                        /* Set the step counter parameters */
-                        case BMI2_STEP_COUNTER_PARAMS:
-                            rslt = set_step_count_params_config(sens_cfg[loop].cfg.step_counter_params, dev);
-                            break;
-
-                        /* Set step counter/detector/activity configuration */
-                        case BMI2_STEP_DETECTOR:
-                        case BMI2_STEP_COUNTER:
-                            rslt = set_step_config(&sens_cfg[loop].cfg.step_counter, dev);
-                            break;
-
-                        default:
-                            rslt = BMI2_E_INVALID_SENSOR;
-                            break;
-                    }
-                }
+                    /* Set the step counter parameters */
+                    case BMI2_STEP_COUNTER_PARAMS:
+                        rslt = set_step_count_params_config(sens_cfg[loop].cfg.step_counter_params, dev);
+                        break;
 
-                /* Return error if any of the set configurations fail */
-                if (rslt != BMI2_OK)
-                {
-                    break;
+                    default:
+                        rslt = BMI2_E_INVALID_SENSOR;
+                        break;
                 }
             }
         }
 
+        /* Set the table driven feature configurations, writing each page once */
+        if (rslt == BMI2_OK)
+        {
+            rslt = bmi2_set_feat_config_batch(sens_cfg,
+                                              n_sens,
+                                              bmi270_context_feat_enc,
+                                              BMI270_CONTEXT_MAX_FEAT_ENC,
+                                              dev);
+        }
+
         /* Enable Advance power save if disabled while configuring and
          * not when already disabled
          */
@@ -1121,67 +1398,58 @@ int8_t bmi270_context_get_sensor_config(struct bmi2_sens_config *sens_cfg, uint8
     uint8_t loop;
 
     /* Variable to get the status of advance power save */
-    uint8_t aps_stat = 0;
+    uint8_t aps_stat = BMI2_DISABLE;
 
     /* Null-pointer check */
     rslt = null_ptr_check(dev);
     if ((rslt == BMI2_OK) && (sens_cfg != NULL))
     {
-        /* Get status of advance power save mode */
-        aps_stat = dev->aps_status;
+        /* Disable advance power save once for all feature configurations */
         for (loop = 0; loop < n_sens; loop++)
+        {
+            if ((sens_cfg[loop].type >= BMI2_MAIN_SENS_MAX_NUM) && (sens_cfg[loop].type != BMI2_GYRO_GAIN_UPDATE) &&
+                (dev->aps_status == BMI2_ENABLE))
+            {
+                aps_stat = BMI2_ENABLE;
+                rslt = bmi2_set_adv_power_save(BMI2_DISABLE, dev);
+                break;
+            }
+        }
+
+        for (loop = 0; (loop < n_sens) && (rslt == BMI2_OK); loop++)
         {
             if ((sens_cfg[loop].type == BMI2_ACCEL) || (sens_cfg[loop].type == BMI2_GYRO) ||
                 (sens_cfg[loop].type == BMI2_AUX) || (sens_cfg[loop].type == BMI2_GYRO_GAIN_UPDATE))
             {
                 rslt = bmi2_get_sensor_config(&sens_cfg[loop], 1, dev);
             }
-            else
+            else if (bmi2_find_feat_encoder(sens_cfg[loop].type, bmi270_context_feat_enc,
+                                            BMI270_CONTEXT_MAX_FEAT_ENC) == NULL)
             {
-                /* Disable Advance power save if enabled for auxiliary
-                 * and feature configurations
-                 */
-                if ((sens_cfg[loop].type >= BMI2_MAIN_SENS_MAX_NUM) || (sens_cfg[loop].type == BMI2_AUX))
+                switch (sens_cfg[loop].type)
                 {
+                    /* Get the step counter parameters */
+                    case BMI2_STEP_COUNTER_PARAMS:
+                        rslt = get_step_count_params_config(sens_cfg[loop].cfg.step_counter_params, dev);
+                        break;
 
-                    if (aps_stat == BMI2_ENABLE)
-                    {
-                        /* Disable advance power save if
-                         * enabled
-                         */
-                        rslt = bmi2_set_adv_power_save(BMI2_DISABLE, dev);
-                    }
-                }
-
-                if (rslt == BMI2_OK)
-                {
-                    switch (sens_cfg[loop].type)
-                    {
-                        /* Set the step counter parameters */
-                        case BMI2_STEP_COUNTER_PARAMS:
-                            rslt = get_step_count_params_config(sens_cfg[loop].cfg.step_counter_params, dev);
-                            break;
-
-                        /* Get step counter/detector/activity configuration */
-                        case BMI2_STEP_DETECTOR:
-                        case BMI2_STEP_COUNTER:
-                            rslt = get_step_config(&sens_cfg[loop].cfg.step_counter, dev);
-                            break;
-
-                        default:
-                            rslt = BMI2_E_INVALID_SENSOR;
-                            break;
-                    }
-                }
-
-                /* Return error if any of the get configurations fail */
-                if (rslt != BMI2_OK)
-                {
-                    break;
+                    default:
+                        rslt = BMI2_E_INVALID_SENSOR;
+                        break;
                 }
             }
         }
 
+        /* Get the table driven feature configurations, reading each page once */
+        if (rslt == BMI2_OK)
+        {
+            rslt = bmi2_get_feat_config_batch(sens_cfg,
+                                              n_sens,
+                                              bmi270_context_feat_enc,
+                                              BMI270_CONTEXT_MAX_FEAT_ENC,
+                                              dev);
+        }
+
         /* Enable Advance power save if disabled while configuring and
          * not when already disabled
          */
@@ -1589,6 +1857,48 @@ static int8_t null_ptr_check(const struct bmi2_dev *dev)
     return rslt;
 }
 
+/*!
+ * @brief This internal API assigns the feature configuration of BMI270_CONTEXT to the
+ * device structure.
+ */
+static void assign_variant_tables(struct bmi2_dev *dev)
+{
+    /* Assign the offsets of the feature input
+     * configuration to the device structure
+     */
+    dev->feat_config = bmi270_context_feat_in;
+
+    /* Assign the offsets of the feature output to
+     * the device structure
+     */
+    dev->feat_output = bmi270_context_feat_out;
+
+    /* Assign the maximum number of pages to the
+     * device structure
+     */
+    dev->page_max = BMI270_CONTEXT_MAX_PAGE_NUM;
+
+    /* Assign maximum number of input sensors/
+     * features to device structure
+     */
+    dev->input_sens = BMI270_CONTEXT_MAX_FEAT_IN;
+
+    /* Assign maximum number of output sensors/
+     * features to device structure
+     */
+    dev->out_sens = BMI270_CONTEXT_MAX_FEAT_OUT;
+
+    /* Assign the offsets of the feature interrupt
+     * to the device structure
+     */
+    dev->map_int = bmi270_c_map_int;
+
+    /* Assign maximum number of feature interrupts
+     * to device structure
+     */
+    dev->sens_int_map = BMI270_C_MAX_INT_MAP;
+}
+
 /*!
  * @brief This internal API selects the sensor/features to be enabled or
  * disabled.
@@ -2010,77 +2320,6 @@ static int8_t set_step_count_params_config(const uint16_t *step_count_params, st
     return rslt;
 }
 
-/* @brief This internal API sets step counter configurations like water-mark
- * level, reset-counter and output-configuration step detector and activity.
- */
-static int8_t set_step_config(const struct bmi2_step_config *config, struct bmi2_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
-
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
-
-    /* Variable to define index */
-    uint8_t index = 0;
-
-    /* Variable to set flag */
-    uint8_t feat_found;
-
-    /* Initialize feature configuration for step counter 4 */
-    struct bmi2_feature_config step_count_config = { 0, 0, 0 };
-
-    /* Copy the feature configuration address to a local pointer */
-    uint16_t *data_p = (uint16_t *) (void *)feat_config;
-
-    /* Search for step counter feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&step_count_config, BMI2_STEP_COUNTER, dev);
-    if (feat_found)
-    {
-        /* Get the configuration from the page where step counter resides */
-        rslt = bmi2_get_feat_config(step_count_config.page, feat_config, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Define the offset in bytes */
-            idx = step_count_config.start_addr;
-
-            /* Get offset in words since all the features are set in words length */
-            idx = idx / 2;
-
-            /* Set water-mark level */
-            *(data_p + idx) = BMI2_SET_BIT_POS0(*(data_p + idx), BMI2_STEP_COUNT_WM_LEVEL, config->watermark_level);
-
-            /* Set reset-counter */
-            *(data_p + idx) = BMI2_SET_BITS(*(data_p + idx), BMI2_STEP_COUNT_RST_CNT, config->reset_counter);
-
-            /* Increment offset by 1 more word to get the total length in words */
-            idx++;
-
-            /* Get total length in bytes to copy from local pointer to the array */
-            idx = (uint8_t)(idx * 2) - step_count_config.start_addr;
-
-            /* Copy the bytes to be set back to the array */
-            for (index = 0; index < idx; index++)
-            {
-                feat_config[step_count_config.start_addr +
-                            index] = *((uint8_t *) data_p + step_count_config.start_addr + index);
-            }
-
-            /* Set the configuration back to the page */
-            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
-        }
-    }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
-
-    return rslt;
-}
-
 /*!
  * @brief This internal API gets step counter parameter configurations.
  */
@@ -2200,66 +2439,6 @@ static int8_t get_step_count_params_config(uint16_t *step_count_params, struct b
     return rslt;
 }
 
-/*!
- * @brief This internal API gets step counter/detector/activity configurations.
- */
-static int8_t get_step_config(struct bmi2_step_config *config, struct bmi2_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
-
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
-
-    /* Variable to define LSB */
-    uint16_t lsb = 0;
-
-    /* Variable to define MSB */
-    uint16_t msb = 0;
-
-    /* Variable to define a word */
-    uint16_t lsb_msb = 0;
-
-    /* Variable to set flag */
-    uint8_t feat_found;
-
-    /* Initialize feature configuration for step counter */
-    struct bmi2_feature_config step_count_config = { 0, 0, 0 };
-
-    /* Search for step counter 4 feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&step_count_config, BMI2_STEP_COUNTER, dev);
-    if (feat_found)
-    {
-        /* Get the configuration from the page where step counter 4 parameter resides */
-        rslt = bmi2_get_feat_config(step_count_config.page, feat_config, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Define the offset for feature enable for step counter/detector/activity */
-            idx = step_count_config.start_addr;
-
-            /* Get word to calculate water-mark level and reset counter */
-            lsb = (uint16_t) feat_config[idx++];
-            msb = ((uint16_t) feat_config[idx++] << 8);
-            lsb_msb = lsb | msb;
-
-            /* Get water-mark level */
-            config->watermark_level = lsb_msb & BMI2_STEP_COUNT_WM_LEVEL_MASK;
-
-            /* Get reset counter */
-            config->reset_counter = (lsb_msb & BMI2_STEP_COUNT_RST_CNT_MASK) >> BMI2_STEP_COUNT_RST_CNT_POS;
-        }
-    }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
-
-    return rslt;
-}
-
 /*!
  * @brief This internal API gets the output values of step counter.
  */
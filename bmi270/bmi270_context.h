@@ -90,6 +90,9 @@ extern "C" {
 /*! @name Defines maximum number of feature outputs */
 #define BMI270_CONTEXT_MAX_FEAT_OUT                  UINT8_C(5)
 
+/*! @name Defines maximum number of feature configuration encoders */
+#define BMI270_CONTEXT_MAX_FEAT_ENC                  UINT8_C(2)
+
 /*! @name Mask definitions for feature interrupt status bits */
 #define BMI270_CONTEXT_STEP_CNT_STATUS_MASK          UINT8_C(0x01)
 
@@ -132,6 +135,30 @@ extern "C" {
  */
 int8_t bmi270_context_init(struct bmi2_dev *dev);
 
+/*!
+ * \ingroup bmi270_contextApiInit
+ * \page bmi270_context_api_bmi270_context_load_variant bmi270_context_load_variant
+ * \code
+ * int8_t bmi270_context_load_variant(struct bmi2_dev *dev);
+ * \endcode
+ * @details This API switches a sensor initialized with another BMI270 variant
+ * to BMI270_CONTEXT without the soft-reset of bmi270_context_init:
+ *  1) updates the device structure with address of the configuration file.
+ *  2) Writes the configuration file.
+ *  3) Updates the feature offset parameters in the device structure.
+ *
+ * @note Register settings are kept across the switch, the features of the
+ * previous variant are not. A configuration file assigned by the user is
+ * replaced.
+ *
+ * @param[in, out] dev      : Structure instance of bmi2_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi270_context_load_variant(struct bmi2_dev *dev);
+
 /**
  * \ingroup bmi270_context
  * \defgroup bmi270_contextApiSensor Feature Set
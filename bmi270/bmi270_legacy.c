@@ -56,6 +56,297 @@ struct bmi2_tap_config *bmi270_legacy_config;
 /*!              Global Variable
  ****************************************************************************/
 
+#ifdef BMI2_COMPRESSED_CONFIG
+
+/*! @name  Configuration file of BMI270 which the compressed configuration file copies from */
+extern const uint8_t bmi270_config_file[];
+
+/*! @name  Global array that stores the configuration file of BMI270_LEGACY compressed
+ * against the configuration file of BMI270
+ */
+static const uint8_t bmi270_legacy_config_blob_data[] = {
+    0x82, 0x00, 0x00, 0x01, 0x3c, 0xb2, 0x82, 0x00, 0x00, 0x08, 0x9b, 0x03, 0x80, 0x2e, 0xa4, 0xb3, 0x80, 0x2e, 0xb8,
+    0x83, 0x17, 0x00, 0x01, 0xc4, 0xb2, 0x84, 0x20, 0x00, 0x80, 0xfc, 0x07, 0x82, 0x28, 0x00, 0x03, 0xe5, 0x01, 0x00,
+    0x5d, 0x80, 0x36, 0x00, 0x00, 0x77, 0x83, 0x3b, 0x00, 0x01, 0x45, 0xf5, 0xa5, 0x44, 0x00, 0xff, 0x45, 0x00, 0x01,
+    0x45, 0x5a, 0x9b, 0xa9, 0x01, 0x00, 0x5d, 0x80, 0x12, 0x01, 0x84, 0x1c, 0x01, 0x15, 0x00, 0x00, 0x30, 0x0a, 0x80,
+    0x40, 0x10, 0x27, 0xe8, 0x73, 0x04, 0x30, 0x00, 0x02, 0x00, 0x01, 0x00, 0x30, 0x10, 0x0b, 0x09, 0x08, 0x88, 0x24,
+    0x01, 0x02, 0x00, 0x00, 0x22, 0x89, 0x7d, 0x01, 0x16, 0x40, 0x00, 0x06, 0x00, 0x09, 0x00, 0x82, 0x00, 0x06, 0x00,
+    0x06, 0x00, 0x08, 0x00, 0x50, 0x00, 0x00, 0x00, 0x4c, 0x04, 0x02, 0x00, 0x03, 0xc0, 0xb7, 0x01, 0x86, 0x9b, 0x01,
+    0x85, 0xf1, 0x00, 0x19, 0x03, 0x00, 0x32, 0x01, 0xe6, 0x78, 0x84, 0x00, 0x9c, 0x6c, 0x07, 0x00, 0x64, 0x75, 0xaa,
+    0x7e, 0x5f, 0x05, 0xbe, 0x0a, 0x5f, 0x05, 0x96, 0xe8, 0xef, 0x41, 0x80, 0x52, 0x01, 0x06, 0x0c, 0x00, 0x4a, 0x00,
+    0xa0, 0x00, 0x00, 0x81, 0x53, 0x01, 0x86, 0xf1, 0x00, 0x00, 0xe0, 0x87, 0x9b, 0x01, 0x0b, 0x9a, 0x00, 0x9a, 0x01,
+    0x9f, 0x01, 0x88, 0x01, 0x96, 0x01, 0x84, 0x01, 0x86, 0x06, 0x02, 0x07, 0x98, 0xf1, 0x7b, 0x01, 0x7a, 0x01, 0x1e,
+    0xf2, 0x80, 0xa8, 0x02, 0x05, 0x76, 0x01, 0x7e, 0x01, 0x80, 0x00, 0x80, 0xae, 0x02, 0x0c, 0xc8, 0x00, 0xcb, 0x00,
+    0xcb, 0x00, 0xd2, 0x00, 0x81, 0x01, 0x69, 0xf5, 0xe0, 0x85, 0x15, 0x02, 0x01, 0xff, 0x00, 0x80, 0x1e, 0x02, 0x11,
+    0xba, 0xf1, 0xae, 0xf1, 0xa0, 0x00, 0xdf, 0x00, 0xa2, 0x01, 0xfa, 0x00, 0xfc, 0x00, 0xff, 0x3f, 0xff, 0xfb, 0x80,
+    0xa4, 0x02, 0x08, 0xb3, 0x01, 0xba, 0x01, 0xbc, 0x01, 0xc2, 0x01, 0xca, 0x81, 0x2b, 0x02, 0x06, 0x8e, 0x01, 0x74,
+    0xf7, 0x00, 0x40, 0x5f, 0x85, 0xb9, 0x02, 0x06, 0x59, 0x0f, 0x4d, 0x0f, 0x53, 0x0f, 0x72, 0x81, 0xcb, 0x02, 0x13,
+    0x75, 0x0f, 0x00, 0x80, 0x86, 0x00, 0x64, 0x0f, 0x77, 0x0f, 0xb3, 0xf1, 0x71, 0x0f, 0x6c, 0xf7, 0xb9, 0xf1, 0xc6,
+    0xf1, 0x82, 0xde, 0x02, 0x07, 0x79, 0x0f, 0x7c, 0x0f, 0xff, 0x03, 0x00, 0xfc, 0x80, 0xea, 0x02, 0x0a, 0x90, 0x00,
+    0x95, 0x00, 0x92, 0x00, 0x98, 0x00, 0x8d, 0x00, 0xa2, 0x83, 0xf1, 0x02, 0x12, 0x7c, 0x01, 0x20, 0xf2, 0xdb, 0x01,
+    0x00, 0x08, 0x00, 0xf8, 0xe8, 0x03, 0x01, 0x80, 0xb8, 0x7e, 0xe1, 0x7a, 0xf0, 0x80, 0xf3, 0x00, 0x8d, 0xa7, 0x01,
+    0x02, 0xa9, 0x00, 0x01, 0xda, 0xfc, 0x02, 0xff, 0xfc, 0x02, 0x82, 0x76, 0x06, 0x02, 0x00, 0xb0, 0x1d, 0x8d, 0x6b,
+    0x16, 0x00, 0x1f, 0xaf, 0x7d, 0x16, 0x08, 0x21, 0x50, 0x10, 0x50, 0x23, 0x52, 0x05, 0x2e, 0xd5, 0x8b, 0xb9, 0x16,
+    0x01, 0x91, 0x03, 0x82, 0xca, 0x16, 0x01, 0x70, 0x01, 0x90, 0xd2, 0x16, 0x01, 0x70, 0x01, 0x82, 0xe8, 0x16, 0x01,
+    0x2e, 0x02, 0x80, 0xb4, 0x07, 0x80, 0x02, 0x0b, 0x80, 0xf4, 0x16, 0x02, 0x25, 0x54, 0x27, 0x85, 0xff, 0x16, 0x00,
+    0x29, 0xa1, 0x09, 0x17, 0x3c, 0x01, 0x2e, 0x7e, 0x01, 0x01, 0x8a, 0xf0, 0x50, 0x50, 0x41, 0x1a, 0x25, 0x03, 0xbd,
+    0x71, 0x82, 0x02, 0xbe, 0x2f, 0xb9, 0x42, 0x42, 0x81, 0xbd, 0x45, 0x41, 0x4f, 0xba, 0xf1, 0x7f, 0xbf, 0xb8, 0x0f,
+    0xb8, 0x5c, 0xb9, 0x24, 0x7f, 0x00, 0xb2, 0x31, 0x7f, 0xeb, 0x7f, 0xd2, 0x7f, 0x08, 0x2f, 0x10, 0x6f, 0x00, 0x90,
+    0x0b, 0x2f, 0x20, 0x6f, 0x00, 0x90, 0x08, 0x2f, 0x30, 0x80, 0x2f, 0x0a, 0x81, 0xcb, 0x0c, 0x02, 0x7d, 0x00, 0xd0,
+    0x81, 0x93, 0x0c, 0x81, 0xe0, 0x1c, 0x0a, 0x90, 0x00, 0x30, 0x2b, 0x52, 0x2f, 0x56, 0x07, 0x2f, 0x2b, 0x58, 0x80,
+    0x8c, 0x14, 0x03, 0x63, 0x0e, 0xfc, 0x2f, 0x80, 0x32, 0x09, 0x33, 0x7d, 0x00, 0x09, 0x2e, 0x7e, 0x01, 0x02, 0x85,
+    0x13, 0x41, 0x04, 0x41, 0xb1, 0xbd, 0xb1, 0xb9, 0x44, 0xbe, 0x82, 0x40, 0x44, 0xba, 0x24, 0xbd, 0xb3, 0x7f, 0x5c,
+    0x05, 0x24, 0xb9, 0x01, 0x56, 0x2d, 0x58, 0x92, 0x7f, 0xa5, 0x7f, 0x80, 0x7f, 0xc0, 0x7f, 0x73, 0x7f, 0x64, 0x7f,
+    0x00, 0x2e, 0xf2, 0x6f, 0x40, 0x7f, 0x80, 0x92, 0x19, 0x09, 0x90, 0x40, 0xf2, 0x7f, 0x00, 0x90, 0x04, 0x2f, 0x51,
+    0x6f, 0x80, 0xb8, 0x1c, 0x05, 0x45, 0x2c, 0x62, 0x6f, 0xc1, 0x40, 0x80, 0x6e, 0x0d, 0x01, 0x51, 0x6f, 0x80, 0x08,
+    0x19, 0x1b, 0xc0, 0xb2, 0x2d, 0x2f, 0x62, 0x6f, 0xa5, 0x6f, 0x84, 0x40, 0xc5, 0x0e, 0x07, 0x2f, 0x75, 0x6f, 0x10,
+    0x30, 0x45, 0x41, 0x40, 0xa1, 0x05, 0x30, 0x05, 0x22, 0x20, 0x1a, 0x80, 0x0a, 0x18, 0x76, 0x40, 0x42, 0x2c, 0x2d,
+    0x10, 0x30, 0x18, 0x28, 0x93, 0x6f, 0x40, 0x42, 0xc3, 0x0e, 0x25, 0x2f, 0xc0, 0x6f, 0x00, 0x90, 0x22, 0x2f, 0x45,
+    0x6f, 0x10, 0x30, 0xc5, 0x14, 0x46, 0xbf, 0xb3, 0xbf, 0xb7, 0x0b, 0x2b, 0x58, 0x65, 0x01, 0x2f, 0x5e, 0x0b, 0x30,
+    0x25, 0x1a, 0x00, 0x2f, 0x0b, 0x43, 0x01, 0x89, 0x2d, 0x2e, 0x79, 0x01, 0x67, 0x0e, 0xf7, 0x2f, 0x80, 0x7f, 0xc3,
+    0x7f, 0x0e, 0x2d, 0xb2, 0x6f, 0xc2, 0x0e, 0x08, 0x2f, 0x10, 0x30, 0x40, 0x42, 0x02, 0x30, 0x74, 0x6f, 0x63, 0x6f,
+    0x04, 0x41, 0x00, 0xa1, 0x02, 0x22, 0xc0, 0x42, 0x00, 0x2e, 0x62, 0x6f, 0x40, 0x6f, 0x73, 0x6f, 0x01, 0x80, 0xc1,
+    0x86, 0x81, 0x84, 0x41, 0x82, 0x03, 0xa2, 0x62, 0x7f, 0x73, 0x7f, 0xa4, 0x2f, 0xeb, 0x6f, 0xd0, 0x6f, 0x81, 0x6f,
+    0x10, 0x81, 0x0b, 0x0d, 0x5f, 0x03, 0x2e, 0x7f, 0x01, 0x41, 0x84, 0x50, 0x50, 0x90, 0x40, 0x82, 0x40, 0x83, 0xbd,
+    0xbf, 0xb9, 0x2c, 0xba, 0xfb, 0x7f, 0xc0, 0xb2, 0xe4, 0x7f, 0x0b, 0x30, 0x36, 0x2f, 0x07, 0x2e, 0x7e, 0x00, 0xc0,
+    0x90, 0x04, 0x2f, 0xc1, 0x86, 0x27, 0x2e, 0x7e, 0x00, 0x37, 0x2e, 0x7f, 0x00, 0xa4, 0xbd, 0x04, 0xbd, 0x34, 0xb8,
+    0x41, 0x40, 0x91, 0xbc, 0x91, 0xb9, 0xb3, 0x7f, 0x24, 0xb9, 0x09, 0x52, 0xc0, 0x7f, 0xd2, 0x7f, 0x98, 0x2e, 0xb3,
+    0xc0, 0xd1, 0x6f, 0xb2, 0x6f, 0x51, 0x28, 0x41, 0x0f, 0x11, 0x30, 0x0d, 0x2f, 0xc2, 0x0e, 0x07, 0x2e, 0x7f, 0x00,
+    0x19, 0x28, 0x04, 0x2f, 0xc0, 0xa6, 0x80, 0x1e, 0x1e, 0x19, 0x7f, 0x00, 0x02, 0x2d, 0x21, 0x2e, 0x7f, 0x00, 0x04,
+    0x2c, 0x02, 0x30, 0x02, 0x30, 0x25, 0x2e, 0x7f, 0x00, 0xc0, 0x6f, 0x07, 0x2e, 0x7f, 0x00, 0x58, 0x0f, 0x80, 0x20,
+    0x12, 0x03, 0xb0, 0x5f, 0x4a, 0x22, 0x80, 0x0c, 0x0d, 0x00, 0xe0, 0x83, 0x47, 0x16, 0x82, 0xac, 0x07, 0x80, 0x66,
+    0x1d, 0x8a, 0xf2, 0x07, 0x80, 0xfc, 0x17, 0xfd, 0xa0, 0x06, 0x80, 0x63, 0x17, 0x8b, 0x4d, 0x17, 0x23, 0xd5, 0x00,
+    0x20, 0x50, 0xf6, 0x7f, 0xe7, 0x7f, 0x00, 0x2e, 0x35, 0x5c, 0x00, 0x2e, 0x87, 0x41, 0xff, 0xbf, 0xff, 0xbb, 0xc0,
+    0x91, 0x02, 0x2f, 0x37, 0x30, 0x2f, 0x2e, 0x69, 0xf5, 0xb8, 0x8f, 0x06, 0x32, 0xc7, 0x41, 0x86, 0x2e, 0x07, 0x01,
+    0x95, 0x01, 0x88, 0x3a, 0x07, 0x10, 0x30, 0x50, 0xe5, 0x7f, 0xf6, 0x7f, 0xd7, 0x7f, 0x00, 0x2e, 0x35, 0x5a, 0x00,
+    0x2e, 0x46, 0x41, 0x6f, 0x80, 0xad, 0x15, 0x08, 0x91, 0x02, 0x2f, 0x36, 0x30, 0x2d, 0x2e, 0x69, 0xf5, 0x84, 0x4c,
+    0x07, 0x01, 0x77, 0x8b, 0x82, 0x54, 0x07, 0x01, 0x6b, 0x01, 0x84, 0x5c, 0x07, 0x11, 0xde, 0x00, 0x86, 0x30, 0x46,
+    0x43, 0x00, 0x2e, 0xf6, 0x6f, 0xe5, 0x6f, 0xd7, 0x6f, 0xd0, 0x5f, 0xc8, 0x2e, 0x88, 0x2e, 0x17, 0x04, 0x02, 0x30,
+    0x30, 0x30, 0x11, 0x81, 0x3b, 0x17, 0x0a, 0x25, 0x2e, 0x7e, 0x00, 0x25, 0x2e, 0xce, 0x00, 0x21, 0x2e, 0xdf, 0x81,
+    0x47, 0x0b, 0x09, 0x23, 0x2e, 0xfe, 0x00, 0x21, 0x2e, 0x78, 0x01, 0xb8, 0x2e, 0x92, 0x86, 0x17, 0x04, 0x40, 0x50,
+    0x98, 0x2e, 0xbd, 0x81, 0xdd, 0x03, 0x00, 0x48, 0x81, 0xe3, 0x03, 0x05, 0xe0, 0x7f, 0x21, 0x2e, 0x69, 0xf5, 0x8a,
+    0xe8, 0x03, 0x27, 0x05, 0x2e, 0xa8, 0x00, 0x2f, 0xbc, 0xae, 0xbc, 0xad, 0xbd, 0x0f, 0xb8, 0x9f, 0xb8, 0x01, 0x0a,
+    0x05, 0x2e, 0x93, 0x00, 0xbf, 0xb9, 0xaf, 0xb8, 0x03, 0x0a, 0x01, 0x0a, 0x21, 0x2e, 0x7a, 0x00, 0x98, 0x2e, 0xeb,
+    0xb5, 0x03, 0x2e, 0x9d, 0x01, 0x80, 0xb8, 0x04, 0x02, 0x40, 0xb2, 0x1a, 0x81, 0x1d, 0x04, 0x00, 0x01, 0x83, 0x23,
+    0x04, 0x17, 0xa8, 0x00, 0x9c, 0xbc, 0x9f, 0xb8, 0x23, 0x2e, 0xdd, 0x00, 0x40, 0x90, 0xf0, 0x7f, 0x03, 0x2f, 0x01,
+    0x52, 0x98, 0x2e, 0x4c, 0xb6, 0x03, 0x2d, 0x80, 0x10, 0x04, 0x01, 0x4c, 0xb6, 0x80, 0xb0, 0x05, 0x02, 0x4b, 0x02,
+    0x10, 0x81, 0xdb, 0x05, 0x03, 0x01, 0x2e, 0x99, 0x01, 0x80, 0x02, 0x04, 0x82, 0xbc, 0x04, 0x04, 0x03, 0x2f, 0x05,
+    0x50, 0x07, 0x83, 0x11, 0x04, 0x04, 0x87, 0x01, 0x00, 0xb2, 0x35, 0x81, 0x1d, 0x04, 0x00, 0x09, 0x83, 0x23, 0x04,
+    0x01, 0x93, 0x01, 0x84, 0x2c, 0x04, 0x00, 0x7b, 0x85, 0x35, 0x04, 0x05, 0x93, 0x01, 0x98, 0x2e, 0x88, 0xb5, 0x81,
+    0xf2, 0x09, 0x0b, 0xb2, 0x1e, 0x2f, 0x98, 0x2e, 0x78, 0xb4, 0x98, 0x2e, 0x49, 0xb5, 0x09, 0x81, 0x4d, 0x04, 0x00,
+    0x09, 0x84, 0x53, 0x04, 0x14, 0x02, 0x81, 0x3f, 0x01, 0x2e, 0x79, 0x01, 0x01, 0x08, 0x09, 0x52, 0xd0, 0x7f, 0x21,
+    0x2e, 0x79, 0x01, 0x98, 0x2e, 0xff, 0xc5, 0x80, 0xda, 0x1d, 0x08, 0x21, 0x2e, 0x79, 0x01, 0x98, 0x2e, 0xc3, 0xb1,
+    0x10, 0x81, 0xdb, 0x05, 0x80, 0x2e, 0x0e, 0x82, 0x72, 0x04, 0x02, 0x2e, 0x02, 0x00, 0x81, 0xbb, 0x0d, 0x03, 0x01,
+    0x2e, 0x6b, 0x01, 0x82, 0x84, 0x04, 0x01, 0x87, 0x01, 0x80, 0x02, 0x04, 0x04, 0x09, 0x52, 0x98, 0x2e, 0x74, 0x83,
+    0x95, 0x04, 0x80, 0x58, 0x1c, 0x80, 0xaa, 0x04, 0x80, 0xa4, 0x04, 0x05, 0x72, 0xb1, 0x01, 0x2e, 0x6e, 0x01, 0x82,
+    0x72, 0x04, 0x00, 0x15, 0x81, 0xb5, 0x04, 0x04, 0xde, 0x00, 0x01, 0x2e, 0xde, 0x83, 0xbf, 0x04, 0x01, 0x6b, 0x01,
+    0x82, 0xc8, 0x04, 0x00, 0x05, 0x81, 0xcf, 0x04, 0x05, 0x5d, 0x0d, 0x01, 0x2e, 0x6b, 0x01, 0x84, 0xda, 0x04, 0x00,
+    0x48, 0x81, 0xe3, 0x04, 0x04, 0xde, 0x00, 0x01, 0x2e, 0xd6, 0x81, 0xed, 0x04, 0x04, 0x8a, 0xb1, 0x01, 0x2e, 0xd6,
+    0x8d, 0xf7, 0x04, 0x00, 0x7c, 0x81, 0x09, 0x05, 0x00, 0xd6, 0x89, 0x0f, 0x05, 0x01, 0x6b, 0x01, 0x82, 0x1e, 0x05,
+    0x00, 0x13, 0x81, 0x25, 0x05, 0x00, 0x0d, 0x8f, 0x2b, 0x05, 0x00, 0x13, 0x97, 0x3f, 0x05, 0x01, 0xf5, 0x03, 0x82,
+    0x5c, 0x05, 0x05, 0x6b, 0x01, 0x98, 0x2e, 0xf5, 0x03, 0x84, 0x68, 0x05, 0x00, 0xd1, 0x81, 0x71, 0x05, 0x04, 0x48,
+    0x03, 0x13, 0x52, 0x0b, 0x81, 0x7b, 0x05, 0x00, 0x11, 0x81, 0x81, 0x05, 0x00, 0xd2, 0x85, 0x87, 0x05, 0x01, 0x6b,
+    0x01, 0x80, 0x92, 0x05, 0x01, 0xf5, 0x03, 0x82, 0x98, 0x05, 0x05, 0x6b, 0x01, 0x01, 0x2e, 0x6b, 0x01, 0x82, 0xa4,
+    0x05, 0x06, 0x78, 0x00, 0x0f, 0x54, 0x0b, 0x52, 0xd0, 0x81, 0xb1, 0x05, 0x00, 0xd1, 0x85, 0xb7, 0x05, 0x01, 0x6b,
+    0x01, 0x80, 0xc2, 0x05, 0x01, 0x24, 0xb6, 0x80, 0xde, 0x03, 0x00, 0x48, 0x81, 0xcd, 0x05, 0x00, 0x1e, 0x81, 0xb5,
+    0x04, 0x06, 0x6b, 0x01, 0x41, 0x30, 0x01, 0x2e, 0xd6, 0x81, 0x0f, 0x05, 0x05, 0x26, 0x2f, 0x01, 0x2e, 0x71, 0x01,
+    0x80, 0xf0, 0x1d, 0x01, 0x01, 0x90, 0x80, 0x4e, 0x11, 0x0c, 0xbf, 0x00, 0x07, 0x2e, 0x72, 0x01, 0xa1, 0x32, 0x17,
+    0x58, 0x98, 0x2e, 0xae, 0x81, 0x79, 0x04, 0x28, 0x71, 0x01, 0x12, 0x2d, 0x15, 0x58, 0xa3, 0x32, 0x10, 0x41, 0x11,
+    0x41, 0x18, 0xb9, 0x04, 0x41, 0x98, 0xbc, 0x41, 0x0a, 0x94, 0x0a, 0x98, 0x2e, 0xa0, 0xb7, 0x11, 0x30, 0x21, 0x2e,
+    0x72, 0x01, 0x21, 0x2e, 0x7b, 0x01, 0x23, 0x2e, 0x71, 0x01, 0x10, 0x80, 0xdb, 0x05, 0x81, 0xd9, 0x05, 0x00, 0xd6,
+    0x81, 0xdf, 0x05, 0x01, 0x6b, 0x01, 0x82, 0xe6, 0x05, 0x05, 0x2b, 0x0e, 0x01, 0x2e, 0x6b, 0x01, 0x88, 0xf2, 0x05,
+    0x00, 0x41, 0x81, 0xff, 0x05, 0x01, 0x38, 0xb6, 0x80, 0x3a, 0x04, 0x00, 0xd7, 0x81, 0x0b, 0x06, 0x01, 0x48, 0x03,
+    0x82, 0xea, 0x04, 0x00, 0x29, 0x83, 0x19, 0x06, 0x06, 0x6c, 0x01, 0x19, 0x54, 0x41, 0x0a, 0xbc, 0x80, 0x21, 0x09,
+    0x25, 0x01, 0x83, 0x80, 0x74, 0x30, 0x23, 0x40, 0x05, 0x40, 0x1b, 0x50, 0x81, 0x40, 0xdc, 0x08, 0x18, 0xb9, 0x11,
+    0x42, 0xd3, 0xbe, 0xe4, 0x6f, 0xc5, 0xbc, 0xdd, 0x0a, 0x12, 0x42, 0x59, 0x0a, 0x11, 0x42, 0xd0, 0x7f, 0xf1, 0x31,
+    0x00, 0x80, 0x47, 0x06, 0x82, 0x91, 0x17, 0x83, 0x51, 0x06, 0x02, 0xc1, 0x6f, 0xd2, 0x83, 0x5b, 0x06, 0x01, 0x0c,
+    0x02, 0x80, 0x3a, 0x04, 0x05, 0x9d, 0x01, 0x21, 0x2e, 0x99, 0x01, 0x80, 0xdc, 0x05, 0x27, 0x21, 0x2e, 0x87, 0x01,
+    0x80, 0x2e, 0x09, 0xb0, 0x01, 0x2e, 0x80, 0x01, 0x01, 0x40, 0x90, 0x50, 0x9f, 0xbd, 0x13, 0xbd, 0xbf, 0xb9, 0x2c,
+    0xb9, 0xfb, 0x7f, 0xe2, 0x7f, 0xc0, 0xb2, 0x0b, 0x30, 0x62, 0x2f, 0x07, 0x2e, 0xce, 0x00, 0x31, 0x54, 0x80, 0x0c,
+    0x09, 0x36, 0x9b, 0x42, 0xc1, 0x86, 0x9b, 0x42, 0x27, 0x2e, 0xce, 0x00, 0x37, 0x2e, 0xcf, 0x00, 0x37, 0x2e, 0xd0,
+    0x00, 0x37, 0x2e, 0xd1, 0x00, 0x8b, 0x42, 0x01, 0x84, 0x17, 0xbc, 0x83, 0x40, 0x32, 0xbd, 0x99, 0xbc, 0x9a, 0xba,
+    0xba, 0xbd, 0x0e, 0xb8, 0x28, 0xb9, 0xba, 0xb9, 0x09, 0x58, 0x1a, 0x25, 0x0d, 0x2e, 0xcf, 0x00, 0x77, 0x82, 0x85,
+    0x81, 0x81, 0x19, 0x00, 0x93, 0x81, 0x27, 0x1d, 0x06, 0x98, 0x2e, 0xd1, 0xc3, 0x03, 0x2e, 0xcf, 0x81, 0x17, 0x1e,
+    0x01, 0x01, 0x30, 0x80, 0x00, 0x0d, 0x45, 0xd1, 0x00, 0x01, 0x2e, 0xd1, 0x00, 0xd1, 0x6f, 0x41, 0x0e, 0x14, 0x2f,
+    0xc1, 0x6f, 0x40, 0xb2, 0x0b, 0x2f, 0x43, 0xb2, 0x09, 0x2f, 0x09, 0x54, 0x31, 0x56, 0x98, 0x2e, 0x0b, 0xc4, 0x00,
+    0x90, 0x06, 0x2f, 0xb1, 0x6f, 0x23, 0x2e, 0xd0, 0x00, 0x03, 0x2d, 0xb1, 0x6f, 0x23, 0x2e, 0xd0, 0x00, 0xd1, 0x6f,
+    0x23, 0x2e, 0xd1, 0x00, 0x03, 0x2e, 0xd1, 0x00, 0x41, 0x82, 0x23, 0x2e, 0xd1, 0x00, 0x09, 0x50, 0x31, 0x52, 0x12,
+    0x40, 0x80, 0x46, 0x1b, 0x03, 0x12, 0x40, 0x52, 0x42, 0x80, 0xb0, 0x0a, 0x80, 0xc6, 0x1b, 0x03, 0x03, 0x2e, 0xd0,
+    0x00, 0x82, 0x12, 0x0d, 0x0c, 0xb1, 0x6f, 0x23, 0x2e, 0xcf, 0x00, 0x06, 0x2d, 0x37, 0x2e, 0xce, 0x00, 0xe0, 0x83,
+    0x47, 0x16, 0x02, 0xfb, 0x6f, 0x70, 0x81, 0x21, 0x0d, 0x0c, 0x80, 0x7f, 0x91, 0x7f, 0xd7, 0x7f, 0xc5, 0x7f, 0xb3,
+    0x7f, 0xa2, 0x7f, 0xe4, 0x83, 0x87, 0x09, 0x06, 0x35, 0x50, 0x00, 0x2e, 0x01, 0x40, 0x9f, 0x81, 0xfb, 0x0a, 0x0f,
+    0x02, 0x2f, 0x31, 0x30, 0x23, 0x2e, 0x69, 0xf5, 0x38, 0x82, 0x61, 0x7f, 0x20, 0x30, 0x41, 0x40, 0x80, 0x54, 0x1c,
+    0x80, 0x62, 0x1c, 0x06, 0x08, 0x08, 0x00, 0xb2, 0x11, 0x2f, 0x33, 0x81, 0xa3, 0x0a, 0x03, 0x32, 0x7f, 0x73, 0x82,
+    0x80, 0xa6, 0x0a, 0x80, 0xb0, 0x0a, 0x00, 0x50, 0x81, 0xb5, 0x0a, 0x0d, 0x01, 0x2e, 0x61, 0xf7, 0x01, 0x31, 0x01,
+    0x0a, 0x21, 0x2e, 0x61, 0xf7, 0x80, 0x30, 0x80, 0x62, 0x1c, 0x04, 0x08, 0x08, 0x00, 0xb2, 0x40, 0x81, 0x15, 0x05,
+    0x05, 0x17, 0xbc, 0x96, 0xbc, 0x0f, 0xb8, 0x80, 0xfc, 0x0a, 0x03, 0x21, 0x2e, 0x6f, 0x01, 0x84, 0xdc, 0x0a, 0x01,
+    0x6b, 0x01, 0x88, 0xe6, 0x0a, 0x00, 0xd6, 0x9b, 0xf3, 0x0a, 0x00, 0x37, 0x85, 0x13, 0x0b, 0x01, 0xe9, 0x01, 0x86,
+    0x1e, 0x0b, 0x01, 0x6b, 0x01, 0x80, 0x2a, 0x0b, 0x01, 0x24, 0xb6, 0x80, 0x3a, 0x04, 0x00, 0xd6, 0x8b, 0x35, 0x0b,
+    0x80, 0x58, 0x1c, 0x80, 0x54, 0x1c, 0x03, 0x60, 0x6f, 0xe1, 0x31, 0x80, 0xe2, 0x08, 0x06, 0xf6, 0x6f, 0xe4, 0x6f,
+    0x80, 0x6f, 0x91, 0x81, 0x57, 0x0b, 0x12, 0xc5, 0x6f, 0xd7, 0x6f, 0x7b, 0x6f, 0x30, 0x5f, 0xc8, 0x2e, 0xa0, 0x50,
+    0x82, 0x7f, 0x90, 0x7f, 0xd7, 0x7f, 0xc5, 0x81, 0x09, 0x08, 0x00, 0xe4, 0x83, 0x87, 0x09, 0x09, 0x35, 0x54, 0x00,
+    0x2e, 0x80, 0x40, 0x0f, 0xbc, 0x0f, 0xb8, 0x80, 0xc8, 0x04, 0x80, 0x9c, 0x1b, 0x09, 0x69, 0xf5, 0xb7, 0x84, 0x62,
+    0x7f, 0x98, 0x2e, 0xe9, 0x01, 0x80, 0xee, 0x04, 0x0f, 0x7f, 0xb3, 0x05, 0x2e, 0xa0, 0x00, 0x03, 0x2e, 0x8c, 0x00,
+    0x01, 0x2e, 0x8e, 0x00, 0xa3, 0xbd, 0x80, 0xd2, 0x0a, 0x39, 0x08, 0x0a, 0xbf, 0xb9, 0xa4, 0xbc, 0x03, 0x0a, 0x22,
+    0xbe, 0x9f, 0xb8, 0x07, 0x2e, 0x96, 0x00, 0x41, 0x0a, 0x4f, 0xba, 0x05, 0x2e, 0x98, 0x00, 0xb3, 0xbd, 0x0c, 0x0b,
+    0x01, 0x2e, 0x90, 0x00, 0xbf, 0xb9, 0x2f, 0xbd, 0x03, 0x2e, 0x9f, 0x00, 0x2f, 0xb9, 0x0f, 0xbc, 0xe3, 0x0a, 0x0f,
+    0xb8, 0x9f, 0xbc, 0x9a, 0x0a, 0x9f, 0xb8, 0x90, 0x0a, 0x91, 0x0a, 0x80, 0x2a, 0x0a, 0x86, 0x6c, 0x08, 0x00, 0x7b,
+    0x83, 0x77, 0x08, 0x80, 0x86, 0x04, 0x04, 0x6b, 0x01, 0x04, 0xa2, 0x07, 0x83, 0xf1, 0x09, 0x80, 0x86, 0x08, 0x80,
+    0xd0, 0x16, 0x09, 0x19, 0x2f, 0x3b, 0x50, 0x09, 0x52, 0x98, 0x2e, 0x01, 0x02, 0x80, 0x74, 0x17, 0x03, 0x25, 0x2e,
+    0x87, 0x01, 0x80, 0x74, 0x17, 0x80, 0x72, 0x18, 0x80, 0x14, 0x11, 0x01, 0xd8, 0x00, 0x82, 0xce, 0x16, 0x05, 0x10,
+    0x30, 0x05, 0x2e, 0x79, 0x00, 0x80, 0xa0, 0x08, 0x11, 0x79, 0x00, 0x25, 0x2e, 0xd9, 0x00, 0x98, 0x2e, 0xf2, 0x01,
+    0x00, 0xb2, 0x22, 0x30, 0x21, 0x30, 0x03, 0x2f, 0x80, 0xbc, 0x04, 0x80, 0x30, 0x0a, 0x0f, 0x01, 0x2e, 0x7a, 0x00,
+    0x00, 0x90, 0x30, 0x30, 0x01, 0x30, 0x41, 0x22, 0x01, 0x2e, 0x94, 0x01, 0x82, 0xc4, 0x08, 0x04, 0x94, 0x01, 0x33,
+    0x30, 0x3d, 0x81, 0xcf, 0x08, 0x00, 0x39, 0x87, 0xd5, 0x08, 0x00, 0x25, 0x83, 0xe1, 0x08, 0x00, 0x79, 0x8f, 0xe9,
+    0x08, 0x00, 0xdc, 0x8f, 0xfd, 0x08, 0x0a, 0x3f, 0x56, 0x04, 0x30, 0xd4, 0x42, 0xd2, 0x42, 0x81, 0x04, 0x24, 0x81,
+    0x1d, 0x09, 0x04, 0xc4, 0x42, 0x23, 0x2e, 0xdc, 0x87, 0x25, 0x09, 0x03, 0x6d, 0x01, 0x81, 0x80, 0x80, 0x86, 0x07,
+    0x18, 0x21, 0x2e, 0x6d, 0x01, 0x0f, 0x56, 0x62, 0x6f, 0x4b, 0x08, 0x00, 0x31, 0x80, 0x42, 0x40, 0xb2, 0x0b, 0x2f,
+    0xf2, 0x3e, 0x01, 0x2e, 0xca, 0xf5, 0x82, 0x8d, 0x51, 0x09, 0x02, 0xf6, 0x6f, 0xe4, 0x81, 0x63, 0x09, 0x02, 0xc5,
+    0x6f, 0xd7, 0x81, 0x6f, 0x09, 0x02, 0x90, 0x6f, 0x60, 0x81, 0x75, 0x09, 0x02, 0x80, 0x7f, 0x92, 0x85, 0x05, 0x08,
+    0x00, 0xe7, 0x83, 0x87, 0x09, 0x06, 0x35, 0x50, 0x00, 0x2e, 0x02, 0x40, 0x2f, 0x83, 0xed, 0x1c, 0x07, 0x32, 0x30,
+    0x25, 0x2e, 0x69, 0xf5, 0x37, 0x80, 0x84, 0xb0, 0x0a, 0x1a, 0xe9, 0x01, 0x0b, 0x30, 0x5b, 0x7f, 0x40, 0x7f, 0x02,
+    0x32, 0x64, 0x6f, 0x25, 0x52, 0x43, 0x56, 0x0b, 0x30, 0x80, 0x2e, 0x65, 0xb4, 0x62, 0x09, 0x40, 0xb3, 0x0b, 0x81,
+    0xab, 0x09, 0x09, 0x0b, 0x2e, 0x79, 0x00, 0x40, 0x91, 0x03, 0x2f, 0xc2, 0x8a, 0x80, 0xc6, 0x09, 0x00, 0x4b, 0x81,
+    0xd1, 0x09, 0x09, 0x21, 0x09, 0x00, 0xb3, 0x79, 0x2f, 0x98, 0x2e, 0xf2, 0x01, 0x80, 0xe0, 0x09, 0x82, 0xbc, 0x04,
+    0x02, 0x02, 0x2f, 0x40, 0x83, 0xed, 0x09, 0x00, 0xdb, 0x85, 0xf5, 0x09, 0x00, 0xdb, 0x81, 0xff, 0x09, 0x01, 0x0d,
+    0xb6, 0x8e, 0x06, 0x0a, 0x07, 0x45, 0x50, 0x07, 0x52, 0x98, 0x2e, 0x01, 0x02, 0x80, 0x26, 0x00, 0x0b, 0x99, 0x01,
+    0x02, 0x30, 0x50, 0x7f, 0x25, 0x2e, 0xdb, 0x00, 0x40, 0x6f, 0x80, 0x0a, 0x04, 0x13, 0x05, 0x2e, 0x7a, 0x00, 0x80,
+    0x90, 0x0e, 0x2f, 0x05, 0x2e, 0xda, 0x00, 0x80, 0x90, 0x36, 0x2f, 0x11, 0x30, 0x02, 0x30, 0x80, 0xe2, 0x0c, 0x1b,
+    0x23, 0x2e, 0x74, 0x01, 0x25, 0x2e, 0x7d, 0x00, 0x25, 0x2e, 0x9e, 0x01, 0x2c, 0x2d, 0x05, 0x2e, 0x9e, 0x01, 0x81,
+    0x82, 0x23, 0x2e, 0x9e, 0x01, 0x12, 0x30, 0x4a, 0x08, 0x82, 0x8e, 0x07, 0x1f, 0x58, 0xf5, 0x98, 0xbc, 0x9e, 0xb8,
+    0x43, 0x90, 0x1a, 0x2f, 0x01, 0x2e, 0xc1, 0xf5, 0x0e, 0xbd, 0x30, 0x30, 0x2e, 0xb9, 0x82, 0x04, 0x01, 0x52, 0x47,
+    0x50, 0x62, 0x7f, 0x98, 0x2e, 0x01, 0x02, 0x80, 0x16, 0x04, 0x0d, 0x01, 0x90, 0x49, 0x50, 0x03, 0x52, 0x02, 0x2f,
+    0x62, 0x6f, 0x98, 0x2e, 0x01, 0x02, 0x80, 0x14, 0x11, 0x03, 0x9d, 0x01, 0x00, 0x30, 0x81, 0xfa, 0x0c, 0x00, 0x6f,
+    0x80, 0xae, 0x0a, 0x0d, 0x52, 0x6f, 0x80, 0x90, 0x05, 0x2f, 0x02, 0x30, 0x25, 0x2e, 0x94, 0x01, 0x25, 0x54, 0x80,
+    0xc6, 0x09, 0x00, 0x25, 0x83, 0x41, 0x0a, 0x36, 0x43, 0x56, 0x0b, 0x30, 0x00, 0x90, 0x0b, 0x2f, 0x37, 0x2e, 0xd8,
+    0x00, 0x41, 0x50, 0x21, 0x2e, 0x5a, 0xf2, 0x98, 0x2e, 0xdd, 0x03, 0x40, 0x6f, 0x02, 0x32, 0x25, 0x52, 0x43, 0x56,
+    0x0b, 0x30, 0x09, 0x2e, 0x60, 0xf5, 0x62, 0x09, 0x40, 0x91, 0x90, 0x2e, 0xc9, 0xb3, 0x61, 0x09, 0x40, 0x91, 0x90,
+    0x2e, 0xc9, 0xb3, 0x80, 0x6f, 0x92, 0x84, 0x63, 0x09, 0x81, 0x6f, 0x0a, 0x00, 0xe7, 0x81, 0x75, 0x0a, 0x00, 0x4b,
+    0x83, 0xcf, 0x14, 0x4a, 0xf8, 0xbc, 0x9c, 0xb9, 0x01, 0x2e, 0x9f, 0x00, 0xf3, 0x7f, 0x8f, 0xbd, 0x3f, 0xba, 0x1a,
+    0x25, 0x78, 0xb8, 0x59, 0x56, 0xd3, 0x08, 0x75, 0x8c, 0x73, 0x8a, 0xeb, 0x7f, 0xfc, 0xbf, 0xd4, 0x7f, 0x0b, 0x30,
+    0xfc, 0xbb, 0x1c, 0x0b, 0x4b, 0x7f, 0x8b, 0x43, 0x4b, 0x43, 0x21, 0x2e, 0xe4, 0x00, 0x00, 0xb3, 0xa7, 0x7f, 0xb5,
+    0x7f, 0xc6, 0x7f, 0x93, 0x7f, 0x90, 0x2e, 0x35, 0xb5, 0x01, 0x2e, 0xfe, 0x00, 0x00, 0xb2, 0x0b, 0x2f, 0x4f, 0x52,
+    0x01, 0x2e, 0xf9, 0x87, 0x1b, 0x15, 0x08, 0xfe, 0x00, 0x82, 0x6f, 0x93, 0x6f, 0x1a, 0x25, 0xc0, 0x81, 0x2f, 0x15,
+    0x05, 0x26, 0xbc, 0x25, 0xbd, 0x06, 0xb8, 0x80, 0x52, 0x05, 0x07, 0x14, 0xb0, 0x0c, 0x2f, 0x51, 0x50, 0x53, 0x54,
+    0x80, 0x46, 0x15, 0x06, 0xa0, 0x00, 0x57, 0x58, 0x1b, 0x42, 0x9b, 0x81, 0x51, 0x15, 0x10, 0xa0, 0x00, 0x0b, 0x42,
+    0x8b, 0x42, 0x86, 0x7f, 0x70, 0x84, 0x5b, 0x50, 0xd8, 0x08, 0x55, 0x52, 0x09, 0x85, 0x67, 0x15, 0x00, 0xd1, 0x83,
+    0x71, 0x15, 0x0a, 0xf9, 0x00, 0xc5, 0x6f, 0xb4, 0x6f, 0x72, 0x6f, 0x4f, 0x52, 0x4d, 0x81, 0x83, 0x15, 0x04, 0x53,
+    0x6f, 0x90, 0x6f, 0x51, 0x87, 0x8d, 0x15, 0x00, 0xd1, 0x87, 0x99, 0x15, 0x00, 0x53, 0x8b, 0xa5, 0x15, 0x04, 0x36,
+    0x6f, 0x26, 0x01, 0x46, 0x85, 0xb9, 0x15, 0x06, 0xfa, 0x00, 0x53, 0x52, 0x14, 0x2f, 0x53, 0xaf, 0xc9, 0x15, 0x10,
+    0xc2, 0x7f, 0x00, 0x90, 0x06, 0x2f, 0x31, 0x30, 0x23, 0x2e, 0x78, 0x01, 0x23, 0x2e, 0xdf, 0x00, 0x0b, 0x80, 0x15,
+    0x16, 0x05, 0x2e, 0xdf, 0x00, 0x05, 0x2e, 0x78, 0x83, 0x09, 0x16, 0x02, 0x78, 0x01, 0x01, 0x85, 0x99, 0x0c, 0x00,
+    0xc1, 0x83, 0x21, 0x16, 0x06, 0xd2, 0x6f, 0x21, 0x52, 0x01, 0x2e, 0xfa, 0x81, 0x2f, 0x16, 0x14, 0x11, 0x2c, 0x42,
+    0x42, 0x10, 0x30, 0x31, 0x30, 0x21, 0x2e, 0xfe, 0x00, 0x23, 0x2e, 0x78, 0x01, 0x23, 0x2e, 0xdf, 0x00, 0xf0, 0x80,
+    0x47, 0x16, 0x89, 0x43, 0x16, 0x82, 0xa4, 0x14, 0x09, 0x07, 0x2e, 0x9f, 0x00, 0x3b, 0xbc, 0x60, 0x50, 0xbf, 0xbd,
+    0x80, 0x38, 0x0c, 0x24, 0xc0, 0xb2, 0xeb, 0x7f, 0x2d, 0x2f, 0x07, 0x2e, 0xff, 0x00, 0xc3, 0x40, 0x01, 0x2e, 0x69,
+    0x01, 0x03, 0x1a, 0x11, 0x2f, 0x5f, 0x52, 0x27, 0x2e, 0x69, 0x01, 0x50, 0x40, 0xa0, 0x7f, 0x78, 0x80, 0x43, 0x40,
+    0xd0, 0x7f, 0xb3, 0x85, 0x61, 0x0c, 0x24, 0xa3, 0x6f, 0x13, 0x42, 0x00, 0x2e, 0xb3, 0x6f, 0x03, 0x42, 0x03, 0x30,
+    0x01, 0x2e, 0xdf, 0x00, 0x01, 0xb2, 0x01, 0x2f, 0x02, 0x90, 0x00, 0x2f, 0x13, 0x30, 0x1a, 0x25, 0x7c, 0x88, 0x01,
+    0x2e, 0xff, 0x00, 0x5d, 0x52, 0x09, 0x98, 0x8b, 0x0c, 0x89, 0x67, 0x0b, 0x00, 0x6b, 0x8d, 0x75, 0x0b, 0x02, 0x09,
+    0x50, 0x67, 0x83, 0x89, 0x0b, 0x00, 0x61, 0x8b, 0x91, 0x0b, 0x00, 0x63, 0x8b, 0xa1, 0x0b, 0x00, 0x65, 0x8d, 0xb1,
+    0x0b, 0x00, 0x6d, 0xa1, 0xc3, 0x0b, 0x00, 0x69, 0xc0, 0xe9, 0x0b, 0xa9, 0x73, 0x07, 0x01, 0x6a, 0x01, 0x82, 0xa2,
+    0x07, 0x01, 0x0d, 0xb6, 0x82, 0xaa, 0x07, 0x01, 0x6a, 0x01, 0x8a, 0xb2, 0x07, 0x00, 0x61, 0x81, 0xc1, 0x07, 0x00,
+    0x63, 0x81, 0xc7, 0x07, 0x00, 0x05, 0x83, 0xcd, 0x07, 0x00, 0x65, 0x89, 0xd5, 0x07, 0x03, 0x6a, 0x01, 0xb8, 0x2e,
+    0x80, 0x5e, 0x17, 0x05, 0x6c, 0x01, 0x03, 0x2e, 0x6c, 0x01, 0x82, 0x68, 0x17, 0x00, 0x7c, 0x83, 0x6f, 0x17, 0x01,
+    0x6f, 0x01, 0x88, 0x78, 0x17, 0x01, 0x70, 0x01, 0x88, 0x9c, 0x17, 0x00, 0xde, 0x80, 0x91, 0x1b, 0x81, 0xad, 0x17,
+    0x01, 0xf5, 0x03, 0x80, 0xe8, 0x0e, 0x01, 0x6b, 0x01, 0x84, 0xba, 0x17, 0x19, 0x24, 0xb6, 0x01, 0x2e, 0xa8, 0x00,
+    0x31, 0x25, 0x08, 0xbd, 0x71, 0x30, 0x20, 0x50, 0x2c, 0xb9, 0x01, 0x09, 0xf2, 0x7f, 0x00, 0x91, 0xeb, 0x7f, 0x0a,
+    0x2f, 0x84, 0x9a, 0x0c, 0x09, 0x13, 0x30, 0x27, 0x2e, 0x74, 0x01, 0xeb, 0x6f, 0xc0, 0x2e, 0x80, 0xdc, 0x07, 0x03,
+    0x01, 0x2e, 0x74, 0x01, 0x80, 0xee, 0x0c, 0x19, 0x06, 0x30, 0xc3, 0x50, 0x98, 0x2e, 0x84, 0xb6, 0x2d, 0x2e, 0x74,
+    0x01, 0x05, 0x2e, 0x73, 0x01, 0x8b, 0x80, 0xc3, 0x52, 0x04, 0x42, 0x98, 0x2e, 0xbf, 0xb6, 0x80, 0xea, 0x0c, 0x01,
+    0xf1, 0x7f, 0x80, 0x94, 0x0c, 0x00, 0xf0, 0x81, 0x49, 0x0a, 0x0a, 0x01, 0x2e, 0x75, 0x01, 0x02, 0x2d, 0x21, 0x2e,
+    0x75, 0x01, 0xeb, 0x81, 0x35, 0x12, 0x0d, 0x0a, 0x82, 0x02, 0x30, 0x12, 0x42, 0x41, 0x0e, 0xfc, 0x2f, 0x37, 0x80,
+    0xc5, 0x52, 0x80, 0x6c, 0x0c, 0x01, 0xc7, 0x52, 0x80, 0x86, 0x1c, 0x1b, 0x07, 0x88, 0x46, 0x8e, 0x06, 0x41, 0x3c,
+    0x8b, 0x32, 0x1a, 0x42, 0x41, 0xc7, 0x41, 0x16, 0x2f, 0x80, 0x91, 0x23, 0x2f, 0x57, 0x0f, 0x16, 0x30, 0x0c, 0x2f,
+    0x06, 0x80, 0x80, 0xb0, 0x0a, 0x80, 0x36, 0x04, 0x80, 0x02, 0x10, 0x29, 0x41, 0x40, 0xd1, 0x0f, 0x02, 0x2f, 0x06,
+    0x30, 0x06, 0x43, 0x46, 0x43, 0x80, 0xb3, 0x11, 0x2f, 0x03, 0x43, 0x47, 0x43, 0xb8, 0x2e, 0xd7, 0x0e, 0x0c, 0x2f,
+    0x43, 0x82, 0x17, 0x04, 0x41, 0x40, 0x41, 0x0f, 0x07, 0x2f, 0x03, 0x43, 0x42, 0x83, 0x47, 0x43, 0x80, 0x08, 0x19,
+    0x46, 0xc1, 0x86, 0x43, 0x42, 0xb8, 0x2e, 0xb8, 0x2e, 0x88, 0x88, 0xc0, 0x50, 0x39, 0x8d, 0x88, 0x81, 0xe2, 0x7f,
+    0x02, 0x30, 0x05, 0x40, 0xf2, 0x7f, 0x41, 0xab, 0x22, 0x30, 0x95, 0x22, 0x86, 0x41, 0x27, 0x5e, 0x9a, 0x00, 0x04,
+    0x41, 0x37, 0x18, 0x66, 0x01, 0xc9, 0x56, 0xeb, 0x00, 0xc1, 0x7f, 0xb3, 0x7f, 0xd5, 0x7f, 0x48, 0x82, 0x39, 0x80,
+    0x82, 0x40, 0xa0, 0x7f, 0x91, 0x7f, 0x8b, 0x7f, 0x06, 0x30, 0x6f, 0x5a, 0xcb, 0x58, 0x6f, 0x81, 0x55, 0x0d, 0x05,
+    0x91, 0x6f, 0x7b, 0x82, 0xc6, 0x6f, 0x80, 0x1e, 0x1b, 0x61, 0x42, 0x42, 0x43, 0x82, 0x83, 0x8b, 0x42, 0x40, 0x86,
+    0x89, 0x7b, 0x82, 0x84, 0x87, 0x71, 0x7f, 0x80, 0xb2, 0x95, 0x7f, 0x64, 0x7f, 0x50, 0x7f, 0x02, 0x2f, 0xc5, 0x40,
+    0x41, 0x8b, 0xc5, 0x42, 0x87, 0x89, 0x67, 0x40, 0x07, 0x0f, 0x85, 0x8b, 0x41, 0x7f, 0x82, 0x8d, 0x47, 0x40, 0x3c,
+    0x2f, 0x81, 0x41, 0x01, 0x0e, 0xe1, 0x6f, 0x2d, 0x2f, 0x46, 0x8c, 0x90, 0x6f, 0x86, 0x41, 0x07, 0x40, 0xfe, 0x0e,
+    0x02, 0x2f, 0x04, 0x41, 0x00, 0xb3, 0x21, 0x2f, 0x44, 0x82, 0x04, 0x30, 0x41, 0x40, 0x71, 0x00, 0xf9, 0x0e, 0x36,
+    0x2f, 0x46, 0x41, 0x80, 0xa7, 0x01, 0x30, 0x04, 0x30, 0x0d, 0x2f, 0xe4, 0x6f, 0x80, 0x74, 0x13, 0x1a, 0x74, 0x0f,
+    0x04, 0x30, 0x07, 0x2f, 0x80, 0x90, 0x00, 0x2f, 0xc1, 0x42, 0x03, 0x86, 0x81, 0x84, 0xc2, 0x42, 0x01, 0x42, 0x14,
+    0x30, 0x42, 0x85, 0x41, 0x43, 0xa1, 0x81, 0x71, 0x0f, 0x35, 0x80, 0x90, 0x1c, 0x2f, 0x01, 0x42, 0x1b, 0x2d, 0x06,
+    0x42, 0x19, 0x2c, 0x04, 0x30, 0xb2, 0x6f, 0xba, 0x04, 0x02, 0x1e, 0x80, 0x43, 0x12, 0x30, 0xc0, 0x6f, 0x23, 0x30,
+    0x98, 0x2e, 0x90, 0xb6, 0x0e, 0x2c, 0x04, 0x30, 0xb2, 0x6f, 0xc0, 0x6f, 0xba, 0x00, 0x51, 0x6f, 0x01, 0x86, 0x4a,
+    0x1c, 0xc1, 0x42, 0x22, 0x30, 0xe1, 0x6f, 0x80, 0x78, 0x0b, 0x79, 0x90, 0xb6, 0x04, 0x30, 0x52, 0x6f, 0xcd, 0x52,
+    0x40, 0x6f, 0xc4, 0x7f, 0x98, 0x2e, 0xa0, 0xcc, 0x41, 0x6f, 0x70, 0x6f, 0x42, 0x40, 0xcf, 0x52, 0x98, 0x2e, 0xa0,
+    0xcc, 0x41, 0x6f, 0x70, 0x6f, 0x42, 0x40, 0x01, 0x40, 0xd3, 0x6f, 0xd3, 0x00, 0xcb, 0x1e, 0xcf, 0x52, 0x13, 0x42,
+    0xb0, 0x7f, 0x98, 0x2e, 0xa0, 0xcc, 0xb0, 0x6f, 0x3e, 0x84, 0xd1, 0x6f, 0x82, 0x40, 0x03, 0x40, 0x51, 0x04, 0x59,
+    0x1c, 0x01, 0x42, 0x02, 0x82, 0xa0, 0x6f, 0x42, 0x40, 0x03, 0x40, 0xd3, 0x0f, 0x00, 0x30, 0x14, 0x30, 0x60, 0x22,
+    0xc5, 0x6f, 0x40, 0x91, 0x01, 0x2f, 0x53, 0x0e, 0x26, 0x2f, 0xe5, 0x6f, 0x47, 0x85, 0x00, 0x2e, 0x83, 0x40, 0x59,
+    0x0f, 0x20, 0x2f, 0x62, 0x6f, 0x4a, 0x8f, 0x85, 0x40, 0xc7, 0x41, 0x7f, 0x8d, 0x6f, 0x0f, 0xa6, 0x15, 0x17, 0x30,
+    0x80, 0x7c, 0x13, 0x1f, 0xe0, 0x6f, 0x0b, 0x80, 0x00, 0x2e, 0x07, 0x40, 0x3e, 0x08, 0x00, 0xb2, 0x00, 0x30, 0x06,
+    0x2f, 0x59, 0x1a, 0x04, 0x2f, 0xfd, 0x12, 0xc0, 0x90, 0x13, 0x30, 0x4b, 0x22, 0x06, 0x25, 0x71, 0x25, 0x80, 0x30,
+    0x07, 0x0e, 0xa4, 0x42, 0xa4, 0x42, 0x83, 0x82, 0x84, 0x42, 0x44, 0x42, 0x00, 0x2e, 0x8b, 0x6f, 0x40, 0x81, 0x69,
+    0x1d, 0x0c, 0x0a, 0x25, 0x3c, 0x80, 0xfb, 0x7f, 0x01, 0x42, 0xd2, 0x7f, 0xe3, 0x7f, 0x32, 0x81, 0xc3, 0x12, 0x04,
+    0x7a, 0xc1, 0xfb, 0x6f, 0xc0, 0x84, 0xcd, 0x1b, 0x13, 0x80, 0xf3, 0x7f, 0x03, 0x42, 0xa1, 0x7f, 0xc2, 0x7f, 0xd1,
+    0x7f, 0x03, 0x30, 0x03, 0x43, 0xe4, 0x7f, 0xbb, 0x7f, 0x22, 0x81, 0xc3, 0x12, 0x49, 0x7a, 0xc1, 0xd2, 0x6f, 0x02,
+    0x17, 0x04, 0x08, 0xc1, 0x6f, 0x0c, 0x09, 0x04, 0x1a, 0x10, 0x30, 0x04, 0x30, 0x20, 0x22, 0x01, 0xb2, 0x14, 0x2f,
+    0xd1, 0x58, 0x14, 0x09, 0xf3, 0x30, 0x93, 0x08, 0x24, 0xbd, 0x44, 0xba, 0x94, 0x0a, 0x02, 0x17, 0xf3, 0x6f, 0x4c,
+    0x08, 0x9a, 0x08, 0x8a, 0x0a, 0x9d, 0x52, 0x51, 0x08, 0x41, 0x58, 0x94, 0x08, 0x28, 0xbd, 0x98, 0xb8, 0xe4, 0x6f,
+    0x51, 0x0a, 0x01, 0x43, 0x00, 0x2e, 0xbb, 0x6f, 0x90, 0x5f, 0xb8, 0x2e, 0xde, 0xc4, 0x17, 0x00, 0x6f, 0x93, 0x27,
+    0x18, 0x02, 0x77, 0x56, 0x71, 0x85, 0xa5, 0x18, 0x00, 0x77, 0x85, 0xaf, 0x18, 0x00, 0x79, 0x8d, 0xb9, 0x18, 0x01,
+    0x6f, 0x01, 0x90, 0xcc, 0x18, 0x00, 0x75, 0x83, 0xe1, 0x18, 0x00, 0x73, 0xb9, 0xe9, 0x18, 0x00, 0xd0, 0x81, 0x63,
+    0x19, 0x00, 0xcf, 0x81, 0x69, 0x19, 0x26, 0xf6, 0x0d, 0x6b, 0x87, 0x81, 0x54, 0xe1, 0x7f, 0xa3, 0x7f, 0xb3, 0x7f,
+    0xb2, 0x88, 0x7b, 0x52, 0xc2, 0x7f, 0x65, 0x8b, 0x7d, 0x56, 0x84, 0x7f, 0x61, 0x7f, 0x75, 0x7f, 0xd0, 0x7f, 0x95,
+    0x7f, 0x53, 0x7f, 0x14, 0x30, 0x7f, 0x54, 0x81, 0x81, 0x97, 0x19, 0x12, 0x53, 0x40, 0x45, 0x8c, 0x42, 0x40, 0x90,
+    0x41, 0xbb, 0x83, 0x86, 0x41, 0xd8, 0x04, 0x16, 0x06, 0x00, 0xac, 0x81, 0x81, 0xaf, 0x19, 0x26, 0xd3, 0x04, 0x10,
+    0x06, 0xc1, 0x84, 0x01, 0x30, 0xc1, 0x02, 0x0b, 0x16, 0x04, 0x09, 0x14, 0x01, 0x99, 0x02, 0xc1, 0xb9, 0xaf, 0xbc,
+    0x59, 0x0a, 0x64, 0x6f, 0x51, 0x43, 0xa1, 0xb4, 0x12, 0x41, 0x13, 0x41, 0x41, 0x43, 0x35, 0x7f, 0x64, 0xd9, 0xdb,
+    0x19, 0x00, 0x89, 0x8d, 0x39, 0x1a, 0x05, 0x33, 0x6f, 0xa4, 0x6f, 0xc1, 0x42, 0x82, 0x50, 0x1a, 0x26, 0x33, 0x6f,
+    0x00, 0x2e, 0x42, 0x6f, 0x55, 0x6f, 0x91, 0x40, 0x42, 0x8b, 0x00, 0x41, 0x41, 0x00, 0x01, 0x43, 0x55, 0x7f, 0x14,
+    0x30, 0xc1, 0x40, 0x95, 0x40, 0x4d, 0x02, 0xc5, 0x6f, 0x87, 0x50, 0x68, 0x0e, 0x75, 0x6f, 0xd1, 0x42, 0xa3, 0x81,
+    0x7d, 0x1a, 0x0b, 0x6f, 0x01, 0x01, 0xb3, 0x22, 0x2f, 0x81, 0x58, 0x90, 0x6f, 0x17, 0x30, 0xba, 0x8c, 0x1a, 0x0b,
+    0x44, 0x2d, 0x83, 0x54, 0x01, 0x32, 0x89, 0x58, 0x05, 0x30, 0x41, 0x50, 0x80, 0x8e, 0x1c, 0x1d, 0x91, 0x01, 0xb8,
+    0xbd, 0x38, 0xb5, 0xe6, 0x7f, 0x0a, 0x16, 0xb1, 0x6f, 0x2a, 0xbb, 0xa6, 0xbd, 0x1c, 0x01, 0x06, 0xbc, 0x52, 0x40,
+    0x06, 0x0a, 0x53, 0x40, 0x45, 0x03, 0xb1, 0x7f, 0x82, 0x44, 0x1a, 0x2d, 0x1a, 0xbd, 0x16, 0xb6, 0x86, 0xba, 0x00,
+    0xa9, 0xaa, 0x0a, 0x67, 0x52, 0x0f, 0x2f, 0x00, 0x91, 0x67, 0x52, 0x03, 0x2f, 0x67, 0x5a, 0x55, 0x0f, 0x67, 0x52,
+    0x08, 0x2f, 0x3f, 0xa1, 0x04, 0x2f, 0x3f, 0x91, 0x03, 0x2f, 0x89, 0x58, 0xd4, 0x0f, 0x00, 0x2f, 0x89, 0x54, 0x12,
+    0x25, 0x82, 0x92, 0x18, 0x0b, 0xe4, 0x6f, 0xf5, 0x37, 0x45, 0x09, 0x21, 0x85, 0x05, 0x43, 0x05, 0x30, 0x80, 0xf4,
+    0x13, 0x06, 0x01, 0x32, 0x89, 0x58, 0xc5, 0x2f, 0x25, 0x89, 0xf1, 0x1a, 0x00, 0x30, 0x83, 0xff, 0x1a, 0x01, 0x6b,
+    0x01, 0x80, 0x08, 0x1b, 0x1d, 0x5d, 0x2f, 0x01, 0xb2, 0x54, 0x2f, 0x02, 0xb2, 0x4e, 0x2f, 0x03, 0x90, 0x63, 0x2f,
+    0x8f, 0x50, 0x39, 0x82, 0x02, 0x40, 0x81, 0x88, 0x91, 0x54, 0x41, 0x40, 0x97, 0x56, 0x04, 0x42, 0x80, 0x6a, 0x1a,
+    0x00, 0x95, 0x81, 0x9f, 0x16, 0x25, 0x45, 0x40, 0x6c, 0x01, 0x55, 0x42, 0x0c, 0x17, 0x45, 0x40, 0x2c, 0x03, 0x54,
+    0x42, 0x53, 0x0e, 0xf2, 0x2f, 0x99, 0x56, 0x3e, 0x82, 0xe2, 0x40, 0xc3, 0x40, 0x28, 0xbd, 0x93, 0x0a, 0x43, 0x40,
+    0xda, 0x00, 0x53, 0x42, 0x8a, 0x16, 0x86, 0x42, 0x1b, 0x04, 0x25, 0x54, 0x4a, 0x0e, 0x3b, 0x85, 0x51, 0x1b, 0x00,
+    0x77, 0x83, 0x5b, 0x1b, 0x08, 0x61, 0x0c, 0x98, 0x2e, 0x2b, 0x0e, 0x98, 0x2e, 0x41, 0x85, 0x6b, 0x1b, 0x0e, 0x38,
+    0xb6, 0x95, 0x54, 0x8b, 0x56, 0x83, 0x42, 0x8f, 0x86, 0x74, 0x30, 0x93, 0x54, 0xc4, 0x81, 0x37, 0x16, 0x02, 0x6b,
+    0x01, 0xa1, 0x81, 0x87, 0x1b, 0x0a, 0x6e, 0x01, 0x21, 0x2e, 0x6d, 0x01, 0xba, 0x82, 0x18, 0x2c, 0x81, 0x81, 0x9b,
+    0x1b, 0x02, 0x6b, 0x01, 0x13, 0x83, 0xa3, 0x1b, 0x01, 0x6b, 0x01, 0x80, 0xac, 0x1b, 0x03, 0x0c, 0x2d, 0x77, 0x30,
+    0x80, 0xde, 0x1a, 0x0f, 0x8d, 0x50, 0x0c, 0x82, 0x12, 0x30, 0x40, 0x42, 0x25, 0x2e, 0x6b, 0x01, 0x2f, 0x2e, 0x7b,
+    0xf7, 0x92, 0xca, 0x1b, 0x00, 0x41, 0x85, 0xe1, 0x1b, 0x00, 0x9b, 0x8b, 0xeb, 0x1b, 0x02, 0x81, 0x52, 0x9d, 0x9d,
+    0xfd, 0x1b, 0x00, 0x87, 0x81, 0x1f, 0x1c, 0x11, 0x12, 0x40, 0x00, 0x40, 0x28, 0xba, 0x9b, 0xbc, 0x88, 0xbd, 0x93,
+    0xb4, 0xe3, 0x0a, 0x89, 0x16, 0x08, 0xb6, 0x88, 0x38, 0x1c, 0x05, 0x5d, 0x0d, 0x01, 0x2e, 0x6b, 0x01, 0x88, 0x4a,
+    0x1c, 0x05, 0x6d, 0x01, 0x21, 0x2e, 0x6e, 0x01, 0x80, 0xf0, 0x11, 0x05, 0x6e, 0x01, 0x03, 0x2e, 0x6d, 0x01, 0x82,
+    0x66, 0x1c, 0x01, 0x05, 0x0e, 0x80, 0xae, 0x16, 0x94, 0x72, 0x1c, 0x00, 0x9f, 0x83, 0x8b, 0x1c, 0x00, 0xa1, 0x9f,
+    0x93, 0x1c, 0x00, 0x95, 0x83, 0xb7, 0x1c, 0x06, 0x71, 0x52, 0x09, 0x2e, 0x62, 0x0f, 0x77, 0x8b, 0xc5, 0x1c, 0x01,
+    0x6e, 0x01, 0x88, 0xd6, 0x1c, 0x00, 0xd7, 0x95, 0xe3, 0x1c, 0x00, 0x63, 0x85, 0xfd, 0x1c, 0x00, 0x75, 0x87, 0x07,
+    0x1d, 0x00, 0xa3, 0x8b, 0x13, 0x1d, 0x00, 0xa1, 0xad, 0x23, 0x1d, 0x00, 0x78, 0x85, 0x55, 0x1d, 0x00, 0x78, 0xa1,
+    0x5f, 0x1d, 0x00, 0xa7, 0x81, 0x85, 0x1d, 0x00, 0xa9, 0x85, 0x8b, 0x1d, 0x00, 0xa5, 0x97, 0x95, 0x1d, 0x00, 0xbb,
+    0x97, 0xb1, 0x1d, 0x02, 0xd5, 0x00, 0x33, 0x85, 0xcf, 0x1d, 0x00, 0x9c, 0xab, 0xd9, 0x1d, 0x01, 0x91, 0x03, 0xa4,
+    0x0a, 0x1e, 0x00, 0xab, 0x81, 0x39, 0x1e, 0x06, 0xad, 0x50, 0x98, 0x2e, 0xfc, 0xc5, 0x5d, 0x81, 0x45, 0x1e, 0x01,
+    0xb1, 0x50, 0x80, 0x78, 0x11, 0x0c, 0xaf, 0x56, 0xb3, 0x52, 0x27, 0x2e, 0x7f, 0x01, 0x23, 0x2e, 0x80, 0x01, 0xb5,
+    0x81, 0x3f, 0x1e, 0x00, 0xb7, 0x81, 0x33, 0x1e, 0x80, 0x92, 0x05, 0x01, 0x0d, 0xb6, 0x84, 0x50, 0x1e, 0x00, 0xeb,
+    0x87, 0x59, 0x1e, 0x02, 0xbd, 0x52, 0xc1, 0x89, 0x67, 0x1e, 0x00, 0xbf, 0x97, 0x75, 0x1e, 0x01, 0x0c, 0x02, 0x86,
+    0x92, 0x1e, 0x00, 0xb9, 0xf5, 0x9d, 0x1e, 0xff, 0x46, 0x00, 0xff, 0x45, 0x00
+};
+
+/*! @name  Global structure that describes the compressed configuration file of BMI270_LEGACY */
+const struct bmi2_config_blob bmi270_legacy_config_blob = {
+    .data = bmi270_legacy_config_blob_data,
+    .size = sizeof(bmi270_legacy_config_blob_data),
+    .raw_size = BMI2_CONFIG_FILE_SIZE,
+    .dict = bmi270_config_file,
+    .dict_size = BMI2_CONFIG_FILE_SIZE
+};
+#else
 /*! @name  Global array that stores the configuration file of BMI270_LEGACY */
 const uint8_t bmi270_legacy_config_file[] = {
     0xc8, 0x2e, 0x00, 0x2e, 0x80, 0x2e, 0x3c, 0xb2, 0xc8, 0x2e, 0x00, 0x2e, 0x80, 0x2e, 0x9b, 0x03, 0x80, 0x2e, 0xa4,
@@ -491,6 +782,7 @@ const uint8_t bmi270_legacy_config_file[] = {
     0x00, 0xc1, 0x80, 0x2e, 0x00, 0xc1, 0x80, 0x2e, 0x00, 0xc1, 0x80, 0x2e, 0x00, 0xc1, 0x80, 0x2e, 0x00, 0xc1, 0x80,
     0x2e, 0x00, 0xc1
 };
+#endif
 
 /*! @name  Global array that stores the feature input configuration of BMI270_LEGACY */
 const struct bmi2_feature_config bmi270_legacy_feat_in[BMI270_LEGACY_MAX_FEAT_IN] = {
@@ -549,6 +841,71 @@ struct bmi2_map_int bmi270_legacy_map_int[BMI270_LEGACY_MAX_INT_MAP] = {
     { .type = BMI2_TRIPLE_TAP, .sens_map_int = BMI270_LEGACY_INT_TRIPLE_TAP_MASK }
 };
 
+/*! @name  Fields of the step counter/detector/activity configuration of BMI270 legacy */
+static const struct bmi2_feat_field bmi270_legacy_step_fields[BMI270_LEGACY_STEP_N_FIELDS] = {
+    BMI2_FEAT_FIELD_POS0(0, BMI2_STEP_COUNT_WM_LEVEL, struct bmi2_step_config, watermark_level),
+    BMI2_FEAT_FIELD(0, BMI2_STEP_COUNT_RST_CNT, struct bmi2_step_config, reset_counter),
+    BMI2_FEAT_FIELD(1, BMI2_STEP_BUFFER_SIZE, struct bmi2_step_config, step_buffer_size)
+};
+
+/*! @name  Fields of the orientation configuration of BMI270 legacy */
+static const struct bmi2_feat_field bmi270_legacy_orient_fields[BMI270_LEGACY_ORIENT_N_FIELDS] = {
+    BMI2_FEAT_FIELD(0, BMI2_ORIENT_UP_DOWN, struct bmi2_orient_config, ud_en),
+    BMI2_FEAT_FIELD(0, BMI2_ORIENT_SYMM_MODE, struct bmi2_orient_config, mode),
+    BMI2_FEAT_FIELD(0, BMI2_ORIENT_BLOCK_MODE, struct bmi2_orient_config, blocking),
+    BMI2_FEAT_FIELD(0, BMI2_ORIENT_THETA, struct bmi2_orient_config, theta),
+    BMI2_FEAT_FIELD_POS0(1, BMI2_ORIENT_HYST, struct bmi2_orient_config, hysteresis)
+};
+
+/*! @name  Fields of the high-g configuration of BMI270 legacy */
+static const struct bmi2_feat_field bmi270_legacy_high_g_fields[BMI270_LEGACY_HIGH_G_N_FIELDS] = {
+    BMI2_FEAT_FIELD_POS0(0, BMI2_HIGH_G_THRES, struct bmi2_high_g_config, threshold),
+    BMI2_FEAT_FIELD_POS0(1, BMI2_HIGH_G_HYST, struct bmi2_high_g_config, hysteresis),
+    BMI2_FEAT_FIELD(1, BMI2_HIGH_G_X_SEL, struct bmi2_high_g_config, select_x),
+    BMI2_FEAT_FIELD(1, BMI2_HIGH_G_Y_SEL, struct bmi2_high_g_config, select_y),
+    BMI2_FEAT_FIELD(1, BMI2_HIGH_G_Z_SEL, struct bmi2_high_g_config, select_z),
+    BMI2_FEAT_FIELD_POS0(2, BMI2_HIGH_G_DUR, struct bmi2_high_g_config, duration)
+};
+
+/*! @name  Fields of the low-g configuration of BMI270 legacy */
+static const struct bmi2_feat_field bmi270_legacy_low_g_fields[BMI270_LEGACY_LOW_G_N_FIELDS] = {
+    BMI2_FEAT_FIELD_POS0(0, BMI2_LOW_G_THRES, struct bmi2_low_g_config, threshold),
+    BMI2_FEAT_FIELD_POS0(1, BMI2_LOW_G_HYST, struct bmi2_low_g_config, hysteresis),
+    BMI2_FEAT_FIELD_POS0(2, BMI2_LOW_G_DUR, struct bmi2_low_g_config, duration)
+};
+
+/*! @name  Fields of the flat configuration of BMI270 legacy */
+static const struct bmi2_feat_field bmi270_legacy_flat_fields[BMI270_LEGACY_FLAT_N_FIELDS] = {
+    BMI2_FEAT_FIELD(0, BMI2_FLAT_THETA, struct bmi2_flat_config, theta),
+    BMI2_FEAT_FIELD(0, BMI2_FLAT_BLOCK, struct bmi2_flat_config, blocking),
+    BMI2_FEAT_FIELD_POS0(1, BMI2_FLAT_HYST, struct bmi2_flat_config, hysteresis),
+    BMI2_FEAT_FIELD(1, BMI2_FLAT_HOLD_TIME, struct bmi2_flat_config, hold_time)
+};
+
+/*! @name  Global array that stores the feature configuration encoders of BMI270 legacy */
+const struct bmi2_feat_encoder bmi270_legacy_feat_enc[BMI270_LEGACY_MAX_FEAT_ENC] = {
+    { .type = BMI2_ANY_MOTION, .feat = BMI2_ANY_MOTION, .fields = bmi2_any_no_mot_fields,
+      .n_fields = BMI2_ANY_NO_MOT_N_FIELDS },
+    { .type = BMI2_NO_MOTION, .feat = BMI2_NO_MOTION, .fields = bmi2_any_no_mot_fields,
+      .n_fields = BMI2_ANY_NO_MOT_N_FIELDS },
+    { .type = BMI2_SIG_MOTION, .feat = BMI2_SIG_MOTION, .fields = bmi2_sig_mot_fields,
+      .n_fields = BMI2_SIG_MOT_N_FIELDS },
+    { .type = BMI2_STEP_DETECTOR, .feat = BMI2_STEP_COUNTER, .fields = bmi270_legacy_step_fields,
+      .n_fields = BMI270_LEGACY_STEP_N_FIELDS },
+    { .type = BMI2_STEP_COUNTER, .feat = BMI2_STEP_COUNTER, .fields = bmi270_legacy_step_fields,
+      .n_fields = BMI270_LEGACY_STEP_N_FIELDS },
+    { .type = BMI2_STEP_ACTIVITY, .feat = BMI2_STEP_COUNTER, .fields = bmi270_legacy_step_fields,
+      .n_fields = BMI270_LEGACY_STEP_N_FIELDS },
+    { .type = BMI2_ORIENTATION, .feat = BMI2_ORIENTATION, .fields = bmi270_legacy_orient_fields,
+      .n_fields = BMI270_LEGACY_ORIENT_N_FIELDS },
+    { .type = BMI2_HIGH_G, .feat = BMI2_HIGH_G, .fields = bmi270_legacy_high_g_fields,
+      .n_fields = BMI270_LEGACY_HIGH_G_N_FIELDS },
+    { .type = BMI2_LOW_G, .feat = BMI2_LOW_G, .fields = bmi270_legacy_low_g_fields,
+      .n_fields = BMI270_LEGACY_LOW_G_N_FIELDS },
+    { .type = BMI2_FLAT, .feat = BMI2_FLAT, .fields = bmi270_legacy_flat_fields,
+      .n_fields = BMI270_LEGACY_FLAT_N_FIELDS }
+};
+
 /******************************************************************************/
 
 /*!         Local Function Prototypes
@@ -716,6 +1073,16 @@ static int8_t set_config_page_secondary(void *tap, void *bmi2_dev);
  */
 static int8_t null_ptr_check(const struct bmi2_dev *dev);
 
+/*!
+ * @brief This internal API assigns the feature configuration of BMI270_LEGACY to the
+ * device structure.
+ *
+ * @param[in, out] dev : Structure instance of bmi2_dev.
+ *
+ * @return None
+ */
+static void assign_variant_tables(struct bmi2_dev *dev);
+
 /*!
  * @brief This internal API enables the selected sensor/features.
  *
@@ -997,789 +1364,250 @@ static int8_t set_gyro_self_offset_corr(uint8_t enable, struct bmi2_dev *dev);
 static int8_t set_gyro_user_gain(uint8_t enable, struct bmi2_dev *dev);
 
 /*!
- * @brief This internal API sets any-motion configurations like axes select,
- * duration, threshold and output-configuration.
+ * @brief This internal API sets tap configurations like sensitivity,
+ * single, double and triple tap enable and output-configuration.
  *
- * @param[in]      config      : Structure instance of bmi2_any_motion_config.
- * @param[in, out] dev         : Structure instance of bmi2_dev.
+ * @param[in]      config         : Structure instance of bmi2_tap_config.
+ * @param[in, out] dev            : Structure instance of bmi2_dev.
  *
- * @verbatim
- *----------------------------------------------------------------------------
- *  bmi2_any_motion_config  |
- *  Structure parameters    |                   Description
- *--------------------------|--------------------------------------------------
- *                          | Defines the number of  consecutive data points for
- *                          | which the threshold condition must be respected,
- *                          | for interrupt assertion. It is expressed in  50 Hz
- *  duration                | samples (20 msec).
- *                          | Range is 0 to 163sec.
- *                          | Default value is 5 = 100ms.
- * -------------------------|---------------------------------------------------
- *                          | Slope threshold value for in 5.11g format.
- *  threshold               | Range is 0 to 1g.
- *                          | Default value is 0xAA = 83mg.
- * -------------------------|---------------------------------------------------
- *  select_x, select_y,     |
- *       select_z           |  Selects the feature on a per-axis basis
- * -------------------------|---------------------------------------------------
- * @endverbatim
  *
  * @return Result of API execution status
  * @retval 0 -> Success
  * @retval < 0 -> Fail
  */
-static int8_t set_any_motion_config(const struct bmi2_any_motion_config *config, struct bmi2_dev *dev);
+static int8_t set_tap_detector_config(struct bmi2_tap_config *config, struct bmi2_dev *dev);
 
 /*!
- * @brief This internal API sets no-motion configurations like axes select,
- * duration, threshold and output-configuration.
- *
- * @param[in]      config       : Structure instance of bmi2_no_motion_config.
- * @param[in, out] dev          : Structure instance of bmi2_dev.
+ * @brief This internal API gets tap configurations like sensitivity,
+ * single, double and triple tap enable and output-configuration.
  *
- * @verbatim
- *----------------------------------------------------------------------------
- *  bmi2_no_motion_config   |
- *  Structure parameters    |                   Description
- *--------------------------|--------------------------------------------------
- *                          | Defines the number of  consecutive data points for
- *                          | which the threshold condition must be respected,
- *                          | for interrupt assertion. It is expressed in  50 Hz
- *  duration                | samples (20 msec).
- *                          | Range is 0 to 163sec.
- *                          | Default value is 5 = 100ms.
- * -------------------------|---------------------------------------------------
- *                          | Slope threshold value for no-motion detection.
- *  threshold               | Range is 0 to 1g.
- *                          | Default value is 0x90 = 70mg.
- * -------------------------|---------------------------------------------------
- *  select_x, select_y,     |
- *       select_z           |  Selects the feature on a per-axis basis
- * -------------------------|---------------------------------------------------
- * @endverbatim
+ * @param[out]      config    : Structure instance of bmi2_tap_config.
+ * @param[in, out]  dev       : Structure instance of bmi2_dev.
  *
  * @return Result of API execution status
  * @retval 0 -> Success
  * @retval < 0 -> Fail
  */
-static int8_t set_no_motion_config(const struct bmi2_no_motion_config *config, struct bmi2_dev *dev);
+static int8_t get_tap_detector_config(struct bmi2_tap_config *config, struct bmi2_dev *dev);
 
 /*!
- * @brief This internal API sets sig-motion configurations like block-size,
- * output-configuration and other parameters.
- *
- * @param[in]      config        : Structure instance of bmi2_sig_motion_config.
- * @param[in, out] dev           : Structure instance of bmi2_dev.
+ * @brief This internal API gets the output values of high-g.
  *
- *----------------------------------------------------------------------------
- *  bmi2_sig_motion_config  |
- *  Structure parameters    |                   Description
- * -------------------------|---------------------------------------------------
- *                          | Defines the duration after which the significant
- *  block_size              | motion interrupt is triggered. It is expressed in
- *                          | 50 Hz samples (20 ms). Default value is 0xFA=5sec.
- *--------------------------|---------------------------------------------------
+ * @param[out] high_g_out       : Pointer to the stored high-g output.
+ * @param[in]  dev              : Structure instance of bmi2_dev.
  *
  * @return Result of API execution status
  * @retval 0 -> Success
  * @retval < 0 -> Fail
  */
-static int8_t set_sig_motion_config(const struct bmi2_sig_motion_config *config, struct bmi2_dev *dev);
+static int8_t get_high_g_output(uint8_t *high_g_out, struct bmi2_dev *dev);
 
 /*!
- * @brief This internal API sets step counter/detector/activity configurations.
+ * @brief This internal API gets the output values of step activity.
  *
- * @param[in] config      : Structure instance of bmi2_step_config.
- * @param[in] dev         : Structure instance of bmi2_dev.
+ * @param[out] step_act         : Pointer to the stored step activity data.
+ * @param[in]  dev      : Structure instance of bmi2_dev.
  *
- *---------------------------------------------------------------------------
- *    bmi2_step_config      |
- *  Structure parameters    |                 Description
- *--------------------------|--------------------------------------------------
- *                          | The Step-counter will trigger output every time
- *                          | the number of steps are counted. Holds implicitly
- *  water-mark level        | a 20x factor, so the range is 0 to 10230,
- *                          | with resolution of 20 steps.
- * -------------------------|---------------------------------------------------
- *  reset counter           | Flag to reset the counted steps.
- * -------------------------|---------------------------------------------------
- *  step_buffer_size        | Step counter buffer size
- * -------------------------|---------------------------------------------------
- * @endverbatim
+ * *step_act  |  Output
+ * -----------|------------
+ * 0x00       |  STILL
+ * 0x01       |  WALKING
+ * 0x02       |  RUNNING
+ * 0x03       |  UNKNOWN
  *
  * @return Result of API execution status
  * @retval 0 -> Success
  * @retval < 0 -> Fail
  */
-static int8_t set_step_config(const struct bmi2_step_config *config, struct bmi2_dev *dev);
+static int8_t get_step_activity_output(uint8_t *step_act, struct bmi2_dev *dev);
 
 /*!
- * @brief This internal API sets tap configurations like sensitivity,
- * single, double and triple tap enable and output-configuration.
+ * @brief This internal API gets the output values of orientation: portrait-
+ * landscape and face up-down.
  *
- * @param[in]      config         : Structure instance of bmi2_tap_config.
- * @param[in, out] dev            : Structure instance of bmi2_dev.
+ * @param[out] orient_out      : Structure pointer to the orientation data.
+ * @param[in]  dev             : Structure instance of bmi2_dev.
+ *
+ *
+ * portrait   |
+ * landscape  |  Output
+ * -----------|------------
+ * 0x00       |  PORTRAIT UPRIGHT
+ * 0x01       |  LANDSCAPE LEFT
+ * 0x02       |  PORTRAIT UPSIDE DOWN
+ * 0x03       |  LANDSCAPE RIGHT
  *
+ * Face       |
+ * up-down    |  Output
+ * -----------|------------
+ * 0x00       |  FACE-UP
+ * 0x01       |  FACE-DOWN
  *
  * @return Result of API execution status
  * @retval 0 -> Success
  * @retval < 0 -> Fail
  */
-static int8_t set_tap_detector_config(struct bmi2_tap_config *config, struct bmi2_dev *dev);
+static int8_t get_orient_output(struct bmi2_orientation_output *orient_out, struct bmi2_dev *dev);
 
 /*!
- * @brief This internal API sets orientation configurations like upside/down
- * detection, symmetrical modes, blocking mode, theta, hysteresis and output
- * configuration.
- *
- * @param[in]      config         : Structure instance of bmi2_orient_config.
- * @param[in, out] dev            : Structure instance of bmi2_dev.
+ * @brief This internal API gets the output values of step counter.
  *
- * @verbatim
- *-----------------------------------------------------------------------------
- *    bmi2_orient_config    |
- *   Structure parameters   |               Description
- *--------------------------|--------------------------------------------------
- *  upside/down             |  Enables upside/down detection, if set to 1.
- *  detection               |
- * -------------------------|---------------------------------------------------
- *                          | Sets the mode:
- *      mode                | Values 0 or 3 - symmetrical.
- *                          | Value 1       - high asymmetrical
- *                          | Value 2       - low asymmetrical
- * -------------------------|---------------------------------------------------
- *                          | Enable - no orientation interrupt will be set.
- *      blocking            | Default value: 3, the most restrictive blocking.
- * -------------------------|---------------------------------------------------
- *                          | Threshold angle used in blocking mode.
- *      theta               | Theta = 64 * (tan(angle)^2)
- *                          | Default value: 40, equivalent to 38 degrees angle.
- * -------------------------|---------------------------------------------------
- *                          | Acceleration hysteresis for Orientation detection
- *                          | is expressed in 5.11g format.
- *      hysteresis          | Default value is 128 = 0.0625g.
- *                          | Range is 0 to 1g.
- * -------------------------|---------------------------------------------------
- * @endverbatim
+ * @param[out] step_count       : Pointer to the stored step counter data.
+ * @param[in]  dev              : Structure instance of bmi2_dev.
  *
  * @return Result of API execution status
  * @retval 0 -> Success
  * @retval < 0 -> Fail
  */
-static int8_t set_orient_config(const struct bmi2_orient_config *config, struct bmi2_dev *dev);
+static int8_t get_step_counter_output(uint32_t *step_count, struct bmi2_dev *dev);
 
 /*!
- * @brief This internal API sets high-g configurations like threshold,
- * hysteresis, duration, and output configuration.
- *
- * @param[in]      config         : Structure instance of bmi2_high_g_config.
- * @param[in, out] dev            : Structure instance of bmi2_dev.
+ * @brief This internal API gets the error status related to NVM.
  *
- * @verbatim
- *-----------------------------------------------------------------------------
- *      bmi2_high_g_config  |
- *      Structure parameter |               Description
- *--------------------------|--------------------------------------------------
- *      threshold           |  The acceleration threshold above which the
- *                          |  high_g motion is signaled.
- *                          |  Threshold value for high_g feature.
- *                          |  Range is 0 to 16g.
- *                          |  Default value is 10000 = 4.9g.
- * -------------------------|---------------------------------------------------
- *                          | Hysteresis value for high_g feature.
- *      hysteresis          | Range is 0 to 2g.
- *                          | Default value is 1000 = 0.49g.
- * -------------------------|---------------------------------------------------
- *                          | Holds the duration in 200 Hz samples (5 ms) for
- *                          | which the threshold has to be exceeded.
- *      duration            | Default value 4 = 20 msec.
- *                          | Range is 0 to 20sec.
- * -------------------------|---------------------------------------------------
- *  select_x, select_y,     |
- *       select_z           |  Selects the feature on a per-axis basis
- * -------------------------|---------------------------------------------------
- * @endverbatim
+ * @param[out] nvm_err_stat     : Stores the NVM error status.
+ * @param[in]  dev              : Structure instance of bmi2_dev.
  *
  * @return Result of API execution status
  * @retval 0 -> Success
  * @retval < 0 -> Fail
  */
-static int8_t set_high_g_config(const struct bmi2_high_g_config *config, struct bmi2_dev *dev);
+static int8_t get_nvm_error_status(struct bmi2_nvm_err_status *nvm_err_stat, struct bmi2_dev *dev);
 
 /*!
- * @brief This internal API sets low-g configurations like threshold,
- * hysteresis, duration, and output configuration.
- *
- * @param[in]      config         : Structure instance of bmi2_low_g_config.
- * @param[in, out] dev            : Structure instance of bmi2_dev.
+ * @brief This internal API gets the error status related to virtual frames.
  *
- * @verbatim
- *----------------------------------------------------------------------------
- *    bmi2_low_g_config     |
- *   Structure parameters   |               Description
- *--------------------------|--------------------------------------------------
- *  threshold               |  The acceleration threshold above which the
- *                          |  low-g motion is signaled.
- *                          |  Range is 0 to 1g.
- *                          |  Default value is 512 = 0.25g.
- * -------------------------|---------------------------------------------------
- *                          | Hysteresis value for low_g feature.
- *                          | Range is 0 to 0.5g.
- *  hysteresis              | Default value is 256 = 0.125g.
- * -------------------------|---------------------------------------------------
- *                          | Holds the duration in 50 Hz samples (20 ms) for
- *                          | which the threshold has to be exceeded.
- *  duration                | Range is 0 to 82 sec.
- *                          | Default value is 0 = 0 ms.
- * -------------------------|---------------------------------------------------
- * @endverbatim
+ * @param[out] vfrm_err_stat    : Stores the VFRM related error status.
+ * @param[in]  dev              : Structure instance of bmi2_dev.
  *
  * @return Result of API execution status
  * @retval 0 -> Success
  * @retval < 0 -> Fail
  */
-static int8_t set_low_g_config(const struct bmi2_low_g_config *config, struct bmi2_dev *dev);
+static int8_t get_vfrm_error_status(struct bmi2_vfrm_err_status *vfrm_err_stat, struct bmi2_dev *dev);
 
 /*!
- * @brief This internal API sets flat configurations like theta, blocking,
- * hold-time, hysteresis, and output configuration.
- *
- * @param[in]      config         : Structure instance of bmi2_flat_config.
- * @param[in, out] dev            : Structure instance of bmi2_dev.
+ * @brief This internal API is used to get enable status of gyroscope user gain
+ * update.
  *
- * @verbatim
- *----------------------------------------------------------------------------
- *      bmi2_flat_config    |
- *      Structure parameters|               Description
- *--------------------------|--------------------------------------------------
- *                          | Sets the theta angle, used for detecting flat
- *                          | position.
- *      theta               | Theta = 64 * (tan(angle)^2);
- *                          | Default value is 8, equivalent to 20 degrees angle
- * -------------------------|---------------------------------------------------
- *                          | Hysteresis for Theta Flat detection.
- *      hysteresis          | Default value is 9 = 2.5 degrees, corresponding
- *                          | to the default Theta angle of 20 degrees.
- * -------------------------|---------------------------------------------------
- *                          | Sets the blocking mode. If blocking is set, no
- *                          | Flat interrupt will be triggered.
- *      blocking            | Default value is 2, the most restrictive blocking
- *                          | mode.
- * -------------------------|---------------------------------------------------
- *                          | Holds the duration in 50Hz samples for which the
- *                          | condition has to be respected.
- *      hold-time           | Default value is 32 = 640 msec.
- *                          | Range is 0 to 5.1 sec.
- * -------------------------|---------------------------------------------------
- * @endverbatim
+ * @param[out] status         : Stores status of gyroscope user gain update.
+ * @param[in]  dev            : Structure instance of bmi2_dev.
  *
  * @return Result of API execution status
  * @retval 0 -> Success
  * @retval < 0 -> Fail
  */
-static int8_t set_flat_config(const struct bmi2_flat_config *config, struct bmi2_dev *dev);
+static int8_t get_user_gain_upd_status(uint8_t *status, struct bmi2_dev *dev);
 
 /*!
- * @brief This internal API gets any-motion configurations like axes select,
- * duration, threshold and output-configuration.
+ * @brief This internal API enables/disables compensation of the gain defined
+ * in the GAIN register.
  *
- * @param[out] config        : Structure instance of bmi2_any_motion_config.
- * @param[in, out]  dev      : Structure instance of bmi2_dev.
+ * @param[in] enable    : Enables/Disables gain compensation
+ * @param[in] dev       : Structure instance of bmi2_dev.
  *
- * @verbatim
- *----------------------------------------------------------------------------
- *  bmi2_any_motion_config  |
- *  Structure parameters    |                   Description
- *--------------------------|--------------------------------------------------
- *                          | Defines the number of  consecutive data points for
- *                          | which the threshold condition must be respected,
- *                          | for interrupt assertion. It is expressed in  50 Hz
- *  duration                | samples (20 msec).
- *                          | Range is 0 to 163sec.
- *                          | Default value is 5 = 100ms.
- * -------------------------|---------------------------------------------------
- *                          | Slope threshold value for in 5.11g format.
- *  threshold               | Range is 0 to 1g.
- *                          | Default value is 0xAA = 83mg.
- * -------------------------|---------------------------------------------------
- *  select_x, select_y,     |
- *       select_z           |  Selects the feature on a per-axis basis
- * -------------------------|---------------------------------------------------
- * @endverbatim
+ *  enable      |  Description
+ * -------------|---------------
+ * BMI2_ENABLE  | Enable gain compensation.
+ * BMI2_DISABLE | Disable gain compensation.
  *
  * @return Result of API execution status
  * @retval 0 -> Success
  * @retval < 0 -> Fail
  */
-static int8_t get_any_motion_config(struct bmi2_any_motion_config *config, struct bmi2_dev *dev);
+static int8_t enable_gyro_gain(uint8_t enable, struct bmi2_dev *dev);
 
 /*!
- * @brief This internal API gets no-motion configurations like axes select,
- * duration, threshold and output-configuration.
+ * @brief This internal API is used to extract the output feature configuration
+ * details like page and start address from the look-up table.
  *
- * @param[out]      config    : Structure instance of bmi2_no_motion_config.
- * @param[in, out]  dev       : Structure instance of bmi2_dev.
+ * @param[out] feat_output      : Structure that stores output feature
+ *                              configurations.
+ * @param[in] type              : Type of feature or sensor.
+ * @param[in] dev               : Structure instance of bmi2_dev.
  *
- * @verbatim
- *----------------------------------------------------------------------------
- *  bmi2_no_motion_config   |
- *  Structure parameters    |                   Description
- *--------------------------|--------------------------------------------------
- *                          | Defines the number of  consecutive data points for
- *                          | which the threshold condition must be respected,
- *                          | for interrupt assertion. It is expressed in  50 Hz
- *  duration                | samples (20 msec).
- *                          | Range is 0 to 163sec.
- *                          | Default value is 5 = 100ms.
- * -------------------------|---------------------------------------------------
- *                          | Slope threshold value for no-motion detection.
- *  threshold               | Range is 0 to 1g.
- *                          | Default value is 0x90 = 70mg.
- * -------------------------|---------------------------------------------------
- *  select_x, select_y,     |
- *       select_z           |  Selects the feature on a per-axis basis
- * -------------------------|---------------------------------------------------
- * @endverbatim
+ * @return Returns the feature found flag.
  *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
+ * @retval  BMI2_FALSE : Feature not found
+ *          BMI2_TRUE  : Feature found
  */
-static int8_t get_no_motion_config(struct bmi2_no_motion_config *config, struct bmi2_dev *dev);
+static uint8_t extract_output_feat_config(struct bmi2_feature_config *feat_output,
+                                          uint8_t type,
+                                          const struct bmi2_dev *dev);
 
 /*!
- * @brief This internal API gets sig-motion configurations like block-size,
- * output-configuration and other parameters.
+ * @brief This internal API is used to enable/disable step activity detection.
  *
- * @param[out]      config    : Structure instance of bmi2_sig_motion_config.
- * @param[in, out]  dev       : Structure instance of bmi2_dev.
+ * @param[in] dev            : Structure instance of bmi2_dev.
+ * @param[in] enable         : Enables/Disables step activity.
  *
- *----------------------------------------------------------------------------
- *  bmi2_sig_motion_config  |
- *  Structure parameters    |                   Description
- * -------------------------|---------------------------------------------------
- *                          | Defines the duration after which the significant
- *  block_size              | motion interrupt is triggered. It is expressed in
- *                          | 50 Hz samples (20 ms). Default value is 0xFA=5sec.
- *--------------------------|---------------------------------------------------
+ * Enable       |  Description
+ * -------------|---------------
+ * BMI2_DISABLE | Disables step activity
+ * BMI2_ENABLE  | Enables step activity
  *
  * @return Result of API execution status
  * @retval 0 -> Success
  * @retval < 0 -> Fail
  */
-static int8_t get_sig_motion_config(struct bmi2_sig_motion_config *config, struct bmi2_dev *dev);
+static int8_t set_step_activity(uint8_t enable, struct bmi2_dev *dev);
 
 /*!
- * @brief This internal API gets step counter/detector/activity configurations.
- *
- * @param[out] config      : Structure instance of bmi2_step_config.
- * @param[in]  dev         : Structure instance of bmi2_dev.
+ * @brief This internal API sets feature configuration to the sensor.
  *
- * @verbatim
- *----------------------------------------------------------------------------
- *    bmi2_step_config      |
- *  Structure parameters    |                 Description
- *--------------------------|--------------------------------------------------
- *                          | The Step-counter will trigger output every time
- *                          | the number of steps are counted. Holds implicitly
- *  water-mark level        | a 20x factor, so the range is 0 to 10230,
- *                          | with resolution of 20 steps.
- * -------------------------|---------------------------------------------------
- *  reset counter           | Flag to reset the counted steps.
- * -------------------------|---------------------------------------------------
- * @endverbatim
+ * @param[in]       sens_cfg     : Structure instance of bmi2_sens_config.
+ * @param[in]       loop         : Variable to loop the sensor feature.
+ * @param[in, out]  dev          : Structure instance of bmi2_dev.
  *
  * @return Result of API execution status
  * @retval 0 -> Success
  * @retval < 0 -> Fail
  */
-static int8_t get_step_config(struct bmi2_step_config *config, struct bmi2_dev *dev);
+static int8_t set_feat_config(struct bmi2_sens_config *sens_cfg, uint8_t loop, struct bmi2_dev *dev);
 
 /*!
- * @brief This internal API gets tap configurations like sensitivity,
- * single, double and triple tap enable and output-configuration.
+ * @brief This internal API gets feature configuration from the sensor.
  *
- * @param[out]      config    : Structure instance of bmi2_tap_config.
- * @param[in, out]  dev       : Structure instance of bmi2_dev.
+ * @param[in]       sens_cfg     : Structure instance of bmi2_sens_config.
+ * @param[in]       loop         : Variable to loop the sensor feature.
+ * @param[in, out]  dev          : Structure instance of bmi2_dev.
  *
  * @return Result of API execution status
  * @retval 0 -> Success
  * @retval < 0 -> Fail
  */
-static int8_t get_tap_detector_config(struct bmi2_tap_config *config, struct bmi2_dev *dev);
+static int8_t get_feat_config(struct bmi2_sens_config *sens_cfg, uint8_t loop, struct bmi2_dev *dev);
 
 /*!
- * @brief This internal API gets orientation configurations like upside/down
- * detection, symmetrical modes, blocking mode, theta, hysteresis and output
- * configuration.
- *
- * @param[out]     config         : Structure instance of bmi2_orient_config.
- * @param[in, out] dev            : Structure instance of bmi2_dev.
+ * @brief This internal API selects the sensors/features to be enabled or
+ * disabled.
  *
- * @verbatim
- *-----------------------------------------------------------------------------
- *    bmi2_orient_config    |
- *   Structure parameters   |               Description
- *--------------------------|--------------------------------------------------
- *  upside/down             |  Enables upside/down detection, if set to 1.
- *  detection               |
- * -------------------------|---------------------------------------------------
- *                          | Sets the mode:
- *      mode                | Values 0 or 3 - symmetrical.
- *                          | Value 1       - high asymmetrical
- *                          | Value 2       - low asymmetrical
- * -------------------------|---------------------------------------------------
- *                          | Enable - no orientation interrupt will be set.
- *      blocking            | Default value: 3, the most restrictive blocking.
- * -------------------------|---------------------------------------------------
- *                          | Threshold angle used in blocking mode.
- *      theta               | Theta = 64 * (tan(angle)^2)
- *                          | Default value: 40, equivalent to 38 degrees angle.
- * -------------------------|---------------------------------------------------
- *                          | Acceleration hysteresis for Orientation detection
- *                          | is expressed in 5.11g format.
- *      hysteresis          | Default value is 128 = 0.0625g.
- *                          | Range is 0 to 1g.
- * -------------------------|---------------------------------------------------
- * @endverbatim
+ * @param[in]  sens_list    : Pointer to select the sensor.
+ * @param[in]  count        : Number of sensors selected.
+ * @param[in] sensor_sel    : Gets the selected sensor.
  *
  * @return Result of API execution status
  * @retval 0 -> Success
  * @retval < 0 -> Fail
  */
-static int8_t get_orient_config(struct bmi2_orient_config *config, struct bmi2_dev *dev);
+static int8_t sens_select(const uint8_t *sens_list, uint8_t count, uint64_t *sensor_sel);
 
 /*!
- * @brief This internal API gets high-g configurations like threshold,
- * hysteresis, duration, and output configuration.
- *
- * @param[out]     config         : Structure instance of bmi2_high_g_config.
- * @param[in, out] dev            : Structure instance of bmi2_dev.
+ * @brief This internal API is used to enable main sensors like accel, gyro, aux and temperature.
  *
- * @verbatim
- *-----------------------------------------------------------------------------
- *      bmi2_high_g_config  |
- *      Structure parameter |               Description
- *--------------------------|--------------------------------------------------
- *      threshold           |  The acceleration threshold above which the
- *                          |  high_g motion is signaled.
- *                          |  Holds threshold in 5.11 g format.
- *                          |  Default is 3072 = 1.5 g.
- *                          |  Range is 0 to 16g.
- * -------------------------|---------------------------------------------------
- *                          | Acceleration hysteresis for high-g detection
- *                          | is expressed in 1.11g format.
- *      hysteresis          | Default value is 256 = 0.125 g.
- *                          | Range is 0 to 2g.
- *                          | Should be smaller than threshold.
- * -------------------------|---------------------------------------------------
- *                          | Holds the duration in 200 Hz samples (5 ms) for
- *                          | which the threshold has to be exceeded.
- *      duration            |Default value 4 = 20 msec.
- *                          | Range is 0 to 20sec.
- * -------------------------|---------------------------------------------------
- *  select_x, select_y,     |
- *       select_z           |  Selects the feature on a per-axis basis
- * -------------------------|---------------------------------------------------
- * @endverbatim
+ * @param[in] sensor_sel    : Enables the selected sensor.
+ * @param[in, out]  dev     : Structure instance of bmi2_dev.
  *
  * @return Result of API execution status
  * @retval 0 -> Success
  * @retval < 0 -> Fail
  */
-static int8_t get_high_g_config(struct bmi2_high_g_config *config, struct bmi2_dev *dev);
+static int8_t enable_main_sensors(uint64_t sensor_sel, struct bmi2_dev *dev);
 
 /*!
- * @brief This internal API gets low-g configurations like threshold,
- * hysteresis, duration, and output configuration.
+ * @brief This internal API is used to enable sensor features.
  *
- * @param[out]     config     : Structure instance of bmi2_low_g_config.
- * @param[in, out] dev        : Structure instance of bmi2_dev.
- *
- * @verbatim
- *    bmi2_low_g_config     |
- *   Structure parameters   |               Description
- *--------------------------|--------------------------------------------------
- *  threshold               |  The acceleration threshold above which the
- *                          |  low-g motion is signaled.
- *                          |  Holds threshold in 5.11 g format.
- *                          |  Default is 3072 = 1.5 g.
- * -------------------------|---------------------------------------------------
- *                          |  Acceleration hysteresis for low-g detection
- *  hysteresis              | is expressed in 1.11g format.
- *                          | Default value is 512 = 0.250 g.
- *                          | Should be smaller than threshold.
- * -------------------------|---------------------------------------------------
- *                          | Holds the duration in 50 Hz samples (20 ms) for
- *                          | which the threshold has to be exceeded.
- *  duration                | Default value 0 = 1 validation sample = (0+1)*20
- *                          | = 20 ms.
- * -------------------------|---------------------------------------------------
- * @endverbatim
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t get_low_g_config(struct bmi2_low_g_config *config, struct bmi2_dev *dev);
-
-/*!
- * @brief This internal API gets flat configurations like theta, blocking,
- * hold-time, hysteresis, and output configuration.
- *
- * @param[out]     config           : Structure instance of bmi2_flat_config.
- * @param[in, out] dev              : Structure instance of bmi2_dev.
- *
- * @verbatim
- *----------------------------------------------------------------------------
- *      bmi2_flat_config    |
- *      Structure parameters|               Description
- *--------------------------|--------------------------------------------------
- *                          | Theta angle, used for detecting flat
- *                          | position.
- *      theta               | Theta = 64 * (tan(angle)^2);
- *                          | Default value is 8, equivalent to 20 degrees angle
- * -------------------------|---------------------------------------------------
- *                          | Hysteresis for Theta Flat detection.
- *      hysteresis          | Default value is 9 = 2.5 degrees, corresponding
- *                          | to the default Theta angle of 20 degrees.
- * -------------------------|---------------------------------------------------
- *                          | Sets the blocking mode. If blocking is set, no
- *                          | Flat interrupt will be triggered.
- *      blocking            | Default value is 2, the most restrictive blocking
- *                          | mode.
- * -------------------------|---------------------------------------------------
- *                          | Holds the duration in 50Hz samples for which the
- *                          | condition has to be respected.
- *      hold-time           | Default value is 32 = 640 m-sec.
- *                          | Range is 0 to 5.1 sec.
- * -------------------------|---------------------------------------------------
- * @endverbatim
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t get_flat_config(struct bmi2_flat_config *config, struct bmi2_dev *dev);
-
-/*!
- * @brief This internal API gets the output values of high-g.
- *
- * @param[out] high_g_out       : Pointer to the stored high-g output.
- * @param[in]  dev              : Structure instance of bmi2_dev.
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t get_high_g_output(uint8_t *high_g_out, struct bmi2_dev *dev);
-
-/*!
- * @brief This internal API gets the output values of step activity.
- *
- * @param[out] step_act         : Pointer to the stored step activity data.
- * @param[in]  dev      : Structure instance of bmi2_dev.
- *
- * *step_act  |  Output
- * -----------|------------
- * 0x00       |  STILL
- * 0x01       |  WALKING
- * 0x02       |  RUNNING
- * 0x03       |  UNKNOWN
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t get_step_activity_output(uint8_t *step_act, struct bmi2_dev *dev);
-
-/*!
- * @brief This internal API gets the output values of orientation: portrait-
- * landscape and face up-down.
- *
- * @param[out] orient_out      : Structure pointer to the orientation data.
- * @param[in]  dev             : Structure instance of bmi2_dev.
- *
- *
- * portrait   |
- * landscape  |  Output
- * -----------|------------
- * 0x00       |  PORTRAIT UPRIGHT
- * 0x01       |  LANDSCAPE LEFT
- * 0x02       |  PORTRAIT UPSIDE DOWN
- * 0x03       |  LANDSCAPE RIGHT
- *
- * Face       |
- * up-down    |  Output
- * -----------|------------
- * 0x00       |  FACE-UP
- * 0x01       |  FACE-DOWN
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t get_orient_output(struct bmi2_orientation_output *orient_out, struct bmi2_dev *dev);
-
-/*!
- * @brief This internal API gets the output values of step counter.
- *
- * @param[out] step_count       : Pointer to the stored step counter data.
- * @param[in]  dev              : Structure instance of bmi2_dev.
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t get_step_counter_output(uint32_t *step_count, struct bmi2_dev *dev);
-
-/*!
- * @brief This internal API gets the error status related to NVM.
- *
- * @param[out] nvm_err_stat     : Stores the NVM error status.
- * @param[in]  dev              : Structure instance of bmi2_dev.
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t get_nvm_error_status(struct bmi2_nvm_err_status *nvm_err_stat, struct bmi2_dev *dev);
-
-/*!
- * @brief This internal API gets the error status related to virtual frames.
- *
- * @param[out] vfrm_err_stat    : Stores the VFRM related error status.
- * @param[in]  dev              : Structure instance of bmi2_dev.
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t get_vfrm_error_status(struct bmi2_vfrm_err_status *vfrm_err_stat, struct bmi2_dev *dev);
-
-/*!
- * @brief This internal API is used to get enable status of gyroscope user gain
- * update.
- *
- * @param[out] status         : Stores status of gyroscope user gain update.
- * @param[in]  dev            : Structure instance of bmi2_dev.
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t get_user_gain_upd_status(uint8_t *status, struct bmi2_dev *dev);
-
-/*!
- * @brief This internal API enables/disables compensation of the gain defined
- * in the GAIN register.
- *
- * @param[in] enable    : Enables/Disables gain compensation
- * @param[in] dev       : Structure instance of bmi2_dev.
- *
- *  enable      |  Description
- * -------------|---------------
- * BMI2_ENABLE  | Enable gain compensation.
- * BMI2_DISABLE | Disable gain compensation.
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t enable_gyro_gain(uint8_t enable, struct bmi2_dev *dev);
-
-/*!
- * @brief This internal API is used to extract the output feature configuration
- * details like page and start address from the look-up table.
- *
- * @param[out] feat_output      : Structure that stores output feature
- *                              configurations.
- * @param[in] type              : Type of feature or sensor.
- * @param[in] dev               : Structure instance of bmi2_dev.
- *
- * @return Returns the feature found flag.
- *
- * @retval  BMI2_FALSE : Feature not found
- *          BMI2_TRUE  : Feature found
- */
-static uint8_t extract_output_feat_config(struct bmi2_feature_config *feat_output,
-                                          uint8_t type,
-                                          const struct bmi2_dev *dev);
-
-/*!
- * @brief This internal API is used to enable/disable step activity detection.
- *
- * @param[in] dev            : Structure instance of bmi2_dev.
- * @param[in] enable         : Enables/Disables step activity.
- *
- * Enable       |  Description
- * -------------|---------------
- * BMI2_DISABLE | Disables step activity
- * BMI2_ENABLE  | Enables step activity
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t set_step_activity(uint8_t enable, struct bmi2_dev *dev);
-
-/*!
- * @brief This internal API sets feature configuration to the sensor.
- *
- * @param[in]       sens_cfg     : Structure instance of bmi2_sens_config.
- * @param[in]       loop         : Variable to loop the sensor feature.
- * @param[in, out]  dev          : Structure instance of bmi2_dev.
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t set_feat_config(struct bmi2_sens_config *sens_cfg, uint8_t loop, struct bmi2_dev *dev);
-
-/*!
- * @brief This internal API gets feature configuration from the sensor.
- *
- * @param[in]       sens_cfg     : Structure instance of bmi2_sens_config.
- * @param[in]       loop         : Variable to loop the sensor feature.
- * @param[in, out]  dev          : Structure instance of bmi2_dev.
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t get_feat_config(struct bmi2_sens_config *sens_cfg, uint8_t loop, struct bmi2_dev *dev);
-
-/*!
- * @brief This internal API selects the sensors/features to be enabled or
- * disabled.
- *
- * @param[in]  sens_list    : Pointer to select the sensor.
- * @param[in]  count        : Number of sensors selected.
- * @param[in] sensor_sel    : Gets the selected sensor.
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t sens_select(const uint8_t *sens_list, uint8_t count, uint64_t *sensor_sel);
-
-/*!
- * @brief This internal API is used to enable main sensors like accel, gyro, aux and temperature.
- *
- * @param[in] sensor_sel    : Enables the selected sensor.
- * @param[in, out]  dev     : Structure instance of bmi2_dev.
- *
- * @return Result of API execution status
- * @retval 0 -> Success
- * @retval < 0 -> Fail
- */
-static int8_t enable_main_sensors(uint64_t sensor_sel, struct bmi2_dev *dev);
-
-/*!
- * @brief This internal API is used to enable sensor features.
- *
- * @param[in] sensor_sel    : Enables features of selected sensor.
- * @param[in, out]  dev     : Structure instance of bmi2_dev.
+ * @param[in] sensor_sel    : Enables features of selected sensor.
+ * @param[in, out]  dev     : Structure instance of bmi2_dev.
  *
  * @return Result of API execution status
  * @retval 0 -> Success
@@ -1837,7 +1665,11 @@ int8_t bmi270_legacy_init(struct bmi2_dev *dev)
         dev->chip_id = BMI270_LEGACY_CHIP_ID;
 
         /* Get the size of config array */
+#ifdef BMI2_COMPRESSED_CONFIG
+        dev->config_size = bmi270_legacy_config_blob.raw_size;
+#else
         dev->config_size = sizeof(bmi270_legacy_config_file);
+#endif
 
         /* Enable the variant specific features if any */
         dev->variant_feature = BMI2_CRT_RTOSK_ENABLE | BMI2_GYRO_CROSS_SENS_ENABLE;
@@ -1852,59 +1684,75 @@ int8_t bmi270_legacy_init(struct bmi2_dev *dev)
             dev->dummy_byte = 0;
         }
 
+        /* A configuration file given by the caller is uploaded as it is */
+        dev->config_blob = NULL;
+
         /* If configuration file pointer is not assigned any address */
         if (!dev->config_file_ptr)
         {
             /* Give the address of the configuration file array to
              * the device pointer
              */
+#ifdef BMI2_COMPRESSED_CONFIG
+            dev->config_blob = &bmi270_legacy_config_blob;
+#else
             dev->config_file_ptr = bmi270_legacy_config_file;
+#endif
         }
 
         /* Initialize BMI2 sensor */
         rslt = bmi2_sec_init(dev);
         if (rslt == BMI2_OK)
         {
-            /* Assign the offsets of the feature input
-             * configuration to the device structure
-             */
-            dev->feat_config = bmi270_legacy_feat_in;
-
-            /* Assign the offsets of the feature output to
-             * the device structure
-             */
-            dev->feat_output = bmi270_legacy_feat_out;
-
-            /* Assign the maximum number of pages to the
-             * device structure
-             */
-            dev->page_max = BMI270_LEGACY_MAX_PAGE_NUM;
+            /* Assign the feature configuration of the variant to the device structure */
+            assign_variant_tables(dev);
 
-            /* Assign maximum number of input sensors
-             * features to device structure
-             */
-            dev->input_sens = BMI270_LEGACY_MAX_FEAT_IN;
+            /* Get the gyroscope cross axis sensitivity */
+            rslt = bmi2_get_gyro_cross_sense(dev);
+        }
+    }
 
-            /* Assign maximum number of output sensors
-             * features to device structure
-             */
-            dev->out_sens = BMI270_LEGACY_MAX_FEAT_OUT;
+    return rslt;
+}
 
-            /* Assign the tap get configurations to function pointer */
-            dev->get_tap_config = get_tap_config;
+/*!
+ * @brief This API loads the configuration file of BMI270_LEGACY into a sensor
+ * initialized with another BMI270 variant, without a soft-reset.
+ */
+int8_t bmi270_legacy_load_variant(struct bmi2_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
 
-            /* Assign the tap set configurations to function pointer */
-            dev->set_tap_config = set_tap_config;
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+    if (rslt == BMI2_OK)
+    {
+        /* Get the size of config array */
+#ifdef BMI2_COMPRESSED_CONFIG
+        dev->config_size = bmi270_legacy_config_blob.raw_size;
+#else
+        dev->config_size = sizeof(bmi270_legacy_config_file);
+#endif
 
-            /* Assign the offsets of the feature interrupt
-             * to the device structure
-             */
-            dev->map_int = bmi270_legacy_map_int;
+        /* Enable the variant specific features if any */
+        dev->variant_feature = BMI2_CRT_RTOSK_ENABLE | BMI2_GYRO_CROSS_SENS_ENABLE;
 
-            /* Assign maximum number of feature interrupts
-             * to device structure
-             */
-            dev->sens_int_map = BMI270_LEGACY_MAX_INT_MAP;
+        /* Replace the configuration file of the previous variant */
+#ifdef BMI2_COMPRESSED_CONFIG
+        dev->config_file_ptr = NULL;
+        dev->config_blob = &bmi270_legacy_config_blob;
+#else
+        dev->config_file_ptr = bmi270_legacy_config_file;
+        dev->config_blob = NULL;
+#endif
+
+        /* Write the configuration file */
+        rslt = bmi2_write_config_file(dev);
+        if (rslt == BMI2_OK)
+        {
+            /* Assign the feature configuration of the variant to the device structure */
+            assign_variant_tables(dev);
 
             /* Get the gyroscope cross axis sensitivity */
             rslt = bmi2_get_gyro_cross_sense(dev);
@@ -1988,47 +1836,51 @@ int8_t bmi270_legacy_set_sensor_config(struct bmi2_sens_config *sens_cfg, uint8_
     uint8_t loop;
 
     /* Variable to get the status of advance power save */
-    uint8_t aps_stat = 0;
+    uint8_t aps_stat = BMI2_DISABLE;
 
     /* Null-pointer check */
     rslt = null_ptr_check(dev);
     if ((rslt == BMI2_OK) && (sens_cfg != NULL))
     {
-        /* Get status of advance power save mode */
-        aps_stat = dev->aps_status;
-
+        /* Disable advance power save once for all auxiliary and feature
+         * configurations
+         */
         for (loop = 0; loop < n_sens; loop++)
+        {
+            if ((sens_cfg[loop].type != BMI2_ACCEL) && (sens_cfg[loop].type != BMI2_GYRO) &&
+                (sens_cfg[loop].type != BMI2_AUX) && (sens_cfg[loop].type != BMI2_GYRO_GAIN_UPDATE) &&
+                (dev->aps_status == BMI2_ENABLE))
+            {
+                aps_stat = BMI2_ENABLE;
+                rslt = bmi2_set_adv_power_save(BMI2_DISABLE, dev);
+                break;
+            }
+        }
+
+        for (loop = 0; (loop < n_sens) && (rslt == BMI2_OK); loop++)
         {
             if ((sens_cfg[loop].type == BMI2_ACCEL) || (sens_cfg[loop].type == BMI2_GYRO) ||
                 (sens_cfg[loop].type == BMI2_AUX) || (sens_cfg[loop].type == BMI2_GYRO_GAIN_UPDATE))
             {
                 rslt = bmi2_set_sensor_config(&sens_cfg[loop], 1, dev);
             }
-            else
+            else if (bmi2_find_feat_encoder(sens_cfg[loop].type, bmi270_legacy_feat_enc,
+                                            BMI270_LEGACY_MAX_FEAT_ENC) == NULL)
             {
-                /* Disable Advance power save if enabled for auxiliary
-                 * and feature configurations
-                 */
-                if (aps_stat == BMI2_ENABLE)
-                {
-                    /* Disable advance power save if
-                     * enabled
-                     */
-                    rslt = bmi2_set_adv_power_save(BMI2_DISABLE, dev);
-                }
-
-                if (rslt == BMI2_OK)
-                {
-                    rslt = set_feat_config(sens_cfg, loop, dev);
-                }
-                /* Return error if any of the set configurations fail */
-                else
-                {
-                    break;
-                }
+                rslt = set_feat_config(sens_cfg, loop, dev);
             }
         }
 
+        /* Set the table driven feature configurations, writing each page once */
+        if (rslt == BMI2_OK)
+        {
+            rslt = bmi2_set_feat_config_batch(sens_cfg,
+                                              n_sens,
+                                              bmi270_legacy_feat_enc,
+                                              BMI270_LEGACY_MAX_FEAT_ENC,
+                                              dev);
+        }
+
         /* Enable Advance power save if disabled while configuring and
          * not when already disabled
          */
@@ -2057,50 +1909,48 @@ int8_t bmi270_legacy_get_sensor_config(struct bmi2_sens_config *sens_cfg, uint8_
     uint8_t loop;
 
     /* Variable to get the status of advance power save */
-    uint8_t aps_stat = 0;
+    uint8_t aps_stat = BMI2_DISABLE;
 
     /* Null-pointer check */
     rslt = null_ptr_check(dev);
     if ((rslt == BMI2_OK) && (sens_cfg != NULL))
     {
-        /* Get status of advance power save mode */
-        aps_stat = dev->aps_status;
+        /* Disable advance power save once for all feature configurations */
         for (loop = 0; loop < n_sens; loop++)
+        {
+            if ((sens_cfg[loop].type >= BMI2_MAIN_SENS_MAX_NUM) && (sens_cfg[loop].type != BMI2_GYRO_GAIN_UPDATE) &&
+                (dev->aps_status == BMI2_ENABLE))
+            {
+                aps_stat = BMI2_ENABLE;
+                rslt = bmi2_set_adv_power_save(BMI2_DISABLE, dev);
+                break;
+            }
+        }
+
+        for (loop = 0; (loop < n_sens) && (rslt == BMI2_OK); loop++)
         {
             if ((sens_cfg[loop].type == BMI2_ACCEL) || (sens_cfg[loop].type == BMI2_GYRO) ||
                 (sens_cfg[loop].type == BMI2_AUX) || (sens_cfg[loop].type == BMI2_GYRO_GAIN_UPDATE))
             {
                 rslt = bmi2_get_sensor_config(&sens_cfg[loop], 1, dev);
             }
-            else
+            else if (bmi2_find_feat_encoder(sens_cfg[loop].type, bmi270_legacy_feat_enc,
+                                            BMI270_LEGACY_MAX_FEAT_ENC) == NULL)
             {
-                /* Disable Advance power save if enabled for auxiliary
-                 * and feature configurations
-                 */
-                if ((sens_cfg[loop].type >= BMI2_MAIN_SENS_MAX_NUM) || (sens_cfg[loop].type == BMI2_AUX))
-                {
-
-                    if (aps_stat == BMI2_ENABLE)
-                    {
-                        /* Disable advance power save if
-                         * enabled
-                         */
-                        rslt = bmi2_set_adv_power_save(BMI2_DISABLE, dev);
-                    }
-                }
-
-                if (rslt == BMI2_OK)
-                {
-                    rslt = get_feat_config(sens_cfg, loop, dev);
-                }
-                /* Return error if any of the get configurations fail */
-                else
-                {
-                    break;
-                }
+                rslt = get_feat_config(sens_cfg, loop, dev);
             }
         }
 
+        /* Get the table driven feature configurations, reading each page once */
+        if (rslt == BMI2_OK)
+        {
+            rslt = bmi2_get_feat_config_batch(sens_cfg,
+                                              n_sens,
+                                              bmi270_legacy_feat_enc,
+                                              BMI270_LEGACY_MAX_FEAT_ENC,
+                                              dev);
+        }
+
         /* Enable Advance power save if disabled while configuring and
          * not when already disabled
          */
@@ -2818,6 +2668,54 @@ static int8_t null_ptr_check(const struct bmi2_dev *dev)
     return rslt;
 }
 
+/*!
+ * @brief This internal API assigns the feature configuration of BMI270_LEGACY to the
+ * device structure.
+ */
+static void assign_variant_tables(struct bmi2_dev *dev)
+{
+    /* Assign the offsets of the feature input
+     * configuration to the device structure
+     */
+    dev->feat_config = bmi270_legacy_feat_in;
+
+    /* Assign the offsets of the feature output to
+     * the device structure
+     */
+    dev->feat_output = bmi270_legacy_feat_out;
+
+    /* Assign the maximum number of pages to the
+     * device structure
+     */
+    dev->page_max = BMI270_LEGACY_MAX_PAGE_NUM;
+
+    /* Assign maximum number of input sensors
+     * features to device structure
+     */
+    dev->input_sens = BMI270_LEGACY_MAX_FEAT_IN;
+
+    /* Assign maximum number of output sensors
+     * features to device structure
+     */
+    dev->out_sens = BMI270_LEGACY_MAX_FEAT_OUT;
+
+    /* Assign the tap get configurations to function pointer */
+    dev->get_tap_config = get_tap_config;
+
+    /* Assign the tap set configurations to function pointer */
+    dev->set_tap_config = set_tap_config;
+
+    /* Assign the offsets of the feature interrupt
+     * to the device structure
+     */
+    dev->map_int = bmi270_legacy_map_int;
+
+    /* Assign maximum number of feature interrupts
+     * to device structure
+     */
+    dev->sens_int_map = BMI270_LEGACY_MAX_INT_MAP;
+}
+
 /*!
  * @brief This internal API selects the sensor/features to be enabled or
  * disabled.
@@ -2929,945 +2827,26 @@ static int8_t sensor_disable(uint64_t sensor_sel, struct bmi2_dev *dev)
             rslt = bmi2_set_adv_power_save(BMI2_DISABLE, dev);
         }
 
-        if (rslt == BMI2_OK)
-        {
-            rslt = disable_sensor_features(sensor_sel, dev);
-
-            /* Enable Advance power save if disabled while
-            * configuring and not when already disabled */
-            if ((aps_stat == BMI2_ENABLE) && (rslt == BMI2_OK))
-            {
-                rslt = bmi2_set_adv_power_save(BMI2_ENABLE, dev);
-            }
-        }
-    }
-
-    return rslt;
-}
-
-/*!
- * @brief This internal API is used to enable/disable any motion feature.
- */
-static int8_t set_any_motion(uint8_t enable, struct bmi2_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
-
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
-
-    /* Variable to set flag */
-    uint8_t feat_found;
-
-    /* Initialize feature configuration for any-motion */
-    struct bmi2_feature_config any_mot_config = { 0, 0, 0 };
-
-    /* Search for any-motion feature and extract its configurations details */
-    feat_found = bmi2_extract_input_feat_config(&any_mot_config, BMI2_ANY_MOTION, dev);
-    if (feat_found)
-    {
-        /* Get the configuration from the page where any-motion feature resides */
-        rslt = bmi2_get_feat_config(any_mot_config.page, feat_config, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Define the offset for enable/disable of any-motion axes */
-            idx = any_mot_config.start_addr + BMI2_ANY_MOT_FEAT_EN_OFFSET;
-
-            /* Set the feature enable bit */
-            feat_config[idx] = BMI2_SET_BITS(feat_config[idx], BMI2_ANY_NO_MOT_EN, enable);
-
-            /* Set the configuration back to the page */
-            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
-
-            if ((rslt == BMI2_OK) && (enable == BMI2_ENABLE))
-            {
-                dev->sens_en_stat |= BMI2_ANY_MOT_SEL;
-            }
-            else
-            {
-                dev->sens_en_stat &= ~BMI2_ANY_MOT_SEL;
-            }
-        }
-    }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
-
-    return rslt;
-}
-
-/*!
- * @brief This internal API is used to enable/disable no-motion feature.
- */
-static int8_t set_no_motion(uint8_t enable, struct bmi2_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
-
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
-
-    /* Variable to set flag */
-    uint8_t feat_found;
-
-    /* Initialize feature configuration for no-motion */
-    struct bmi2_feature_config no_mot_config = { 0, 0, 0 };
-
-    /* Search for no-motion feature and extract its configurations details */
-    feat_found = bmi2_extract_input_feat_config(&no_mot_config, BMI2_NO_MOTION, dev);
-    if (feat_found)
-    {
-        /* Get the configuration from the page where any/no-motion feature resides */
-        rslt = bmi2_get_feat_config(no_mot_config.page, feat_config, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Define the offset for enable/disable of no-motion axes */
-            idx = no_mot_config.start_addr + BMI2_NO_MOT_FEAT_EN_OFFSET;
-
-            /* Set the feature enable bit */
-            feat_config[idx] = BMI2_SET_BITS(feat_config[idx], BMI2_ANY_NO_MOT_EN, enable);
-
-            /* Set the configuration back to the page */
-            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
-
-            if ((rslt == BMI2_OK) && (enable == BMI2_ENABLE))
-            {
-                dev->sens_en_stat |= BMI2_NO_MOT_SEL;
-            }
-            else
-            {
-                dev->sens_en_stat &= ~BMI2_NO_MOT_SEL;
-            }
-        }
-    }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
-
-    return rslt;
-}
-
-/*!
- * @brief This internal API is used to enable/disable step detector feature.
- */
-static int8_t set_step_detector(uint8_t enable, struct bmi2_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
-
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
-
-    /* Variable to set flag */
-    uint8_t feat_found;
-
-    /* Initialize feature configuration for step detector */
-    struct bmi2_feature_config step_det_config = { 0, 0, 0 };
-
-    /* Search for step detector feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&step_det_config, BMI2_STEP_DETECTOR, dev);
-    if (feat_found)
-    {
-        /* Get the configuration from the page where step detector feature resides */
-        rslt = bmi2_get_feat_config(step_det_config.page, feat_config, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Define the offset for enable/disable of step detector */
-            idx = step_det_config.start_addr + BMI2_STEP_COUNT_FEAT_EN_OFFSET;
-
-            /* Set the feature enable bit */
-            feat_config[idx] = BMI2_SET_BITS(feat_config[idx], BMI2_STEP_DET_FEAT_EN, enable);
-
-            /* Set the configuration back to the page */
-            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
-
-            if ((rslt == BMI2_OK) && (enable == BMI2_ENABLE))
-            {
-                dev->sens_en_stat |= BMI2_STEP_DETECT_SEL;
-            }
-            else
-            {
-                dev->sens_en_stat &= ~BMI2_STEP_DETECT_SEL;
-            }
-        }
-    }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
-
-    return rslt;
-}
-
-/*!
- * @brief This internal API is used to enable/disable step counter feature.
- */
-static int8_t set_step_counter(uint8_t enable, struct bmi2_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
-
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
-
-    /* Variable to set flag */
-    uint8_t feat_found;
-
-    /* Initialize feature configuration for step counter */
-    struct bmi2_feature_config step_count_config = { 0, 0, 0 };
-
-    /* Search for step counter feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&step_count_config, BMI2_STEP_COUNTER, dev);
-    if (feat_found)
-    {
-        /* Get the configuration from the page where step-counter feature resides */
-        rslt = bmi2_get_feat_config(step_count_config.page, feat_config, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Define the offset for enable/disable of step counter */
-            idx = step_count_config.start_addr + BMI2_STEP_COUNT_FEAT_EN_OFFSET;
-
-            /* Set the feature enable bit */
-            feat_config[idx] = BMI2_SET_BITS(feat_config[idx], BMI2_STEP_COUNT_FEAT_EN, enable);
-
-            /* Set the configuration back to the page */
-            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
-
-            if ((rslt == BMI2_OK) && (enable == BMI2_ENABLE))
-            {
-                dev->sens_en_stat |= BMI2_STEP_COUNT_SEL;
-            }
-            else
-            {
-                dev->sens_en_stat &= ~BMI2_STEP_COUNT_SEL;
-            }
-        }
-    }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
-
-    return rslt;
-}
-
-/*!
- * @brief This internal API is used to enable/disable step activity detection.
- */
-static int8_t set_step_activity(uint8_t enable, struct bmi2_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
-
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
-
-    /* Variable to set flag */
-    uint8_t feat_found;
-
-    /* Initialize feature configuration for step activity */
-    struct bmi2_feature_config step_act_config = { 0, 0, 0 };
-
-    /* Search for step activity feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&step_act_config, BMI2_STEP_ACTIVITY, dev);
-    if (feat_found)
-    {
-        /* Get the configuration from the page where step-activity
-         * feature resides
-         */
-        rslt = bmi2_get_feat_config(step_act_config.page, feat_config, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Define the offset for enable/disable of step activity */
-            idx = step_act_config.start_addr + BMI2_STEP_COUNT_FEAT_EN_OFFSET;
-
-            /* Set the feature enable bit */
-            feat_config[idx] = BMI2_SET_BITS(feat_config[idx], BMI2_STEP_ACT_FEAT_EN, enable);
-
-            /* Set the configuration back to the page */
-            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
-
-            if ((rslt == BMI2_OK) && (enable == BMI2_ENABLE))
-            {
-                dev->sens_en_stat |= BMI2_STEP_ACT_SEL;
-            }
-            else
-            {
-                dev->sens_en_stat &= ~BMI2_STEP_ACT_SEL;
-            }
-        }
-    }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
-
-    return rslt;
-}
-
-/*!
- * @brief This internal API is used to enable/disable sig-motion feature.
- */
-static int8_t set_sig_motion(uint8_t enable, struct bmi2_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
-
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
-
-    /* Variable to set flag */
-    uint8_t feat_found;
-
-    /* Initialize feature configuration for sig-motion */
-    struct bmi2_feature_config sig_mot_config = { 0, 0, 0 };
-
-    /* Search for sig-motion feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&sig_mot_config, BMI2_SIG_MOTION, dev);
-    if (feat_found)
-    {
-        /* Get the configuration from the page where sig-motion feature resides */
-        rslt = bmi2_get_feat_config(sig_mot_config.page, feat_config, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Define the offset for enable/disable of sig-motion */
-            idx = sig_mot_config.start_addr + BMI2_SIG_MOT_FEAT_EN_OFFSET;
-
-            /* Set the feature enable bit */
-            feat_config[idx] = BMI2_SET_BIT_POS0(feat_config[idx], BMI2_SIG_MOT_FEAT_EN, enable);
-
-            /* Set the configuration back to the page */
-            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
-
-            if ((rslt == BMI2_OK) && (enable == BMI2_ENABLE))
-            {
-                dev->sens_en_stat |= BMI2_SIG_MOTION_SEL;
-            }
-            else
-            {
-                dev->sens_en_stat &= ~BMI2_SIG_MOTION_SEL;
-            }
-        }
-    }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
-
-    return rslt;
-}
-
-/*!
- * @brief This internal API is used to enable/disable tap feature through
- * single tap.
- */
-static int8_t set_single_tap(uint8_t enable, struct bmi2_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
-
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
-
-    /* Variable to set flag */
-    uint8_t feat_found;
-
-    /* Initialize feature configuration for tap */
-    struct bmi2_feature_config tap_config = { 0, 0, 0 };
-
-    /* Search for tap feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&tap_config, BMI2_SINGLE_TAP, dev);
-    if (feat_found)
-    {
-        /* Get the configuration from the page where tap feature resides */
-        rslt = bmi2_get_feat_config(tap_config.page, feat_config, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Define the offset for enable/disable of tap */
-            idx = tap_config.start_addr;
-
-            /* Set the feature enable bit */
-            feat_config[idx] = BMI2_SET_BIT_POS0(feat_config[idx], BMI2_TAP_SINGLE_TAP_EN, enable);
-
-            /* Set the configuration back to the page */
-            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
-
-            if ((rslt == BMI2_OK) && (enable == BMI2_ENABLE))
-            {
-                dev->sens_en_stat |= BMI2_SINGLE_TAP_SEL;
-            }
-            else
-            {
-                dev->sens_en_stat &= ~BMI2_SINGLE_TAP_SEL;
-            }
-        }
-    }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
-
-    return rslt;
-}
-
-/*!
- * @brief This internal API is used to enable/disable tap feature through
- * double tap.
- */
-static int8_t set_double_tap(uint8_t enable, struct bmi2_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
-
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
-
-    /* Variable to set flag */
-    uint8_t feat_found;
-
-    /* Initialize feature configuration for tap */
-    struct bmi2_feature_config tap_config = { 0, 0, 0 };
-
-    /* Search for tap feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&tap_config, BMI2_DOUBLE_TAP, dev);
-    if (feat_found)
-    {
-        /* Get the configuration from the page where tap feature resides */
-        rslt = bmi2_get_feat_config(tap_config.page, feat_config, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Define the offset for enable/disable of tap */
-            idx = tap_config.start_addr;
-
-            /* Set the feature enable bit */
-            feat_config[idx] = BMI2_SET_BITS(feat_config[idx], BMI2_TAP_DOUBLE_TAP_EN, enable);
-
-            /* Set the configuration back to the page */
-            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
-
-            if ((rslt == BMI2_OK) && (enable == BMI2_ENABLE))
-            {
-                dev->sens_en_stat |= BMI2_DOUBLE_TAP_SEL;
-            }
-            else
-            {
-                dev->sens_en_stat &= ~BMI2_DOUBLE_TAP_SEL;
-            }
-        }
-    }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
-
-    return rslt;
-}
-
-/*!
- * @brief This internal API is used to enable/disable tap feature through
- * triple tap.
- */
-static int8_t set_triple_tap(uint8_t enable, struct bmi2_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
-
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
-
-    /* Variable to set flag */
-    uint8_t feat_found;
-
-    /* Initialize feature configuration for tap */
-    struct bmi2_feature_config tap_config = { 0, 0, 0 };
-
-    /* Search for tap feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&tap_config, BMI2_TRIPLE_TAP, dev);
-    if (feat_found)
-    {
-        /* Get the configuration from the page where tap feature resides */
-        rslt = bmi2_get_feat_config(tap_config.page, feat_config, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Define the offset for enable/disable of tap */
-            idx = tap_config.start_addr;
-
-            /* Set the feature enable bit */
-            feat_config[idx] = BMI2_SET_BITS(feat_config[idx], BMI2_TAP_TRIPLE_TAP_EN, enable);
-
-            /* Set the configuration back to the page */
-            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
-
-            if ((rslt == BMI2_OK) && (enable == BMI2_ENABLE))
-            {
-                dev->sens_en_stat |= BMI2_TRIPLE_TAP_SEL;
-            }
-            else
-            {
-                dev->sens_en_stat &= ~BMI2_TRIPLE_TAP_SEL;
-            }
-        }
-    }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
-
-    return rslt;
-}
-
-/*!
- * @brief This internal API is used to enable/disable orientation feature.
- */
-static int8_t set_orientation(uint8_t enable, struct bmi2_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
-
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
-
-    /* Variable to set flag */
-    uint8_t feat_found;
-
-    /* Initialize feature configuration for orientation */
-    struct bmi2_feature_config orient_config = { 0, 0, 0 };
-
-    /* Search for orientation feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&orient_config, BMI2_ORIENTATION, dev);
-    if (feat_found)
-    {
-        /* Get the configuration from the page where orientation feature resides */
-        rslt = bmi2_get_feat_config(orient_config.page, feat_config, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Define the offset for enable/disable of orientation */
-            idx = orient_config.start_addr;
-
-            /* Set the feature enable bit */
-            feat_config[idx] = BMI2_SET_BIT_POS0(feat_config[idx], BMI2_ORIENT_FEAT_EN, enable);
-
-            /* Set the configuration back to the page */
-            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
-
-            if ((rslt == BMI2_OK) && (enable == BMI2_ENABLE))
-            {
-                dev->sens_en_stat |= BMI2_ORIENT_SEL;
-            }
-            else
-            {
-                dev->sens_en_stat &= ~BMI2_ORIENT_SEL;
-            }
-        }
-    }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
-
-    return rslt;
-}
-
-/*!
- * @brief This internal API is used to enable/disable high-g feature.
- */
-static int8_t set_high_g(uint8_t enable, struct bmi2_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
-
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
-
-    /* Variable to set flag */
-    uint8_t feat_found;
-
-    /* Initialize feature configuration for high-g */
-    struct bmi2_feature_config high_g_config = { 0, 0, 0 };
-
-    /* Search for high-g feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&high_g_config, BMI2_HIGH_G, dev);
-    if (feat_found)
-    {
-        /* Get the configuration from the page where high-g feature resides */
-        rslt = bmi2_get_feat_config(high_g_config.page, feat_config, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Define the offset for enable/disable of high-g */
-            idx = high_g_config.start_addr + BMI2_HIGH_G_FEAT_EN_OFFSET;
-
-            /* Set the feature enable bit */
-            feat_config[idx] = BMI2_SET_BITS(feat_config[idx], BMI2_HIGH_G_FEAT_EN, enable);
-
-            /* Set the configuration back to the page */
-            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
-
-            if ((rslt == BMI2_OK) && (enable == BMI2_ENABLE))
-            {
-                dev->sens_en_stat |= BMI2_HIGH_G_SEL;
-            }
-            else
-            {
-                dev->sens_en_stat &= ~BMI2_HIGH_G_SEL;
-            }
-        }
-    }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
-
-    return rslt;
-}
-
-/*!
- * @brief This internal API is used to enable/disable low-g feature.
- */
-static int8_t set_low_g(uint8_t enable, struct bmi2_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
-
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
-
-    /* Variable to set flag */
-    uint8_t feat_found;
-
-    /* Initialize feature configuration for low-g */
-    struct bmi2_feature_config low_g_config = { 0, 0, 0 };
-
-    /* Search for low-g feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&low_g_config, BMI2_LOW_G, dev);
-    if (feat_found)
-    {
-        /* Get the configuration from the page where low-g feature resides */
-        rslt = bmi2_get_feat_config(low_g_config.page, feat_config, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Define the offset for enable/disable of low-g */
-            idx = low_g_config.start_addr + BMI2_LOW_G_FEAT_EN_OFFSET;
-
-            /* Set the feature enable bit */
-            feat_config[idx] = BMI2_SET_BITS(feat_config[idx], BMI2_LOW_G_FEAT_EN, enable);
-
-            /* Set the configuration back to the page */
-            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
-
-            if ((rslt == BMI2_OK) && (enable == BMI2_ENABLE))
-            {
-                dev->sens_en_stat |= BMI2_LOW_G_SEL;
-            }
-            else
-            {
-                dev->sens_en_stat &= ~BMI2_LOW_G_SEL;
-            }
-        }
-    }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
-
-    return rslt;
-}
-
-/*!
- * @brief This internal API is used to enable/disable flat feature.
- */
-static int8_t set_flat(uint8_t enable, struct bmi2_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
-
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
-
-    /* Variable to set flag */
-    uint8_t feat_found;
-
-    /* Initialize feature configuration for flat */
-    struct bmi2_feature_config flat_config = { 0, 0, 0 };
-
-    /* Search for flat feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&flat_config, BMI2_FLAT, dev);
-    if (feat_found)
-    {
-        /* Get the configuration from the page where flat feature resides */
-        rslt = bmi2_get_feat_config(flat_config.page, feat_config, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Define the offset for enable/disable of flat */
-            idx = flat_config.start_addr;
-
-            /* Set the feature enable bit */
-            feat_config[idx] = BMI2_SET_BIT_POS0(feat_config[idx], BMI2_FLAT_FEAT_EN, enable);
-
-            /* Set the configuration back to the page */
-            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
-
-            if ((rslt == BMI2_OK) && (enable == BMI2_ENABLE))
-            {
-                dev->sens_en_stat |= BMI2_FLAT_SEL;
-            }
-            else
-            {
-                dev->sens_en_stat &= ~BMI2_FLAT_SEL;
-            }
-        }
-    }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
-
-    return rslt;
-}
-
-/*!
- * @brief This internal API gives an option to enable self-offset correction
- * feature of gyroscope, either internally or by the host.
- */
-static int8_t set_gyro_self_offset_corr(uint8_t enable, struct bmi2_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
-
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
-
-    /* Variable to set flag */
-    uint8_t feat_found;
-
-    /* Initialize feature configuration for self-offset correction */
-    struct bmi2_feature_config self_off_corr_cfg = { 0, 0, 0 };
-
-    /* Search for self-offset correction and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&self_off_corr_cfg, BMI2_GYRO_SELF_OFF, dev);
-    if (feat_found)
-    {
-        /* Get the configuration from the page where self-offset
-         * correction feature resides
-         */
-        rslt = bmi2_get_feat_config(self_off_corr_cfg.page, feat_config, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Define the offset for enable/disable of self-offset correction */
-            idx = self_off_corr_cfg.start_addr;
-
-            /* Set the feature enable bit */
-            feat_config[idx] = BMI2_SET_BITS(feat_config[idx], BMI2_GYR_SELF_OFF_CORR_FEAT_EN, enable);
-
-            /* Set the configuration back to the page */
-            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
-
-            if ((rslt == BMI2_OK) && (enable == BMI2_ENABLE))
-            {
-                dev->sens_en_stat |= BMI2_GYRO_SELF_OFF_SEL;
-            }
-            else
-            {
-                dev->sens_en_stat &= ~BMI2_GYRO_SELF_OFF_SEL;
-            }
-        }
-    }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
-
-    return rslt;
-}
-
-/*!
- * @brief This internal API is used to enable/disable gyroscope user gain
- * feature.
- */
-static int8_t set_gyro_user_gain(uint8_t enable, struct bmi2_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
-
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
-
-    /* Variable to set flag */
-    uint8_t feat_found;
-
-    /* Initialize feature configuration for gyroscope user gain */
-    struct bmi2_feature_config gyr_user_gain_cfg = { 0, 0, 0 };
-
-    /* Search for user gain feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&gyr_user_gain_cfg, BMI2_GYRO_GAIN_UPDATE, dev);
-    if (feat_found)
-    {
-        /* Get the configuration from the page where user gain feature resides */
-        rslt = bmi2_get_feat_config(gyr_user_gain_cfg.page, feat_config, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Define the offset for enable/disable of user gain */
-            idx = gyr_user_gain_cfg.start_addr + BMI2_GYR_USER_GAIN_FEAT_EN_OFFSET;
-
-            /* Set the feature enable bit */
-            feat_config[idx] = BMI2_SET_BITS(feat_config[idx], BMI2_GYR_USER_GAIN_FEAT_EN, enable);
-
-            /* Set the configuration back to the page */
-            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
-
-            if ((rslt == BMI2_OK) && (enable == BMI2_ENABLE))
-            {
-                dev->sens_en_stat |= BMI2_GYRO_GAIN_UPDATE_SEL;
-            }
-            else
-            {
-                dev->sens_en_stat &= ~BMI2_GYRO_GAIN_UPDATE_SEL;
-            }
-        }
-    }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
-
-    return rslt;
-}
-
-/*!
- * @brief This internal API sets any-motion configurations like axes select,
- * duration, threshold and output-configuration.
- */
-static int8_t set_any_motion_config(const struct bmi2_any_motion_config *config, struct bmi2_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t feat_config[BMI2_FEAT_SIZE_IN_BYTES] = { 0 };
-
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
-
-    /* Variable to define count */
-    uint8_t index = 0;
-
-    /* Variable to set flag */
-    uint8_t feat_found;
-
-    /* Initialize feature configuration for any motion */
-    struct bmi2_feature_config any_mot_config = { 0, 0, 0 };
-
-    /* Copy the feature configuration address to a local pointer */
-    uint16_t *data_p = (uint16_t *) (void *)feat_config;
-
-    /* Search for any-motion feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&any_mot_config, BMI2_ANY_MOTION, dev);
-    if (feat_found)
-    {
-        /* Get the configuration from the page where any-motion feature resides */
-        rslt = bmi2_get_feat_config(any_mot_config.page, feat_config, dev);
-        if (rslt == BMI2_OK)
-        {
-            /* Define the offset in bytes for any-motion select */
-            idx = any_mot_config.start_addr;
-
-            /* Get offset in words since all the features are set in words length */
-            idx = idx / 2;
-
-            /* Set duration */
-            *(data_p + idx) = BMI2_SET_BIT_POS0(*(data_p + idx), BMI2_ANY_NO_MOT_DUR, config->duration);
-
-            /* Set x-select */
-            *(data_p + idx) = BMI2_SET_BITS(*(data_p + idx), BMI2_ANY_NO_MOT_X_SEL, config->select_x);
-
-            /* Set y-select */
-            *(data_p + idx) = BMI2_SET_BITS(*(data_p + idx), BMI2_ANY_NO_MOT_Y_SEL, config->select_y);
-
-            /* Set z-select */
-            *(data_p + idx) = BMI2_SET_BITS(*(data_p + idx), BMI2_ANY_NO_MOT_Z_SEL, config->select_z);
-
-            /* Increment offset by 1 word to set threshold and output configuration */
-            idx++;
-
-            /* Set threshold */
-            *(data_p + idx) = BMI2_SET_BIT_POS0(*(data_p + idx), BMI2_ANY_NO_MOT_THRES, config->threshold);
-
-            /* Increment offset by 1 more word to get the total length in words */
-            idx++;
-
-            /* Get total length in bytes to copy from local pointer to the array */
-            idx = (uint8_t)(idx * 2) - any_mot_config.start_addr;
+        if (rslt == BMI2_OK)
+        {
+            rslt = disable_sensor_features(sensor_sel, dev);
 
-            /* Copy the bytes to be set back to the array */
-            for (index = 0; index < idx; index++)
+            /* Enable Advance power save if disabled while
+            * configuring and not when already disabled */
+            if ((aps_stat == BMI2_ENABLE) && (rslt == BMI2_OK))
             {
-                feat_config[any_mot_config.start_addr +
-                            index] = *((uint8_t *) data_p + any_mot_config.start_addr + index);
+                rslt = bmi2_set_adv_power_save(BMI2_ENABLE, dev);
             }
-
-            /* Set the configuration back to the page */
-            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
         }
     }
-    else
-    {
-        rslt = BMI2_E_INVALID_SENSOR;
-    }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API sets no-motion configurations like axes select,
- * duration, threshold and output-configuration.
+ * @brief This internal API is used to enable/disable any motion feature.
  */
-static int8_t set_no_motion_config(const struct bmi2_no_motion_config *config, struct bmi2_dev *dev)
+static int8_t set_any_motion(uint8_t enable, struct bmi2_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
@@ -3878,65 +2857,37 @@ static int8_t set_no_motion_config(const struct bmi2_no_motion_config *config, s
     /* Variable to define the array offset */
     uint8_t idx = 0;
 
-    /* Variable to define count */
-    uint8_t index = 0;
-
     /* Variable to set flag */
     uint8_t feat_found;
 
-    /* Initialize feature configuration for no-motion */
-    struct bmi2_feature_config no_mot_config = { 0, 0, 0 };
-
-    /* Copy the feature configuration address to a local pointer */
-    uint16_t *data_p = (uint16_t *) (void *)feat_config;
+    /* Initialize feature configuration for any-motion */
+    struct bmi2_feature_config any_mot_config = { 0, 0, 0 };
 
-    /* Search for no-motion feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&no_mot_config, BMI2_NO_MOTION, dev);
+    /* Search for any-motion feature and extract its configurations details */
+    feat_found = bmi2_extract_input_feat_config(&any_mot_config, BMI2_ANY_MOTION, dev);
     if (feat_found)
     {
-        /* Get the configuration from the page where no-motion feature resides */
-        rslt = bmi2_get_feat_config(no_mot_config.page, feat_config, dev);
+        /* Get the configuration from the page where any-motion feature resides */
+        rslt = bmi2_get_feat_config(any_mot_config.page, feat_config, dev);
         if (rslt == BMI2_OK)
         {
-            /* Define the offset in bytes for no-motion select */
-            idx = no_mot_config.start_addr;
-
-            /* Get offset in words since all the features are set in words length */
-            idx = idx / 2;
-
-            /* Set duration */
-            *(data_p + idx) = BMI2_SET_BIT_POS0(*(data_p + idx), BMI2_ANY_NO_MOT_DUR, config->duration);
-
-            /* Set x-select */
-            *(data_p + idx) = BMI2_SET_BITS(*(data_p + idx), BMI2_ANY_NO_MOT_X_SEL, config->select_x);
-
-            /* Set y-select */
-            *(data_p + idx) = BMI2_SET_BITS(*(data_p + idx), BMI2_ANY_NO_MOT_Y_SEL, config->select_y);
-
-            /* Set z-select */
-            *(data_p + idx) = BMI2_SET_BITS(*(data_p + idx), BMI2_ANY_NO_MOT_Z_SEL, config->select_z);
-
-            /* Increment offset by 1 word to set threshold and output configuration */
-            idx++;
-
-            /* Set threshold */
-            *(data_p + idx) = BMI2_SET_BIT_POS0(*(data_p + idx), BMI2_ANY_NO_MOT_THRES, config->threshold);
+            /* Define the offset for enable/disable of any-motion axes */
+            idx = any_mot_config.start_addr + BMI2_ANY_MOT_FEAT_EN_OFFSET;
 
-            /* Increment offset by 1 more word to get the total length in words */
-            idx++;
+            /* Set the feature enable bit */
+            feat_config[idx] = BMI2_SET_BITS(feat_config[idx], BMI2_ANY_NO_MOT_EN, enable);
 
-            /* Get total length in bytes to copy from local pointer to the array */
-            idx = (uint8_t)(idx * 2) - no_mot_config.start_addr;
+            /* Set the configuration back to the page */
+            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
 
-            /* Copy the bytes to be set back to the array */
-            for (index = 0; index < idx; index++)
+            if ((rslt == BMI2_OK) && (enable == BMI2_ENABLE))
             {
-                feat_config[no_mot_config.start_addr +
-                            index] = *((uint8_t *) data_p + no_mot_config.start_addr + index);
+                dev->sens_en_stat |= BMI2_ANY_MOT_SEL;
+            }
+            else
+            {
+                dev->sens_en_stat &= ~BMI2_ANY_MOT_SEL;
             }
-
-            /* Set the configuration back to the page */
-            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
         }
     }
     else
@@ -3948,10 +2899,9 @@ static int8_t set_no_motion_config(const struct bmi2_no_motion_config *config, s
 }
 
 /*!
- * @brief This internal API sets sig-motion configurations like block-size,
- * output-configuration and other parameters.
+ * @brief This internal API is used to enable/disable no-motion feature.
  */
-static int8_t set_sig_motion_config(const struct bmi2_sig_motion_config *config, struct bmi2_dev *dev)
+static int8_t set_no_motion(uint8_t enable, struct bmi2_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
@@ -3962,47 +2912,37 @@ static int8_t set_sig_motion_config(const struct bmi2_sig_motion_config *config,
     /* Variable to define the array offset */
     uint8_t idx = 0;
 
-    /* Variable to define index */
-    uint8_t index = 0;
-
     /* Variable to set flag */
     uint8_t feat_found;
 
-    /* Initialize feature configuration for sig-motion */
-    struct bmi2_feature_config sig_mot_config = { 0, 0, 0 };
-
-    /* Copy the feature configuration address to a local pointer */
-    uint16_t *data_p = (uint16_t *) (void *)feat_config;
+    /* Initialize feature configuration for no-motion */
+    struct bmi2_feature_config no_mot_config = { 0, 0, 0 };
 
-    /* Search for sig-motion feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&sig_mot_config, BMI2_SIG_MOTION, dev);
+    /* Search for no-motion feature and extract its configurations details */
+    feat_found = bmi2_extract_input_feat_config(&no_mot_config, BMI2_NO_MOTION, dev);
     if (feat_found)
     {
-        /* Get the configuration from the page where sig-motion feature resides */
-        rslt = bmi2_get_feat_config(sig_mot_config.page, feat_config, dev);
+        /* Get the configuration from the page where any/no-motion feature resides */
+        rslt = bmi2_get_feat_config(no_mot_config.page, feat_config, dev);
         if (rslt == BMI2_OK)
         {
-            /* Define the offset in bytes for sig-motion select */
-            idx = sig_mot_config.start_addr;
-
-            /* Get offset in words since all the features are set in words length */
-            idx = idx / 2;
+            /* Define the offset for enable/disable of no-motion axes */
+            idx = no_mot_config.start_addr + BMI2_NO_MOT_FEAT_EN_OFFSET;
 
-            /* Set parameter 1 */
-            *(data_p + idx) = BMI2_SET_BIT_POS0(*(data_p + idx), BMI2_SIG_MOT_PARAM_1, config->block_size);
+            /* Set the feature enable bit */
+            feat_config[idx] = BMI2_SET_BITS(feat_config[idx], BMI2_ANY_NO_MOT_EN, enable);
 
-            /* Get total length in bytes to copy from local pointer to the array */
-            idx = (uint8_t)(idx * 2) - sig_mot_config.start_addr;
+            /* Set the configuration back to the page */
+            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
 
-            /* Copy the bytes to be set back to the array */
-            for (index = 0; index < idx; index++)
+            if ((rslt == BMI2_OK) && (enable == BMI2_ENABLE))
             {
-                feat_config[sig_mot_config.start_addr +
-                            index] = *((uint8_t *) data_p + sig_mot_config.start_addr + index);
+                dev->sens_en_stat |= BMI2_NO_MOT_SEL;
+            }
+            else
+            {
+                dev->sens_en_stat &= ~BMI2_NO_MOT_SEL;
             }
-
-            /* Set the configuration back to the page */
-            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
         }
     }
     else
@@ -4013,10 +2953,10 @@ static int8_t set_sig_motion_config(const struct bmi2_sig_motion_config *config,
     return rslt;
 }
 
-/* @brief This internal API sets step counter configurations like water-mark
- * level, reset-counter and output-configuration step detector and activity.
+/*!
+ * @brief This internal API is used to enable/disable step detector feature.
  */
-static int8_t set_step_config(const struct bmi2_step_config *config, struct bmi2_dev *dev)
+static int8_t set_step_detector(uint8_t enable, struct bmi2_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
@@ -4027,61 +2967,37 @@ static int8_t set_step_config(const struct bmi2_step_config *config, struct bmi2
     /* Variable to define the array offset */
     uint8_t idx = 0;
 
-    /* Variable to define index */
-    uint8_t index = 0;
-
     /* Variable to set flag */
     uint8_t feat_found;
 
-    /* Initialize feature configuration for step counter 4 */
-    struct bmi2_feature_config step_count_config = { 0, 0, 0 };
-
-    /* Copy the feature configuration address to a local pointer */
-    uint16_t *data_p = (uint16_t *) (void *)feat_config;
+    /* Initialize feature configuration for step detector */
+    struct bmi2_feature_config step_det_config = { 0, 0, 0 };
 
-    /* Search for step counter feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&step_count_config, BMI2_STEP_COUNTER, dev);
+    /* Search for step detector feature and extract its configuration details */
+    feat_found = bmi2_extract_input_feat_config(&step_det_config, BMI2_STEP_DETECTOR, dev);
     if (feat_found)
     {
-        /* Get the configuration from the page where step counter resides */
-        rslt = bmi2_get_feat_config(step_count_config.page, feat_config, dev);
+        /* Get the configuration from the page where step detector feature resides */
+        rslt = bmi2_get_feat_config(step_det_config.page, feat_config, dev);
         if (rslt == BMI2_OK)
         {
-            /* Define the offset in bytes */
-            idx = step_count_config.start_addr;
-
-            /* Get offset in words since all the features are set in words length */
-            idx = idx / 2;
-
-            /* Set water-mark level */
-            *(data_p + idx) = BMI2_SET_BIT_POS0(*(data_p + idx), BMI2_STEP_COUNT_WM_LEVEL, config->watermark_level);
-
-            /* Set reset-counter */
-            *(data_p + idx) = BMI2_SET_BITS(*(data_p + idx), BMI2_STEP_COUNT_RST_CNT, config->reset_counter);
-
-            /* Increment offset by 1 word  to set output
-             * configuration of step detector and step activity
-             */
-            idx++;
-
-            /* Set step buffer size */
-            *(data_p + idx) = BMI2_SET_BITS(*(data_p + idx), BMI2_STEP_BUFFER_SIZE, config->step_buffer_size);
+            /* Define the offset for enable/disable of step detector */
+            idx = step_det_config.start_addr + BMI2_STEP_COUNT_FEAT_EN_OFFSET;
 
-            /* Increment offset by 1 more word to get the total length in words */
-            idx++;
+            /* Set the feature enable bit */
+            feat_config[idx] = BMI2_SET_BITS(feat_config[idx], BMI2_STEP_DET_FEAT_EN, enable);
 
-            /* Get total length in bytes to copy from local pointer to the array */
-            idx = (uint8_t)(idx * 2) - step_count_config.start_addr;
+            /* Set the configuration back to the page */
+            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
 
-            /* Copy the bytes to be set back to the array */
-            for (index = 0; index < idx; index++)
+            if ((rslt == BMI2_OK) && (enable == BMI2_ENABLE))
             {
-                feat_config[step_count_config.start_addr +
-                            index] = *((uint8_t *) data_p + step_count_config.start_addr + index);
+                dev->sens_en_stat |= BMI2_STEP_DETECT_SEL;
+            }
+            else
+            {
+                dev->sens_en_stat &= ~BMI2_STEP_DETECT_SEL;
             }
-
-            /* Set the configuration back to the page */
-            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
         }
     }
     else
@@ -4092,25 +3008,10 @@ static int8_t set_step_config(const struct bmi2_step_config *config, struct bmi2
     return rslt;
 }
 
-/* @brief This internal API sets tap configurations like sensitivity,
- * single, double and triple tap enable and output-configuration.
- */
-static int8_t set_tap_detector_config(struct bmi2_tap_config *config, struct bmi2_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt;
-
-    rslt = dev->set_tap_config(config, dev);
-
-    return rslt;
-}
-
 /*!
- * @brief This internal API sets orientation configurations like upside/down
- * detection, symmetrical modes, blocking mode, theta, hysteresis and output
- * configuration.
+ * @brief This internal API is used to enable/disable step counter feature.
  */
-static int8_t set_orient_config(const struct bmi2_orient_config *config, struct bmi2_dev *dev)
+static int8_t set_step_counter(uint8_t enable, struct bmi2_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
@@ -4121,65 +3022,37 @@ static int8_t set_orient_config(const struct bmi2_orient_config *config, struct
     /* Variable to define the array offset */
     uint8_t idx = 0;
 
-    /* Variable to define index */
-    uint8_t index = 0;
-
     /* Variable to set flag */
     uint8_t feat_found;
 
-    /* Initialize feature configuration for orient */
-    struct bmi2_feature_config orient_config = { 0, 0, 0 };
-
-    /* Copy the feature configuration address to a local pointer */
-    uint16_t *data_p = (uint16_t *) (void *)feat_config;
+    /* Initialize feature configuration for step counter */
+    struct bmi2_feature_config step_count_config = { 0, 0, 0 };
 
-    /* Search for orient feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&orient_config, BMI2_ORIENTATION, dev);
+    /* Search for step counter feature and extract its configuration details */
+    feat_found = bmi2_extract_input_feat_config(&step_count_config, BMI2_STEP_COUNTER, dev);
     if (feat_found)
     {
-        /* Get the configuration from the page where orient feature resides */
-        rslt = bmi2_get_feat_config(orient_config.page, feat_config, dev);
+        /* Get the configuration from the page where step-counter feature resides */
+        rslt = bmi2_get_feat_config(step_count_config.page, feat_config, dev);
         if (rslt == BMI2_OK)
         {
-            /* Define the offset in bytes for orient select */
-            idx = orient_config.start_addr;
-
-            /* Get offset in words since all the features are set in words length */
-            idx = idx / 2;
-
-            /* Set upside/down detection */
-            *(data_p + idx) = BMI2_SET_BITS(*(data_p + idx), BMI2_ORIENT_UP_DOWN, config->ud_en);
-
-            /* Set symmetrical modes */
-            *(data_p + idx) = BMI2_SET_BITS(*(data_p + idx), BMI2_ORIENT_SYMM_MODE, config->mode);
-
-            /* Set blocking mode */
-            *(data_p + idx) = BMI2_SET_BITS(*(data_p + idx), BMI2_ORIENT_BLOCK_MODE, config->blocking);
-
-            /* Set theta */
-            *(data_p + idx) = BMI2_SET_BITS(*(data_p + idx), BMI2_ORIENT_THETA, config->theta);
-
-            /* Increment offset by 1 more word to set hysteresis and output configuration */
-            idx++;
-
-            /* Set hysteresis */
-            *(data_p + idx) = BMI2_SET_BIT_POS0(*(data_p + idx), BMI2_ORIENT_HYST, config->hysteresis);
+            /* Define the offset for enable/disable of step counter */
+            idx = step_count_config.start_addr + BMI2_STEP_COUNT_FEAT_EN_OFFSET;
 
-            /* Increment offset by 1 more word to get the total length in words */
-            idx++;
+            /* Set the feature enable bit */
+            feat_config[idx] = BMI2_SET_BITS(feat_config[idx], BMI2_STEP_COUNT_FEAT_EN, enable);
 
-            /* Get total length in bytes to copy from local pointer to the array */
-            idx = (uint8_t)(idx * 2) - orient_config.start_addr;
+            /* Set the configuration back to the page */
+            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
 
-            /* Copy the bytes to be set back to the array */
-            for (index = 0; index < idx; index++)
+            if ((rslt == BMI2_OK) && (enable == BMI2_ENABLE))
+            {
+                dev->sens_en_stat |= BMI2_STEP_COUNT_SEL;
+            }
+            else
             {
-                feat_config[orient_config.start_addr +
-                            index] = *((uint8_t *) data_p + orient_config.start_addr + index);
+                dev->sens_en_stat &= ~BMI2_STEP_COUNT_SEL;
             }
-
-            /* Set the configuration back to the page */
-            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
         }
     }
     else
@@ -4191,10 +3064,9 @@ static int8_t set_orient_config(const struct bmi2_orient_config *config, struct
 }
 
 /*!
- * @brief This internal API sets high-g configurations like threshold,
- * hysteresis, duration, and out0put configuration.
+ * @brief This internal API is used to enable/disable step activity detection.
  */
-static int8_t set_high_g_config(const struct bmi2_high_g_config *config, struct bmi2_dev *dev)
+static int8_t set_step_activity(uint8_t enable, struct bmi2_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
@@ -4205,71 +3077,39 @@ static int8_t set_high_g_config(const struct bmi2_high_g_config *config, struct
     /* Variable to define the array offset */
     uint8_t idx = 0;
 
-    /* Variable to define index */
-    uint8_t index = 0;
-
     /* Variable to set flag */
     uint8_t feat_found;
 
-    /* Initialize feature configuration for high-g */
-    struct bmi2_feature_config high_g_config = { 0, 0, 0 };
-
-    /* Copy the feature configuration address to a local pointer */
-    uint16_t *data_p = (uint16_t *) (void *)feat_config;
+    /* Initialize feature configuration for step activity */
+    struct bmi2_feature_config step_act_config = { 0, 0, 0 };
 
-    /* Search for high-g feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&high_g_config, BMI2_HIGH_G, dev);
+    /* Search for step activity feature and extract its configuration details */
+    feat_found = bmi2_extract_input_feat_config(&step_act_config, BMI2_STEP_ACTIVITY, dev);
     if (feat_found)
     {
-        /* Get the configuration from the page where high-g feature resides */
-        rslt = bmi2_get_feat_config(high_g_config.page, feat_config, dev);
+        /* Get the configuration from the page where step-activity
+         * feature resides
+         */
+        rslt = bmi2_get_feat_config(step_act_config.page, feat_config, dev);
         if (rslt == BMI2_OK)
         {
-            /* Define the offset in bytes for high-g select */
-            idx = high_g_config.start_addr;
-
-            /* Get offset in words since all the features are set in words length */
-            idx = idx / 2;
-
-            /* Set threshold */
-            *(data_p + idx) = BMI2_SET_BIT_POS0(*(data_p + idx), BMI2_HIGH_G_THRES, config->threshold);
-
-            /* Increment offset by 1 more word to set hysteresis */
-            idx++;
-
-            /* Set hysteresis */
-            *(data_p + idx) = BMI2_SET_BIT_POS0(*(data_p + idx), BMI2_HIGH_G_HYST, config->hysteresis);
-
-            /* Set x-select */
-            *(data_p + idx) = BMI2_SET_BITS(*(data_p + idx), BMI2_HIGH_G_X_SEL, config->select_x);
-
-            /* Set y-select */
-            *(data_p + idx) = BMI2_SET_BITS(*(data_p + idx), BMI2_HIGH_G_Y_SEL, config->select_y);
-
-            /* Set z-select */
-            *(data_p + idx) = BMI2_SET_BITS(*(data_p + idx), BMI2_HIGH_G_Z_SEL, config->select_z);
-
-            /* Increment offset by 1 more word to set duration and output configuration */
-            idx++;
-
-            /* Set duration */
-            *(data_p + idx) = BMI2_SET_BIT_POS0(*(data_p + idx), BMI2_HIGH_G_DUR, config->duration);
+            /* Define the offset for enable/disable of step activity */
+            idx = step_act_config.start_addr + BMI2_STEP_COUNT_FEAT_EN_OFFSET;
 
-            /* Increment offset by 1 more word to get the total length in words */
-            idx++;
+            /* Set the feature enable bit */
+            feat_config[idx] = BMI2_SET_BITS(feat_config[idx], BMI2_STEP_ACT_FEAT_EN, enable);
 
-            /* Get total length in bytes to copy from local pointer to the array */
-            idx = (uint8_t)(idx * 2) - high_g_config.start_addr;
+            /* Set the configuration back to the page */
+            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
 
-            /* Copy the bytes to be set back to the array */
-            for (index = 0; index < idx; index++)
+            if ((rslt == BMI2_OK) && (enable == BMI2_ENABLE))
             {
-                feat_config[high_g_config.start_addr +
-                            index] = *((uint8_t *) data_p + high_g_config.start_addr + index);
+                dev->sens_en_stat |= BMI2_STEP_ACT_SEL;
+            }
+            else
+            {
+                dev->sens_en_stat &= ~BMI2_STEP_ACT_SEL;
             }
-
-            /* Set the configuration back to the page */
-            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
         }
     }
     else
@@ -4281,10 +3121,9 @@ static int8_t set_high_g_config(const struct bmi2_high_g_config *config, struct
 }
 
 /*!
- * @brief This internal API sets low-g configurations like threshold,
- * hysteresis, duration, and output configuration.
+ * @brief This internal API is used to enable/disable sig-motion feature.
  */
-static int8_t set_low_g_config(const struct bmi2_low_g_config *config, struct bmi2_dev *dev)
+static int8_t set_sig_motion(uint8_t enable, struct bmi2_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
@@ -4295,61 +3134,37 @@ static int8_t set_low_g_config(const struct bmi2_low_g_config *config, struct bm
     /* Variable to define the array offset */
     uint8_t idx = 0;
 
-    /* Variable to define index */
-    uint8_t index = 0;
-
     /* Variable to set flag */
     uint8_t feat_found;
 
-    /* Initialize feature configuration for low-g */
-    struct bmi2_feature_config low_g_config = { 0, 0, 0 };
-
-    /* Copy the feature configuration address to a local pointer */
-    uint16_t *data_p = (uint16_t *) (void *)feat_config;
+    /* Initialize feature configuration for sig-motion */
+    struct bmi2_feature_config sig_mot_config = { 0, 0, 0 };
 
-    /* Search for low-g feature and extract its configuration details  */
-    feat_found = bmi2_extract_input_feat_config(&low_g_config, BMI2_LOW_G, dev);
+    /* Search for sig-motion feature and extract its configuration details */
+    feat_found = bmi2_extract_input_feat_config(&sig_mot_config, BMI2_SIG_MOTION, dev);
     if (feat_found)
     {
-        /* Get the configuration from the page where low-g feature resides */
-        rslt = bmi2_get_feat_config(low_g_config.page, feat_config, dev);
+        /* Get the configuration from the page where sig-motion feature resides */
+        rslt = bmi2_get_feat_config(sig_mot_config.page, feat_config, dev);
         if (rslt == BMI2_OK)
         {
-            /* Define the offset in bytes for low-g select */
-            idx = low_g_config.start_addr;
-
-            /* Get offset in words since all the features are set in words length */
-            idx = idx / 2;
-
-            /* Set threshold */
-            *(data_p + idx) = BMI2_SET_BIT_POS0(*(data_p + idx), BMI2_LOW_G_THRES, config->threshold);
-
-            /* Increment offset by 1 more word to set hysteresis */
-            idx++;
-
-            /* Set hysteresis */
-            *(data_p + idx) = BMI2_SET_BIT_POS0(*(data_p + idx), BMI2_LOW_G_HYST, config->hysteresis);
-
-            /* Increment offset by 1 more word to set duration and output configuration */
-            idx++;
-
-            /* Set duration */
-            *(data_p + idx) = BMI2_SET_BIT_POS0(*(data_p + idx), BMI2_LOW_G_DUR, config->duration);
+            /* Define the offset for enable/disable of sig-motion */
+            idx = sig_mot_config.start_addr + BMI2_SIG_MOT_FEAT_EN_OFFSET;
 
-            /* Increment offset by 1 more word to get the total length in words */
-            idx++;
+            /* Set the feature enable bit */
+            feat_config[idx] = BMI2_SET_BIT_POS0(feat_config[idx], BMI2_SIG_MOT_FEAT_EN, enable);
 
-            /* Get total length in bytes to copy from local pointer to the array */
-            idx = (uint8_t)(idx * 2) - low_g_config.start_addr;
+            /* Set the configuration back to the page */
+            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
 
-            /* Copy the bytes to be set back to the array */
-            for (index = 0; index < idx; index++)
+            if ((rslt == BMI2_OK) && (enable == BMI2_ENABLE))
+            {
+                dev->sens_en_stat |= BMI2_SIG_MOTION_SEL;
+            }
+            else
             {
-                feat_config[low_g_config.start_addr + index] = *((uint8_t *) data_p + low_g_config.start_addr + index);
+                dev->sens_en_stat &= ~BMI2_SIG_MOTION_SEL;
             }
-
-            /* Set the configuration back to the page */
-            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
         }
     }
     else
@@ -4361,10 +3176,10 @@ static int8_t set_low_g_config(const struct bmi2_low_g_config *config, struct bm
 }
 
 /*!
- * @brief This internal API sets flat configurations like theta, blocking,
- * hold-time, hysteresis, and output configuration.
+ * @brief This internal API is used to enable/disable tap feature through
+ * single tap.
  */
-static int8_t set_flat_config(const struct bmi2_flat_config *config, struct bmi2_dev *dev)
+static int8_t set_single_tap(uint8_t enable, struct bmi2_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
@@ -4375,61 +3190,37 @@ static int8_t set_flat_config(const struct bmi2_flat_config *config, struct bmi2
     /* Variable to define the array offset */
     uint8_t idx = 0;
 
-    /* Variable to define index */
-    uint8_t index = 0;
-
     /* Variable to set flag */
     uint8_t feat_found;
 
-    /* Initialize feature configuration for flat */
-    struct bmi2_feature_config flat_config = { 0, 0, 0 };
-
-    /* Copy the feature configuration address to a local pointer */
-    uint16_t *data_p = (uint16_t *) (void *)feat_config;
+    /* Initialize feature configuration for tap */
+    struct bmi2_feature_config tap_config = { 0, 0, 0 };
 
-    /* Search for flat feature and extract its configuration details  */
-    feat_found = bmi2_extract_input_feat_config(&flat_config, BMI2_FLAT, dev);
+    /* Search for tap feature and extract its configuration details */
+    feat_found = bmi2_extract_input_feat_config(&tap_config, BMI2_SINGLE_TAP, dev);
     if (feat_found)
     {
-        /* Get the configuration from the page where flat feature resides */
-        rslt = bmi2_get_feat_config(flat_config.page, feat_config, dev);
+        /* Get the configuration from the page where tap feature resides */
+        rslt = bmi2_get_feat_config(tap_config.page, feat_config, dev);
         if (rslt == BMI2_OK)
         {
-            /* Define the offset in bytes for flat select */
-            idx = flat_config.start_addr;
-
-            /* Get offset in words since all the features are set in words length */
-            idx = idx / 2;
-
-            /* Set theta */
-            *(data_p + idx) = BMI2_SET_BITS(*(data_p + idx), BMI2_FLAT_THETA, config->theta);
-
-            /* Set blocking */
-            *(data_p + idx) = BMI2_SET_BITS(*(data_p + idx), BMI2_FLAT_BLOCK, config->blocking);
-
-            /* Increment offset by 1 more word to set hysteresis and hold-time */
-            idx++;
-
-            /* Set hysteresis */
-            *(data_p + idx) = BMI2_SET_BIT_POS0(*(data_p + idx), BMI2_FLAT_HYST, config->hysteresis);
-
-            /* Set hold-time */
-            *(data_p + idx) = BMI2_SET_BITS(*(data_p + idx), BMI2_FLAT_HOLD_TIME, config->hold_time);
+            /* Define the offset for enable/disable of tap */
+            idx = tap_config.start_addr;
 
-            /* Increment offset by 1 more word to get the total length in words */
-            idx++;
+            /* Set the feature enable bit */
+            feat_config[idx] = BMI2_SET_BIT_POS0(feat_config[idx], BMI2_TAP_SINGLE_TAP_EN, enable);
 
-            /* Get total length in bytes to copy from local pointer to the array */
-            idx = (uint8_t)(idx * 2) - flat_config.start_addr;
+            /* Set the configuration back to the page */
+            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
 
-            /* Copy the bytes to be set back to the array */
-            for (index = 0; index < idx; index++)
+            if ((rslt == BMI2_OK) && (enable == BMI2_ENABLE))
             {
-                feat_config[flat_config.start_addr + index] = *((uint8_t *) data_p + flat_config.start_addr + index);
+                dev->sens_en_stat |= BMI2_SINGLE_TAP_SEL;
+            }
+            else
+            {
+                dev->sens_en_stat &= ~BMI2_SINGLE_TAP_SEL;
             }
-
-            /* Set the configuration back to the page */
-            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
         }
     }
     else
@@ -4441,10 +3232,10 @@ static int8_t set_flat_config(const struct bmi2_flat_config *config, struct bmi2
 }
 
 /*!
- * @brief This internal API gets any-motion configurations like axes select,
- * duration, threshold and output-configuration.
+ * @brief This internal API is used to enable/disable tap feature through
+ * double tap.
  */
-static int8_t get_any_motion_config(struct bmi2_any_motion_config *config, struct bmi2_dev *dev)
+static int8_t set_double_tap(uint8_t enable, struct bmi2_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
@@ -4455,56 +3246,37 @@ static int8_t get_any_motion_config(struct bmi2_any_motion_config *config, struc
     /* Variable to define the array offset */
     uint8_t idx = 0;
 
-    /* Variable to define LSB */
-    uint16_t lsb;
-
-    /* Variable to define MSB */
-    uint16_t msb;
-
-    /* Variable to define a word */
-    uint16_t lsb_msb;
-
     /* Variable to set flag */
     uint8_t feat_found;
 
-    /* Initialize feature configuration for any-motion */
-    struct bmi2_feature_config any_mot_config = { 0, 0, 0 };
+    /* Initialize feature configuration for tap */
+    struct bmi2_feature_config tap_config = { 0, 0, 0 };
 
-    /* Search for any-motion feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&any_mot_config, BMI2_ANY_MOTION, dev);
+    /* Search for tap feature and extract its configuration details */
+    feat_found = bmi2_extract_input_feat_config(&tap_config, BMI2_DOUBLE_TAP, dev);
     if (feat_found)
     {
-        /* Get the configuration from the page where any-motion feature resides */
-        rslt = bmi2_get_feat_config(any_mot_config.page, feat_config, dev);
+        /* Get the configuration from the page where tap feature resides */
+        rslt = bmi2_get_feat_config(tap_config.page, feat_config, dev);
         if (rslt == BMI2_OK)
         {
-            /* Define the offset for feature enable for any-motion */
-            idx = any_mot_config.start_addr;
-
-            /* Get word to calculate duration, x, y and z select */
-            lsb = (uint16_t) feat_config[idx++];
-            msb = ((uint16_t) feat_config[idx++] << 8);
-            lsb_msb = lsb | msb;
-
-            /* Get duration */
-            config->duration = lsb_msb & BMI2_ANY_NO_MOT_DUR_MASK;
-
-            /* Get x-select */
-            config->select_x = (lsb_msb & BMI2_ANY_NO_MOT_X_SEL_MASK) >> BMI2_ANY_NO_MOT_X_SEL_POS;
-
-            /* Get y-select */
-            config->select_y = (lsb_msb & BMI2_ANY_NO_MOT_Y_SEL_MASK) >> BMI2_ANY_NO_MOT_Y_SEL_POS;
+            /* Define the offset for enable/disable of tap */
+            idx = tap_config.start_addr;
 
-            /* Get z-select */
-            config->select_z = (lsb_msb & BMI2_ANY_NO_MOT_Z_SEL_MASK) >> BMI2_ANY_NO_MOT_Z_SEL_POS;
+            /* Set the feature enable bit */
+            feat_config[idx] = BMI2_SET_BITS(feat_config[idx], BMI2_TAP_DOUBLE_TAP_EN, enable);
 
-            /* Get word to calculate threshold, output configuration from the same word */
-            lsb = (uint16_t) feat_config[idx++];
-            msb = ((uint16_t) feat_config[idx++] << 8);
-            lsb_msb = lsb | msb;
+            /* Set the configuration back to the page */
+            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
 
-            /* Get threshold */
-            config->threshold = lsb_msb & BMI2_ANY_NO_MOT_THRES_MASK;
+            if ((rslt == BMI2_OK) && (enable == BMI2_ENABLE))
+            {
+                dev->sens_en_stat |= BMI2_DOUBLE_TAP_SEL;
+            }
+            else
+            {
+                dev->sens_en_stat &= ~BMI2_DOUBLE_TAP_SEL;
+            }
         }
     }
     else
@@ -4516,10 +3288,10 @@ static int8_t get_any_motion_config(struct bmi2_any_motion_config *config, struc
 }
 
 /*!
- * @brief This internal API gets no-motion configurations like axes select,
- * duration, threshold and output-configuration.
+ * @brief This internal API is used to enable/disable tap feature through
+ * triple tap.
  */
-static int8_t get_no_motion_config(struct bmi2_no_motion_config *config, struct bmi2_dev *dev)
+static int8_t set_triple_tap(uint8_t enable, struct bmi2_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
@@ -4530,56 +3302,37 @@ static int8_t get_no_motion_config(struct bmi2_no_motion_config *config, struct
     /* Variable to define the array offset */
     uint8_t idx = 0;
 
-    /* Variable to define LSB */
-    uint16_t lsb = 0;
-
-    /* Variable to define MSB */
-    uint16_t msb = 0;
-
-    /* Variable to define a word */
-    uint16_t lsb_msb = 0;
-
     /* Variable to set flag */
     uint8_t feat_found;
 
-    /* Initialize feature configuration for no-motion */
-    struct bmi2_feature_config no_mot_config = { 0, 0, 0 };
+    /* Initialize feature configuration for tap */
+    struct bmi2_feature_config tap_config = { 0, 0, 0 };
 
-    /* Search for no-motion feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&no_mot_config, BMI2_NO_MOTION, dev);
+    /* Search for tap feature and extract its configuration details */
+    feat_found = bmi2_extract_input_feat_config(&tap_config, BMI2_TRIPLE_TAP, dev);
     if (feat_found)
     {
-        /* Get the configuration from the page where no-motion feature resides */
-        rslt = bmi2_get_feat_config(no_mot_config.page, feat_config, dev);
+        /* Get the configuration from the page where tap feature resides */
+        rslt = bmi2_get_feat_config(tap_config.page, feat_config, dev);
         if (rslt == BMI2_OK)
         {
-            /* Define the offset for feature enable for no-motion */
-            idx = no_mot_config.start_addr;
-
-            /* Get word to calculate duration, x, y and z select */
-            lsb = (uint16_t) feat_config[idx++];
-            msb = ((uint16_t) feat_config[idx++] << 8);
-            lsb_msb = lsb | msb;
-
-            /* Get duration */
-            config->duration = lsb_msb & BMI2_ANY_NO_MOT_DUR_MASK;
-
-            /* Get x-select */
-            config->select_x = (lsb_msb & BMI2_ANY_NO_MOT_X_SEL_MASK) >> BMI2_ANY_NO_MOT_X_SEL_POS;
-
-            /* Get y-select */
-            config->select_y = (lsb_msb & BMI2_ANY_NO_MOT_Y_SEL_MASK) >> BMI2_ANY_NO_MOT_Y_SEL_POS;
+            /* Define the offset for enable/disable of tap */
+            idx = tap_config.start_addr;
 
-            /* Get z-select */
-            config->select_z = (lsb_msb & BMI2_ANY_NO_MOT_Z_SEL_MASK) >> BMI2_ANY_NO_MOT_Z_SEL_POS;
+            /* Set the feature enable bit */
+            feat_config[idx] = BMI2_SET_BITS(feat_config[idx], BMI2_TAP_TRIPLE_TAP_EN, enable);
 
-            /* Get word to calculate threshold, output configuration from the same word */
-            lsb = (uint16_t) feat_config[idx++];
-            msb = ((uint16_t) feat_config[idx++] << 8);
-            lsb_msb = lsb | msb;
+            /* Set the configuration back to the page */
+            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
 
-            /* Get threshold */
-            config->threshold = lsb_msb & BMI2_ANY_NO_MOT_THRES_MASK;
+            if ((rslt == BMI2_OK) && (enable == BMI2_ENABLE))
+            {
+                dev->sens_en_stat |= BMI2_TRIPLE_TAP_SEL;
+            }
+            else
+            {
+                dev->sens_en_stat &= ~BMI2_TRIPLE_TAP_SEL;
+            }
         }
     }
     else
@@ -4591,10 +3344,9 @@ static int8_t get_no_motion_config(struct bmi2_no_motion_config *config, struct
 }
 
 /*!
- * @brief This internal API gets sig-motion configurations like block-size,
- * output-configuration and other parameters.
+ * @brief This internal API is used to enable/disable orientation feature.
  */
-static int8_t get_sig_motion_config(struct bmi2_sig_motion_config *config, struct bmi2_dev *dev)
+static int8_t set_orientation(uint8_t enable, struct bmi2_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
@@ -4605,39 +3357,37 @@ static int8_t get_sig_motion_config(struct bmi2_sig_motion_config *config, struc
     /* Variable to define the array offset */
     uint8_t idx = 0;
 
-    /* Variable to define LSB */
-    uint16_t lsb = 0;
-
-    /* Variable to define MSB */
-    uint16_t msb = 0;
-
-    /* Variable to define a word */
-    uint16_t lsb_msb = 0;
-
     /* Variable to set flag */
     uint8_t feat_found;
 
-    /* Initialize feature configuration sig-motion */
-    struct bmi2_feature_config sig_mot_config = { 0, 0, 0 };
+    /* Initialize feature configuration for orientation */
+    struct bmi2_feature_config orient_config = { 0, 0, 0 };
 
-    /* Search for sig-motion feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&sig_mot_config, BMI2_SIG_MOTION, dev);
+    /* Search for orientation feature and extract its configuration details */
+    feat_found = bmi2_extract_input_feat_config(&orient_config, BMI2_ORIENTATION, dev);
     if (feat_found)
     {
-        /* Get the configuration from the page where sig-motion feature resides */
-        rslt = bmi2_get_feat_config(sig_mot_config.page, feat_config, dev);
+        /* Get the configuration from the page where orientation feature resides */
+        rslt = bmi2_get_feat_config(orient_config.page, feat_config, dev);
         if (rslt == BMI2_OK)
         {
-            /* Define the offset for feature enable for sig-motion */
-            idx = sig_mot_config.start_addr;
+            /* Define the offset for enable/disable of orientation */
+            idx = orient_config.start_addr;
+
+            /* Set the feature enable bit */
+            feat_config[idx] = BMI2_SET_BIT_POS0(feat_config[idx], BMI2_ORIENT_FEAT_EN, enable);
 
-            /* Get word to calculate parameter 1 */
-            lsb = (uint16_t) feat_config[idx++];
-            msb = ((uint16_t) feat_config[idx++] << 8);
-            lsb_msb = lsb | msb;
+            /* Set the configuration back to the page */
+            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
 
-            /* Get parameter 1  */
-            config->block_size = lsb_msb & BMI2_SIG_MOT_PARAM_1_MASK;
+            if ((rslt == BMI2_OK) && (enable == BMI2_ENABLE))
+            {
+                dev->sens_en_stat |= BMI2_ORIENT_SEL;
+            }
+            else
+            {
+                dev->sens_en_stat &= ~BMI2_ORIENT_SEL;
+            }
         }
     }
     else
@@ -4649,9 +3399,9 @@ static int8_t get_sig_motion_config(struct bmi2_sig_motion_config *config, struc
 }
 
 /*!
- * @brief This internal API gets step counter/detector/activity configurations.
+ * @brief This internal API is used to enable/disable high-g feature.
  */
-static int8_t get_step_config(struct bmi2_step_config *config, struct bmi2_dev *dev)
+static int8_t set_high_g(uint8_t enable, struct bmi2_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
@@ -4662,49 +3412,37 @@ static int8_t get_step_config(struct bmi2_step_config *config, struct bmi2_dev *
     /* Variable to define the array offset */
     uint8_t idx = 0;
 
-    /* Variable to define LSB */
-    uint16_t lsb = 0;
-
-    /* Variable to define MSB */
-    uint16_t msb = 0;
-
-    /* Variable to define a word */
-    uint16_t lsb_msb = 0;
-
     /* Variable to set flag */
     uint8_t feat_found;
 
-    /* Initialize feature configuration for step counter */
-    struct bmi2_feature_config step_count_config = { 0, 0, 0 };
+    /* Initialize feature configuration for high-g */
+    struct bmi2_feature_config high_g_config = { 0, 0, 0 };
 
-    /* Search for step counter 4 feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&step_count_config, BMI2_STEP_COUNTER, dev);
+    /* Search for high-g feature and extract its configuration details */
+    feat_found = bmi2_extract_input_feat_config(&high_g_config, BMI2_HIGH_G, dev);
     if (feat_found)
     {
-        /* Get the configuration from the page where step counter 4 parameter resides */
-        rslt = bmi2_get_feat_config(step_count_config.page, feat_config, dev);
+        /* Get the configuration from the page where high-g feature resides */
+        rslt = bmi2_get_feat_config(high_g_config.page, feat_config, dev);
         if (rslt == BMI2_OK)
         {
-            /* Define the offset for feature enable for step counter/detector/activity */
-            idx = step_count_config.start_addr;
-
-            /* Get word to calculate water-mark level and reset counter */
-            lsb = (uint16_t) feat_config[idx++];
-            msb = ((uint16_t) feat_config[idx++] << 8);
-            lsb_msb = lsb | msb;
-
-            /* Get water-mark level */
-            config->watermark_level = lsb_msb & BMI2_STEP_COUNT_WM_LEVEL_MASK;
+            /* Define the offset for enable/disable of high-g */
+            idx = high_g_config.start_addr + BMI2_HIGH_G_FEAT_EN_OFFSET;
 
-            /* Get reset counter */
-            config->reset_counter = (lsb_msb & BMI2_STEP_COUNT_RST_CNT_MASK) >> BMI2_STEP_COUNT_RST_CNT_POS;
+            /* Set the feature enable bit */
+            feat_config[idx] = BMI2_SET_BITS(feat_config[idx], BMI2_HIGH_G_FEAT_EN, enable);
 
-            /* Get word to calculate output configuration of step detector and activity */
-            lsb = (uint16_t) feat_config[idx++];
-            msb = ((uint16_t) feat_config[idx++] << 8);
-            lsb_msb = lsb | msb;
+            /* Set the configuration back to the page */
+            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
 
-            config->step_buffer_size = (lsb_msb & BMI2_STEP_BUFFER_SIZE_MASK) >> BMI2_STEP_BUFFER_SIZE_POS;
+            if ((rslt == BMI2_OK) && (enable == BMI2_ENABLE))
+            {
+                dev->sens_en_stat |= BMI2_HIGH_G_SEL;
+            }
+            else
+            {
+                dev->sens_en_stat &= ~BMI2_HIGH_G_SEL;
+            }
         }
     }
     else
@@ -4716,25 +3454,9 @@ static int8_t get_step_config(struct bmi2_step_config *config, struct bmi2_dev *
 }
 
 /*!
- * @brief This internal API gets tap configurations like sensitivity,
- * single, double and triple tap enable and output-configuration.
- */
-static int8_t get_tap_detector_config(struct bmi2_tap_config *config, struct bmi2_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt;
-
-    rslt = dev->get_tap_config(config, dev);
-
-    return rslt;
-}
-
-/*!
- * @brief This internal API gets orientation configurations like upside/down
- * detection, symmetrical modes, blocking mode, theta, hysteresis and output
- * configuration.
+ * @brief This internal API is used to enable/disable low-g feature.
  */
-static int8_t get_orient_config(struct bmi2_orient_config *config, struct bmi2_dev *dev)
+static int8_t set_low_g(uint8_t enable, struct bmi2_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
@@ -4745,58 +3467,37 @@ static int8_t get_orient_config(struct bmi2_orient_config *config, struct bmi2_d
     /* Variable to define the array offset */
     uint8_t idx = 0;
 
-    /* Variable to define LSB */
-    uint16_t lsb = 0;
-
-    /* Variable to define MSB */
-    uint16_t msb = 0;
-
-    /* Variable to define a word */
-    uint16_t lsb_msb = 0;
-
     /* Variable to set flag */
     uint8_t feat_found;
 
-    /* Initialize feature configuration for orient */
-    struct bmi2_feature_config orient_config = { 0, 0, 0 };
+    /* Initialize feature configuration for low-g */
+    struct bmi2_feature_config low_g_config = { 0, 0, 0 };
 
-    /* Search for orient feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&orient_config, BMI2_ORIENTATION, dev);
+    /* Search for low-g feature and extract its configuration details */
+    feat_found = bmi2_extract_input_feat_config(&low_g_config, BMI2_LOW_G, dev);
     if (feat_found)
     {
-        /* Get the configuration from the page where orient feature resides */
-        rslt = bmi2_get_feat_config(orient_config.page, feat_config, dev);
+        /* Get the configuration from the page where low-g feature resides */
+        rslt = bmi2_get_feat_config(low_g_config.page, feat_config, dev);
         if (rslt == BMI2_OK)
         {
-            /* Define the offset in bytes for orient select */
-            idx = orient_config.start_addr;
-
-            /* Get word to calculate upside/down detection,
-             * symmetrical modes, blocking mode and theta
-             */
-            lsb = (uint16_t) feat_config[idx++];
-            msb = ((uint16_t) feat_config[idx++] << 8);
-            lsb_msb = lsb | msb;
-
-            /* Get upside/down detection */
-            config->ud_en = (lsb_msb & BMI2_ORIENT_UP_DOWN_MASK) >> BMI2_ORIENT_UP_DOWN_POS;
-
-            /* Get symmetrical modes */
-            config->mode = (lsb_msb & BMI2_ORIENT_SYMM_MODE_MASK) >> BMI2_ORIENT_SYMM_MODE_POS;
-
-            /* Get blocking mode */
-            config->blocking = (lsb_msb & BMI2_ORIENT_BLOCK_MODE_MASK) >> BMI2_ORIENT_BLOCK_MODE_POS;
+            /* Define the offset for enable/disable of low-g */
+            idx = low_g_config.start_addr + BMI2_LOW_G_FEAT_EN_OFFSET;
 
-            /* Get theta */
-            config->theta = (lsb_msb & BMI2_ORIENT_THETA_MASK) >> BMI2_ORIENT_THETA_POS;
+            /* Set the feature enable bit */
+            feat_config[idx] = BMI2_SET_BITS(feat_config[idx], BMI2_LOW_G_FEAT_EN, enable);
 
-            /* Get the next word to calculate hysteresis and output configuration */
-            lsb = (uint16_t) feat_config[idx++];
-            msb = ((uint16_t) feat_config[idx++] << 8);
-            lsb_msb = lsb | msb;
+            /* Set the configuration back to the page */
+            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
 
-            /* Get hysteresis */
-            config->hysteresis = lsb_msb & BMI2_ORIENT_HYST_MASK;
+            if ((rslt == BMI2_OK) && (enable == BMI2_ENABLE))
+            {
+                dev->sens_en_stat |= BMI2_LOW_G_SEL;
+            }
+            else
+            {
+                dev->sens_en_stat &= ~BMI2_LOW_G_SEL;
+            }
         }
     }
     else
@@ -4808,10 +3509,9 @@ static int8_t get_orient_config(struct bmi2_orient_config *config, struct bmi2_d
 }
 
 /*!
- * @brief This internal API gets high-g configurations like threshold,
- * hysteresis, duration, and output configuration.
+ * @brief This internal API is used to enable/disable flat feature.
  */
-static int8_t get_high_g_config(struct bmi2_high_g_config *config, struct bmi2_dev *dev)
+static int8_t set_flat(uint8_t enable, struct bmi2_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
@@ -4822,64 +3522,37 @@ static int8_t get_high_g_config(struct bmi2_high_g_config *config, struct bmi2_d
     /* Variable to define the array offset */
     uint8_t idx = 0;
 
-    /* Variable to define LSB */
-    uint16_t lsb = 0;
-
-    /* Variable to define MSB */
-    uint16_t msb = 0;
-
-    /* Variable to define a word */
-    uint16_t lsb_msb = 0;
-
     /* Variable to set flag */
     uint8_t feat_found;
 
-    /* Initialize feature configuration for high-g */
-    struct bmi2_feature_config high_g_config = { 0, 0, 0 };
+    /* Initialize feature configuration for flat */
+    struct bmi2_feature_config flat_config = { 0, 0, 0 };
 
-    /* Search for high-g feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&high_g_config, BMI2_HIGH_G, dev);
+    /* Search for flat feature and extract its configuration details */
+    feat_found = bmi2_extract_input_feat_config(&flat_config, BMI2_FLAT, dev);
     if (feat_found)
     {
-        /* Get the configuration from the page where high-g feature resides */
-        rslt = bmi2_get_feat_config(high_g_config.page, feat_config, dev);
+        /* Get the configuration from the page where flat feature resides */
+        rslt = bmi2_get_feat_config(flat_config.page, feat_config, dev);
         if (rslt == BMI2_OK)
         {
-            /* Define the offset in bytes for high-g select */
-            idx = high_g_config.start_addr;
-
-            /* Get word to calculate threshold */
-            lsb = (uint16_t) feat_config[idx++];
-            msb = ((uint16_t) feat_config[idx++] << 8);
-            lsb_msb = lsb | msb;
-
-            /* Get threshold */
-            config->threshold = lsb_msb & BMI2_HIGH_G_THRES_MASK;
-
-            /* Get word to calculate hysteresis */
-            lsb = (uint16_t) feat_config[idx++];
-            msb = ((uint16_t) feat_config[idx++] << 8);
-            lsb_msb = lsb | msb;
-
-            /* Get hysteresis */
-            config->hysteresis = lsb_msb & BMI2_HIGH_G_HYST_MASK;
-
-            /* Get x_select */
-            config->select_x = (lsb_msb & BMI2_HIGH_G_X_SEL_MASK) >> BMI2_HIGH_G_X_SEL_POS;
-
-            /* Get y_select */
-            config->select_y = (lsb_msb & BMI2_HIGH_G_Y_SEL_MASK) >> BMI2_HIGH_G_Y_SEL_POS;
+            /* Define the offset for enable/disable of flat */
+            idx = flat_config.start_addr;
 
-            /* Get z_select */
-            config->select_z = (lsb_msb & BMI2_HIGH_G_Z_SEL_MASK) >> BMI2_HIGH_G_Z_SEL_POS;
+            /* Set the feature enable bit */
+            feat_config[idx] = BMI2_SET_BIT_POS0(feat_config[idx], BMI2_FLAT_FEAT_EN, enable);
 
-            /* Get word to calculate duration and output configuration */
-            lsb = (uint16_t) feat_config[idx++];
-            msb = ((uint16_t) feat_config[idx++] << 8);
-            lsb_msb = lsb | msb;
+            /* Set the configuration back to the page */
+            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
 
-            /* Get duration */
-            config->duration = lsb_msb & BMI2_HIGH_G_DUR_MASK;
+            if ((rslt == BMI2_OK) && (enable == BMI2_ENABLE))
+            {
+                dev->sens_en_stat |= BMI2_FLAT_SEL;
+            }
+            else
+            {
+                dev->sens_en_stat &= ~BMI2_FLAT_SEL;
+            }
         }
     }
     else
@@ -4891,10 +3564,10 @@ static int8_t get_high_g_config(struct bmi2_high_g_config *config, struct bmi2_d
 }
 
 /*!
- * @brief This internal API gets low-g configurations like threshold,
- * hysteresis, duration, and output configuration.
+ * @brief This internal API gives an option to enable self-offset correction
+ * feature of gyroscope, either internally or by the host.
  */
-static int8_t get_low_g_config(struct bmi2_low_g_config *config, struct bmi2_dev *dev)
+static int8_t set_gyro_self_offset_corr(uint8_t enable, struct bmi2_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
@@ -4905,55 +3578,39 @@ static int8_t get_low_g_config(struct bmi2_low_g_config *config, struct bmi2_dev
     /* Variable to define the array offset */
     uint8_t idx = 0;
 
-    /* Variable to define LSB */
-    uint16_t lsb = 0;
-
-    /* Variable to define MSB */
-    uint16_t msb = 0;
-
-    /* Variable to define a word */
-    uint16_t lsb_msb = 0;
-
     /* Variable to set flag */
     uint8_t feat_found;
 
-    /* Initialize feature configuration for low-g */
-    struct bmi2_feature_config low_g_config = { 0, 0, 0 };
+    /* Initialize feature configuration for self-offset correction */
+    struct bmi2_feature_config self_off_corr_cfg = { 0, 0, 0 };
 
-    /* Search for low-g feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&low_g_config, BMI2_LOW_G, dev);
+    /* Search for self-offset correction and extract its configuration details */
+    feat_found = bmi2_extract_input_feat_config(&self_off_corr_cfg, BMI2_GYRO_SELF_OFF, dev);
     if (feat_found)
     {
-        /* Get the configuration from the page where low-g feature resides */
-        rslt = bmi2_get_feat_config(low_g_config.page, feat_config, dev);
+        /* Get the configuration from the page where self-offset
+         * correction feature resides
+         */
+        rslt = bmi2_get_feat_config(self_off_corr_cfg.page, feat_config, dev);
         if (rslt == BMI2_OK)
         {
-            /* Define the offset in bytes for low-g select */
-            idx = low_g_config.start_addr;
-
-            /* Get word to calculate threshold */
-            lsb = (uint16_t) feat_config[idx++];
-            msb = ((uint16_t) feat_config[idx++] << 8);
-            lsb_msb = lsb | msb;
-
-            /* Get threshold */
-            config->threshold = lsb_msb & BMI2_LOW_G_THRES_MASK;
-
-            /* Get word to calculate hysteresis */
-            lsb = (uint16_t) feat_config[idx++];
-            msb = ((uint16_t) feat_config[idx++] << 8);
-            lsb_msb = lsb | msb;
+            /* Define the offset for enable/disable of self-offset correction */
+            idx = self_off_corr_cfg.start_addr;
 
-            /* Get hysteresis */
-            config->hysteresis = lsb_msb & BMI2_LOW_G_HYST_MASK;
+            /* Set the feature enable bit */
+            feat_config[idx] = BMI2_SET_BITS(feat_config[idx], BMI2_GYR_SELF_OFF_CORR_FEAT_EN, enable);
 
-            /* Get word to calculate duration and output configuration */
-            lsb = (uint16_t) feat_config[idx++];
-            msb = ((uint16_t) feat_config[idx++] << 8);
-            lsb_msb = lsb | msb;
+            /* Set the configuration back to the page */
+            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
 
-            /* Get duration */
-            config->duration = lsb_msb & BMI2_LOW_G_DUR_MASK;
+            if ((rslt == BMI2_OK) && (enable == BMI2_ENABLE))
+            {
+                dev->sens_en_stat |= BMI2_GYRO_SELF_OFF_SEL;
+            }
+            else
+            {
+                dev->sens_en_stat &= ~BMI2_GYRO_SELF_OFF_SEL;
+            }
         }
     }
     else
@@ -4965,10 +3622,10 @@ static int8_t get_low_g_config(struct bmi2_low_g_config *config, struct bmi2_dev
 }
 
 /*!
- * @brief This internal API gets flat configurations like theta, blocking,
- * hold-time, hysteresis, and output configuration.
+ * @brief This internal API is used to enable/disable gyroscope user gain
+ * feature.
  */
-static int8_t get_flat_config(struct bmi2_flat_config *config, struct bmi2_dev *dev)
+static int8_t set_gyro_user_gain(uint8_t enable, struct bmi2_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
@@ -4979,53 +3636,37 @@ static int8_t get_flat_config(struct bmi2_flat_config *config, struct bmi2_dev *
     /* Variable to define the array offset */
     uint8_t idx = 0;
 
-    /* Variable to define LSB */
-    uint16_t lsb = 0;
-
-    /* Variable to define MSB */
-    uint16_t msb = 0;
-
-    /* Variable to define a word */
-    uint16_t lsb_msb = 0;
-
     /* Variable to set flag */
     uint8_t feat_found;
 
-    /* Initialize feature configuration for flat */
-    struct bmi2_feature_config flat_config = { 0, 0, 0 };
+    /* Initialize feature configuration for gyroscope user gain */
+    struct bmi2_feature_config gyr_user_gain_cfg = { 0, 0, 0 };
 
-    /* Search for flat feature and extract its configuration details */
-    feat_found = bmi2_extract_input_feat_config(&flat_config, BMI2_FLAT, dev);
+    /* Search for user gain feature and extract its configuration details */
+    feat_found = bmi2_extract_input_feat_config(&gyr_user_gain_cfg, BMI2_GYRO_GAIN_UPDATE, dev);
     if (feat_found)
     {
-        /* Get the configuration from the page where flat feature resides */
-        rslt = bmi2_get_feat_config(flat_config.page, feat_config, dev);
+        /* Get the configuration from the page where user gain feature resides */
+        rslt = bmi2_get_feat_config(gyr_user_gain_cfg.page, feat_config, dev);
         if (rslt == BMI2_OK)
         {
-            /* Define the offset in bytes for flat select */
-            idx = flat_config.start_addr;
-
-            /* Get word to calculate theta, blocking mode and output configuration */
-            lsb = (uint16_t) feat_config[idx++];
-            msb = ((uint16_t) feat_config[idx++] << 8);
-            lsb_msb = lsb | msb;
-
-            /* Get theta */
-            config->theta = (lsb_msb & BMI2_FLAT_THETA_MASK) >> BMI2_FLAT_THETA_POS;
-
-            /* Get blocking mode */
-            config->blocking = (lsb_msb & BMI2_FLAT_BLOCK_MASK) >> BMI2_FLAT_BLOCK_POS;
+            /* Define the offset for enable/disable of user gain */
+            idx = gyr_user_gain_cfg.start_addr + BMI2_GYR_USER_GAIN_FEAT_EN_OFFSET;
 
-            /* Get word to calculate hysteresis and hold-time */
-            lsb = (uint16_t) feat_config[idx++];
-            msb = ((uint16_t) feat_config[idx++] << 8);
-            lsb_msb = lsb | msb;
+            /* Set the feature enable bit */
+            feat_config[idx] = BMI2_SET_BITS(feat_config[idx], BMI2_GYR_USER_GAIN_FEAT_EN, enable);
 
-            /* Get hysteresis */
-            config->hysteresis = lsb_msb & BMI2_FLAT_HYST_MASK;
+            /* Set the configuration back to the page */
+            rslt = bmi2_set_regs(BMI2_FEATURES_REG_ADDR, feat_config, BMI2_FEAT_SIZE_IN_BYTES, dev);
 
-            /* Get hold-time */
-            config->hold_time = (lsb_msb & BMI2_FLAT_HOLD_TIME_MASK) >> BMI2_FLAT_HOLD_TIME_POS;
+            if ((rslt == BMI2_OK) && (enable == BMI2_ENABLE))
+            {
+                dev->sens_en_stat |= BMI2_GYRO_GAIN_UPDATE_SEL;
+            }
+            else
+            {
+                dev->sens_en_stat &= ~BMI2_GYRO_GAIN_UPDATE_SEL;
+            }
         }
     }
     else
@@ -5036,6 +3677,33 @@ static int8_t get_flat_config(struct bmi2_flat_config *config, struct bmi2_dev *
     return rslt;
 }
 
+/* @brief This internal API sets tap configurations like sensitivity,
+ * single, double and triple tap enable and output-configuration.
+ */
+static int8_t set_tap_detector_config(struct bmi2_tap_config *config, struct bmi2_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = dev->set_tap_config(config, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API gets tap configurations like sensitivity,
+ * single, double and triple tap enable and output-configuration.
+ */
+static int8_t get_tap_detector_config(struct bmi2_tap_config *config, struct bmi2_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = dev->get_tap_config(config, dev);
+
+    return rslt;
+}
+
 /*!
  * @brief This internal API gets the output values of high-g.
  */
@@ -5449,55 +4117,14 @@ static int8_t set_feat_config(struct bmi2_sens_config *sens_cfg, uint8_t loop, s
     /* Variable to define error */
     int8_t rslt;
 
+    /* Features described by bmi270_legacy_feat_enc are set by bmi2_set_feat_config_batch */
     switch (sens_cfg[loop].type)
     {
-        /* Set any-motion configuration */
-        case BMI2_ANY_MOTION:
-            rslt = set_any_motion_config(&sens_cfg[loop].cfg.any_motion, dev);
-            break;
-
-        /* Set no-motion configuration */
-        case BMI2_NO_MOTION:
-            rslt = set_no_motion_config(&sens_cfg[loop].cfg.no_motion, dev);
-            break;
-
-        /* Set sig-motion configuration */
-        case BMI2_SIG_MOTION:
-            rslt = set_sig_motion_config(&sens_cfg[loop].cfg.sig_motion, dev);
-            break;
-
-        /* Set step counter/detector/activity configuration */
-        case BMI2_STEP_DETECTOR:
-        case BMI2_STEP_COUNTER:
-        case BMI2_STEP_ACTIVITY:
-            rslt = set_step_config(&sens_cfg[loop].cfg.step_counter, dev);
-            break;
-
         /* Set tap configuration */
         case BMI2_TAP:
             rslt = set_tap_detector_config(&sens_cfg[loop].cfg.tap_conf, dev);
             break;
 
-        /* Set orientation configuration */
-        case BMI2_ORIENTATION:
-            rslt = set_orient_config(&sens_cfg[loop].cfg.orientation, dev);
-            break;
-
-        /* Set high-g configuration */
-        case BMI2_HIGH_G:
-            rslt = set_high_g_config(&sens_cfg[loop].cfg.high_g, dev);
-            break;
-
-        /* Set low-g configuration */
-        case BMI2_LOW_G:
-            rslt = set_low_g_config(&sens_cfg[loop].cfg.low_g, dev);
-            break;
-
-        /* Set flat configuration */
-        case BMI2_FLAT:
-            rslt = set_flat_config(&sens_cfg[loop].cfg.flat, dev);
-            break;
-
         default:
             rslt = BMI2_E_INVALID_SENSOR;
             break;
@@ -5514,55 +4141,14 @@ static int8_t get_feat_config(struct bmi2_sens_config *sens_cfg, uint8_t loop, s
     /* Variable to define error */
     int8_t rslt;
 
+    /* Features described by bmi270_legacy_feat_enc are read by bmi2_get_feat_config_batch */
     switch (sens_cfg[loop].type)
     {
-        /* Get sig-motion configuration */
-        case BMI2_SIG_MOTION:
-            rslt = get_sig_motion_config(&sens_cfg[loop].cfg.sig_motion, dev);
-            break;
-
-        /* Get any motion configuration */
-        case BMI2_ANY_MOTION:
-            rslt = get_any_motion_config(&sens_cfg[loop].cfg.any_motion, dev);
-            break;
-
-        /* Get no motion configuration */
-        case BMI2_NO_MOTION:
-            rslt = get_no_motion_config(&sens_cfg[loop].cfg.no_motion, dev);
-            break;
-
-        /* Get step counter/detector/activity configuration */
-        case BMI2_STEP_DETECTOR:
-        case BMI2_STEP_COUNTER:
-        case BMI2_STEP_ACTIVITY:
-            rslt = get_step_config(&sens_cfg[loop].cfg.step_counter, dev);
-            break;
-
         /* Get tap configuration */
         case BMI2_TAP:
             rslt = get_tap_detector_config(&sens_cfg[loop].cfg.tap_conf, dev);
             break;
 
-        /* Get orientation configuration */
-        case BMI2_ORIENTATION:
-            rslt = get_orient_config(&sens_cfg[loop].cfg.orientation, dev);
-            break;
-
-        /* Get high-g configuration */
-        case BMI2_HIGH_G:
-            rslt = get_high_g_config(&sens_cfg[loop].cfg.high_g, dev);
-            break;
-
-        /* Get low-g configuration */
-        case BMI2_LOW_G:
-            rslt = get_low_g_config(&sens_cfg[loop].cfg.low_g, dev);
-            break;
-
-        /* Get flat configuration */
-        case BMI2_FLAT:
-            rslt = get_flat_config(&sens_cfg[loop].cfg.flat, dev);
-            break;
-
         default:
             rslt = BMI2_E_INVALID_SENSOR;
             break;
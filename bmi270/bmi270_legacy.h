@@ -103,6 +103,16 @@ extern "C" {
 /*! @name Defines maximum number of feature outputs */
 #define BMI270_LEGACY_MAX_FEAT_OUT                    UINT8_C(8)
 
+/*! @name Defines maximum number of feature configuration encoders */
+#define BMI270_LEGACY_MAX_FEAT_ENC                    UINT8_C(10)
+
+/*! @name Defines number of fields of the feature configurations */
+#define BMI270_LEGACY_STEP_N_FIELDS                   UINT8_C(3)
+#define BMI270_LEGACY_ORIENT_N_FIELDS                 UINT8_C(5)
+#define BMI270_LEGACY_HIGH_G_N_FIELDS                 UINT8_C(6)
+#define BMI270_LEGACY_LOW_G_N_FIELDS                  UINT8_C(3)
+#define BMI270_LEGACY_FLAT_N_FIELDS                   UINT8_C(4)
+
 /*! @name Mask definitions for feature interrupt status bits */
 #define BMI270_LEGACY_SIG_MOT_STATUS_MASK             UINT8_C(0x01)
 #define BMI270_LEGACY_STEP_CNT_STATUS_MASK            UINT8_C(0x02)
@@ -177,6 +187,30 @@ extern "C" {
  */
 int8_t bmi270_legacy_init(struct bmi2_dev *dev);
 
+/*!
+ * \ingroup bmi270_legacyApiInit
+ * \page bmi270_legacy_api_bmi270_legacy_load_variant bmi270_legacy_load_variant
+ * \code
+ * int8_t bmi270_legacy_load_variant(struct bmi2_dev *dev);
+ * \endcode
+ * @details This API switches a sensor initialized with another BMI270 variant
+ * to BMI270_LEGACY without the soft-reset of bmi270_legacy_init:
+ *  1) updates the device structure with address of the configuration file.
+ *  2) Writes the configuration file.
+ *  3) Updates the feature offset parameters in the device structure.
+ *
+ * @note Register settings are kept across the switch, the features of the
+ * previous variant are not. A configuration file assigned by the user is
+ * replaced.
+ *
+ * @param[in, out] dev      : Structure instance of bmi2_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi270_legacy_load_variant(struct bmi2_dev *dev);
+
 /**
  * \ingroup bmi270_legacy
  * \defgroup bmi270_legacyApiSensor Feature Set
@@ -96,6 +96,49 @@ const struct bmi2_feature_config bmi270_maximum_fifo_feat_out[BMI270_MAXIMUM_FIF
  */
 static int8_t null_ptr_check(const struct bmi2_dev *dev);
 
+/*!
+ * @brief This internal API assigns the feature configuration of BMI270_MAXIMUM_FIFO to the
+ * device structure.
+ *
+ * @param[in, out] dev : Structure instance of bmi2_dev.
+ *
+ * @return None
+ */
+static void assign_variant_tables(struct bmi2_dev *dev);
+
+/*!
+ * @brief This internal API starts the burst read of a chunk of FIFO data.
+ *
+ * @param[out] data : Chunk buffer, with room for the dummy byte.
+ * @param[in]  len  : Number of FIFO bytes to be read.
+ * @param[in]  dev  : Structure instance of bmi2_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t read_chunk(uint8_t *data, uint16_t len, struct bmi2_dev *dev);
+
+/*!
+ * @brief This internal API parses a chunk of FIFO data, hands the frames to
+ * the sink and updates the counters of the stream.
+ *
+ * @param[in]      data   : Chunk buffer, starting with the dummy byte.
+ * @param[in]      len    : Number of FIFO bytes in the chunk.
+ * @param[out]     stall  : Back-pressure reported by the sink.
+ * @param[in, out] stream : Structure instance of bmi270_fifo_stream.
+ * @param[in]      dev    : Structure instance of bmi2_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t parse_chunk(uint8_t *data,
+                          uint16_t len,
+                          uint8_t *stall,
+                          struct bmi270_fifo_stream *stream,
+                          const struct bmi2_dev *dev);
+
 /***************************************************************************/
 
 /*!         User Interface Definitions
@@ -137,6 +180,9 @@ int8_t bmi270_maximum_fifo_init(struct bmi2_dev *dev)
             dev->dummy_byte = 0;
         }
 
+        /* A configuration file given by the caller is uploaded as it is */
+        dev->config_blob = NULL;
+
         /* If configuration file pointer is not assigned any address */
         if (!dev->config_file_ptr)
         {
@@ -151,30 +197,46 @@ int8_t bmi270_maximum_fifo_init(struct bmi2_dev *dev)
 
         if (rslt == BMI2_OK)
         {
-            /* Assign the offsets of the feature input
-             * configuration to the device structure
-             */
-            dev->feat_config = bmi270_maximum_fifo_feat_in;
+            /* Assign the feature configuration of the variant to the device structure */
+            assign_variant_tables(dev);
 
-            /* Assign the offsets of the feature output to
-             * the device structure
-             */
-            dev->feat_output = bmi270_maximum_fifo_feat_out;
+            /* Get the gyroscope cross axis sensitivity */
+            rslt = bmi2_get_gyro_cross_sense(dev);
+        }
+    }
 
-            /* Assign the maximum number of pages to the
-             * device structure
-             */
-            dev->page_max = BMI270_MAXIMUM_FIFO_MAX_PAGE_NUM;
+    return rslt;
+}
 
-            /* Assign maximum number of input sensors/
-             * features to device structure
-             */
-            dev->input_sens = BMI270_MAXIMUM_FIFO_MAX_FEAT_IN;
+/*!
+ * @brief This API loads the configuration file of BMI270_MAXIMUM_FIFO into a sensor
+ * initialized with another BMI270 variant, without a soft-reset.
+ */
+int8_t bmi270_maximum_fifo_load_variant(struct bmi2_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
 
-            /* Assign maximum number of output sensors/
-             * features to device structure
-             */
-            dev->out_sens = BMI270_MAXIMUM_FIFO_MAX_FEAT_OUT;
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+    if (rslt == BMI2_OK)
+    {
+        /* Get the size of config array */
+        dev->config_size = sizeof(bmi270_maximum_fifo_config_file);
+
+        /* Enable the variant specific features if any */
+        dev->variant_feature = BMI2_GYRO_CROSS_SENS_ENABLE | BMI2_MAXIMUM_FIFO_VARIANT;
+
+        /* Replace the configuration file of the previous variant */
+        dev->config_file_ptr = bmi270_maximum_fifo_config_file;
+        dev->config_blob = NULL;
+
+        /* Write the configuration file */
+        rslt = bmi2_write_config_file(dev);
+        if (rslt == BMI2_OK)
+        {
+            /* Assign the feature configuration of the variant to the device structure */
+            assign_variant_tables(dev);
 
             /* Get the gyroscope cross axis sensitivity */
             rslt = bmi2_get_gyro_cross_sense(dev);
@@ -184,6 +246,204 @@ int8_t bmi270_maximum_fifo_init(struct bmi2_dev *dev)
     return rslt;
 }
 
+/*!
+ * @brief This API validates the buffers of the stream, reads the FIFO
+ * configuration once and clears the counters.
+ */
+int8_t bmi270_maximum_fifo_stream_init(struct bmi270_fifo_stream *stream, struct bmi2_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Array to store FIFO configuration data */
+    uint8_t config_data[BMI2_FIFO_CONFIG_LENGTH] = { 0 };
+
+    /* Variable to define the length of a data frame */
+    uint16_t frame_len = 0;
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+    if ((rslt == BMI2_OK) && (stream != NULL) && (stream->chunk[0] != NULL) && (stream->chunk[1] != NULL) &&
+        (stream->acc != NULL) && (stream->gyr != NULL) && (stream->sink != NULL))
+    {
+        /* Get the FIFO frame configuration, kept for every drain */
+        rslt = bmi2_get_regs(BMI2_FIFO_CONFIG_0_ADDR, config_data, BMI2_FIFO_CONFIG_LENGTH, dev);
+        if (rslt == BMI2_OK)
+        {
+            stream->header_enable = (uint8_t)((config_data[1]) & (BMI2_FIFO_HEADER_EN >> 8));
+            stream->data_enable =
+                (uint16_t)(((config_data[0]) | ((uint16_t) config_data[1] << 8)) & BMI2_FIFO_ALL_EN);
+
+            if (stream->header_enable != 0)
+            {
+                frame_len++;
+            }
+
+            if (stream->data_enable & BMI2_FIFO_ACC_EN)
+            {
+                frame_len += BMI2_FIFO_ACC_LENGTH;
+            }
+
+            if (stream->data_enable & BMI2_FIFO_GYR_EN)
+            {
+                frame_len += BMI2_FIFO_GYR_LENGTH;
+            }
+
+            if (stream->data_enable & BMI2_FIFO_AUX_EN)
+            {
+                frame_len += BMI2_FIFO_AUX_LENGTH;
+            }
+
+            if ((stream->data_enable == 0) || (stream->chunk_len < frame_len) || (stream->acc_len == 0) ||
+                (stream->gyr_len == 0))
+            {
+                rslt = BMI2_E_INVALID_INPUT;
+            }
+        }
+
+        if (rslt == BMI2_OK)
+        {
+            /* End each burst on a frame boundary in steady state */
+            stream->chunk_len = (uint16_t)(stream->chunk_len - (stream->chunk_len % frame_len));
+
+            stream->n_drains = 0;
+            stream->n_stalls = 0;
+            stream->n_bytes = 0;
+            stream->n_acc_frames = 0;
+            stream->n_gyr_frames = 0;
+            stream->n_overflows = 0;
+            stream->n_skipped_frames = 0;
+            stream->max_fill = 0;
+            stream->start_us = 0;
+            stream->bytes_per_sec = 0;
+        }
+    }
+    else if (rslt == BMI2_OK)
+    {
+        rslt = BMI2_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API drains the FIFO on the watermark interrupt in pipelined
+ * chunks and hands the parsed frames to the sink.
+ */
+int8_t bmi270_maximum_fifo_stream_drain(uint32_t now_us, struct bmi270_fifo_stream *stream, struct bmi2_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Variable to store the FIFO fill level */
+    uint16_t fill = 0;
+
+    /* Number of FIFO bytes not yet requested */
+    uint16_t remaining = 0;
+
+    /* Number of FIFO bytes in the current and next chunk */
+    uint16_t len = 0;
+    uint16_t next_len;
+
+    /* Index of the chunk buffer being parsed */
+    uint8_t cur = 0;
+
+    /* Back-pressure reported by the sink */
+    uint8_t stall = 0;
+
+    /* Time elapsed since the first drain */
+    uint32_t elapsed_us;
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+    if ((rslt == BMI2_OK) && (stream != NULL) && (stream->chunk_len != 0))
+    {
+        rslt = bmi2_get_fifo_length(&fill, dev);
+        if (rslt == BMI2_OK)
+        {
+            if (stream->n_drains == 0)
+            {
+                stream->start_us = now_us;
+            }
+
+            stream->n_drains++;
+
+            if (fill > stream->max_fill)
+            {
+                stream->max_fill = fill;
+            }
+
+            if (fill >= BMI270_MAXIMUM_FIFO_FULL_LEVEL)
+            {
+                stream->n_overflows++;
+            }
+
+            /* Start the read of the first chunk */
+            remaining = fill;
+            len = (remaining < stream->chunk_len) ? remaining : stream->chunk_len;
+            if (len > 0)
+            {
+                rslt = read_chunk(stream->chunk[cur], len, dev);
+                remaining -= len;
+            }
+        }
+
+        while ((rslt == BMI2_OK) && (len > 0))
+        {
+            /* Complete the read of the current chunk */
+            if (stream->wait != NULL)
+            {
+                dev->intf_rslt = stream->wait(dev->intf_ptr);
+                if (dev->intf_rslt != BMI2_INTF_RET_SUCCESS)
+                {
+                    rslt = BMI2_E_COM_FAIL;
+                }
+            }
+
+            /* Start the read of the next chunk before parsing the current one,
+             * unless the sink asked to stop
+             */
+            next_len = 0;
+            if ((rslt == BMI2_OK) && (stall == 0))
+            {
+                next_len = (remaining < stream->chunk_len) ? remaining : stream->chunk_len;
+                if (next_len > 0)
+                {
+                    rslt = read_chunk(stream->chunk[cur ^ 1], next_len, dev);
+                    remaining -= next_len;
+                }
+            }
+
+            if (rslt == BMI2_OK)
+            {
+                stream->n_bytes += len;
+                rslt = parse_chunk(stream->chunk[cur], len, &stall, stream, dev);
+            }
+
+            cur ^= 1;
+            len = next_len;
+        }
+
+        if (stall != 0)
+        {
+            stream->n_stalls++;
+        }
+
+        /* Sustained throughput since the first drain */
+        elapsed_us = now_us - stream->start_us;
+        if (elapsed_us > 0)
+        {
+            stream->bytes_per_sec = (uint32_t)(((uint64_t)stream->n_bytes * 1000000) / elapsed_us);
+        }
+    }
+    else if (rslt == BMI2_OK)
+    {
+        rslt = BMI2_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
 /***************************************************************************/
 
 /*!         Local Function Definitions
@@ -206,3 +466,134 @@ static int8_t null_ptr_check(const struct bmi2_dev *dev)
 
     return rslt;
 }
+
+/*!
+ * @brief This internal API assigns the feature configuration of BMI270_MAXIMUM_FIFO to the
+ * device structure.
+ */
+static void assign_variant_tables(struct bmi2_dev *dev)
+{
+    /* Assign the offsets of the feature input
+     * configuration to the device structure
+     */
+    dev->feat_config = bmi270_maximum_fifo_feat_in;
+
+    /* Assign the offsets of the feature output to
+     * the device structure
+     */
+    dev->feat_output = bmi270_maximum_fifo_feat_out;
+
+    /* Assign the maximum number of pages to the
+     * device structure
+     */
+    dev->page_max = BMI270_MAXIMUM_FIFO_MAX_PAGE_NUM;
+
+    /* Assign maximum number of input sensors/
+     * features to device structure
+     */
+    dev->input_sens = BMI270_MAXIMUM_FIFO_MAX_FEAT_IN;
+
+    /* Assign maximum number of output sensors/
+     * features to device structure
+     */
+    dev->out_sens = BMI270_MAXIMUM_FIFO_MAX_FEAT_OUT;
+
+    /* The variant has no feature interrupts */
+    dev->map_int = NULL;
+    dev->sens_int_map = 0;
+}
+
+/*!
+ * @brief This internal API starts the burst read of a chunk of FIFO data.
+ */
+static int8_t read_chunk(uint8_t *data, uint16_t len, struct bmi2_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt = BMI2_OK;
+
+    /* Variable to define FIFO address */
+    uint8_t addr = BMI2_FIFO_DATA_ADDR;
+
+    /* Configuring reg_addr for SPI Interface */
+    if (dev->intf == BMI2_SPI_INTF)
+    {
+        addr = (addr | BMI2_SPI_RD_MASK);
+    }
+
+    /* Read FIFO data, the dummy byte leads the chunk */
+    dev->intf_rslt = dev->read(addr, data, (uint32_t)len + dev->dummy_byte, dev->intf_ptr);
+
+    /* Provide delay based on advanced power saving mode status */
+    if (dev->aps_status == BMI2_ENABLE)
+    {
+        dev->delay_us(450, dev->intf_ptr);
+    }
+    else
+    {
+        dev->delay_us(2, dev->intf_ptr);
+    }
+
+    /* If interface read fails, update rslt variable with communication failure */
+    if (dev->intf_rslt != BMI2_INTF_RET_SUCCESS)
+    {
+        rslt = BMI2_E_COM_FAIL;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API parses a chunk of FIFO data, hands the frames to
+ * the sink and updates the counters of the stream.
+ */
+static int8_t parse_chunk(uint8_t *data,
+                          uint16_t len,
+                          uint8_t *stall,
+                          struct bmi270_fifo_stream *stream,
+                          const struct bmi2_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Number of frames parsed */
+    uint16_t acc_len;
+    uint16_t gyr_len;
+
+    /* FIFO frame structure describing the chunk */
+    struct bmi2_fifo_frame fifo = { 0 };
+
+    fifo.data = data;
+    fifo.length = (uint16_t)(len + dev->dummy_byte);
+    fifo.header_enable = stream->header_enable;
+    fifo.data_enable = stream->data_enable;
+
+    do
+    {
+        acc_len = stream->acc_len;
+        gyr_len = stream->gyr_len;
+        fifo.skipped_frame_count = 0;
+
+        rslt = bmi2_extract_accel_gyro(stream->acc, &acc_len, stream->gyr, &gyr_len, &fifo, dev);
+        if (rslt >= BMI2_OK)
+        {
+            stream->n_acc_frames += acc_len;
+            stream->n_gyr_frames += gyr_len;
+            stream->n_skipped_frames += fifo.skipped_frame_count;
+
+            if (((acc_len > 0) || (gyr_len > 0)) &&
+                (stream->sink(stream->acc, acc_len, stream->gyr, gyr_len, stream->sink_ptr) != 0))
+            {
+                (*stall) = 1;
+            }
+        }
+
+        /* Parse the rest of the chunk once the sink has the frame buffers back */
+    } while (rslt == BMI2_W_PARTIAL_READ);
+
+    if (rslt > BMI2_OK)
+    {
+        rslt = BMI2_OK;
+    }
+
+    return rslt;
+}
@@ -75,6 +75,114 @@ extern "C" {
 
 /*! @name Mask definitions for feature interrupt status bits */
 
+/*! @name FIFO size in bytes, the feature engine of the variant uses none of it */
+#define BMI270_MAXIMUM_FIFO_SIZE          UINT16_C(6144)
+
+/*! @name Number of FIFO bytes read per burst while streaming */
+#ifndef BMI270_MAXIMUM_FIFO_CHUNK_SIZE
+#define BMI270_MAXIMUM_FIFO_CHUNK_SIZE    UINT16_C(1024)
+#endif
+
+/*! @name FIFO fill level from which a drain counts an overflow, no
+ * further frame fits in the FIFO
+ */
+#define BMI270_MAXIMUM_FIFO_FULL_LEVEL    (BMI270_MAXIMUM_FIFO_SIZE - BMI2_FIFO_ALL_LENGTH - 1)
+
+/******************************************************************************/
+/*! @name           Function Pointers                             */
+/******************************************************************************/
+
+/*!
+ * @brief Sink function pointer which receives the frames parsed from a chunk
+ * of FIFO data.
+ *
+ * @param[in] acc      : Parsed accelerometer frames.
+ * @param[in] acc_len  : Number of accelerometer frames.
+ * @param[in] gyr      : Parsed gyroscope frames.
+ * @param[in] gyr_len  : Number of gyroscope frames.
+ * @param[in] sink_ptr : Pointer to the user context of the sink.
+ *
+ * @return Back-pressure of the sink
+ * @retval 0 -> Continue draining
+ * @retval != 0 -> Stop draining, the remaining frames stay in the FIFO
+ */
+typedef int8_t (*bmi270_fifo_sink_fptr_t)(const struct bmi2_sens_axes_data *acc,
+                                          uint16_t acc_len,
+                                          const struct bmi2_sens_axes_data *gyr,
+                                          uint16_t gyr_len,
+                                          void *sink_ptr);
+
+/*!
+ * @brief Wait function pointer for a bus read function which only starts the
+ * transfer (e.g. DMA). It blocks until the last started read completes.
+ *
+ * @param[in] intf_ptr : Interface pointer of the device.
+ *
+ * @return Status of the completed read
+ * @retval BMI2_INTF_RET_SUCCESS -> Success
+ * @retval != BMI2_INTF_RET_SUCCESS -> Failure
+ */
+typedef BMI2_INTF_RETURN_TYPE (*bmi270_fifo_wait_fptr_t)(void *intf_ptr);
+
+/******************************************************************************/
+/*!  @name         Structure Declarations                             */
+/******************************************************************************/
+
+/*!  @name Structure to define the FIFO streaming drain and its counters */
+struct bmi270_fifo_stream
+{
+    /*! Two chunk buffers of chunk_len bytes plus the dummy byte, one is read
+     * while the other is parsed
+     */
+    uint8_t *chunk[2];
+
+    /*! Number of FIFO bytes read per burst */
+    uint16_t chunk_len;
+
+    /*! Buffers of the parsed frames handed to the sink */
+    struct bmi2_sens_axes_data *acc;
+    struct bmi2_sens_axes_data *gyr;
+
+    /*! Number of frames the accel and gyro buffers can hold */
+    uint16_t acc_len;
+    uint16_t gyr_len;
+
+    /*! Sink of the parsed frames */
+    bmi270_fifo_sink_fptr_t sink;
+
+    /*! User context of the sink */
+    void *sink_ptr;
+
+    /*! Completes an asynchronous bus read, NULL if the read blocks */
+    bmi270_fifo_wait_fptr_t wait;
+
+    /*! FIFO header mode and enabled data, read once at init */
+    uint8_t header_enable;
+    uint16_t data_enable;
+
+    /*! Number of drains, and of drains stopped by the sink */
+    uint32_t n_drains;
+    uint32_t n_stalls;
+
+    /*! Number of bytes read and of frames parsed */
+    uint32_t n_bytes;
+    uint32_t n_acc_frames;
+    uint32_t n_gyr_frames;
+
+    /*! Number of drains which found the FIFO full */
+    uint32_t n_overflows;
+
+    /*! Number of frames dropped by the sensor, from skip frames */
+    uint32_t n_skipped_frames;
+
+    /*! Highest FIFO fill level seen by a drain */
+    uint16_t max_fill;
+
+    /*! Time of the first drain and sustained throughput since then */
+    uint32_t start_us;
+    uint32_t bytes_per_sec;
+};
+
 /***************************************************************************/
 
 /*!     BMI270 User Interface function prototypes
@@ -107,6 +215,86 @@ extern "C" {
  */
 int8_t bmi270_maximum_fifo_init(struct bmi2_dev *dev);
 
+/*!
+ * \ingroup bmi270_maximum_fifoApiInit
+ * \page bmi270_maximum_fifo_api_bmi270_maximum_fifo_load_variant bmi270_maximum_fifo_load_variant
+ * \code
+ * int8_t bmi270_maximum_fifo_load_variant(struct bmi2_dev *dev);
+ * \endcode
+ * @details This API switches a sensor initialized with another BMI270 variant
+ * to BMI270_MAXIMUM_FIFO without the soft-reset of bmi270_maximum_fifo_init:
+ *  1) updates the device structure with address of the configuration file.
+ *  2) Writes the configuration file.
+ *  3) Updates the feature offset parameters in the device structure.
+ *
+ * @note Register settings are kept across the switch, the features of the
+ * previous variant are not. A configuration file assigned by the user is
+ * replaced.
+ *
+ * @param[in, out] dev      : Structure instance of bmi2_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi270_maximum_fifo_load_variant(struct bmi2_dev *dev);
+
+/**
+ * \ingroup bmi270_maximum_fifo
+ * \defgroup bmi270_maximum_fifoApiStream FIFO streaming
+ * @brief Drain the full FIFO in pipelined chunks
+ */
+
+/*!
+ * \ingroup bmi270_maximum_fifoApiStream
+ * \page bmi270_maximum_fifo_api_bmi270_maximum_fifo_stream_init bmi270_maximum_fifo_stream_init
+ * \code
+ * int8_t bmi270_maximum_fifo_stream_init(struct bmi270_fifo_stream *stream, struct bmi2_dev *dev);
+ * \endcode
+ * @details This API validates the buffers of the stream, reads the FIFO
+ * configuration once and clears the counters. It is called after the FIFO is
+ * configured, and again whenever the FIFO configuration changes.
+ *
+ * @note chunk_len is rounded down to a multiple of the data frame length, so
+ * that a burst in steady state does not end within a frame.
+ *
+ * @param[in, out] stream   : Structure instance of bmi270_fifo_stream.
+ * @param[in]      dev      : Structure instance of bmi2_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi270_maximum_fifo_stream_init(struct bmi270_fifo_stream *stream, struct bmi2_dev *dev);
+
+/*!
+ * \ingroup bmi270_maximum_fifoApiStream
+ * \page bmi270_maximum_fifo_api_bmi270_maximum_fifo_stream_drain bmi270_maximum_fifo_stream_drain
+ * \code
+ * int8_t bmi270_maximum_fifo_stream_drain(uint32_t now_us, struct bmi270_fifo_stream *stream, struct bmi2_dev *dev);
+ * \endcode
+ * @details This API is called on the FIFO watermark interrupt. It reads the
+ * FIFO fill level once and drains it in bursts of chunk_len bytes. The read of
+ * the next chunk is started before the previous chunk is parsed and handed to
+ * the sink, so with an asynchronous read and the wait function the bus and
+ * the parser overlap.
+ *
+ * @note A frame cut at the end of the last burst is sent again by the sensor
+ * and is parsed on the next drain. A sink which reports back-pressure stops
+ * the drain after the chunk in flight, the frames left in the FIFO keep the
+ * watermark interrupt asserted.
+ *
+ * @param[in]      now_us   : Time of the drain in microseconds, used for the
+ *                            throughput. It may wrap around.
+ * @param[in, out] stream   : Structure instance of bmi270_fifo_stream.
+ * @param[in]      dev      : Structure instance of bmi2_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi270_maximum_fifo_stream_drain(uint32_t now_us, struct bmi270_fifo_stream *stream, struct bmi2_dev *dev);
+
 /******************************************************************************/
 /*! @name       C++ Guard Macros                                      */
 /******************************************************************************/
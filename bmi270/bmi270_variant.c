@@ -0,0 +1,360 @@
+/**
+* SPDX-License-Identifier: BSD-3-Clause
+*
+* @file       bmi270_variant.c
+* @date       2026-10-18
+*
+*/
+
+/***************************************************************************/
+
+/*!             Header files
+ ****************************************************************************/
+#include "bmi270_variant.h"
+
+/***************************************************************************/
+
+/*!              Global Variable
+ ****************************************************************************/
+
+/*! @name  Init APIs of the variants, indexed by variant */
+static const bmi270_variant_load_fptr_t variant_init[BMI270_VARIANT_MAX] = {
+    bmi270_init, bmi270_legacy_init, bmi270_context_init, bmi270_maximum_fifo_init
+};
+
+/*! @name  Configuration file load APIs of the variants, indexed by variant */
+static const bmi270_variant_load_fptr_t variant_load[BMI270_VARIANT_MAX] = {
+    bmi270_load_variant, bmi270_legacy_load_variant, bmi270_context_load_variant, bmi270_maximum_fifo_load_variant
+};
+
+/******************************************************************************/
+
+/*!         Local Function Prototypes
+ ******************************************************************************/
+
+/*!
+ * @brief This internal API is used to validate the manager and device
+ * structure pointers for null conditions.
+ *
+ * @param[in] mgr : Structure instance of bmi270_variant_mgr.
+ * @param[in] dev : Structure instance of bmi2_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t null_ptr_check(const struct bmi270_variant_mgr *mgr, const struct bmi2_dev *dev);
+
+/*!
+ * @brief This internal API loads the configuration file of a variant with the
+ * upload burst length of the manager, falling back to the init API of the
+ * variant if the load fails.
+ *
+ * @param[in] variant       : Variant to load.
+ * @param[in, out] mgr      : Structure instance of bmi270_variant_mgr.
+ * @param[in, out] dev      : Structure instance of bmi2_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t load_variant(uint8_t variant, struct bmi270_variant_mgr *mgr, struct bmi2_dev *dev);
+
+/*!
+ * @brief This internal API reads the time of the manager, 0 when the latency
+ * is not measured.
+ *
+ * @param[in] mgr : Structure instance of bmi270_variant_mgr.
+ *
+ * @return Time in microseconds
+ */
+static uint32_t get_time_us(const struct bmi270_variant_mgr *mgr);
+
+/***************************************************************************/
+
+/*!         User Interface Definitions
+ ****************************************************************************/
+
+/*!
+ * @brief This API initializes the sensor with the init API of the given
+ * variant and clears the switch statistics.
+ */
+int8_t bmi270_variant_init(uint8_t variant, struct bmi270_variant_mgr *mgr, struct bmi2_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(mgr, dev);
+    if ((rslt == BMI2_OK) && (variant >= BMI270_VARIANT_MAX))
+    {
+        rslt = BMI2_E_INVALID_INPUT;
+    }
+
+    if (rslt == BMI2_OK)
+    {
+        mgr->n_switches = 0;
+        mgr->n_resets = 0;
+        mgr->switch_us = 0;
+        mgr->max_switch_us = 0;
+        mgr->save_us = 0;
+        mgr->load_us = 0;
+        mgr->restore_us = 0;
+
+        rslt = variant_init[variant](dev);
+        if (rslt == BMI2_OK)
+        {
+            mgr->variant = variant;
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API switches the sensor to another variant, keeping the sensor,
+ * FIFO and interrupt configuration.
+ */
+int8_t bmi270_variant_switch(uint8_t variant, struct bmi270_variant_mgr *mgr, struct bmi2_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Variable to disable the sensors during the load */
+    uint8_t pwr_ctrl = 0;
+
+    /* Variables to store the time of each step */
+    uint32_t start_us;
+    uint32_t saved_us;
+    uint32_t loaded_us;
+    uint32_t end_us;
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(mgr, dev);
+    if ((rslt == BMI2_OK) && (variant >= BMI270_VARIANT_MAX))
+    {
+        rslt = BMI2_E_INVALID_INPUT;
+    }
+
+    if ((rslt == BMI2_OK) && (variant != mgr->variant))
+    {
+        start_us = get_time_us(mgr);
+
+        rslt = bmi270_variant_save_state(&mgr->state, dev);
+        saved_us = get_time_us(mgr);
+
+        if (rslt == BMI2_OK)
+        {
+            /* Stop the sensors while the feature engine is reloaded */
+            rslt = bmi2_set_regs(BMI2_PWR_CTRL_ADDR, &pwr_ctrl, 1, dev);
+        }
+
+        if (rslt == BMI2_OK)
+        {
+            rslt = load_variant(variant, mgr, dev);
+        }
+
+        loaded_us = get_time_us(mgr);
+
+        if (rslt == BMI2_OK)
+        {
+            mgr->variant = variant;
+
+            rslt = bmi270_variant_restore_state(&mgr->state, dev);
+        }
+
+        end_us = get_time_us(mgr);
+
+        if (rslt == BMI2_OK)
+        {
+            mgr->n_switches++;
+            mgr->save_us = saved_us - start_us;
+            mgr->load_us = loaded_us - saved_us;
+            mgr->restore_us = end_us - loaded_us;
+            mgr->switch_us = end_us - start_us;
+
+            if (mgr->switch_us > mgr->max_switch_us)
+            {
+                mgr->max_switch_us = mgr->switch_us;
+            }
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API saves the sensor, FIFO and interrupt configuration and the
+ * enabled main sensors.
+ */
+int8_t bmi270_variant_save_state(struct bmi270_variant_state *state, struct bmi2_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Array to store the power configuration and control registers */
+    uint8_t pwr[2] = { 0 };
+
+    if ((state == NULL) || (dev == NULL))
+    {
+        rslt = BMI2_E_NULL_PTR;
+    }
+    else
+    {
+        rslt = bmi2_get_regs(BMI270_VARIANT_SENS_CONF_ADDR, state->sens_conf, BMI270_VARIANT_SENS_CONF_LEN, dev);
+        if (rslt == BMI2_OK)
+        {
+            rslt = bmi2_get_regs(BMI270_VARIANT_INT_CONF_ADDR, state->int_conf, BMI270_VARIANT_INT_CONF_LEN, dev);
+        }
+
+        if (rslt == BMI2_OK)
+        {
+            /* Power configuration and control are consecutive registers */
+            rslt = bmi2_get_regs(BMI2_PWR_CONF_ADDR, pwr, 2, dev);
+        }
+
+        if (rslt == BMI2_OK)
+        {
+            state->pwr_conf = pwr[0];
+            state->pwr_ctrl = pwr[1];
+            state->sens_en_stat = dev->sens_en_stat & BMI2_MAIN_SENSORS;
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API restores a saved sensor, FIFO and interrupt configuration,
+ * and then the power control and configuration.
+ */
+int8_t bmi270_variant_restore_state(const struct bmi270_variant_state *state, struct bmi2_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Array to store the interrupt registers with the feature mappings cleared */
+    uint8_t int_conf[BMI270_VARIANT_INT_CONF_LEN];
+
+    /* Variable to define loop */
+    uint8_t loop;
+
+    if ((state == NULL) || (dev == NULL))
+    {
+        rslt = BMI2_E_NULL_PTR;
+    }
+    else
+    {
+        for (loop = 0; loop < BMI270_VARIANT_INT_CONF_LEN; loop++)
+        {
+            int_conf[loop] = state->int_conf[loop];
+        }
+
+        int_conf[BMI270_VARIANT_INT1_MAP_FEAT_IDX] = 0;
+        int_conf[BMI270_VARIANT_INT2_MAP_FEAT_IDX] = 0;
+
+        /* Burst writes need the advanced power save mode disabled */
+        rslt = bmi2_set_adv_power_save(BMI2_DISABLE, dev);
+        if (rslt == BMI2_OK)
+        {
+            rslt = bmi2_set_regs(BMI270_VARIANT_SENS_CONF_ADDR,
+                                 (uint8_t *)state->sens_conf,
+                                 BMI270_VARIANT_SENS_CONF_LEN,
+                                 dev);
+        }
+
+        if (rslt == BMI2_OK)
+        {
+            rslt = bmi2_set_regs(BMI270_VARIANT_INT_CONF_ADDR, int_conf, BMI270_VARIANT_INT_CONF_LEN, dev);
+        }
+
+        if (rslt == BMI2_OK)
+        {
+            rslt = bmi2_set_regs(BMI2_PWR_CTRL_ADDR, (uint8_t *)&state->pwr_ctrl, 1, dev);
+        }
+
+        if (rslt == BMI2_OK)
+        {
+            /* Also restores the advanced power save status of the device structure */
+            rslt = bmi2_set_regs(BMI2_PWR_CONF_ADDR, (uint8_t *)&state->pwr_conf, 1, dev);
+        }
+
+        if (rslt == BMI2_OK)
+        {
+            dev->sens_en_stat = state->sens_en_stat;
+        }
+    }
+
+    return rslt;
+}
+
+/***************************************************************************/
+
+/*!         Local Function Definitions
+ ****************************************************************************/
+
+/*!
+ * @brief This internal API is used to validate the manager and device
+ * structure pointers for null conditions.
+ */
+static int8_t null_ptr_check(const struct bmi270_variant_mgr *mgr, const struct bmi2_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt = BMI2_OK;
+
+    if ((mgr == NULL) || (dev == NULL) || (dev->read == NULL) || (dev->write == NULL) || (dev->delay_us == NULL))
+    {
+        /* Device structure pointer is not valid */
+        rslt = BMI2_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API loads the configuration file of a variant with the
+ * upload burst length of the manager, falling back to the init API of the
+ * variant if the load fails.
+ */
+static int8_t load_variant(uint8_t variant, struct bmi270_variant_mgr *mgr, struct bmi2_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Variable to store the user set read/write length */
+    uint16_t read_write_len = dev->read_write_len;
+
+    if (mgr->upload_len != 0)
+    {
+        dev->read_write_len = mgr->upload_len;
+    }
+
+    rslt = variant_load[variant](dev);
+    if (rslt == BMI2_E_CONFIG_LOAD)
+    {
+        /* Soft-reset and load the configuration file again */
+        rslt = variant_init[variant](dev);
+        mgr->n_resets++;
+    }
+
+    /* Restore the user set length */
+    dev->read_write_len = read_write_len;
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API reads the time of the manager, 0 when the latency
+ * is not measured.
+ */
+static uint32_t get_time_us(const struct bmi270_variant_mgr *mgr)
+{
+    uint32_t time_us = 0;
+
+    if (mgr->get_time_us != NULL)
+    {
+        time_us = mgr->get_time_us();
+    }
+
+    return time_us;
+}
@@ -0,0 +1,257 @@
+/**
+* SPDX-License-Identifier: BSD-3-Clause
+*
+* @file       bmi270_variant.h
+* @date       2026-10-18
+*
+*/
+
+/**
+ * \ingroup bmi2xy
+ * \defgroup bmi270_variant BMI270_VARIANT
+ * @brief Runtime switching between the BMI270 variants
+ */
+
+#ifndef BMI270_VARIANT_H_
+#define BMI270_VARIANT_H_
+
+/*! CPP guard */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************/
+
+/*!             Header files
+ ****************************************************************************/
+#include "bmi270.h"
+#include "bmi270_legacy.h"
+#include "bmi270_context.h"
+#include "bmi270_maximum_fifo.h"
+
+/***************************************************************************/
+
+/*!               Macro definitions
+ ****************************************************************************/
+
+/*! @name BMI270 variants */
+#define BMI270_VARIANT_BASE                   UINT8_C(0)
+#define BMI270_VARIANT_LEGACY                 UINT8_C(1)
+#define BMI270_VARIANT_CONTEXT                UINT8_C(2)
+#define BMI270_VARIANT_MAXIMUM_FIFO           UINT8_C(3)
+#define BMI270_VARIANT_MAX                    UINT8_C(4)
+
+/*! @name Sensor and FIFO configuration registers kept across a switch,
+ * ACC_CONF to FIFO_CONFIG_1
+ */
+#define BMI270_VARIANT_SENS_CONF_ADDR         BMI2_ACC_CONF_ADDR
+#define BMI270_VARIANT_SENS_CONF_LEN          UINT8_C(10)
+
+/*! @name Interrupt pin and mapping registers kept across a switch,
+ * INT1_IO_CTRL to INT_MAP_DATA
+ */
+#define BMI270_VARIANT_INT_CONF_ADDR          BMI2_INT1_IO_CTRL_ADDR
+#define BMI270_VARIANT_INT_CONF_LEN           UINT8_C(6)
+
+/*! @name Index of the feature interrupt mappings in the interrupt registers,
+ * cleared by a switch as the features differ between variants
+ */
+#define BMI270_VARIANT_INT1_MAP_FEAT_IDX      (BMI2_INT1_MAP_FEAT_ADDR - BMI2_INT1_IO_CTRL_ADDR)
+#define BMI270_VARIANT_INT2_MAP_FEAT_IDX      (BMI2_INT2_MAP_FEAT_ADDR - BMI2_INT1_IO_CTRL_ADDR)
+
+/******************************************************************************/
+/*! @name           Function Pointers                             */
+/******************************************************************************/
+
+/*!
+ * @brief Function pointer which initializes or loads a BMI270 variant.
+ *
+ * @param[in, out] dev : Structure instance of bmi2_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+typedef int8_t (*bmi270_variant_load_fptr_t)(struct bmi2_dev *dev);
+
+/*!
+ * @brief Time function pointer which should be mapped to a microsecond
+ * timer of the user, used to measure the switch latency. It may wrap around.
+ *
+ * @return Time in microseconds
+ */
+typedef uint32_t (*bmi270_variant_time_fptr_t)(void);
+
+/******************************************************************************/
+/*!  @name         Structure Declarations                             */
+/******************************************************************************/
+
+/*!  @name Structure to define the sensor state kept across a variant switch */
+struct bmi270_variant_state
+{
+    /*! Sensor and FIFO configuration registers */
+    uint8_t sens_conf[BMI270_VARIANT_SENS_CONF_LEN];
+
+    /*! Interrupt pin and mapping registers */
+    uint8_t int_conf[BMI270_VARIANT_INT_CONF_LEN];
+
+    /*! Power configuration register */
+    uint8_t pwr_conf;
+
+    /*! Power control register */
+    uint8_t pwr_ctrl;
+
+    /*! Enabled main sensors */
+    uint64_t sens_en_stat;
+};
+
+/*!  @name Structure to define the variant manager and its switch latency */
+struct bmi270_variant_mgr
+{
+    /*! Active variant */
+    uint8_t variant;
+
+    /*! Burst length of the configuration upload of a switch, 0 keeps read_write_len */
+    uint16_t upload_len;
+
+    /*! Time function pointer, NULL when the latency is not measured */
+    bmi270_variant_time_fptr_t get_time_us;
+
+    /*! Sensor state saved by the last switch */
+    struct bmi270_variant_state state;
+
+    /*! Number of switches */
+    uint32_t n_switches;
+
+    /*! Number of switches which fell back to a soft-reset */
+    uint32_t n_resets;
+
+    /*! Time of the last switch in microseconds */
+    uint32_t switch_us;
+
+    /*! Longest switch in microseconds */
+    uint32_t max_switch_us;
+
+    /*! Time the last switch spent saving the sensor state in microseconds */
+    uint32_t save_us;
+
+    /*! Time the last switch spent loading the configuration file in microseconds */
+    uint32_t load_us;
+
+    /*! Time the last switch spent restoring the sensor state in microseconds */
+    uint32_t restore_us;
+};
+
+/***************************************************************************/
+
+/*!     BMI270_VARIANT User Interface function prototypes
+ ****************************************************************************/
+
+/**
+ * \ingroup bmi270_variant
+ * \defgroup bmi270_variantApiSwitch Variant switch
+ * @brief Initialize a BMI270 variant and switch to another one at runtime
+ */
+
+/*!
+ * \ingroup bmi270_variantApiSwitch
+ * \page bmi270_variant_api_bmi270_variant_init bmi270_variant_init
+ * \code
+ * int8_t bmi270_variant_init(uint8_t variant, struct bmi270_variant_mgr *mgr, struct bmi2_dev *dev);
+ * \endcode
+ * @details This API initializes the sensor with the init API of the given
+ * variant and clears the switch statistics. upload_len and get_time_us of the
+ * manager are set by the user before.
+ *
+ * @param[in] variant       : Variant to initialize.
+ *
+ *@verbatim
+ *    variant                     |  Value
+ * -------------------------------|---------
+ *  BMI270_VARIANT_BASE           |  0
+ *  BMI270_VARIANT_LEGACY         |  1
+ *  BMI270_VARIANT_CONTEXT        |  2
+ *  BMI270_VARIANT_MAXIMUM_FIFO   |  3
+ *@endverbatim
+ *
+ * @param[in, out] mgr      : Structure instance of bmi270_variant_mgr.
+ * @param[in, out] dev      : Structure instance of bmi2_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi270_variant_init(uint8_t variant, struct bmi270_variant_mgr *mgr, struct bmi2_dev *dev);
+
+/*!
+ * \ingroup bmi270_variantApiSwitch
+ * \page bmi270_variant_api_bmi270_variant_switch bmi270_variant_switch
+ * \code
+ * int8_t bmi270_variant_switch(uint8_t variant, struct bmi270_variant_mgr *mgr, struct bmi2_dev *dev);
+ * \endcode
+ * @details This API switches the sensor to another variant:
+ *  1) Saves the sensor, FIFO and interrupt configuration.
+ *  2) Loads the configuration file of the variant without a soft-reset,
+ *     falling back to the init API of the variant if the load fails.
+ *  3) Restores the saved configuration, except the feature interrupt
+ *     mappings, and the enabled main sensors.
+ *  4) Updates the switch latency of the manager.
+ *
+ * Features of the previous variant are disabled by the switch and are
+ * configured again with the APIs of the new variant.
+ *
+ * @param[in] variant       : Variant to switch to.
+ * @param[in, out] mgr      : Structure instance of bmi270_variant_mgr.
+ * @param[in, out] dev      : Structure instance of bmi2_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi270_variant_switch(uint8_t variant, struct bmi270_variant_mgr *mgr, struct bmi2_dev *dev);
+
+/*!
+ * \ingroup bmi270_variantApiSwitch
+ * \page bmi270_variant_api_bmi270_variant_save_state bmi270_variant_save_state
+ * \code
+ * int8_t bmi270_variant_save_state(struct bmi270_variant_state *state, struct bmi2_dev *dev);
+ * \endcode
+ * @details This API saves the sensor, FIFO and interrupt configuration and the
+ * enabled main sensors.
+ *
+ * @param[out] state        : Structure instance of bmi270_variant_state.
+ * @param[in] dev           : Structure instance of bmi2_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi270_variant_save_state(struct bmi270_variant_state *state, struct bmi2_dev *dev);
+
+/*!
+ * \ingroup bmi270_variantApiSwitch
+ * \page bmi270_variant_api_bmi270_variant_restore_state bmi270_variant_restore_state
+ * \code
+ * int8_t bmi270_variant_restore_state(const struct bmi270_variant_state *state, struct bmi2_dev *dev);
+ * \endcode
+ * @details This API restores a saved sensor, FIFO and interrupt configuration,
+ * with the feature interrupt mappings cleared, and then the power control and
+ * configuration.
+ *
+ * @param[in] state         : Structure instance of bmi270_variant_state.
+ * @param[in, out] dev      : Structure instance of bmi2_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi270_variant_restore_state(const struct bmi270_variant_state *state, struct bmi2_dev *dev);
+
+/******************************************************************************/
+/*! @name       C++ Guard Macros                                      */
+/******************************************************************************/
+#ifdef __cplusplus
+}
+#endif /* End of CPP guard */
+
+#endif /* BMI270_VARIANT_H_ */
@@ -181,6 +181,9 @@
 #define BMI2_W_PARTIAL_READ                       INT8_C(2)
 #define BMI2_W_DUMMY_BYTE                         INT8_C(3)
 
+/*! @name To define warning for a self-test or NVM step still in progress */
+#define BMI2_W_STEP_PENDING                       INT8_C(4)
+
 /*! @name Macros to define dummy frame header  FIFO headerless mode */
 #define BMI2_FIFO_HEADERLESS_DUMMY_ACC            UINT8_C(0x01)
 #define BMI2_FIFO_HEADERLESS_DUMMY_GYR            UINT8_C(0x02)
@@ -271,6 +274,7 @@
 #define BMI2_ACC_START_INDEX                      UINT8_C(9)
 #define BMI2_GYR_START_INDEX                      UINT8_C(15)
 #define BMI2_ACC_GYR_AUX_SENSORTIME_NUM_BYTES     UINT8_C(24)
+#define BMI2_CONFIG_FILE_SIZE                     UINT16_C(8192)
 #define BMI2_CRT_CONFIG_FILE_SIZE                 UINT16_C(2048)
 #define BMI2_FEAT_SIZE_IN_BYTES                   UINT8_C(16)
 #define BMI2_ACC_CONFIG_LENGTH                    UINT8_C(2)
@@ -279,6 +283,22 @@
 #define BMI2_CONFIG_LOAD_SUCCESS                  UINT8_C(1)
 #define BMI2_CONFIG_LOAD_STATUS_MASK              UINT8_C(0x0F)
 
+/*! @name Compressed configuration blob stream: a control byte below 0x80 is
+ * followed by (control + 1) literal bytes, otherwise it is followed by a
+ * 16-bit little-endian dictionary offset to copy
+ * ((control & 0x7F) + BMI2_CONFIG_BLOB_MIN_COPY) bytes from
+ */
+#define BMI2_CONFIG_BLOB_COPY                     UINT8_C(0x80)
+#define BMI2_CONFIG_BLOB_LEN_MASK                 UINT8_C(0x7F)
+#define BMI2_CONFIG_BLOB_MIN_COPY                 UINT8_C(4)
+
+/*! @name Size of the buffer a compressed configuration blob is decoded into;
+ * bounds the burst length of the configuration upload
+ */
+#ifndef BMI2_CONFIG_CHUNK_SIZE
+#define BMI2_CONFIG_CHUNK_SIZE                    UINT16_C(64)
+#endif
+
 /*! @name To define BMI2 pages */
 #define BMI2_PAGE_0                               UINT8_C(0)
 #define BMI2_PAGE_1                               UINT8_C(1)
@@ -289,6 +309,21 @@
 #define BMI2_PAGE_6                               UINT8_C(6)
 #define BMI2_PAGE_7                               UINT8_C(7)
 
+/*! @name Macros to describe the fields of a feature configuration in an encoder table */
+#define BMI2_FEAT_MEMBER(type, member) \
+    (uint8_t)offsetof(type, member), (uint8_t)sizeof(((type *)0)->member)
+#define BMI2_FEAT_FIELD(word, bitname, type, member) \
+    { word, bitname##_MASK, bitname##_POS, BMI2_FEAT_MEMBER(type, member) }
+#define BMI2_FEAT_FIELD_POS0(word, bitname, type, member) \
+    { word, bitname##_MASK, 0, BMI2_FEAT_MEMBER(type, member) }
+#define BMI2_FEAT_FIELD_WORD(word, type, member) \
+    { word, UINT16_C(0xFFFF), 0, BMI2_FEAT_MEMBER(type, member) }
+
+/*! @name Number of fields of the feature configurations shared across variants */
+#define BMI2_ANY_NO_MOT_N_FIELDS                  UINT8_C(5)
+#define BMI2_SIG_MOT_N_FIELDS                     UINT8_C(1)
+#define BMI2_STEP_N_FIELDS                        UINT8_C(2)
+
 /*! @name Array Parameter Definitions */
 #define BMI2_PARSE_SENSOR_TIME_LSB_BYTE           UINT8_C(21)
 #define BMI2_PARSE_SENSOR_TIME_XLSB_BYTE          UINT8_C(22)
@@ -402,6 +437,23 @@
 /*! @name Macro to define gyroscope configuration value for FOC */
 #define BMI2_FOC_GYR_CONF_VAL                     UINT8_C(0xB6)
 
+/*! @name Macro to define accelerometer configuration value for FIFO based
+ * FOC, 1600Hz, continuous mode, CIC mode
+ */
+#ifndef BMI2_FOC_FIFO_ACC_CONF_VAL
+#define BMI2_FOC_FIFO_ACC_CONF_VAL                UINT8_C(0xBC)
+#endif
+
+/*! @name Macro to define gyroscope configuration value for FIFO based FOC,
+ * 400Hz, continuous mode, CIC mode
+ */
+#ifndef BMI2_FOC_FIFO_GYR_CONF_VAL
+#define BMI2_FOC_FIFO_GYR_CONF_VAL                UINT8_C(0xBA)
+#endif
+
+/*! @name Number of FIFO registers from FIFO_DOWNS to FIFO_CONFIG_1 */
+#define BMI2_FOC_FIFO_REG_LEN                     UINT8_C(5)
+
 /*! @name Macro to define X Y and Z axis for an array */
 #define BMI2_X_AXIS                               UINT8_C(0)
 #define BMI2_Y_AXIS                               UINT8_C(1)
@@ -410,6 +462,13 @@
 /*! @name Macro for delay to read internal status */
 #define BMI2_INTERNAL_STATUS_READ_DELAY_MS        UINT32_C(140000)
 
+/*! @name Interval in microseconds of the polls for the configuration load
+ * status, which give up after BMI2_INTERNAL_STATUS_READ_DELAY_MS
+ */
+#ifndef BMI2_CONFIG_LOAD_POLL_US
+#define BMI2_CONFIG_LOAD_POLL_US                  UINT32_C(1000)
+#endif
+
 /******************************************************************************/
 /*! @name        Sensor Macro Definitions                 */
 /******************************************************************************/
@@ -833,6 +892,39 @@
 #define BMI2_CRT_MIN_BURST_WORD_LENGTH            UINT8_C(2)
 #define BMI2_CRT_MAX_BURST_WORD_LENGTH            UINT16_C(255)
 
+/*! @name Macro to define the start of the CRT configuration in the configuration file */
+#define BMI2_CRT_CONFIG_FILE_START                UINT16_C(0x1800)
+
+/*! @name Macros to define the procedures of the self-test state machine */
+#define BMI2_TEST_SM_GYRO_SELF_TEST               UINT8_C(1)
+#define BMI2_TEST_SM_CRT                          UINT8_C(2)
+#define BMI2_TEST_SM_ACCEL_SELF_TEST              UINT8_C(3)
+#define BMI2_TEST_SM_NVM_PROG                     UINT8_C(4)
+
+/*! @name Macros to define the states of the self-test state machine */
+#define BMI2_TEST_SM_DONE                         UINT8_C(0)
+#define BMI2_TEST_SM_GT_START                     UINT8_C(1)
+#define BMI2_TEST_SM_GT_SETUP                     UINT8_C(2)
+#define BMI2_TEST_SM_GT_DL_READY                  UINT8_C(3)
+#define BMI2_TEST_SM_GT_DL_CHUNK                  UINT8_C(4)
+#define BMI2_TEST_SM_GT_DL_ACK                    UINT8_C(5)
+#define BMI2_TEST_SM_GT_RUNNING                   UINT8_C(6)
+#define BMI2_TEST_SM_ACC_START                    UINT8_C(7)
+#define BMI2_TEST_SM_ACC_SETUP                    UINT8_C(8)
+#define BMI2_TEST_SM_ACC_SIGN                     UINT8_C(9)
+#define BMI2_TEST_SM_ACC_READ                     UINT8_C(10)
+#define BMI2_TEST_SM_NVM_START                    UINT8_C(11)
+#define BMI2_TEST_SM_NVM_PROG_CMD                 UINT8_C(12)
+#define BMI2_TEST_SM_NVM_WAIT                     UINT8_C(13)
+
+/*! @name Macros to define the waits of the accel self-test and NVM programming */
+#define BMI2_ACC_SELF_TEST_ENABLE_US              UINT32_C(1000)
+#define BMI2_ACC_SELF_TEST_CONFIG_US              UINT32_C(3000)
+#define BMI2_ACC_SELF_TEST_SETTLE_US              UINT32_C(51000)
+#define BMI2_NVM_PREP_US                          UINT32_C(40000)
+#define BMI2_NVM_PROG_POLL_US                     UINT32_C(20000)
+#define BMI2_NVM_PROG_RETRY                       UINT8_C(100)
+
 /* Reference value with positive and negative noise range in lsb */
 
 /*
@@ -1692,6 +1784,54 @@ struct bmi2_gyro_self_test_status
     uint8_t gyr_axis_z_ok : 1;
 };
 
+/*! @name Structure to define the context of a resumable self-test, CRT or
+ * NVM programming procedure
+ */
+struct bmi2_test_sm
+{
+    /*! Procedure, BMI2_TEST_SM_GYRO_SELF_TEST to BMI2_TEST_SM_NVM_PROG */
+    uint8_t op;
+
+    /*! Current state of the procedure */
+    uint8_t state;
+
+    /*! Status of advance power save before the procedure */
+    uint8_t aps_stat;
+
+    /*! Polls left before the current wait times out */
+    uint8_t retry;
+
+    /*! Max burst length at the start of the CRT */
+    uint8_t max_burst_len;
+
+    /*! Value of rdy_for_dl before the last G_TRIGGER command */
+    uint8_t rdy_for_dl;
+
+    /*! Set when the next CRT download burst is not acknowledged */
+    uint8_t last_byte_flag;
+
+    /*! Polarity of the accel self-test excitation */
+    uint8_t sign;
+
+    /*! Index of the next CRT download burst */
+    uint16_t dl_index;
+
+    /*! Length of the CRT download bursts, 0 when no download is needed */
+    uint16_t dl_len;
+
+    /*! End of the full length CRT download bursts */
+    uint16_t dl_balance;
+
+    /*! Accel data with positive self-test excitation */
+    struct bmi2_sens_axes_data positive;
+
+    /*! Time in microseconds from which the next step is due */
+    uint32_t next_us;
+
+    /*! Result of the procedure once it is done */
+    int8_t rslt;
+};
+
 /*! @name Structure to define NVM error status */
 struct bmi2_nvm_err_status
 {
@@ -2479,6 +2619,79 @@ struct bmi2_feature_config
     uint8_t start_addr;
 };
 
+/*!  @name Structure to define a field of a feature configuration */
+struct bmi2_feat_field
+{
+    /*! Word holding the field, in words from the start address of the feature */
+    uint8_t word;
+
+    /*! Mask of the field in the word */
+    uint16_t mask;
+
+    /*! Bit position of the field in the word */
+    uint8_t pos;
+
+    /*! Offset in bytes of the member holding the field value */
+    uint8_t member;
+
+    /*! Size in bytes of the member, 1 or 2 */
+    uint8_t size;
+};
+
+/*!  @name Structure to define the encoder of a feature configuration */
+struct bmi2_feat_encoder
+{
+    /*! Defines the type of sensor */
+    uint8_t type;
+
+    /*! Feature whose input configuration locates the fields */
+    uint8_t feat;
+
+    /*! Fields of the feature configuration */
+    const struct bmi2_feat_field *fields;
+
+    /*! Number of fields */
+    uint8_t n_fields;
+};
+
+/*!  @name Structure to define a configuration file kept compressed in flash */
+struct bmi2_config_blob
+{
+    /*! Compressed stream of literal runs and dictionary copies */
+    const uint8_t *data;
+
+    /*! Size of the compressed stream */
+    uint16_t size;
+
+    /*! Size of the decoded configuration file */
+    uint16_t raw_size;
+
+    /*! Dictionary the copies refer to, itself an uncompressed configuration file */
+    const uint8_t *dict;
+
+    /*! Size of the dictionary */
+    uint16_t dict_size;
+};
+
+/*!  @name Structure to hold the decode position in a compressed configuration blob */
+struct bmi2_config_cursor
+{
+    /*! Position of the next control or literal byte in the stream */
+    uint16_t in_pos;
+
+    /*! Position in the decoded configuration file */
+    uint16_t out_pos;
+
+    /*! Position of the next byte to copy from the dictionary */
+    uint16_t dict_pos;
+
+    /*! Bytes left in the current literal run or copy */
+    uint8_t run;
+
+    /*! Indicates the current run is a dictionary copy */
+    uint8_t copy;
+};
+
 /*!  @name Structure to define the feature interrupt configurations */
 struct bmi2_map_int
 {
@@ -2526,6 +2739,12 @@ struct bmi2_dev
     /*! Pointer to the configuration data buffer address */
     const uint8_t *config_file_ptr;
 
+    /*! Compressed configuration file, uploaded instead of config_file_ptr when assigned */
+    const struct bmi2_config_blob *config_blob;
+
+    /*! Decode position in the compressed configuration file */
+    struct bmi2_config_cursor config_cursor;
+
     /*! To define maximum page number */
     uint8_t page_max;
 
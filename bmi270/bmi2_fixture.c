@@ -0,0 +1,365 @@
+/**
+* SPDX-License-Identifier: BSD-3-Clause
+*
+* @file       bmi2_fixture.c
+* @date       2026-10-18
+*
+*/
+
+/***************************************************************************/
+
+/*!             Header files
+ ****************************************************************************/
+#include "bmi2_fixture.h"
+
+/***************************************************************************/
+
+/*!              Global Variable
+ ****************************************************************************/
+
+/*! @name  Procedures of the tests, indexed by test */
+static const uint8_t test_op[BMI2_FIXTURE_N_TESTS] = {
+    BMI2_TEST_SM_ACCEL_SELF_TEST, BMI2_TEST_SM_GYRO_SELF_TEST, BMI2_TEST_SM_CRT
+};
+
+/******************************************************************************/
+
+/*!         Local Function Prototypes
+ ******************************************************************************/
+
+/*!
+ * @brief This internal API finds the next test of a sensor.
+ *
+ * @param[in] tests     : Tests to run.
+ * @param[in] test_idx  : Index from which the test is searched.
+ *
+ * @return Index of the next test, BMI2_FIXTURE_N_TESTS when none is left
+ */
+static uint8_t next_test(uint8_t tests, uint8_t test_idx);
+
+/*!
+ * @brief This internal API checks if the next step of a sensor is due.
+ *
+ * @param[in] now_us    : Current time in microseconds.
+ * @param[in] dut       : Structure instance of bmi2_fixture_dut.
+ *
+ * @return BMI2_TRUE when the step is due, BMI2_FALSE otherwise
+ */
+static uint8_t step_is_due(uint32_t now_us, const struct bmi2_fixture_dut *dut);
+
+/*!
+ * @brief This internal API runs the next step of a sensor, starting its test
+ * first if needed, and records the result once the test is done.
+ *
+ * @param[in] now_us        : Current time in microseconds.
+ * @param[in, out] dut      : Structure instance of bmi2_fixture_dut.
+ * @param[in, out] fx       : Structure instance of bmi2_fixture.
+ */
+static void run_step(uint32_t now_us, struct bmi2_fixture_dut *dut, struct bmi2_fixture *fx);
+
+/*!
+ * @brief This internal API finds the time of the next due step.
+ *
+ * @param[in] now_us    : Current time in microseconds.
+ * @param[in] fx        : Structure instance of bmi2_fixture.
+ *
+ * @return Time of the next due step in microseconds
+ */
+static uint32_t next_due_us(uint32_t now_us, const struct bmi2_fixture *fx);
+
+/*!
+ * @brief This internal API reads the time of the fixture, 0 when the bus
+ * time is not measured.
+ *
+ * @param[in] fx : Structure instance of bmi2_fixture.
+ *
+ * @return Time in microseconds
+ */
+static uint32_t get_time_us(const struct bmi2_fixture *fx);
+
+/***************************************************************************/
+
+/*!         User Interface Definitions
+ ****************************************************************************/
+
+/*!
+ * @brief This API initializes a fixture without sensors.
+ */
+int8_t bmi2_fixture_init(bmi2_fixture_time_fptr_t get_time_us, struct bmi2_fixture *fx)
+{
+    /* Variable to define error */
+    int8_t rslt = BMI2_OK;
+
+    /* Variable to define loop */
+    uint8_t loop;
+
+    if (fx != NULL)
+    {
+        fx->n_duts = 0;
+        fx->n_pending = 0;
+        fx->get_time_us = get_time_us;
+        fx->started = BMI2_FALSE;
+        fx->start_us = 0;
+        fx->duration_us = 0;
+
+        for (loop = 0; loop < BMI2_FIXTURE_MAX_BUSES; loop++)
+        {
+            fx->next_dut[loop] = 0;
+            fx->n_steps[loop] = 0;
+            fx->bus_us[loop] = 0;
+        }
+    }
+    else
+    {
+        rslt = BMI2_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API adds an initialized sensor and the tests to run on it to the
+ * fixture.
+ */
+int8_t bmi2_fixture_add(uint8_t bus, uint8_t tests, struct bmi2_dev *dev, struct bmi2_fixture *fx)
+{
+    /* Variable to define error */
+    int8_t rslt = BMI2_OK;
+
+    /* Variable to define loop */
+    uint8_t loop;
+
+    struct bmi2_fixture_dut *dut;
+
+    if ((fx == NULL) || (dev == NULL))
+    {
+        rslt = BMI2_E_NULL_PTR;
+    }
+    else if ((fx->n_duts >= BMI2_FIXTURE_MAX_DUTS) || (bus >= BMI2_FIXTURE_MAX_BUSES) ||
+             ((tests & BMI2_FIXTURE_ALL_TESTS) == 0) || (fx->started == BMI2_TRUE))
+    {
+        rslt = BMI2_E_INVALID_INPUT;
+    }
+    else
+    {
+        dut = &fx->dut[fx->n_duts];
+        dut->dev = dev;
+        dut->bus = bus;
+        dut->tests = tests;
+        dut->test_idx = next_test(tests, 0);
+
+        for (loop = 0; loop < BMI2_FIXTURE_N_TESTS; loop++)
+        {
+            dut->result[loop].rslt = BMI2_W_STEP_PENDING;
+            dut->result[loop].start_us = 0;
+            dut->result[loop].duration_us = 0;
+            dut->result[loop].bus_us = 0;
+            dut->result[loop].n_steps = 0;
+        }
+
+        fx->n_duts++;
+        fx->n_pending++;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API runs at most one due step on each bus, serving the sensors
+ * of a bus round robin.
+ */
+int8_t bmi2_fixture_poll(uint32_t now_us, uint32_t *next_us, struct bmi2_fixture *fx)
+{
+    /* Variable to define error */
+    int8_t rslt = BMI2_OK;
+
+    /* Variables to define loop */
+    uint8_t bus;
+    uint8_t loop;
+
+    /* Variable to define the index of a sensor */
+    uint8_t idx;
+
+    if ((fx == NULL) || (next_us == NULL))
+    {
+        rslt = BMI2_E_NULL_PTR;
+    }
+    else
+    {
+        if (fx->started == BMI2_FALSE)
+        {
+            fx->started = BMI2_TRUE;
+            fx->start_us = now_us;
+        }
+
+        for (bus = 0; bus < BMI2_FIXTURE_MAX_BUSES; bus++)
+        {
+            for (loop = 0; loop < fx->n_duts; loop++)
+            {
+                idx = (uint8_t)((fx->next_dut[bus] + loop) % fx->n_duts);
+                if ((fx->dut[idx].bus == bus) && step_is_due(now_us, &fx->dut[idx]))
+                {
+                    run_step(now_us, &fx->dut[idx], fx);
+
+                    /* The next poll of this bus starts after the served sensor */
+                    fx->next_dut[bus] = (uint8_t)((idx + 1) % fx->n_duts);
+                    break;
+                }
+            }
+        }
+
+        *next_us = next_due_us(now_us, fx);
+
+        if (fx->n_pending > 0)
+        {
+            rslt = BMI2_W_STEP_PENDING;
+        }
+    }
+
+    return rslt;
+}
+
+/***************************************************************************/
+
+/*!              Local Function Definitions
+ ****************************************************************************/
+
+/*!
+ * @brief This internal API finds the next test of a sensor.
+ */
+static uint8_t next_test(uint8_t tests, uint8_t test_idx)
+{
+    while ((test_idx < BMI2_FIXTURE_N_TESTS) && ((tests & (1 << test_idx)) == 0))
+    {
+        test_idx++;
+    }
+
+    return test_idx;
+}
+
+/*!
+ * @brief This internal API checks if the next step of a sensor is due.
+ */
+static uint8_t step_is_due(uint32_t now_us, const struct bmi2_fixture_dut *dut)
+{
+    uint8_t due = BMI2_FALSE;
+
+    if (dut->test_idx < BMI2_FIXTURE_N_TESTS)
+    {
+        /* A test which is not started yet is due at once */
+        if ((dut->result[dut->test_idx].n_steps == 0) || ((int32_t)(now_us - dut->sm.next_us) >= 0))
+        {
+            due = BMI2_TRUE;
+        }
+    }
+
+    return due;
+}
+
+/*!
+ * @brief This internal API runs the next step of a sensor and records the
+ * result once the test is done.
+ */
+static void run_step(uint32_t now_us, struct bmi2_fixture_dut *dut, struct bmi2_fixture *fx)
+{
+    /* Variable to define error */
+    int8_t rslt = BMI2_OK;
+
+    /* Variables to define the time of the step */
+    uint32_t begin_us;
+    uint32_t step_us;
+
+    struct bmi2_fixture_result *res = &dut->result[dut->test_idx];
+
+    begin_us = get_time_us(fx);
+
+    if (res->n_steps == 0)
+    {
+        res->start_us = now_us;
+        rslt = bmi2_test_sm_start(test_op[dut->test_idx], now_us, &dut->sm, dut->dev);
+    }
+
+    if (rslt == BMI2_OK)
+    {
+        rslt = bmi2_test_sm_step(now_us, &dut->sm, dut->dev);
+    }
+
+    step_us = get_time_us(fx) - begin_us;
+
+    res->n_steps++;
+    res->bus_us += step_us;
+    fx->n_steps[dut->bus]++;
+    fx->bus_us[dut->bus] += step_us;
+
+    if (rslt != BMI2_W_STEP_PENDING)
+    {
+        res->rslt = rslt;
+        res->duration_us = (now_us + step_us) - res->start_us;
+
+        dut->test_idx = next_test(dut->tests, (uint8_t)(dut->test_idx + 1));
+        if (dut->test_idx >= BMI2_FIXTURE_N_TESTS)
+        {
+            fx->n_pending--;
+            if (fx->n_pending == 0)
+            {
+                fx->duration_us = (now_us + step_us) - fx->start_us;
+            }
+        }
+    }
+}
+
+/*!
+ * @brief This internal API finds the time of the next due step.
+ */
+static uint32_t next_due_us(uint32_t now_us, const struct bmi2_fixture *fx)
+{
+    /* Variable to define loop */
+    uint8_t loop;
+
+    /* Variable to define the time to the next step of a sensor */
+    int32_t wait_us;
+
+    /* Variable to define the time to the next due step */
+    uint32_t min_wait_us = UINT32_MAX;
+
+    for (loop = 0; loop < fx->n_duts; loop++)
+    {
+        if (fx->dut[loop].test_idx < BMI2_FIXTURE_N_TESTS)
+        {
+            if (step_is_due(now_us, &fx->dut[loop]))
+            {
+                min_wait_us = 0;
+            }
+            else
+            {
+                wait_us = (int32_t)(fx->dut[loop].sm.next_us - now_us);
+                if ((uint32_t)wait_us < min_wait_us)
+                {
+                    min_wait_us = (uint32_t)wait_us;
+                }
+            }
+        }
+    }
+
+    if (min_wait_us == UINT32_MAX)
+    {
+        min_wait_us = 0;
+    }
+
+    return now_us + min_wait_us;
+}
+
+/*!
+ * @brief This internal API reads the time of the fixture.
+ */
+static uint32_t get_time_us(const struct bmi2_fixture *fx)
+{
+    uint32_t time_us = 0;
+
+    if (fx->get_time_us != NULL)
+    {
+        time_us = fx->get_time_us();
+    }
+
+    return time_us;
+}
@@ -0,0 +1,237 @@
+/**
+* SPDX-License-Identifier: BSD-3-Clause
+*
+* @file       bmi2_fixture.h
+* @date       2026-10-18
+*
+*/
+
+/**
+ * \ingroup bmi2xy
+ * \defgroup bmi2_fixture BMI2_FIXTURE
+ * @brief Concurrent CRT and self-tests on many sensors of a production fixture
+ */
+
+#ifndef BMI2_FIXTURE_H_
+#define BMI2_FIXTURE_H_
+
+/*! CPP guard */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************/
+
+/*!             Header files
+ ****************************************************************************/
+#include "bmi2.h"
+
+/***************************************************************************/
+
+/*!               Macro definitions
+ ****************************************************************************/
+
+/*! @name Maximum number of sensors of a fixture */
+#ifndef BMI2_FIXTURE_MAX_DUTS
+#define BMI2_FIXTURE_MAX_DUTS                 UINT8_C(16)
+#endif
+
+/*! @name Maximum number of buses of a fixture */
+#ifndef BMI2_FIXTURE_MAX_BUSES
+#define BMI2_FIXTURE_MAX_BUSES                UINT8_C(4)
+#endif
+
+/*! @name Tests of a sensor, run in this order as the accel self-test ends
+ * with a soft reset which would drop the CRT gains
+ */
+#define BMI2_FIXTURE_ACCEL_SELF_TEST          UINT8_C(0x01)
+#define BMI2_FIXTURE_GYRO_SELF_TEST           UINT8_C(0x02)
+#define BMI2_FIXTURE_CRT                      UINT8_C(0x04)
+#define BMI2_FIXTURE_ALL_TESTS                UINT8_C(0x07)
+
+/*! @name Number of tests, index of a test in the results of a sensor */
+#define BMI2_FIXTURE_N_TESTS                  UINT8_C(3)
+
+/******************************************************************************/
+/*! @name           Function Pointers                             */
+/******************************************************************************/
+
+/*!
+ * @brief Time function pointer which should be mapped to a microsecond
+ * timer of the user, used to measure the bus time of the steps. It may wrap
+ * around.
+ *
+ * @return Time in microseconds
+ */
+typedef uint32_t (*bmi2_fixture_time_fptr_t)(void);
+
+/******************************************************************************/
+/*!  @name         Structure Declarations                             */
+/******************************************************************************/
+
+/*!  @name Structure to define the result of a test of a sensor */
+struct bmi2_fixture_result
+{
+    /*! Result of the test, BMI2_W_STEP_PENDING until it is done */
+    int8_t rslt;
+
+    /*! Time of the first step in microseconds */
+    uint32_t start_us;
+
+    /*! Time from the first step to the end of the test in microseconds */
+    uint32_t duration_us;
+
+    /*! Time spent in the steps in microseconds, 0 without get_time_us */
+    uint32_t bus_us;
+
+    /*! Number of steps */
+    uint16_t n_steps;
+};
+
+/*!  @name Structure to define a sensor of the fixture */
+struct bmi2_fixture_dut
+{
+    /*! Initialized sensor */
+    struct bmi2_dev *dev;
+
+    /*! Bus of the sensor, sensors on one bus get their steps in turn */
+    uint8_t bus;
+
+    /*! Tests to run, BMI2_FIXTURE_ACCEL_SELF_TEST | ... */
+    uint8_t tests;
+
+    /*! Index of the running test, BMI2_FIXTURE_N_TESTS once all are done */
+    uint8_t test_idx;
+
+    /*! Context of the running test */
+    struct bmi2_test_sm sm;
+
+    /*! Results, indexed by test */
+    struct bmi2_fixture_result result[BMI2_FIXTURE_N_TESTS];
+};
+
+/*!  @name Structure to define a production fixture */
+struct bmi2_fixture
+{
+    /*! Sensors of the fixture */
+    struct bmi2_fixture_dut dut[BMI2_FIXTURE_MAX_DUTS];
+
+    /*! Number of sensors */
+    uint8_t n_duts;
+
+    /*! Number of sensors with tests left */
+    uint8_t n_pending;
+
+    /*! Sensor from which the next step of a bus is searched, round robin */
+    uint8_t next_dut[BMI2_FIXTURE_MAX_BUSES];
+
+    /*! Time function pointer, NULL when the bus time is not measured */
+    bmi2_fixture_time_fptr_t get_time_us;
+
+    /*! Set by the first poll, sensors can no longer be added */
+    uint8_t started;
+
+    /*! Time of the first poll in microseconds */
+    uint32_t start_us;
+
+    /*! Time from the first poll to the end of the last test in microseconds */
+    uint32_t duration_us;
+
+    /*! Number of steps run on each bus */
+    uint32_t n_steps[BMI2_FIXTURE_MAX_BUSES];
+
+    /*! Time spent in steps on each bus in microseconds, 0 without get_time_us */
+    uint32_t bus_us[BMI2_FIXTURE_MAX_BUSES];
+};
+
+/***************************************************************************/
+
+/*!     BMI2_FIXTURE User Interface function prototypes
+ ****************************************************************************/
+
+/**
+ * \ingroup bmi2_fixture
+ * \defgroup bmi2_fixtureApiRun Fixture
+ * @brief Run CRT, accel and gyro self-tests on many sensors concurrently
+ */
+
+/*!
+ * \ingroup bmi2_fixtureApiRun
+ * \page bmi2_fixture_api_bmi2_fixture_init bmi2_fixture_init
+ * \code
+ * int8_t bmi2_fixture_init(bmi2_fixture_time_fptr_t get_time_us, struct bmi2_fixture *fx);
+ * \endcode
+ * @details This API initializes a fixture without sensors.
+ *
+ * @param[in] get_time_us   : Time function pointer, NULL when the bus time is
+ *                            not measured.
+ * @param[out] fx           : Structure instance of bmi2_fixture.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi2_fixture_init(bmi2_fixture_time_fptr_t get_time_us, struct bmi2_fixture *fx);
+
+/*!
+ * \ingroup bmi2_fixtureApiRun
+ * \page bmi2_fixture_api_bmi2_fixture_add bmi2_fixture_add
+ * \code
+ * int8_t bmi2_fixture_add(uint8_t bus, uint8_t tests, struct bmi2_dev *dev, struct bmi2_fixture *fx);
+ * \endcode
+ * @details This API adds an initialized sensor and the tests to run on it to
+ * the fixture. Each sensor has its own bmi2_dev, e.g. one per I2C bus and
+ * address or SPI chip select.
+ *
+ * @param[in] bus           : Bus of the sensor, below BMI2_FIXTURE_MAX_BUSES.
+ * @param[in] tests         : Tests to run.
+ *
+ *@verbatim
+ *    tests                         |  Value
+ * ---------------------------------|---------
+ *  BMI2_FIXTURE_ACCEL_SELF_TEST    |  0x01
+ *  BMI2_FIXTURE_GYRO_SELF_TEST     |  0x02
+ *  BMI2_FIXTURE_CRT                |  0x04
+ *@endverbatim
+ *
+ * @param[in] dev           : Structure instance of bmi2_dev.
+ * @param[in, out] fx       : Structure instance of bmi2_fixture.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi2_fixture_add(uint8_t bus, uint8_t tests, struct bmi2_dev *dev, struct bmi2_fixture *fx);
+
+/*!
+ * \ingroup bmi2_fixtureApiRun
+ * \page bmi2_fixture_api_bmi2_fixture_poll bmi2_fixture_poll
+ * \code
+ * int8_t bmi2_fixture_poll(uint32_t now_us, uint32_t *next_us, struct bmi2_fixture *fx);
+ * \endcode
+ * @details This API runs at most one due step on each bus. The sensors of a
+ * bus are served round robin, so a CRT download does not hold back the
+ * other sensors of its bus, and the waits of all sensors overlap. A test is
+ * started with the first poll after the previous test of the sensor ended,
+ * and its result is kept also when it fails.
+ *
+ * @param[in] now_us        : Current time in microseconds. It may wrap around.
+ * @param[out] next_us      : Time of the next due step, now_us when a step is
+ *                            due at once. The caller may sleep until then.
+ * @param[in, out] fx       : Structure instance of bmi2_fixture.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> All tests are done, the results are in fx->dut[].result
+ * @retval BMI2_W_STEP_PENDING -> Tests are running
+ * @retval < 0 -> Fail
+ */
+int8_t bmi2_fixture_poll(uint32_t now_us, uint32_t *next_us, struct bmi2_fixture *fx);
+
+/******************************************************************************/
+/*! @name       C++ Guard Macros                                      */
+/******************************************************************************/
+#ifdef __cplusplus
+}
+#endif /* End of CPP guard */
+
+#endif /* BMI2_FIXTURE_H_ */
@@ -65,6 +65,15 @@ static int8_t get_ois_acc_gyr_data(struct bmi2_ois_sens_axes_data *ois_data,
                                    struct bmi2_ois_dev *ois_dev,
                                    int16_t ois_gyr_cross_sens_zx);
 
+/*!
+ * @brief This internal API decodes the x, y and z axes from the register data.
+ *
+ * @param[out] ois_data : Structure instance of bmi2_ois_sens_axes_data.
+ * @param[in] reg_data  : Register data of the x, y and z axes.
+ *
+ */
+static void unpack_ois_axes(struct bmi2_ois_sens_axes_data *ois_data, const uint8_t *reg_data);
+
 /*!
  * @brief This internal API is used to validate the OIS device pointer for null
  * conditions.
@@ -275,10 +284,33 @@ int8_t bmi2_ois_read_data(const uint8_t *sens_sel,
     /* Variable to update register address */
     uint8_t reg_addr = 0;
 
+    /* Variable to store the sensors selected */
+    uint8_t sens_mask = 0;
+
     /* Null-pointer check */
     rslt = null_ptr_check(ois_dev);
     if ((rslt == BMI2_OIS_OK) && (sens_sel != NULL))
     {
+        for (loop = 0; loop < n_sens; loop++)
+        {
+            if ((sens_sel[loop] == BMI2_OIS_ACCEL) || (sens_sel[loop] == BMI2_OIS_GYRO))
+            {
+                sens_mask |= sens_sel[loop];
+            }
+            else
+            {
+                /* Leave invalid selections to be reported below */
+                sens_mask = 0;
+                break;
+            }
+        }
+
+        /* Accelerometer and gyroscope registers are contiguous, read both in one burst */
+        if (sens_mask == (BMI2_OIS_ACCEL | BMI2_OIS_GYRO))
+        {
+            n_sens = 0;
+            rslt = bmi2_ois_read_acc_gyr(ois_dev, gyr_cross_sens_zx);
+        }
 
         for (loop = 0; loop < n_sens; loop++)
         {
@@ -320,6 +352,277 @@ int8_t bmi2_ois_read_data(const uint8_t *sens_sel,
     return rslt;
 }
 
+/*!
+ * @brief This API reads accelerometer and gyroscope data through OIS interface
+ * in a single burst.
+ */
+int8_t bmi2_ois_read_acc_gyr(struct bmi2_ois_dev *ois_dev, int16_t gyr_cross_sens_zx)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Array to define data stored in register */
+    uint8_t reg_data[BMI2_OIS_ACC_GYR_BURST_NUM_BYTES] = { 0 };
+
+    /* Read accelerometer and gyroscope data in one transaction */
+    rslt = bmi2_ois_get_regs(BMI2_OIS_ACC_X_LSB_ADDR, reg_data, BMI2_OIS_ACC_GYR_BURST_NUM_BYTES, ois_dev);
+    if (rslt == BMI2_OIS_OK)
+    {
+        unpack_ois_axes(&ois_dev->acc_data, &reg_data[0]);
+        unpack_ois_axes(&ois_dev->gyr_data, &reg_data[BMI2_OIS_GYR_X_LSB_ADDR - BMI2_OIS_ACC_X_LSB_ADDR]);
+
+        comp_gyro_cross_axis_sensitivity(&ois_dev->gyr_data, gyr_cross_sens_zx);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes timer driven OIS sampling.
+ */
+int8_t bmi2_ois_timing_init(uint32_t period_us, struct bmi2_ois_timing *timing)
+{
+    /* Variable to define error */
+    int8_t rslt = BMI2_OIS_OK;
+
+    if ((timing != NULL) && (period_us != 0))
+    {
+        timing->period_us = period_us;
+        timing->next_us = 0;
+        timing->started = BMI2_OIS_DISABLE;
+        timing->n_samples = 0;
+        timing->n_missed = 0;
+        timing->jitter_min_us = UINT32_C(0xFFFFFFFF);
+        timing->jitter_max_us = 0;
+        timing->jitter_sum_us = 0;
+    }
+    else
+    {
+        rslt = BMI2_OIS_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads accelerometer and gyroscope data on a sampling timer
+ * tick and updates the jitter statistics.
+ */
+int8_t bmi2_ois_read_timed(uint32_t now_us,
+                           struct bmi2_ois_timing *timing,
+                           struct bmi2_ois_dev *ois_dev,
+                           int16_t gyr_cross_sens_zx)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Deviation of the tick from its scheduled time */
+    int32_t deviation;
+
+    /* Variable to store the absolute deviation */
+    uint32_t jitter;
+
+    /* Variable to store the sampling periods skipped */
+    uint32_t missed = 0;
+
+    if ((timing == NULL) || (timing->period_us == 0))
+    {
+        rslt = BMI2_OIS_E_NULL_PTR;
+    }
+    else
+    {
+        /* Sample first, the statistics are not time critical */
+        rslt = bmi2_ois_read_acc_gyr(ois_dev, gyr_cross_sens_zx);
+    }
+
+    if (rslt == BMI2_OIS_OK)
+    {
+        if (timing->started == BMI2_OIS_DISABLE)
+        {
+            /* The first tick defines the sampling grid */
+            timing->started = BMI2_OIS_ENABLE;
+            timing->next_us = now_us;
+        }
+
+        deviation = (int32_t)(now_us - timing->next_us);
+        if (deviation >= (int32_t)timing->period_us)
+        {
+            missed = (uint32_t)deviation / timing->period_us;
+            deviation -= (int32_t)(missed * timing->period_us);
+            timing->next_us += missed * timing->period_us;
+            timing->n_missed += missed;
+        }
+
+        jitter = (deviation < 0) ? (uint32_t)(-deviation) : (uint32_t)deviation;
+        if (jitter < timing->jitter_min_us)
+        {
+            timing->jitter_min_us = jitter;
+        }
+
+        if (jitter > timing->jitter_max_us)
+        {
+            timing->jitter_max_us = jitter;
+        }
+
+        timing->jitter_sum_us += jitter;
+        timing->n_samples++;
+        timing->next_us += timing->period_us;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes the OIS acquisition service.
+ */
+int8_t bmi2_ois_acq_init(uint32_t period_us,
+                         int16_t gyr_cross_sens_zx,
+                         struct bmi2_ois_dev *ois_dev,
+                         struct bmi2_ois_acq *acq)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Variable to define loop */
+    uint8_t loop;
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(ois_dev);
+    if ((rslt == BMI2_OIS_OK) && (acq != NULL))
+    {
+        rslt = bmi2_ois_timing_init(period_us, &acq->timing);
+    }
+    else
+    {
+        rslt = BMI2_OIS_E_NULL_PTR;
+    }
+
+    if (rslt == BMI2_OIS_OK)
+    {
+        acq->ois_dev = ois_dev;
+        acq->gyr_cross_sens_zx = gyr_cross_sens_zx;
+        acq->head = 0;
+        acq->tail = 0;
+        acq->seq = 0;
+        acq->n_overrun = 0;
+        acq->n_read_fail = 0;
+        acq->latency_max_us = 0;
+        for (loop = 0; loop < BMI2_OIS_ACQ_HIST_BINS; loop++)
+        {
+            acq->latency_hist[loop] = 0;
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API samples OIS data into the acquisition ring on a sampling
+ * timer tick.
+ */
+int8_t bmi2_ois_acq_tick(uint32_t now_us, struct bmi2_ois_acq *acq)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Variable to store the ring write index */
+    uint16_t head;
+
+    /* Variable to point the ring slot written */
+    struct bmi2_ois_sample *sample;
+
+    if (acq == NULL)
+    {
+        rslt = BMI2_OIS_E_NULL_PTR;
+    }
+    else
+    {
+        rslt = bmi2_ois_read_timed(now_us, &acq->timing, acq->ois_dev, acq->gyr_cross_sens_zx);
+        if (rslt != BMI2_OIS_OK)
+        {
+            acq->n_read_fail++;
+        }
+    }
+
+    if (rslt == BMI2_OIS_OK)
+    {
+        head = acq->head;
+        if ((uint16_t)(head - acq->tail) >= BMI2_OIS_ACQ_RING_SIZE)
+        {
+            /* The consumer owns the oldest samples, drop the new one */
+            acq->n_overrun++;
+        }
+        else
+        {
+            sample = &acq->ring[head & (BMI2_OIS_ACQ_RING_SIZE - 1)];
+            sample->acc_data = acq->ois_dev->acc_data;
+            sample->gyr_data = acq->ois_dev->gyr_data;
+            sample->time_us = now_us;
+            sample->seq = acq->seq;
+
+            /* Publish the sample only once it is complete */
+            BMI2_OIS_ACQ_BARRIER();
+            acq->head = (uint16_t)(head + 1);
+        }
+
+        acq->seq++;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API takes the oldest sample from the OIS acquisition ring.
+ */
+int8_t bmi2_ois_acq_pop(uint32_t now_us, struct bmi2_ois_sample *sample, struct bmi2_ois_acq *acq)
+{
+    /* Variable to define error */
+    int8_t rslt = BMI2_OIS_OK;
+
+    /* Variable to store the ring read index */
+    uint16_t tail;
+
+    /* Variable to store the time from sampling to consumption */
+    uint32_t latency;
+
+    /* Variable to store the histogram bin */
+    uint32_t bin;
+
+    if ((acq == NULL) || (sample == NULL))
+    {
+        rslt = BMI2_OIS_E_NULL_PTR;
+    }
+    else if (acq->tail == acq->head)
+    {
+        rslt = BMI2_OIS_W_NO_SAMPLE;
+    }
+    else
+    {
+        tail = acq->tail;
+
+        /* Read the sample only after seeing it published */
+        BMI2_OIS_ACQ_BARRIER();
+        *sample = acq->ring[tail & (BMI2_OIS_ACQ_RING_SIZE - 1)];
+        BMI2_OIS_ACQ_BARRIER();
+        acq->tail = (uint16_t)(tail + 1);
+
+        latency = now_us - sample->time_us;
+        bin = latency / BMI2_OIS_ACQ_HIST_BIN_US;
+        if (bin >= BMI2_OIS_ACQ_HIST_BINS)
+        {
+            bin = BMI2_OIS_ACQ_HIST_BINS - 1;
+        }
+
+        acq->latency_hist[bin]++;
+        if (latency > acq->latency_max_us)
+        {
+            acq->latency_max_us = latency;
+        }
+    }
+
+    return rslt;
+}
+
 /***************************************************************************/
 
 /*!         Local Function Definitions
@@ -341,18 +644,6 @@ static int8_t get_ois_acc_gyr_data(struct bmi2_ois_sens_axes_data *ois_data,
     /* Variable to define error */
     int8_t rslt;
 
-    /* Variables to store MSB value */
-    uint8_t msb;
-
-    /* Variables to store LSB value */
-    uint8_t lsb;
-
-    /* Variables to store both MSB and LSB value */
-    uint16_t msb_lsb;
-
-    /* Variables to define index */
-    uint8_t index = 0;
-
     /* Array to define data stored in register */
     uint8_t reg_data[BMI2_OIS_ACC_GYR_NUM_BYTES] = { 0 };
 
@@ -360,23 +651,7 @@ static int8_t get_ois_acc_gyr_data(struct bmi2_ois_sens_axes_data *ois_data,
     rslt = bmi2_ois_get_regs(reg_addr, reg_data, BMI2_OIS_ACC_GYR_NUM_BYTES, ois_dev);
     if (rslt == BMI2_OIS_OK)
     {
-        /* Read x-axis data */
-        lsb = reg_data[index++];
-        msb = reg_data[index++];
-        msb_lsb = ((uint16_t)msb << 8) | (uint16_t)lsb;
-        ois_data->x = (int16_t)msb_lsb;
-
-        /* Read y-axis data */
-        lsb = reg_data[index++];
-        msb = reg_data[index++];
-        msb_lsb = ((uint16_t)msb << 8) | (uint16_t)lsb;
-        ois_data->y = (int16_t)msb_lsb;
-
-        /* Read z-axis data */
-        lsb = reg_data[index++];
-        msb = reg_data[index++];
-        msb_lsb = ((uint16_t)msb << 8) | (uint16_t)lsb;
-        ois_data->z = (int16_t)msb_lsb;
+        unpack_ois_axes(ois_data, reg_data);
 
         comp_gyro_cross_axis_sensitivity(ois_data, ois_gyr_cross_sens_zx);
     }
@@ -384,6 +659,42 @@ static int8_t get_ois_acc_gyr_data(struct bmi2_ois_sens_axes_data *ois_data,
     return rslt;
 }
 
+/*!
+ * @brief This internal API decodes the x, y and z axes from the register data.
+ */
+static void unpack_ois_axes(struct bmi2_ois_sens_axes_data *ois_data, const uint8_t *reg_data)
+{
+    /* Variables to store MSB value */
+    uint8_t msb;
+
+    /* Variables to store LSB value */
+    uint8_t lsb;
+
+    /* Variables to store both MSB and LSB value */
+    uint16_t msb_lsb;
+
+    /* Variables to define index */
+    uint8_t index = 0;
+
+    /* Read x-axis data */
+    lsb = reg_data[index++];
+    msb = reg_data[index++];
+    msb_lsb = ((uint16_t)msb << 8) | (uint16_t)lsb;
+    ois_data->x = (int16_t)msb_lsb;
+
+    /* Read y-axis data */
+    lsb = reg_data[index++];
+    msb = reg_data[index++];
+    msb_lsb = ((uint16_t)msb << 8) | (uint16_t)lsb;
+    ois_data->y = (int16_t)msb_lsb;
+
+    /* Read z-axis data */
+    lsb = reg_data[index++];
+    msb = reg_data[index++];
+    msb_lsb = ((uint16_t)msb << 8) | (uint16_t)lsb;
+    ois_data->z = (int16_t)msb_lsb;
+}
+
 /*!
  * @brief This internal API is used to validate the device structure pointer for
  * null conditions.
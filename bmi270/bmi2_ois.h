@@ -99,6 +99,9 @@ extern "C" {
 #define BMI2_OIS_E_COM_FAIL                   INT8_C(-2)
 #define BMI2_OIS_E_INVALID_SENSOR             INT8_C(-8)
 
+/*! @name To define warnings */
+#define BMI2_OIS_W_NO_SAMPLE                  INT8_C(1)
+
 /*! @name Mask definitions for SPI read/write address for OIS */
 #define BMI2_OIS_SPI_RD_MASK                  UINT8_C(0x80)
 #define BMI2_OIS_SPI_WR_MASK                  UINT8_C(0x7F)
@@ -106,6 +109,33 @@ extern "C" {
 /*! @name BMI2 OIS data bytes */
 #define BMI2_OIS_ACC_GYR_NUM_BYTES            UINT8_C(6)
 
+/*! @name BMI2 OIS accelerometer and gyroscope data bytes read in one burst */
+#define BMI2_OIS_ACC_GYR_BURST_NUM_BYTES      UINT8_C(12)
+
+/*! @name Number of samples in the OIS acquisition ring, must be a power of 2 */
+#ifndef BMI2_OIS_ACQ_RING_SIZE
+#define BMI2_OIS_ACQ_RING_SIZE                UINT16_C(64)
+#endif
+
+/*! @name Number of bins of the OIS acquisition latency histogram, the last bin holds all larger latencies */
+#ifndef BMI2_OIS_ACQ_HIST_BINS
+#define BMI2_OIS_ACQ_HIST_BINS                UINT8_C(16)
+#endif
+
+/*! @name Width of a bin of the OIS acquisition latency histogram in microseconds */
+#ifndef BMI2_OIS_ACQ_HIST_BIN_US
+#define BMI2_OIS_ACQ_HIST_BIN_US              UINT32_C(50)
+#endif
+
+/*! @name Memory barrier between the OIS acquisition producer and consumer */
+#ifndef BMI2_OIS_ACQ_BARRIER
+#if defined(__GNUC__)
+#define BMI2_OIS_ACQ_BARRIER()                __sync_synchronize()
+#else
+#define BMI2_OIS_ACQ_BARRIER()
+#endif
+#endif
+
 /*!  @name Macros to select sensor for OIS data read */
 #define BMI2_OIS_ACCEL                        UINT8_C(0x01)
 #define BMI2_OIS_GYRO                         UINT8_C(0x02)
@@ -239,6 +269,87 @@ struct bmi2_ois_dev
     struct bmi2_ois_sens_axes_data gyr_data;
 };
 
+/*!  @name Structure to define timer driven OIS sampling and its jitter statistics */
+struct bmi2_ois_timing
+{
+    /*! Sampling period in microseconds */
+    uint32_t period_us;
+
+    /*! Scheduled time of the next sample in microseconds */
+    uint32_t next_us;
+
+    /*! Set once the first sample was read */
+    uint8_t started;
+
+    /*! Number of samples read */
+    uint32_t n_samples;
+
+    /*! Number of sampling periods skipped because a tick came too late */
+    uint32_t n_missed;
+
+    /*! Smallest deviation from the scheduled time in microseconds */
+    uint32_t jitter_min_us;
+
+    /*! Largest deviation from the scheduled time in microseconds */
+    uint32_t jitter_max_us;
+
+    /*! Sum of the deviations from the scheduled time in microseconds */
+    uint64_t jitter_sum_us;
+};
+
+/*!  @name Structure to define an OIS sample of the acquisition ring */
+struct bmi2_ois_sample
+{
+    /*! Accelerometer data axes */
+    struct bmi2_ois_sens_axes_data acc_data;
+
+    /*! Gyroscope data axes */
+    struct bmi2_ois_sens_axes_data gyr_data;
+
+    /*! Time of the sampling tick in microseconds */
+    uint32_t time_us;
+
+    /*! Sequence number, gaps show samples dropped on a full ring */
+    uint32_t seq;
+};
+
+/*!  @name Structure to define the OIS acquisition service */
+struct bmi2_ois_acq
+{
+    /*! OIS device sampled */
+    struct bmi2_ois_dev *ois_dev;
+
+    /*! Gyroscope cross sensitivity */
+    int16_t gyr_cross_sens_zx;
+
+    /*! Sampling timing and jitter statistics */
+    struct bmi2_ois_timing timing;
+
+    /*! Samples not consumed yet */
+    struct bmi2_ois_sample ring[BMI2_OIS_ACQ_RING_SIZE];
+
+    /*! Ring write index, only updated by the sampling tick */
+    volatile uint16_t head;
+
+    /*! Ring read index, only updated by the consumer */
+    volatile uint16_t tail;
+
+    /*! Sequence number of the next sample */
+    uint32_t seq;
+
+    /*! Number of samples dropped because the ring was full */
+    uint32_t n_overrun;
+
+    /*! Number of failed OIS reads */
+    uint32_t n_read_fail;
+
+    /*! Histogram of the time from sampling to consumption */
+    uint32_t latency_hist[BMI2_OIS_ACQ_HIST_BINS];
+
+    /*! Largest time from sampling to consumption in microseconds */
+    uint32_t latency_max_us;
+};
+
 /***************************************************************************/
 
 /*!     BMI2 OIS User Interface function prototypes
@@ -380,6 +491,148 @@ int8_t bmi2_ois_read_data(const uint8_t *sens_sel,
                           struct bmi2_ois_dev *ois_dev,
                           int16_t gyr_cross_sens_zx);
 
+/*!
+ * \ingroup bmi2_oisApiRead
+ * \page bmi2_ois_api_bmi2_ois_read_acc_gyr bmi2_ois_read_acc_gyr
+ * \code
+ * int8_t bmi2_ois_read_acc_gyr(struct bmi2_ois_dev *ois_dev, int16_t gyr_cross_sens_zx);
+ * \endcode
+ *  @details This API reads accelerometer and gyroscope data through OIS
+ * interface in a single burst, as the data registers are contiguous, and
+ * compensates the gyroscope cross-axis sensitivity.
+ *
+ * @param[in, out] ois_dev      : Structure instance of bmi2_ois_dev.
+ * @param[in] gyr_cross_sens_zx : Store the gyroscope cross sensitivity values taken from the bmi2xy
+ *                                (refer bmi2_ois example).
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi2_ois_read_acc_gyr(struct bmi2_ois_dev *ois_dev, int16_t gyr_cross_sens_zx);
+
+/*!
+ * \ingroup bmi2_oisApiRead
+ * \page bmi2_ois_api_bmi2_ois_timing_init bmi2_ois_timing_init
+ * \code
+ * int8_t bmi2_ois_timing_init(uint32_t period_us, struct bmi2_ois_timing *timing);
+ * \endcode
+ *  @details This API initializes timer driven OIS sampling and clears its
+ * jitter statistics.
+ *
+ * @param[in] period_us : Sampling period in microseconds, e.g. 156 for 6.4kHz.
+ * @param[out] timing   : Structure instance of bmi2_ois_timing.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi2_ois_timing_init(uint32_t period_us, struct bmi2_ois_timing *timing);
+
+/*!
+ * \ingroup bmi2_oisApiRead
+ * \page bmi2_ois_api_bmi2_ois_read_timed bmi2_ois_read_timed
+ * \code
+ * int8_t bmi2_ois_read_timed(uint32_t now_us,
+ *                            struct bmi2_ois_timing *timing,
+ *                            struct bmi2_ois_dev *ois_dev,
+ *                            int16_t gyr_cross_sens_zx);
+ * \endcode
+ *  @details This API is to be called from the sampling timer tick. It reads
+ * accelerometer and gyroscope data in a single burst, records the deviation
+ * of the tick from its scheduled time and schedules the next sample on the
+ * sampling grid. Ticks later than a full period count the skipped periods
+ * in timing->n_missed.
+ *
+ * @param[in] now_us            : Time of the tick in microseconds. It may wrap around.
+ * @param[in, out] timing       : Structure instance of bmi2_ois_timing.
+ * @param[in, out] ois_dev      : Structure instance of bmi2_ois_dev.
+ * @param[in] gyr_cross_sens_zx : Store the gyroscope cross sensitivity values taken from the bmi2xy
+ *                                (refer bmi2_ois example).
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi2_ois_read_timed(uint32_t now_us,
+                           struct bmi2_ois_timing *timing,
+                           struct bmi2_ois_dev *ois_dev,
+                           int16_t gyr_cross_sens_zx);
+
+/**
+ * \ingroup bmi2_ois
+ * \defgroup bmi2_oisApiAcq Acquisition
+ * @brief Periodic OIS sampling into a ring buffer consumed by a control loop
+ */
+
+/*!
+ * \ingroup bmi2_oisApiAcq
+ * \page bmi2_ois_api_bmi2_ois_acq_init bmi2_ois_acq_init
+ * \code
+ * int8_t bmi2_ois_acq_init(uint32_t period_us,
+ *                          int16_t gyr_cross_sens_zx,
+ *                          struct bmi2_ois_dev *ois_dev,
+ *                          struct bmi2_ois_acq *acq);
+ * \endcode
+ *  @details This API initializes the OIS acquisition service. The sampling
+ * timer is then to call bmi2_ois_acq_tick every period_us and the control
+ * loop to call bmi2_ois_acq_pop. The ring is lock-free for one producer and
+ * one consumer.
+ *
+ * @param[in] period_us         : Sampling period in microseconds.
+ * @param[in] gyr_cross_sens_zx : Store the gyroscope cross sensitivity values taken from the bmi2xy
+ *                                (refer bmi2_ois example).
+ * @param[in] ois_dev           : Structure instance of bmi2_ois_dev.
+ * @param[out] acq              : Structure instance of bmi2_ois_acq.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi2_ois_acq_init(uint32_t period_us,
+                         int16_t gyr_cross_sens_zx,
+                         struct bmi2_ois_dev *ois_dev,
+                         struct bmi2_ois_acq *acq);
+
+/*!
+ * \ingroup bmi2_oisApiAcq
+ * \page bmi2_ois_api_bmi2_ois_acq_tick bmi2_ois_acq_tick
+ * \code
+ * int8_t bmi2_ois_acq_tick(uint32_t now_us, struct bmi2_ois_acq *acq);
+ * \endcode
+ *  @details This API is to be called from the sampling timer interrupt. It
+ * reads accelerometer and gyroscope data and appends the sample to the ring.
+ * The sample is dropped and counted in acq->n_overrun if the ring is full.
+ *
+ * @param[in] now_us   : Time of the tick in microseconds. It may wrap around.
+ * @param[in, out] acq : Structure instance of bmi2_ois_acq.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t bmi2_ois_acq_tick(uint32_t now_us, struct bmi2_ois_acq *acq);
+
+/*!
+ * \ingroup bmi2_oisApiAcq
+ * \page bmi2_ois_api_bmi2_ois_acq_pop bmi2_ois_acq_pop
+ * \code
+ * int8_t bmi2_ois_acq_pop(uint32_t now_us, struct bmi2_ois_sample *sample, struct bmi2_ois_acq *acq);
+ * \endcode
+ *  @details This API takes the oldest sample from the ring and records the
+ * time from sampling to consumption in the latency histogram.
+ *
+ * @param[in] now_us   : Current time in microseconds. It may wrap around.
+ * @param[out] sample  : Oldest sample of the ring.
+ * @param[in, out] acq : Structure instance of bmi2_ois_acq.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval BMI2_OIS_W_NO_SAMPLE -> The ring is empty
+ * @retval < 0 -> Fail
+ */
+int8_t bmi2_ois_acq_pop(uint32_t now_us, struct bmi2_ois_sample *sample, struct bmi2_ois_acq *acq);
+
 #ifdef __cplusplus
 }
 #endif /* End of CPP guard */
@@ -270,6 +270,9 @@ void bmi2_error_codes_print_result(int8_t rslt)
         case BMI2_W_PARTIAL_READ:
             printf("Warning [%d] : FIFO partial read\r\n", rslt);
             break;
+        case BMI2_W_STEP_PENDING:
+            printf("Warning [%d] : Self-test step pending\r\n", rslt);
+            break;
         case BMI2_E_NULL_PTR:
             printf(
                 "Error [%d] : Null pointer error. It occurs when the user tries to assign value (not address) to a pointer," " which has been initialized to NULL.\r\n",
@@ -0,0 +1,222 @@
+/**\
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include <stdio.h>
+#include "bmi270.h"
+#include "common.h"
+#include "coines.h"
+#include "mcu_app30_interface.h"
+
+/******************************************************************************/
+/*!                  Macros                                                   */
+
+/*! Buffer size allocated to store raw FIFO data */
+#define BMI2_FIFO_RAW_DATA_BUFFER_SIZE  UINT16_C(1200)
+
+/*! Number of accel frames to be extracted from FIFO */
+#define BMI2_FIFO_ACCEL_FRAME_COUNT     UINT8_C(100)
+
+/*! Setting a watermark level in FIFO, 50 accel frames of 7 bytes */
+#define BMI2_FIFO_WATERMARK_LEVEL       UINT16_C(350)
+
+/*! Macro to read sensortime byte in FIFO */
+#define SENSORTIME_OVERHEAD_BYTE        UINT8_C(250)
+
+/*! Accel frame period in microseconds at 100 Hz */
+#define ACCEL_PERIOD_US                 UINT32_C(10000)
+
+/*! Interrupt events taken per loop */
+#define EVENT_BATCH                     UINT8_C(8)
+
+/******************************************************************************/
+/*!           Static Function Declaration                                     */
+
+/*!
+ *  @brief This internal API is used to set configurations for accel.
+ *  @param[in] dev       : Structure instance of bmi2_dev.
+ *  @return Status of execution.
+ */
+static int8_t set_accel_config(struct bmi2_dev *dev);
+
+/******************************************************************************/
+/*!            Functions                                                      */
+
+/* This function starts the execution of program. */
+int main(void)
+{
+    /* Status of api are returned to this variable. */
+    int8_t rslt;
+
+    uint16_t index;
+    uint16_t fifo_length = 0;
+    uint16_t accel_frame_length;
+    uint16_t int_status = 0;
+    uint32_t n_events;
+    uint32_t idx;
+    uint8_t try = 1;
+
+    /* Number of bytes of FIFO data
+     * NOTE : Dummy byte (for SPI Interface) required for FIFO data read must be given as part of array size
+     */
+    uint8_t fifo_data[BMI2_FIFO_RAW_DATA_BUFFER_SIZE + SENSORTIME_OVERHEAD_BYTE];
+
+    struct bmi2_dev bmi2_dev;
+    struct bmi2_sens_axes_data fifo_accel_data[BMI2_FIFO_ACCEL_FRAME_COUNT] = { { 0 } };
+    struct bmi2_fifo_frame fifoframe = { 0 };
+    struct bmi2_int_pin_config pin_config = { 0 };
+    struct event_queue_event events[EVENT_BATCH];
+    struct event_queue_stats event_stats;
+    uint8_t sensor_sel = BMI2_ACCEL;
+
+    /* Interface reference is given as a parameter
+     * For I2C : BMI2_I2C_INTF
+     * For SPI : BMI2_SPI_INTF
+     */
+    rslt = bmi2_interface_init(&bmi2_dev, BMI2_I2C_INTF);
+    bmi2_error_codes_print_result(rslt);
+
+    rslt = bmi270_init(&bmi2_dev);
+    bmi2_error_codes_print_result(rslt);
+
+    rslt = bmi2_get_int_pin_config(&pin_config, &bmi2_dev);
+    bmi2_error_codes_print_result(rslt);
+
+    rslt = set_accel_config(&bmi2_dev);
+    bmi2_error_codes_print_result(rslt);
+
+    rslt = bmi270_sensor_enable(&sensor_sel, 1, &bmi2_dev);
+    bmi2_error_codes_print_result(rslt);
+
+    /* Before setting FIFO, disable the advance power save mode. */
+    rslt = bmi2_set_adv_power_save(BMI2_DISABLE, &bmi2_dev);
+    bmi2_error_codes_print_result(rslt);
+
+    rslt = bmi2_set_fifo_config(BMI2_FIFO_ALL_EN, BMI2_DISABLE, &bmi2_dev);
+    bmi2_error_codes_print_result(rslt);
+
+    fifoframe.data = fifo_data;
+
+    /* Header mode with sensortime, both enabled by default */
+    rslt = bmi2_set_fifo_config(BMI2_FIFO_ACC_EN, BMI2_ENABLE, &bmi2_dev);
+    bmi2_error_codes_print_result(rslt);
+
+    fifoframe.data_int_map = BMI2_FWM_INT;
+    rslt = bmi2_map_data_int(fifoframe.data_int_map, BMI2_INT1, &bmi2_dev);
+    bmi2_error_codes_print_result(rslt);
+
+    pin_config.pin_type = BMI2_INT1;
+    pin_config.pin_cfg[0].input_en = BMI2_INT_INPUT_DISABLE;
+    pin_config.pin_cfg[0].lvl = BMI2_INT_ACTIVE_LOW;
+    pin_config.pin_cfg[0].od = BMI2_INT_PUSH_PULL;
+    pin_config.pin_cfg[0].output_en = BMI2_INT_OUTPUT_ENABLE;
+    pin_config.int_latch = BMI2_INT_NON_LATCH;
+    rslt = bmi2_set_int_pin_config(&pin_config, &bmi2_dev);
+    bmi2_error_codes_print_result(rslt);
+
+    fifoframe.wm_lvl = BMI2_FIFO_WATERMARK_LEVEL;
+    rslt = bmi2_set_fifo_wm(fifoframe.wm_lvl, &bmi2_dev);
+    bmi2_error_codes_print_result(rslt);
+
+    /* Each watermark edge is queued with its time, none is lost while a FIFO read is in progress */
+    coines_attach_interrupt_queued(COINES_MINI_SHUTTLE_PIN_1_6, COINES_PIN_INTERRUPT_FALLING_EDGE);
+
+    while (try <= 10)
+    {
+        n_events = coines_get_interrupt_events(events, EVENT_BATCH);
+
+        for (idx = 0; idx < n_events; idx++)
+        {
+            if (events[idx].flags & EVENT_QUEUE_FLAG_OVERFLOW)
+            {
+                printf("\nInterrupt events were lost before this one\n");
+            }
+
+            rslt = bmi2_get_int_status(&int_status, &bmi2_dev);
+            bmi2_error_codes_print_result(rslt);
+
+            if ((rslt != BMI2_OK) || !(int_status & BMI2_FWM_INT_STATUS_MASK))
+            {
+                continue;
+            }
+
+            rslt = bmi2_get_fifo_length(&fifo_length, &bmi2_dev);
+            bmi2_error_codes_print_result(rslt);
+
+            fifoframe.length = fifo_length + SENSORTIME_OVERHEAD_BYTE + bmi2_dev.dummy_byte;
+            rslt = bmi2_read_fifo_data(&fifoframe, &bmi2_dev);
+            bmi2_error_codes_print_result(rslt);
+
+            accel_frame_length = BMI2_FIFO_ACCEL_FRAME_COUNT;
+            rslt = bmi2_extract_accel(fifo_accel_data, &accel_frame_length, &fifoframe, &bmi2_dev);
+            bmi2_error_codes_print_result(rslt);
+
+            /*
+             * The edge is raised when the watermark frame is written, the frame number
+             * BMI2_FIFO_WATERMARK_LEVEL / 7 - 1 of this read. Frames before and after it
+             * are one ODR period apart, which places every frame on the board clock.
+             */
+            printf("\nIteration %d, edge at %lu us, sensortime %.4lf s, %d frames\n",
+                   try,
+                   (unsigned long)events[idx].timestamp_us,
+                   (fifoframe.sensor_time * BMI2_SENSORTIME_RESOLUTION),
+                   accel_frame_length);
+
+            for (index = 0; index < accel_frame_length; index++)
+            {
+                printf("%lu us ACCEL[%d] X : %d\t Y : %d\t Z : %d\n",
+                       (unsigned long)(events[idx].timestamp_us +
+                                       ((int32_t)index - (BMI2_FIFO_WATERMARK_LEVEL / 7 - 1)) *
+                                       (int32_t)ACCEL_PERIOD_US),
+                       index,
+                       fifo_accel_data[index].x,
+                       fifo_accel_data[index].y,
+                       fifo_accel_data[index].z);
+            }
+
+            try++;
+        }
+    }
+
+    coines_detach_interrupt(COINES_MINI_SHUTTLE_PIN_1_6);
+
+    coines_get_interrupt_event_stats(&event_stats);
+    printf("\nInterrupt events %lu, lost %lu, most queued %lu\n",
+           (unsigned long)event_stats.n_events,
+           (unsigned long)event_stats.n_overflows,
+           (unsigned long)event_stats.max_used);
+
+    bmi2_coines_deinit();
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API is used to set configurations for accel.
+ */
+static int8_t set_accel_config(struct bmi2_dev *dev)
+{
+    int8_t rslt;
+    struct bmi2_sens_config config;
+
+    config.type = BMI2_ACCEL;
+
+    rslt = bmi270_get_sensor_config(&config, 1, dev);
+    bmi2_error_codes_print_result(rslt);
+
+    if (rslt == BMI2_OK)
+    {
+        /* 100 Hz, matching ACCEL_PERIOD_US */
+        config.cfg.acc.odr = BMI2_ACC_ODR_100HZ;
+        config.cfg.acc.range = BMI2_ACC_RANGE_2G;
+        config.cfg.acc.bwp = BMI2_ACC_NORMAL_AVG4;
+        config.cfg.acc.filter_perf = BMI2_PERF_OPT_MODE;
+
+        rslt = bmi270_set_sensor_config(&config, 1, dev);
+        bmi2_error_codes_print_result(rslt);
+    }
+
+    return rslt;
+}
@@ -0,0 +1,140 @@
+/**\
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include <stdio.h>
+#include "bmi270.h"
+#include "bmi2_fixture.h"
+#include "common.h"
+
+/******************************************************************************/
+/*!                  Macros                                                   */
+
+/*! Number of sensors of the fixture */
+#define N_DUTS  UINT8_C(3)
+
+/******************************************************************************/
+/*!           Static Variable Definition                                      */
+
+/*! Sensors of the fixture */
+static struct bmi2_dev duts[N_DUTS];
+
+/*! Bus and address of each sensor: primary and secondary address on I2C bus 0,
+ *  primary address on I2C bus 1
+ */
+static struct coines_intf_config dut_intf[N_DUTS] = {
+    { BMI2_I2C_PRIM_ADDR, COINES_I2C_BUS_0 }, { BMI2_I2C_SEC_ADDR, COINES_I2C_BUS_0 },
+    { BMI2_I2C_PRIM_ADDR, COINES_I2C_BUS_1 }
+};
+
+/*! Production fixture */
+static struct bmi2_fixture fixture;
+
+/******************************************************************************/
+/*!           Static Function Declaration                                     */
+
+/*!
+ *  @brief This internal API reads the time of the fixture.
+ *
+ *  @return Time in microseconds.
+ */
+static uint32_t fixture_time_us(void);
+
+/******************************************************************************/
+/*!            Functions                                                      */
+
+/* This function starts the execution of program. */
+int main(void)
+{
+    /* Status of api are returned to this variable. */
+    int8_t rslt;
+
+    uint8_t loop;
+    uint8_t test;
+    uint32_t next_us;
+
+    /* Names of the tests, indexed by test */
+    const char *test_name[BMI2_FIXTURE_N_TESTS] = { "Accel self-test", "Gyro self-test", "CRT" };
+
+    /* The first sensor sets up the board and I2C bus 0. */
+    rslt = bmi2_interface_init(&duts[0], BMI2_I2C_INTF);
+    bmi2_error_codes_print_result(rslt);
+
+    (void)coines_config_i2c_bus(COINES_I2C_BUS_1, COINES_I2C_STANDARD_MODE);
+
+    rslt = bmi2_fixture_init(fixture_time_us, &fixture);
+    bmi2_error_codes_print_result(rslt);
+
+    for (loop = 0; (loop < N_DUTS) && (rslt == BMI2_OK); loop++)
+    {
+        /* Each sensor has its own device structure and bus address. */
+        if (loop > 0)
+        {
+            duts[loop] = duts[0];
+        }
+
+        duts[loop].intf_ptr = &dut_intf[loop];
+
+        rslt = bmi270_init(&duts[loop]);
+        bmi2_error_codes_print_result(rslt);
+
+        if (rslt == BMI2_OK)
+        {
+            /* The sensors of I2C bus 0 share their bus steps. */
+            rslt = bmi2_fixture_add(dut_intf[loop].bus, BMI2_FIXTURE_ALL_TESTS, &duts[loop], &fixture);
+            bmi2_error_codes_print_result(rslt);
+        }
+    }
+
+    /* Do not move the fixture while doing CRT. If so, it will throw an abort error. */
+    while (rslt == BMI2_OK)
+    {
+        rslt = bmi2_fixture_poll(fixture_time_us(), &next_us, &fixture);
+        if (rslt == BMI2_W_STEP_PENDING)
+        {
+            /* Sleep until the next step is due, other work could be done here. */
+            while ((int32_t)(fixture_time_us() - next_us) < 0)
+            {
+            }
+
+            rslt = BMI2_OK;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    bmi2_error_codes_print_result(rslt);
+
+    printf("\nSensor  Test              Result  Duration(ms)  Bus(ms)  Steps\n");
+    for (loop = 0; loop < fixture.n_duts; loop++)
+    {
+        for (test = 0; test < BMI2_FIXTURE_N_TESTS; test++)
+        {
+            printf("%6d  %-16s  %6d  %12.1f  %7.1f  %5u\n",
+                   loop,
+                   test_name[test],
+                   fixture.dut[loop].result[test].rslt,
+                   fixture.dut[loop].result[test].duration_us / 1000.0,
+                   fixture.dut[loop].result[test].bus_us / 1000.0,
+                   fixture.dut[loop].result[test].n_steps);
+        }
+    }
+
+    printf("\nAll tests done in %lu ms\n", (long unsigned int)(fixture.duration_us / 1000));
+
+    bmi2_coines_deinit();
+
+    return rslt;
+}
+
+/*!
+ *  @brief This internal API reads the time of the fixture.
+ */
+static uint32_t fixture_time_us(void)
+{
+    return (uint32_t)coines_get_micro_sec();
+}
@@ -0,0 +1,309 @@
+/**\
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "bmi270.h"
+#include "common.h"
+#include "coines.h"
+#include "flash_log.h"
+
+/******************************************************************************/
+/*!                Macro definition                                           */
+
+/*! Macros to select the sensors                   */
+#define ACCEL           UINT8_C(0x00)
+#define GYRO            UINT8_C(0x01)
+
+/*! Record types of the binary log */
+#define REC_ACCEL       UINT8_C(1)
+#define REC_GYRO        UINT8_C(2)
+
+/*! Accel and gyro samples logged in each format */
+#define LOG_LEN         UINT32_C(4000)
+
+/*! Log files */
+#define TEXT_FILE       "bench.txt"
+#define BINARY_FILE     "bench.bin"
+
+/******************************************************************************/
+/*!           Static Variable Definition                                      */
+
+/*! Writer, two blocks of FLASH_LOG_BLOCK_SIZE */
+static struct flash_log log_writer;
+
+/*! Read back buffer, one block */
+static uint8_t block_buf[FLASH_LOG_BLOCK_SIZE];
+
+/*! Sensortime extended to 32 bits: the upper bits, the previous 24 bit value */
+static uint32_t sens_time_high;
+static uint32_t sens_time_prev;
+
+/******************************************************************************/
+/*!           Static Function Declaration                                     */
+
+/*!
+ *  @brief This internal API is used to set configurations for accel and gyro.
+ *  @param[in] bmi       : Structure instance of bmi2_dev.
+ *  @return Status of execution.
+ */
+static int8_t set_accel_gyro_config(struct bmi2_dev *bmi);
+
+/*!
+ *  @brief This internal API waits for the next accel and gyro sample.
+ *  @param[out] data     : Sample.
+ *  @param[in] bmi       : Structure instance of bmi2_dev.
+ *  @return Status of execution.
+ */
+static int8_t get_sample(struct bmi2_sens_data *data, struct bmi2_dev *bmi);
+
+/*!
+ *  @brief Extends the 24 bit sensortime to 32 bits, the non decreasing time of
+ *  the binary log; it wraps every 655 s, the extended time after 46 hours.
+ *  @param[in] sens_time : Sensortime of a sample, called for every sample.
+ *  @return Extended sensortime.
+ */
+static uint32_t extend_sensortime(uint32_t sens_time);
+
+/*!
+ *  @brief Writes a block of the binary log through the flogfs file glue.
+ */
+static int8_t write_block(const uint8_t *data, uint16_t len, void *intf_ptr);
+
+/*!
+ *  @brief Counts the records read back from the binary log.
+ */
+static void count_record(uint8_t type, uint32_t time, const uint8_t *data, uint8_t len, void *cb_ptr);
+
+/******************************************************************************/
+/*!            Functions                                                      */
+
+/* This function starts the execution of program. */
+int main(void)
+{
+    int8_t rslt;
+    struct bmi2_dev bmi;
+    struct bmi2_sens_data sensor_data = { { 0 } };
+    uint8_t sensor_list[2] = { BMI2_ACCEL, BMI2_GYRO };
+    struct flash_log_scan_stats scan_stats;
+    uint32_t n_records[3] = { 0 };
+    uint32_t n_scanned = 0;
+    uint8_t rec[6];
+    uint32_t time;
+    char line[64];
+    uint64_t start_us;
+    uint64_t write_us = 0;
+    uint64_t put_us = 0;
+    uint64_t process_us = 0;
+    uint32_t text_bytes = 0;
+    uint32_t idx;
+    int len;
+    int fd;
+
+    rslt = bmi2_interface_init(&bmi, BMI2_I2C_INTF);
+    bmi2_error_codes_print_result(rslt);
+
+    rslt = bmi270_init(&bmi);
+    bmi2_error_codes_print_result(rslt);
+
+    rslt = set_accel_gyro_config(&bmi);
+    bmi2_error_codes_print_result(rslt);
+
+    rslt = bmi2_sensor_enable(sensor_list, 2, &bmi);
+    bmi2_error_codes_print_result(rslt);
+
+    (void)unlink(TEXT_FILE);
+    (void)unlink(BINARY_FILE);
+
+    /* One text line per sample, each line one flash write */
+    fd = open(TEXT_FILE, O_WRONLY | O_CREAT);
+    for (idx = 0; (idx < LOG_LEN) && (fd >= 0) && (rslt == BMI2_OK); idx++)
+    {
+        rslt = get_sample(&sensor_data, &bmi);
+
+        len = snprintf(line, sizeof(line), "%lu,%d,%d,%d,%d,%d,%d\n",
+                       (unsigned long)sensor_data.sens_time,
+                       sensor_data.acc.x, sensor_data.acc.y, sensor_data.acc.z,
+                       sensor_data.gyr.x, sensor_data.gyr.y, sensor_data.gyr.z);
+
+        start_us = coines_get_micro_sec();
+        (void)write(fd, line, (size_t)len);
+        write_us += coines_get_micro_sec() - start_us;
+        text_bytes += (uint32_t)len;
+    }
+
+    if (fd >= 0)
+    {
+        (void)close(fd);
+    }
+
+    /* Binary records batched into blocks, the flash is written from the main loop */
+    fd = open(BINARY_FILE, O_WRONLY | O_CREAT);
+    (void)flash_log_init(write_block, &fd, &log_writer);
+    for (idx = 0; (idx < LOG_LEN) && (fd >= 0) && (rslt == BMI2_OK); idx++)
+    {
+        rslt = get_sample(&sensor_data, &bmi);
+        time = extend_sensortime(sensor_data.sens_time);
+
+        start_us = coines_get_micro_sec();
+        rec[0] = (uint8_t)sensor_data.acc.x;
+        rec[1] = (uint8_t)(sensor_data.acc.x >> 8);
+        rec[2] = (uint8_t)sensor_data.acc.y;
+        rec[3] = (uint8_t)(sensor_data.acc.y >> 8);
+        rec[4] = (uint8_t)sensor_data.acc.z;
+        rec[5] = (uint8_t)(sensor_data.acc.z >> 8);
+        (void)flash_log_put(REC_ACCEL, time, rec, sizeof(rec), &log_writer);
+
+        rec[0] = (uint8_t)sensor_data.gyr.x;
+        rec[1] = (uint8_t)(sensor_data.gyr.x >> 8);
+        rec[2] = (uint8_t)sensor_data.gyr.y;
+        rec[3] = (uint8_t)(sensor_data.gyr.y >> 8);
+        rec[4] = (uint8_t)sensor_data.gyr.z;
+        rec[5] = (uint8_t)(sensor_data.gyr.z >> 8);
+        (void)flash_log_put(REC_GYRO, time, rec, sizeof(rec), &log_writer);
+        put_us += coines_get_micro_sec() - start_us;
+
+        start_us = coines_get_micro_sec();
+        (void)flash_log_process(&log_writer);
+        process_us += coines_get_micro_sec() - start_us;
+    }
+
+    if (fd >= 0)
+    {
+        /* The index lets a host tool seek to a time range, see tools/flash_log */
+        (void)flash_log_finish(&log_writer);
+        (void)close(fd);
+    }
+
+    printf("\nText   : %lu samples, %lu bytes, %lu flash writes, %lu us writing\n",
+           (unsigned long)LOG_LEN,
+           (unsigned long)text_bytes,
+           (unsigned long)LOG_LEN,
+           (unsigned long)write_us);
+    printf("Binary : %lu records, %lu dropped, %lu blocks of %d bytes, %lu us in put, %lu us in process\n",
+           (unsigned long)log_writer.stats.n_records,
+           (unsigned long)log_writer.stats.n_dropped,
+           (unsigned long)log_writer.stats.n_blocks,
+           FLASH_LOG_BLOCK_SIZE,
+           (unsigned long)put_us,
+           (unsigned long)process_us);
+
+    /* Read back block by block, each block checks on its own */
+    fd = open(BINARY_FILE, O_RDONLY);
+    while ((fd >= 0) && (read(fd, block_buf, sizeof(block_buf)) == (int)sizeof(block_buf)))
+    {
+        (void)flash_log_scan(block_buf, sizeof(block_buf), count_record, n_records, &scan_stats);
+        n_scanned += scan_stats.n_blocks;
+    }
+
+    if (fd >= 0)
+    {
+        (void)close(fd);
+    }
+
+    printf("Read back: %lu blocks, %lu accel and %lu gyro records\n",
+           (unsigned long)n_scanned,
+           (unsigned long)n_records[REC_ACCEL],
+           (unsigned long)n_records[REC_GYRO]);
+
+    bmi2_coines_deinit();
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API waits for the next accel and gyro sample.
+ */
+static int8_t get_sample(struct bmi2_sens_data *data, struct bmi2_dev *bmi)
+{
+    int8_t rslt;
+
+    do
+    {
+        rslt = bmi2_get_sensor_data(data, bmi);
+    } while ((rslt == BMI2_OK) &&
+             (((data->status & BMI2_DRDY_ACC) == 0) || ((data->status & BMI2_DRDY_GYR) == 0)));
+
+    return rslt;
+}
+
+/*!
+ * @brief Extends the 24 bit sensortime to 32 bits.
+ */
+static uint32_t extend_sensortime(uint32_t sens_time)
+{
+    /* The counter wrapped since the previous sample */
+    if (sens_time < sens_time_prev)
+    {
+        sens_time_high += UINT32_C(1) << 24;
+    }
+
+    sens_time_prev = sens_time;
+
+    return sens_time_high | sens_time;
+}
+
+/*!
+ * @brief Writes a block of the binary log through the flogfs file glue.
+ */
+static int8_t write_block(const uint8_t *data, uint16_t len, void *intf_ptr)
+{
+    int fd = *(int *)intf_ptr;
+
+    return (write(fd, data, len) == (int)len) ? 0 : -1;
+}
+
+/*!
+ * @brief Counts the records read back from the binary log.
+ */
+static void count_record(uint8_t type, uint32_t time, const uint8_t *data, uint8_t len, void *cb_ptr)
+{
+    uint32_t *n_records = (uint32_t *)cb_ptr;
+
+    (void)time;
+    (void)data;
+    (void)len;
+
+    if (type <= REC_GYRO)
+    {
+        n_records[type]++;
+    }
+}
+
+/*!
+ * @brief This internal API is used to set configurations for accel and gyro.
+ */
+static int8_t set_accel_gyro_config(struct bmi2_dev *bmi)
+{
+    int8_t rslt;
+    struct bmi2_sens_config config[2];
+
+    config[ACCEL].type = BMI2_ACCEL;
+    config[GYRO].type = BMI2_GYRO;
+
+    rslt = bmi2_get_sensor_config(config, 2, bmi);
+    bmi2_error_codes_print_result(rslt);
+
+    if (rslt == BMI2_OK)
+    {
+        config[ACCEL].cfg.acc.odr = BMI2_ACC_ODR_200HZ;
+        config[ACCEL].cfg.acc.range = BMI2_ACC_RANGE_2G;
+        config[ACCEL].cfg.acc.bwp = BMI2_ACC_NORMAL_AVG4;
+        config[ACCEL].cfg.acc.filter_perf = BMI2_PERF_OPT_MODE;
+
+        config[GYRO].cfg.gyr.odr = BMI2_GYR_ODR_200HZ;
+        config[GYRO].cfg.gyr.range = BMI2_GYR_RANGE_2000;
+        config[GYRO].cfg.gyr.bwp = BMI2_GYR_NORMAL_MODE;
+        config[GYRO].cfg.gyr.noise_perf = BMI2_POWER_OPT_MODE;
+        config[GYRO].cfg.gyr.filter_perf = BMI2_PERF_OPT_MODE;
+
+        rslt = bmi2_set_sensor_config(config, 2, bmi);
+        bmi2_error_codes_print_result(rslt);
+    }
+
+    return rslt;
+}
@@ -0,0 +1,251 @@
+/**\
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include <stdio.h>
+#include "bmi270.h"
+#include "bmi2_ois.h"
+#include "common.h"
+
+/******************************************************************************/
+/*!                Macro definition                                           */
+
+/*! OIS sampling period in microseconds (6.4kHz) */
+#define OIS_PERIOD_US         UINT32_C(156)
+
+/*! Control loop period in microseconds */
+#define CONTROL_PERIOD_US     UINT32_C(1000)
+
+/*! Number of control loop iterations */
+#define CONTROL_LOOP_COUNT    UINT16_C(2000)
+
+/******************************************************************************/
+/*!                Static variable definition                                 */
+
+/*! OIS acquisition service shared by the sampling timer and the control loop */
+static struct bmi2_ois_acq ois_acq;
+
+/******************************************************************************/
+/*!           Static Function Declaration                                     */
+
+/*!
+ *  @brief This internal API is used to set configurations for accel and gyro.
+ *
+ *  @param[in] bmi       : Structure instance of bmi2_dev.
+ *
+ *  @return Status of execution.
+ */
+static int8_t set_accel_gyro_config(struct bmi2_dev *bmi);
+
+#if !defined(PC)
+
+/*!
+ *  @brief OIS sampling timer handler.
+ *
+ *  @param[in] event_type : Timer event.
+ *  @param[in] p_context  : Timer context.
+ */
+static void ois_timer_handler(uint32_t event_type, void *p_context);
+#endif
+
+/******************************************************************************/
+/*!            Functions                                        */
+
+/* This function starts the execution of program. */
+int main(void)
+{
+    /* Status of api are returned to this variable. */
+    int8_t rslt;
+
+    /* Assign accel and gyro sensor to variable. */
+    uint8_t sensor_list[2] = { BMI2_ACCEL, BMI2_GYRO };
+
+    /* Sensor initialization configuration. */
+    struct bmi2_dev bmi;
+
+    /* OIS interface configuration. */
+    struct bmi2_ois_dev ois_dev = { 0 };
+
+    /* Sample consumed by the control loop. */
+    struct bmi2_ois_sample sample;
+
+    uint16_t loop;
+    uint8_t bin;
+    uint32_t n_consumed = 0;
+    uint32_t now_us;
+
+#if defined(PC)
+    uint32_t next_tick_us;
+    uint32_t next_control_us;
+#endif
+
+    /* Interface reference is given as a parameter
+     * For I2C : BMI2_I2C_INTF
+     * For SPI : BMI2_SPI_INTF
+     */
+    rslt = bmi2_interface_init(&bmi, BMI2_SPI_INTF);
+    bmi2_error_codes_print_result(rslt);
+
+    rslt = bmi270_init(&bmi);
+    bmi2_error_codes_print_result(rslt);
+
+    if (rslt == BMI2_OK)
+    {
+        rslt = set_accel_gyro_config(&bmi);
+        bmi2_error_codes_print_result(rslt);
+    }
+
+    if (rslt == BMI2_OK)
+    {
+        rslt = bmi2_sensor_enable(sensor_list, 2, &bmi);
+        bmi2_error_codes_print_result(rslt);
+    }
+
+    if (rslt == BMI2_OK)
+    {
+        rslt = bmi2_set_ois_interface(BMI2_ENABLE, &bmi);
+        bmi2_error_codes_print_result(rslt);
+    }
+
+    if (rslt == BMI2_OK)
+    {
+        rslt = bmi2_ois_interface_init(&ois_dev);
+        bmi2_error_codes_print_result(rslt);
+    }
+
+    if (rslt == BMI2_OK)
+    {
+        ois_dev.acc_en = BMI2_OIS_ENABLE;
+        ois_dev.gyr_en = BMI2_OIS_ENABLE;
+        rslt = bmi2_ois_set_config(&ois_dev);
+    }
+
+    if (rslt == BMI2_OK)
+    {
+        rslt = bmi2_ois_acq_init(OIS_PERIOD_US, bmi.gyr_cross_sens_zx, &ois_dev, &ois_acq);
+    }
+
+#if !defined(PC)
+    if (rslt == BMI2_OK)
+    {
+        /* OIS samples are taken from the hardware timer interrupt */
+        if ((coines_timer_config(COINES_TIMER_INSTANCE_1, (void *)ois_timer_handler) != COINES_SUCCESS) ||
+            (coines_timer_start(COINES_TIMER_INSTANCE_1, OIS_PERIOD_US) != COINES_SUCCESS))
+        {
+            rslt = BMI2_E_COM_FAIL;
+        }
+    }
+#else
+    next_tick_us = (uint32_t)coines_get_micro_sec();
+    next_control_us = next_tick_us + CONTROL_PERIOD_US;
+#endif
+
+    for (loop = 0; (loop < CONTROL_LOOP_COUNT) && (rslt == BMI2_OK); loop++)
+    {
+#if defined(PC)
+
+        /* Host stand-in for the sampling timer: tick whenever due until the next control step */
+        while ((int32_t)((uint32_t)coines_get_micro_sec() - next_control_us) < 0)
+        {
+            now_us = (uint32_t)coines_get_micro_sec();
+            if ((int32_t)(now_us - next_tick_us) >= 0)
+            {
+                (void)bmi2_ois_acq_tick(now_us, &ois_acq);
+                next_tick_us += OIS_PERIOD_US;
+            }
+        }
+
+        next_control_us += CONTROL_PERIOD_US;
+#else
+        coines_delay_usec(CONTROL_PERIOD_US);
+#endif
+
+        /* Control loop: consume every sample taken since the last step */
+        now_us = (uint32_t)coines_get_micro_sec();
+        while (bmi2_ois_acq_pop(now_us, &sample, &ois_acq) == BMI2_OIS_OK)
+        {
+            n_consumed++;
+        }
+    }
+
+#if !defined(PC)
+    (void)coines_timer_stop(COINES_TIMER_INSTANCE_1);
+#endif
+
+    if (rslt == BMI2_OK)
+    {
+        printf("Samples taken %lu, consumed %lu, dropped %lu, read failures %lu\n",
+               (long unsigned int)ois_acq.timing.n_samples,
+               (long unsigned int)n_consumed,
+               (long unsigned int)ois_acq.n_overrun,
+               (long unsigned int)ois_acq.n_read_fail);
+        printf("Tick jitter (us): min %lu, max %lu, mean %lu, missed periods %lu\n",
+               (long unsigned int)ois_acq.timing.jitter_min_us,
+               (long unsigned int)ois_acq.timing.jitter_max_us,
+               (long unsigned int)(ois_acq.timing.jitter_sum_us / (ois_acq.timing.n_samples ? ois_acq.timing.n_samples : 1)),
+               (long unsigned int)ois_acq.timing.n_missed);
+        printf("Sample to consumer latency (max %lu us):\n", (long unsigned int)ois_acq.latency_max_us);
+        for (bin = 0; bin < BMI2_OIS_ACQ_HIST_BINS; bin++)
+        {
+            printf("  %s%4lu us : %lu\n",
+                   (bin == (BMI2_OIS_ACQ_HIST_BINS - 1)) ? ">=" : "< ",
+                   (long unsigned int)((bin + (bin != (BMI2_OIS_ACQ_HIST_BINS - 1))) * BMI2_OIS_ACQ_HIST_BIN_US),
+                   (long unsigned int)ois_acq.latency_hist[bin]);
+        }
+    }
+
+    bmi2_coines_deinit();
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API is used to set configurations for accel and gyro.
+ */
+static int8_t set_accel_gyro_config(struct bmi2_dev *bmi)
+{
+    /* Status of api are returned to this variable. */
+    int8_t rslt;
+
+    /* Structure to define accelerometer and gyro configuration. */
+    struct bmi2_sens_config config[2];
+
+    config[0].type = BMI2_ACCEL;
+    config[1].type = BMI2_GYRO;
+
+    rslt = bmi2_get_sensor_config(config, 2, bmi);
+    if (rslt == BMI2_OK)
+    {
+        /* OIS data is output at 6.4kHz independently of the configured ODR */
+        config[0].cfg.acc.odr = BMI2_ACC_ODR_1600HZ;
+        config[0].cfg.acc.range = BMI2_ACC_RANGE_4G;
+        config[0].cfg.acc.bwp = BMI2_ACC_NORMAL_AVG4;
+        config[0].cfg.acc.filter_perf = BMI2_PERF_OPT_MODE;
+
+        config[1].cfg.gyr.odr = BMI2_GYR_ODR_3200HZ;
+        config[1].cfg.gyr.range = BMI2_GYR_RANGE_2000;
+        config[1].cfg.gyr.bwp = BMI2_GYR_NORMAL_MODE;
+        config[1].cfg.gyr.noise_perf = BMI2_POWER_OPT_MODE;
+        config[1].cfg.gyr.filter_perf = BMI2_PERF_OPT_MODE;
+
+        rslt = bmi2_set_sensor_config(config, 2, bmi);
+    }
+
+    return rslt;
+}
+
+#if !defined(PC)
+
+/*!
+ *  @brief OIS sampling timer handler.
+ */
+static void ois_timer_handler(uint32_t event_type, void *p_context)
+{
+    (void)event_type;
+    (void)p_context;
+
+    (void)bmi2_ois_acq_tick((uint32_t)coines_get_micro_sec(), &ois_acq);
+}
+#endif
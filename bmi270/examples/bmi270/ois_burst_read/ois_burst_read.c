@@ -0,0 +1,254 @@
+/**\
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include <stdio.h>
+#include <string.h>
+#include "bmi2_ois.h"
+#include "coines.h"
+
+/******************************************************************************/
+/*!                Macro definition                                           */
+
+/*! OIS sampling period in microseconds (6.4kHz) */
+#define OIS_PERIOD_US         UINT32_C(156)
+
+/*! Number of OIS samples read per benchmark */
+#define OIS_SAMPLE_COUNT      UINT16_C(6400)
+
+/*! Simulated SPI clock in kHz */
+#define SIM_SPI_CLOCK_KHZ     UINT32_C(10000)
+
+/*! Simulated per transaction overhead (chip select, driver call) in nanoseconds */
+#define SIM_SPI_OVERHEAD_NS   UINT32_C(2000)
+
+/*! Gyroscope cross sensitivity used by the simulation */
+#define SIM_GYR_CROSS_SENS_ZX INT16_C(3)
+
+/******************************************************************************/
+/*!                Structure definition                                       */
+
+/*! Simulated OIS SPI interface */
+struct sim_ois_spi
+{
+    /*! OIS register map */
+    uint8_t regs[128];
+
+    /*! Number of transactions */
+    uint32_t n_transactions;
+
+    /*! Simulated bus time in nanoseconds */
+    uint64_t bus_time_ns;
+};
+
+/******************************************************************************/
+/*!           Static Function Declaration                                     */
+
+/*!
+ *  @brief Simulated OIS SPI read which accounts the bus time of the transaction.
+ */
+static BMI2_INTF_RETURN_TYPE sim_spi_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ *  @brief Simulated OIS SPI write which accounts the bus time of the transaction.
+ */
+static BMI2_INTF_RETURN_TYPE sim_spi_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ *  @brief Delay function of the simulated OIS interface.
+ */
+static void sim_delay_us(uint32_t period, void *intf_ptr);
+
+/*!
+ *  @brief This internal API updates the simulated OIS data registers.
+ *
+ *  @param[in] sample : Sample number.
+ *  @param[in] sim    : Simulated OIS SPI interface.
+ */
+static void sim_update_data(uint16_t sample, struct sim_ois_spi *sim);
+
+/******************************************************************************/
+/*!            Functions                                        */
+
+/* This function starts the execution of program. */
+int main(void)
+{
+    /* Status of api are returned to this variable. */
+    int8_t rslt = BMI2_OIS_OK;
+
+    /* Sensor selection for the separate reads. */
+    uint8_t sens_sel[2] = { BMI2_OIS_ACCEL, BMI2_OIS_GYRO };
+
+    /* Data read by the separate reads, to compare with the burst read. */
+    struct bmi2_ois_sens_axes_data acc_ref, gyr_ref;
+
+    struct bmi2_ois_dev ois_dev;
+    struct bmi2_ois_timing timing;
+    struct sim_ois_spi sim;
+    uint16_t sample;
+    uint16_t mismatch = 0;
+    uint32_t separate_transactions;
+    uint64_t separate_bus_ns;
+    uint32_t tick_us;
+
+    memset(&ois_dev, 0, sizeof(ois_dev));
+    memset(&sim, 0, sizeof(sim));
+
+    ois_dev.ois_read = sim_spi_read;
+    ois_dev.ois_write = sim_spi_write;
+    ois_dev.ois_delay_us = sim_delay_us;
+    ois_dev.intf_ptr = &sim;
+
+    (void)coines_open_comm_intf(COINES_COMM_INTF_USB, NULL);
+
+    /* Separate accelerometer and gyroscope reads, as done before the burst read */
+    for (sample = 0; (sample < OIS_SAMPLE_COUNT) && (rslt == BMI2_OIS_OK); sample++)
+    {
+        sim_update_data(sample, &sim);
+        rslt = bmi2_ois_read_data(&sens_sel[0], 1, &ois_dev, SIM_GYR_CROSS_SENS_ZX);
+        if (rslt == BMI2_OIS_OK)
+        {
+            rslt = bmi2_ois_read_data(&sens_sel[1], 1, &ois_dev, SIM_GYR_CROSS_SENS_ZX);
+        }
+
+        acc_ref = ois_dev.acc_data;
+        gyr_ref = ois_dev.gyr_data;
+
+        /* Same sample through the burst read */
+        if (rslt == BMI2_OIS_OK)
+        {
+            rslt = bmi2_ois_read_acc_gyr(&ois_dev, SIM_GYR_CROSS_SENS_ZX);
+        }
+
+        if (memcmp(&acc_ref, &ois_dev.acc_data, sizeof(acc_ref)) || memcmp(&gyr_ref, &ois_dev.gyr_data, sizeof(gyr_ref)))
+        {
+            mismatch++;
+        }
+    }
+
+    /* Bus usage of the separate reads alone */
+    sim.n_transactions = 0;
+    sim.bus_time_ns = 0;
+    for (sample = 0; (sample < OIS_SAMPLE_COUNT) && (rslt == BMI2_OIS_OK); sample++)
+    {
+        rslt = bmi2_ois_read_data(&sens_sel[0], 1, &ois_dev, SIM_GYR_CROSS_SENS_ZX);
+        if (rslt == BMI2_OIS_OK)
+        {
+            rslt = bmi2_ois_read_data(&sens_sel[1], 1, &ois_dev, SIM_GYR_CROSS_SENS_ZX);
+        }
+    }
+
+    separate_transactions = sim.n_transactions;
+    separate_bus_ns = sim.bus_time_ns;
+
+    /* Timer driven burst reads at the OIS rate */
+    sim.n_transactions = 0;
+    sim.bus_time_ns = 0;
+    if (rslt == BMI2_OIS_OK)
+    {
+        rslt = bmi2_ois_timing_init(OIS_PERIOD_US, &timing);
+    }
+
+    tick_us = (uint32_t)coines_get_micro_sec();
+    for (sample = 0; (sample < OIS_SAMPLE_COUNT) && (rslt == BMI2_OIS_OK); sample++)
+    {
+        /* Stand-in for the sampling timer interrupt */
+        while ((int32_t)((uint32_t)coines_get_micro_sec() - tick_us) < 0)
+        {
+        }
+
+        sim_update_data(sample, &sim);
+        rslt = bmi2_ois_read_timed((uint32_t)coines_get_micro_sec(), &timing, &ois_dev, SIM_GYR_CROSS_SENS_ZX);
+        tick_us += OIS_PERIOD_US;
+    }
+
+    if (rslt == BMI2_OIS_OK)
+    {
+        printf("OIS samples                 : %u\n", OIS_SAMPLE_COUNT);
+        printf("Separate reads              : %lu transactions, %lu ns bus time per sample\n",
+               (long unsigned int)(separate_transactions / OIS_SAMPLE_COUNT),
+               (long unsigned int)(separate_bus_ns / OIS_SAMPLE_COUNT));
+        printf("Burst read                  : %lu transactions, %lu ns bus time per sample\n",
+               (long unsigned int)(sim.n_transactions / OIS_SAMPLE_COUNT),
+               (long unsigned int)(sim.bus_time_ns / OIS_SAMPLE_COUNT));
+        printf("Burst vs separate mismatches: %u\n", mismatch);
+        printf("Timer jitter (us)           : min %lu, max %lu, mean %lu\n",
+               (long unsigned int)timing.jitter_min_us,
+               (long unsigned int)timing.jitter_max_us,
+               (long unsigned int)(timing.jitter_sum_us / timing.n_samples));
+        printf("Missed OIS periods          : %lu\n", (long unsigned int)timing.n_missed);
+    }
+    else
+    {
+        printf("OIS read failed, error %d\n", rslt);
+    }
+
+    (void)coines_close_comm_intf(COINES_COMM_INTF_USB, NULL);
+
+    return rslt;
+}
+
+/*!
+ *  @brief Simulated OIS SPI read which accounts the bus time of the transaction.
+ */
+static BMI2_INTF_RETURN_TYPE sim_spi_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    struct sim_ois_spi *sim = (struct sim_ois_spi *)intf_ptr;
+    uint32_t index;
+
+    /* The first byte clocked in during the address byte is a dummy byte */
+    reg_addr &= BMI2_OIS_SPI_WR_MASK;
+    reg_data[0] = 0;
+    for (index = 1; index < len; index++)
+    {
+        reg_data[index] = sim->regs[(reg_addr + index - 1) & 0x7F];
+    }
+
+    sim->n_transactions++;
+    sim->bus_time_ns += SIM_SPI_OVERHEAD_NS + (((uint64_t)(len + 1) * 8 * 1000000) / SIM_SPI_CLOCK_KHZ);
+
+    return BMI2_INTF_RET_SUCCESS;
+}
+
+/*!
+ *  @brief Simulated OIS SPI write which accounts the bus time of the transaction.
+ */
+static BMI2_INTF_RETURN_TYPE sim_spi_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    struct sim_ois_spi *sim = (struct sim_ois_spi *)intf_ptr;
+
+    memcpy(&sim->regs[reg_addr & 0x7F], reg_data, len);
+
+    sim->n_transactions++;
+    sim->bus_time_ns += SIM_SPI_OVERHEAD_NS + (((uint64_t)(len + 1) * 8 * 1000000) / SIM_SPI_CLOCK_KHZ);
+
+    return BMI2_INTF_RET_SUCCESS;
+}
+
+/*!
+ *  @brief Delay function of the simulated OIS interface.
+ */
+static void sim_delay_us(uint32_t period, void *intf_ptr)
+{
+    (void)intf_ptr;
+
+    coines_delay_usec(period);
+}
+
+/*!
+ *  @brief This internal API updates the simulated OIS data registers.
+ */
+static void sim_update_data(uint16_t sample, struct sim_ois_spi *sim)
+{
+    uint8_t index;
+    uint16_t value;
+
+    for (index = 0; index < BMI2_OIS_ACC_GYR_BURST_NUM_BYTES; index += 2)
+    {
+        value = (uint16_t)((sample * 37U) + (index * 4099U));
+        sim->regs[BMI2_OIS_ACC_X_LSB_ADDR + index] = (uint8_t)value;
+        sim->regs[BMI2_OIS_ACC_X_LSB_ADDR + index + 1] = (uint8_t)(value >> 8);
+    }
+}
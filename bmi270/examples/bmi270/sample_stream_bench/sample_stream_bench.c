@@ -0,0 +1,280 @@
+/**\
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include <stdio.h>
+#include "bmi270.h"
+#include "common.h"
+#include "sample_stream.h"
+
+/******************************************************************************/
+/*!                Macro definition                                           */
+
+/*! Earth's gravity in m/s^2 */
+#define GRAVITY_EARTH   (9.80665f)
+
+/*! Macros to select the sensors                   */
+#define ACCEL           UINT8_C(0x00)
+#define GYRO            UINT8_C(0x01)
+
+/*! Number of samples captured from the sensor */
+#define CAPTURE_LEN     UINT16_C(256)
+
+/*! Number of samples sent in each output format */
+#define SEND_LEN        UINT32_C(8192)
+
+/*! Samples per binary frame pair */
+#define BATCH_LEN       UINT16_C(16)
+
+/******************************************************************************/
+/*!           Static Variable Definition                                      */
+
+/*! Captured samples, sent over and over to measure the link */
+static struct sample_stream_axes acc_data[CAPTURE_LEN];
+static struct sample_stream_axes gyr_data[CAPTURE_LEN];
+
+/******************************************************************************/
+/*!           Static Function Declaration                                     */
+
+/*!
+ *  @brief This internal API is used to set configurations for accel and gyro.
+ *
+ *  @param[in] bmi       : Structure instance of bmi2_dev.
+ *
+ *  @return Status of execution.
+ */
+static int8_t set_accel_gyro_config(struct bmi2_dev *bmi);
+
+/*!
+ *  @brief This internal API writes a binary frame to the USB link.
+ */
+static void usb_write(const uint8_t *data, uint16_t len, void *intf_ptr);
+
+/*!
+ *  @brief This internal API sends the captured samples as text lines.
+ *
+ *  @return Time taken in microseconds.
+ */
+static uint32_t send_text(uint8_t bit_width);
+
+/*!
+ *  @brief This internal API sends the captured samples as binary frames.
+ *
+ *  @param[in] flags     : 0 or SAMPLE_STREAM_DELTA.
+ *  @param[in] enc       : Binary stream encoder.
+ *
+ *  @return Time taken in microseconds.
+ */
+static uint32_t send_binary(uint8_t flags, struct sample_stream_enc *enc);
+
+/******************************************************************************/
+/*!            Functions                                        */
+
+/* This function starts the execution of program. */
+int main(void)
+{
+    /* Status of api are returned to this variable. */
+    int8_t rslt;
+
+    /* Assign accel and gyro sensor to variable. */
+    uint8_t sensor_list[2] = { BMI2_ACCEL, BMI2_GYRO };
+
+    /* Sensor initialization configuration. */
+    struct bmi2_dev bmi;
+
+    /* Structure to define type of sensor and their respective data. */
+    struct bmi2_sens_data sensor_data = { { 0 } };
+
+    /* Binary stream encoder. */
+    struct sample_stream_enc enc;
+
+    uint16_t indx = 0;
+    uint32_t text_us = 0, plain_us = 0, delta_us = 0;
+    uint32_t plain_bytes = 0, delta_bytes = 0;
+
+    /* Interface reference is given as a parameter
+     * For I2C : BMI2_I2C_INTF
+     * For SPI : BMI2_SPI_INTF
+     */
+    rslt = bmi2_interface_init(&bmi, BMI2_I2C_INTF);
+    bmi2_error_codes_print_result(rslt);
+
+    /* Initialize bmi270. */
+    rslt = bmi270_init(&bmi);
+    bmi2_error_codes_print_result(rslt);
+
+    if (rslt == BMI2_OK)
+    {
+        rslt = set_accel_gyro_config(&bmi);
+        bmi2_error_codes_print_result(rslt);
+    }
+
+    if (rslt == BMI2_OK)
+    {
+        /* NOTE:
+         * Accel and Gyro enable must be done after setting configurations
+         */
+        rslt = bmi2_sensor_enable(sensor_list, 2, &bmi);
+        bmi2_error_codes_print_result(rslt);
+    }
+
+    /* Capture real samples first, so the sensor data rate does not limit the link measurement. */
+    while ((rslt == BMI2_OK) && (indx < CAPTURE_LEN))
+    {
+        rslt = bmi2_get_sensor_data(&sensor_data, &bmi);
+        bmi2_error_codes_print_result(rslt);
+
+        if ((rslt == BMI2_OK) && (sensor_data.status & BMI2_DRDY_ACC) && (sensor_data.status & BMI2_DRDY_GYR))
+        {
+            acc_data[indx].sensortime = sensor_data.sens_time;
+            acc_data[indx].x = sensor_data.acc.x;
+            acc_data[indx].y = sensor_data.acc.y;
+            acc_data[indx].z = sensor_data.acc.z;
+            gyr_data[indx].sensortime = sensor_data.sens_time;
+            gyr_data[indx].x = sensor_data.gyr.x;
+            gyr_data[indx].y = sensor_data.gyr.y;
+            gyr_data[indx].z = sensor_data.gyr.z;
+            indx++;
+        }
+    }
+
+    if (rslt == BMI2_OK)
+    {
+        /* The binary frames end up on the same terminal as the text. The host
+         * decoder skips the text while it looks for frames.
+         */
+        text_us = send_text(bmi.resolution);
+
+        (void)sample_stream_init(usb_write, NULL, &enc);
+        plain_us = send_binary(0, &enc);
+        plain_bytes = enc.n_bytes;
+
+        (void)sample_stream_init(usb_write, NULL, &enc);
+        delta_us = send_binary(SAMPLE_STREAM_DELTA, &enc);
+        delta_bytes = enc.n_bytes;
+
+        printf("\n\nAccel and gyro samples per second over USB, %lu samples each\n", (long unsigned int)SEND_LEN);
+        printf("Text         : %lu samples/s\n", (long unsigned int)((uint64_t)SEND_LEN * 1000000 / text_us));
+        printf("Binary plain : %lu samples/s, %lu bytes\n",
+               (long unsigned int)((uint64_t)SEND_LEN * 1000000 / plain_us),
+               (long unsigned int)plain_bytes);
+        printf("Binary delta : %lu samples/s, %lu bytes\n",
+               (long unsigned int)((uint64_t)SEND_LEN * 1000000 / delta_us),
+               (long unsigned int)delta_bytes);
+    }
+
+    bmi2_coines_deinit();
+
+    return rslt;
+}
+
+/*!
+ *  @brief This internal API writes a binary frame to the USB link.
+ */
+static void usb_write(const uint8_t *data, uint16_t len, void *intf_ptr)
+{
+    (void)intf_ptr;
+
+    coines_write_intf(COINES_COMM_INTF_USB, (void *)data, len);
+}
+
+/*!
+ *  @brief This internal API sends the captured samples as text lines.
+ */
+static uint32_t send_text(uint8_t bit_width)
+{
+    uint32_t start = (uint32_t)coines_get_micro_sec();
+    uint32_t count;
+    uint16_t idx;
+    float half_scale = ((float)(1 << bit_width) / 2.0f);
+
+    for (count = 0; count < SEND_LEN; count++)
+    {
+        idx = (uint16_t)(count % CAPTURE_LEN);
+
+        /* Same line as the accel_gyro example, 2G and 2000dps range */
+        printf("%lu, %d, %d, %d, %4.2f, %4.2f, %4.2f, %d, %d, %d, %4.2f, %4.2f, %4.2f\n",
+               (long unsigned int)count,
+               acc_data[idx].x,
+               acc_data[idx].y,
+               acc_data[idx].z,
+               (GRAVITY_EARTH * acc_data[idx].x * 2) / half_scale,
+               (GRAVITY_EARTH * acc_data[idx].y * 2) / half_scale,
+               (GRAVITY_EARTH * acc_data[idx].z * 2) / half_scale,
+               gyr_data[idx].x,
+               gyr_data[idx].y,
+               gyr_data[idx].z,
+               (2000 / half_scale) * gyr_data[idx].x,
+               (2000 / half_scale) * gyr_data[idx].y,
+               (2000 / half_scale) * gyr_data[idx].z);
+    }
+
+    (void)fflush(stdout);
+    coines_flush_intf(COINES_COMM_INTF_USB);
+
+    return (uint32_t)coines_get_micro_sec() - start;
+}
+
+/*!
+ *  @brief This internal API sends the captured samples as binary frames.
+ */
+static uint32_t send_binary(uint8_t flags, struct sample_stream_enc *enc)
+{
+    uint32_t start = (uint32_t)coines_get_micro_sec();
+    uint32_t count;
+    uint16_t idx;
+
+    for (count = 0; count < SEND_LEN; count += BATCH_LEN)
+    {
+        idx = (uint16_t)(count % CAPTURE_LEN);
+        (void)sample_stream_put_axes(SAMPLE_STREAM_TYPE_ACCEL | flags, &acc_data[idx], BATCH_LEN, enc);
+        (void)sample_stream_put_axes(SAMPLE_STREAM_TYPE_GYRO | flags, &gyr_data[idx], BATCH_LEN, enc);
+    }
+
+    coines_flush_intf(COINES_COMM_INTF_USB);
+
+    return (uint32_t)coines_get_micro_sec() - start;
+}
+
+/*!
+ * @brief This internal API is used to set configurations for accel and gyro.
+ */
+static int8_t set_accel_gyro_config(struct bmi2_dev *bmi)
+{
+    /* Status of api are returned to this variable. */
+    int8_t rslt;
+
+    /* Structure to define accelerometer and gyro configuration. */
+    struct bmi2_sens_config config[2];
+
+    /* Configure the type of feature. */
+    config[ACCEL].type = BMI2_ACCEL;
+    config[GYRO].type = BMI2_GYRO;
+
+    /* Get default configurations for the type of feature selected. */
+    rslt = bmi2_get_sensor_config(config, 2, bmi);
+    bmi2_error_codes_print_result(rslt);
+
+    if (rslt == BMI2_OK)
+    {
+        /* Accel and gyro at 1600Hz, 2G and 2000dps, as used by the text output. */
+        config[ACCEL].cfg.acc.odr = BMI2_ACC_ODR_1600HZ;
+        config[ACCEL].cfg.acc.range = BMI2_ACC_RANGE_2G;
+        config[ACCEL].cfg.acc.bwp = BMI2_ACC_NORMAL_AVG4;
+        config[ACCEL].cfg.acc.filter_perf = BMI2_PERF_OPT_MODE;
+
+        config[GYRO].cfg.gyr.odr = BMI2_GYR_ODR_1600HZ;
+        config[GYRO].cfg.gyr.range = BMI2_GYR_RANGE_2000;
+        config[GYRO].cfg.gyr.bwp = BMI2_GYR_NORMAL_MODE;
+        config[GYRO].cfg.gyr.noise_perf = BMI2_POWER_OPT_MODE;
+        config[GYRO].cfg.gyr.filter_perf = BMI2_PERF_OPT_MODE;
+
+        /* Set the accel and gyro configurations. */
+        rslt = bmi2_set_sensor_config(config, 2, bmi);
+        bmi2_error_codes_print_result(rslt);
+    }
+
+    return rslt;
+}
@@ -0,0 +1,118 @@
+/**\
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include <stdio.h>
+#include "bmi270.h"
+#include "common.h"
+
+/******************************************************************************/
+/*!                  Static Function Declaration                              */
+
+/*!
+ *  @brief This internal API runs a procedure step by step and counts the
+ *  passes of the main loop in between.
+ *
+ *  @param[in] op       : Procedure to be run.
+ *  @param[in] dev      : Structure instance of bmi2_dev.
+ *
+ *  @return Status of execution.
+ */
+static int8_t run_steps(uint8_t op, struct bmi2_dev *dev);
+
+/******************************************************************************/
+/*!            Functions                                        */
+
+/* This function starts the execution of program. */
+int main(void)
+{
+    /* Sensor initialization configuration. */
+    struct bmi2_dev bmi2_dev;
+
+    /* Status of api are returned to this variable. */
+    int8_t rslt;
+
+    /* Interface reference is given as a parameter
+     * For I2C : BMI2_I2C_INTF
+     * For SPI : BMI2_SPI_INTF
+     */
+    rslt = bmi2_interface_init(&bmi2_dev, BMI2_I2C_INTF);
+    bmi2_error_codes_print_result(rslt);
+
+    /* Initialize bmi270. */
+    rslt = bmi270_init(&bmi2_dev);
+    bmi2_error_codes_print_result(rslt);
+
+    if (rslt == BMI2_OK)
+    {
+        /* Do not move the board while doing CRT. If so, it will throw an abort error. */
+        printf("CRT\n");
+        rslt = run_steps(BMI2_TEST_SM_CRT, &bmi2_dev);
+        bmi2_error_codes_print_result(rslt);
+    }
+
+    if (rslt == BMI2_OK)
+    {
+        printf("Gyro self-test\n");
+        rslt = run_steps(BMI2_TEST_SM_GYRO_SELF_TEST, &bmi2_dev);
+        bmi2_error_codes_print_result(rslt);
+    }
+
+    if (rslt == BMI2_OK)
+    {
+        /* The accel self-test ends with a soft reset. */
+        printf("Accel self-test\n");
+        rslt = run_steps(BMI2_TEST_SM_ACCEL_SELF_TEST, &bmi2_dev);
+        bmi2_error_codes_print_result(rslt);
+    }
+
+    bmi2_coines_deinit();
+
+    return rslt;
+}
+
+/*!
+ *  @brief This internal API runs a procedure step by step and counts the
+ *  passes of the main loop in between.
+ */
+static int8_t run_steps(uint8_t op, struct bmi2_dev *dev)
+{
+    /* Status of api are returned to this variable. */
+    int8_t rslt;
+
+    /* Context of the procedure. */
+    struct bmi2_test_sm sm;
+
+    uint32_t start_us = (uint32_t)coines_get_micro_sec();
+    uint32_t steps = 0;
+    uint32_t loops = 0;
+
+    rslt = bmi2_test_sm_start(op, start_us, &sm, dev);
+
+    while ((rslt == BMI2_OK) || (rslt == BMI2_W_STEP_PENDING))
+    {
+        /* Only steps which are due access the sensor. */
+        if ((int32_t)((uint32_t)coines_get_micro_sec() - sm.next_us) >= 0)
+        {
+            rslt = bmi2_test_sm_step((uint32_t)coines_get_micro_sec(), &sm, dev);
+            steps++;
+            if (rslt != BMI2_W_STEP_PENDING)
+            {
+                break;
+            }
+        }
+
+        /* Other sensors, USB and the like are serviced here. */
+        loops++;
+    }
+
+    printf("Result %d after %lu us, %lu steps, %lu main loop passes\n",
+           rslt,
+           (long unsigned int)((uint32_t)coines_get_micro_sec() - start_us),
+           (long unsigned int)steps,
+           (long unsigned int)loops);
+
+    return rslt;
+}
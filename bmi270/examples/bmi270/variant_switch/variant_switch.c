@@ -0,0 +1,218 @@
+/**\
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include <stdio.h>
+#include "bmi270_variant.h"
+#include "common.h"
+
+/******************************************************************************/
+/*!                Macro definition                                           */
+
+/*! Number of round trips between the maximum FIFO and legacy variants */
+#define SWITCH_COUNT    UINT8_C(5)
+
+/*! Burst length of the configuration upload during a switch */
+#define UPLOAD_LEN      UINT16_C(254)
+
+/******************************************************************************/
+/*!           Static Function Declaration                                     */
+
+/*!
+ *  @brief This internal API reads the microsecond timer of the platform.
+ *
+ *  @return Time in microseconds.
+ */
+static uint32_t get_time_us(void);
+
+/*!
+ *  @brief This internal API sets and enables accel and gyro with the
+ *  FIFO and data ready interrupt, the state kept across the switches.
+ *
+ *  @param[in] bmi       : Structure instance of bmi2_dev.
+ *
+ *  @return Status of execution.
+ */
+static int8_t set_accel_gyro_fifo(struct bmi2_dev *bmi);
+
+/*!
+ *  @brief This internal API switches to a variant and prints the latency.
+ *
+ *  @param[in] variant   : Variant to switch to.
+ *  @param[in] mgr       : Structure instance of bmi270_variant_mgr.
+ *  @param[in] bmi       : Structure instance of bmi2_dev.
+ *
+ *  @return Status of execution.
+ */
+static int8_t switch_variant(uint8_t variant, struct bmi270_variant_mgr *mgr, struct bmi2_dev *bmi);
+
+/******************************************************************************/
+/*!            Functions                                        */
+
+/* This function starts the execution of program. */
+int main(void)
+{
+    /* Status of api are returned to this variable. */
+    int8_t rslt;
+
+    /* Variable to define loop */
+    uint8_t loop;
+
+    /* Sensor initialization configuration. */
+    struct bmi2_dev bmi;
+
+    /* Variant manager, latency measured with the platform timer. */
+    struct bmi270_variant_mgr mgr = { 0 };
+
+    /* Accel configuration read back after the switches. */
+    struct bmi2_sens_config config = { 0 };
+
+    /* Interface reference is given as a parameter
+     * For I2C : BMI2_I2C_INTF
+     * For SPI : BMI2_SPI_INTF
+     */
+    rslt = bmi2_interface_init(&bmi, BMI2_SPI_INTF);
+    bmi2_error_codes_print_result(rslt);
+
+    mgr.upload_len = UPLOAD_LEN;
+    mgr.get_time_us = get_time_us;
+
+    /* Start with the base variant. */
+    rslt = bmi270_variant_init(BMI270_VARIANT_BASE, &mgr, &bmi);
+    bmi2_error_codes_print_result(rslt);
+
+    if (rslt == BMI2_OK)
+    {
+        rslt = set_accel_gyro_fifo(&bmi);
+        bmi2_error_codes_print_result(rslt);
+    }
+
+    for (loop = 0; (loop < SWITCH_COUNT) && (rslt == BMI2_OK); loop++)
+    {
+        /* High throughput FIFO mode. */
+        rslt = switch_variant(BMI270_VARIANT_MAXIMUM_FIFO, &mgr, &bmi);
+
+        if (rslt == BMI2_OK)
+        {
+            /* Feature detection mode. */
+            rslt = switch_variant(BMI270_VARIANT_LEGACY, &mgr, &bmi);
+        }
+    }
+
+    if (rslt == BMI2_OK)
+    {
+        config.type = BMI2_ACCEL;
+        rslt = bmi2_get_sensor_config(&config, 1, &bmi);
+        bmi2_error_codes_print_result(rslt);
+
+        printf("\nAccel ODR 0x%x range %d after %lu switches, %lu soft-reset fallbacks, longest %lu us\n",
+               config.cfg.acc.odr,
+               config.cfg.acc.range,
+               (long unsigned int)mgr.n_switches,
+               (long unsigned int)mgr.n_resets,
+               (long unsigned int)mgr.max_switch_us);
+    }
+
+    bmi2_coines_deinit();
+
+    return rslt;
+}
+
+/*!
+ *  @brief This internal API reads the microsecond timer of the platform.
+ */
+static uint32_t get_time_us(void)
+{
+    return (uint32_t)coines_get_micro_sec();
+}
+
+/*!
+ *  @brief This internal API sets and enables accel and gyro with the
+ *  FIFO and data ready interrupt, the state kept across the switches.
+ */
+static int8_t set_accel_gyro_fifo(struct bmi2_dev *bmi)
+{
+    /* Status of api are returned to this variable. */
+    int8_t rslt;
+
+    /* Assign accel and gyro sensor to variable. */
+    uint8_t sensor_list[2] = { BMI2_ACCEL, BMI2_GYRO };
+
+    /* Structure to define accel and gyro configuration. */
+    struct bmi2_sens_config config[2] = { { 0 } };
+
+    /* Interrupt pin configuration */
+    struct bmi2_int_pin_config pin_config = { 0 };
+
+    config[0].type = BMI2_ACCEL;
+    config[1].type = BMI2_GYRO;
+
+    rslt = bmi2_get_sensor_config(config, 2, bmi);
+    if (rslt == BMI2_OK)
+    {
+        config[0].cfg.acc.odr = BMI2_ACC_ODR_400HZ;
+        config[0].cfg.acc.range = BMI2_ACC_RANGE_4G;
+        config[1].cfg.gyr.odr = BMI2_GYR_ODR_400HZ;
+        config[1].cfg.gyr.range = BMI2_GYR_RANGE_2000;
+
+        rslt = bmi2_set_sensor_config(config, 2, bmi);
+    }
+
+    if (rslt == BMI2_OK)
+    {
+        rslt = bmi2_sensor_enable(sensor_list, 2, bmi);
+    }
+
+    if (rslt == BMI2_OK)
+    {
+        rslt = bmi2_set_fifo_config(BMI2_FIFO_ACC_EN | BMI2_FIFO_GYR_EN | BMI2_FIFO_HEADER_EN, BMI2_ENABLE, bmi);
+    }
+
+    if (rslt == BMI2_OK)
+    {
+        rslt = bmi2_get_int_pin_config(&pin_config, bmi);
+    }
+
+    if (rslt == BMI2_OK)
+    {
+        pin_config.pin_type = BMI2_INT1;
+        pin_config.pin_cfg[0].output_en = BMI2_INT_OUTPUT_ENABLE;
+        pin_config.pin_cfg[0].lvl = BMI2_INT_ACTIVE_HIGH;
+        pin_config.pin_cfg[0].od = BMI2_INT_PUSH_PULL;
+
+        rslt = bmi2_set_int_pin_config(&pin_config, bmi);
+    }
+
+    if (rslt == BMI2_OK)
+    {
+        rslt = bmi2_map_data_int(BMI2_FWM_INT, BMI2_INT1, bmi);
+    }
+
+    return rslt;
+}
+
+/*!
+ *  @brief This internal API switches to a variant and prints the latency.
+ */
+static int8_t switch_variant(uint8_t variant, struct bmi270_variant_mgr *mgr, struct bmi2_dev *bmi)
+{
+    /* Status of api are returned to this variable. */
+    int8_t rslt;
+
+    rslt = bmi270_variant_switch(variant, mgr, bmi);
+    bmi2_error_codes_print_result(rslt);
+
+    if (rslt == BMI2_OK)
+    {
+        printf("Switch to variant %d : %lu us (save %lu, load %lu, restore %lu)\n",
+               variant,
+               (long unsigned int)mgr->switch_us,
+               (long unsigned int)mgr->save_us,
+               (long unsigned int)mgr->load_us,
+               (long unsigned int)mgr->restore_us);
+    }
+
+    return rslt;
+}
@@ -0,0 +1,239 @@
+/**\
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include <stdio.h>
+#include "bmi270_maximum_fifo.h"
+#include "common.h"
+
+/******************************************************************************/
+/*!                  Macros                                                   */
+
+/*! Number of frames a chunk can hold, header byte + accel + gyro */
+#define FRAMES_PER_CHUNK           (BMI270_MAXIMUM_FIFO_CHUNK_SIZE / (1 + BMI2_FIFO_ACC_GYR_LENGTH))
+
+/*! Setting a watermark level in FIFO, leaves room for one more drain */
+#define BMI2_FIFO_WATERMARK_LEVEL  UINT16_C(4096)
+
+/*! Number of drains before the counters are printed */
+#define DRAIN_COUNT                UINT16_C(200)
+
+/******************************************************************************/
+/*!           Static Variable Definition                                      */
+
+/*! Chunk buffers, one is read while the other is parsed.
+ * NOTE : Dummy byte (for SPI Interface) required for FIFO data read must be given as part of array size
+ */
+static uint8_t chunk_data[2][BMI270_MAXIMUM_FIFO_CHUNK_SIZE + 1];
+
+/*! Frames parsed from a chunk */
+static struct bmi2_sens_axes_data fifo_accel_data[FRAMES_PER_CHUNK];
+static struct bmi2_sens_axes_data fifo_gyro_data[FRAMES_PER_CHUNK];
+
+/******************************************************************************/
+/*!           Static Function Declaration                                     */
+
+/*!
+ *  @brief This internal API is used to set configurations for accel and gyro.
+ *  @param[in] dev       : Structure instance of bmi2_dev.
+ *  @return Status of execution.
+ */
+static int8_t set_accel_gyro_config(struct bmi2_dev *dev);
+
+/*!
+ *  @brief This internal API receives the frames of each chunk.
+ */
+static int8_t fifo_sink(const struct bmi2_sens_axes_data *acc,
+                        uint16_t acc_len,
+                        const struct bmi2_sens_axes_data *gyr,
+                        uint16_t gyr_len,
+                        void *sink_ptr);
+
+/******************************************************************************/
+/*!            Functions                                                      */
+
+/* This function starts the execution of program. */
+int main(void)
+{
+    /* Status of api are returned to this variable. */
+    int8_t rslt;
+
+    /* Sensor initialization configuration. */
+    struct bmi2_dev bmi2_dev;
+
+    /* FIFO streaming drain. */
+    struct bmi270_fifo_stream stream = { 0 };
+
+    /* Accel and gyro sensor are listed in array. */
+    uint8_t sensor_sel[2] = { BMI2_ACCEL, BMI2_GYRO };
+
+    /* Variable to get fifo water-mark interrupt status. */
+    uint16_t int_status = 0;
+
+    /* Last accel frame of the stream. */
+    struct bmi2_sens_axes_data last_accel = { 0 };
+
+    uint16_t drains = 0;
+
+    /* Interface reference is given as a parameter
+     * For I2C : BMI2_I2C_INTF
+     * For SPI : BMI2_SPI_INTF
+     */
+    rslt = bmi2_interface_init(&bmi2_dev, BMI2_SPI_INTF);
+    bmi2_error_codes_print_result(rslt);
+
+    /* Initialize bmi270_maximum_fifo. */
+    rslt = bmi270_maximum_fifo_init(&bmi2_dev);
+    bmi2_error_codes_print_result(rslt);
+
+    /* Configuration settings for accel and gyro. */
+    rslt = set_accel_gyro_config(&bmi2_dev);
+    bmi2_error_codes_print_result(rslt);
+
+    /* NOTE:
+     * Accel and Gyro enable must be done after setting configurations
+     */
+    rslt = bmi2_sensor_enable(sensor_sel, 2, &bmi2_dev);
+    bmi2_error_codes_print_result(rslt);
+
+    /* Before setting FIFO, disable the advance power save mode. */
+    rslt = bmi2_set_adv_power_save(BMI2_DISABLE, &bmi2_dev);
+    bmi2_error_codes_print_result(rslt);
+
+    /* Initially disable all configurations in fifo. */
+    rslt = bmi2_set_fifo_config(BMI2_FIFO_ALL_EN, BMI2_DISABLE, &bmi2_dev);
+    bmi2_error_codes_print_result(rslt);
+
+    /* Set FIFO configuration by enabling accel and gyro.
+     * NOTE 1: The header mode is enabled by default.
+     * NOTE 2: Sensortime frames are only sent when reading past the end of
+     * the FIFO, which the drain does not do.
+     */
+    rslt = bmi2_set_fifo_config(BMI2_FIFO_ACC_EN | BMI2_FIFO_GYR_EN, BMI2_ENABLE, &bmi2_dev);
+    bmi2_error_codes_print_result(rslt);
+
+    /* Map water-mark interrupt to the required interrupt pin. */
+    rslt = bmi2_map_data_int(BMI2_FWM_INT, BMI2_INT1, &bmi2_dev);
+    bmi2_error_codes_print_result(rslt);
+
+    rslt = bmi2_set_fifo_wm(BMI2_FIFO_WATERMARK_LEVEL, &bmi2_dev);
+    bmi2_error_codes_print_result(rslt);
+
+    /* Buffers and sink of the drain. dev->read blocks here, an
+     * asynchronous read is completed by assigning stream.wait.
+     */
+    stream.chunk[0] = chunk_data[0];
+    stream.chunk[1] = chunk_data[1];
+    stream.chunk_len = BMI270_MAXIMUM_FIFO_CHUNK_SIZE;
+    stream.acc = fifo_accel_data;
+    stream.gyr = fifo_gyro_data;
+    stream.acc_len = FRAMES_PER_CHUNK;
+    stream.gyr_len = FRAMES_PER_CHUNK;
+    stream.sink = fifo_sink;
+    stream.sink_ptr = &last_accel;
+
+    /* Read the FIFO configuration once, after the FIFO is configured. */
+    rslt = bmi270_maximum_fifo_stream_init(&stream, &bmi2_dev);
+    bmi2_error_codes_print_result(rslt);
+
+    while ((rslt == BMI2_OK) && (drains < DRAIN_COUNT))
+    {
+        rslt = bmi2_get_int_status(&int_status, &bmi2_dev);
+        bmi2_error_codes_print_result(rslt);
+
+        /* Drain the FIFO on water-mark interrupt. */
+        if ((rslt == BMI2_OK) && (int_status & BMI2_FWM_INT_STATUS_MASK))
+        {
+            rslt = bmi270_maximum_fifo_stream_drain((uint32_t)coines_get_micro_sec(), &stream, &bmi2_dev);
+            bmi2_error_codes_print_result(rslt);
+
+            drains++;
+        }
+    }
+
+    printf("\nLast ACCEL X : %d\t Y : %d\t Z : %d\n", last_accel.x, last_accel.y, last_accel.z);
+    printf("Drains : %lu\n", (long unsigned int)stream.n_drains);
+    printf("Bytes read : %lu\n", (long unsigned int)stream.n_bytes);
+    printf("Accel frames : %lu, gyro frames : %lu\n",
+           (long unsigned int)stream.n_acc_frames,
+           (long unsigned int)stream.n_gyr_frames);
+    printf("Overflows : %lu, skipped frames : %lu\n",
+           (long unsigned int)stream.n_overflows,
+           (long unsigned int)stream.n_skipped_frames);
+    printf("Highest fill level : %d bytes\n", stream.max_fill);
+    printf("Sustained throughput : %lu bytes/s\n", (long unsigned int)stream.bytes_per_sec);
+
+    bmi2_coines_deinit();
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API receives the frames of each chunk.
+ */
+static int8_t fifo_sink(const struct bmi2_sens_axes_data *acc,
+                        uint16_t acc_len,
+                        const struct bmi2_sens_axes_data *gyr,
+                        uint16_t gyr_len,
+                        void *sink_ptr)
+{
+    struct bmi2_sens_axes_data *last_accel = (struct bmi2_sens_axes_data *)sink_ptr;
+
+    (void)gyr;
+    (void)gyr_len;
+
+    /* Keep the latest sample, the frames are forwarded here in a real application */
+    if (acc_len > 0)
+    {
+        *last_accel = acc[acc_len - 1];
+    }
+
+    /* No back-pressure: keep draining */
+    return BMI2_OK;
+}
+
+/*!
+ * @brief This internal API is used to set configurations for accel and gyro.
+ */
+static int8_t set_accel_gyro_config(struct bmi2_dev *dev)
+{
+    /* Status of api are returned to this variable. */
+    int8_t rslt;
+
+    /* Structure to define accel and gyro configurations. */
+    struct bmi2_sens_config config[2];
+
+    /* Configure the type of feature. */
+    config[0].type = BMI2_ACCEL;
+    config[1].type = BMI2_GYRO;
+
+    /* Get default configurations for the type of feature selected. */
+    rslt = bmi2_get_sensor_config(config, 2, dev);
+    bmi2_error_codes_print_result(rslt);
+
+    if (rslt == BMI2_OK)
+    {
+        /* Accel configuration settings, at the highest data rate. */
+        config[0].cfg.acc.odr = BMI2_ACC_ODR_1600HZ;
+        config[0].cfg.acc.range = BMI2_ACC_RANGE_2G;
+        config[0].cfg.acc.bwp = BMI2_ACC_NORMAL_AVG4;
+        config[0].cfg.acc.filter_perf = BMI2_PERF_OPT_MODE;
+
+        /* Gyro configuration settings, at the same data rate as accel so
+         * that both land in the same FIFO frame.
+         */
+        config[1].cfg.gyr.odr = BMI2_GYR_ODR_1600HZ;
+        config[1].cfg.gyr.range = BMI2_GYR_RANGE_2000;
+        config[1].cfg.gyr.bwp = BMI2_GYR_NORMAL_MODE;
+        config[1].cfg.gyr.noise_perf = BMI2_POWER_OPT_MODE;
+        config[1].cfg.gyr.filter_perf = BMI2_PERF_OPT_MODE;
+
+        /* Set new configurations. */
+        rslt = bmi2_set_sensor_config(config, 2, dev);
+        bmi2_error_codes_print_result(rslt);
+    }
+
+    return rslt;
+}
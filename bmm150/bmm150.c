@@ -582,6 +582,58 @@ static int8_t validate_adv_self_test(int16_t positive_data_z, int16_t negative_d
  */
 static int8_t set_adv_self_test_current(uint8_t self_test_current, struct bmm150_dev *dev);
 
+/*!
+ * @brief This internal API returns the value of a settings register from the
+ * register shadow, falling back to a bus read when the shadow is not valid.
+ *
+ * @param[in] reg_addr      : Settings register address (0x4B to 0x52)
+ * @param[out] reg_data     : Register value
+ * @param[in] dev           : Structure instance of bmm150_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval >0 -> Warning
+ * @retval <0 -> Fail
+ */
+static int8_t read_shadowed_reg(uint8_t reg_addr, uint8_t *reg_data, struct bmm150_dev *dev);
+
+/*!
+ * @brief This internal API writes a settings register and updates the
+ * register shadow on success.
+ *
+ * @param[in] reg_addr      : Settings register address (0x4B to 0x52)
+ * @param[in] reg_data      : Register value to be written
+ * @param[in] dev           : Structure instance of bmm150_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval >0 -> Warning
+ * @retval <0 -> Fail
+ */
+static int8_t write_shadowed_reg(uint8_t reg_addr, uint8_t reg_data, struct bmm150_dev *dev);
+
+/*!
+ * @brief This internal API returns the value to be kept in the register shadow
+ * for the written/read register value. Self-clearing bits (soft reset, normal
+ * self test) are dropped and forced mode is stored as sleep mode, since the
+ * sensor returns to sleep mode by itself once the measurement is done.
+ *
+ * @param[in] reg_addr      : Settings register address (0x4B to 0x52)
+ * @param[in] reg_data      : Register value
+ *
+ * @return Register value to be stored in the shadow
+ */
+static uint8_t shadow_reg_image(uint8_t reg_addr, uint8_t reg_data);
+
+/*!
+ * @brief This internal API stores the settings registers 0x4B to 0x52 read
+ * from the sensor in the register shadow.
+ *
+ * @param[in] reg_data      : Register values of 0x4B to 0x52
+ * @param[in] dev           : Structure instance of bmm150_dev.
+ */
+static void store_reg_shadow(const uint8_t *reg_data, struct bmm150_dev *dev);
+
 /********************** Global function definitions ************************/
 
 /*!
@@ -594,8 +646,17 @@ int8_t bmm150_init(struct bmm150_dev *dev)
     int8_t rslt;
     uint8_t chip_id = 0;
 
-    /* Power up the sensor from suspend to sleep mode */
-    rslt = set_power_control_bit(BMM150_POWER_CNTRL_ENABLE, dev);
+    /* Check for null pointer in the device structure */
+    rslt = null_ptr_check(dev);
+
+    if (rslt == BMM150_OK)
+    {
+        /* Register contents are unknown until they are read back */
+        dev->reg_shadow.valid = BMM150_FALSE;
+
+        /* Power up the sensor from suspend to sleep mode */
+        rslt = set_power_control_bit(BMM150_POWER_CNTRL_ENABLE, dev);
+    }
 
     if (rslt == BMM150_OK)
     {
@@ -615,6 +676,12 @@ int8_t bmm150_init(struct bmm150_dev *dev)
 
                 /* Function to update trim values */
                 rslt = read_trim_registers(dev);
+
+                if (rslt == BMM150_OK)
+                {
+                    /* Populate the register shadow of the settings registers */
+                    rslt = bmm150_refresh_reg_shadow(dev);
+                }
             }
         }
     }
@@ -690,13 +757,19 @@ int8_t bmm150_soft_reset(struct bmm150_dev *dev)
     int8_t rslt;
     uint8_t reg_data;
 
-    rslt = bmm150_get_regs(BMM150_REG_POWER_CONTROL, &reg_data, 1, dev);
+    rslt = read_shadowed_reg(BMM150_REG_POWER_CONTROL, &reg_data, dev);
 
     if (rslt == BMM150_OK)
     {
         reg_data = reg_data | BMM150_SET_SOFT_RESET;
-        rslt = bmm150_set_regs(BMM150_REG_POWER_CONTROL, &reg_data, 1, dev);
+        rslt = write_shadowed_reg(BMM150_REG_POWER_CONTROL, reg_data, dev);
         dev->delay_us(BMM150_DELAY_SOFT_RESET, dev->intf_ptr);
+
+        if (rslt == BMM150_OK)
+        {
+            /* All registers except 0x4B are back to their default values */
+            rslt = bmm150_refresh_reg_shadow(dev);
+        }
     }
 
     return rslt;
@@ -946,6 +1019,9 @@ int8_t bmm150_get_sensor_settings(struct bmm150_settings *settings, struct bmm15
         {
             /* Parse and store the settings */
             parse_setting(setting, settings);
+
+            /* Settings registers are read anyway, keep the shadow in sync */
+            store_reg_shadow(setting, dev);
         }
     }
     else
@@ -1090,6 +1166,74 @@ int8_t bmm150_perform_self_test(uint8_t self_test_mode, struct bmm150_dev *dev)
     return rslt;
 }
 
+/*!
+ * @brief This API reads the settings registers 0x4B to 0x52 and refreshes
+ * the register shadow.
+ */
+int8_t bmm150_refresh_reg_shadow(struct bmm150_dev *dev)
+{
+    int8_t rslt;
+    uint8_t reg_data[BMM150_LEN_SETTING_DATA] = { 0 };
+
+    /* Read the entire settings registers in one burst */
+    rslt = bmm150_get_regs(BMM150_REG_POWER_CONTROL, reg_data, BMM150_LEN_SETTING_DATA, dev);
+
+    if (rslt == BMM150_OK)
+    {
+        store_reg_shadow(reg_data, dev);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API compares the register shadow with the settings registers
+ * of the sensor.
+ */
+int8_t bmm150_check_reg_shadow(uint8_t *mismatch, struct bmm150_dev *dev)
+{
+    int8_t rslt;
+    uint8_t idx;
+    uint8_t reg_data[BMM150_LEN_SETTING_DATA] = { 0 };
+
+    if (mismatch != NULL)
+    {
+        rslt = bmm150_get_regs(BMM150_REG_POWER_CONTROL, reg_data, BMM150_LEN_SETTING_DATA, dev);
+
+        if (rslt == BMM150_OK)
+        {
+            if (dev->reg_shadow.valid == BMM150_TRUE)
+            {
+                *mismatch = 0;
+
+                for (idx = 0; idx < BMM150_LEN_SETTING_DATA; idx++)
+                {
+                    if (shadow_reg_image(BMM150_REG_POWER_CONTROL + idx, reg_data[idx]) != dev->reg_shadow.regs[idx])
+                    {
+                        /* Bit n of mismatch corresponds to register 0x4B + n */
+                        *mismatch |= (uint8_t)(1 << idx);
+                    }
+                }
+            }
+            else
+            {
+                *mismatch = BMM150_SHADOW_ALL_REGS;
+            }
+
+            if (*mismatch != 0)
+            {
+                rslt = BMM150_W_REG_SHADOW_MISMATCH;
+            }
+        }
+    }
+    else
+    {
+        rslt = BMM150_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
 /*!
  * @brief This API is used to get the status flags of interrupts
  */
@@ -1230,14 +1374,14 @@ static int8_t set_power_control_bit(uint8_t pwrcntrl_bit, struct bmm150_dev *dev
     uint8_t reg_data = 0;
 
     /* Power control register 0x4B is read */
-    rslt = bmm150_get_regs(BMM150_REG_POWER_CONTROL, &reg_data, 1, dev);
+    rslt = read_shadowed_reg(BMM150_REG_POWER_CONTROL, &reg_data, dev);
 
     /* Proceed if everything is fine until now */
     if (rslt == BMM150_OK)
     {
         /* Sets the value of power control bit */
         reg_data = BMM150_SET_BITS_POS_0(reg_data, BMM150_PWR_CNTRL, pwrcntrl_bit);
-        rslt = bmm150_set_regs(BMM150_REG_POWER_CONTROL, &reg_data, 1, dev);
+        rslt = write_shadowed_reg(BMM150_REG_POWER_CONTROL, reg_data, dev);
 
         if (rslt == BMM150_OK)
         {
@@ -1245,6 +1389,12 @@ static int8_t set_power_control_bit(uint8_t pwrcntrl_bit, struct bmm150_dev *dev
              * value in dev structure
              */
             dev->pwr_cntrl_bit = pwrcntrl_bit;
+
+            if (pwrcntrl_bit == BMM150_POWER_CNTRL_DISABLE)
+            {
+                /* Registers other than 0x4B lose their content in suspend mode */
+                dev->reg_shadow.valid = BMM150_FALSE;
+            }
         }
     }
 
@@ -1312,13 +1462,13 @@ static int8_t write_op_mode(uint8_t op_mode, struct bmm150_dev *dev)
     uint8_t reg_data;
 
     /* Read the 0x4C register */
-    rslt = bmm150_get_regs(BMM150_REG_OP_MODE, &reg_data, 1, dev);
+    rslt = read_shadowed_reg(BMM150_REG_OP_MODE, &reg_data, dev);
 
     if (rslt == BMM150_OK)
     {
         /* Set the op_mode value in Opmode bits of 0x4C */
         reg_data = BMM150_SET_BITS(reg_data, BMM150_OP_MODE, op_mode);
-        rslt = bmm150_set_regs(BMM150_REG_OP_MODE, &reg_data, 1, dev);
+        rslt = write_shadowed_reg(BMM150_REG_OP_MODE, reg_data, dev);
     }
 
     return rslt;
@@ -1344,6 +1494,12 @@ static int8_t suspend_to_sleep_mode(struct bmm150_dev *dev)
 
             /* Start-up time delay of 3ms */
             dev->delay_us(BMM150_START_UP_TIME, dev->intf_ptr);
+
+            if (rslt == BMM150_OK)
+            {
+                /* Registers came back with their default values */
+                rslt = bmm150_refresh_reg_shadow(dev);
+            }
         }
     }
 
@@ -1360,7 +1516,7 @@ static int8_t set_xy_rep(const struct bmm150_settings *settings, struct bmm150_d
 
     /* Set the xy repetition */
     rep_xy = settings->xy_rep;
-    rslt = bmm150_set_regs(BMM150_REG_REP_XY, &rep_xy, 1, dev);
+    rslt = write_shadowed_reg(BMM150_REG_REP_XY, rep_xy, dev);
 
     return rslt;
 }
@@ -1375,7 +1531,7 @@ static int8_t set_z_rep(const struct bmm150_settings *settings, struct bmm150_de
 
     /* Set the z repetition */
     rep_z = settings->z_rep;
-    rslt = bmm150_set_regs(BMM150_REG_REP_Z, &rep_z, 1, dev);
+    rslt = write_shadowed_reg(BMM150_REG_REP_Z, rep_z, dev);
 
     return rslt;
 }
@@ -1389,13 +1545,13 @@ static int8_t set_odr(const struct bmm150_settings *settings, struct bmm150_dev
     uint8_t reg_data;
 
     /* Read the 0x4C register */
-    rslt = bmm150_get_regs(BMM150_REG_OP_MODE, &reg_data, 1, dev);
+    rslt = read_shadowed_reg(BMM150_REG_OP_MODE, &reg_data, dev);
 
     if (rslt == BMM150_OK)
     {
         /* Set the ODR value */
         reg_data = BMM150_SET_BITS(reg_data, BMM150_ODR, settings->data_rate);
-        rslt = bmm150_set_regs(BMM150_REG_OP_MODE, &reg_data, 1, dev);
+        rslt = write_shadowed_reg(BMM150_REG_OP_MODE, reg_data, dev);
     }
 
     return rslt;
@@ -1435,13 +1591,13 @@ static int8_t set_control_measurement_xyz(const struct bmm150_settings *settings
     int8_t rslt;
     uint8_t reg_data;
 
-    rslt = bmm150_get_regs(BMM150_REG_AXES_ENABLE, &reg_data, 1, dev);
+    rslt = read_shadowed_reg(BMM150_REG_AXES_ENABLE, &reg_data, dev);
 
     if (rslt == BMM150_OK)
     {
         /* Set the axes to be enabled/disabled */
         reg_data = BMM150_SET_BITS(reg_data, BMM150_CONTROL_MEASURE, settings->xyz_axes_control);
-        rslt = bmm150_set_regs(BMM150_REG_AXES_ENABLE, &reg_data, 1, dev);
+        rslt = write_shadowed_reg(BMM150_REG_AXES_ENABLE, reg_data, dev);
     }
 
     return rslt;
@@ -1543,7 +1699,7 @@ static int8_t interrupt_pin_settings(uint16_t desired_settings,
     uint8_t reg_data;
     struct bmm150_int_ctrl_settings int_settings;
 
-    rslt = bmm150_get_regs(BMM150_REG_AXES_ENABLE, &reg_data, 1, dev);
+    rslt = read_shadowed_reg(BMM150_REG_AXES_ENABLE, &reg_data, dev);
 
     if (rslt == BMM150_OK)
     {
@@ -1581,7 +1737,7 @@ static int8_t interrupt_pin_settings(uint16_t desired_settings,
         }
 
         /* Set the interrupt configurations in the 0x4E register */
-        rslt = bmm150_set_regs(BMM150_REG_AXES_ENABLE, &reg_data, 1, dev);
+        rslt = write_shadowed_reg(BMM150_REG_AXES_ENABLE, reg_data, dev);
     }
 
     return rslt;
@@ -1600,7 +1756,7 @@ static int8_t interrupt_config(uint16_t desired_settings, const struct bmm150_se
     uint8_t reg_data;
     struct bmm150_int_ctrl_settings int_settings;
 
-    rslt = bmm150_get_regs(BMM150_REG_INT_CONFIG, &reg_data, 1, dev);
+    rslt = read_shadowed_reg(BMM150_REG_INT_CONFIG, &reg_data, dev);
 
     if (rslt == BMM150_OK)
     {
@@ -1630,7 +1786,7 @@ static int8_t interrupt_config(uint16_t desired_settings, const struct bmm150_se
         }
 
         /* Set the interrupt configurations in the 0x4D register */
-        rslt = bmm150_set_regs(BMM150_REG_INT_CONFIG, &reg_data, 1, dev);
+        rslt = write_shadowed_reg(BMM150_REG_INT_CONFIG, reg_data, dev);
     }
 
     return rslt;
@@ -1674,7 +1830,7 @@ static int8_t interrupt_threshold_settings(uint16_t desired_settings,
 
         /* Sets the Low threshold value to trigger interrupt */
         reg_data = (uint8_t)settings->int_settings.low_threshold;
-        rslt = bmm150_set_regs(BMM150_REG_LOW_THRESHOLD, &reg_data, 1, dev);
+        rslt = write_shadowed_reg(BMM150_REG_LOW_THRESHOLD, reg_data, dev);
     }
 
     if (desired_settings & BMM150_SEL_HIGH_THRESHOLD_SETTING)
@@ -1688,7 +1844,7 @@ static int8_t interrupt_threshold_settings(uint16_t desired_settings,
 
         /* Sets the High threshold value to trigger interrupt */
         reg_data = (uint8_t)settings->int_settings.high_threshold;
-        rslt = bmm150_set_regs(BMM150_REG_HIGH_THRESHOLD, &reg_data, 1, dev);
+        rslt = write_shadowed_reg(BMM150_REG_HIGH_THRESHOLD, reg_data, dev);
     }
 
     return rslt;
@@ -2075,7 +2231,7 @@ static int8_t enable_normal_self_test(uint8_t *self_test_enable, struct bmm150_d
     uint8_t self_test_val;
 
     /* Read the data from register 0x4C */
-    rslt = bmm150_get_regs(BMM150_REG_OP_MODE, &reg_data, 1, dev);
+    rslt = read_shadowed_reg(BMM150_REG_OP_MODE, &reg_data, dev);
 
     if (rslt == BMM150_OK)
     {
@@ -2084,7 +2240,7 @@ static int8_t enable_normal_self_test(uint8_t *self_test_enable, struct bmm150_d
         reg_data = BMM150_SET_BITS_POS_0(reg_data, BMM150_SELF_TEST, self_test_val);
 
         /* Write the data to 0x4C register to trigger self test */
-        rslt = bmm150_set_regs(BMM150_REG_OP_MODE, &reg_data, 1, dev);
+        rslt = write_shadowed_reg(BMM150_REG_OP_MODE, reg_data, dev);
         dev->delay_us(BMM150_DELAY_NORMAL_SELF_TEST, dev->intf_ptr);
 
         if (rslt == BMM150_OK)
@@ -2319,7 +2475,7 @@ static int8_t set_adv_self_test_current(uint8_t self_test_current, struct bmm150
     uint8_t reg_data;
 
     /* Read the 0x4C register */
-    rslt = bmm150_get_regs(BMM150_REG_OP_MODE, &reg_data, 1, dev);
+    rslt = read_shadowed_reg(BMM150_REG_OP_MODE, &reg_data, dev);
 
     if (rslt == BMM150_OK)
     {
@@ -2327,8 +2483,91 @@ static int8_t set_adv_self_test_current(uint8_t self_test_current, struct bmm150
          * (bit6 and bit7) of 0x4c register
          */
         reg_data = BMM150_SET_BITS(reg_data, BMM150_ADV_SELF_TEST, self_test_current);
-        rslt = bmm150_set_regs(BMM150_REG_OP_MODE, &reg_data, 1, dev);
+        rslt = write_shadowed_reg(BMM150_REG_OP_MODE, reg_data, dev);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API returns the value of a settings register from the
+ * register shadow, falling back to a bus read when the shadow is not valid.
+ */
+static int8_t read_shadowed_reg(uint8_t reg_addr, uint8_t *reg_data, struct bmm150_dev *dev)
+{
+    int8_t rslt = BMM150_OK;
+
+    if (dev->reg_shadow.valid == BMM150_TRUE)
+    {
+        /* No bus transaction required */
+        *reg_data = dev->reg_shadow.regs[BMM150_SHADOW_IDX(reg_addr)];
+    }
+    else
+    {
+        rslt = bmm150_get_regs(reg_addr, reg_data, 1, dev);
     }
 
     return rslt;
 }
+
+/*!
+ * @brief This internal API writes a settings register and updates the
+ * register shadow on success.
+ */
+static int8_t write_shadowed_reg(uint8_t reg_addr, uint8_t reg_data, struct bmm150_dev *dev)
+{
+    int8_t rslt;
+
+    rslt = bmm150_set_regs(reg_addr, &reg_data, 1, dev);
+
+    if (rslt == BMM150_OK)
+    {
+        dev->reg_shadow.regs[BMM150_SHADOW_IDX(reg_addr)] = shadow_reg_image(reg_addr, reg_data);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API returns the value to be kept in the register shadow
+ * for the written/read register value.
+ */
+static uint8_t shadow_reg_image(uint8_t reg_addr, uint8_t reg_data)
+{
+    if (reg_addr == BMM150_REG_POWER_CONTROL)
+    {
+        /* Soft reset bits are cleared by the sensor */
+        reg_data = reg_data & (uint8_t)~BMM150_SET_SOFT_RESET;
+    }
+    else if (reg_addr == BMM150_REG_OP_MODE)
+    {
+        /* Normal self test bit is cleared by the sensor */
+        reg_data = BMM150_SET_BITS_POS_0(reg_data, BMM150_SELF_TEST, 0);
+
+        /* Sensor returns to sleep mode after a forced mode measurement */
+        if (BMM150_GET_BITS(reg_data, BMM150_OP_MODE) == BMM150_POWERMODE_FORCED)
+        {
+            reg_data = BMM150_SET_BITS(reg_data, BMM150_OP_MODE, BMM150_POWERMODE_SLEEP);
+        }
+    }
+
+    return reg_data;
+}
+
+/*!
+ * @brief This internal API stores the settings registers 0x4B to 0x52 read
+ * from the sensor in the register shadow.
+ */
+static void store_reg_shadow(const uint8_t *reg_data, struct bmm150_dev *dev)
+{
+    uint8_t idx;
+
+    for (idx = 0; idx < BMM150_LEN_SETTING_DATA; idx++)
+    {
+        dev->reg_shadow.regs[idx] = shadow_reg_image(BMM150_REG_POWER_CONTROL + idx, reg_data[idx]);
+    }
+
+    /* Registers other than 0x4B are only accessible out of suspend mode */
+    dev->pwr_cntrl_bit = BMM150_GET_BITS_POS_0(reg_data[0], BMM150_PWR_CNTRL);
+    dev->reg_shadow.valid = (dev->pwr_cntrl_bit == BMM150_POWER_CNTRL_ENABLE) ? BMM150_TRUE : BMM150_FALSE;
+}
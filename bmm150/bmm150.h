@@ -324,6 +324,56 @@ int8_t bmm150_set_sensor_settings(uint16_t desired_settings, struct bmm150_setti
  */
 int8_t bmm150_get_sensor_settings(struct bmm150_settings *settings, struct bmm150_dev *dev);
 
+/**
+ * \ingroup bmm150
+ * \defgroup bmm150ApiRegShadow Register shadow
+ * @brief Keep the settings registers mirrored in the device structure
+ */
+
+/*!
+ * \ingroup bmm150ApiRegShadow
+ * \page bmm150_api_bmm150_refresh_reg_shadow bmm150_refresh_reg_shadow
+ * \code
+ * int8_t bmm150_refresh_reg_shadow(struct bmm150_dev *dev);
+ * \endcode
+ * @details This API reads the settings registers 0x4B to 0x52 in one burst
+ * and refreshes the register shadow in the dev structure. The shadow lets
+ * the settings APIs skip reading a register back before modifying it.
+ *
+ * @param[in,out] dev   : Structure instance of bmm150_dev.
+ *
+ * @note The shadow is populated by bmm150_init and kept up to date by the
+ * driver. Call this API only if the registers were changed outside the
+ * driver, e.g. through bmm150_set_regs or a sensor power cycle.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval >0 -> Warning
+ * @retval <0 -> Fail
+ */
+int8_t bmm150_refresh_reg_shadow(struct bmm150_dev *dev);
+
+/*!
+ * \ingroup bmm150ApiRegShadow
+ * \page bmm150_api_bmm150_check_reg_shadow bmm150_check_reg_shadow
+ * \code
+ * int8_t bmm150_check_reg_shadow(uint8_t *mismatch, struct bmm150_dev *dev);
+ * \endcode
+ * @details This API reads the settings registers 0x4B to 0x52 and compares
+ * them against the register shadow. The shadow is not modified.
+ *
+ * @param[out] mismatch : Bit n is set if register (0x4B + n) differs from
+ *                        the shadow. All bits are set if the shadow is not
+ *                        valid.
+ * @param[in] dev       : Structure instance of bmm150_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success, shadow is consistent
+ * @retval 9 -> BMM150_W_REG_SHADOW_MISMATCH
+ * @retval <0 -> Fail
+ */
+int8_t bmm150_check_reg_shadow(uint8_t *mismatch, struct bmm150_dev *dev);
+
 /**
  * \ingroup bmm150
  * \defgroup bmm150ApiMagData Read magnetometer data
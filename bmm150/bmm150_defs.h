@@ -143,6 +143,7 @@
 #define BMM150_W_NORMAL_SELF_TEST_X_FAIL          INT8_C(6)
 #define BMM150_W_NORMAL_SELF_TEST_XYZ_FAIL        INT8_C(7)
 #define BMM150_W_ADV_SELF_TEST_FAIL               INT8_C(8)
+#define BMM150_W_REG_SHADOW_MISMATCH              INT8_C(9)
 
 /*! @name CHIP ID & SOFT RESET VALUES      */
 #define BMM150_CHIP_ID                            UINT8_C(0x32)
@@ -365,6 +366,10 @@
 #define BMM150_ADV_SELF_TEST_MSK                  UINT8_C(0xC0)
 #define BMM150_ADV_SELF_TEST_POS                  UINT8_C(0x06)
 
+/*! @name Register shadow macros */
+#define BMM150_SHADOW_IDX(reg_addr)               ((reg_addr) - BMM150_REG_POWER_CONTROL)
+#define BMM150_SHADOW_ALL_REGS                    UINT8_C(0xFF)
+
 /*! @name Register read lengths  */
 #define BMM150_LEN_SELF_TEST                      UINT8_C(5)
 #define BMM150_LEN_SETTING_DATA                   UINT8_C(8)
@@ -637,6 +642,18 @@ struct bmm150_mag_data
 
 #endif
 
+/*!
+ * @brief bmm150 register shadow of the settings registers 0x4B to 0x52
+ */
+struct bmm150_reg_shadow
+{
+    /*! Register images indexed by BMM150_SHADOW_IDX(reg_addr) */
+    uint8_t regs[BMM150_LEN_SETTING_DATA];
+
+    /*! BMM150_TRUE when regs mirror the sensor registers */
+    uint8_t valid;
+};
+
 /*!
  * @brief bmm150 device structure
  */
@@ -673,6 +690,9 @@ struct bmm150_dev
 
     /*! Power control bit value */
     uint8_t pwr_cntrl_bit;
+
+    /*! Shadow of the settings registers, used to avoid read-modify-write */
+    struct bmm150_reg_shadow reg_shadow;
 };
 
 #endif /* BMM150_DEFS_H_ */
@@ -0,0 +1,200 @@
+/**\
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include <stdio.h>
+#include "bmm150.h"
+#include "common.h"
+
+/******************************************************************************/
+/*!                            Macros                                         */
+
+/* Macro to hold the number of times each settings change is repeated */
+#define LOOP_COUNT  UINT8_C(10)
+
+/******************************************************************************/
+/*!                Static variable definition                                 */
+
+/*! Bus read/write functions assigned by bmm150_interface_selection */
+static bmm150_read_fptr_t bus_read;
+static bmm150_write_fptr_t bus_write;
+
+/*! Number of bus transactions issued by the driver */
+static uint32_t read_count;
+static uint32_t write_count;
+
+/******************************************************************************/
+/*!         Static Function Declaration                                       */
+
+/*!
+ *  @brief Bus read function which counts the read transactions.
+ */
+static BMM150_INTF_RET_TYPE counting_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t length, void *intf_ptr);
+
+/*!
+ *  @brief Bus write function which counts the write transactions.
+ */
+static BMM150_INTF_RET_TYPE counting_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t length,
+                                           void *intf_ptr);
+
+/*!
+ *  @brief This internal API applies a typical set of settings changes and
+ *  prints the bus transactions it took.
+ *
+ *  @param[in] use_shadow : BMM150_TRUE to use the register shadow,
+ *                          BMM150_FALSE to force read-modify-write.
+ *  @param[in] dev        : Structure instance of bmm150_dev.
+ *
+ *  @return Status of execution.
+ */
+static int8_t run_settings_changes(uint8_t use_shadow, struct bmm150_dev *dev);
+
+/******************************************************************************/
+/*!            Functions                                        */
+
+/* This function starts the execution of program. */
+int main(void)
+{
+    /* Status of api are returned to this variable */
+    int8_t rslt;
+
+    /* Registers which differ from the shadow */
+    uint8_t mismatch = 0;
+
+    /* Sensor initialization configuration. */
+    struct bmm150_dev dev = { 0 };
+
+    /* Interface selection is to be updated as parameter
+     * For I2C :  BMM150_I2C_INTF
+     * For SPI :  BMM150_SPI_INTF
+     */
+    rslt = bmm150_interface_selection(&dev, BMM150_SPI_INTF);
+    bmm150_error_codes_print_result("bmm150_interface_selection", rslt);
+
+    if (rslt == BMM150_OK)
+    {
+        /* Route the driver bus accesses through the counters */
+        bus_read = dev.read;
+        bus_write = dev.write;
+        dev.read = counting_read;
+        dev.write = counting_write;
+
+        rslt = bmm150_init(&dev);
+        bmm150_error_codes_print_result("bmm150_init", rslt);
+
+        if (rslt == BMM150_OK)
+        {
+            printf("Bus transactions per settings change (%d iterations)\n\n", LOOP_COUNT);
+
+            /* Before: every settings change reads the register back */
+            rslt = run_settings_changes(BMM150_FALSE, &dev);
+            bmm150_error_codes_print_result("run_settings_changes", rslt);
+        }
+
+        if (rslt == BMM150_OK)
+        {
+            rslt = bmm150_refresh_reg_shadow(&dev);
+            bmm150_error_codes_print_result("bmm150_refresh_reg_shadow", rslt);
+        }
+
+        if (rslt == BMM150_OK)
+        {
+            /* After: settings changes are write-only */
+            rslt = run_settings_changes(BMM150_TRUE, &dev);
+            bmm150_error_codes_print_result("run_settings_changes", rslt);
+        }
+
+        if (rslt == BMM150_OK)
+        {
+            rslt = bmm150_check_reg_shadow(&mismatch, &dev);
+            bmm150_error_codes_print_result("bmm150_check_reg_shadow", rslt);
+
+            printf("\nRegister shadow mismatch mask : 0x%02x\n", mismatch);
+        }
+    }
+
+    bmm150_coines_deinit();
+
+    return rslt;
+}
+
+/*!
+ *  @brief Bus read function which counts the read transactions.
+ */
+static BMM150_INTF_RET_TYPE counting_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t length, void *intf_ptr)
+{
+    read_count++;
+
+    return bus_read(reg_addr, reg_data, length, intf_ptr);
+}
+
+/*!
+ *  @brief Bus write function which counts the write transactions.
+ */
+static BMM150_INTF_RET_TYPE counting_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t length,
+                                           void *intf_ptr)
+{
+    write_count++;
+
+    return bus_write(reg_addr, reg_data, length, intf_ptr);
+}
+
+/*!
+ *  @brief This internal API applies a typical set of settings changes and
+ *  prints the bus transactions it took.
+ */
+static int8_t run_settings_changes(uint8_t use_shadow, struct bmm150_dev *dev)
+{
+    /* Status of api are returned to this variable. */
+    int8_t rslt = BMM150_OK;
+    uint8_t loop;
+    uint16_t desired_settings;
+
+    struct bmm150_settings settings = { 0 };
+
+    read_count = 0;
+    write_count = 0;
+
+    for (loop = 0; (loop < LOOP_COUNT) && (rslt == BMM150_OK); loop++)
+    {
+        if (use_shadow == BMM150_FALSE)
+        {
+            /* Forces the driver back to read-modify-write */
+            dev->reg_shadow.valid = BMM150_FALSE;
+        }
+
+        settings.pwr_mode = BMM150_POWERMODE_NORMAL;
+        rslt = bmm150_set_op_mode(&settings, dev);
+
+        if (rslt == BMM150_OK)
+        {
+            settings.preset_mode = (loop & 1) ? BMM150_PRESETMODE_REGULAR : BMM150_PRESETMODE_LOWPOWER;
+            rslt = bmm150_set_presetmode(&settings, dev);
+        }
+
+        if (rslt == BMM150_OK)
+        {
+            desired_settings = BMM150_SEL_DRDY_PIN_EN | BMM150_SEL_INT_PIN_EN | BMM150_SEL_DRDY_POLARITY |
+                               BMM150_SEL_DATA_OVERRUN_INT | BMM150_SEL_HIGH_THRESHOLD_INT |
+                               BMM150_SEL_HIGH_THRESHOLD_SETTING;
+
+            settings.int_settings.drdy_pin_en = BMM150_INT_ENABLE;
+            settings.int_settings.int_pin_en = BMM150_INT_ENABLE;
+            settings.int_settings.drdy_polarity = BMM150_ACTIVE_HIGH_POLARITY;
+            settings.int_settings.data_overrun_en = BMM150_INT_ENABLE;
+            settings.int_settings.high_int_en = BMM150_THRESHOLD_X;
+            settings.int_settings.high_threshold = 100;
+            rslt = bmm150_set_sensor_settings(desired_settings, &settings, dev);
+        }
+    }
+
+    printf("%-22s : %lu reads, %lu writes, %lu transactions per iteration\n",
+           (use_shadow == BMM150_TRUE) ? "With register shadow" : "Read-modify-write",
+           (long unsigned int)read_count,
+           (long unsigned int)write_count,
+           (long unsigned int)((read_count + write_count) / LOOP_COUNT));
+
+    return rslt;
+}
@@ -0,0 +1,236 @@
+/**
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @file    capture_ring.c
+ * @date    Oct 18, 2026
+ * @brief   Zero-copy DMA capture buffers handed over by ownership
+ */
+
+/**********************************************************************************/
+/* own header files */
+/**********************************************************************************/
+#include "capture_ring.h"
+
+/**********************************************************************************/
+/* macro definitions */
+/**********************************************************************************/
+/*! Position of a free running queue index */
+#define QUEUE_POS(idx)  ((uint8_t)((idx) & (CAPTURE_RING_MAX_BUFS - 1)))
+
+/**********************************************************************************/
+/* static function declarations */
+/**********************************************************************************/
+
+/*!
+ * @brief Finds the number of a buffer from its data, n_bufs if it is not one.
+ */
+static uint8_t buffer_index(const uint32_t *data, const struct capture_ring *ring);
+
+/**********************************************************************************/
+/* functions */
+/**********************************************************************************/
+
+/*!
+ * @brief This API initializes a ring over the given storage, all buffers free.
+ */
+int8_t capture_ring_init(uint32_t *buf, uint16_t buf_words, uint8_t n_bufs, struct capture_ring *ring)
+{
+    uint8_t idx;
+
+    if ((buf == NULL) || (ring == NULL))
+    {
+        return CAPTURE_RING_E_NULL_PTR;
+    }
+
+    if ((buf_words == 0) || (n_bufs < 3) || (n_bufs > CAPTURE_RING_MAX_BUFS))
+    {
+        return CAPTURE_RING_E_INVALID_CFG;
+    }
+
+    ring->buf = buf;
+    ring->buf_words = buf_words;
+    ring->n_bufs = n_bufs;
+    ring->filled_head = 0;
+    ring->filled_tail = 0;
+    ring->next_seq = 0;
+    ring->stats.n_buffers = 0;
+    ring->stats.n_overruns = 0;
+    ring->stats.n_released = 0;
+    ring->stats.max_waiting = 0;
+
+    for (idx = 0; idx < n_bufs; idx++)
+    {
+        ring->free_q[idx] = idx;
+        ring->seq[idx] = 0;
+        ring->time_us[idx] = 0;
+        ring->held[idx] = 0;
+    }
+
+    ring->free_tail = 0;
+    ring->free_head = n_bufs;
+
+    return CAPTURE_RING_OK;
+}
+
+/*!
+ * @brief This API takes a free buffer for the DMA.
+ */
+uint32_t *capture_ring_start(struct capture_ring *ring)
+{
+    uint8_t idx;
+
+    if ((ring == NULL) || (ring->buf == NULL) || (ring->free_head == ring->free_tail))
+    {
+        return NULL;
+    }
+
+    idx = ring->free_q[QUEUE_POS(ring->free_tail)];
+    CAPTURE_RING_BARRIER();
+    ring->free_tail++;
+
+    return &ring->buf[idx * ring->buf_words];
+}
+
+/*!
+ * @brief This API queues the buffer released by the DMA to the consumer and
+ * returns the buffer to hand to the DMA next.
+ */
+uint32_t *capture_ring_next(const uint32_t *released, uint32_t time_us, struct capture_ring *ring)
+{
+    uint8_t idx;
+    uint8_t next;
+    uint8_t waiting;
+
+    if ((ring == NULL) || (ring->buf == NULL))
+    {
+        return NULL;
+    }
+
+    idx = buffer_index(released, ring);
+    if (idx >= ring->n_bufs)
+    {
+        return NULL;
+    }
+
+    /* The consumer holds every other buffer: keep writing into this one */
+    if (ring->free_head == ring->free_tail)
+    {
+        ring->next_seq++;
+        ring->stats.n_overruns++;
+
+        return &ring->buf[idx * ring->buf_words];
+    }
+
+    next = ring->free_q[QUEUE_POS(ring->free_tail)];
+    CAPTURE_RING_BARRIER();
+    ring->free_tail++;
+
+    ring->seq[idx] = ring->next_seq++;
+    ring->time_us[idx] = time_us;
+    ring->filled_q[QUEUE_POS(ring->filled_head)] = idx;
+    CAPTURE_RING_BARRIER();
+    ring->filled_head++;
+    ring->stats.n_buffers++;
+
+    waiting = (uint8_t)(ring->filled_head - ring->filled_tail);
+    if (waiting > ring->stats.max_waiting)
+    {
+        ring->stats.max_waiting = waiting;
+    }
+
+    return &ring->buf[next * ring->buf_words];
+}
+
+/*!
+ * @brief This API takes the oldest filled buffer.
+ */
+int8_t capture_ring_get(struct capture_ring_block *block, struct capture_ring *ring)
+{
+    uint8_t idx;
+
+    if ((block == NULL) || (ring == NULL) || (ring->buf == NULL))
+    {
+        return CAPTURE_RING_E_NULL_PTR;
+    }
+
+    if (ring->filled_head == ring->filled_tail)
+    {
+        return CAPTURE_RING_W_EMPTY;
+    }
+
+    CAPTURE_RING_BARRIER();
+    idx = ring->filled_q[QUEUE_POS(ring->filled_tail)];
+    block->data = &ring->buf[idx * ring->buf_words];
+    block->seq = ring->seq[idx];
+    block->time_us = ring->time_us[idx];
+    ring->held[idx] = 1;
+    CAPTURE_RING_BARRIER();
+    ring->filled_tail++;
+
+    return CAPTURE_RING_OK;
+}
+
+/*!
+ * @brief This API gives a buffer back for the DMA.
+ */
+int8_t capture_ring_release(const uint32_t *data, struct capture_ring *ring)
+{
+    uint8_t idx;
+
+    if ((data == NULL) || (ring == NULL) || (ring->buf == NULL))
+    {
+        return CAPTURE_RING_E_NULL_PTR;
+    }
+
+    /* Only a buffer the consumer holds goes back, once: a second release or
+     * one of a buffer the DMA owns would hand the same buffer out twice
+     */
+    idx = buffer_index(data, ring);
+    if ((idx >= ring->n_bufs) || (ring->held[idx] == 0) ||
+        ((uint8_t)(ring->free_head - ring->free_tail) >= ring->n_bufs))
+    {
+        return CAPTURE_RING_E_INVALID_CFG;
+    }
+
+    ring->held[idx] = 0;
+    ring->free_q[QUEUE_POS(ring->free_head)] = idx;
+    CAPTURE_RING_BARRIER();
+    ring->free_head++;
+    ring->stats.n_released++;
+
+    return CAPTURE_RING_OK;
+}
+
+/*!
+ * @brief This API returns the number of filled buffers waiting for the consumer.
+ */
+uint8_t capture_ring_count(const struct capture_ring *ring)
+{
+    if (ring == NULL)
+    {
+        return 0;
+    }
+
+    return (uint8_t)(ring->filled_head - ring->filled_tail);
+}
+
+/*!
+ * @brief Finds the number of a buffer from its data, n_bufs if it is not one.
+ */
+static uint8_t buffer_index(const uint32_t *data, const struct capture_ring *ring)
+{
+    size_t offset;
+
+    if ((data == NULL) || (data < ring->buf))
+    {
+        return ring->n_bufs;
+    }
+
+    offset = (size_t)(data - ring->buf);
+    if (((offset % ring->buf_words) != 0) || ((offset / ring->buf_words) >= ring->n_bufs))
+    {
+        return ring->n_bufs;
+    }
+
+    return (uint8_t)(offset / ring->buf_words);
+}
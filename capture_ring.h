@@ -0,0 +1,202 @@
+/**
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @file    capture_ring.h
+ * @date    Oct 18, 2026
+ * @brief   Zero-copy DMA capture buffers handed over by ownership
+ *
+ * A DMA driver of the double buffered kind (nRF I2S) owns two buffers, the one
+ * being filled and the next one. When a buffer is released by the DMA it is
+ * queued to the consumer and a free buffer is handed to the DMA in its place.
+ * A buffer goes back to the DMA only after the consumer released it, so a slow
+ * consumer never reads a buffer being overwritten.
+ *
+ * If no buffer is free the released one is handed straight back to the DMA
+ * and its data is dropped: an overrun. Every buffer released by the DMA takes
+ * a sequence number, dropped ones included, so the consumer sees overruns as
+ * gaps.
+ *
+ * Concurrency: the DMA interrupt calls capture_ring_start and
+ * capture_ring_next, one consumer calls capture_ring_get and
+ * capture_ring_release. Each queue of buffer indices has one writer per index,
+ * as in rx_ring, so no interrupt masking is needed.
+ */
+#ifndef CAPTURE_RING_H_
+#define CAPTURE_RING_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**********************************************************************************/
+/* macro definitions */
+/**********************************************************************************/
+/*! Maximum number of buffers, a power of two */
+#define CAPTURE_RING_MAX_BUFS     (8)
+
+/*! Compiler barrier, orders the queue entry before the index which publishes it */
+#ifndef CAPTURE_RING_BARRIER
+#define CAPTURE_RING_BARRIER()    __asm__ volatile ("" ::: "memory")
+#endif
+
+/*! Status codes */
+#define CAPTURE_RING_OK            INT8_C(0)
+#define CAPTURE_RING_E_NULL_PTR    INT8_C(-1)
+#define CAPTURE_RING_E_INVALID_CFG INT8_C(-2)
+
+/*! Warning: no filled buffer is waiting */
+#define CAPTURE_RING_W_EMPTY       INT8_C(1)
+
+/**********************************************************************************/
+/* data structure declarations  */
+/**********************************************************************************/
+
+/*!
+ * @brief Filled buffer, owned by the consumer until released
+ */
+struct capture_ring_block
+{
+    /*! Data, buf_words words */
+    const uint32_t *data;
+
+    /*! Sequence number, a gap tells how many buffers were dropped */
+    uint32_t seq;
+
+    /*! Time the DMA released the buffer, as passed to capture_ring_next */
+    uint32_t time_us;
+};
+
+/*!
+ * @brief Counters of a capture ring
+ */
+struct capture_ring_stats
+{
+    /*! Buffers queued to the consumer */
+    uint32_t n_buffers;
+
+    /*! Buffers dropped because none was free */
+    uint32_t n_overruns;
+
+    /*! Buffers given back by the consumer */
+    uint32_t n_released;
+
+    /*! Most buffers waiting for the consumer at once */
+    uint8_t max_waiting;
+};
+
+/*!
+ * @brief Capture ring
+ */
+struct capture_ring
+{
+    /*! Buffer storage, n_bufs * buf_words words */
+    uint32_t *buf;
+
+    /*! Words per buffer */
+    uint16_t buf_words;
+
+    /*! Number of buffers */
+    uint8_t n_bufs;
+
+    /*! Free buffers: head written by the consumer, tail by the interrupt */
+    uint8_t free_q[CAPTURE_RING_MAX_BUFS];
+    volatile uint8_t free_head;
+    volatile uint8_t free_tail;
+
+    /*! Filled buffers: head written by the interrupt, tail by the consumer */
+    uint8_t filled_q[CAPTURE_RING_MAX_BUFS];
+    volatile uint8_t filled_head;
+    volatile uint8_t filled_tail;
+
+    /*! Sequence number and time of each buffer, written by the interrupt */
+    uint32_t seq[CAPTURE_RING_MAX_BUFS];
+    uint32_t time_us[CAPTURE_RING_MAX_BUFS];
+
+    /*! Buffers taken by capture_ring_get and not released yet, written by the consumer */
+    uint8_t held[CAPTURE_RING_MAX_BUFS];
+
+    /*! Sequence number of the next buffer released by the DMA */
+    uint32_t next_seq;
+
+    /*! Counters, n_released written by the consumer, the others by the interrupt */
+    struct capture_ring_stats stats;
+};
+
+/**********************************************************************************/
+/* functions */
+/**********************************************************************************/
+
+/*!
+ * @brief This API initializes a ring over the given storage, all buffers free.
+ *
+ * @param[in] buf       : Storage of n_bufs * buf_words words.
+ * @param[in] buf_words : Words per buffer.
+ * @param[in] n_bufs    : Number of buffers, 3 to CAPTURE_RING_MAX_BUFS: two for
+ *                        the DMA, at least one for the consumer.
+ * @param[out] ring     : Ring.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t capture_ring_init(uint32_t *buf, uint16_t buf_words, uint8_t n_bufs, struct capture_ring *ring);
+
+/*!
+ * @brief This API takes a free buffer for the DMA, when it is started and when it
+ * asks for its next buffer the first time.
+ *
+ * @param[in,out] ring : Ring.
+ *
+ * @return Buffer, NULL if none is free
+ */
+uint32_t *capture_ring_start(struct capture_ring *ring);
+
+/*!
+ * @brief This API queues the buffer released by the DMA to the consumer and
+ * returns the buffer to hand to the DMA next. DMA interrupt.
+ *
+ * @param[in] released : Buffer the DMA has filled.
+ * @param[in] time_us  : Current time, stored with the buffer.
+ * @param[in,out] ring : Ring.
+ *
+ * @return Next buffer of the DMA; released itself on an overrun, NULL if
+ *         released is not a buffer of the ring
+ */
+uint32_t *capture_ring_next(const uint32_t *released, uint32_t time_us, struct capture_ring *ring);
+
+/*!
+ * @brief This API takes the oldest filled buffer, consumer side.
+ *
+ * @param[out] block   : Buffer, owned until capture_ring_release.
+ * @param[in,out] ring : Ring.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval > 0 -> Warning, CAPTURE_RING_W_EMPTY: no buffer is waiting
+ * @retval < 0 -> Fail
+ */
+int8_t capture_ring_get(struct capture_ring_block *block, struct capture_ring *ring);
+
+/*!
+ * @brief This API gives a buffer back for the DMA, consumer side.
+ *
+ * @param[in] data     : Data of a block from capture_ring_get.
+ * @param[in,out] ring : Ring.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval CAPTURE_RING_E_INVALID_CFG -> data is not a buffer the consumer holds,
+ *                                       e.g. it was released already
+ * @retval < 0 -> Fail
+ */
+int8_t capture_ring_release(const uint32_t *data, struct capture_ring *ring);
+
+/*!
+ * @brief This API returns the number of filled buffers waiting for the consumer.
+ *
+ * @param[in] ring : Ring.
+ *
+ * @return Number of buffers
+ */
+uint8_t capture_ring_count(const struct capture_ring *ring);
+
+#endif /* CAPTURE_RING_H_ */
@@ -0,0 +1,136 @@
+/**
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @file    event_queue.c
+ * @date    Oct 18, 2026
+ * @brief   Lock-free queue of time stamped interrupt events
+ */
+
+/**********************************************************************************/
+/* system header includes */
+/**********************************************************************************/
+#include <string.h>
+
+/**********************************************************************************/
+/* own header files */
+/**********************************************************************************/
+#include "event_queue.h"
+
+/**********************************************************************************/
+/* functions */
+/**********************************************************************************/
+
+/*!
+ * @brief This API initializes a queue over the given storage.
+ */
+int8_t event_queue_init(struct event_queue_event *buf, uint32_t size, struct event_queue *queue)
+{
+    int8_t rslt = EVENT_QUEUE_OK;
+
+    if ((buf == NULL) || (queue == NULL))
+    {
+        rslt = EVENT_QUEUE_E_NULL_PTR;
+    }
+    else if ((size < 2) || ((size & (size - 1)) != 0))
+    {
+        rslt = EVENT_QUEUE_E_INVALID_CFG;
+    }
+    else
+    {
+        memset(queue, 0, sizeof(*queue));
+        queue->buf = buf;
+        queue->mask = size - 1;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API stores an event, producer side.
+ */
+int8_t event_queue_put(const struct event_queue_event *event, struct event_queue *queue)
+{
+    struct event_queue_event *slot;
+    uint32_t head;
+    uint32_t used;
+
+    if ((event == NULL) || (queue == NULL) || (queue->buf == NULL))
+    {
+        return EVENT_QUEUE_E_NULL_PTR;
+    }
+
+    head = queue->head;
+    used = head - queue->tail;
+
+    if (used > queue->mask)
+    {
+        queue->stats.n_overflows++;
+        queue->overflowed = 1;
+
+        return EVENT_QUEUE_W_FULL;
+    }
+
+    slot = &queue->buf[head & queue->mask];
+    *slot = *event;
+    slot->flags = queue->overflowed ? EVENT_QUEUE_FLAG_OVERFLOW : 0;
+    queue->overflowed = 0;
+
+    EVENT_QUEUE_BARRIER();
+    queue->head = head + 1;
+
+    queue->stats.n_events++;
+    if ((used + 1) > queue->stats.max_used)
+    {
+        queue->stats.max_used = used + 1;
+    }
+
+    return EVENT_QUEUE_OK;
+}
+
+/*!
+ * @brief This API takes out up to n events, oldest first, consumer side.
+ */
+uint32_t event_queue_get(struct event_queue_event *events, uint32_t n, struct event_queue *queue)
+{
+    uint32_t tail;
+    uint32_t avail;
+    uint32_t idx;
+
+    if ((events == NULL) || (queue == NULL) || (queue->buf == NULL))
+    {
+        return 0;
+    }
+
+    tail = queue->tail;
+    avail = queue->head - tail;
+    EVENT_QUEUE_BARRIER();
+
+    if (n > avail)
+    {
+        n = avail;
+    }
+
+    for (idx = 0; idx < n; idx++)
+    {
+        events[idx] = queue->buf[(tail + idx) & queue->mask];
+    }
+
+    /* The slots are handed back only once they are copied out */
+    EVENT_QUEUE_BARRIER();
+    queue->tail = tail + n;
+
+    return n;
+}
+
+/*!
+ * @brief This API returns the number of queued events.
+ */
+uint32_t event_queue_count(const struct event_queue *queue)
+{
+    if (queue == NULL)
+    {
+        return 0;
+    }
+
+    return queue->head - queue->tail;
+}
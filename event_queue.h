@@ -0,0 +1,148 @@
+/**
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @file    event_queue.h
+ * @date    Oct 18, 2026
+ * @brief   Lock-free queue of time stamped interrupt events
+ *
+ * The GPIO interrupt is the only producer and writes head, the main loop is the
+ * only consumer and writes tail, as in rx_ring. Events are taken out in the
+ * order of their edges. A full queue drops the new event and counts it; the
+ * next event stored carries EVENT_QUEUE_FLAG_OVERFLOW so the consumer knows
+ * where edges are missing.
+ */
+#ifndef EVENT_QUEUE_H_
+#define EVENT_QUEUE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**********************************************************************************/
+/* macro definitions */
+/**********************************************************************************/
+/*! Compiler barrier, orders the event before the index which publishes it */
+#ifndef EVENT_QUEUE_BARRIER
+#define EVENT_QUEUE_BARRIER()     __asm__ volatile ("" ::: "memory")
+#endif
+
+/*! Event flags */
+#define EVENT_QUEUE_FLAG_OVERFLOW UINT8_C(0x01)
+
+/*! Status codes */
+#define EVENT_QUEUE_OK            INT8_C(0)
+#define EVENT_QUEUE_E_NULL_PTR    INT8_C(-1)
+#define EVENT_QUEUE_E_INVALID_CFG INT8_C(-2)
+#define EVENT_QUEUE_W_FULL        INT8_C(1)
+
+/**********************************************************************************/
+/* data structure declarations  */
+/**********************************************************************************/
+
+/*!
+ * @brief Interrupt event
+ */
+struct event_queue_event
+{
+    /*! Time of the edge in microseconds */
+    uint64_t timestamp_us;
+
+    /*! Pin of the edge */
+    uint8_t pin;
+
+    /*! Edge type */
+    uint8_t edge;
+
+    /*! EVENT_QUEUE_FLAG_* */
+    uint8_t flags;
+};
+
+/*!
+ * @brief Counters of a queue
+ */
+struct event_queue_stats
+{
+    /*! Events stored */
+    uint32_t n_events;
+
+    /*! Events dropped because the queue was full */
+    uint32_t n_overflows;
+
+    /*! Highest number of queued events */
+    uint32_t max_used;
+};
+
+/*!
+ * @brief Event queue
+ */
+struct event_queue
+{
+    /*! Storage, size events */
+    struct event_queue_event *buf;
+
+    /*! Size - 1, the size is a power of two */
+    uint32_t mask;
+
+    /*! Free running count of stored events, written by the producer */
+    volatile uint32_t head;
+
+    /*! Free running count of consumed events, written by the consumer */
+    volatile uint32_t tail;
+
+    /*! The last event was dropped, written by the producer */
+    uint8_t overflowed;
+
+    /*! Counters, written by the producer */
+    struct event_queue_stats stats;
+};
+
+/**********************************************************************************/
+/* functions */
+/**********************************************************************************/
+
+/*!
+ * @brief This API initializes a queue over the given storage.
+ *
+ * @param[in] buf    : Storage.
+ * @param[in] size   : Number of events of the storage, a power of two.
+ * @param[out] queue : Queue.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t event_queue_init(struct event_queue_event *buf, uint32_t size, struct event_queue *queue);
+
+/*!
+ * @brief This API stores an event, producer side.
+ *
+ * @param[in] event     : Event, its flags are set by the queue.
+ * @param[in,out] queue : Queue.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval > 0 -> Warning, EVENT_QUEUE_W_FULL: the event was dropped
+ * @retval < 0 -> Fail
+ */
+int8_t event_queue_put(const struct event_queue_event *event, struct event_queue *queue);
+
+/*!
+ * @brief This API takes out up to n events, oldest first, consumer side.
+ *
+ * @param[out] events   : Destination.
+ * @param[in] n         : Most events to take.
+ * @param[in,out] queue : Queue.
+ *
+ * @return Number of events taken
+ */
+uint32_t event_queue_get(struct event_queue_event *events, uint32_t n, struct event_queue *queue);
+
+/*!
+ * @brief This API returns the number of queued events.
+ *
+ * @param[in] queue : Queue.
+ *
+ * @return Number of events
+ */
+uint32_t event_queue_count(const struct event_queue *queue);
+
+#endif /* EVENT_QUEUE_H_ */
@@ -0,0 +1,570 @@
+/**
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @file    flash_log.c
+ * @date    Oct 18, 2026
+ * @brief   Buffered binary logging to flash, writer and recovery reader
+ */
+
+/**********************************************************************************/
+/* system header includes */
+/**********************************************************************************/
+#include <string.h>
+
+/**********************************************************************************/
+/* own header files */
+/**********************************************************************************/
+#include "flash_log.h"
+#include "sample_stream.h"
+
+/**********************************************************************************/
+/* local macro definitions */
+/**********************************************************************************/
+/*! Record overhead: type, length and the longest varint */
+#define RECORD_OVERHEAD     (2 + 5)
+
+/*! Block sizes a reader accepts, as log2 */
+#define MIN_BLOCK_SIZE_LOG2 (9)
+#define MAX_BLOCK_SIZE_LOG2 (15)
+
+#if ((FLASH_LOG_BLOCK_SIZE & (FLASH_LOG_BLOCK_SIZE - 1)) != 0) || \
+    (FLASH_LOG_BLOCK_SIZE < (1 << MIN_BLOCK_SIZE_LOG2)) || (FLASH_LOG_BLOCK_SIZE > (1 << MAX_BLOCK_SIZE_LOG2))
+#error "FLASH_LOG_BLOCK_SIZE must be a power of two from 512 to 32768"
+#endif
+
+#if ((FLASH_LOG_INDEX_ENTRIES % 2) != 0) || (FLASH_LOG_INDEX_ENTRIES < 2) || \
+    (FLASH_LOG_INDEX_ENTRIES > FLASH_LOG_INDEX_MAX)
+#error "FLASH_LOG_INDEX_ENTRIES must be even, from 2 to FLASH_LOG_INDEX_MAX"
+#endif
+
+/**********************************************************************************/
+/* static function declarations */
+/**********************************************************************************/
+
+/*!
+ * @brief Completes the header of the block being filled and hands it to the consumer.
+ */
+static void seal_block(struct flash_log *log);
+
+/*!
+ * @brief Adds a block just written to the index, merging entries when it is full.
+ */
+static void index_block(const uint8_t *block, struct flash_log *log);
+
+/*!
+ * @brief Returns log2 of the block size.
+ */
+static uint8_t block_size_log2(void);
+
+/*!
+ * @brief Checks the block at the start of data, returns its size or 0 if it is not valid.
+ */
+static uint32_t check_block(const uint8_t *data, uint32_t len);
+
+/*!
+ * @brief Hands the records of a valid block to the callback.
+ */
+static void scan_records(const uint8_t *block, flash_log_record_fptr_t cb, void *cb_ptr,
+                         struct flash_log_scan_stats *stats);
+
+/*!
+ * @brief Little endian and varint helpers.
+ */
+static void put_u16(uint8_t *buf, uint16_t val);
+static void put_u32(uint8_t *buf, uint32_t val);
+static uint16_t get_u16(const uint8_t *buf);
+static uint32_t get_u32(const uint8_t *buf);
+static uint8_t put_varint(uint8_t *buf, uint32_t val);
+static uint8_t get_varint(const uint8_t *buf, uint16_t len, uint32_t *val);
+
+/**********************************************************************************/
+/* functions */
+/**********************************************************************************/
+
+/*!
+ * @brief This API initializes a writer.
+ */
+int8_t flash_log_init(flash_log_write_fptr_t write, void *intf_ptr, struct flash_log *log)
+{
+    int8_t rslt = FLASH_LOG_OK;
+
+    if ((write == NULL) || (log == NULL))
+    {
+        rslt = FLASH_LOG_E_NULL_PTR;
+    }
+    else
+    {
+        memset(log, 0, sizeof(*log));
+        log->write = write;
+        log->intf_ptr = intf_ptr;
+        log->stride = 1;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API stores a record, producer side.
+ */
+int8_t flash_log_put(uint8_t type, uint32_t time, const uint8_t *data, uint8_t len, struct flash_log *log)
+{
+    uint8_t *rec;
+    uint32_t dt;
+
+    if ((log == NULL) || ((data == NULL) && (len != 0)))
+    {
+        return FLASH_LOG_E_NULL_PTR;
+    }
+
+    /* A time going back, a wrapped counter, would leave the index unsorted */
+    if ((type == 0) || ((log->stats.n_records != 0) && (time < log->prev_time)))
+    {
+        return FLASH_LOG_E_INVALID_CFG;
+    }
+
+    /* Seal a block which cannot take the longest form of this record */
+    if ((log->n_records != 0) && ((log->fill_len + RECORD_OVERHEAD + len) > FLASH_LOG_MAX_PAYLOAD))
+    {
+        seal_block(log);
+    }
+
+    /* Still waiting for the flash after the last seal */
+    if (log->sealed[log->fill])
+    {
+        log->stats.n_dropped++;
+        log->dropped = 1;
+
+        return FLASH_LOG_W_DROPPED;
+    }
+
+    dt = (log->n_records == 0) ? 0 : (time - log->prev_time);
+    if (log->n_records == 0)
+    {
+        put_u32(&log->block[log->fill][12], time);
+    }
+
+    log->sensor_mask |= UINT32_C(1) << ((type - 1) & 0x1F);
+
+    rec = &log->block[log->fill][FLASH_LOG_HEADER_LEN + log->fill_len];
+    rec[0] = type;
+    rec[1] = len;
+    log->fill_len += 2;
+    log->fill_len += put_varint(&rec[2], dt);
+    memcpy(&log->block[log->fill][FLASH_LOG_HEADER_LEN + log->fill_len], data, len);
+    log->fill_len += len;
+
+    log->n_records++;
+    log->prev_time = time;
+    log->stats.n_records++;
+
+    return FLASH_LOG_OK;
+}
+
+/*!
+ * @brief This API writes the sealed blocks to the flash, consumer side.
+ */
+uint8_t flash_log_process(struct flash_log *log)
+{
+    uint8_t n_written = 0;
+
+    if (log == NULL)
+    {
+        return 0;
+    }
+
+    while (log->sealed[log->drain])
+    {
+        FLASH_LOG_BARRIER();
+        if (log->write(log->block[log->drain], FLASH_LOG_BLOCK_SIZE, log->intf_ptr) == 0)
+        {
+            /* Indexed by position in the file, a lost block leaves no gap */
+            index_block(log->block[log->drain], log);
+            log->stats.n_blocks++;
+            n_written++;
+        }
+        else
+        {
+            /* The producer must not stall on a failing file, the block is given up */
+            log->stats.n_write_errors++;
+        }
+
+        FLASH_LOG_BARRIER();
+        log->sealed[log->drain] = 0;
+        log->drain = (uint8_t)((log->drain + 1) % FLASH_LOG_N_BLOCKS);
+    }
+
+    return n_written;
+}
+
+/*!
+ * @brief This API seals the block being filled and writes all blocks.
+ */
+int8_t flash_log_flush(struct flash_log *log)
+{
+    uint32_t n_errors;
+
+    if (log == NULL)
+    {
+        return FLASH_LOG_E_NULL_PTR;
+    }
+
+    n_errors = log->stats.n_write_errors;
+
+    if ((log->n_records != 0) && !log->sealed[log->fill])
+    {
+        seal_block(log);
+    }
+
+    (void)flash_log_process(log);
+
+    return (log->stats.n_write_errors == n_errors) ? FLASH_LOG_OK : FLASH_LOG_E_COM_FAIL;
+}
+
+/*!
+ * @brief This API flushes the log and appends the index.
+ */
+int8_t flash_log_finish(struct flash_log *log)
+{
+    int8_t rslt;
+    uint8_t *buf;
+    uint16_t crc = 0xFFFF;
+    uint16_t len = 0;
+    uint16_t idx;
+
+    rslt = flash_log_flush(log);
+    if (log == NULL)
+    {
+        return rslt;
+    }
+
+    /* Every block is written, the first one serves as scratch for the index */
+    buf = log->block[0];
+    for (idx = 0; idx <= log->n_index; idx++)
+    {
+        if (idx < log->n_index)
+        {
+            put_u32(&buf[len], log->index[idx].first_block);
+            put_u32(&buf[len + 4], log->index[idx].first_time);
+            put_u32(&buf[len + 8], log->index[idx].last_time);
+            put_u32(&buf[len + 12], log->index[idx].sensor_mask);
+            put_u32(&buf[len + 16], log->index[idx].n_records);
+            len += FLASH_LOG_INDEX_ENTRY_LEN;
+        }
+        else
+        {
+            crc = sample_stream_crc16_update(crc, buf, len);
+            memcpy(&buf[len], FLASH_LOG_INDEX_MAGIC, 4);
+            buf[len + 4] = FLASH_LOG_VERSION;
+            buf[len + 5] = block_size_log2();
+            put_u16(&buf[len + 6], log->n_index);
+            put_u32(&buf[len + 8], log->stride);
+            put_u32(&buf[len + 12], log->stats.n_blocks);
+            put_u16(&buf[len + 16], 0);
+            crc = sample_stream_crc16_update(crc, &buf[len], FLASH_LOG_FOOTER_LEN - 2);
+            put_u16(&buf[len + 18], crc);
+            len += FLASH_LOG_FOOTER_LEN;
+        }
+
+        /* Written in pieces of whole entries, the footer always fits after the last */
+        if ((idx == log->n_index) || ((len + FLASH_LOG_INDEX_ENTRY_LEN + FLASH_LOG_FOOTER_LEN) > FLASH_LOG_BLOCK_SIZE))
+        {
+            if (idx < log->n_index)
+            {
+                crc = sample_stream_crc16_update(crc, buf, len);
+            }
+
+            if (log->write(buf, len, log->intf_ptr) != 0)
+            {
+                log->stats.n_write_errors++;
+                rslt = FLASH_LOG_E_COM_FAIL;
+            }
+
+            len = 0;
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads back a log, handing every record of the valid blocks to the callback.
+ */
+int8_t flash_log_scan(const uint8_t *data,
+                      uint32_t len,
+                      flash_log_record_fptr_t cb,
+                      void *cb_ptr,
+                      struct flash_log_scan_stats *stats)
+{
+    uint32_t offset = 0;
+    uint32_t block_size;
+    uint32_t seq;
+    uint32_t prev_seq = 0;
+    uint8_t seq_valid = 0;
+
+    if ((data == NULL) || (stats == NULL))
+    {
+        return FLASH_LOG_E_NULL_PTR;
+    }
+
+    memset(stats, 0, sizeof(*stats));
+
+    while ((offset + FLASH_LOG_HEADER_LEN) <= len)
+    {
+        block_size = check_block(&data[offset], len - offset);
+        if (block_size == 0)
+        {
+            /* Resynchronize on the next header, byte by byte */
+            stats->n_skipped++;
+            offset++;
+            continue;
+        }
+
+        seq = get_u32(&data[offset + 8]);
+        if (seq_valid && ((seq - prev_seq) > 1) && ((int32_t)(seq - prev_seq) > 0))
+        {
+            stats->n_lost_blocks += seq - prev_seq - 1;
+        }
+
+        prev_seq = seq;
+        seq_valid = 1;
+
+        if (data[offset + 6] & FLASH_LOG_FLAG_DROPPED)
+        {
+            stats->n_dropped_marks++;
+        }
+
+        stats->n_blocks++;
+        scan_records(&data[offset], cb, cb_ptr, stats);
+
+        /* A block cut short by the end of the file is the last one */
+        offset += block_size;
+    }
+
+    stats->n_skipped += (offset < len) ? (len - offset) : 0;
+
+    return FLASH_LOG_OK;
+}
+
+/*!
+ * @brief Completes the header of the block being filled and hands it to the consumer.
+ */
+static void seal_block(struct flash_log *log)
+{
+    uint8_t *block = log->block[log->fill];
+    uint32_t n_sealed = 0;
+    uint8_t idx;
+
+    memset(&block[FLASH_LOG_HEADER_LEN + log->fill_len], FLASH_LOG_PAD, FLASH_LOG_MAX_PAYLOAD - log->fill_len);
+
+    block[0] = FLASH_LOG_SYNC_0;
+    block[1] = FLASH_LOG_SYNC_1;
+    block[4] = FLASH_LOG_VERSION;
+    block[5] = block_size_log2();
+    block[6] = log->dropped ? FLASH_LOG_FLAG_DROPPED : 0;
+    block[7] = 0;
+    put_u32(&block[8], log->seq);
+    put_u32(&block[16], log->prev_time);
+    put_u32(&block[20], log->sensor_mask);
+    put_u16(&block[24], log->fill_len);
+    put_u16(&block[26], log->n_records);
+    put_u16(&block[2], sample_stream_crc16(&block[4], (uint16_t)(FLASH_LOG_HEADER_LEN - 4 + log->fill_len)));
+
+    FLASH_LOG_BARRIER();
+    log->sealed[log->fill] = 1;
+
+    log->seq++;
+    log->dropped = 0;
+    log->fill_len = 0;
+    log->n_records = 0;
+    log->sensor_mask = 0;
+    log->fill = (uint8_t)((log->fill + 1) % FLASH_LOG_N_BLOCKS);
+
+    for (idx = 0; idx < FLASH_LOG_N_BLOCKS; idx++)
+    {
+        n_sealed += log->sealed[idx];
+    }
+
+    if (n_sealed > log->stats.max_sealed)
+    {
+        log->stats.max_sealed = n_sealed;
+    }
+}
+
+/*!
+ * @brief Adds a block just written to the index, merging entries when it is full.
+ */
+static void index_block(const uint8_t *block, struct flash_log *log)
+{
+    struct flash_log_index_entry *entry;
+    uint32_t block_nr = log->stats.n_blocks;
+    uint16_t idx;
+
+    if ((block_nr / log->stride) >= FLASH_LOG_INDEX_ENTRIES)
+    {
+        for (idx = 0; idx < (FLASH_LOG_INDEX_ENTRIES / 2); idx++)
+        {
+            log->index[idx] = log->index[2 * idx];
+            log->index[idx].last_time = log->index[2 * idx + 1].last_time;
+            log->index[idx].sensor_mask |= log->index[2 * idx + 1].sensor_mask;
+            log->index[idx].n_records += log->index[2 * idx + 1].n_records;
+        }
+
+        log->n_index = FLASH_LOG_INDEX_ENTRIES / 2;
+        log->stride *= 2;
+    }
+
+    entry = &log->index[block_nr / log->stride];
+    if ((block_nr / log->stride) == log->n_index)
+    {
+        entry->first_block = block_nr;
+        entry->first_time = get_u32(&block[12]);
+        entry->sensor_mask = 0;
+        entry->n_records = 0;
+        log->n_index++;
+    }
+
+    entry->last_time = get_u32(&block[16]);
+    entry->sensor_mask |= get_u32(&block[20]);
+    entry->n_records += get_u16(&block[26]);
+}
+
+/*!
+ * @brief Returns log2 of the block size.
+ */
+static uint8_t block_size_log2(void)
+{
+    uint8_t size_log2 = 0;
+
+    while ((1UL << size_log2) < FLASH_LOG_BLOCK_SIZE)
+    {
+        size_log2++;
+    }
+
+    return size_log2;
+}
+
+/*!
+ * @brief Checks the block at the start of data, returns its size or 0 if it is not valid.
+ */
+static uint32_t check_block(const uint8_t *data, uint32_t len)
+{
+    uint32_t block_size;
+    uint16_t payload_len;
+
+    if ((data[0] != FLASH_LOG_SYNC_0) || (data[1] != FLASH_LOG_SYNC_1) || (data[4] != FLASH_LOG_VERSION) ||
+        (data[5] < MIN_BLOCK_SIZE_LOG2) || (data[5] > MAX_BLOCK_SIZE_LOG2))
+    {
+        return 0;
+    }
+
+    block_size = 1UL << data[5];
+    payload_len = get_u16(&data[24]);
+    if ((payload_len > (block_size - FLASH_LOG_HEADER_LEN)) || ((FLASH_LOG_HEADER_LEN + (uint32_t)payload_len) > len))
+    {
+        return 0;
+    }
+
+    if (sample_stream_crc16(&data[4], (uint16_t)(FLASH_LOG_HEADER_LEN - 4 + payload_len)) != get_u16(&data[2]))
+    {
+        return 0;
+    }
+
+    return block_size;
+}
+
+/*!
+ * @brief Hands the records of a valid block to the callback.
+ */
+static void scan_records(const uint8_t *block, flash_log_record_fptr_t cb, void *cb_ptr,
+                         struct flash_log_scan_stats *stats)
+{
+    const uint8_t *rec = &block[FLASH_LOG_HEADER_LEN];
+    uint16_t payload_len = get_u16(&block[24]);
+    uint16_t n_records = get_u16(&block[26]);
+    uint32_t time = get_u32(&block[12]);
+    uint16_t pos = 0;
+    uint16_t idx;
+    uint32_t dt;
+    uint8_t used;
+    uint8_t len;
+
+    for (idx = 0; (idx < n_records) && ((pos + 3) <= payload_len); idx++)
+    {
+        len = rec[pos + 1];
+        used = get_varint(&rec[pos + 2], (uint16_t)(payload_len - pos - 2), &dt);
+        if ((used == 0) || ((pos + 2 + used + len) > payload_len))
+        {
+            break;
+        }
+
+        time += dt;
+        if (cb != NULL)
+        {
+            cb(rec[pos], time, &rec[pos + 2 + used], len, cb_ptr);
+        }
+
+        stats->n_records++;
+        pos = (uint16_t)(pos + 2 + used + len);
+    }
+}
+
+static void put_u16(uint8_t *buf, uint16_t val)
+{
+    buf[0] = (uint8_t)val;
+    buf[1] = (uint8_t)(val >> 8);
+}
+
+static void put_u32(uint8_t *buf, uint32_t val)
+{
+    buf[0] = (uint8_t)val;
+    buf[1] = (uint8_t)(val >> 8);
+    buf[2] = (uint8_t)(val >> 16);
+    buf[3] = (uint8_t)(val >> 24);
+}
+
+static uint16_t get_u16(const uint8_t *buf)
+{
+    return (uint16_t)(buf[0] | (buf[1] << 8));
+}
+
+static uint32_t get_u32(const uint8_t *buf)
+{
+    return (uint32_t)buf[0] | ((uint32_t)buf[1] << 8) | ((uint32_t)buf[2] << 16) | ((uint32_t)buf[3] << 24);
+}
+
+static uint8_t put_varint(uint8_t *buf, uint32_t val)
+{
+    uint8_t len = 0;
+
+    while (val >= 0x80)
+    {
+        buf[len++] = (uint8_t)(val | 0x80);
+        val >>= 7;
+    }
+
+    buf[len++] = (uint8_t)val;
+
+    return len;
+}
+
+/*!
+ * @brief Returns the number of bytes used, 0 if the varint does not end within len.
+ */
+static uint8_t get_varint(const uint8_t *buf, uint16_t len, uint32_t *val)
+{
+    uint8_t used = 0;
+    uint8_t shift = 0;
+
+    *val = 0;
+    while ((used < len) && (used < 5))
+    {
+        *val |= (uint32_t)(buf[used] & 0x7F) << shift;
+        shift += 7;
+        if ((buf[used++] & 0x80) == 0)
+        {
+            return used;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,320 @@
+/**
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @file    flash_log.h
+ * @date    Oct 18, 2026
+ * @brief   Buffered binary logging to flash, writer and recovery reader
+ *
+ * Records are collected in RAM blocks of FLASH_LOG_BLOCK_SIZE bytes, a multiple
+ * of the flash page. A full block is sealed and handed to the write callback by
+ * flash_log_process, called from the main loop, while the producer goes on
+ * filling the next block. If every block is waiting for the flash the record is
+ * dropped and counted, the producer never waits.
+ *
+ * Every block is written whole, padded with 0xFF, and starts with a header
+ * which doubles as sync marker, all fields little endian:
+ *
+ *   0     sync, 0xA5 0x5A
+ *   2     CRC-16/CCITT-FALSE of bytes 4 to 28+n-1, u16
+ *   4     format version, FLASH_LOG_VERSION
+ *   5     log2 of the block size
+ *   6     flags, FLASH_LOG_FLAG_*
+ *   7     reserved, 0
+ *   8     block sequence number, u32
+ *   12    time of the first record, u32
+ *   16    time of the last record, u32
+ *   20    sensor mask, bit (type - 1) % 32 set for every record type present, u32
+ *   24    payload length n, u16
+ *   26    number of records, u16
+ *   28    records
+ *
+ * A record is: u8 type (not 0), u8 data length, varint time delta to the
+ * previous record of the block (0 for the first), data. Records never cross
+ * blocks, so after a power loss the reader resynchronizes on the next valid
+ * header and only the block being written is lost.
+ *
+ * While writing, the consumer keeps an index of at most FLASH_LOG_INDEX_ENTRIES
+ * entries, each summing up stride consecutive blocks. When it is full, pairs of
+ * entries are merged and the stride doubles, so the RAM used does not grow with
+ * the log. flash_log_finish appends the index after the last block:
+ *
+ *   n x   index entry, FLASH_LOG_INDEX_ENTRY_LEN bytes:
+ *         0 first block u32, 4 first time u32, 8 last time u32,
+ *         12 sensor mask u32, 16 number of records u32
+ *   0     magic, "FLIX"
+ *   4     format version, FLASH_LOG_VERSION
+ *   5     log2 of the block size
+ *   6     number of index entries n, u16
+ *   8     stride, blocks per index entry, u32
+ *   12    number of blocks, u32
+ *   16    reserved, 0
+ *   18    CRC-16/CCITT-FALSE of the index entries and footer bytes 0 to 17, u16
+ *
+ * The footer ends the file, so a reader finds the index from the file size and
+ * seeks to a time range without reading the blocks before it. A log without
+ * footer, cut by a power loss, is still read by flash_log_scan.
+ */
+#ifndef FLASH_LOG_H_
+#define FLASH_LOG_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**********************************************************************************/
+/* macro definitions */
+/**********************************************************************************/
+/*! Block size in bytes, a power of two and a multiple of the flash page */
+#ifndef FLASH_LOG_BLOCK_SIZE
+#define FLASH_LOG_BLOCK_SIZE        (2048)
+#endif
+
+/*! Number of RAM blocks, two for double buffering */
+#ifndef FLASH_LOG_N_BLOCKS
+#define FLASH_LOG_N_BLOCKS          (2)
+#endif
+
+/*! Index entries kept in RAM, even, up to FLASH_LOG_INDEX_MAX */
+#ifndef FLASH_LOG_INDEX_ENTRIES
+#define FLASH_LOG_INDEX_ENTRIES     (256)
+#endif
+
+/*! Compiler barrier, orders the block contents before the flag which hands it over */
+#ifndef FLASH_LOG_BARRIER
+#define FLASH_LOG_BARRIER()         __asm__ volatile ("" ::: "memory")
+#endif
+
+/*! Block layout */
+#define FLASH_LOG_SYNC_0            UINT8_C(0xA5)
+#define FLASH_LOG_SYNC_1            UINT8_C(0x5A)
+#define FLASH_LOG_VERSION           UINT8_C(2)
+#define FLASH_LOG_HEADER_LEN        (28)
+#define FLASH_LOG_MAX_PAYLOAD       (FLASH_LOG_BLOCK_SIZE - FLASH_LOG_HEADER_LEN)
+#define FLASH_LOG_PAD               UINT8_C(0xFF)
+
+/*! Index layout */
+#define FLASH_LOG_INDEX_MAGIC       "FLIX"
+#define FLASH_LOG_INDEX_ENTRY_LEN   (20)
+#define FLASH_LOG_FOOTER_LEN        (20)
+#define FLASH_LOG_INDEX_MAX         (2048)
+
+/*! Longest record data */
+#define FLASH_LOG_MAX_DATA          (255)
+
+/*! Block flags: records were dropped between the previous block and this one */
+#define FLASH_LOG_FLAG_DROPPED      UINT8_C(0x01)
+
+/*! Status codes */
+#define FLASH_LOG_OK                INT8_C(0)
+#define FLASH_LOG_E_NULL_PTR        INT8_C(-1)
+#define FLASH_LOG_E_INVALID_CFG     INT8_C(-2)
+#define FLASH_LOG_E_COM_FAIL        INT8_C(-3)
+#define FLASH_LOG_W_DROPPED         INT8_C(1)
+
+/**********************************************************************************/
+/* data structure declarations  */
+/**********************************************************************************/
+
+/*!
+ * @brief Writes one block to the log file
+ *
+ * @return 0 on success
+ */
+typedef int8_t (*flash_log_write_fptr_t)(const uint8_t *data, uint16_t len, void *intf_ptr);
+
+/*!
+ * @brief Counters of a writer
+ */
+struct flash_log_stats
+{
+    /*! Records stored */
+    uint32_t n_records;
+
+    /*! Records dropped because every block was waiting for the flash */
+    uint32_t n_dropped;
+
+    /*! Blocks written */
+    uint32_t n_blocks;
+
+    /*! Blocks the write callback failed on, they are lost */
+    uint32_t n_write_errors;
+
+    /*! Most blocks waiting for the flash at once */
+    uint32_t max_sealed;
+};
+
+/*!
+ * @brief Index entry, sums up stride consecutive blocks
+ */
+struct flash_log_index_entry
+{
+    /*! Number of the first block in the file */
+    uint32_t first_block;
+
+    /*! Time of the first and of the last record */
+    uint32_t first_time;
+    uint32_t last_time;
+
+    /*! Record types present, bit (type - 1) % 32 */
+    uint32_t sensor_mask;
+
+    /*! Number of records */
+    uint32_t n_records;
+};
+
+/*!
+ * @brief Writer
+ */
+struct flash_log
+{
+    /*! RAM blocks */
+    uint8_t block[FLASH_LOG_N_BLOCKS][FLASH_LOG_BLOCK_SIZE];
+
+    /*! Block is sealed and waits for the flash, set by the producer, cleared by the consumer */
+    volatile uint8_t sealed[FLASH_LOG_N_BLOCKS];
+
+    /*! Block being filled, payload bytes, records and time of the last record, producer */
+    uint8_t fill;
+    uint16_t fill_len;
+    uint16_t n_records;
+    uint32_t prev_time;
+    uint32_t sensor_mask;
+
+    /*! Records were dropped since the last block was sealed, producer */
+    uint8_t dropped;
+
+    /*! Sequence number of the next block, producer */
+    uint32_t seq;
+
+    /*! Next block to write, consumer */
+    uint8_t drain;
+
+    /*! Index of the blocks written, entries used and blocks per entry, consumer */
+    struct flash_log_index_entry index[FLASH_LOG_INDEX_ENTRIES];
+    uint16_t n_index;
+    uint32_t stride;
+
+    /*! Writes a block */
+    flash_log_write_fptr_t write;
+
+    /*! Passed to write */
+    void *intf_ptr;
+
+    /*! Counters */
+    struct flash_log_stats stats;
+};
+
+/*!
+ * @brief Receives a record found by flash_log_scan
+ */
+typedef void (*flash_log_record_fptr_t)(uint8_t type, uint32_t time, const uint8_t *data, uint8_t len, void *cb_ptr);
+
+/*!
+ * @brief Counters of a scan
+ */
+struct flash_log_scan_stats
+{
+    /*! Valid blocks and their records */
+    uint32_t n_blocks;
+    uint32_t n_records;
+
+    /*! Blocks missing according to the sequence numbers */
+    uint32_t n_lost_blocks;
+
+    /*! Blocks announcing dropped records */
+    uint32_t n_dropped_marks;
+
+    /*! Bytes skipped while looking for a valid header */
+    uint32_t n_skipped;
+};
+
+/**********************************************************************************/
+/* functions */
+/**********************************************************************************/
+
+/*!
+ * @brief This API initializes a writer.
+ *
+ * @param[in] write    : Writes a block to the log file.
+ * @param[in] intf_ptr : Passed to write.
+ * @param[out] log     : Writer.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t flash_log_init(flash_log_write_fptr_t write, void *intf_ptr, struct flash_log *log);
+
+/*!
+ * @brief This API stores a record, producer side. Never waits for the flash.
+ *
+ * @param[in] type    : Record type, 1 to 255.
+ * @param[in] time    : Time of the record, in any unit, non decreasing over the
+ *                      whole log: a wrapping counter such as the 24 bit
+ *                      sensortime must be extended to 32 bits by the caller.
+ * @param[in] data    : Record data.
+ * @param[in] len     : Length of data, up to FLASH_LOG_MAX_DATA.
+ * @param[in,out] log : Writer.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval > 0 -> Warning, FLASH_LOG_W_DROPPED: no free block, the record is dropped
+ * @retval < 0 -> Fail, FLASH_LOG_E_INVALID_CFG also for a time before that of
+ *                the previous record
+ */
+int8_t flash_log_put(uint8_t type, uint32_t time, const uint8_t *data, uint8_t len, struct flash_log *log);
+
+/*!
+ * @brief This API writes the sealed blocks to the flash, consumer side. Main loop.
+ *
+ * @param[in,out] log : Writer.
+ *
+ * @return Number of blocks written
+ */
+uint8_t flash_log_process(struct flash_log *log);
+
+/*!
+ * @brief This API seals the block being filled and writes all blocks, before the
+ * file is closed. The producer must be stopped.
+ *
+ * @param[in,out] log : Writer.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail, a block could not be written
+ */
+int8_t flash_log_flush(struct flash_log *log);
+
+/*!
+ * @brief This API flushes the log and appends the index, before the file is
+ * closed. The producer must be stopped, nothing can be added afterwards.
+ *
+ * @param[in,out] log : Writer.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail, a block or the index could not be written
+ */
+int8_t flash_log_finish(struct flash_log *log);
+
+/*!
+ * @brief This API reads back a log, or what is left of it, handing every record
+ * of the valid blocks to the callback in order. The index appended by
+ * flash_log_finish is not a block and counts as skipped bytes.
+ *
+ * @param[in] data     : Log file contents.
+ * @param[in] len      : Length of data.
+ * @param[in] cb       : Receives the records.
+ * @param[in] cb_ptr   : Passed to cb.
+ * @param[out] stats   : Counters of the scan.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t flash_log_scan(const uint8_t *data,
+                      uint32_t len,
+                      flash_log_record_fptr_t cb,
+                      void *cb_ptr,
+                      struct flash_log_scan_stats *stats);
+
+#endif /* FLASH_LOG_H_ */
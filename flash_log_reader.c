@@ -0,0 +1,409 @@
+/**
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @file    flash_log_reader.c
+ * @date    Oct 18, 2026
+ * @brief   Host reader of flash logs, seeks to a time range through the index
+ */
+
+/**********************************************************************************/
+/* system header includes */
+/**********************************************************************************/
+#include <string.h>
+
+/**********************************************************************************/
+/* own header files */
+/**********************************************************************************/
+#include "flash_log_reader.h"
+#include "sample_stream.h"
+
+/**********************************************************************************/
+/* data structure declarations  */
+/**********************************************************************************/
+
+/*!
+ * @brief Range filter between flash_log_scan and the caller
+ */
+struct range_filter
+{
+    uint32_t from;
+    uint32_t to;
+    uint32_t sensor_mask;
+    flash_log_record_fptr_t cb;
+    void *cb_ptr;
+    uint32_t n_records;
+};
+
+/**********************************************************************************/
+/* static function declarations */
+/**********************************************************************************/
+
+/*!
+ * @brief Reads the footer and the index, returns FLASH_LOG_OK if they are valid.
+ */
+static int8_t load_index(uint32_t file_len, struct flash_log_file *file);
+
+/*!
+ * @brief Reads len bytes at offset, returns the number of bytes read.
+ */
+static uint32_t read_at(uint32_t offset, uint8_t *buf, uint32_t len, struct flash_log_file *file);
+
+/*!
+ * @brief Reads the header of a block, returns 1 if it looks valid.
+ */
+static uint8_t read_header(uint32_t block_nr, uint8_t *header, struct flash_log_file *file);
+
+/*!
+ * @brief Returns the first block from lo to hi - 1 ending at or after from, hi if none.
+ */
+static uint32_t find_block(uint32_t from, uint32_t lo, uint32_t hi, struct flash_log_file *file);
+
+/*!
+ * @brief Hands the records of the range to the caller.
+ */
+static void filter_record(uint8_t type, uint32_t time, const uint8_t *data, uint8_t len, void *cb_ptr);
+
+/*!
+ * @brief Little endian helpers.
+ */
+static uint16_t get_u16(const uint8_t *buf);
+static uint32_t get_u32(const uint8_t *buf);
+
+/**********************************************************************************/
+/* functions */
+/**********************************************************************************/
+
+/*!
+ * @brief This API opens a log file and loads its index.
+ */
+int8_t flash_log_file_open(const char *path, struct flash_log_file *file)
+{
+    int8_t rslt = FLASH_LOG_OK;
+    uint8_t header[FLASH_LOG_HEADER_LEN];
+    long file_len;
+
+    if ((path == NULL) || (file == NULL))
+    {
+        return FLASH_LOG_E_NULL_PTR;
+    }
+
+    memset(file, 0, sizeof(*file));
+    file->fp = fopen(path, "rb");
+    if (file->fp == NULL)
+    {
+        return FLASH_LOG_E_COM_FAIL;
+    }
+
+    if (fseek(file->fp, 0, SEEK_END) != 0)
+    {
+        rslt = FLASH_LOG_E_COM_FAIL;
+    }
+    else
+    {
+        file_len = ftell(file->fp);
+        if ((file_len < 0) || ((unsigned long)file_len > UINT32_MAX))
+        {
+            rslt = FLASH_LOG_E_COM_FAIL;
+        }
+        else if (load_index((uint32_t)file_len, file) != FLASH_LOG_OK)
+        {
+            /* No index, the block size comes from the first header */
+            file->n_index = 0;
+            if ((read_at(0, header, FLASH_LOG_HEADER_LEN, file) != FLASH_LOG_HEADER_LEN) ||
+                (header[0] != FLASH_LOG_SYNC_0) || (header[1] != FLASH_LOG_SYNC_1) ||
+                (header[4] != FLASH_LOG_VERSION) || (header[5] < 9) || (header[5] > 15))
+            {
+                rslt = FLASH_LOG_E_INVALID_CFG;
+            }
+            else
+            {
+                file->block_size = UINT32_C(1) << header[5];
+                file->n_blocks = (uint32_t)((file_len + file->block_size - 1) / file->block_size);
+                rslt = FLASH_LOG_W_NO_INDEX;
+            }
+        }
+    }
+
+    if (rslt < FLASH_LOG_OK)
+    {
+        flash_log_file_close(file);
+    }
+
+    memset(&file->stats, 0, sizeof(file->stats));
+
+    return rslt;
+}
+
+/*!
+ * @brief This API hands the records from time from to time to to the callback in order.
+ */
+int8_t flash_log_file_read(uint32_t from,
+                           uint32_t to,
+                           uint32_t sensor_mask,
+                           flash_log_record_fptr_t cb,
+                           void *cb_ptr,
+                           struct flash_log_file *file)
+{
+    struct range_filter filter;
+    struct flash_log_scan_stats scan_stats;
+    struct flash_log_index_entry *entry;
+    uint8_t *block;
+    uint32_t block_nr;
+    uint32_t len;
+    uint16_t lo;
+    uint16_t hi;
+    uint16_t mid;
+
+    if ((file == NULL) || (file->fp == NULL))
+    {
+        return FLASH_LOG_E_NULL_PTR;
+    }
+
+    filter.from = from;
+    filter.to = to;
+    filter.sensor_mask = sensor_mask;
+    filter.cb = cb;
+    filter.cb_ptr = cb_ptr;
+    filter.n_records = 0;
+    block = file->block;
+
+    if (file->n_index != 0)
+    {
+        /* First index entry ending at or after from */
+        lo = 0;
+        hi = file->n_index;
+        while (lo < hi)
+        {
+            mid = (uint16_t)((lo + hi) / 2);
+            if (file->index[mid].last_time < from)
+            {
+                lo = (uint16_t)(mid + 1);
+            }
+            else
+            {
+                hi = mid;
+            }
+        }
+
+        block_nr = file->n_blocks;
+        if (lo < file->n_index)
+        {
+            block_nr = find_block(from,
+                                  file->index[lo].first_block,
+                                  ((lo + 1) < file->n_index) ? file->index[lo + 1].first_block : file->n_blocks,
+                                  file);
+        }
+    }
+    else
+    {
+        block_nr = find_block(from, 0, file->n_blocks, file);
+    }
+
+    while (block_nr < file->n_blocks)
+    {
+        if ((file->n_index != 0) && ((block_nr % file->stride) == 0) && ((block_nr / file->stride) < file->n_index))
+        {
+            /* A whole index entry is passed over if it holds none of the types */
+            entry = &file->index[block_nr / file->stride];
+            if (entry->first_time > to)
+            {
+                break;
+            }
+
+            if ((entry->sensor_mask & sensor_mask) == 0)
+            {
+                block_nr += file->stride;
+                continue;
+            }
+        }
+
+        if (!read_header(block_nr, block, file))
+        {
+            file->stats.n_bad_blocks++;
+            block_nr++;
+            continue;
+        }
+
+        if (get_u32(&block[12]) > to)
+        {
+            break;
+        }
+
+        if ((get_u32(&block[16]) >= from) && ((get_u32(&block[20]) & sensor_mask) != 0))
+        {
+            len = read_at(block_nr * file->block_size + FLASH_LOG_HEADER_LEN,
+                          &block[FLASH_LOG_HEADER_LEN],
+                          file->block_size - FLASH_LOG_HEADER_LEN,
+                          file);
+
+            /* The block checks on its own, a bad one is passed over */
+            (void)flash_log_scan(block, FLASH_LOG_HEADER_LEN + len, filter_record, &filter, &scan_stats);
+            if (scan_stats.n_blocks == 0)
+            {
+                file->stats.n_bad_blocks++;
+            }
+
+            file->stats.n_blocks += scan_stats.n_blocks;
+        }
+
+        block_nr++;
+    }
+
+    file->stats.n_records += filter.n_records;
+
+    return FLASH_LOG_OK;
+}
+
+/*!
+ * @brief This API closes a log file.
+ */
+void flash_log_file_close(struct flash_log_file *file)
+{
+    if ((file != NULL) && (file->fp != NULL))
+    {
+        (void)fclose(file->fp);
+        file->fp = NULL;
+    }
+}
+
+/*!
+ * @brief Reads the footer and the index, returns FLASH_LOG_OK if they are valid.
+ */
+static int8_t load_index(uint32_t file_len, struct flash_log_file *file)
+{
+    uint8_t footer[FLASH_LOG_FOOTER_LEN];
+    uint8_t entry[FLASH_LOG_INDEX_ENTRY_LEN];
+    uint32_t index_len;
+    uint32_t offset;
+    uint16_t crc = 0xFFFF;
+    uint16_t idx;
+
+    if ((file_len < FLASH_LOG_FOOTER_LEN) ||
+        (read_at(file_len - FLASH_LOG_FOOTER_LEN, footer, FLASH_LOG_FOOTER_LEN, file) != FLASH_LOG_FOOTER_LEN) ||
+        (memcmp(footer, FLASH_LOG_INDEX_MAGIC, 4) != 0) || (footer[4] != FLASH_LOG_VERSION) || (footer[5] < 9) || (footer[5] > 15))
+    {
+        return FLASH_LOG_E_INVALID_CFG;
+    }
+
+    file->block_size = UINT32_C(1) << footer[5];
+    file->n_index = get_u16(&footer[6]);
+    file->stride = get_u32(&footer[8]);
+    file->n_blocks = get_u32(&footer[12]);
+    index_len = (uint32_t)file->n_index * FLASH_LOG_INDEX_ENTRY_LEN;
+
+    /* The blocks, the index and the footer make up the whole file */
+    if ((file->n_index > FLASH_LOG_INDEX_MAX) || (file->stride == 0) ||
+        (((uint64_t)file->n_blocks * file->block_size + index_len + FLASH_LOG_FOOTER_LEN) != file_len))
+    {
+        return FLASH_LOG_E_INVALID_CFG;
+    }
+
+    offset = file->n_blocks * file->block_size;
+    for (idx = 0; idx < file->n_index; idx++)
+    {
+        if (read_at(offset, entry, FLASH_LOG_INDEX_ENTRY_LEN, file) != FLASH_LOG_INDEX_ENTRY_LEN)
+        {
+            return FLASH_LOG_E_COM_FAIL;
+        }
+
+        crc = sample_stream_crc16_update(crc, entry, FLASH_LOG_INDEX_ENTRY_LEN);
+        file->index[idx].first_block = get_u32(&entry[0]);
+        file->index[idx].first_time = get_u32(&entry[4]);
+        file->index[idx].last_time = get_u32(&entry[8]);
+        file->index[idx].sensor_mask = get_u32(&entry[12]);
+        file->index[idx].n_records = get_u32(&entry[16]);
+        offset += FLASH_LOG_INDEX_ENTRY_LEN;
+    }
+
+    crc = sample_stream_crc16_update(crc, footer, FLASH_LOG_FOOTER_LEN - 2);
+    if (crc != get_u16(&footer[18]))
+    {
+        return FLASH_LOG_E_INVALID_CFG;
+    }
+
+    return FLASH_LOG_OK;
+}
+
+/*!
+ * @brief Reads len bytes at offset, returns the number of bytes read.
+ */
+static uint32_t read_at(uint32_t offset, uint8_t *buf, uint32_t len, struct flash_log_file *file)
+{
+    size_t n_read = 0;
+
+    if (fseek(file->fp, (long)offset, SEEK_SET) == 0)
+    {
+        n_read = fread(buf, 1, len, file->fp);
+    }
+
+    file->stats.n_reads++;
+    file->stats.n_bytes += (uint32_t)n_read;
+
+    return (uint32_t)n_read;
+}
+
+/*!
+ * @brief Reads the header of a block, returns 1 if it looks valid.
+ */
+static uint8_t read_header(uint32_t block_nr, uint8_t *header, struct flash_log_file *file)
+{
+    /* Only the CRC over the whole block proves it, this is enough to search */
+    return (read_at(block_nr * file->block_size, header, FLASH_LOG_HEADER_LEN, file) == FLASH_LOG_HEADER_LEN) &&
+           (header[0] == FLASH_LOG_SYNC_0) && (header[1] == FLASH_LOG_SYNC_1) &&
+           (header[4] == FLASH_LOG_VERSION) && ((UINT32_C(1) << (header[5] & 0x1F)) == file->block_size);
+}
+
+/*!
+ * @brief Returns the first block from lo to hi - 1 ending at or after from, hi if none.
+ */
+static uint32_t find_block(uint32_t from, uint32_t lo, uint32_t hi, struct flash_log_file *file)
+{
+    uint8_t header[FLASH_LOG_HEADER_LEN];
+    uint32_t mid;
+
+    while (lo < hi)
+    {
+        mid = lo + (hi - lo) / 2;
+
+        /* A damaged block may hold the range, the search goes on before it */
+        if (read_header(mid, header, file) && (get_u32(&header[16]) < from))
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+/*!
+ * @brief Hands the records of the range to the caller.
+ */
+static void filter_record(uint8_t type, uint32_t time, const uint8_t *data, uint8_t len, void *cb_ptr)
+{
+    struct range_filter *filter = (struct range_filter *)cb_ptr;
+
+    if ((time >= filter->from) && (time <= filter->to) &&
+        ((filter->sensor_mask & (UINT32_C(1) << ((type - 1) & 0x1F))) != 0))
+    {
+        if (filter->cb != NULL)
+        {
+            filter->cb(type, time, data, len, filter->cb_ptr);
+        }
+
+        filter->n_records++;
+    }
+}
+
+static uint16_t get_u16(const uint8_t *buf)
+{
+    return (uint16_t)(buf[0] | (buf[1] << 8));
+}
+
+static uint32_t get_u32(const uint8_t *buf)
+{
+    return (uint32_t)buf[0] | ((uint32_t)buf[1] << 8) | ((uint32_t)buf[2] << 16) | ((uint32_t)buf[3] << 24);
+}
@@ -0,0 +1,127 @@
+/**
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @file    flash_log_reader.h
+ * @date    Oct 18, 2026
+ * @brief   Host reader of flash logs, seeks to a time range through the index
+ *
+ * The index appended by flash_log_finish tells which stride of blocks holds a
+ * time; within it the blocks are located by a binary search on their headers,
+ * which carry the time of their first and last record. Only the blocks
+ * overlapping the range are read. A log without index, cut by a power loss, is
+ * searched on the block headers alone.
+ */
+#ifndef FLASH_LOG_READER_H_
+#define FLASH_LOG_READER_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "flash_log.h"
+
+/**********************************************************************************/
+/* macro definitions */
+/**********************************************************************************/
+/*! Largest block size read */
+#define FLASH_LOG_READER_MAX_BLOCK (32768)
+
+/*! The log has no valid index, it is searched on the block headers */
+#define FLASH_LOG_W_NO_INDEX       INT8_C(2)
+
+/*! Every record type */
+#define FLASH_LOG_ALL_TYPES        UINT32_C(0xFFFFFFFF)
+
+/**********************************************************************************/
+/* data structure declarations  */
+/**********************************************************************************/
+
+/*!
+ * @brief Counters of the reads from a log file
+ */
+struct flash_log_read_stats
+{
+    /*! Reads and bytes read from the file */
+    uint32_t n_reads;
+    uint32_t n_bytes;
+
+    /*! Blocks decoded */
+    uint32_t n_blocks;
+
+    /*! Blocks which failed their check */
+    uint32_t n_bad_blocks;
+
+    /*! Records handed to the callback */
+    uint32_t n_records;
+};
+
+/*!
+ * @brief Log file opened for reading
+ */
+struct flash_log_file
+{
+    /*! File */
+    FILE *fp;
+
+    /*! Size of the block, number of blocks */
+    uint32_t block_size;
+    uint32_t n_blocks;
+
+    /*! Index, no entries if the log has none */
+    struct flash_log_index_entry index[FLASH_LOG_INDEX_MAX];
+    uint16_t n_index;
+    uint32_t stride;
+
+    /*! Block being decoded */
+    uint8_t block[FLASH_LOG_READER_MAX_BLOCK];
+
+    /*! Counters */
+    struct flash_log_read_stats stats;
+};
+
+/**********************************************************************************/
+/* functions */
+/**********************************************************************************/
+
+/*!
+ * @brief This API opens a log file and loads its index.
+ *
+ * @param[in] path  : Path of the log file.
+ * @param[out] file : Log file.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval > 0 -> Warning, FLASH_LOG_W_NO_INDEX: the log has no valid index
+ * @retval < 0 -> Fail
+ */
+int8_t flash_log_file_open(const char *path, struct flash_log_file *file);
+
+/*!
+ * @brief This API hands the records from time from to time to, both included, to
+ * the callback in order, reading only the blocks overlapping the range.
+ *
+ * @param[in] from        : Start of the range.
+ * @param[in] to          : End of the range.
+ * @param[in] sensor_mask : Record types wanted, bit (type - 1) % 32.
+ * @param[in] cb          : Receives the records.
+ * @param[in] cb_ptr      : Passed to cb.
+ * @param[in,out] file    : Log file.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t flash_log_file_read(uint32_t from,
+                           uint32_t to,
+                           uint32_t sensor_mask,
+                           flash_log_record_fptr_t cb,
+                           void *cb_ptr,
+                           struct flash_log_file *file);
+
+/*!
+ * @brief This API closes a log file.
+ *
+ * @param[in,out] file : Log file.
+ */
+void flash_log_file_close(struct flash_log_file *file);
+
+#endif /* FLASH_LOG_READER_H_ */
@@ -26,22 +26,56 @@
                                                * voltage R1 is 300kohm and R2 is 180kohm*/
 #define CPU_FREQ_HZ                    64000000   /**<ARM cortex M4 is running at 64Mhz*/
 
+#define USB_TX_PACKET_SIZE             NRF_DRV_USBD_EPSIZE   /**<Size of a USB CDC transmit slot, one endpoint packet*/
+#ifndef USB_TX_SLOTS
+#define USB_TX_SLOTS                   16   /**<Number of USB CDC transmit slots, a power of two*/
+#endif
+#ifndef USB_RX_RING_SIZE
+#define USB_RX_RING_SIZE               4096   /**<Size of the USB CDC receive ring, a power of two not below RX_BUFFER_SIZE*/
+#endif
+#ifndef INT_EVENT_QUEUE_SIZE
+#define INT_EVENT_QUEUE_SIZE           64   /**<Number of queued interrupt events, a power of two*/
+#endif
+#ifndef USB_TX_TIMEOUT_MS
+#define USB_TX_TIMEOUT_MS              100   /**<Time a full transmit ring may block before the data is dropped*/
+#endif
+#ifndef TDM_N_BUFFERS
+#define TDM_N_BUFFERS                  3   /**<Number of I2S/TDM receive buffers, 3 to CAPTURE_RING_MAX_BUFS*/
+#endif
+#ifndef BLE_NUS_PACKET_SIZE
+#define BLE_NUS_PACKET_SIZE            244   /**<NUS notification payload, the ATT payload of a 247 byte MTU*/
+#endif
+#ifndef BLE_TX_SLOTS
+#define BLE_TX_SLOTS                   8   /**<Number of BLE NUS transmit packets, a power of two*/
+#endif
+#ifndef BLE_TX_LATENCY_US
+#define BLE_TX_LATENCY_US              20000   /**<Longest time a partial BLE NUS packet is held*/
+#endif
+#ifndef BLE_TX_SWI_IRQn
+#define BLE_TX_SWI_IRQn                SWI4_EGU4_IRQn   /**<Software interrupt sending the BLE NUS packets*/
+#define BLE_TX_SWI_IRQHandler          SWI4_EGU4_IRQHandler
+#endif
+#define BLE_TX_SWI_PRIORITY            7   /**<Lowest application priority, below the streaming interrupt*/
+
 /**Macro to convert the result of ADC conversion in millivolts */
 #define ADC_RESULT_IN_MILLI_VOLTS(ADC_VALUE) \
     (((ADC_VALUE) *ADC_REF_VOLTAGE_IN_MILLIVOLTS) / ADC_RES_10BIT)
 
 volatile bool serial_connected = false;
-static uint8_t serial_buffer[RX_BUFFER_SIZE] = { 0 };
-static volatile uint16_t serial_idx = 0, read_idx = 0;
-static uint8_t temp_rx;
+static uint8_t usb_rx_buffer[USB_RX_RING_SIZE];
+static struct rx_ring usb_rx;
+static uint8_t usb_rx_packet[NRF_DRV_USBD_EPSIZE];
 
 volatile bool ble_nus_connected = false;
 volatile bool ble_bas_connected = false;
 extern volatile size_t ble_nus_available;
+static uint8_t ble_tx_buffer[BLE_TX_SLOTS * BLE_NUS_PACKET_SIZE];
+static struct ble_stream ble_tx;
 uint32_t baud_rate = 0;
 volatile uint32_t g_millis = 0;
 
-volatile bool tx_pending = false;
+static uint8_t usb_tx_buffer[USB_TX_SLOTS * USB_TX_PACKET_SIZE];
+static struct tx_ring usb_tx;
 volatile uint8_t batt_status_percentage = 0;
 volatile uint16_t batt_status_in_milli_volts = 0;
 volatile bool coines_adc_transfer_done = false;
@@ -66,6 +100,10 @@ uint8_t multi_io_map[COINES_SHUTTLE_PIN_MAX] = {
 };
 
 static nrfx_gpiote_in_config_t gpio_config = NRFX_GPIOTE_RAW_CONFIG_IN_SENSE_LOTOHI(true);
+static struct isr_entry isr_table[NUMBER_OF_PINS];
+static struct coines_isr_stats isr_stats;
+static struct event_queue_event int_event_buffer[INT_EVENT_QUEUE_SIZE];
+static struct event_queue int_events;
 
 flog_write_file_t write_file[MAX_FILE_DESCRIPTORS];
 flog_read_file_t read_file[MAX_FILE_DESCRIPTORS];
@@ -76,20 +114,13 @@ DIR dir_h;
 flogfs_ls_iterator_t iter;
 nrf_saadc_value_t adc_buffer;
 
-static uint32_t const * volatile mp_block_to_check = NULL;
 static void coines_i2s_recv(nrf_drv_i2s_buffers_t const * p_released, uint32_t status);
 
 static coines_tdm_callback tdm_data_callback = NULL;
 
-static uint32_t i2s_buffer_rx[2][COINES_TDM_BUFFER_SIZE_WORDS];
-
-nrf_drv_i2s_buffers_t const initial_buffers = {
-    .p_rx_buffer = i2s_buffer_rx[0], .p_tx_buffer = NULL,
-};
-
-nrf_drv_i2s_buffers_t const next_buffers = {
-    .p_rx_buffer = i2s_buffer_rx[1], .p_tx_buffer = NULL,
-};
+/* Two buffers held by the I2S DMA, the others filled or with the consumer */
+static uint32_t i2s_buffer_rx[TDM_N_BUFFERS][COINES_TDM_BUFFER_SIZE_WORDS];
+static struct capture_ring tdm_rx;
 
 /**@brief Function for handling the ADC interrupt.
  *
@@ -234,34 +265,25 @@ static void cdc_acm_user_ev_handler(app_usbd_class_inst_t const * p_inst, app_us
         case APP_USBD_CDC_ACM_USER_EVT_PORT_OPEN:
             check_com_port_connection(1);
 
-            /* Setup a read */
-            (void)app_usbd_cdc_acm_read(&m_app_cdc_acm, &temp_rx, 1);
-            tx_pending = false;
+            /* Setup a read of up to one packet */
+            (void)app_usbd_cdc_acm_read_any(&m_app_cdc_acm, usb_rx_packet, sizeof(usb_rx_packet));
+            tx_ring_discard(&usb_tx);
             break;
         case APP_USBD_CDC_ACM_USER_EVT_PORT_CLOSE:
             check_com_port_connection(0);
-            tx_pending = false;
+            tx_ring_discard(&usb_tx);
             break;
         case APP_USBD_CDC_ACM_USER_EVT_TX_DONE:
-            tx_pending = false;
+            tx_ring_tx_done(&usb_tx);
             break;
         case APP_USBD_CDC_ACM_USER_EVT_RX_DONE:
         {
             do
             {
-                serial_buffer[serial_idx] = temp_rx;
-
-                /* Overwrite the last byte in case the buffer has been read */
-                if (serial_idx < (RX_BUFFER_SIZE - 1))
-                {
-                    serial_idx++;
-                }
-                else
-                {
-                    serial_idx = (RX_BUFFER_SIZE - 1);
-                }
-
-                ret = app_usbd_cdc_acm_read(&m_app_cdc_acm, &temp_rx, 1);
+                /* Bytes which do not fit are dropped and counted */
+                (void)rx_ring_write(usb_rx_packet, (uint32_t)app_usbd_cdc_acm_rx_size(&m_app_cdc_acm), &usb_rx);
+
+                ret = app_usbd_cdc_acm_read_any(&m_app_cdc_acm, usb_rx_packet, sizeof(usb_rx_packet));
             }while (ret == NRF_SUCCESS);
             break;
         }
@@ -304,6 +326,126 @@ static uint32_t external_flash_init(void)
     return ret_status;
 }
 
+/*!
+ * @brief Starts the USB CDC transfer of one transmit slot
+ */
+static int8_t usb_tx_start(const uint8_t *data, uint16_t len, void *intf_ptr)
+{
+    (void)intf_ptr;
+
+    if (app_usbd_cdc_acm_write(&m_app_cdc_acm, data, len) != NRF_SUCCESS)
+    {
+        return TX_RING_E_COM_FAIL;
+    }
+
+    return TX_RING_OK;
+}
+
+/*!
+ * @brief Queues data for USB CDC transmission. Returns at once unless the
+ *        transmit ring is full, data which does not fit within USB_TX_TIMEOUT_MS is dropped.
+ */
+static void usb_tx_write(const void *buffer, uint32_t len)
+{
+    const uint8_t *data = (const uint8_t *)buffer;
+    uint16_t chunk;
+    uint16_t written;
+    uint32_t wait_start = 0;
+    bool waiting = false;
+
+    while (len > 0)
+    {
+        chunk = (len > UINT16_MAX) ? UINT16_MAX : (uint16_t)len;
+        (void)tx_ring_write(data, chunk, &written, &usb_tx);
+        data += written;
+        len -= written;
+
+        if (written > 0)
+        {
+            waiting = false;
+        }
+        else if (!waiting)
+        {
+            waiting = true;
+            wait_start = g_millis;
+        }
+        else if (!serial_connected || ((g_millis - wait_start) > USB_TX_TIMEOUT_MS))
+        {
+            tx_ring_drop(len, &usb_tx);
+            break;
+        }
+        else
+        {
+            coines_yield();
+        }
+    }
+}
+
+/*!
+ * @brief Sends one BLE NUS transmit packet as notification
+ */
+static int8_t ble_tx_send(const uint8_t *data, uint16_t len, void *intf_ptr)
+{
+    (void)intf_ptr;
+
+    if (ble_service_nus_write(data, len) != len)
+    {
+        return BLE_STREAM_E_COM_FAIL;
+    }
+
+    return BLE_STREAM_OK;
+}
+
+/*!
+ * @brief Queues data for BLE NUS transmission, coalesced into MTU-sized notifications.
+ *        A write is kept whole or dropped whole; one longer than UINT16_MAX is
+ *        written in parts and the rest is given up at the first dropped part.
+ */
+static void ble_tx_write(const void *buffer, uint32_t len)
+{
+    const uint8_t *data = (const uint8_t *)buffer;
+    uint16_t chunk;
+    int8_t rslt = BLE_STREAM_OK;
+
+    /* The stream is also run by the BLE transmit interrupt */
+    NVIC_DisableIRQ(BLE_TX_SWI_IRQn);
+    if (!ble_nus_connected)
+    {
+        ble_stream_discard(&ble_tx);
+    }
+    else
+    {
+        while ((len > 0) && (rslt == BLE_STREAM_OK))
+        {
+            chunk = (len > UINT16_MAX) ? UINT16_MAX : (uint16_t)len;
+            rslt = ble_stream_write(data, chunk, (uint32_t)coines_get_micro_sec(), &ble_tx);
+            data += chunk;
+            len -= chunk;
+        }
+    }
+
+    NVIC_EnableIRQ(BLE_TX_SWI_IRQn);
+}
+
+/*!
+ * @brief Sends everything written for BLE NUS transmission, the partial packet included.
+ */
+static void ble_tx_flush(void)
+{
+    NVIC_DisableIRQ(BLE_TX_SWI_IRQn);
+    (void)ble_stream_flush((uint32_t)coines_get_micro_sec(), &ble_tx);
+    NVIC_EnableIRQ(BLE_TX_SWI_IRQn);
+}
+
+/*!
+ * @brief BLE transmit software interrupt, sends the queued packets and a partial
+ *        packet which has waited BLE_TX_LATENCY_US, whatever the main loop does.
+ */
+void BLE_TX_SWI_IRQHandler(void)
+{
+    (void)ble_stream_process((uint32_t)coines_get_micro_sec(), &ble_tx);
+}
+
 /**@brief Function for  initializing usb.
  */
 static uint32_t usb_init()
@@ -313,6 +455,8 @@ static uint32_t usb_init()
         };
 
     uint32_t ret_status=NRF_SUCCESS;
+    (void)tx_ring_init(usb_tx_buffer, USB_TX_PACKET_SIZE, USB_TX_SLOTS, usb_tx_start, NULL, &usb_tx);
+    (void)rx_ring_init(usb_rx_buffer, USB_RX_RING_SIZE, &usb_rx);
     app_usbd_serial_num_generate();
     if (NRF_SUCCESS == app_usbd_init(&usbd_config))
     {
@@ -404,9 +548,21 @@ int16_t coines_open_comm_intf(enum coines_comm_intf intf_type, void *arg)
 
     if (intf_type == COINES_COMM_INTF_BLE)
     {
+        (void)ble_stream_init(ble_tx_buffer,
+                              BLE_NUS_PACKET_SIZE,
+                              BLE_TX_SLOTS,
+                              BLE_TX_LATENCY_US,
+                              ble_tx_send,
+                              NULL,
+                              &ble_tx);
         ble_service_init(&init_handle);
     }
 
+    /* Configured whatever the interface, it is masked around every use of the BLE stream */
+    NVIC_SetPriority(BLE_TX_SWI_IRQn, BLE_TX_SWI_PRIORITY);
+    NVIC_ClearPendingIRQ(BLE_TX_SWI_IRQn);
+    NVIC_EnableIRQ(BLE_TX_SWI_IRQn);
+
     error_status |= usb_init();
 
     nrf_gpio_cfg_output(VDD_PS_EN);
@@ -524,9 +680,8 @@ int16_t coines_get_pin_config(enum coines_multi_io_pin pin_number,
 
 static void coines_i2s_recv(nrf_drv_i2s_buffers_t const * p_released, uint32_t status)
 {
-    /* 'nrf_drv_i2s_next_buffers_set' is called directly from the handler
-     each time next buffers are requested, so data corruption is not
-     expected. */
+    nrf_drv_i2s_buffers_t next_buffers = { .p_rx_buffer = NULL, .p_tx_buffer = NULL };
+    struct capture_ring_block block;
 
     /*lint -e716 -e722 */
     ASSERT(p_released);
@@ -540,26 +695,30 @@ static void coines_i2s_recv(nrf_drv_i2s_buffers_t const * p_released, uint32_t s
     }
 
     /* First call of this handler occurs right after the transfer is started.
-     No data has been transferred yet at this point, so there is nothing to
-     check. Only the buffers for the next part of the transfer should be
-     provided. */
+     No data has been transferred yet at this point, only the buffer for the
+     next part of the transfer should be provided. Afterwards the released
+     buffer goes to the consumer and a free one takes its place; with none
+     free the released buffer is overwritten, counted as an overrun. */
     if (!p_released->p_rx_buffer)
     {
-
-        APP_ERROR_CHECK(nrf_drv_i2s_next_buffers_set(&next_buffers));
+        next_buffers.p_rx_buffer = capture_ring_start(&tdm_rx);
     }
     else
     {
-        mp_block_to_check = (uint32_t *)p_released->p_rx_buffer;
+        next_buffers.p_rx_buffer = capture_ring_next(p_released->p_rx_buffer,
+                                                     (uint32_t)coines_get_micro_sec(),
+                                                     &tdm_rx);
+    }
 
-        /* The driver has just finished accessing the buffers pointed by
-         'p_released'. They can be used for the next part of the transfer
-         that will be scheduled now. */
-        APP_ERROR_CHECK(nrf_drv_i2s_next_buffers_set(p_released));
+    APP_ERROR_CHECK(nrf_drv_i2s_next_buffers_set(&next_buffers));
 
-        if (tdm_data_callback)
+    /* The buffer is handed back to the DMA only once the callback returned */
+    if (tdm_data_callback)
+    {
+        while (capture_ring_get(&block, &tdm_rx) == CAPTURE_RING_OK)
         {
-            tdm_data_callback(mp_block_to_check);
+            tdm_data_callback(block.data);
+            (void)capture_ring_release(block.data, &tdm_rx);
         }
     }
 }
@@ -568,6 +727,8 @@ int16_t coines_config_i2s_bus(uint16_t data_words, coines_tdm_callback callback)
 {
     uint32_t rslt;
 
+    nrf_drv_i2s_buffers_t initial_buffers = { .p_rx_buffer = NULL, .p_tx_buffer = NULL };
+
     tdm_data_callback = callback;
     nrf_drv_i2s_config_t config = NRF_DRV_I2S_DEFAULT_CONFIG;
 
@@ -593,12 +754,15 @@ int16_t coines_config_i2s_bus(uint16_t data_words, coines_tdm_callback callback)
     rslt = nrf_drv_i2s_init(&config, coines_i2s_recv);
     if (rslt == NRF_SUCCESS)
     {
-        if (data_words > COINES_TDM_BUFFER_SIZE_WORDS)
+        if ((data_words == 0) || (data_words > COINES_TDM_BUFFER_SIZE_WORDS))
         {
             return COINES_E_MEMORY_ALLOCATION;
         }
         else
         {
+            /* Buffers of data_words words, packed at the start of the storage */
+            (void)capture_ring_init(&i2s_buffer_rx[0][0], data_words, TDM_N_BUFFERS, &tdm_rx);
+            initial_buffers.p_rx_buffer = capture_ring_start(&tdm_rx);
             rslt = nrf_drv_i2s_start(&initial_buffers, data_words, 0);
         }
     }
@@ -617,10 +781,44 @@ int16_t coines_config_i2s_bus(uint16_t data_words, coines_tdm_callback callback)
 void coines_attach_interrupt(enum coines_multi_io_pin pin_number,
                              void (*callback)(uint32_t, uint32_t),
                              enum coines_pin_interrupt_mode int_mode)
+{
+    attach_interrupt(pin_number, callback, NULL, int_mode);
+}
+
+/*!
+ * @brief Attaches a interrupt to a Multi-IO pin, its edges being queued with their time
+ */
+void coines_attach_interrupt_queued(enum coines_multi_io_pin pin_number, enum coines_pin_interrupt_mode int_mode)
+{
+    if (int_events.buf == NULL)
+    {
+        (void)event_queue_init(int_event_buffer, INT_EVENT_QUEUE_SIZE, &int_events);
+    }
+
+    attach_interrupt(pin_number, NULL, NULL, int_mode);
+}
+
+/*!
+ * @brief Attaches a interrupt to a Multi-IO pin, the callback receiving the time of the edge
+ */
+void coines_attach_interrupt_timestamped(enum coines_multi_io_pin pin_number,
+                                         coines_isr_ts_cb_t callback,
+                                         enum coines_pin_interrupt_mode int_mode)
+{
+    attach_interrupt(pin_number, NULL, callback, int_mode);
+}
+
+/*!
+ * @brief Sets up the GPIOTE input of a Multi-IO pin and its table entry
+ */
+static void attach_interrupt(enum coines_multi_io_pin pin_number,
+                             ISR_CB callback,
+                             coines_isr_ts_cb_t ts_callback,
+                             enum coines_pin_interrupt_mode int_mode)
 {
     uint32_t pin_num = multi_io_map[pin_number];
 
-    if (pin_num == 0 || pin_num == 0xff)
+    if (pin_num == 0 || pin_num == 0xff || pin_num >= NUMBER_OF_PINS)
     {
         return;
     }
@@ -640,10 +838,14 @@ void coines_attach_interrupt(enum coines_multi_io_pin pin_number,
         gpio_config.sense = NRF_GPIOTE_POLARITY_HITOLO;
     }
 
+    /* Multi-IO pins sharing an nRF pin share its entry, the last attach wins */
+    isr_table[pin_num].cb = callback;
+    isr_table[pin_num].ts_cb = ts_callback;
+    isr_table[pin_num].queued = (callback == NULL) && (ts_callback == NULL) && (int_events.buf != NULL);
+    isr_table[pin_num].io_pin = (uint8_t)pin_number;
+
     (void)nrfx_gpiote_in_init(pin_num, &gpio_config, gpiohandler);
     nrfx_gpiote_in_event_enable(pin_num, true);
-    isr_cb[pin_number] = callback;
-
 }
 
 /*!
@@ -655,15 +857,17 @@ void coines_detach_interrupt(enum coines_multi_io_pin pin_number)
 {
     uint32_t pin_num = multi_io_map[pin_number];
 
-    if (pin_num == 0 || pin_num == 0xff)
+    if (pin_num == 0 || pin_num == 0xff || pin_num >= NUMBER_OF_PINS)
     {
         return;
     }
 
     /* Cleanup */
-    isr_cb[pin_number] = NULL;
-    nrfx_gpiote_in_uninit(pin_num);
     nrfx_gpiote_in_event_disable(pin_num);
+    nrfx_gpiote_in_uninit(pin_num);
+    isr_table[pin_num].cb = NULL;
+    isr_table[pin_num].ts_cb = NULL;
+    isr_table[pin_num].queued = 0;
 }
 
 /*!
@@ -671,12 +875,126 @@ void coines_detach_interrupt(enum coines_multi_io_pin pin_number)
  */
 static void gpiohandler(nrfx_gpiote_pin_t pin, nrf_gpiote_polarity_t action)
 {
-    for (int i = 0; i < COINES_SHUTTLE_PIN_MAX; i++)
+    /* Taken first, as close to the edge as the GPIOTE interrupt gets */
+    uint64_t timestamp_us = coines_get_micro_sec();
+    uint32_t handler_us;
+    ISR_CB cb;
+    coines_isr_ts_cb_t ts_cb;
+    struct event_queue_event event;
+
+    if (pin >= NUMBER_OF_PINS)
     {
-        if (pin == multi_io_map[i] && isr_cb[i] != NULL)
+        isr_stats.n_unhandled++;
+
+        return;
+    }
+
+    cb = isr_table[pin].cb;
+    ts_cb = isr_table[pin].ts_cb;
+
+    if (ts_cb != NULL)
+    {
+        ts_cb(pin, (uint32_t)action, timestamp_us);
+    }
+    else if (cb != NULL)
+    {
+        cb(pin, (uint32_t)action);
+    }
+    else if (isr_table[pin].queued)
+    {
+        /* The sense is both edges in change mode, the pin level tells which one it was */
+        if (action == NRF_GPIOTE_POLARITY_TOGGLE)
         {
-            isr_cb[i](pin, (uint32_t)action);
+            action = nrf_gpio_pin_read(pin) ? NRF_GPIOTE_POLARITY_LOTOHI : NRF_GPIOTE_POLARITY_HITOLO;
         }
+
+        event.timestamp_us = timestamp_us;
+        event.pin = isr_table[pin].io_pin;
+        event.edge = (action == NRF_GPIOTE_POLARITY_LOTOHI) ? (uint8_t)COINES_PIN_INTERRUPT_RISING_EDGE :
+                     (uint8_t)COINES_PIN_INTERRUPT_FALLING_EDGE;
+        (void)event_queue_put(&event, &int_events);
+    }
+    else
+    {
+        isr_stats.n_unhandled++;
+
+        return;
+    }
+
+    handler_us = (uint32_t)(coines_get_micro_sec() - timestamp_us);
+    isr_stats.n_interrupts++;
+    isr_stats.sum_handler_us += handler_us;
+    if (handler_us > isr_stats.max_handler_us)
+    {
+        isr_stats.max_handler_us = handler_us;
+    }
+}
+
+/*!
+ * @brief This API returns the GPIO interrupt counters.
+ */
+void coines_get_isr_stats(struct coines_isr_stats *stats)
+{
+    if (stats != NULL)
+    {
+        NRFX_IRQ_DISABLE(GPIOTE_IRQn);
+        *stats = isr_stats;
+        NRFX_IRQ_ENABLE(GPIOTE_IRQn);
+    }
+}
+
+/*!
+ * @brief This API takes out queued interrupt events, oldest first.
+ */
+uint32_t coines_get_interrupt_events(struct event_queue_event *events, uint32_t n)
+{
+    return event_queue_get(events, n, &int_events);
+}
+
+/*!
+ * @brief This API returns the counters of the interrupt event queue.
+ */
+void coines_get_interrupt_event_stats(struct event_queue_stats *stats)
+{
+    if (stats != NULL)
+    {
+        NRFX_IRQ_DISABLE(GPIOTE_IRQn);
+        *stats = int_events.stats;
+        NRFX_IRQ_ENABLE(GPIOTE_IRQn);
+    }
+}
+
+/*!
+ * @brief This API takes the oldest filled I2S/TDM buffer.
+ */
+int16_t coines_get_tdm_buffer(struct capture_ring_block *block)
+{
+    if (block == NULL)
+    {
+        return COINES_E_NULL_PTR;
+    }
+
+    return capture_ring_get(block, &tdm_rx);
+}
+
+/*!
+ * @brief This API gives an I2S/TDM buffer back for the DMA.
+ */
+int16_t coines_release_tdm_buffer(const uint32_t *data)
+{
+    return (capture_ring_release(data, &tdm_rx) == CAPTURE_RING_OK) ? COINES_SUCCESS : COINES_E_FAILURE;
+}
+
+/*!
+ * @brief This API returns the counters of the I2S/TDM capture.
+ */
+void coines_get_tdm_stats(struct capture_ring_stats *stats)
+{
+    if (stats != NULL)
+    {
+        NRFX_IRQ_DISABLE(I2S_IRQn);
+        *stats = tdm_rx.stats;
+        NRFX_IRQ_ENABLE(I2S_IRQn);
     }
 }
 
@@ -684,12 +1002,7 @@ uint16_t coines_intf_available(enum coines_comm_intf intf)
 {
     if ((intf == COINES_COMM_INTF_USB) && (serial_connected))
     {
-        if (read_idx >= serial_idx)
-        {
-            return 0;
-        }
-
-        return serial_idx - read_idx;
+        return (uint16_t)rx_ring_count(&usb_rx);
     }
     else if (intf == COINES_COMM_INTF_BLE)
     {
@@ -717,51 +1030,67 @@ void coines_write_intf(enum coines_comm_intf intf, void *buffer, uint16_t len)
 {
     if ((intf == COINES_COMM_INTF_USB) && (serial_connected))
     {
-        tx_pending = true;
-        (void)app_usbd_cdc_acm_write(&m_app_cdc_acm, buffer, len);
-        while (tx_pending)
-            ;
+        usb_tx_write(buffer, len);
     }
     else if (intf == COINES_COMM_INTF_BLE)
     {
-        (void)ble_service_nus_write(buffer, len);
+        ble_tx_write(buffer, len);
     }
 }
 
 void coines_flush_intf(enum coines_comm_intf intf)
 {
+    uint32_t wait_start = g_millis;
+
     if ((intf == COINES_COMM_INTF_USB) && (serial_connected))
     {
-        /* Do nothing */
+        /* Wait for the queued data to be on the host */
+        (void)tx_ring_flush(&usb_tx);
+        while (!tx_ring_is_idle(&usb_tx) && serial_connected && ((g_millis - wait_start) <= USB_TX_TIMEOUT_MS))
+        {
+            coines_yield();
+        }
     }
     else if (intf == COINES_COMM_INTF_BLE)
     {
         (void)fflush(bt_w);
+        ble_tx_flush();
     }
 }
 
-static uint16_t read_serial_buffer(uint8_t *buffer, uint16_t len)
+/*!
+ * @brief This API returns the counters of the USB CDC transmit ring
+ */
+void coines_get_usb_tx_stats(struct tx_ring_stats *stats)
 {
-    uint16_t bytes_read = 0;
-
-    NRFX_IRQ_DISABLE(USBD_IRQn);
-
-    while ((read_idx <= serial_idx) && (bytes_read < len))
+    if (stats != NULL)
     {
-        buffer[bytes_read] = serial_buffer[read_idx];
-        read_idx++;
-        bytes_read++;
+        *stats = usb_tx.stats;
     }
+}
 
-    if (read_idx >= serial_idx)
+/*!
+ * @brief This API returns the counters of the BLE NUS transmit stream
+ */
+void coines_get_ble_tx_stats(struct ble_stream_stats *stats)
+{
+    if (stats != NULL)
     {
-        read_idx = 0;
-        serial_idx = 0;
+        NVIC_DisableIRQ(BLE_TX_SWI_IRQn);
+        *stats = ble_tx.stats;
+        NVIC_EnableIRQ(BLE_TX_SWI_IRQn);
     }
+}
 
-    NRFX_IRQ_ENABLE(USBD_IRQn);
-
-    return bytes_read;
+/*!
+ * @brief This API returns the counters of the USB CDC receive ring
+ */
+void coines_get_usb_rx_stats(struct rx_ring_stats *stats)
+{
+    if (stats != NULL)
+    {
+        *stats = usb_rx.stats;
+    }
 }
 
 uint16_t coines_read_intf(enum coines_comm_intf intf, void *buffer, uint16_t len)
@@ -770,7 +1099,7 @@ uint16_t coines_read_intf(enum coines_comm_intf intf, void *buffer, uint16_t len
 
     if ((intf == COINES_COMM_INTF_USB) && (serial_connected))
     {
-        bytes_read = read_serial_buffer((uint8_t*)buffer, len);
+        bytes_read = (uint16_t)rx_ring_read((uint8_t*)buffer, len, &usb_rx);
     }
     else if (intf == COINES_COMM_INTF_BLE)
     {
@@ -786,6 +1115,12 @@ uint16_t coines_read_intf(enum coines_comm_intf intf, void *buffer, uint16_t len
 void SysTick_Handler(void)
 {
     g_millis++;
+
+    /* A held packet is sent from the BLE transmit interrupt once it is due */
+    if (ble_nus_connected && ((ble_tx.fill_len != 0) || (ble_tx.head != ble_tx.tail)))
+    {
+        NVIC_SetPendingIRQ(BLE_TX_SWI_IRQn);
+    }
 }
 
 /* For stdio functions */
@@ -794,10 +1129,7 @@ int __attribute__((weak)) _write(int fd, const void *buffer, int len)
 {
     if ((fd == 1 || fd == 2) && serial_connected == true)
     {
-        tx_pending = true;
-        (void)app_usbd_cdc_acm_write(&m_app_cdc_acm, buffer, (size_t)len);
-        while (tx_pending)
-            ;
+        usb_tx_write(buffer, (uint32_t)len);
 
         return len;
     }
@@ -807,7 +1139,9 @@ int __attribute__((weak)) _write(int fd, const void *buffer, int len)
     }
     else if (fd == BLE_NUS_FD_W && ble_nus_connected == true)
     {
-        return (int)ble_service_nus_write(buffer, (size_t)len);
+        ble_tx_write(buffer, (uint32_t)len);
+
+        return len;
     }
     else
     {
@@ -819,10 +1153,11 @@ int __attribute__((weak)) _read(int fd, void *buffer, int len)
 {
     if (fd == 0)
     {
-        while ((serial_idx - read_idx) < len)
+        /* A request larger than the ring is served with what it can hold */
+        while (rx_ring_count(&usb_rx) < (uint32_t)len && rx_ring_count(&usb_rx) < rx_ring_capacity(&usb_rx))
             ;
 
-        return read_serial_buffer((uint8_t*)buffer, (uint16_t)len);
+        return (int)rx_ring_read((uint8_t*)buffer, (uint32_t)len, &usb_rx);
     }
     else if (fd >= 3 && fd < MAX_FILE_DESCRIPTORS + 3)
     {
@@ -905,6 +1240,17 @@ int __attribute__((weak)) _close(int fd)
     bool fd_val;
     flog_result_t retval;
 
+    if (fd == BLE_NUS_FD_W)
+    {
+        ble_tx_flush();
+
+        return 0;
+    }
+    else if (fd == BLE_NUS_FD_R)
+    {
+        return 0;
+    }
+
     fd_val = fd_rw[fd - 3];
     if (fd_val == true)
     {
@@ -1199,7 +1545,8 @@ uint64_t coines_get_micro_sec()
     }while ((pend_flag != pend_flag2) || (millis_count != coines_get_millis()) || (systick_count < SysTick->VAL));
 
     /*lint -e524 -e647 */
-    return ((millis_count + pend_flag) * 1000) +
+    /* In 64 bit, a 32 bit product of the milliseconds would wrap after 71 minutes */
+    return ((uint64_t)(millis_count + pend_flag) * 1000) +
            (((SysTick->LOAD - systick_count) * (1048576 / (CPU_FREQ_HZ / 1000000))) >> 20);
 }
 
@@ -13,6 +13,7 @@
 
 #include "mcu_app30_support.h"
 #include "coines.h"
+#include "mcu_app30_interface.h"
 
 #include <sys/stat.h>
 
@@ -89,7 +90,20 @@ APP_USBD_CDC_ACM_GLOBAL_DEF(m_app_cdc_acm,
                             APP_USBD_CDC_COMM_PROTOCOL_NONE);
 
 typedef void (*ISR_CB)(uint32_t pin, uint32_t polarity);
-static ISR_CB isr_cb[COINES_SHUTTLE_PIN_MAX];
+
+/* Interrupt callbacks looked up by nRF pin number, one of them is set, or the edges are queued */
+struct isr_entry
+{
+    ISR_CB cb;
+    coines_isr_ts_cb_t ts_cb;
+    uint8_t queued;
+    uint8_t io_pin;
+};
+
 static void gpiohandler(nrfx_gpiote_pin_t pin, nrf_gpiote_polarity_t action);
+static void attach_interrupt(enum coines_multi_io_pin pin_number,
+                             ISR_CB callback,
+                             coines_isr_ts_cb_t ts_callback,
+                             enum coines_pin_interrupt_mode int_mode);
 
 #endif /* MCU_APP30_H_ */
@@ -19,6 +19,12 @@ C_SRCS_COINES += \
 mcu_app30_support.c \
 mcu_app30_interface.c \
 mcu_app30.c \
+tx_ring.c \
+rx_ring.c \
+stream_core.c \
+event_queue.c \
+ble_stream.c \
+capture_ring.c \
 $(THIRD_PARTY_DIR)/ds28e05/ds28e05.c \
 $(LIB_DIR)/nrf52_eeprom/app30_eeprom.c \
 $(LIB_DIR)/w25_common/w25_common.c \
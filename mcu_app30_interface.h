@@ -13,8 +13,15 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <stdbool.h>
 
 #include "coines.h"
+#include "tx_ring.h"
+#include "ble_stream.h"
+#include "rx_ring.h"
+#include "stream_core.h"
+#include "event_queue.h"
+#include "capture_ring.h"
 
 /**********************************************************************************/
 /* macro definitions */
@@ -82,6 +89,29 @@ enum coines_i2c_pin_map
     COINES_I2C_PIN_SECONDARY       /*< Pin mapping for secondary sensor(AUX) */
 };
 
+/*!
+ * @brief Interrupt callback receiving the time of the edge
+ */
+typedef void (*coines_isr_ts_cb_t)(uint32_t pin, uint32_t polarity, uint64_t timestamp_us);
+
+/*!
+ * @brief GPIO interrupt counters
+ */
+struct coines_isr_stats
+{
+    /*! Edges handed to a callback */
+    uint32_t n_interrupts;
+
+    /*! Edges on a pin without callback */
+    uint32_t n_unhandled;
+
+    /*! Longest time from the edge time stamp to the return of the callback */
+    uint32_t max_handler_us;
+
+    /*! Sum of those times, for the average */
+    uint64_t sum_handler_us;
+};
+
 /**********************************************************************************/
 /* functions */
 /**********************************************************************************/
@@ -108,4 +138,118 @@ bool coines_is_i2c_enabled(enum coines_i2c_bus bus);
 int16_t coines_config_i2c_bus_internal(enum coines_i2c_bus bus, enum coines_i2c_mode i2c_mode,
                               enum coines_i2c_pin_map pin_map);
 
+/*!
+ * @brief This API returns the counters of the USB CDC transmit ring.
+ *
+ * @param[out] stats : Bytes, packets, backpressure and dropped byte counters.
+ */
+void coines_get_usb_tx_stats(struct tx_ring_stats *stats);
+
+/*!
+ * @brief This API returns the counters of the BLE NUS transmit stream, see
+ * ble_stream_throughput for the throughput.
+ *
+ * @param[out] stats : Packet, drop and latency counters.
+ */
+void coines_get_ble_tx_stats(struct ble_stream_stats *stats);
+
+/*!
+ * @brief This API returns the counters of the USB CDC receive ring.
+ *
+ * @param[out] stats : Received bytes, dropped bytes and highest fill level.
+ */
+void coines_get_usb_rx_stats(struct rx_ring_stats *stats);
+
+/*!
+ * @brief This API returns the counters of an on-board streaming channel.
+ *
+ * @param[in] sensor_id : Streaming channel.
+ * @param[out] stats    : Queued samples, dropped samples, trigger overruns and bus errors.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int16_t coines_get_stream_stats(uint8_t sensor_id, struct stream_core_stats *stats);
+
+/*!
+ * @brief Attaches an interrupt to a Multi-IO pin, the callback receiving the
+ * time of the edge taken on entry of the GPIO interrupt.
+ *
+ * @param[in] pin_number : Multi-IO pin
+ * @param[in] callback   : Function to be called on detection of interrupt
+ * @param[in] int_mode   : Trigger modes - change,rising edge,falling edge
+ */
+void coines_attach_interrupt_timestamped(enum coines_multi_io_pin pin_number,
+                                         coines_isr_ts_cb_t callback,
+                                         enum coines_pin_interrupt_mode int_mode);
+
+/*!
+ * @brief This API returns the GPIO interrupt counters.
+ *
+ * @param[out] stats : Handled and unhandled edges, handler times.
+ */
+void coines_get_isr_stats(struct coines_isr_stats *stats);
+
+/*!
+ * @brief Attaches an interrupt to a Multi-IO pin whose edges are queued
+ * instead of calling back. Each edge is queued with its Multi-IO pin, its
+ * type, COINES_PIN_INTERRUPT_RISING_EDGE or _FALLING_EDGE, and the
+ * coines_get_micro_sec() time taken on entry of the GPIO interrupt.
+ *
+ * @param[in] pin_number : Multi-IO pin
+ * @param[in] int_mode   : Trigger modes - change,rising edge,falling edge
+ */
+void coines_attach_interrupt_queued(enum coines_multi_io_pin pin_number, enum coines_pin_interrupt_mode int_mode);
+
+/*!
+ * @brief This API takes out queued interrupt events, oldest first.
+ *
+ * @param[out] events : Destination.
+ * @param[in] n       : Most events to take.
+ *
+ * @return Number of events taken
+ */
+uint32_t coines_get_interrupt_events(struct event_queue_event *events, uint32_t n);
+
+/*!
+ * @brief This API returns the counters of the interrupt event queue.
+ *
+ * @param[out] stats : Queued events, events lost to a full queue and highest fill level.
+ */
+void coines_get_interrupt_event_stats(struct event_queue_stats *stats);
+
+/*!
+ * @brief This API takes the oldest filled I2S/TDM buffer, when the bus was
+ * configured without a callback. The buffer stays with the caller, out of
+ * reach of the DMA, until given back with coines_release_tdm_buffer. A gap in
+ * the sequence numbers counts the buffers dropped meanwhile.
+ *
+ * @param[out] block : Data, sequence number and release time of the buffer.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval > 0 -> Warning, CAPTURE_RING_W_EMPTY: no buffer is waiting
+ * @retval < 0 -> Fail
+ */
+int16_t coines_get_tdm_buffer(struct capture_ring_block *block);
+
+/*!
+ * @brief This API gives an I2S/TDM buffer back for the DMA.
+ *
+ * @param[in] data : Data of a block from coines_get_tdm_buffer.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int16_t coines_release_tdm_buffer(const uint32_t *data);
+
+/*!
+ * @brief This API returns the counters of the I2S/TDM capture.
+ *
+ * @param[out] stats : Filled buffers, overruns, released buffers and most buffers waiting.
+ */
+void coines_get_tdm_stats(struct capture_ring_stats *stats);
+
 #endif /* MCU_APP30_INTERFACE_H_ */
\ No newline at end of file
@@ -14,6 +14,8 @@
 #include <stdint.h>
 #include "coines.h"
 #include "mcu_app30_support.h"
+#include "mcu_app30_interface.h"
+#include "stream_core.h"
 
 /**********************************************************************************/
 /* own header files */
@@ -28,6 +30,18 @@
 #define RTC_RESOLUTION_USEC   (1000000 / RTC_TICKS_PER_SECOND)
 #define RTC_TICKS_TO_USEC(t)  (((uint64_t)t * UINT64_C(1000000)) / RTC_TICKS_PER_SECOND)
 
+/* Polling mode streaming timer */
+#ifndef STREAM_TIMER_INSTANCE
+#define STREAM_TIMER_INSTANCE COINES_TIMER_INSTANCE_2
+#endif
+
+/* Software interrupt doing the streaming bus reads, below the timer and GPIOTE priority */
+#ifndef STREAM_SWI_IRQn
+#define STREAM_SWI_IRQn       SWI3_EGU3_IRQn
+#define STREAM_SWI_IRQHandler SWI3_EGU3_IRQHandler
+#endif
+#define STREAM_SWI_PRIORITY   7
+
 /**********************************************************************************/
 /* constant definitions */
 /**********************************************************************************/
@@ -66,6 +80,11 @@ static nrfx_timer_config_t timer_config = {
     .interrupt_priority = 3, .p_context = NULL
 };
 
+/* On-board streaming */
+static struct stream_core stream;
+static uint8_t stream_initialized = 0;
+static uint8_t stream_running = 0;
+
 /**********************************************************************************/
 /* static function declaration */
 /**********************************************************************************/
@@ -118,6 +137,69 @@ static void rtc_handler(nrfx_rtc_int_type_t int_type)
     }
 }
 
+/*!
+ * @brief Reads a register block of a streaming sensor, called from the streaming software interrupt
+ */
+static int8_t stream_bus_read(const struct coines_streaming_config *cfg, uint8_t reg_addr, uint8_t *data, uint16_t len)
+{
+    if (cfg->intf == COINES_SENSOR_INTF_SPI)
+    {
+        /* Bosch sensors read with the MSB of the address set */
+        return coines_read_spi(cfg->spi_bus, cfg->cs_pin, reg_addr | 0x80, data, len);
+    }
+
+    return coines_read_i2c(cfg->i2c_bus, cfg->dev_addr, reg_addr, data, len);
+}
+
+/*!
+ * @brief Polling mode streaming timer handler, only marks the due channels
+ */
+static void stream_timer_handler(nrf_timer_event_t event_type, void *p_context)
+{
+    (void)p_context;
+
+    if (event_type == NRF_TIMER_EVENT_COMPARE0)
+    {
+        if (stream_core_timer_tick(coines_get_micro_sec(), &stream) != 0)
+        {
+            NVIC_SetPendingIRQ(STREAM_SWI_IRQn);
+        }
+    }
+}
+
+/*!
+ * @brief Interrupt mode streaming handlers of the channels, only mark the channel with the edge time
+ */
+static void stream_int_handler_1(uint32_t pin, uint32_t polarity, uint64_t timestamp_us)
+{
+    (void)pin;
+    (void)polarity;
+
+    if (stream_core_trigger(COINES_MIN_SENSOR_ID, timestamp_us, &stream))
+    {
+        NVIC_SetPendingIRQ(STREAM_SWI_IRQn);
+    }
+}
+
+static void stream_int_handler_2(uint32_t pin, uint32_t polarity, uint64_t timestamp_us)
+{
+    (void)pin;
+    (void)polarity;
+
+    if (stream_core_trigger(COINES_MIN_SENSOR_ID + 1, timestamp_us, &stream))
+    {
+        NVIC_SetPendingIRQ(STREAM_SWI_IRQn);
+    }
+}
+
+/*!
+ * @brief Streaming software interrupt, reads the pending samples from the sensors
+ */
+void STREAM_SWI_IRQHandler(void)
+{
+    stream_core_process(&stream);
+}
+
 /**********************************************************************************/
 /* functions */
 /**********************************************************************************/
@@ -195,22 +277,103 @@ int16_t coines_config_streaming(uint8_t channel_id,
                                 struct coines_streaming_config *stream_config,
                                 struct coines_streaming_blocks *data_blocks)
 {
-    (void)channel_id;
-    (void)stream_config;
-    (void)data_blocks;
+    if (stream_running)
+    {
+        return COINES_E_FAILURE;
+    }
 
-    return COINES_E_NOT_SUPPORTED;
+    if (!stream_initialized)
+    {
+        (void)stream_core_init(stream_bus_read, &stream);
+        NVIC_SetPriority(STREAM_SWI_IRQn, STREAM_SWI_PRIORITY);
+        NVIC_ClearPendingIRQ(STREAM_SWI_IRQn);
+        NVIC_EnableIRQ(STREAM_SWI_IRQn);
+        stream_initialized = 1;
+    }
+
+    return stream_core_config(channel_id, stream_config, data_blocks, &stream);
 }
 
 /*!
- * @brief This API is used to send the streaming settings to the board.
+ * @brief This API is used to start or stop the streaming.
  */
 int16_t coines_start_stop_streaming(enum coines_streaming_mode stream_mode, uint8_t start_stop)
 {
-    (void)stream_mode;
-    (void)start_stop;
+    static const coines_isr_ts_cb_t int_handler[STREAM_CORE_MAX_CHANNELS] = {
+        stream_int_handler_1, stream_int_handler_2
+    };
+    int16_t rslt = COINES_SUCCESS;
+    uint32_t tick_us;
+    uint8_t idx;
+
+    if (!stream_initialized)
+    {
+        return COINES_E_FAILURE;
+    }
 
-    return COINES_E_NOT_SUPPORTED;
+    if (start_stop == COINES_STREAMING_START)
+    {
+        if (stream_running)
+        {
+            return COINES_E_FAILURE;
+        }
+
+        rslt = stream_core_start(stream_mode, coines_get_micro_sec(), &tick_us, &stream);
+        if ((rslt == COINES_SUCCESS) && (stream_mode == COINES_STREAMING_MODE_POLLING))
+        {
+            rslt = coines_timer_config(STREAM_TIMER_INSTANCE, (void *)stream_timer_handler);
+            if (rslt == COINES_SUCCESS)
+            {
+                rslt = coines_timer_start(STREAM_TIMER_INSTANCE, tick_us);
+            }
+        }
+        else if (rslt == COINES_SUCCESS)
+        {
+            for (idx = 0; idx < STREAM_CORE_MAX_CHANNELS; idx++)
+            {
+                if (stream.ch[idx].configured)
+                {
+                    coines_attach_interrupt_timestamped(stream.ch[idx].cfg.int_pin,
+                                                        int_handler[idx],
+                                                        COINES_PIN_INTERRUPT_RISING_EDGE);
+                }
+            }
+        }
+
+        if (rslt == COINES_SUCCESS)
+        {
+            stream_running = 1;
+        }
+        else
+        {
+            stream_core_stop(&stream);
+        }
+    }
+    else if (stream_running)
+    {
+        stream_core_stop(&stream);
+        if (stream.mode == COINES_STREAMING_MODE_POLLING)
+        {
+            (void)coines_timer_stop(STREAM_TIMER_INSTANCE);
+
+            /* Released so that the next start can configure it again */
+            nrfx_timer_uninit(&timer_instance[STREAM_TIMER_INSTANCE]);
+        }
+        else
+        {
+            for (idx = 0; idx < STREAM_CORE_MAX_CHANNELS; idx++)
+            {
+                if (stream.ch[idx].configured)
+                {
+                    coines_detach_interrupt(stream.ch[idx].cfg.int_pin);
+                }
+            }
+        }
+
+        stream_running = 0;
+    }
+
+    return rslt;
 }
 
 /*!
@@ -221,12 +384,32 @@ int16_t coines_read_stream_sensor_data(uint8_t sensor_id,
                                        uint8_t *data,
                                        uint32_t *valid_samples_count)
 {
-    (void)sensor_id;
-    (void)number_of_samples;
-    (void)data;
-    (void)valid_samples_count;
+    if (!stream_initialized)
+    {
+        return COINES_E_FAILURE;
+    }
 
-    return COINES_E_NOT_SUPPORTED;
+    return stream_core_read(sensor_id, number_of_samples, data, valid_samples_count, &stream);
+}
+
+/*!
+ * @brief This API is used to get the counters of a streaming channel.
+ */
+int16_t coines_get_stream_stats(uint8_t sensor_id, struct stream_core_stats *stats)
+{
+    if (stats == NULL)
+    {
+        return COINES_E_NULL_PTR;
+    }
+
+    if (!stream_initialized || (sensor_id < COINES_MIN_SENSOR_ID) || (sensor_id > STREAM_CORE_MAX_CHANNELS))
+    {
+        return COINES_E_FAILURE;
+    }
+
+    *stats = stream.ch[sensor_id - COINES_MIN_SENSOR_ID].stats;
+
+    return COINES_SUCCESS;
 }
 
 /*!
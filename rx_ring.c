@@ -0,0 +1,160 @@
+/**
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @file    rx_ring.c
+ * @date    Oct 18, 2026
+ * @brief   Lock-free single producer, single consumer receive ring
+ */
+
+/**********************************************************************************/
+/* system header includes */
+/**********************************************************************************/
+#include <string.h>
+
+/**********************************************************************************/
+/* own header files */
+/**********************************************************************************/
+#include "rx_ring.h"
+
+/**********************************************************************************/
+/* functions */
+/**********************************************************************************/
+
+/*!
+ * @brief This API initializes a ring over the given storage.
+ */
+int8_t rx_ring_init(uint8_t *buf, uint32_t size, struct rx_ring *ring)
+{
+    int8_t rslt = RX_RING_OK;
+
+    if ((buf == NULL) || (ring == NULL))
+    {
+        rslt = RX_RING_E_NULL_PTR;
+    }
+    else if ((size < 2) || ((size & (size - 1)) != 0))
+    {
+        rslt = RX_RING_E_INVALID_CFG;
+    }
+    else
+    {
+        memset(ring, 0, sizeof(*ring));
+        ring->buf = buf;
+        ring->mask = size - 1;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API stores received data, producer side.
+ */
+uint32_t rx_ring_write(const uint8_t *data, uint32_t len, struct rx_ring *ring)
+{
+    uint32_t head;
+    uint32_t used;
+    uint32_t offset;
+    uint32_t chunk;
+
+    if ((data == NULL) || (ring == NULL) || (ring->buf == NULL))
+    {
+        return 0;
+    }
+
+    head = ring->head;
+    used = head - ring->tail;
+
+    if (len > (ring->mask + 1 - used))
+    {
+        ring->stats.n_dropped += len - (ring->mask + 1 - used);
+        len = ring->mask + 1 - used;
+    }
+
+    /* At most two copies, up to the end of the storage and from its start */
+    offset = head & ring->mask;
+    chunk = ring->mask + 1 - offset;
+    if (chunk > len)
+    {
+        chunk = len;
+    }
+
+    memcpy(&ring->buf[offset], data, chunk);
+    memcpy(ring->buf, &data[chunk], len - chunk);
+
+    RX_RING_BARRIER();
+    ring->head = head + len;
+
+    ring->stats.n_bytes += len;
+    if ((used + len) > ring->stats.max_used)
+    {
+        ring->stats.max_used = used + len;
+    }
+
+    return len;
+}
+
+/*!
+ * @brief This API copies out and releases up to len bytes, consumer side.
+ */
+uint32_t rx_ring_read(uint8_t *data, uint32_t len, struct rx_ring *ring)
+{
+    uint32_t tail;
+    uint32_t avail;
+    uint32_t offset;
+    uint32_t chunk;
+
+    if ((data == NULL) || (ring == NULL) || (ring->buf == NULL))
+    {
+        return 0;
+    }
+
+    tail = ring->tail;
+    avail = ring->head - tail;
+    RX_RING_BARRIER();
+
+    if (len > avail)
+    {
+        len = avail;
+    }
+
+    offset = tail & ring->mask;
+    chunk = ring->mask + 1 - offset;
+    if (chunk > len)
+    {
+        chunk = len;
+    }
+
+    memcpy(data, &ring->buf[offset], chunk);
+    memcpy(&data[chunk], ring->buf, len - chunk);
+
+    /* The space is handed back only once it is copied out */
+    RX_RING_BARRIER();
+    ring->tail = tail + len;
+
+    return len;
+}
+
+/*!
+ * @brief This API returns the number of bytes ready to be read.
+ */
+uint32_t rx_ring_count(const struct rx_ring *ring)
+{
+    if (ring == NULL)
+    {
+        return 0;
+    }
+
+    return ring->head - ring->tail;
+}
+
+/*!
+ * @brief This API returns the number of bytes the ring holds when full.
+ */
+uint32_t rx_ring_capacity(const struct rx_ring *ring)
+{
+    if (ring == NULL)
+    {
+        return 0;
+    }
+
+    return ring->mask + 1;
+}
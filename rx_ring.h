@@ -0,0 +1,130 @@
+/**
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @file    rx_ring.h
+ * @date    Oct 18, 2026
+ * @brief   Lock-free single producer, single consumer receive ring
+ *
+ * The receive interrupt is the only producer and writes head, the main loop is
+ * the only consumer and writes tail, so neither side masks interrupts. Both
+ * indexes run freely and are reduced with the size mask, the ring size is a
+ * power of two.
+ */
+#ifndef RX_RING_H_
+#define RX_RING_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**********************************************************************************/
+/* macro definitions */
+/**********************************************************************************/
+/*! Compiler barrier, orders the ring contents before the index which publishes them */
+#ifndef RX_RING_BARRIER
+#define RX_RING_BARRIER()     __asm__ volatile ("" ::: "memory")
+#endif
+
+/*! Status codes */
+#define RX_RING_OK            INT8_C(0)
+#define RX_RING_E_NULL_PTR    INT8_C(-1)
+#define RX_RING_E_INVALID_CFG INT8_C(-2)
+
+/**********************************************************************************/
+/* data structure declarations  */
+/**********************************************************************************/
+
+/*!
+ * @brief Counters of a ring
+ */
+struct rx_ring_stats
+{
+    /*! Bytes stored by the producer */
+    uint32_t n_bytes;
+
+    /*! Bytes the producer dropped because the ring was full */
+    uint32_t n_dropped;
+
+    /*! Highest fill level in bytes */
+    uint32_t max_used;
+};
+
+/*!
+ * @brief Receive ring
+ */
+struct rx_ring
+{
+    /*! Storage, size bytes */
+    uint8_t *buf;
+
+    /*! Size - 1, the size is a power of two */
+    uint32_t mask;
+
+    /*! Free running count of stored bytes, written by the producer */
+    volatile uint32_t head;
+
+    /*! Free running count of consumed bytes, written by the consumer */
+    volatile uint32_t tail;
+
+    /*! Counters, written by the producer */
+    struct rx_ring_stats stats;
+};
+
+/**********************************************************************************/
+/* functions */
+/**********************************************************************************/
+
+/*!
+ * @brief This API initializes a ring over the given storage.
+ *
+ * @param[in] buf   : Storage.
+ * @param[in] size  : Size of buf, a power of two.
+ * @param[out] ring : Ring to initialize.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t rx_ring_init(uint8_t *buf, uint32_t size, struct rx_ring *ring);
+
+/*!
+ * @brief This API stores received data, producer side. Bytes which do not
+ * fit are dropped and counted.
+ *
+ * @param[in] data     : Received data.
+ * @param[in] len      : Length of data.
+ * @param[in,out] ring : Ring.
+ *
+ * @return Number of bytes stored
+ */
+uint32_t rx_ring_write(const uint8_t *data, uint32_t len, struct rx_ring *ring);
+
+/*!
+ * @brief This API copies out and releases up to len bytes, consumer side.
+ *
+ * @param[out] data    : Destination.
+ * @param[in] len      : Size of data.
+ * @param[in,out] ring : Ring.
+ *
+ * @return Number of bytes read
+ */
+uint32_t rx_ring_read(uint8_t *data, uint32_t len, struct rx_ring *ring);
+
+/*!
+ * @brief This API returns the number of bytes ready to be read.
+ *
+ * @param[in] ring : Ring.
+ *
+ * @return Number of bytes in the ring
+ */
+uint32_t rx_ring_count(const struct rx_ring *ring);
+
+/*!
+ * @brief This API returns the number of bytes the ring holds when full.
+ *
+ * @param[in] ring : Ring.
+ *
+ * @return Capacity in bytes
+ */
+uint32_t rx_ring_capacity(const struct rx_ring *ring);
+
+#endif /* RX_RING_H_ */
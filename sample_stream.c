@@ -0,0 +1,643 @@
+/**
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @file    sample_stream.c
+ * @date    Oct 18, 2026
+ * @brief   Binary sample streaming protocol, encoder and decoder
+ */
+
+/**********************************************************************************/
+/* system header includes */
+/**********************************************************************************/
+#include <string.h>
+
+/**********************************************************************************/
+/* own header files */
+/**********************************************************************************/
+#include "sample_stream.h"
+
+/**********************************************************************************/
+/* local macro definitions */
+/**********************************************************************************/
+/*! Longest delta encoded axes record: varint time, then 3 x s16 or 3 x 3 byte varint */
+#define AXES_DELTA_MAX_LEN  (5 + 9)
+
+/*! Number of records a frame header can count */
+#define MAX_FRAME_RECORDS   (255)
+
+/**********************************************************************************/
+/* static function declarations */
+/**********************************************************************************/
+
+/*!
+ * @brief Adds the header and CRC to the frame being built and writes it.
+ */
+static void send_frame(uint8_t type,
+                       uint8_t n_records,
+                       uint32_t sensortime,
+                       uint16_t payload_len,
+                       struct sample_stream_enc *enc);
+
+/*!
+ * @brief Encodes one axes record.
+ */
+static uint8_t put_axes_record(uint8_t *buf,
+                               uint8_t delta,
+                               uint8_t first,
+                               uint32_t dt,
+                               const struct sample_stream_axes *s,
+                               const struct sample_stream_axes *prev);
+
+/*!
+ * @brief Checks and decodes the complete frame at the start of the receive buffer.
+ */
+static int8_t decode_frame(struct sample_stream_dec *dec);
+
+/*!
+ * @brief Drops the first bytes of the receive buffer.
+ */
+static void drop_bytes(uint16_t n, struct sample_stream_dec *dec);
+
+/*!
+ * @brief Consumes whatever frames, or garbage, the receive buffer starts with.
+ */
+static void scan_frames(struct sample_stream_dec *dec);
+
+/*!
+ * @brief Little endian and varint helpers.
+ */
+static void put_u16(uint8_t *buf, uint16_t val);
+static void put_u32(uint8_t *buf, uint32_t val);
+static uint16_t get_u16(const uint8_t *buf);
+static uint32_t get_u32(const uint8_t *buf);
+static uint8_t put_varint(uint8_t *buf, uint32_t val);
+static uint8_t get_varint(const uint8_t *buf, uint16_t len, uint32_t *val);
+
+/**********************************************************************************/
+/* functions */
+/**********************************************************************************/
+
+/*!
+ * @brief This API initializes an encoder.
+ */
+int8_t sample_stream_init(sample_stream_write_fptr_t write, void *intf_ptr, struct sample_stream_enc *enc)
+{
+    int8_t rslt = SAMPLE_STREAM_OK;
+
+    if ((write == NULL) || (enc == NULL))
+    {
+        rslt = SAMPLE_STREAM_E_NULL_PTR;
+    }
+    else
+    {
+        memset(enc, 0, sizeof(*enc));
+        enc->write = write;
+        enc->intf_ptr = intf_ptr;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sends axes samples, split into as many frames as needed.
+ */
+int8_t sample_stream_put_axes(uint8_t type, const struct sample_stream_axes *s, uint16_t n, struct sample_stream_enc *enc)
+{
+    int8_t rslt = SAMPLE_STREAM_OK;
+    uint8_t delta = (type & SAMPLE_STREAM_DELTA) ? 1 : 0;
+    uint8_t rec[AXES_DELTA_MAX_LEN];
+    uint8_t rec_len;
+    uint8_t count;
+    uint16_t payload_len;
+    uint16_t idx = 0;
+    uint16_t first;
+    uint32_t dt;
+    uint8_t *payload;
+
+    if ((s == NULL) || (enc == NULL) || (enc->write == NULL))
+    {
+        rslt = SAMPLE_STREAM_E_NULL_PTR;
+    }
+    else if (((type & SAMPLE_STREAM_TYPE_MSK) < SAMPLE_STREAM_TYPE_ACCEL) ||
+             ((type & SAMPLE_STREAM_TYPE_MSK) > SAMPLE_STREAM_TYPE_MAG))
+    {
+        rslt = SAMPLE_STREAM_E_INVALID_TYPE;
+    }
+    else
+    {
+        payload = &enc->frame[SAMPLE_STREAM_HEADER_LEN];
+
+        while (idx < n)
+        {
+            first = idx;
+            count = 0;
+            payload_len = 0;
+
+            while ((idx < n) && (count < MAX_FRAME_RECORDS))
+            {
+                dt = (count == 0) ? 0 : (s[idx].sensortime - s[idx - 1].sensortime);
+
+                /* A plain record holds a 16 bit time delta */
+                if (!delta && (dt > UINT16_MAX))
+                {
+                    break;
+                }
+
+                rec_len = put_axes_record(rec, delta, (count == 0), dt, &s[idx], (count == 0) ? NULL : &s[idx - 1]);
+                if ((payload_len + rec_len) > SAMPLE_STREAM_MAX_PAYLOAD)
+                {
+                    break;
+                }
+
+                memcpy(&payload[payload_len], rec, rec_len);
+                payload_len += rec_len;
+                count++;
+                idx++;
+            }
+
+            send_frame(type, count, s[first].sensortime, payload_len, enc);
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sends environment samples, split into as many frames as needed.
+ */
+int8_t sample_stream_put_env(const struct sample_stream_env *s, uint16_t n, struct sample_stream_enc *enc)
+{
+    int8_t rslt = SAMPLE_STREAM_OK;
+    uint8_t count;
+    uint16_t idx = 0;
+    uint16_t first;
+    uint32_t dt;
+    uint8_t *rec;
+
+    if ((s == NULL) || (enc == NULL) || (enc->write == NULL))
+    {
+        rslt = SAMPLE_STREAM_E_NULL_PTR;
+    }
+    else
+    {
+        while (idx < n)
+        {
+            first = idx;
+            count = 0;
+
+            while ((idx < n) && ((count + 1) * SAMPLE_STREAM_ENV_LEN <= SAMPLE_STREAM_MAX_PAYLOAD))
+            {
+                dt = (count == 0) ? 0 : (s[idx].sensortime - s[idx - 1].sensortime);
+                if (dt > UINT16_MAX)
+                {
+                    break;
+                }
+
+                rec = &enc->frame[SAMPLE_STREAM_HEADER_LEN + count * SAMPLE_STREAM_ENV_LEN];
+                put_u16(&rec[0], (uint16_t)dt);
+                put_u16(&rec[2], (uint16_t)s[idx].temperature);
+                put_u32(&rec[4], s[idx].pressure);
+                put_u32(&rec[8], s[idx].humidity);
+                put_u32(&rec[12], s[idx].gas_resistance);
+                rec[16] = s[idx].status;
+                rec[17] = s[idx].gas_index;
+                count++;
+                idx++;
+            }
+
+            send_frame(SAMPLE_STREAM_TYPE_ENV,
+                       count,
+                       s[first].sensortime,
+                       (uint16_t)(count * SAMPLE_STREAM_ENV_LEN),
+                       enc);
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes a decoder.
+ */
+int8_t sample_stream_dec_init(sample_stream_axes_fptr_t axes_cb,
+                              sample_stream_env_fptr_t env_cb,
+                              void *cb_ptr,
+                              struct sample_stream_dec *dec)
+{
+    int8_t rslt = SAMPLE_STREAM_OK;
+
+    if (dec == NULL)
+    {
+        rslt = SAMPLE_STREAM_E_NULL_PTR;
+    }
+    else
+    {
+        memset(dec, 0, sizeof(*dec));
+        dec->axes_cb = axes_cb;
+        dec->env_cb = env_cb;
+        dec->cb_ptr = cb_ptr;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API feeds received bytes to the decoder.
+ */
+int8_t sample_stream_decode(const uint8_t *data, uint32_t len, struct sample_stream_dec *dec)
+{
+    int8_t rslt = SAMPLE_STREAM_OK;
+    uint16_t need;
+
+    if ((data == NULL) || (dec == NULL))
+    {
+        rslt = SAMPLE_STREAM_E_NULL_PTR;
+    }
+    else
+    {
+        while (len > 0)
+        {
+            /* Take no more than the header, then no more than the frame */
+            if (dec->frame_len < SAMPLE_STREAM_HEADER_LEN)
+            {
+                need = SAMPLE_STREAM_HEADER_LEN - dec->frame_len;
+            }
+            else
+            {
+                need = SAMPLE_STREAM_HEADER_LEN + get_u16(&dec->frame[10]) + SAMPLE_STREAM_CRC_LEN - dec->frame_len;
+            }
+
+            if (need > len)
+            {
+                need = (uint16_t)len;
+            }
+
+            memcpy(&dec->frame[dec->frame_len], data, need);
+            dec->frame_len += need;
+            data += need;
+            len -= need;
+
+            scan_frames(dec);
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API computes the CRC-16/CCITT-FALSE of a buffer.
+ */
+uint16_t sample_stream_crc16(const uint8_t *data, uint16_t len)
+{
+    return sample_stream_crc16_update(0xFFFF, data, len);
+}
+
+/*!
+ * @brief This API continues a CRC-16/CCITT-FALSE over the next part of the data.
+ */
+uint16_t sample_stream_crc16_update(uint16_t crc, const uint8_t *data, uint16_t len)
+{
+    /* Nibble table, a compromise between flash size and speed */
+    static const uint16_t crc_nibble[16] = {
+        0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+        0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+    };
+    uint16_t idx;
+
+    for (idx = 0; idx < len; idx++)
+    {
+        crc = (uint16_t)((crc << 4) ^ crc_nibble[(crc >> 12) ^ (data[idx] >> 4)]);
+        crc = (uint16_t)((crc << 4) ^ crc_nibble[(crc >> 12) ^ (data[idx] & 0x0F)]);
+    }
+
+    return crc;
+}
+
+/*!
+ * @brief Adds the header and CRC to the frame being built and writes it.
+ */
+static void send_frame(uint8_t type,
+                       uint8_t n_records,
+                       uint32_t sensortime,
+                       uint16_t payload_len,
+                       struct sample_stream_enc *enc)
+{
+    uint16_t frame_len = SAMPLE_STREAM_HEADER_LEN + payload_len;
+
+    enc->frame[0] = SAMPLE_STREAM_SYNC_0;
+    enc->frame[1] = SAMPLE_STREAM_SYNC_1;
+    enc->frame[2] = type;
+    enc->frame[3] = n_records;
+    put_u16(&enc->frame[4], enc->seq);
+    put_u32(&enc->frame[6], sensortime);
+    put_u16(&enc->frame[10], payload_len);
+    put_u16(&enc->frame[frame_len], sample_stream_crc16(&enc->frame[2], (uint16_t)(frame_len - 2)));
+    frame_len += SAMPLE_STREAM_CRC_LEN;
+
+    enc->write(enc->frame, frame_len, enc->intf_ptr);
+
+    enc->seq++;
+    enc->n_frames++;
+    enc->n_bytes += frame_len;
+}
+
+/*!
+ * @brief Encodes one axes record.
+ */
+static uint8_t put_axes_record(uint8_t *buf,
+                               uint8_t delta,
+                               uint8_t first,
+                               uint32_t dt,
+                               const struct sample_stream_axes *s,
+                               const struct sample_stream_axes *prev)
+{
+    uint8_t len;
+    int32_t diff[3];
+    uint8_t axis;
+
+    if (!delta)
+    {
+        put_u16(&buf[0], (uint16_t)dt);
+        put_u16(&buf[2], (uint16_t)s->x);
+        put_u16(&buf[4], (uint16_t)s->y);
+        put_u16(&buf[6], (uint16_t)s->z);
+        len = SAMPLE_STREAM_AXES_LEN;
+    }
+    else
+    {
+        len = put_varint(buf, dt);
+        if (first)
+        {
+            put_u16(&buf[len], (uint16_t)s->x);
+            put_u16(&buf[len + 2], (uint16_t)s->y);
+            put_u16(&buf[len + 4], (uint16_t)s->z);
+            len += 6;
+        }
+        else
+        {
+            diff[0] = (int32_t)s->x - prev->x;
+            diff[1] = (int32_t)s->y - prev->y;
+            diff[2] = (int32_t)s->z - prev->z;
+            for (axis = 0; axis < 3; axis++)
+            {
+                /* Zig-zag, small magnitudes of either sign give short varints */
+                len += put_varint(&buf[len], ((uint32_t)diff[axis] << 1) ^ (uint32_t)(diff[axis] >> 31));
+            }
+        }
+    }
+
+    return len;
+}
+
+/*!
+ * @brief Checks and decodes the complete frame at the start of the receive buffer.
+ */
+static int8_t decode_frame(struct sample_stream_dec *dec)
+{
+    int8_t rslt = SAMPLE_STREAM_OK;
+    const uint8_t *frame = dec->frame;
+    uint8_t type = frame[2] & SAMPLE_STREAM_TYPE_MSK;
+    uint8_t delta = (frame[2] & SAMPLE_STREAM_DELTA) ? 1 : 0;
+    uint8_t n_records = frame[3];
+    uint16_t seq = get_u16(&frame[4]);
+    uint32_t time = get_u32(&frame[6]);
+    uint16_t payload_len = get_u16(&frame[10]);
+    const uint8_t *payload = &frame[SAMPLE_STREAM_HEADER_LEN];
+    uint16_t pos = 0;
+    uint16_t idx;
+    uint8_t axis;
+    uint8_t used;
+    uint32_t val;
+    int16_t *axes[3];
+    struct sample_stream_axes *a;
+    struct sample_stream_env *e;
+
+    if (sample_stream_crc16(&frame[2], (uint16_t)(SAMPLE_STREAM_HEADER_LEN - 2 + payload_len)) !=
+        get_u16(&payload[payload_len]))
+    {
+        rslt = SAMPLE_STREAM_E_BAD_FRAME;
+    }
+    else if ((type >= SAMPLE_STREAM_TYPE_ACCEL) && (type <= SAMPLE_STREAM_TYPE_MAG))
+    {
+        for (idx = 0; (idx < n_records) && (idx < SAMPLE_STREAM_MAX_RECORDS) && (rslt == SAMPLE_STREAM_OK); idx++)
+        {
+            a = &dec->rec.axes[idx];
+            if (!delta)
+            {
+                if ((pos + SAMPLE_STREAM_AXES_LEN) > payload_len)
+                {
+                    rslt = SAMPLE_STREAM_E_BAD_FRAME;
+                    break;
+                }
+
+                time += get_u16(&payload[pos]);
+                a->x = (int16_t)get_u16(&payload[pos + 2]);
+                a->y = (int16_t)get_u16(&payload[pos + 4]);
+                a->z = (int16_t)get_u16(&payload[pos + 6]);
+                pos += SAMPLE_STREAM_AXES_LEN;
+            }
+            else
+            {
+                used = get_varint(&payload[pos], payload_len - pos, &val);
+                pos += used;
+                time += val;
+
+                if (idx == 0)
+                {
+                    if ((used == 0) || ((pos + 6) > payload_len))
+                    {
+                        rslt = SAMPLE_STREAM_E_BAD_FRAME;
+                        break;
+                    }
+
+                    a->x = (int16_t)get_u16(&payload[pos]);
+                    a->y = (int16_t)get_u16(&payload[pos + 2]);
+                    a->z = (int16_t)get_u16(&payload[pos + 4]);
+                    pos += 6;
+                }
+                else
+                {
+                    axes[0] = &a->x;
+                    axes[1] = &a->y;
+                    axes[2] = &a->z;
+                    *a = dec->rec.axes[idx - 1];
+                    for (axis = 0; (axis < 3) && (used != 0); axis++)
+                    {
+                        used = get_varint(&payload[pos], payload_len - pos, &val);
+                        pos += used;
+                        *axes[axis] = (int16_t)(*axes[axis] + (int32_t)((val >> 1) ^ (0U - (val & 1))));
+                    }
+
+                    if (used == 0)
+                    {
+                        rslt = SAMPLE_STREAM_E_BAD_FRAME;
+                        break;
+                    }
+                }
+            }
+
+            a->sensortime = time;
+        }
+
+        if ((rslt == SAMPLE_STREAM_OK) && ((idx != n_records) || (pos != payload_len)))
+        {
+            rslt = SAMPLE_STREAM_E_BAD_FRAME;
+        }
+
+        if ((rslt == SAMPLE_STREAM_OK) && (dec->axes_cb != NULL))
+        {
+            dec->axes_cb(frame[2] & SAMPLE_STREAM_TYPE_MSK, dec->rec.axes, n_records, dec->cb_ptr);
+        }
+    }
+    else if ((type == SAMPLE_STREAM_TYPE_ENV) && ((uint16_t)(n_records * SAMPLE_STREAM_ENV_LEN) == payload_len))
+    {
+        for (idx = 0; idx < n_records; idx++, pos += SAMPLE_STREAM_ENV_LEN)
+        {
+            e = &dec->rec.env[idx];
+            time += get_u16(&payload[pos]);
+            e->sensortime = time;
+            e->temperature = (int16_t)get_u16(&payload[pos + 2]);
+            e->pressure = get_u32(&payload[pos + 4]);
+            e->humidity = get_u32(&payload[pos + 8]);
+            e->gas_resistance = get_u32(&payload[pos + 12]);
+            e->status = payload[pos + 16];
+            e->gas_index = payload[pos + 17];
+        }
+
+        if (dec->env_cb != NULL)
+        {
+            dec->env_cb(dec->rec.env, n_records, dec->cb_ptr);
+        }
+    }
+    else
+    {
+        rslt = SAMPLE_STREAM_E_BAD_FRAME;
+    }
+
+    if (rslt == SAMPLE_STREAM_OK)
+    {
+        if (dec->seq_valid && (seq != dec->seq))
+        {
+            dec->n_lost_frames += (uint16_t)(seq - dec->seq);
+        }
+
+        dec->seq = seq + 1;
+        dec->seq_valid = 1;
+        dec->n_frames++;
+        dec->n_records += n_records;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief Drops the first bytes of the receive buffer.
+ */
+static void drop_bytes(uint16_t n, struct sample_stream_dec *dec)
+{
+    memmove(dec->frame, &dec->frame[n], dec->frame_len - n);
+    dec->frame_len -= n;
+}
+
+/*!
+ * @brief Consumes whatever frames, or garbage, the receive buffer starts with.
+ */
+static void scan_frames(struct sample_stream_dec *dec)
+{
+    uint16_t frame_len;
+
+    while (dec->frame_len > 0)
+    {
+        frame_len = SAMPLE_STREAM_HEADER_LEN + SAMPLE_STREAM_CRC_LEN;
+        if (dec->frame_len >= SAMPLE_STREAM_HEADER_LEN)
+        {
+            frame_len += get_u16(&dec->frame[10]);
+        }
+
+        if ((dec->frame[0] != SAMPLE_STREAM_SYNC_0) ||
+            ((dec->frame_len >= 2) && (dec->frame[1] != SAMPLE_STREAM_SYNC_1)) ||
+            (frame_len > SAMPLE_STREAM_MAX_FRAME))
+        {
+            /* Not a frame start, look for the next one */
+            dec->n_skipped++;
+            drop_bytes(1, dec);
+        }
+        else if ((dec->frame_len < SAMPLE_STREAM_HEADER_LEN) || (dec->frame_len < frame_len))
+        {
+            /* Wait for more bytes */
+            break;
+        }
+        else if (decode_frame(dec) == SAMPLE_STREAM_OK)
+        {
+            drop_bytes(frame_len, dec);
+        }
+        else
+        {
+            /* A sync pattern in the data, or a damaged frame */
+            dec->n_bad_frames++;
+            dec->n_skipped++;
+            drop_bytes(1, dec);
+        }
+    }
+}
+
+static void put_u16(uint8_t *buf, uint16_t val)
+{
+    buf[0] = (uint8_t)val;
+    buf[1] = (uint8_t)(val >> 8);
+}
+
+static void put_u32(uint8_t *buf, uint32_t val)
+{
+    buf[0] = (uint8_t)val;
+    buf[1] = (uint8_t)(val >> 8);
+    buf[2] = (uint8_t)(val >> 16);
+    buf[3] = (uint8_t)(val >> 24);
+}
+
+static uint16_t get_u16(const uint8_t *buf)
+{
+    return (uint16_t)(buf[0] | (buf[1] << 8));
+}
+
+static uint32_t get_u32(const uint8_t *buf)
+{
+    return (uint32_t)buf[0] | ((uint32_t)buf[1] << 8) | ((uint32_t)buf[2] << 16) | ((uint32_t)buf[3] << 24);
+}
+
+static uint8_t put_varint(uint8_t *buf, uint32_t val)
+{
+    uint8_t len = 0;
+
+    while (val >= 0x80)
+    {
+        buf[len++] = (uint8_t)(val | 0x80);
+        val >>= 7;
+    }
+
+    buf[len++] = (uint8_t)val;
+
+    return len;
+}
+
+/*!
+ * @brief Returns the number of bytes used, 0 if the varint does not end within len.
+ */
+static uint8_t get_varint(const uint8_t *buf, uint16_t len, uint32_t *val)
+{
+    uint8_t used = 0;
+    uint8_t shift = 0;
+
+    *val = 0;
+    while ((used < len) && (used < 5))
+    {
+        *val |= (uint32_t)(buf[used] & 0x7F) << shift;
+        shift += 7;
+        if ((buf[used++] & 0x80) == 0)
+        {
+            return used;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,293 @@
+/**
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @file    sample_stream.h
+ * @date    Oct 18, 2026
+ * @brief   Binary sample streaming protocol, encoder and decoder
+ *
+ * Samples are sent as frames of records of one sensor type, all fields little endian:
+ *
+ *   0     sync, 0xAA 0x55
+ *   2     type, SAMPLE_STREAM_TYPE_* | SAMPLE_STREAM_DELTA
+ *   3     number of records
+ *   4     sequence number, u16, one per frame
+ *   6     sensortime of the first record, u32
+ *   10    payload length, u16
+ *   12    records
+ *   12+n  CRC-16/CCITT-FALSE of bytes 2 to 12+n-1, u16
+ *
+ * Axes records (accel, gyro, aux, mag):
+ *   plain : u16 sensortime delta to the previous record, s16 x, y, z
+ *   delta : varint sensortime delta, then s16 x, y, z for the first record and
+ *           zig-zag varint x, y, z deltas to the previous record afterwards
+ * Environment records (BME68x):
+ *   u16 sensortime delta, s16 temperature (0.01 degC), u32 pressure (Pa),
+ *   u32 humidity (0.001 %rH), u32 gas resistance (Ohm), u8 status, u8 gas index
+ *
+ * The encoder has no platform dependency, the frames are handed to a write callback.
+ * The decoder runs on the host, fed with whatever chunks the link delivers.
+ */
+#ifndef SAMPLE_STREAM_H_
+#define SAMPLE_STREAM_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**********************************************************************************/
+/* macro definitions */
+/**********************************************************************************/
+/*! Largest frame in bytes, header and CRC included */
+#ifndef SAMPLE_STREAM_MAX_FRAME
+#define SAMPLE_STREAM_MAX_FRAME         (256)
+#endif
+
+/*! Frame layout */
+#define SAMPLE_STREAM_SYNC_0            UINT8_C(0xAA)
+#define SAMPLE_STREAM_SYNC_1            UINT8_C(0x55)
+#define SAMPLE_STREAM_HEADER_LEN        (12)
+#define SAMPLE_STREAM_CRC_LEN           (2)
+#define SAMPLE_STREAM_MAX_PAYLOAD       (SAMPLE_STREAM_MAX_FRAME - SAMPLE_STREAM_HEADER_LEN - SAMPLE_STREAM_CRC_LEN)
+
+/*! Record sizes */
+#define SAMPLE_STREAM_AXES_LEN          (8)
+#define SAMPLE_STREAM_AXES_DELTA_MIN    (4)
+#define SAMPLE_STREAM_ENV_LEN           (18)
+
+/*! Most records a frame can hold */
+#define SAMPLE_STREAM_MAX_RECORDS       (SAMPLE_STREAM_MAX_PAYLOAD / SAMPLE_STREAM_AXES_DELTA_MIN)
+
+/*! Record types */
+#define SAMPLE_STREAM_TYPE_ACCEL        UINT8_C(1)
+#define SAMPLE_STREAM_TYPE_GYRO         UINT8_C(2)
+#define SAMPLE_STREAM_TYPE_AUX          UINT8_C(3)
+#define SAMPLE_STREAM_TYPE_MAG          UINT8_C(4)
+#define SAMPLE_STREAM_TYPE_ENV          UINT8_C(5)
+#define SAMPLE_STREAM_TYPE_MSK          UINT8_C(0x0F)
+
+/*! Type flag: axes records are delta encoded */
+#define SAMPLE_STREAM_DELTA             UINT8_C(0x80)
+
+/*! Status codes */
+#define SAMPLE_STREAM_OK                INT8_C(0)
+#define SAMPLE_STREAM_E_NULL_PTR        INT8_C(-1)
+#define SAMPLE_STREAM_E_INVALID_TYPE    INT8_C(-2)
+#define SAMPLE_STREAM_E_BAD_FRAME       INT8_C(-3)
+
+/**********************************************************************************/
+/* data structure declarations  */
+/**********************************************************************************/
+
+/*!
+ * @brief Axes sample of accel, gyro, aux or mag
+ */
+struct sample_stream_axes
+{
+    /*! Sensor time */
+    uint32_t sensortime;
+
+    /*! Axes data */
+    int16_t x;
+    int16_t y;
+    int16_t z;
+};
+
+/*!
+ * @brief Environment sample of BME68x, integer units of the BME68x API
+ */
+struct sample_stream_env
+{
+    /*! Time stamp */
+    uint32_t sensortime;
+
+    /*! Temperature in 0.01 degree Celsius */
+    int16_t temperature;
+
+    /*! Pressure in Pascal */
+    uint32_t pressure;
+
+    /*! Humidity in 0.001 % relative humidity */
+    uint32_t humidity;
+
+    /*! Gas resistance in Ohm */
+    uint32_t gas_resistance;
+
+    /*! Measurement status */
+    uint8_t status;
+
+    /*! Heater profile index */
+    uint8_t gas_index;
+};
+
+/*!
+ * @brief Writes one frame to the link
+ */
+typedef void (*sample_stream_write_fptr_t)(const uint8_t *data, uint16_t len, void *intf_ptr);
+
+/*!
+ * @brief Encoder
+ */
+struct sample_stream_enc
+{
+    /*! Sequence number of the next frame */
+    uint16_t seq;
+
+    /*! Writes a frame */
+    sample_stream_write_fptr_t write;
+
+    /*! Passed to write */
+    void *intf_ptr;
+
+    /*! Frame being built */
+    uint8_t frame[SAMPLE_STREAM_MAX_FRAME];
+
+    /*! Frames and bytes written */
+    uint32_t n_frames;
+    uint32_t n_bytes;
+};
+
+/*!
+ * @brief Receives the records of a decoded frame. n is at most SAMPLE_STREAM_MAX_RECORDS.
+ */
+typedef void (*sample_stream_axes_fptr_t)(uint8_t type, const struct sample_stream_axes *s, uint16_t n, void *cb_ptr);
+typedef void (*sample_stream_env_fptr_t)(const struct sample_stream_env *s, uint16_t n, void *cb_ptr);
+
+/*!
+ * @brief Decoder
+ */
+struct sample_stream_dec
+{
+    /*! Record callbacks, either may be NULL */
+    sample_stream_axes_fptr_t axes_cb;
+    sample_stream_env_fptr_t env_cb;
+    void *cb_ptr;
+
+    /*! Frame being received */
+    uint8_t frame[SAMPLE_STREAM_MAX_FRAME];
+    uint16_t frame_len;
+
+    /*! Sequence number expected next */
+    uint16_t seq;
+    uint8_t seq_valid;
+
+    /*! Decoded records */
+    union
+    {
+        struct sample_stream_axes axes[SAMPLE_STREAM_MAX_RECORDS];
+        struct sample_stream_env env[SAMPLE_STREAM_MAX_PAYLOAD / SAMPLE_STREAM_ENV_LEN];
+    } rec;
+
+    /*! Good frames and their records */
+    uint32_t n_frames;
+    uint32_t n_records;
+
+    /*! Frames with a bad CRC or malformed payload */
+    uint32_t n_bad_frames;
+
+    /*! Frames missing according to the sequence numbers */
+    uint32_t n_lost_frames;
+
+    /*! Bytes skipped while looking for a frame */
+    uint32_t n_skipped;
+};
+
+/**********************************************************************************/
+/* functions */
+/**********************************************************************************/
+
+/*!
+ * @brief This API initializes an encoder.
+ *
+ * @param[in] write     : Writes a frame to the link.
+ * @param[in] intf_ptr  : Passed to write.
+ * @param[out] enc      : Encoder.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t sample_stream_init(sample_stream_write_fptr_t write, void *intf_ptr, struct sample_stream_enc *enc);
+
+/*!
+ * @brief This API sends axes samples, split into as many frames as needed.
+ * A new frame is also started when the time to the previous sample does not
+ * fit a plain record.
+ *
+ * @param[in] type     : SAMPLE_STREAM_TYPE_ACCEL, _GYRO, _AUX or _MAG,
+ *                       optionally or-ed with SAMPLE_STREAM_DELTA.
+ * @param[in] s        : Samples in time order.
+ * @param[in] n        : Number of samples.
+ * @param[in,out] enc  : Encoder.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t sample_stream_put_axes(uint8_t type, const struct sample_stream_axes *s, uint16_t n, struct sample_stream_enc *enc);
+
+/*!
+ * @brief This API sends environment samples, split into as many frames as needed.
+ *
+ * @param[in] s        : Samples in time order.
+ * @param[in] n        : Number of samples.
+ * @param[in,out] enc  : Encoder.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t sample_stream_put_env(const struct sample_stream_env *s, uint16_t n, struct sample_stream_enc *enc);
+
+/*!
+ * @brief This API initializes a decoder.
+ *
+ * @param[in] axes_cb  : Receives axes records, may be NULL.
+ * @param[in] env_cb   : Receives environment records, may be NULL.
+ * @param[in] cb_ptr   : Passed to the callbacks.
+ * @param[out] dec     : Decoder.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t sample_stream_dec_init(sample_stream_axes_fptr_t axes_cb,
+                              sample_stream_env_fptr_t env_cb,
+                              void *cb_ptr,
+                              struct sample_stream_dec *dec);
+
+/*!
+ * @brief This API feeds received bytes to the decoder. Complete frames are
+ * checked and their records handed to the callbacks.
+ *
+ * @param[in] data     : Received bytes, any chunking.
+ * @param[in] len      : Number of bytes.
+ * @param[in,out] dec  : Decoder.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t sample_stream_decode(const uint8_t *data, uint32_t len, struct sample_stream_dec *dec);
+
+/*!
+ * @brief This API computes the CRC-16/CCITT-FALSE of a buffer.
+ *
+ * @param[in] data : Data.
+ * @param[in] len  : Length of data.
+ *
+ * @return CRC
+ */
+uint16_t sample_stream_crc16(const uint8_t *data, uint16_t len);
+
+/*!
+ * @brief This API continues a CRC-16/CCITT-FALSE over the next part of the data,
+ * for data which is not contiguous. Start with crc = 0xFFFF.
+ *
+ * @param[in] crc  : CRC of the preceding parts.
+ * @param[in] data : Data.
+ * @param[in] len  : Length of data.
+ *
+ * @return CRC
+ */
+uint16_t sample_stream_crc16_update(uint16_t crc, const uint8_t *data, uint16_t len);
+
+#endif /* SAMPLE_STREAM_H_ */
@@ -0,0 +1,402 @@
+/**
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @file    stream_core.c
+ * @date    Oct 18, 2026
+ * @brief   On-board streaming of sensor register blocks
+ */
+
+/**********************************************************************************/
+/* system header includes */
+/**********************************************************************************/
+#include <string.h>
+
+/**********************************************************************************/
+/* own header files */
+/**********************************************************************************/
+#include "stream_core.h"
+
+/**********************************************************************************/
+/* static function declarations */
+/**********************************************************************************/
+
+/*!
+ * @brief Returns the channel of an identifier, NULL if out of range.
+ */
+static struct stream_core_channel *get_channel(uint8_t channel_id, struct stream_core *core);
+
+/*!
+ * @brief Marks a channel pending, or counts the overrun.
+ */
+static uint8_t make_pending(struct stream_core_channel *ch, uint64_t now_us);
+
+/*!
+ * @brief Reads the blocks of one sample and queues it.
+ */
+static void read_sample(struct stream_core_channel *ch, uint64_t stamp_us, struct stream_core *core);
+
+/*!
+ * @brief Greatest common divisor.
+ */
+static uint32_t gcd(uint32_t a, uint32_t b);
+
+/**********************************************************************************/
+/* functions */
+/**********************************************************************************/
+
+/*!
+ * @brief This API initializes the streaming core.
+ */
+int16_t stream_core_init(stream_core_read_fptr_t read, struct stream_core *core)
+{
+    int16_t rslt = STREAM_CORE_OK;
+
+    if ((read == NULL) || (core == NULL))
+    {
+        rslt = STREAM_CORE_E_NULL_PTR;
+    }
+    else
+    {
+        memset(core, 0, sizeof(*core));
+        core->read = read;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API configures a channel.
+ */
+int16_t stream_core_config(uint8_t channel_id,
+                           const struct coines_streaming_config *stream_config,
+                           const struct coines_streaming_blocks *data_blocks,
+                           struct stream_core *core)
+{
+    int16_t rslt = STREAM_CORE_OK;
+    struct stream_core_channel *ch;
+    uint32_t sample_len = 0;
+    uint16_t idx;
+
+    if ((stream_config == NULL) || (data_blocks == NULL) || (core == NULL))
+    {
+        return STREAM_CORE_E_NULL_PTR;
+    }
+
+    ch = get_channel(channel_id, core);
+    if ((ch == NULL) || core->running || (data_blocks->no_of_blocks == 0) ||
+        (data_blocks->no_of_blocks > STREAM_CORE_MAX_BLOCKS))
+    {
+        rslt = STREAM_CORE_E_INVALID_CFG;
+    }
+    else
+    {
+        for (idx = 0; idx < data_blocks->no_of_blocks; idx++)
+        {
+            sample_len += data_blocks->no_of_data_bytes[idx];
+        }
+
+        if (stream_config->int_timestamp)
+        {
+            sample_len += STREAM_CORE_TIMESTAMP_LEN;
+        }
+
+        /* A sample must fit the ring, with room to spare for the next one */
+        if ((sample_len == 0) || ((sample_len * 2) > STREAM_CORE_BUF_SIZE))
+        {
+            rslt = STREAM_CORE_E_INVALID_CFG;
+        }
+    }
+
+    if (rslt == STREAM_CORE_OK)
+    {
+        ch->cfg = *stream_config;
+        ch->blocks = *data_blocks;
+        ch->sample_len = (uint16_t)sample_len;
+        ch->period_us = stream_config->sampling_time;
+        if (stream_config->sampling_units == COINES_SAMPLING_TIME_IN_MILLI_SEC)
+        {
+            ch->period_us *= 1000;
+        }
+
+        ch->configured = 1;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API starts streaming on all configured channels.
+ */
+int16_t stream_core_start(enum coines_streaming_mode mode, uint64_t now_us, uint32_t *tick_us, struct stream_core *core)
+{
+    int16_t rslt = STREAM_CORE_E_INVALID_CFG;
+    struct stream_core_channel *ch;
+    uint32_t tick = 0;
+    uint8_t idx;
+
+    if ((tick_us == NULL) || (core == NULL))
+    {
+        return STREAM_CORE_E_NULL_PTR;
+    }
+
+    for (idx = 0; idx < STREAM_CORE_MAX_CHANNELS; idx++)
+    {
+        ch = &core->ch[idx];
+        if (ch->configured)
+        {
+            if ((mode == COINES_STREAMING_MODE_POLLING) && (ch->period_us == 0))
+            {
+                rslt = STREAM_CORE_E_INVALID_CFG;
+                break;
+            }
+
+            (void)rx_ring_init(ch->buf, STREAM_CORE_BUF_SIZE, &ch->ring);
+            memset(&ch->stats, 0, sizeof(ch->stats));
+            ch->pending = 0;
+            ch->next_us = now_us + ch->period_us;
+            tick = gcd(tick, ch->period_us);
+            rslt = STREAM_CORE_OK;
+        }
+    }
+
+    /* Periods such as 1000 and 999 us would need a 1 us timer */
+    if ((rslt == STREAM_CORE_OK) && (mode == COINES_STREAMING_MODE_POLLING) && (tick < STREAM_CORE_MIN_TICK_US))
+    {
+        rslt = STREAM_CORE_E_INVALID_CFG;
+    }
+
+    if (rslt == STREAM_CORE_OK)
+    {
+        *tick_us = tick;
+        core->mode = mode;
+        core->running = 1;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API stops streaming.
+ */
+void stream_core_stop(struct stream_core *core)
+{
+    if (core != NULL)
+    {
+        core->running = 0;
+    }
+}
+
+/*!
+ * @brief This API marks the channels due at now_us as pending, polling mode.
+ */
+uint8_t stream_core_timer_tick(uint64_t now_us, struct stream_core *core)
+{
+    struct stream_core_channel *ch;
+    uint8_t mask = 0;
+    uint8_t idx;
+
+    if ((core != NULL) && core->running && (core->mode == COINES_STREAMING_MODE_POLLING))
+    {
+        for (idx = 0; idx < STREAM_CORE_MAX_CHANNELS; idx++)
+        {
+            ch = &core->ch[idx];
+
+            /* Due once now_us has reached next_us, a 64 bit time does not wrap */
+            if (ch->configured && (now_us >= ch->next_us))
+            {
+                /* Stamped with the scheduled time, the timer is the reference */
+                if (make_pending(ch, ch->next_us))
+                {
+                    mask |= (uint8_t)(1 << idx);
+                }
+
+                ch->next_us += ch->period_us;
+            }
+        }
+    }
+
+    return mask;
+}
+
+/*!
+ * @brief This API marks a channel pending, interrupt mode.
+ */
+uint8_t stream_core_trigger(uint8_t channel_id, uint64_t now_us, struct stream_core *core)
+{
+    struct stream_core_channel *ch = get_channel(channel_id, core);
+    uint8_t made_pending = 0;
+
+    if ((ch != NULL) && ch->configured && core->running && (core->mode == COINES_STREAMING_MODE_INTERRUPT))
+    {
+        made_pending = make_pending(ch, now_us);
+    }
+
+    return made_pending;
+}
+
+/*!
+ * @brief This API reads the pending samples from the sensors and queues them.
+ */
+void stream_core_process(struct stream_core *core)
+{
+    struct stream_core_channel *ch;
+    uint64_t stamp_us;
+    uint8_t idx;
+
+    if (core != NULL)
+    {
+        for (idx = 0; idx < STREAM_CORE_MAX_CHANNELS; idx++)
+        {
+            ch = &core->ch[idx];
+            if (ch->pending)
+            {
+                /* Taken before the flag is released, a newer trigger counts as an overrun */
+                stamp_us = ch->stamp_us;
+                ch->pending = 0;
+
+                if (core->running)
+                {
+                    read_sample(ch, stamp_us, core);
+                }
+            }
+        }
+    }
+}
+
+/*!
+ * @brief This API copies out queued samples of a channel.
+ */
+int16_t stream_core_read(uint8_t channel_id,
+                         uint32_t number_of_samples,
+                         uint8_t *data,
+                         uint32_t *valid_samples_count,
+                         struct stream_core *core)
+{
+    int16_t rslt = STREAM_CORE_OK;
+    struct stream_core_channel *ch;
+    uint32_t n_samples;
+
+    if ((data == NULL) || (valid_samples_count == NULL) || (core == NULL))
+    {
+        return STREAM_CORE_E_NULL_PTR;
+    }
+
+    ch = get_channel(channel_id, core);
+    if ((ch == NULL) || !ch->configured || (ch->ring.buf == NULL))
+    {
+        rslt = STREAM_CORE_E_INVALID_CFG;
+        *valid_samples_count = 0;
+    }
+    else
+    {
+        /* Only whole samples, the producer queues a sample in one go */
+        n_samples = rx_ring_count(&ch->ring) / ch->sample_len;
+        if (n_samples > number_of_samples)
+        {
+            n_samples = number_of_samples;
+        }
+
+        *valid_samples_count = rx_ring_read(data, n_samples * ch->sample_len, &ch->ring) / ch->sample_len;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief Returns the channel of an identifier, NULL if out of range.
+ */
+static struct stream_core_channel *get_channel(uint8_t channel_id, struct stream_core *core)
+{
+    struct stream_core_channel *ch = NULL;
+
+    if ((core != NULL) && (channel_id >= COINES_MIN_SENSOR_ID) && (channel_id <= STREAM_CORE_MAX_CHANNELS))
+    {
+        ch = &core->ch[channel_id - COINES_MIN_SENSOR_ID];
+    }
+
+    return ch;
+}
+
+/*!
+ * @brief Marks a channel pending, or counts the overrun.
+ */
+static uint8_t make_pending(struct stream_core_channel *ch, uint64_t now_us)
+{
+    uint8_t made_pending = 0;
+
+    if (ch->pending)
+    {
+        ch->stats.n_overruns++;
+    }
+    else
+    {
+        ch->stamp_us = now_us;
+        ch->pending = 1;
+        made_pending = 1;
+    }
+
+    return made_pending;
+}
+
+/*!
+ * @brief Reads the blocks of one sample and queues it.
+ */
+static void read_sample(struct stream_core_channel *ch, uint64_t stamp_us, struct stream_core *core)
+{
+    uint8_t *sample = core->sample;
+    uint16_t len = 0;
+    uint16_t idx;
+    int8_t bus_rslt = 0;
+
+    /* Whole samples only, so the reader never sees a torn one */
+    if ((rx_ring_capacity(&ch->ring) - rx_ring_count(&ch->ring)) < ch->sample_len)
+    {
+        ch->stats.n_dropped++;
+    }
+    else
+    {
+        for (idx = 0; (idx < ch->blocks.no_of_blocks) && (bus_rslt == 0); idx++)
+        {
+            bus_rslt = core->read(&ch->cfg, ch->blocks.reg_start_addr[idx], &sample[len], ch->blocks.no_of_data_bytes[idx]);
+            len += ch->blocks.no_of_data_bytes[idx];
+        }
+
+        if (bus_rslt != 0)
+        {
+            ch->stats.n_bus_errors++;
+        }
+        else
+        {
+            if (ch->cfg.int_timestamp)
+            {
+                /* 48 bit microsecond time, MSB first */
+                sample[len++] = (uint8_t)(stamp_us >> 40);
+                sample[len++] = (uint8_t)(stamp_us >> 32);
+                sample[len++] = (uint8_t)(stamp_us >> 24);
+                sample[len++] = (uint8_t)(stamp_us >> 16);
+                sample[len++] = (uint8_t)(stamp_us >> 8);
+                sample[len++] = (uint8_t)stamp_us;
+            }
+
+            (void)rx_ring_write(sample, len, &ch->ring);
+            ch->stats.n_samples++;
+        }
+    }
+}
+
+/*!
+ * @brief Greatest common divisor.
+ */
+static uint32_t gcd(uint32_t a, uint32_t b)
+{
+    uint32_t tmp;
+
+    while (b != 0)
+    {
+        tmp = a % b;
+        a = b;
+        b = tmp;
+    }
+
+    return a;
+}
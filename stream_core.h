@@ -0,0 +1,256 @@
+/**
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @file    stream_core.h
+ * @date    Oct 18, 2026
+ * @brief   On-board streaming of sensor register blocks
+ *
+ * Each channel reads up to STREAM_CORE_MAX_BLOCKS register blocks per sample,
+ * triggered by a timer (polling mode) or by the sensor interrupt pin
+ * (interrupt mode), and queues the sample in its own ring.
+ *
+ * The core has no platform dependency. The trigger side, stream_core_timer_tick
+ * and stream_core_trigger, only takes the time stamp and is meant for the timer
+ * and GPIO interrupts. stream_core_process does the bus reads at a lower
+ * priority, where the bus driver may wait for its own interrupt.
+ * stream_core_read is called from the main loop.
+ *
+ * A sample holds the block bytes in configuration order, followed by the
+ * trigger time in microseconds as 6 bytes, MSB first, if int_timestamp is set:
+ * the lower 48 bits of the 64 bit time of the board.
+ */
+#ifndef STREAM_CORE_H_
+#define STREAM_CORE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "coines.h"
+#include "rx_ring.h"
+
+/**********************************************************************************/
+/* macro definitions */
+/**********************************************************************************/
+/*! Number of channels, channel identifiers run from 1 */
+#define STREAM_CORE_MAX_CHANNELS        COINES_MAX_SENSOR_ID
+
+/*! Register blocks per sample, the size of struct coines_streaming_blocks */
+#define STREAM_CORE_MAX_BLOCKS          (10)
+
+/*! Shortest timer period in polling mode; channel periods whose greatest
+ * common divisor is shorter are refused, the timer interrupt would take the CPU
+ */
+#ifndef STREAM_CORE_MIN_TICK_US
+#define STREAM_CORE_MIN_TICK_US         (100)
+#endif
+
+/*! Bytes of the time stamp of a sample */
+#define STREAM_CORE_TIMESTAMP_LEN       (6)
+
+/*! Longest sample, all blocks of 255 bytes and the time stamp */
+#define STREAM_CORE_MAX_SAMPLE_LEN      (STREAM_CORE_MAX_BLOCKS * 255 + STREAM_CORE_TIMESTAMP_LEN)
+
+/*! Ring size of a channel, a power of two */
+#ifndef STREAM_CORE_BUF_SIZE
+#define STREAM_CORE_BUF_SIZE            (8192)
+#endif
+
+/*! Status codes, the COINES error codes */
+#define STREAM_CORE_OK                  COINES_SUCCESS
+#define STREAM_CORE_E_NULL_PTR          COINES_E_NULL_PTR
+#define STREAM_CORE_E_INVALID_CFG       COINES_E_FAILURE
+
+/**********************************************************************************/
+/* data structure declarations  */
+/**********************************************************************************/
+
+/*!
+ * @brief Reads a register block of the sensor of a channel
+ *
+ * @return 0 on success
+ */
+typedef int8_t (*stream_core_read_fptr_t)(const struct coines_streaming_config *cfg,
+                                          uint8_t reg_addr,
+                                          uint8_t *data,
+                                          uint16_t len);
+
+/*!
+ * @brief Counters of a channel
+ */
+struct stream_core_stats
+{
+    /*! Samples queued */
+    uint32_t n_samples;
+
+    /*! Samples dropped because the ring was full */
+    uint32_t n_dropped;
+
+    /*! Triggers lost because the previous one was still being read */
+    uint32_t n_overruns;
+
+    /*! Samples dropped because of a bus error */
+    uint32_t n_bus_errors;
+};
+
+/*!
+ * @brief Streaming channel
+ */
+struct stream_core_channel
+{
+    /*! Channel is configured */
+    uint8_t configured;
+
+    /*! Sensor interface and sampling settings */
+    struct coines_streaming_config cfg;
+
+    /*! Register blocks */
+    struct coines_streaming_blocks blocks;
+
+    /*! Bytes per sample, time stamp included */
+    uint16_t sample_len;
+
+    /*! Sampling period in polling mode */
+    uint32_t period_us;
+
+    /*! Next sampling time in polling mode */
+    uint64_t next_us;
+
+    /*! Trigger time of the pending sample, written only while no sample is pending */
+    volatile uint64_t stamp_us;
+
+    /*! A sample is to be read */
+    volatile uint8_t pending;
+
+    /*! Queued samples */
+    struct rx_ring ring;
+    uint8_t buf[STREAM_CORE_BUF_SIZE];
+
+    /*! Counters */
+    struct stream_core_stats stats;
+};
+
+/*!
+ * @brief Streaming core
+ */
+struct stream_core
+{
+    /*! Channels 1 to STREAM_CORE_MAX_CHANNELS */
+    struct stream_core_channel ch[STREAM_CORE_MAX_CHANNELS];
+
+    /*! Reads a register block */
+    stream_core_read_fptr_t read;
+
+    /*! Streaming mode */
+    enum coines_streaming_mode mode;
+
+    /*! Streaming is running */
+    volatile uint8_t running;
+
+    /*! Sample being read, kept off the stack of stream_core_process */
+    uint8_t sample[STREAM_CORE_MAX_SAMPLE_LEN];
+};
+
+/**********************************************************************************/
+/* functions */
+/**********************************************************************************/
+
+/*!
+ * @brief This API initializes the streaming core.
+ *
+ * @param[in] read  : Reads a register block.
+ * @param[out] core : Streaming core.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int16_t stream_core_init(stream_core_read_fptr_t read, struct stream_core *core);
+
+/*!
+ * @brief This API configures a channel. Streaming must be stopped.
+ *
+ * @param[in] channel_id    : Channel, 1 to STREAM_CORE_MAX_CHANNELS.
+ * @param[in] stream_config : Sensor interface and sampling settings.
+ * @param[in] data_blocks   : Register blocks read per sample.
+ * @param[in,out] core      : Streaming core.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int16_t stream_core_config(uint8_t channel_id,
+                           const struct coines_streaming_config *stream_config,
+                           const struct coines_streaming_blocks *data_blocks,
+                           struct stream_core *core);
+
+/*!
+ * @brief This API starts streaming on all configured channels, emptying their rings.
+ *
+ * @param[in] mode       : Polling or interrupt mode.
+ * @param[in] now_us     : Current time.
+ * @param[out] tick_us   : Polling mode: timer period for stream_core_timer_tick,
+ *                         the greatest common divisor of the channel periods.
+ * @param[in,out] core   : Streaming core.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail, STREAM_CORE_E_INVALID_CFG also in polling mode if the
+ *                timer period would be shorter than STREAM_CORE_MIN_TICK_US
+ */
+int16_t stream_core_start(enum coines_streaming_mode mode, uint64_t now_us, uint32_t *tick_us, struct stream_core *core);
+
+/*!
+ * @brief This API stops streaming. Queued samples can still be read.
+ *
+ * @param[in,out] core : Streaming core.
+ */
+void stream_core_stop(struct stream_core *core);
+
+/*!
+ * @brief This API marks the channels due at now_us as pending, polling mode. Timer interrupt.
+ *
+ * @param[in] now_us   : Current time.
+ * @param[in,out] core : Streaming core.
+ *
+ * @return Mask of the channels made pending, bit 0 for channel 1
+ */
+uint8_t stream_core_timer_tick(uint64_t now_us, struct stream_core *core);
+
+/*!
+ * @brief This API marks a channel pending, interrupt mode. GPIO interrupt.
+ *
+ * @param[in] channel_id : Channel.
+ * @param[in] now_us     : Time of the interrupt edge.
+ * @param[in,out] core   : Streaming core.
+ *
+ * @return 1 if the channel was made pending
+ */
+uint8_t stream_core_trigger(uint8_t channel_id, uint64_t now_us, struct stream_core *core);
+
+/*!
+ * @brief This API reads the pending samples from the sensors and queues them.
+ *
+ * @param[in,out] core : Streaming core.
+ */
+void stream_core_process(struct stream_core *core);
+
+/*!
+ * @brief This API copies out queued samples of a channel.
+ *
+ * @param[in] channel_id           : Channel.
+ * @param[in] number_of_samples    : Most samples to copy.
+ * @param[out] data                : Destination, number_of_samples samples.
+ * @param[out] valid_samples_count : Samples copied.
+ * @param[in,out] core             : Streaming core.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int16_t stream_core_read(uint8_t channel_id,
+                         uint32_t number_of_samples,
+                         uint8_t *data,
+                         uint32_t *valid_samples_count,
+                         struct stream_core *core);
+
+#endif /* STREAM_CORE_H_ */
@@ -0,0 +1,330 @@
+/**\
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ble_stream.h"
+#include "sample_stream.h"
+
+/******************************************************************************/
+/*!                Macro definition                                           */
+
+/*! Stream setup of the board: 244 byte packets, 8 of them, 20 ms latency */
+#define PACKET_SIZE         UINT16_C(244)
+#define N_SLOTS             UINT8_C(8)
+#define LATENCY_US          UINT32_C(20000)
+
+/*! Link: 7.5 ms connection interval, 4 notification buffers in the stack */
+#define CONN_INTERVAL_US    UINT32_C(7500)
+#define LINK_BUFS           UINT8_C(4)
+
+/*! Simulation step, and the period of the timer running ble_stream_process */
+#define STEP_US             UINT32_C(100)
+#define TIMER_US            UINT32_C(1000)
+
+/*! Time of the start, close to the wrap of the 32 bit microsecond count */
+#define START_US            UINT32_C(0xFFF00000)
+
+/*! Samples are encoded once this many are pending, like a FIFO watermark */
+#define BATCH               UINT16_C(10)
+
+/*! Defaults: 200 Hz accelerometer, 6 packets per connection event, 60 s */
+#define DEFAULT_RATE_HZ     UINT32_C(200)
+#define DEFAULT_PER_EVENT   UINT32_C(6)
+#define DEFAULT_SECONDS     UINT32_C(60)
+
+/******************************************************************************/
+/*!           Structure Definition                                            */
+
+/*! Simulated BLE link: notifications queued in the stack, sent at connection events */
+struct sim_link
+{
+    uint8_t buf[LINK_BUFS][PACKET_SIZE];
+    uint16_t len[LINK_BUFS];
+    uint8_t head;
+    uint8_t tail;
+    uint32_t per_event;
+};
+
+/*! Outcome of a run */
+struct sim_result
+{
+    /*! Frames written by the encoder, and those the host decoded */
+    uint32_t n_frames;
+    uint32_t n_decoded;
+
+    /*! Frames the host found cut or lost */
+    uint32_t n_bad;
+    uint32_t n_lost;
+
+    /*! Counters of the stream */
+    struct ble_stream_stats stats;
+};
+
+/******************************************************************************/
+/*!           Static Variable Definition                                      */
+
+/*! Stream, its storage and the link */
+static struct ble_stream stream;
+static uint8_t stream_buf[N_SLOTS * PACKET_SIZE];
+static struct sim_link link;
+
+/*! Encoder on the board, decoder on the host */
+static struct sample_stream_enc enc;
+static struct sample_stream_dec dec;
+
+/*! Current time */
+static uint32_t now_us;
+
+/******************************************************************************/
+/*!           Static Function Declaration                                     */
+
+/*!
+ *  @brief Runs the stream, the caller only writes frames; a timer sends the held packets.
+ */
+static void run(uint32_t rate_hz, uint32_t per_event, uint32_t seconds, struct sim_result *result);
+
+/*!
+ *  @brief Sends one packet: queued in the stack if it has a buffer free.
+ */
+static int8_t link_send(const uint8_t *data, uint16_t len, void *intf_ptr);
+
+/*!
+ *  @brief Connection event: the queued notifications reach the host.
+ */
+static void link_event(struct sim_link *sim);
+
+/*!
+ *  @brief Writes an encoded frame to the stream.
+ */
+static void frame_write(const uint8_t *data, uint16_t len, void *intf_ptr);
+
+/*!
+ *  @brief Prints a run and checks it.
+ */
+static int check_result(uint32_t rate_hz, uint32_t per_event, const struct sim_result *result);
+
+/******************************************************************************/
+/*!            Functions                                                      */
+
+/*
+ * Simulates the BLE NUS transmit path on the host: an accelerometer stream
+ * is encoded with sample_stream, the frames are written to ble_stream, the
+ * link takes a few notifications per connection event and the host decodes
+ * what arrives. A frame must never be cut, every dropped frame must show as
+ * a sequence gap, and a partial packet must leave within the latency bound
+ * with no further writes, as the timer alone sends it.
+ *
+ *   ble_stream_sim [rate_hz] [packets_per_event] [seconds]
+ */
+int main(int argc, char *argv[])
+{
+    struct sim_result result;
+    uint32_t rate_hz = DEFAULT_RATE_HZ;
+    uint32_t per_event = DEFAULT_PER_EVENT;
+    uint32_t seconds = DEFAULT_SECONDS;
+    int ok = 1;
+
+    if (argc > 1)
+    {
+        rate_hz = (uint32_t)strtoul(argv[1], NULL, 0);
+    }
+
+    if (argc > 2)
+    {
+        per_event = (uint32_t)strtoul(argv[2], NULL, 0);
+    }
+
+    if (argc > 3)
+    {
+        seconds = (uint32_t)strtoul(argv[3], NULL, 0);
+    }
+
+    if ((rate_hz == 0) || (rate_hz > 1000000 / STEP_US) || (per_event == 0) || (seconds == 0))
+    {
+        printf("Usage: %s [rate_hz] [packets_per_event] [seconds]\n", argv[0]);
+
+        return EXIT_FAILURE;
+    }
+
+    /* The stream refuses a slot count which would break the wrap of its counts */
+    if ((ble_stream_init(stream_buf, PACKET_SIZE, 6, LATENCY_US, link_send, &link, &stream) !=
+         BLE_STREAM_E_INVALID_CFG))
+    {
+        printf("6 slots were accepted\n");
+        ok = 0;
+    }
+
+    /* A slow stream: every packet leaves partial, sent by the timer */
+    run(5, per_event, seconds, &result);
+    ok &= check_result(5, per_event, &result);
+
+    run(rate_hz, per_event, seconds, &result);
+    ok &= check_result(rate_hz, per_event, &result);
+
+    /* More than the link carries: frames are dropped whole */
+    run(rate_hz * 40, 1, seconds, &result);
+    ok &= check_result(rate_hz * 40, 1, &result);
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/*!
+ *  @brief Runs the stream, the caller only writes frames; a timer sends the held packets.
+ */
+static void run(uint32_t rate_hz, uint32_t per_event, uint32_t seconds, struct sim_result *result)
+{
+    struct sample_stream_axes samples[BATCH];
+    uint64_t n_steps = ((uint64_t)seconds * 1000000) / STEP_US;
+    uint64_t step;
+    uint64_t elapsed_us;
+    uint32_t n_samples = 0;
+    uint16_t n_pending = 0;
+
+    memset(result, 0, sizeof(*result));
+    memset(&link, 0, sizeof(link));
+    link.per_event = per_event;
+    now_us = START_US;
+
+    (void)ble_stream_init(stream_buf, PACKET_SIZE, N_SLOTS, LATENCY_US, link_send, &link, &stream);
+    (void)sample_stream_init(frame_write, result, &enc);
+    (void)sample_stream_dec_init(NULL, NULL, NULL, &dec);
+
+    for (step = 0; step < n_steps; step++)
+    {
+        elapsed_us = step * STEP_US;
+
+        /* Sensor: a sample every 1/rate_hz, read in batches */
+        while (((uint64_t)n_samples * 1000000) / rate_hz <= elapsed_us)
+        {
+            samples[n_pending].sensortime = n_samples * 4;
+            samples[n_pending].x = (int16_t)n_samples;
+            samples[n_pending].y = (int16_t)(n_samples * 3);
+            samples[n_pending].z = (int16_t)(-(int32_t)n_samples);
+            n_pending++;
+            n_samples++;
+
+            if ((n_pending == BATCH) || (rate_hz < BATCH))
+            {
+                (void)sample_stream_put_axes(SAMPLE_STREAM_TYPE_ACCEL, samples, n_pending, &enc);
+                n_pending = 0;
+            }
+        }
+
+        /* Timer, as the SysTick pending the transmit interrupt */
+        if ((elapsed_us % TIMER_US) == 0)
+        {
+            (void)ble_stream_process(now_us, &stream);
+        }
+
+        if ((elapsed_us % CONN_INTERVAL_US) == 0)
+        {
+            link_event(&link);
+        }
+
+        now_us += STEP_US;
+    }
+
+    result->n_decoded = dec.n_frames;
+    result->n_bad = dec.n_bad_frames;
+    result->n_lost = dec.n_lost_frames;
+    result->stats = stream.stats;
+}
+
+/*!
+ *  @brief Sends one packet: queued in the stack if it has a buffer free.
+ */
+static int8_t link_send(const uint8_t *data, uint16_t len, void *intf_ptr)
+{
+    struct sim_link *sim = (struct sim_link *)intf_ptr;
+
+    if ((uint8_t)(sim->head - sim->tail) >= LINK_BUFS)
+    {
+        return BLE_STREAM_W_BUSY;
+    }
+
+    memcpy(sim->buf[sim->head % LINK_BUFS], data, len);
+    sim->len[sim->head % LINK_BUFS] = len;
+    sim->head++;
+
+    return BLE_STREAM_OK;
+}
+
+/*!
+ *  @brief Connection event: the queued notifications reach the host.
+ */
+static void link_event(struct sim_link *sim)
+{
+    uint32_t n_sent = 0;
+
+    while ((sim->head != sim->tail) && (n_sent < sim->per_event))
+    {
+        (void)sample_stream_decode(sim->buf[sim->tail % LINK_BUFS], sim->len[sim->tail % LINK_BUFS], &dec);
+        sim->tail++;
+        n_sent++;
+    }
+}
+
+/*!
+ *  @brief Writes an encoded frame to the stream.
+ */
+static void frame_write(const uint8_t *data, uint16_t len, void *intf_ptr)
+{
+    struct sim_result *result = (struct sim_result *)intf_ptr;
+
+    result->n_frames++;
+    (void)ble_stream_write(data, len, now_us, &stream);
+}
+
+/*!
+ *  @brief Prints a run and checks it.
+ */
+static int check_result(uint32_t rate_hz, uint32_t per_event, const struct sim_result *result)
+{
+    const struct ble_stream_stats *stats = &result->stats;
+    uint32_t in_flight = result->n_frames - result->n_decoded - stats->n_dropped_writes;
+    int ok = 1;
+
+    printf("%6lu Hz, %lu per event: %6lu frames, %6lu decoded, %5lu dropped, %5lu lost, %lu cut, "
+           "%6lu packets (%lu full), latency max %lu us mean %lu us\n",
+           (unsigned long)rate_hz,
+           (unsigned long)per_event,
+           (unsigned long)result->n_frames,
+           (unsigned long)result->n_decoded,
+           (unsigned long)stats->n_dropped_writes,
+           (unsigned long)result->n_lost,
+           (unsigned long)result->n_bad,
+           (unsigned long)stats->n_packets,
+           (unsigned long)stats->n_full_packets,
+           (unsigned long)stats->max_latency_us,
+           (unsigned long)((stats->n_packets != 0) ? (stats->sum_latency_us / stats->n_packets) : 0));
+
+    /* Frames still in the stream or the link at the end are not lost, each takes
+     * at least a header and a CRC
+     */
+    if ((result->n_bad != 0) ||
+        (in_flight > ((N_SLOTS + LINK_BUFS) * PACKET_SIZE) / (SAMPLE_STREAM_HEADER_LEN + SAMPLE_STREAM_CRC_LEN)))
+    {
+        printf("  frames were cut or went missing\n");
+        ok = 0;
+    }
+
+    if (result->n_lost > stats->n_dropped_writes)
+    {
+        printf("  more frames lost than dropped\n");
+        ok = 0;
+    }
+
+    /* Unless the link is the limit, a packet leaves within the latency and a timer period */
+    if ((stats->n_dropped_writes == 0) && (stats->max_latency_us > LATENCY_US + TIMER_US))
+    {
+        printf("  a packet was held longer than %lu us\n", (unsigned long)(LATENCY_US + TIMER_US));
+        ok = 0;
+    }
+
+    return ok;
+}
@@ -0,0 +1,586 @@
+/**\
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "bmi270_maximum_fifo.h"
+
+/******************************************************************************/
+/*!                Macro definition                                           */
+
+/*! Register map */
+#define REG_FIFO_LENGTH_0   UINT8_C(0x24)
+#define REG_FIFO_LENGTH_1   UINT8_C(0x25)
+#define REG_FIFO_DATA       UINT8_C(0x26)
+#define REG_FIFO_CONFIG_1   UINT8_C(0x49)
+
+/*! FIFO frames in header mode: accel and gyro, skip, and the byte read from an empty FIFO */
+#define HDR_ACC_GYR         UINT8_C(0x8C)
+#define HDR_SKIP            UINT8_C(0x40)
+#define HDR_EMPTY           UINT8_C(0x80)
+#define FRAME_LEN           UINT8_C(13)
+#define SKIP_LEN            UINT8_C(2)
+
+/*! Header mode with accel and gyro */
+#define FIFO_CONFIG_1       UINT8_C(0xD0)
+
+/*! 1600 Hz output data rate, drain from this fill level on, as the watermark interrupt */
+#define FRAME_US            (625.0)
+#define WATERMARK           UINT16_C(4050)
+
+/*! Time per byte: I2C at 400 kHz, SPI at 10 MHz, in microseconds */
+#define I2C_US_PER_BYTE     (22.5)
+#define SPI_US_PER_BYTE     (0.8)
+
+/*! Frames per phase, 10 s at 1600 Hz */
+#define PHASE_FRAMES        UINT32_C(16000)
+
+/*! Overflow phase: the watermark is served this many frames late, the FIFO
+ * holds about 160 frames above the watermark
+ */
+#define LATE_FRAMES         UINT32_C(250)
+
+/*! Stall phase: the sink stops every this many calls */
+#define STALL_EVERY         UINT32_C(3)
+
+/*! Frames each sink call can take */
+#define SINK_FRAMES         UINT16_C(100)
+
+/*! Storage of the simulated FIFO, compacted once the tail passes QUEUE_COMPACT */
+#define QUEUE_SIZE          UINT32_C(65536)
+#define QUEUE_COMPACT       UINT32_C(60000)
+
+/*! Parse cost: frames in a full FIFO, and runs */
+#define FULL_FRAMES         (BMI270_MAXIMUM_FIFO_SIZE / FRAME_LEN)
+#define PARSE_RUNS          UINT32_C(20000)
+
+/******************************************************************************/
+/*!           Structure Definition                                            */
+
+/*! Frames checked by the sink */
+struct sink_check
+{
+    /*! Next expected sequence number, valid once started */
+    uint16_t next_seq;
+    uint8_t started;
+
+    /*! Frames delivered, frames missing from the sequence and frames out of order */
+    uint32_t n_frames;
+    uint32_t n_missing;
+    uint32_t n_bad;
+
+    /*! Sink calls, and the sink stops every stall_every calls, 0 for never */
+    uint32_t n_calls;
+    uint32_t stall_every;
+};
+
+/******************************************************************************/
+/*!           Static Variable Definition                                      */
+
+/*! Simulated FIFO: bytes from head to tail, frames dropped since the last skip frame and in total */
+static uint8_t queue[QUEUE_SIZE];
+static uint32_t head;
+static uint32_t tail;
+static uint32_t n_dropped;
+static uint32_t n_dropped_total;
+static uint32_t seq_pushed;
+
+/*! Register map */
+static uint8_t regs[256];
+
+/*! Simulated time, time of the next frame, and bus timing, in microseconds */
+static double time_us;
+static double next_frame_us;
+static double us_per_byte;
+
+/*! Chunk buffers and the frame buffers of the sink */
+static uint8_t chunk[2][BMI270_MAXIMUM_FIFO_CHUNK_SIZE + 1];
+static struct bmi2_sens_axes_data acc[SINK_FRAMES];
+static struct bmi2_sens_axes_data gyr[SINK_FRAMES];
+
+/******************************************************************************/
+/*!           Static Function Declaration                                     */
+
+/*!
+ *  @brief Pushes the frames due at the simulated time.
+ */
+static void fifo_update(void);
+
+/*!
+ *  @brief Reads the register map and the FIFO, a partially read frame stays in the FIFO.
+ */
+static BMI2_INTF_RETURN_TYPE map_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ *  @brief Writes the register map.
+ */
+static BMI2_INTF_RETURN_TYPE map_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ *  @brief Advances the simulated time.
+ */
+static void map_delay_us(uint32_t period, void *intf_ptr);
+
+/*!
+ *  @brief Checks the order of the frames, and stops the drain as configured.
+ */
+static int8_t sink(const struct bmi2_sens_axes_data *acc_data,
+                   uint16_t acc_len,
+                   const struct bmi2_sens_axes_data *gyr_data,
+                   uint16_t gyr_len,
+                   void *sink_ptr);
+
+/*!
+ *  @brief Runs the three phases of the drain on one bus.
+ */
+static int check_bus(uint8_t intf);
+
+/*!
+ *  @brief Compares the single pass parser with the accel and gyro parsers on a full FIFO.
+ */
+static int check_parse(void);
+
+/*!
+ *  @brief Monotonic time of the host, in microseconds.
+ */
+static double host_us(void);
+
+/******************************************************************************/
+/*!            Functions                                                      */
+
+/*
+ * Checks the streaming drain of the maximum FIFO variant on a simulated
+ * 1600 Hz accel and gyro FIFO in header mode. Frames arrive while the bus
+ * reads, a frame cut by a chunk stays in the FIFO, and an overflow drops
+ * frames behind a skip frame. Every frame must reach the sink once and in
+ * order, and the frames missing from the sequence must match the skip
+ * frames, through overflows and stalls of the sink. The single pass parser
+ * must match the accel and gyro parsers, its cost is printed.
+ *
+ *   fifo_stream_check
+ */
+int main(void)
+{
+    int ok = 1;
+
+    ok &= check_bus(BMI2_I2C_INTF);
+    ok &= check_bus(BMI2_SPI_INTF);
+    ok &= check_parse();
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/*!
+ *  @brief Pushes the frames due at the simulated time.
+ */
+static void fifo_update(void)
+{
+    int16_t data[6];
+
+    while (next_frame_us <= time_us)
+    {
+        next_frame_us += FRAME_US;
+
+        if ((tail - head) + SKIP_LEN + FRAME_LEN > BMI270_MAXIMUM_FIFO_SIZE)
+        {
+            n_dropped++;
+            n_dropped_total++;
+            seq_pushed++;
+            continue;
+        }
+
+        if (tail >= QUEUE_COMPACT)
+        {
+            memmove(queue, &queue[head], tail - head);
+            tail -= head;
+            head = 0;
+        }
+
+        /* One skip frame per overflow, its count saturates */
+        if (n_dropped != 0)
+        {
+            queue[tail++] = HDR_SKIP;
+            queue[tail++] = (uint8_t)((n_dropped > 0xFF) ? 0xFF : n_dropped);
+            n_dropped = 0;
+        }
+
+        /* Gyro then accel, x holds the sequence number */
+        data[0] = (int16_t)seq_pushed;
+        data[1] = 1;
+        data[2] = 2;
+        data[3] = (int16_t)seq_pushed;
+        data[4] = 3;
+        data[5] = 4;
+
+        queue[tail++] = HDR_ACC_GYR;
+        memcpy(&queue[tail], data, sizeof(data));
+        tail += sizeof(data);
+        seq_pushed++;
+    }
+}
+
+/*!
+ *  @brief Reads the register map and the FIFO, a partially read frame stays in the FIFO.
+ */
+static BMI2_INTF_RETURN_TYPE map_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    const struct bmi2_dev *dev = (const struct bmi2_dev *)intf_ptr;
+    uint32_t index;
+    uint32_t frame_len;
+    uint32_t n;
+
+    time_us += (len + 2) * us_per_byte;
+    fifo_update();
+
+    reg_addr &= BMI2_SPI_WR_MASK;
+    reg_data += dev->dummy_byte;
+    len -= dev->dummy_byte;
+
+    if (reg_addr == REG_FIFO_DATA)
+    {
+        index = 0;
+        while (index < len)
+        {
+            if (head == tail)
+            {
+                reg_data[index++] = HDR_EMPTY;
+                continue;
+            }
+
+            frame_len = (queue[head] == HDR_SKIP) ? SKIP_LEN : FRAME_LEN;
+            n = ((len - index) < frame_len) ? (len - index) : frame_len;
+            memcpy(&reg_data[index], &queue[head], n);
+            index += n;
+
+            if (n == frame_len)
+            {
+                head += frame_len;
+            }
+        }
+
+        return BMI2_INTF_RET_SUCCESS;
+    }
+
+    for (index = 0; index < len; index++)
+    {
+        switch ((uint8_t)(reg_addr + index))
+        {
+            case REG_FIFO_LENGTH_0:
+                reg_data[index] = (uint8_t)(tail - head);
+                break;
+            case REG_FIFO_LENGTH_1:
+                reg_data[index] = (uint8_t)((tail - head) >> 8);
+                break;
+            default:
+                reg_data[index] = regs[(uint8_t)(reg_addr + index)];
+                break;
+        }
+    }
+
+    return BMI2_INTF_RET_SUCCESS;
+}
+
+/*!
+ *  @brief Writes the register map.
+ */
+static BMI2_INTF_RETURN_TYPE map_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    uint32_t index;
+
+    (void)intf_ptr;
+
+    time_us += (len + 2) * us_per_byte;
+
+    for (index = 0; index < len; index++)
+    {
+        regs[(uint8_t)((reg_addr & BMI2_SPI_WR_MASK) + index)] = reg_data[index];
+    }
+
+    return BMI2_INTF_RET_SUCCESS;
+}
+
+/*!
+ *  @brief Advances the simulated time.
+ */
+static void map_delay_us(uint32_t period, void *intf_ptr)
+{
+    (void)intf_ptr;
+
+    time_us += period;
+}
+
+/*!
+ *  @brief Checks the order of the frames, and stops the drain as configured.
+ */
+static int8_t sink(const struct bmi2_sens_axes_data *acc_data,
+                   uint16_t acc_len,
+                   const struct bmi2_sens_axes_data *gyr_data,
+                   uint16_t gyr_len,
+                   void *sink_ptr)
+{
+    struct sink_check *check = (struct sink_check *)sink_ptr;
+    uint16_t index;
+    uint16_t gap;
+
+    check->n_calls++;
+
+    if (acc_len != gyr_len)
+    {
+        check->n_bad++;
+    }
+
+    for (index = 0; (index < acc_len) && (index < gyr_len); index++)
+    {
+        if (((uint16_t)acc_data[index].x != (uint16_t)gyr_data[index].x) || (acc_data[index].y != 3) ||
+            (gyr_data[index].y != 1))
+        {
+            check->n_bad++;
+        }
+
+        if (check->started)
+        {
+            /* A frame delivered twice or out of order shows as a gap wrapping around */
+            gap = (uint16_t)((uint16_t)acc_data[index].x - check->next_seq);
+            if (gap > PHASE_FRAMES)
+            {
+                check->n_bad++;
+            }
+            else
+            {
+                check->n_missing += gap;
+            }
+        }
+
+        check->next_seq = (uint16_t)(acc_data[index].x + 1);
+        check->started = 1;
+        check->n_frames++;
+    }
+
+    if ((check->stall_every != 0) && ((check->n_calls % check->stall_every) == 0))
+    {
+        return 1;
+    }
+
+    return 0;
+}
+
+/*!
+ *  @brief Runs the three phases of the drain on one bus.
+ */
+static int check_bus(uint8_t intf)
+{
+    static const char *const phase_names[] = { "watermark", "overflow", "stalls" };
+    struct bmi2_dev dev = { 0 };
+    struct bmi270_fifo_stream stream = { 0 };
+    struct sink_check check = { 0 };
+    uint32_t phase;
+    uint32_t frame;
+    uint32_t pending;
+    uint32_t late = 0;
+    int8_t rslt;
+    int ok = 1;
+
+    printf("%s:\n", (intf == BMI2_SPI_INTF) ? "SPI 10 MHz" : "I2C 400 kHz");
+
+    memset(regs, 0, sizeof(regs));
+    regs[REG_FIFO_CONFIG_1] = FIFO_CONFIG_1;
+    head = 0;
+    tail = 0;
+    n_dropped = 0;
+    n_dropped_total = 0;
+    seq_pushed = 0;
+    time_us = 0;
+    next_frame_us = FRAME_US;
+    us_per_byte = (intf == BMI2_SPI_INTF) ? SPI_US_PER_BYTE : I2C_US_PER_BYTE;
+
+    dev.intf = intf;
+    dev.dummy_byte = (intf == BMI2_SPI_INTF) ? 1 : 0;
+    dev.read = map_read;
+    dev.write = map_write;
+    dev.delay_us = map_delay_us;
+    dev.intf_ptr = &dev;
+    dev.remap.x_axis = BMI2_MAP_X_AXIS;
+    dev.remap.y_axis = BMI2_MAP_Y_AXIS;
+    dev.remap.z_axis = BMI2_MAP_Z_AXIS;
+
+    stream.chunk[0] = chunk[0];
+    stream.chunk[1] = chunk[1];
+    stream.chunk_len = BMI270_MAXIMUM_FIFO_CHUNK_SIZE;
+    stream.acc = acc;
+    stream.gyr = gyr;
+    stream.acc_len = SINK_FRAMES;
+    stream.gyr_len = SINK_FRAMES;
+    stream.sink = sink;
+    stream.sink_ptr = &check;
+
+    rslt = bmi270_maximum_fifo_stream_init(&stream, &dev);
+    if ((rslt != BMI2_OK) || (stream.chunk_len % FRAME_LEN != 0))
+    {
+        printf("  init failed: %d, chunk of %u bytes\n", rslt, stream.chunk_len);
+
+        return 0;
+    }
+
+    for (phase = 0; phase < 3; phase++)
+    {
+        check.stall_every = (phase == 2) ? STALL_EVERY : 0;
+
+        for (frame = 0; frame < PHASE_FRAMES; frame++)
+        {
+            time_us += FRAME_US;
+            fifo_update();
+
+            if ((tail - head) < WATERMARK)
+            {
+                continue;
+            }
+
+            /* The overflow phase serves the watermark late */
+            if ((phase == 1) && (late < LATE_FRAMES))
+            {
+                late++;
+            }
+            else
+            {
+                late = 0;
+                rslt = bmi270_maximum_fifo_stream_drain((uint32_t)time_us, &stream, &dev);
+                if (rslt != BMI2_OK)
+                {
+                    printf("  drain failed: %d\n", rslt);
+                    ok = 0;
+                }
+            }
+        }
+
+        printf("  %-9s: %5lu drains, %4lu stalls, %4lu overflows, %5lu skipped, max fill %4u, %6lu B/s, "
+               "%6lu frames, %5lu missing, %lu bad\n",
+               phase_names[phase],
+               (unsigned long)stream.n_drains,
+               (unsigned long)stream.n_stalls,
+               (unsigned long)stream.n_overflows,
+               (unsigned long)stream.n_skipped_frames,
+               stream.max_fill,
+               (unsigned long)stream.bytes_per_sec,
+               (unsigned long)check.n_frames,
+               (unsigned long)check.n_missing,
+               (unsigned long)check.n_bad);
+    }
+
+    /* Every frame pushed is delivered, missing behind a skip frame, or after the
+     * last one delivered; a skip frame read last may not have a gap behind it yet
+     */
+    pending = (uint16_t)(seq_pushed - check.next_seq);
+    if ((check.n_bad != 0) || (check.n_missing > stream.n_skipped_frames) ||
+        (stream.n_skipped_frames > n_dropped_total) || (check.n_frames + check.n_missing + pending != seq_pushed) ||
+        (stream.n_acc_frames != check.n_frames) || (stream.n_gyr_frames != check.n_frames))
+    {
+        printf("  frames were lost, repeated or reordered\n");
+        ok = 0;
+    }
+
+    if ((stream.n_overflows == 0) || (stream.n_stalls == 0))
+    {
+        printf("  the overflow or stall phase was not reached\n");
+        ok = 0;
+    }
+
+    return ok;
+}
+
+/*!
+ *  @brief Compares the single pass parser with the accel and gyro parsers on a full FIFO.
+ */
+static int check_parse(void)
+{
+    static uint8_t data[BMI270_MAXIMUM_FIFO_SIZE];
+    static struct bmi2_sens_axes_data acc_ref[FULL_FRAMES];
+    static struct bmi2_sens_axes_data gyr_ref[FULL_FRAMES];
+    static struct bmi2_sens_axes_data acc_one[FULL_FRAMES];
+    static struct bmi2_sens_axes_data gyr_one[FULL_FRAMES];
+    struct bmi2_dev dev = { 0 };
+    struct bmi2_fifo_frame fifo = { 0 };
+    uint16_t acc_len = 0;
+    uint16_t gyr_len = 0;
+    uint16_t acc_one_len = 0;
+    uint16_t gyr_one_len = 0;
+    uint32_t run;
+    double start_us;
+    double two_pass_us;
+    double one_pass_us;
+    int ok;
+
+    dev.read = map_read;
+    dev.write = map_write;
+    dev.delay_us = map_delay_us;
+    dev.intf_ptr = &dev;
+    dev.remap.x_axis = BMI2_MAP_X_AXIS;
+    dev.remap.y_axis = BMI2_MAP_Y_AXIS;
+    dev.remap.z_axis = BMI2_MAP_Z_AXIS;
+
+    head = 0;
+    tail = 0;
+    n_dropped = 0;
+    seq_pushed = 0;
+    time_us = FULL_FRAMES * FRAME_US;
+    next_frame_us = FRAME_US;
+    fifo_update();
+    memcpy(data, queue, tail);
+
+    fifo.data = data;
+    fifo.length = (uint16_t)tail;
+    fifo.header_enable = (uint8_t)(BMI2_FIFO_HEADER_EN >> 8);
+    fifo.data_enable = BMI2_FIFO_ACC_EN | BMI2_FIFO_GYR_EN;
+
+    start_us = host_us();
+    for (run = 0; run < PARSE_RUNS; run++)
+    {
+        fifo.acc_byte_start_idx = 0;
+        fifo.gyr_byte_start_idx = 0;
+        acc_len = FULL_FRAMES;
+        gyr_len = FULL_FRAMES;
+        (void)bmi2_extract_accel(acc_ref, &acc_len, &fifo, &dev);
+        (void)bmi2_extract_gyro(gyr_ref, &gyr_len, &fifo, &dev);
+    }
+
+    two_pass_us = (host_us() - start_us) / PARSE_RUNS;
+
+    start_us = host_us();
+    for (run = 0; run < PARSE_RUNS; run++)
+    {
+        fifo.acc_byte_start_idx = 0;
+        acc_one_len = FULL_FRAMES;
+        gyr_one_len = FULL_FRAMES;
+        (void)bmi2_extract_accel_gyro(acc_one, &acc_one_len, gyr_one, &gyr_one_len, &fifo, &dev);
+    }
+
+    one_pass_us = (host_us() - start_us) / PARSE_RUNS;
+
+    ok = (acc_len == FULL_FRAMES) && (acc_ref[FULL_FRAMES - 1].x == FULL_FRAMES - 1) && (acc_one_len == acc_len) && (gyr_one_len == gyr_len) &&
+         (memcmp(acc_one, acc_ref, acc_len * sizeof(acc_ref[0])) == 0) &&
+         (memcmp(gyr_one, gyr_ref, gyr_len * sizeof(gyr_ref[0])) == 0);
+
+    printf("Parse of a full FIFO, %u frames: accel and gyro %.1f us, single pass %.1f us, %s\n",
+           acc_one_len,
+           two_pass_us,
+           one_pass_us,
+           ok ? "equal" : "DIFFERENT");
+
+    return ok;
+}
+
+/*!
+ *  @brief Monotonic time of the host, in microseconds.
+ */
+static double host_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (ts.tv_sec * 1e6) + (ts.tv_nsec / 1e3);
+}
@@ -0,0 +1,475 @@
+/**\
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bmi270_variant.h"
+
+/******************************************************************************/
+/*!                Macro definition                                           */
+
+/*! Register map */
+#define REG_CHIP_ID         UINT8_C(0x00)
+#define REG_INTERNAL_STATUS UINT8_C(0x21)
+#define REG_ACC_CONF        UINT8_C(0x40)
+#define REG_INT1_IO_CTRL    UINT8_C(0x53)
+#define REG_INT1_MAP_FEAT   UINT8_C(0x56)
+#define REG_INT2_MAP_FEAT   UINT8_C(0x57)
+#define REG_INIT_CTRL       UINT8_C(0x59)
+#define REG_INIT_ADDR_0     UINT8_C(0x5B)
+#define REG_INIT_ADDR_1     UINT8_C(0x5C)
+#define REG_INIT_DATA       UINT8_C(0x5E)
+#define REG_PWR_CONF        UINT8_C(0x7C)
+#define REG_PWR_CTRL        UINT8_C(0x7D)
+#define REG_CMD             UINT8_C(0x7E)
+
+/*! Chip id of the BMI270, soft-reset command, power configuration after a reset */
+#define CHIP_ID             UINT8_C(0x24)
+#define CMD_SOFT_RESET      UINT8_C(0xB6)
+#define PWR_CONF_RESET      UINT8_C(0x03)
+
+/*! The feature engine reports the load this long after INIT_CTRL is set */
+#define LOAD_US             (20000.0)
+
+/*! Time per byte: I2C at 400 kHz, SPI at 10 MHz, in microseconds */
+#define I2C_US_PER_BYTE     (22.5)
+#define SPI_US_PER_BYTE     (0.8)
+
+/*! Burst length of the sensor API, and of the configuration upload of a switch */
+#define READ_WRITE_LEN      UINT16_C(46)
+#define UPLOAD_LEN          UINT16_C(254)
+
+/*! Largest configuration file */
+#define IMAGE_SIZE          UINT16_C(8192)
+
+/******************************************************************************/
+/*!           Structure Definition                                            */
+
+/*! Configuration file uploaded by the init API of a variant */
+struct variant_ref
+{
+    uint8_t image[IMAGE_SIZE];
+    uint16_t size;
+    double init_us;
+};
+
+/******************************************************************************/
+/*!           Static Variable Definition                                      */
+
+/*! Sensor, FIFO and interrupt setup kept across the switches */
+static const uint8_t sens_conf[BMI270_VARIANT_SENS_CONF_LEN] = {
+    0xA8, 0x02, 0xE9, 0x00, 0x46, 0x00, 0x80, 0x02, 0x02, 0xD0
+};
+static const uint8_t int_conf[BMI270_VARIANT_INT_CONF_LEN] = { 0x0A, 0x00, 0x00, 0x44, 0x02, 0x04 };
+static const uint8_t pwr_ctrl = 0x0E;
+static const uint8_t pwr_conf = 0x02;
+
+static const char *const variant_names[BMI270_VARIANT_MAX] = { "base", "legacy", "context", "maximum FIFO" };
+
+/*! Register map and the configuration uploaded to INIT_DATA */
+static uint8_t regs[256];
+static uint8_t image[IMAGE_SIZE];
+
+/*! Simulated time and bus timing, in microseconds */
+static double time_us;
+static double us_per_byte;
+
+/*! Time INIT_CTRL was set, negative while no load runs */
+static double load_start_us;
+
+/*! Loads which never complete, before the next one does */
+static uint8_t n_failing_loads;
+
+/*! Upload of each variant by its init API */
+static struct variant_ref refs[BMI270_VARIANT_MAX];
+
+/******************************************************************************/
+/*!           Static Function Declaration                                     */
+
+/*!
+ *  @brief Reads the register map, the load completes LOAD_US after INIT_CTRL.
+ */
+static BMI2_INTF_RETURN_TYPE map_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ *  @brief Writes the register map, records the configuration upload.
+ */
+static BMI2_INTF_RETURN_TYPE map_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ *  @brief Advances the simulated time.
+ */
+static void map_delay_us(uint32_t period, void *intf_ptr);
+
+/*!
+ *  @brief Simulated microsecond timer of the variant manager.
+ */
+static uint32_t map_time_us(void);
+
+/*!
+ *  @brief Clears the register map as a power-on, and sets up the device on a bus.
+ */
+static void map_reset(uint8_t intf, struct bmi2_dev *dev);
+
+/*!
+ *  @brief Records the upload and the time of the init API of each variant.
+ */
+static int record_refs(uint8_t intf);
+
+/*!
+ *  @brief Sets up the sensor, FIFO and interrupts kept across the switches.
+ */
+static int8_t set_state(struct bmi2_dev *dev);
+
+/*!
+ *  @brief Switches to a variant and checks the restored state and the upload.
+ */
+static int check_switch(uint8_t variant, struct bmi270_variant_mgr *mgr, struct bmi2_dev *dev);
+
+/*!
+ *  @brief Runs the switches on one bus.
+ */
+static int check_bus(uint8_t intf);
+
+/******************************************************************************/
+/*!            Functions                                                      */
+
+/*
+ * Checks the BMI270 variant switch on a simulated sensor: the switch must
+ * upload the same configuration file as the init API of the variant, keep
+ * the sensor, FIFO and interrupt setup with the feature interrupts unmapped,
+ * and fall back to a soft-reset when the load fails. The latency of each
+ * switch is printed against the init API of the variant, on I2C and SPI.
+ *
+ *   variant_check
+ */
+int main(void)
+{
+    int ok = 1;
+
+    ok &= check_bus(BMI2_I2C_INTF);
+    ok &= check_bus(BMI2_SPI_INTF);
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/*!
+ *  @brief Reads the register map, the load completes LOAD_US after INIT_CTRL.
+ */
+static BMI2_INTF_RETURN_TYPE map_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    struct bmi2_dev *dev = (struct bmi2_dev *)intf_ptr;
+    uint32_t index;
+    uint8_t addr;
+
+    time_us += (len + 2) * us_per_byte;
+    reg_addr &= BMI2_SPI_WR_MASK;
+
+    for (index = 0; index < len; index++)
+    {
+        /* SPI reads start with a dummy byte */
+        if (index < dev->dummy_byte)
+        {
+            reg_data[index] = 0xFF;
+            continue;
+        }
+
+        addr = (uint8_t)(reg_addr + index - dev->dummy_byte);
+        if (addr == REG_CHIP_ID)
+        {
+            reg_data[index] = CHIP_ID;
+        }
+        else if (addr == REG_INTERNAL_STATUS)
+        {
+            reg_data[index] = ((load_start_us >= 0) && (time_us - load_start_us >= LOAD_US)) ? 0x01 : 0x00;
+        }
+        else
+        {
+            reg_data[index] = regs[addr];
+        }
+    }
+
+    return BMI2_INTF_RET_SUCCESS;
+}
+
+/*!
+ *  @brief Writes the register map, records the configuration upload.
+ */
+static BMI2_INTF_RETURN_TYPE map_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    uint32_t index;
+    uint32_t offset;
+
+    (void)intf_ptr;
+
+    time_us += (len + 2) * us_per_byte;
+
+    if (reg_addr == REG_INIT_DATA)
+    {
+        /* INIT_ADDR holds the offset in words, 4 bits then 8 bits */
+        offset = ((uint32_t)(regs[REG_INIT_ADDR_0] & 0x0F) | ((uint32_t)regs[REG_INIT_ADDR_1] << 4)) * 2;
+        if (offset + len <= IMAGE_SIZE)
+        {
+            memcpy(&image[offset], reg_data, len);
+        }
+
+        return BMI2_INTF_RET_SUCCESS;
+    }
+
+    for (index = 0; index < len; index++)
+    {
+        regs[(uint8_t)(reg_addr + index)] = reg_data[index];
+    }
+
+    if (reg_addr == REG_INIT_CTRL)
+    {
+        load_start_us = -1;
+        if ((reg_data[0] & 0x01) != 0)
+        {
+            if (n_failing_loads != 0)
+            {
+                n_failing_loads--;
+            }
+            else
+            {
+                load_start_us = time_us;
+            }
+        }
+    }
+    else if ((reg_addr == REG_CMD) && (reg_data[0] == CMD_SOFT_RESET))
+    {
+        memset(regs, 0, sizeof(regs));
+        regs[REG_PWR_CONF] = PWR_CONF_RESET;
+        load_start_us = -1;
+    }
+
+    return BMI2_INTF_RET_SUCCESS;
+}
+
+/*!
+ *  @brief Advances the simulated time.
+ */
+static void map_delay_us(uint32_t period, void *intf_ptr)
+{
+    (void)intf_ptr;
+
+    time_us += period;
+}
+
+/*!
+ *  @brief Simulated microsecond timer of the variant manager.
+ */
+static uint32_t map_time_us(void)
+{
+    return (uint32_t)time_us;
+}
+
+/*!
+ *  @brief Clears the register map as a power-on, and sets up the device on a bus.
+ */
+static void map_reset(uint8_t intf, struct bmi2_dev *dev)
+{
+    memset(regs, 0, sizeof(regs));
+    regs[REG_PWR_CONF] = PWR_CONF_RESET;
+    load_start_us = -1;
+    n_failing_loads = 0;
+    us_per_byte = (intf == BMI2_SPI_INTF) ? SPI_US_PER_BYTE : I2C_US_PER_BYTE;
+
+    memset(dev, 0, sizeof(*dev));
+    dev->intf = intf;
+    dev->dummy_byte = (intf == BMI2_SPI_INTF) ? 1 : 0;
+    dev->read = map_read;
+    dev->write = map_write;
+    dev->delay_us = map_delay_us;
+    dev->intf_ptr = dev;
+    dev->read_write_len = READ_WRITE_LEN;
+}
+
+/*!
+ *  @brief Records the upload and the time of the init API of each variant.
+ */
+static int record_refs(uint8_t intf)
+{
+    struct bmi2_dev dev;
+    struct bmi270_variant_mgr mgr = { 0 };
+    uint8_t variant;
+    double start_us;
+    int8_t rslt;
+
+    for (variant = 0; variant < BMI270_VARIANT_MAX; variant++)
+    {
+        map_reset(intf, &dev);
+        memset(image, 0, sizeof(image));
+
+        start_us = time_us;
+        rslt = bmi270_variant_init(variant, &mgr, &dev);
+        if ((rslt != BMI2_OK) || (dev.config_size > IMAGE_SIZE))
+        {
+            printf("  init of the %s variant failed: %d\n", variant_names[variant], rslt);
+
+            return 0;
+        }
+
+        refs[variant].init_us = time_us - start_us;
+        refs[variant].size = dev.config_size;
+        memcpy(refs[variant].image, image, sizeof(image));
+    }
+
+    return 1;
+}
+
+/*!
+ *  @brief Sets up the sensor, FIFO and interrupts kept across the switches.
+ */
+static int8_t set_state(struct bmi2_dev *dev)
+{
+    int8_t rslt;
+
+    rslt = bmi2_set_adv_power_save(BMI2_DISABLE, dev);
+    if (rslt == BMI2_OK)
+    {
+        rslt = bmi2_set_regs(REG_ACC_CONF, (uint8_t *)sens_conf, sizeof(sens_conf), dev);
+    }
+
+    if (rslt == BMI2_OK)
+    {
+        rslt = bmi2_set_regs(REG_INT1_IO_CTRL, (uint8_t *)int_conf, sizeof(int_conf), dev);
+    }
+
+    if (rslt == BMI2_OK)
+    {
+        rslt = bmi2_set_regs(REG_PWR_CTRL, (uint8_t *)&pwr_ctrl, 1, dev);
+    }
+
+    if (rslt == BMI2_OK)
+    {
+        rslt = bmi2_set_regs(REG_PWR_CONF, (uint8_t *)&pwr_conf, 1, dev);
+    }
+
+    /* The feature interrupt is lost in a switch, the main sensors are kept */
+    dev->sens_en_stat = BMI2_ACCEL_SENS_SEL | BMI2_GYRO_SENS_SEL | BMI2_ANY_MOT_SEL;
+
+    return rslt;
+}
+
+/*!
+ *  @brief Switches to a variant and checks the restored state and the upload.
+ */
+static int check_switch(uint8_t variant, struct bmi270_variant_mgr *mgr, struct bmi2_dev *dev)
+{
+    const struct variant_ref *ref = &refs[variant];
+    int8_t rslt;
+    int ok = 1;
+
+    memset(image, 0, sizeof(image));
+    rslt = bmi270_variant_switch(variant, mgr, dev);
+
+    printf("  to %-12s: rslt %d, %7.1f ms (save %.1f, load %.1f, restore %.1f), init %7.1f ms, %lu resets\n",
+           variant_names[variant],
+           rslt,
+           mgr->switch_us / 1000.0,
+           mgr->save_us / 1000.0,
+           mgr->load_us / 1000.0,
+           mgr->restore_us / 1000.0,
+           ref->init_us / 1000.0,
+           (unsigned long)mgr->n_resets);
+
+    if ((rslt != BMI2_OK) || (mgr->variant != variant))
+    {
+        printf("    the switch failed\n");
+
+        return 0;
+    }
+
+    if ((dev->config_size != ref->size) || (memcmp(image, ref->image, ref->size) != 0))
+    {
+        printf("    the upload differs from the init API of the variant\n");
+        ok = 0;
+    }
+
+    if ((memcmp(&regs[REG_ACC_CONF], sens_conf, sizeof(sens_conf)) != 0) ||
+        (memcmp(&regs[REG_INT1_IO_CTRL], int_conf, REG_INT1_MAP_FEAT - REG_INT1_IO_CTRL) != 0) ||
+        (regs[REG_INT1_MAP_FEAT] != 0) || (regs[REG_INT2_MAP_FEAT] != 0) ||
+        (regs[REG_INT1_MAP_FEAT + 2] != int_conf[BMI270_VARIANT_INT_CONF_LEN - 1]) ||
+        (regs[REG_PWR_CTRL] != pwr_ctrl) || (regs[REG_PWR_CONF] != pwr_conf))
+    {
+        printf("    the sensor, FIFO or interrupt setup was not restored\n");
+        ok = 0;
+    }
+
+    if ((dev->aps_status != BMI2_DISABLE) || (dev->sens_en_stat != (BMI2_ACCEL_SENS_SEL | BMI2_GYRO_SENS_SEL)))
+    {
+        printf("    the device structure was not restored\n");
+        ok = 0;
+    }
+
+    return ok;
+}
+
+/*!
+ *  @brief Runs the switches on one bus.
+ */
+static int check_bus(uint8_t intf)
+{
+    static const uint8_t sequence[] = {
+        BMI270_VARIANT_MAXIMUM_FIFO, BMI270_VARIANT_LEGACY, BMI270_VARIANT_BASE, BMI270_VARIANT_CONTEXT,
+        BMI270_VARIANT_LEGACY
+    };
+    struct bmi2_dev dev;
+    struct bmi270_variant_mgr mgr = { 0 };
+    uint8_t loop;
+    int ok;
+
+    printf("%s:\n", (intf == BMI2_SPI_INTF) ? "SPI 10 MHz" : "I2C 400 kHz");
+
+    ok = record_refs(intf);
+    if (!ok)
+    {
+        return 0;
+    }
+
+    map_reset(intf, &dev);
+    mgr.get_time_us = map_time_us;
+    mgr.upload_len = UPLOAD_LEN;
+
+    if ((bmi270_variant_init(BMI270_VARIANT_BASE, &mgr, &dev) != BMI2_OK) || (set_state(&dev) != BMI2_OK))
+    {
+        printf("  setup failed\n");
+
+        return 0;
+    }
+
+    for (loop = 0; loop < sizeof(sequence); loop++)
+    {
+        ok &= check_switch(sequence[loop], &mgr, &dev);
+    }
+
+    if (mgr.n_resets != 0)
+    {
+        printf("    a switch fell back to a soft-reset\n");
+        ok = 0;
+    }
+
+    /* The next load never completes: the switch soft-resets and loads again */
+    n_failing_loads = 1;
+    ok &= check_switch(BMI270_VARIANT_MAXIMUM_FIFO, &mgr, &dev);
+
+    if (mgr.n_resets != 1)
+    {
+        printf("    the failed load did not fall back to a soft-reset\n");
+        ok = 0;
+    }
+
+    /* Burst length of the user is kept */
+    if (dev.read_write_len != READ_WRITE_LEN)
+    {
+        printf("    the burst length was not restored\n");
+        ok = 0;
+    }
+
+    return ok;
+}
@@ -0,0 +1,354 @@
+/**\
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bmi270.h"
+#include "bmi270_legacy.h"
+#include "bmi270_context.h"
+
+/******************************************************************************/
+/*!                Macro definition                                           */
+
+/*! Feature pages served by the register map, 16 bytes each */
+#define N_PAGES             UINT8_C(8)
+#define PAGE_LEN            UINT8_C(16)
+
+/*! Register map: feature page select, feature window, chip id, internal status */
+#define REG_CHIP_ID         UINT8_C(0x00)
+#define REG_INTERNAL_STATUS UINT8_C(0x21)
+#define REG_FEAT_PAGE       UINT8_C(0x2F)
+#define REG_FEATURES        UINT8_C(0x30)
+#define REG_INIT_DATA       UINT8_C(0x5E)
+
+/*! Runs per variant, each from its own seed */
+#define N_SEEDS             UINT8_C(3)
+
+/*! Most feature types set at once */
+#define MAX_TYPES           UINT8_C(11)
+
+/*! Bytes of a configuration compared */
+#define CFG_LEN             sizeof(union bmi2_sens_config_types)
+
+/******************************************************************************/
+/*!           Structure Definition                                            */
+
+/*! A variant of the sensor API, with the feature types it configures */
+struct variant
+{
+    const char *name;
+    int8_t (*init)(struct bmi2_dev *dev);
+    int8_t (*set_config)(struct bmi2_sens_config *sens_cfg, uint8_t n_sens, struct bmi2_dev *dev);
+    int8_t (*get_config)(struct bmi2_sens_config *sens_cfg, uint8_t n_sens, struct bmi2_dev *dev);
+    uint8_t n_types;
+    uint8_t types[MAX_TYPES];
+};
+
+/*! Outcome of a run: the feature pages after setting, the configurations read back */
+struct run_result
+{
+    int8_t set_rslt;
+    int8_t get_rslt;
+    uint8_t pages[N_PAGES][PAGE_LEN];
+    uint8_t cfg[MAX_TYPES][CFG_LEN];
+};
+
+/******************************************************************************/
+/*!           Static Variable Definition                                      */
+
+static const struct variant variants[] = {
+    { "bmi270", bmi270_init, bmi270_set_sensor_config, bmi270_get_sensor_config, 7,
+      { BMI2_ANY_MOTION, BMI2_NO_MOTION, BMI2_SIG_MOTION, BMI2_STEP_COUNTER, BMI2_WRIST_GESTURE,
+        BMI2_WRIST_WEAR_WAKE_UP, BMI2_STEP_ACTIVITY } },
+    { "bmi270_legacy", bmi270_legacy_init, bmi270_legacy_set_sensor_config, bmi270_legacy_get_sensor_config, 11,
+      { BMI2_ANY_MOTION, BMI2_ORIENTATION, BMI2_NO_MOTION, BMI2_SIG_MOTION, BMI2_STEP_COUNTER, BMI2_HIGH_G,
+        BMI2_LOW_G, BMI2_FLAT, BMI2_STEP_DETECTOR, BMI2_TAP, BMI2_ACCEL } },
+    { "bmi270_context", bmi270_context_init, bmi270_context_set_sensor_config, bmi270_context_get_sensor_config, 3,
+      { BMI2_STEP_COUNTER, BMI2_STEP_COUNTER_PARAMS, BMI2_STEP_DETECTOR } }
+};
+
+#define N_VARIANTS          (sizeof(variants) / sizeof(variants[0]))
+
+#ifndef FEATURE_CHECK_RECORD
+
+/*! Results of the hand-written encoders */
+#include "feature_check_ref.h"
+#endif
+
+/*! Register map */
+static uint8_t regs[256];
+static uint8_t pages[N_PAGES][PAGE_LEN];
+
+/*! Pseudo random generator state */
+static uint32_t prng;
+
+/******************************************************************************/
+/*!           Static Function Declaration                                     */
+
+/*!
+ *  @brief Reads the register map, the feature window through the selected page.
+ */
+static BMI2_INTF_RETURN_TYPE map_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ *  @brief Writes the register map, configuration file uploads are dropped.
+ */
+static BMI2_INTF_RETURN_TYPE map_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ *  @brief No delay is needed by the register map.
+ */
+static void map_delay_us(uint32_t period, void *intf_ptr);
+
+/*!
+ *  @brief Next pseudo random byte, the same on every host.
+ */
+static uint8_t next_byte(void);
+
+/*!
+ *  @brief Fills random feature pages and configurations, sets and reads them back.
+ */
+static void run(const struct variant *var, uint32_t seed, struct run_result *result);
+
+#ifdef FEATURE_CHECK_RECORD
+
+/*!
+ *  @brief Prints a two dimensional byte array as a fully braced C initializer.
+ */
+static void print_rows(const uint8_t *data, size_t n_rows, size_t row_len);
+#endif
+
+/******************************************************************************/
+/*!            Functions                                                      */
+
+/*
+ * Checks the feature configuration encoders on a simulated register map. The
+ * pages start from pseudo random contents, random configurations of every
+ * feature type of a variant are set, then read back. The feature pages after
+ * setting and the configurations read back are compared with those recorded
+ * from the hand-written set_*_config/get_*_config code, built with
+ * -DFEATURE_CHECK_RECORD against its sources (make ref REF_DIR=...).
+ */
+int main(void)
+{
+    static struct run_result result;
+    uint32_t n_fail = 0;
+    uint8_t var;
+    uint8_t seed;
+
+#ifdef FEATURE_CHECK_RECORD
+    printf("/* Recorded by feature_check -DFEATURE_CHECK_RECORD, do not edit */\n\n");
+    printf("#define REF_N_VARIANTS  %u\n", (unsigned)N_VARIANTS);
+    printf("#define REF_N_SEEDS     %u\n\n", N_SEEDS);
+    printf("static const struct run_result ref_results[REF_N_VARIANTS][REF_N_SEEDS] = {\n");
+#endif
+
+    for (var = 0; var < N_VARIANTS; var++)
+    {
+        for (seed = 0; seed < N_SEEDS; seed++)
+        {
+            run(&variants[var], (uint32_t)(var * N_SEEDS + seed + 1), &result);
+
+#ifdef FEATURE_CHECK_RECORD
+            printf("    [%u][%u] = { %d, %d,\n      {", var, seed, result.set_rslt, result.get_rslt);
+            print_rows(&result.pages[0][0], N_PAGES, PAGE_LEN);
+            printf(" },\n      {");
+            print_rows(&result.cfg[0][0], MAX_TYPES, CFG_LEN);
+            printf(" } },\n");
+#else
+            if ((result.set_rslt != ref_results[var][seed].set_rslt) ||
+                (result.get_rslt != ref_results[var][seed].get_rslt) ||
+                (memcmp(result.pages, ref_results[var][seed].pages, sizeof(result.pages)) != 0) ||
+                (memcmp(result.cfg, ref_results[var][seed].cfg, sizeof(result.cfg)) != 0))
+            {
+                printf("%s seed %u: differs from the recorded results\n", variants[var].name, seed);
+                n_fail++;
+            }
+            else
+            {
+                printf("%s seed %u: %u feature types, pages and read back configurations match\n",
+                       variants[var].name,
+                       seed,
+                       variants[var].n_types);
+            }
+#endif
+        }
+    }
+
+#ifdef FEATURE_CHECK_RECORD
+    printf("};\n");
+#endif
+
+    return (n_fail == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/*!
+ *  @brief Fills random feature pages and configurations, sets and reads them back.
+ */
+static void run(const struct variant *var, uint32_t seed, struct run_result *result)
+{
+    struct bmi2_dev dev;
+    struct bmi2_sens_config cfg[MAX_TYPES];
+    uint8_t *cfg_bytes;
+    uint8_t page;
+    uint8_t idx;
+    size_t byte;
+
+    memset(result, 0, sizeof(*result));
+    memset(regs, 0, sizeof(regs));
+    memset(&dev, 0, sizeof(dev));
+    dev.intf = BMI2_I2C_INTF;
+    dev.read = map_read;
+    dev.write = map_write;
+    dev.delay_us = map_delay_us;
+    dev.read_write_len = 32;
+    dev.config_file_ptr = NULL;
+    (void)var->init(&dev);
+
+    prng = seed;
+    for (page = 0; page < N_PAGES; page++)
+    {
+        for (idx = 0; idx < PAGE_LEN; idx++)
+        {
+            pages[page][idx] = next_byte();
+        }
+    }
+
+    memset(cfg, 0, sizeof(cfg));
+    for (idx = 0; idx < var->n_types; idx++)
+    {
+        cfg[idx].type = var->types[idx];
+        cfg_bytes = (uint8_t *)&cfg[idx].cfg;
+        for (byte = 0; byte < CFG_LEN; byte++)
+        {
+            cfg_bytes[byte] = next_byte();
+        }
+    }
+
+    result->set_rslt = var->set_config(cfg, var->n_types, &dev);
+    memcpy(result->pages, pages, sizeof(pages));
+
+    memset(cfg, 0, sizeof(cfg));
+    for (idx = 0; idx < var->n_types; idx++)
+    {
+        cfg[idx].type = var->types[idx];
+    }
+
+    result->get_rslt = var->get_config(cfg, var->n_types, &dev);
+    for (idx = 0; idx < var->n_types; idx++)
+    {
+        memcpy(result->cfg[idx], &cfg[idx].cfg, CFG_LEN);
+    }
+}
+
+/*!
+ *  @brief Reads the register map, the feature window through the selected page.
+ */
+static BMI2_INTF_RETURN_TYPE map_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    uint32_t idx;
+    uint8_t addr;
+
+    (void)intf_ptr;
+
+    for (idx = 0; idx < len; idx++)
+    {
+        addr = (uint8_t)(reg_addr + idx);
+        if ((addr >= REG_FEATURES) && (addr < (REG_FEATURES + PAGE_LEN)))
+        {
+            reg_data[idx] = pages[regs[REG_FEAT_PAGE] % N_PAGES][addr - REG_FEATURES];
+        }
+        else if (addr == REG_CHIP_ID)
+        {
+            reg_data[idx] = BMI270_CHIP_ID;
+        }
+        else if (addr == REG_INTERNAL_STATUS)
+        {
+            /* Initialization done */
+            reg_data[idx] = 0x01;
+        }
+        else
+        {
+            reg_data[idx] = regs[addr];
+        }
+    }
+
+    return BMI2_INTF_RET_SUCCESS;
+}
+
+/*!
+ *  @brief Writes the register map, configuration file uploads are dropped.
+ */
+static BMI2_INTF_RETURN_TYPE map_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    uint32_t idx;
+    uint8_t addr;
+
+    (void)intf_ptr;
+
+    if (reg_addr == REG_INIT_DATA)
+    {
+        return BMI2_INTF_RET_SUCCESS;
+    }
+
+    for (idx = 0; idx < len; idx++)
+    {
+        addr = (uint8_t)(reg_addr + idx);
+        if ((addr >= REG_FEATURES) && (addr < (REG_FEATURES + PAGE_LEN)))
+        {
+            pages[regs[REG_FEAT_PAGE] % N_PAGES][addr - REG_FEATURES] = reg_data[idx];
+        }
+        else
+        {
+            regs[addr] = reg_data[idx];
+        }
+    }
+
+    return BMI2_INTF_RET_SUCCESS;
+}
+
+/*!
+ *  @brief No delay is needed by the register map.
+ */
+static void map_delay_us(uint32_t period, void *intf_ptr)
+{
+    (void)period;
+    (void)intf_ptr;
+}
+
+/*!
+ *  @brief Next pseudo random byte, the same on every host.
+ */
+static uint8_t next_byte(void)
+{
+    prng = (prng * UINT32_C(1103515245)) + UINT32_C(12345);
+
+    return (uint8_t)(prng >> 16);
+}
+
+#ifdef FEATURE_CHECK_RECORD
+
+/*!
+ *  @brief Prints a two dimensional byte array as a fully braced C initializer.
+ */
+static void print_rows(const uint8_t *data, size_t n_rows, size_t row_len)
+{
+    size_t row;
+    size_t idx;
+
+    for (row = 0; row < n_rows; row++)
+    {
+        printf("\n        {");
+        for (idx = 0; idx < row_len; idx++)
+        {
+            printf("%s0x%02x,", ((idx != 0) && ((idx % 16) == 0)) ? "\n          " : " ", data[(row * row_len) + idx]);
+        }
+
+        printf(" },");
+    }
+}
+#endif
@@ -0,0 +1,581 @@
+/**\
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bmi270.h"
+#include "bmi2_fixture.h"
+
+/******************************************************************************/
+/*!                Macro definition                                           */
+
+/*! Register map */
+#define REG_CHIP_ID             UINT8_C(0x00)
+#define REG_ACC_DATA            UINT8_C(0x0C)
+#define REG_INTERNAL_STATUS     UINT8_C(0x21)
+#define REG_FEAT_PAGE           UINT8_C(0x2F)
+#define REG_FEATURES            UINT8_C(0x30)
+#define REG_INIT_DATA           UINT8_C(0x5E)
+#define REG_GYR_CRT_CONF        UINT8_C(0x69)
+#define REG_ACC_SELF_TEST       UINT8_C(0x6D)
+#define REG_GYR_SELF_TEST_AXES  UINT8_C(0x6E)
+#define REG_CMD                 UINT8_C(0x7E)
+
+/*! Register bits: CRT running and ready for download, self-test enable and sign */
+#define CRT_RUNNING             UINT8_C(0x04)
+#define RDY_FOR_DL              UINT8_C(0x08)
+#define ACC_SELF_TEST_EN        UINT8_C(0x01)
+#define ACC_SELF_TEST_SIGN      UINT8_C(0x04)
+#define GYR_AXES_OK             UINT8_C(0x0F)
+
+/*! Gyro trigger command */
+#define CMD_G_TRIGGER           UINT8_C(0x02)
+
+/*! Feature page and byte of the gyro trigger flags, and the flag requiring a CRT download */
+#define GT_PAGE                 UINT8_C(1)
+#define GT_BYTE                 UINT8_C(2)
+#define GT_DL_REQUIRED          UINT8_C(0x10)
+
+/*! Chip id of the BMI270 */
+#define CHIP_ID                 UINT8_C(0x24)
+
+/*! Timing of the simulated sensor, in microseconds */
+#define CRT_US                  (300000.0)
+#define CRT_AFTER_DL_US         (200000.0)
+#define DL_TOGGLE_US            (1500.0)
+
+/*! CRT download length after which the CRT starts */
+#define DL_LEN                  UINT32_C(2048)
+
+/*! I2C time per byte at 400 kHz, in microseconds */
+#define BUS_US_PER_BYTE         (22.5)
+
+/*! Accel self-test response in LSB at +/-16g: x, y with the opposite sign, z */
+#define ST_X                    INT16_C(17500)
+#define ST_Y                    INT16_C(17500)
+#define ST_Z                    INT16_C(12000)
+#define ST_WEAK                 INT16_C(1000)
+#define ACC_REST                INT16_C(100)
+
+/*! Fixture: six sensors on three buses, the odd ones need a CRT download */
+#define N_SENSORS               UINT8_C(6)
+#define N_BUSES                 UINT8_C(3)
+
+/*! Sensor which never gets ready for its CRT download */
+#define STUCK_SENSOR            UINT8_C(5)
+
+/******************************************************************************/
+/*!           Structure Definition                                            */
+
+/*! Simulated sensor */
+struct sim_sensor
+{
+    uint8_t regs[256];
+    uint8_t pages[8][16];
+
+    /*! The CRT runs, needs a download, the sensor never gets ready for it, the self-test response is weak */
+    uint8_t crt_running;
+    uint8_t dl_required;
+    uint8_t dl_stuck;
+    uint8_t weak;
+
+    /*! Time the CRT ends and rdy_for_dl toggles, 0 for none */
+    double crt_end_us;
+    double dl_toggle_us;
+
+    /*! CRT bytes downloaded and bus transfers */
+    uint32_t dl_bytes;
+    uint32_t n_transfers;
+};
+
+/******************************************************************************/
+/*!           Static Variable Definition                                      */
+
+static const char *const test_names[BMI2_FIXTURE_N_TESTS] = { "accel", "gyro", "CRT" };
+
+/*! Sensors on one clock, and the device of each */
+static struct sim_sensor sensors[N_SENSORS];
+static struct bmi2_dev devs[N_SENSORS];
+static double time_us;
+
+/*! Fixture */
+static struct bmi2_fixture fixture;
+
+/******************************************************************************/
+/*!           Static Function Declaration                                     */
+
+/*!
+ *  @brief Runs the timed events of the sensor due at the simulated time.
+ */
+static void sim_update(struct sim_sensor *sim);
+
+/*!
+ *  @brief Reads the register map: accel data with the self-test excitation, feature pages.
+ */
+static BMI2_INTF_RETURN_TYPE sim_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ *  @brief Writes the register map: gyro trigger and CRT download.
+ */
+static BMI2_INTF_RETURN_TYPE sim_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ *  @brief Advances the simulated time.
+ */
+static void sim_delay_us(uint32_t period, void *intf_ptr);
+
+/*!
+ *  @brief Simulated microsecond timer of the fixture.
+ */
+static uint32_t sim_time_us(void);
+
+/*!
+ *  @brief Initializes the sensors.
+ */
+static int sim_setup(void);
+
+/*!
+ *  @brief Runs the tests of each sensor with the blocking APIs, one sensor after another.
+ */
+static int run_serial(double *serial_us);
+
+/*!
+ *  @brief Checks if the next step of a sensor of the fixture is due.
+ */
+static int step_due(uint32_t now_us, const struct bmi2_fixture_dut *dut);
+
+/*!
+ *  @brief Runs the fixture and checks the order of the steps on each bus.
+ */
+static int run_fixture(void);
+
+/*!
+ *  @brief Prints the results and checks them.
+ */
+static int check_results(double serial_us);
+
+/******************************************************************************/
+/*!            Functions                                                      */
+
+/*
+ * Checks the BMI2 production fixture on six simulated sensors on three
+ * buses. Each sensor runs the accel self-test, gyro self-test and CRT. The
+ * odd sensors need a CRT download, and the last never gets ready for it.
+ * A poll may run at most one step per bus. The due sensors of a bus are
+ * served round robin. The stuck download must fail only the gyro tests of
+ * its own sensor. The fixture must finish sooner than the blocking APIs
+ * run one sensor after another.
+ *
+ *   fixture_check
+ */
+int main(void)
+{
+    double serial_us = 0;
+    int ok;
+
+    ok = run_serial(&serial_us);
+    ok &= run_fixture();
+    ok &= check_results(serial_us);
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/*!
+ *  @brief Runs the timed events of the sensor due at the simulated time.
+ */
+static void sim_update(struct sim_sensor *sim)
+{
+    if ((sim->crt_end_us > 0) && (time_us >= sim->crt_end_us))
+    {
+        sim->regs[REG_GYR_CRT_CONF] &= (uint8_t)~CRT_RUNNING;
+        sim->regs[REG_GYR_SELF_TEST_AXES] = GYR_AXES_OK;
+        sim->crt_running = 0;
+        sim->crt_end_us = 0;
+    }
+
+    if ((sim->dl_toggle_us > 0) && (time_us >= sim->dl_toggle_us))
+    {
+        sim->regs[REG_GYR_CRT_CONF] ^= RDY_FOR_DL;
+        sim->dl_toggle_us = 0;
+    }
+}
+
+/*!
+ *  @brief Reads the register map: accel data with the self-test excitation, feature pages.
+ */
+static BMI2_INTF_RETURN_TYPE sim_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    struct sim_sensor *sim = (struct sim_sensor *)intf_ptr;
+    uint8_t st = sim->regs[REG_ACC_SELF_TEST];
+    int16_t acc[3] = { ACC_REST, ACC_REST, ACC_REST };
+    uint32_t index;
+    uint8_t addr;
+
+    sim->n_transfers++;
+    time_us += (len + 2) * BUS_US_PER_BYTE;
+    sim_update(sim);
+
+    if ((st & ACC_SELF_TEST_EN) != 0)
+    {
+        acc[0] = sim->weak ? ST_WEAK : ST_X;
+        acc[1] = (int16_t)-(sim->weak ? ST_WEAK : ST_Y);
+        acc[2] = sim->weak ? ST_WEAK : ST_Z;
+
+        if ((st & ACC_SELF_TEST_SIGN) == 0)
+        {
+            acc[0] = (int16_t)-acc[0];
+            acc[1] = (int16_t)-acc[1];
+            acc[2] = (int16_t)-acc[2];
+        }
+    }
+
+    for (index = 0; index < len; index++)
+    {
+        addr = (uint8_t)(reg_addr + index);
+        if ((addr >= REG_FEATURES) && (addr < REG_FEATURES + 16))
+        {
+            reg_data[index] = sim->pages[sim->regs[REG_FEAT_PAGE] & 0x07][addr - REG_FEATURES];
+        }
+        else if ((addr >= REG_ACC_DATA) && (addr < REG_ACC_DATA + 6))
+        {
+            reg_data[index] = (uint8_t)((uint16_t)acc[(addr - REG_ACC_DATA) / 2] >> (8 * (addr & 0x01)));
+        }
+        else if (addr == REG_INTERNAL_STATUS)
+        {
+            reg_data[index] = 0x01;
+        }
+        else if (addr == REG_CHIP_ID)
+        {
+            reg_data[index] = CHIP_ID;
+        }
+        else
+        {
+            reg_data[index] = sim->regs[addr];
+        }
+    }
+
+    return BMI2_INTF_RET_SUCCESS;
+}
+
+/*!
+ *  @brief Writes the register map: gyro trigger and CRT download.
+ */
+static BMI2_INTF_RETURN_TYPE sim_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    struct sim_sensor *sim = (struct sim_sensor *)intf_ptr;
+    uint32_t index;
+    uint8_t addr;
+
+    sim->n_transfers++;
+    time_us += (len + 2) * BUS_US_PER_BYTE;
+    sim_update(sim);
+
+    if (reg_addr == REG_INIT_DATA)
+    {
+        sim->dl_bytes += len;
+
+        return BMI2_INTF_RET_SUCCESS;
+    }
+
+    for (index = 0; index < len; index++)
+    {
+        addr = (uint8_t)(reg_addr + index);
+        if ((addr >= REG_FEATURES) && (addr < REG_FEATURES + 16))
+        {
+            sim->pages[sim->regs[REG_FEAT_PAGE] & 0x07][addr - REG_FEATURES] = reg_data[index];
+        }
+        else
+        {
+            sim->regs[addr] = reg_data[index];
+        }
+    }
+
+    if ((reg_addr == REG_CMD) && (reg_data[0] == CMD_G_TRIGGER))
+    {
+        /* A CRT needing a download runs once the download is complete */
+        if (!sim->crt_running)
+        {
+            sim->crt_running = 1;
+            sim->regs[REG_GYR_CRT_CONF] |= CRT_RUNNING;
+            sim->crt_end_us = sim->dl_required ? 0 : (time_us + CRT_US);
+        }
+
+        if (sim->dl_required)
+        {
+            if (!sim->dl_stuck)
+            {
+                sim->dl_toggle_us = time_us + DL_TOGGLE_US;
+            }
+
+            if ((sim->dl_bytes >= DL_LEN) && (sim->crt_end_us == 0))
+            {
+                sim->crt_end_us = time_us + CRT_AFTER_DL_US;
+            }
+        }
+    }
+
+    return BMI2_INTF_RET_SUCCESS;
+}
+
+/*!
+ *  @brief Advances the simulated time.
+ */
+static void sim_delay_us(uint32_t period, void *intf_ptr)
+{
+    time_us += period;
+    sim_update((struct sim_sensor *)intf_ptr);
+}
+
+/*!
+ *  @brief Simulated microsecond timer of the fixture.
+ */
+static uint32_t sim_time_us(void)
+{
+    return (uint32_t)time_us;
+}
+
+/*!
+ *  @brief Initializes the sensors.
+ */
+static int sim_setup(void)
+{
+    uint8_t loop;
+
+    for (loop = 0; loop < N_SENSORS; loop++)
+    {
+        memset(&sensors[loop], 0, sizeof(sensors[loop]));
+
+        memset(&devs[loop], 0, sizeof(devs[loop]));
+        devs[loop].intf = BMI2_I2C_INTF;
+        devs[loop].read = sim_read;
+        devs[loop].write = sim_write;
+        devs[loop].delay_us = sim_delay_us;
+        devs[loop].intf_ptr = &sensors[loop];
+        devs[loop].read_write_len = 46;
+
+        if (bmi270_init(&devs[loop]) != BMI2_OK)
+        {
+            printf("Init of sensor %u failed\n", loop);
+
+            return 0;
+        }
+
+        /* The configuration upload of the init is not a CRT download */
+        sensors[loop].dl_bytes = 0;
+        sensors[loop].n_transfers = 0;
+        sensors[loop].dl_required = loop % 2;
+        sensors[loop].dl_stuck = (loop == STUCK_SENSOR);
+        if (sensors[loop].dl_required)
+        {
+            sensors[loop].pages[GT_PAGE][GT_BYTE] = GT_DL_REQUIRED;
+        }
+    }
+
+    return 1;
+}
+
+/*!
+ *  @brief Runs the tests of each sensor with the blocking APIs, one sensor after another.
+ */
+static int run_serial(double *serial_us)
+{
+    uint8_t loop;
+    double start_us;
+
+    if (!sim_setup())
+    {
+        return 0;
+    }
+
+    start_us = time_us;
+    for (loop = 0; loop < N_SENSORS; loop++)
+    {
+        (void)bmi2_perform_accel_self_test(&devs[loop]);
+        (void)bmi2_do_gyro_st(&devs[loop]);
+        (void)bmi2_do_crt(&devs[loop]);
+    }
+
+    *serial_us = time_us - start_us;
+
+    return 1;
+}
+
+/*!
+ *  @brief Checks if the next step of a sensor of the fixture is due.
+ */
+static int step_due(uint32_t now_us, const struct bmi2_fixture_dut *dut)
+{
+    if (dut->test_idx >= BMI2_FIXTURE_N_TESTS)
+    {
+        return 0;
+    }
+
+    return (dut->result[dut->test_idx].n_steps == 0) || ((int32_t)(now_us - dut->sm.next_us) >= 0);
+}
+
+/*!
+ *  @brief Runs the fixture and checks the order of the steps on each bus.
+ */
+static int run_fixture(void)
+{
+    uint32_t transfers[N_SENSORS];
+    uint32_t waits[N_SENSORS] = { 0 };
+    uint32_t max_wait = 0;
+    uint32_t n_polls = 0;
+    uint32_t n_bad_polls = 0;
+    uint32_t now_us;
+    uint32_t next_us = 0;
+    uint8_t due[N_SENSORS];
+    uint8_t served[N_BUSES];
+    uint8_t loop;
+    int8_t rslt;
+    int ok = 1;
+
+    if (!sim_setup() || (bmi2_fixture_init(sim_time_us, &fixture) != BMI2_OK))
+    {
+        return 0;
+    }
+
+    for (loop = 0; loop < N_SENSORS; loop++)
+    {
+        if (bmi2_fixture_add(loop % N_BUSES, BMI2_FIXTURE_ALL_TESTS, &devs[loop], &fixture) != BMI2_OK)
+        {
+            printf("Sensor %u was not added\n", loop);
+
+            return 0;
+        }
+    }
+
+    do
+    {
+        now_us = (uint32_t)time_us;
+        for (loop = 0; loop < N_SENSORS; loop++)
+        {
+            due[loop] = (uint8_t)step_due(now_us, &fixture.dut[loop]);
+            transfers[loop] = sensors[loop].n_transfers;
+        }
+
+        rslt = bmi2_fixture_poll(now_us, &next_us, &fixture);
+        n_polls++;
+
+        /* At most one sensor of a bus ran; a due sensor which did not run waits */
+        memset(served, 0, sizeof(served));
+        for (loop = 0; loop < N_SENSORS; loop++)
+        {
+            if (sensors[loop].n_transfers != transfers[loop])
+            {
+                served[loop % N_BUSES]++;
+                waits[loop] = 0;
+            }
+            else if (due[loop])
+            {
+                waits[loop]++;
+                if (waits[loop] > max_wait)
+                {
+                    max_wait = waits[loop];
+                }
+            }
+        }
+
+        for (loop = 0; loop < N_BUSES; loop++)
+        {
+            if (served[loop] > 1)
+            {
+                n_bad_polls++;
+            }
+        }
+
+        /* Sleep until the next step is due */
+        if ((rslt == BMI2_W_STEP_PENDING) && ((int32_t)(next_us - (uint32_t)time_us) > 0))
+        {
+            time_us = next_us;
+        }
+    } while (rslt == BMI2_W_STEP_PENDING);
+
+    printf("Fixture: %lu polls, a due sensor waited at most %lu polls\n", (unsigned long)n_polls,
+           (unsigned long)max_wait);
+
+    if (rslt != BMI2_OK)
+    {
+        printf("  poll failed: %d\n", rslt);
+        ok = 0;
+    }
+
+    if (n_bad_polls != 0)
+    {
+        printf("  %lu polls ran more than one step on a bus\n", (unsigned long)n_bad_polls);
+        ok = 0;
+    }
+
+    /* Round robin: with two sensors per bus, a due sensor waits one poll at most */
+    if (max_wait > (N_SENSORS / N_BUSES) - 1)
+    {
+        printf("  a sensor was passed over while due\n");
+        ok = 0;
+    }
+
+    return ok;
+}
+
+/*!
+ *  @brief Prints the results and checks them.
+ */
+static int check_results(double serial_us)
+{
+    const struct bmi2_fixture_result *res;
+    uint8_t loop;
+    uint8_t test;
+    int8_t expected;
+    int ok = 1;
+
+    printf("Serial %.1f ms, fixture %.1f ms\n", serial_us / 1000, fixture.duration_us / 1000.0);
+
+    for (loop = 0; loop < N_BUSES; loop++)
+    {
+        printf("  bus %u: %5lu steps, busy %.1f ms\n",
+               loop,
+               (unsigned long)fixture.n_steps[loop],
+               fixture.bus_us[loop] / 1000.0);
+    }
+
+    for (loop = 0; loop < N_SENSORS; loop++)
+    {
+        printf("  sensor %u, bus %u:", loop, fixture.dut[loop].bus);
+
+        for (test = 0; test < BMI2_FIXTURE_N_TESTS; test++)
+        {
+            res = &fixture.dut[loop].result[test];
+            printf("  %s %4d in %6.1f ms, %4u steps",
+                   test_names[test],
+                   res->rslt,
+                   res->duration_us / 1000.0,
+                   res->n_steps);
+
+            /* The stuck download fails the gyro self-test and CRT of its sensor only */
+            expected = ((loop == STUCK_SENSOR) && (test != 0)) ? BMI2_E_CRT_READY_FOR_DL_FAIL_ABORT : BMI2_OK;
+            if (res->rslt != expected)
+            {
+                ok = 0;
+            }
+        }
+
+        printf("\n");
+    }
+
+    if (!ok)
+    {
+        printf("  a result differs from the expected one\n");
+    }
+
+    if (fixture.duration_us >= serial_us)
+    {
+        printf("  the fixture was not faster than the blocking APIs\n");
+        ok = 0;
+    }
+
+    return ok;
+}
@@ -0,0 +1,502 @@
+/**\
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "bmi2.h"
+
+/******************************************************************************/
+/*!                Macro definition                                           */
+
+/*! Register map */
+#define REG_STATUS          UINT8_C(0x03)
+#define REG_ACC_DATA        UINT8_C(0x0C)
+#define REG_GYR_DATA        UINT8_C(0x12)
+#define REG_FIFO_LENGTH_0   UINT8_C(0x24)
+#define REG_FIFO_LENGTH_1   UINT8_C(0x25)
+#define REG_FIFO_DATA       UINT8_C(0x26)
+#define REG_ACC_CONF        UINT8_C(0x40)
+#define REG_GYR_CONF        UINT8_C(0x42)
+#define REG_FIFO_CONFIG_1   UINT8_C(0x49)
+#define REG_ACC_OFF_X       UINT8_C(0x71)
+#define REG_GYR_OFF_X       UINT8_C(0x74)
+#define REG_GYR_OFF_MSB     UINT8_C(0x77)
+#define REG_PWR_CONF        UINT8_C(0x7C)
+#define REG_CMD             UINT8_C(0x7E)
+
+/*! FIFO size and frame length, header-less frames of one sensor */
+#define FIFO_SIZE           UINT16_C(2048)
+#define FRAME_LEN           UINT8_C(6)
+
+/*! I2C time per byte at 400 kHz, in microseconds */
+#define BUS_US_PER_BYTE     (22.5)
+
+/*! Bias of the simulated sensor: accelerometer in g, gyroscope in dps */
+#define ACC_BIAS_X          (0.05)
+#define ACC_BIAS_Y          (-0.03)
+#define ACC_BIAS_Z          (0.02)
+#define GYR_BIAS_X          (1.22)
+#define GYR_BIAS_Y          (-2.13)
+#define GYR_BIAS_Z          (0.43)
+
+/*! Noise density: accelerometer in g/sqrt(Hz), gyroscope in dps/sqrt(Hz) */
+#define ACC_NOISE           (160e-6)
+#define GYR_NOISE           (0.008)
+
+/*! Offset register resolution: accelerometer in g, gyroscope in dps */
+#define ACC_OFF_LSB         (0.00390625)
+#define GYR_OFF_LSB         (0.061)
+
+/*! Sensitivity: accelerometer +/-2g, gyroscope +/-2000dps */
+#define ACC_LSB_PER_G       (16384.0)
+#define GYR_LSB_PER_DPS     (16.384)
+
+/*! Runs per FOC path */
+#define N_SEEDS             UINT8_C(4)
+
+/*! A dummy frame every DUMMY_EVERY frames of the FIFO, in the runs with dummy frames */
+#define DUMMY_EVERY         UINT16_C(10)
+
+/*! Offsets may differ from the bias by this many LSB: the average and the
+ * accelerometer scaling truncate towards zero, a negative deviation of the
+ * accelerometer is off by up to 1.5 LSB, plus noise of about 0.2 LSB
+ */
+#define OFF_TOL_LSB         (2.0)
+
+/******************************************************************************/
+/*!           Structure Definition                                            */
+
+/*! Outcome of a run */
+struct run_result
+{
+    int8_t acc_rslt;
+    int8_t gyr_rslt;
+    double acc_ms;
+    double gyr_ms;
+    uint32_t acc_transfers;
+    uint32_t gyr_transfers;
+    int16_t acc_off[3];
+    int16_t gyr_off[3];
+};
+
+/******************************************************************************/
+/*!           Static Variable Definition                                      */
+
+static const double acc_bias[3] = { ACC_BIAS_X, ACC_BIAS_Y, ACC_BIAS_Z };
+static const double gyr_bias[3] = { GYR_BIAS_X, GYR_BIAS_Y, GYR_BIAS_Z };
+
+/*! Register map */
+static uint8_t regs[256];
+
+/*! Simulated time, in microseconds, and bus transfers */
+static double time_us;
+static uint32_t n_transfers;
+
+/*! FIFO: time of the last flush, frames read since */
+static double fifo_start_us;
+static uint32_t fifo_read;
+
+/*! Last sample index read from the data registers */
+static long acc_last;
+static long gyr_last;
+
+/*! Noise seed of the run, dummy frame period of the FIFO, 0 for none */
+static uint32_t noise_seed;
+static uint16_t dummy_every;
+
+/******************************************************************************/
+/*!           Static Function Declaration                                     */
+
+/*!
+ *  @brief Reads the register map: data registers, status and FIFO.
+ */
+static BMI2_INTF_RETURN_TYPE map_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ *  @brief Writes the register map, a FIFO flush restarts the FIFO.
+ */
+static BMI2_INTF_RETURN_TYPE map_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ *  @brief Advances the simulated time.
+ */
+static void map_delay_us(uint32_t period, void *intf_ptr);
+
+/*!
+ *  @brief Output data rate of a sensor configuration register, in Hz.
+ */
+static double odr_hz(uint8_t conf);
+
+/*!
+ *  @brief Sample number idx of a sensor, bias plus noise.
+ */
+static void sample(uint8_t gyr, uint32_t idx, int16_t data[3]);
+
+/*!
+ *  @brief Normally distributed noise of a sample and channel, the same on every host.
+ */
+static double noise(uint32_t idx, uint8_t channel);
+
+/*!
+ *  @brief Number of frames in the FIFO, dummy frames included.
+ */
+static uint32_t fifo_frames(void);
+
+/*!
+ *  @brief Runs the accelerometer and gyroscope FOC of a path.
+ */
+static void run(uint8_t use_fifo, struct bmi2_dev *dev, struct run_result *result);
+
+/*!
+ *  @brief Checks the offsets of a run against the bias.
+ */
+static uint8_t offsets_match(const struct run_result *result);
+
+/******************************************************************************/
+/*!            Functions                                                      */
+
+/*
+ * Checks the FIFO based FOC on a simulated sensor with a known bias. The
+ * sensor has the noise density of the datasheet, the bus the timing of I2C at
+ * 400 kHz. The FIFO holds header-less frames, with or without a dummy frame
+ * every DUMMY_EVERY frames. The offsets written by the FIFO based FOC must
+ * cancel the bias within OFF_TOL_LSB; the polling FOC runs on the same sensor
+ * for comparison of the offsets, the time and the bus transfers.
+ */
+int main(void)
+{
+    struct bmi2_dev dev;
+    struct run_result poll;
+    struct run_result fifo;
+    uint32_t n_fail = 0;
+    uint8_t with_dummy;
+
+    memset(&dev, 0, sizeof(dev));
+    dev.intf = BMI2_I2C_INTF;
+    dev.read = map_read;
+    dev.write = map_write;
+    dev.delay_us = map_delay_us;
+    dev.read_write_len = 46;
+    dev.resolution = 16;
+    dev.remap.x_axis = BMI2_MAP_X_AXIS;
+    dev.remap.y_axis = BMI2_MAP_Y_AXIS;
+    dev.remap.z_axis = BMI2_MAP_Z_AXIS;
+
+    printf("Expected offsets: accel %.1f %.1f %.1f, gyro %.1f %.1f %.1f LSB\n",
+           -acc_bias[0] / ACC_OFF_LSB,
+           -acc_bias[1] / ACC_OFF_LSB,
+           -acc_bias[2] / ACC_OFF_LSB,
+           -gyr_bias[0] / GYR_OFF_LSB,
+           -gyr_bias[1] / GYR_OFF_LSB,
+           -gyr_bias[2] / GYR_OFF_LSB);
+
+    for (with_dummy = 0; with_dummy < 2; with_dummy++)
+    {
+        for (noise_seed = 1; noise_seed <= N_SEEDS; noise_seed++)
+        {
+            dummy_every = with_dummy ? DUMMY_EVERY : 0;
+            run(0, &dev, &poll);
+            run(1, &dev, &fifo);
+
+            printf("seed %lu, %s dummy frames\n", (unsigned long)noise_seed, with_dummy ? "with" : "no");
+            printf("  poll: accel %4d %4d %4d in %7.1f ms, %4lu transfers; gyro %4d %4d %4d in %7.1f ms, %4lu transfers\n",
+                   poll.acc_off[0],
+                   poll.acc_off[1],
+                   poll.acc_off[2],
+                   poll.acc_ms,
+                   (unsigned long)poll.acc_transfers,
+                   poll.gyr_off[0],
+                   poll.gyr_off[1],
+                   poll.gyr_off[2],
+                   poll.gyr_ms,
+                   (unsigned long)poll.gyr_transfers);
+            printf("  fifo: accel %4d %4d %4d in %7.1f ms, %4lu transfers; gyro %4d %4d %4d in %7.1f ms, %4lu transfers\n",
+                   fifo.acc_off[0],
+                   fifo.acc_off[1],
+                   fifo.acc_off[2],
+                   fifo.acc_ms,
+                   (unsigned long)fifo.acc_transfers,
+                   fifo.gyr_off[0],
+                   fifo.gyr_off[1],
+                   fifo.gyr_off[2],
+                   fifo.gyr_ms,
+                   (unsigned long)fifo.gyr_transfers);
+
+            if ((fifo.acc_rslt != BMI2_OK) || (fifo.gyr_rslt != BMI2_OK) || !offsets_match(&fifo))
+            {
+                printf("  fifo: rslt %d %d, offsets do not cancel the bias\n", fifo.acc_rslt, fifo.gyr_rslt);
+                n_fail++;
+            }
+        }
+    }
+
+    return (n_fail == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/*!
+ *  @brief Runs the accelerometer and gyroscope FOC of a path.
+ */
+static void run(uint8_t use_fifo, struct bmi2_dev *dev, struct run_result *result)
+{
+    struct bmi2_accel_foc_g_value g_value = { 0, 0, 1, 0 };
+    double start_us;
+    uint16_t off;
+    uint8_t axis;
+
+    memset(result, 0, sizeof(*result));
+    memset(regs, 0, sizeof(regs));
+
+    /* Accelerometer 100Hz, gyroscope 200Hz, advanced power save */
+    regs[REG_ACC_CONF] = 0xA8;
+    regs[REG_GYR_CONF] = 0xA9;
+    regs[REG_FIFO_CONFIG_1] = 0x10;
+    regs[REG_PWR_CONF] = 0x03;
+    dev->aps_status = BMI2_ENABLE;
+    acc_last = -1;
+    gyr_last = -1;
+
+    start_us = time_us;
+    n_transfers = 0;
+    result->acc_rslt = use_fifo ? bmi2_perform_accel_foc_fifo(&g_value, dev) : bmi2_perform_accel_foc(&g_value, dev);
+    result->acc_ms = (time_us - start_us) / 1000.0;
+    result->acc_transfers = n_transfers;
+
+    start_us = time_us;
+    n_transfers = 0;
+    result->gyr_rslt = use_fifo ? bmi2_perform_gyro_foc_fifo(dev) : bmi2_perform_gyro_foc(dev);
+    result->gyr_ms = (time_us - start_us) / 1000.0;
+    result->gyr_transfers = n_transfers;
+
+    for (axis = 0; axis < 3; axis++)
+    {
+        result->acc_off[axis] = (int8_t)regs[REG_ACC_OFF_X + axis];
+
+        /* 10 bit gyroscope offsets, the two upper bits of each in REG_GYR_OFF_MSB */
+        off = (uint16_t)(regs[REG_GYR_OFF_X + axis] | (((regs[REG_GYR_OFF_MSB] >> (2 * axis)) & 0x03) << 8));
+        result->gyr_off[axis] = (int16_t)((off & 0x200) ? (off - 1024) : off);
+    }
+}
+
+/*!
+ *  @brief Checks the offsets of a run against the bias.
+ */
+static uint8_t offsets_match(const struct run_result *result)
+{
+    uint8_t axis;
+
+    for (axis = 0; axis < 3; axis++)
+    {
+        if ((fabs(result->acc_off[axis] + (acc_bias[axis] / ACC_OFF_LSB)) > OFF_TOL_LSB) ||
+            (fabs(result->gyr_off[axis] + (gyr_bias[axis] / GYR_OFF_LSB)) > OFF_TOL_LSB))
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/*!
+ *  @brief Reads the register map: data registers, status and FIFO.
+ */
+static BMI2_INTF_RETURN_TYPE map_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    long acc_idx;
+    long gyr_idx;
+    int16_t data[3];
+    uint32_t frame;
+    uint32_t idx;
+    uint8_t addr;
+    uint8_t gyr;
+
+    (void)intf_ptr;
+
+    n_transfers++;
+    time_us += (len + 2) * BUS_US_PER_BYTE;
+    acc_idx = (long)(time_us * odr_hz(regs[REG_ACC_CONF]) / 1e6);
+    gyr_idx = (long)(time_us * odr_hz(regs[REG_GYR_CONF]) / 1e6);
+
+    if (reg_addr == REG_FIFO_DATA)
+    {
+        /* Frames of the enabled sensor, dummy frames in between; 0x8000 past the end */
+        gyr = (regs[REG_FIFO_CONFIG_1] & 0x80) ? 1 : 0;
+        for (idx = 0; idx + FRAME_LEN <= len; idx += FRAME_LEN)
+        {
+            if (fifo_read >= fifo_frames())
+            {
+                reg_data[idx] = 0x00;
+                reg_data[idx + 1] = 0x80;
+                reg_data[idx + 2] = 0x00;
+                reg_data[idx + 3] = 0x80;
+                reg_data[idx + 4] = 0x00;
+                reg_data[idx + 5] = 0x80;
+                continue;
+            }
+
+            frame = fifo_read++;
+            if ((dummy_every != 0) && ((frame % dummy_every) == (uint32_t)(dummy_every - 1)))
+            {
+                reg_data[idx] = gyr ? 0x02 : 0x01;
+                reg_data[idx + 1] = 0x7F;
+                reg_data[idx + 2] = 0x00;
+                reg_data[idx + 3] = 0x80;
+                reg_data[idx + 4] = 0x00;
+                reg_data[idx + 5] = 0x00;
+            }
+            else
+            {
+                /* FIFO samples are numbered apart from those of the data registers */
+                sample(gyr, UINT32_C(1000000) + frame, data);
+                memcpy(&reg_data[idx], data, FRAME_LEN);
+            }
+        }
+
+        return BMI2_INTF_RET_SUCCESS;
+    }
+
+    for (idx = 0; idx < len; idx++)
+    {
+        addr = (uint8_t)(reg_addr + idx);
+        if (addr == REG_STATUS)
+        {
+            /* Data ready of the accelerometer and gyroscope, command ready */
+            reg_data[idx] = (uint8_t)(((acc_idx > acc_last) ? 0x80 : 0) | ((gyr_idx > gyr_last) ? 0x40 : 0) | 0x10);
+        }
+        else if ((addr >= REG_ACC_DATA) && (addr < (REG_ACC_DATA + FRAME_LEN)))
+        {
+            sample(0, (uint32_t)acc_idx, data);
+            reg_data[idx] = ((uint8_t *)data)[addr - REG_ACC_DATA];
+            acc_last = acc_idx;
+        }
+        else if ((addr >= REG_GYR_DATA) && (addr < (REG_GYR_DATA + FRAME_LEN)))
+        {
+            sample(1, (uint32_t)gyr_idx, data);
+            reg_data[idx] = ((uint8_t *)data)[addr - REG_GYR_DATA];
+            gyr_last = gyr_idx;
+        }
+        else if (addr == REG_FIFO_LENGTH_0)
+        {
+            reg_data[idx] = (uint8_t)((fifo_frames() - fifo_read) * FRAME_LEN);
+        }
+        else if (addr == REG_FIFO_LENGTH_1)
+        {
+            reg_data[idx] = (uint8_t)(((fifo_frames() - fifo_read) * FRAME_LEN) >> 8);
+        }
+        else
+        {
+            reg_data[idx] = regs[addr];
+        }
+    }
+
+    return BMI2_INTF_RET_SUCCESS;
+}
+
+/*!
+ *  @brief Writes the register map, a FIFO flush restarts the FIFO.
+ */
+static BMI2_INTF_RETURN_TYPE map_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    uint32_t idx;
+
+    (void)intf_ptr;
+
+    n_transfers++;
+    time_us += (len + 2) * BUS_US_PER_BYTE;
+    for (idx = 0; idx < len; idx++)
+    {
+        regs[(uint8_t)(reg_addr + idx)] = reg_data[idx];
+    }
+
+    if ((reg_addr == REG_CMD) && (reg_data[0] == BMI2_FIFO_FLUSH_CMD))
+    {
+        fifo_start_us = time_us;
+        fifo_read = 0;
+    }
+
+    return BMI2_INTF_RET_SUCCESS;
+}
+
+/*!
+ *  @brief Advances the simulated time.
+ */
+static void map_delay_us(uint32_t period, void *intf_ptr)
+{
+    (void)intf_ptr;
+
+    time_us += period;
+}
+
+/*!
+ *  @brief Output data rate of a sensor configuration register, in Hz.
+ */
+static double odr_hz(uint8_t conf)
+{
+    return 100.0 * pow(2.0, (double)(conf & 0x0F) - 8.0);
+}
+
+/*!
+ *  @brief Sample number idx of a sensor, bias plus noise.
+ */
+static void sample(uint8_t gyr, uint32_t idx, int16_t data[3])
+{
+    double odr = odr_hz(regs[gyr ? REG_GYR_CONF : REG_ACC_CONF]);
+    double value;
+    uint8_t axis;
+
+    for (axis = 0; axis < 3; axis++)
+    {
+        if (gyr)
+        {
+            value = (gyr_bias[axis] + (GYR_NOISE * sqrt(odr / 2.0) * noise(idx, (uint8_t)(axis + 3)))) *
+                    GYR_LSB_PER_DPS;
+        }
+        else
+        {
+            /* 1g on the z axis */
+            value = (acc_bias[axis] + ((axis == 2) ? 1.0 : 0.0) + (ACC_NOISE * sqrt(odr / 2.0) * noise(idx, axis))) *
+                    ACC_LSB_PER_G;
+        }
+
+        data[axis] = (int16_t)lrint(value);
+    }
+}
+
+/*!
+ *  @brief Normally distributed noise of a sample and channel, the same on every host.
+ */
+static double noise(uint32_t idx, uint8_t channel)
+{
+    uint32_t state = (idx * UINT32_C(2654435761)) ^ (channel * UINT32_C(40503)) ^ (noise_seed * UINT32_C(97));
+    double u1;
+    double u2;
+
+    state = (state * UINT32_C(1103515245)) + UINT32_C(12345);
+    u1 = ((state >> 8) + 1.0) / 16777218.0;
+    state = (state * UINT32_C(1103515245)) + UINT32_C(12345);
+    u2 = ((state >> 8) + 1.0) / 16777218.0;
+
+    /* Box-Muller */
+    return sqrt(-2.0 * log(u1)) * cos(2.0 * 3.14159265358979323846 * u2);
+}
+
+/*!
+ *  @brief Number of frames in the FIFO, dummy frames included.
+ */
+static uint32_t fifo_frames(void)
+{
+    uint8_t gyr = (regs[REG_FIFO_CONFIG_1] & 0x80) ? 1 : 0;
+    uint32_t n_frames = (uint32_t)((time_us - fifo_start_us) * odr_hz(regs[gyr ? REG_GYR_CONF : REG_ACC_CONF]) / 1e6);
+
+    /* Stop on full */
+    if (n_frames > (FIFO_SIZE / FRAME_LEN))
+    {
+        n_frames = FIFO_SIZE / FRAME_LEN;
+    }
+
+    return n_frames;
+}
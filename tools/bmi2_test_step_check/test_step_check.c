@@ -0,0 +1,587 @@
+/**\
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bmi270.h"
+
+/******************************************************************************/
+/*!                Macro definition                                           */
+
+/*! Register map */
+#define REG_CHIP_ID             UINT8_C(0x00)
+#define REG_STATUS              UINT8_C(0x03)
+#define REG_ACC_DATA            UINT8_C(0x0C)
+#define REG_INTERNAL_STATUS     UINT8_C(0x21)
+#define REG_FEAT_PAGE           UINT8_C(0x2F)
+#define REG_FEATURES            UINT8_C(0x30)
+#define REG_INIT_DATA           UINT8_C(0x5E)
+#define REG_GYR_CRT_CONF        UINT8_C(0x69)
+#define REG_ACC_SELF_TEST       UINT8_C(0x6D)
+#define REG_GYR_SELF_TEST_AXES  UINT8_C(0x6E)
+#define REG_CMD                 UINT8_C(0x7E)
+
+/*! Register bits: NVM ready, CRT running and ready for download, self-test enable and sign */
+#define NVM_RDY                 UINT8_C(0x10)
+#define CRT_RUNNING             UINT8_C(0x04)
+#define RDY_FOR_DL              UINT8_C(0x08)
+#define ACC_SELF_TEST_EN        UINT8_C(0x01)
+#define ACC_SELF_TEST_SIGN      UINT8_C(0x04)
+#define GYR_AXES_OK             UINT8_C(0x0F)
+
+/*! Commands: gyro trigger and NVM programming */
+#define CMD_G_TRIGGER           UINT8_C(0x02)
+#define CMD_NVM_PROG            UINT8_C(0xA0)
+
+/*! Feature page and byte of the gyro trigger flags, and the flag requiring a CRT download */
+#define GT_PAGE                 UINT8_C(1)
+#define GT_BYTE                 UINT8_C(2)
+#define GT_DL_REQUIRED          UINT8_C(0x10)
+
+/*! Chip id of the BMI270 */
+#define CHIP_ID                 UINT8_C(0x24)
+
+/*! Timing of the simulated sensor, in microseconds */
+#define CRT_US                  (300000.0)
+#define CRT_AFTER_DL_US         (200000.0)
+#define DL_TOGGLE_US            (1500.0)
+#define NVM_PROG_US             (130000.0)
+
+/*! CRT download length after which the CRT starts */
+#define DL_LEN                  UINT32_C(2048)
+
+/*! I2C time per byte at 400 kHz, in microseconds */
+#define BUS_US_PER_BYTE         (22.5)
+
+/*! Accel self-test response in LSB at +/-16g: x, y with the opposite sign, z */
+#define ST_X                    INT16_C(17500)
+#define ST_Y                    INT16_C(17500)
+#define ST_Z                    INT16_C(12000)
+#define ST_WEAK                 INT16_C(1000)
+#define ACC_REST                INT16_C(100)
+
+/*! Number of sensors sharing the bus, and work between their steps in microseconds */
+#define N_SENSORS               UINT8_C(4)
+#define LOOP_US                 UINT32_C(100)
+
+/*! Longest CRT or gyro self-test step allowed while interleaving */
+#define MAX_STEP_US             UINT32_C(3000)
+
+/*! Number of cases */
+#define N_CASES                 UINT8_C(9)
+
+/******************************************************************************/
+/*!           Structure Definition                                            */
+
+/*! Simulated sensor */
+struct sim_sensor
+{
+    uint8_t regs[256];
+    uint8_t pages[8][16];
+
+    /*! The CRT runs, needs a download, the sensor never gets ready for it, the self-test response is weak */
+    uint8_t crt_running;
+    uint8_t dl_required;
+    uint8_t dl_stuck;
+    uint8_t weak;
+
+    /*! Time the CRT ends, rdy_for_dl toggles and the NVM programming ends, 0 for none */
+    double crt_end_us;
+    double dl_toggle_us;
+    double nvm_end_us;
+
+    /*! CRT bytes downloaded and bus transfers */
+    uint32_t dl_bytes;
+    uint32_t n_transfers;
+};
+
+/*! A procedure and the sensor it runs on */
+struct test_case
+{
+    const char *name;
+    uint8_t op;
+    uint8_t dl_required;
+    uint8_t dl_stuck;
+    uint8_t weak;
+    int8_t expected;
+};
+
+/******************************************************************************/
+/*!           Static Variable Definition                                      */
+
+static const struct test_case cases[N_CASES] = {
+    { "gyro self-test", BMI2_TEST_SM_GYRO_SELF_TEST, 0, 0, 0, BMI2_OK },
+    { "gyro self-test, download", BMI2_TEST_SM_GYRO_SELF_TEST, 1, 0, 0, BMI2_OK },
+    { "gyro self-test, stuck download", BMI2_TEST_SM_GYRO_SELF_TEST, 1, 1, 0, BMI2_E_CRT_READY_FOR_DL_FAIL_ABORT },
+    { "CRT", BMI2_TEST_SM_CRT, 0, 0, 0, BMI2_OK },
+    { "CRT, download", BMI2_TEST_SM_CRT, 1, 0, 0, BMI2_OK },
+    { "CRT, stuck download", BMI2_TEST_SM_CRT, 1, 1, 0, BMI2_E_CRT_READY_FOR_DL_FAIL_ABORT },
+    { "accel self-test", BMI2_TEST_SM_ACCEL_SELF_TEST, 0, 0, 0, BMI2_OK },
+    { "accel self-test, weak", BMI2_TEST_SM_ACCEL_SELF_TEST, 0, 0, 1, BMI2_E_SELF_TEST_FAIL },
+    { "NVM programming", BMI2_TEST_SM_NVM_PROG, 0, 0, 0, BMI2_OK }
+};
+
+/*! Sensors, sharing one clock */
+static struct sim_sensor sensors[N_SENSORS];
+static double time_us;
+
+/*! Time of each case through the blocking API, in microseconds */
+static double blocking_us[N_CASES];
+
+/******************************************************************************/
+/*!           Static Function Declaration                                     */
+
+/*!
+ *  @brief Runs the timed events of the sensor due at the simulated time.
+ */
+static void sim_update(struct sim_sensor *sim);
+
+/*!
+ *  @brief Reads the register map: accel data with the self-test excitation, feature pages.
+ */
+static BMI2_INTF_RETURN_TYPE sim_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ *  @brief Writes the register map: gyro trigger, CRT download and NVM programming.
+ */
+static BMI2_INTF_RETURN_TYPE sim_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ *  @brief Advances the simulated time.
+ */
+static void sim_delay_us(uint32_t period, void *intf_ptr);
+
+/*!
+ *  @brief Initializes a sensor for a case.
+ */
+static int8_t sim_setup(const struct test_case *test, struct sim_sensor *sim, struct bmi2_dev *dev);
+
+/*!
+ *  @brief Runs a procedure with its blocking API.
+ */
+static int8_t run_blocking(uint8_t op, struct bmi2_dev *dev);
+
+/*!
+ *  @brief Runs each case blocking and in steps.
+ */
+static int check_cases(void);
+
+/*!
+ *  @brief Runs four procedures interleaved on one bus.
+ */
+static int check_interleaved(void);
+
+/******************************************************************************/
+/*!            Functions                                                      */
+
+/*
+ * Checks the resumable CRT, self-test and NVM programming steps on
+ * simulated sensors: each procedure must give the same result through its
+ * blocking API and through bmi2_test_sm_step, a step before its deadline
+ * must not touch the bus, and four procedures interleaved on one bus must
+ * finish sooner than one after another with short CRT and gyro steps.
+ *
+ *   test_step_check
+ */
+int main(void)
+{
+    int ok;
+
+    ok = check_cases();
+    ok &= check_interleaved();
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/*!
+ *  @brief Runs the timed events of the sensor due at the simulated time.
+ */
+static void sim_update(struct sim_sensor *sim)
+{
+    if ((sim->crt_end_us > 0) && (time_us >= sim->crt_end_us))
+    {
+        sim->regs[REG_GYR_CRT_CONF] &= (uint8_t)~CRT_RUNNING;
+        sim->regs[REG_GYR_SELF_TEST_AXES] = GYR_AXES_OK;
+        sim->crt_running = 0;
+        sim->crt_end_us = 0;
+    }
+
+    if ((sim->dl_toggle_us > 0) && (time_us >= sim->dl_toggle_us))
+    {
+        sim->regs[REG_GYR_CRT_CONF] ^= RDY_FOR_DL;
+        sim->dl_toggle_us = 0;
+    }
+
+    if ((sim->nvm_end_us > 0) && (time_us >= sim->nvm_end_us))
+    {
+        sim->regs[REG_STATUS] |= NVM_RDY;
+        sim->nvm_end_us = 0;
+    }
+}
+
+/*!
+ *  @brief Reads the register map: accel data with the self-test excitation, feature pages.
+ */
+static BMI2_INTF_RETURN_TYPE sim_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    struct sim_sensor *sim = (struct sim_sensor *)intf_ptr;
+    uint8_t st = sim->regs[REG_ACC_SELF_TEST];
+    int16_t acc[3] = { ACC_REST, ACC_REST, ACC_REST };
+    uint32_t index;
+    uint8_t addr;
+
+    sim->n_transfers++;
+    time_us += (len + 2) * BUS_US_PER_BYTE;
+    sim_update(sim);
+
+    if ((st & ACC_SELF_TEST_EN) != 0)
+    {
+        acc[0] = sim->weak ? ST_WEAK : ST_X;
+        acc[1] = (int16_t)-(sim->weak ? ST_WEAK : ST_Y);
+        acc[2] = sim->weak ? ST_WEAK : ST_Z;
+
+        if ((st & ACC_SELF_TEST_SIGN) == 0)
+        {
+            acc[0] = (int16_t)-acc[0];
+            acc[1] = (int16_t)-acc[1];
+            acc[2] = (int16_t)-acc[2];
+        }
+    }
+
+    for (index = 0; index < len; index++)
+    {
+        addr = (uint8_t)(reg_addr + index);
+        if ((addr >= REG_FEATURES) && (addr < REG_FEATURES + 16))
+        {
+            reg_data[index] = sim->pages[sim->regs[REG_FEAT_PAGE] & 0x07][addr - REG_FEATURES];
+        }
+        else if ((addr >= REG_ACC_DATA) && (addr < REG_ACC_DATA + 6))
+        {
+            reg_data[index] = (uint8_t)((uint16_t)acc[(addr - REG_ACC_DATA) / 2] >> (8 * (addr & 0x01)));
+        }
+        else if (addr == REG_INTERNAL_STATUS)
+        {
+            reg_data[index] = 0x01;
+        }
+        else if (addr == REG_CHIP_ID)
+        {
+            reg_data[index] = CHIP_ID;
+        }
+        else
+        {
+            reg_data[index] = sim->regs[addr];
+        }
+    }
+
+    return BMI2_INTF_RET_SUCCESS;
+}
+
+/*!
+ *  @brief Writes the register map: gyro trigger, CRT download and NVM programming.
+ */
+static BMI2_INTF_RETURN_TYPE sim_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    struct sim_sensor *sim = (struct sim_sensor *)intf_ptr;
+    uint32_t index;
+    uint8_t addr;
+
+    sim->n_transfers++;
+    time_us += (len + 2) * BUS_US_PER_BYTE;
+    sim_update(sim);
+
+    if (reg_addr == REG_INIT_DATA)
+    {
+        sim->dl_bytes += len;
+
+        return BMI2_INTF_RET_SUCCESS;
+    }
+
+    for (index = 0; index < len; index++)
+    {
+        addr = (uint8_t)(reg_addr + index);
+        if ((addr >= REG_FEATURES) && (addr < REG_FEATURES + 16))
+        {
+            sim->pages[sim->regs[REG_FEAT_PAGE] & 0x07][addr - REG_FEATURES] = reg_data[index];
+        }
+        else
+        {
+            sim->regs[addr] = reg_data[index];
+        }
+    }
+
+    if ((reg_addr == REG_CMD) && (reg_data[0] == CMD_G_TRIGGER))
+    {
+        /* A CRT needing a download runs once the download is complete */
+        if (!sim->crt_running)
+        {
+            sim->crt_running = 1;
+            sim->regs[REG_GYR_CRT_CONF] |= CRT_RUNNING;
+            sim->crt_end_us = sim->dl_required ? 0 : (time_us + CRT_US);
+        }
+
+        if (sim->dl_required)
+        {
+            if (!sim->dl_stuck)
+            {
+                sim->dl_toggle_us = time_us + DL_TOGGLE_US;
+            }
+
+            if ((sim->dl_bytes >= DL_LEN) && (sim->crt_end_us == 0))
+            {
+                sim->crt_end_us = time_us + CRT_AFTER_DL_US;
+            }
+        }
+    }
+    else if ((reg_addr == REG_CMD) && (reg_data[0] == CMD_NVM_PROG))
+    {
+        sim->regs[REG_STATUS] &= (uint8_t)~NVM_RDY;
+        sim->nvm_end_us = time_us + NVM_PROG_US;
+    }
+
+    return BMI2_INTF_RET_SUCCESS;
+}
+
+/*!
+ *  @brief Advances the simulated time.
+ */
+static void sim_delay_us(uint32_t period, void *intf_ptr)
+{
+    time_us += period;
+    sim_update((struct sim_sensor *)intf_ptr);
+}
+
+/*!
+ *  @brief Initializes a sensor for a case.
+ */
+static int8_t sim_setup(const struct test_case *test, struct sim_sensor *sim, struct bmi2_dev *dev)
+{
+    int8_t rslt;
+
+    memset(sim, 0, sizeof(*sim));
+    sim->regs[REG_STATUS] = NVM_RDY;
+    sim->weak = test->weak;
+
+    memset(dev, 0, sizeof(*dev));
+    dev->intf = BMI2_I2C_INTF;
+    dev->read = sim_read;
+    dev->write = sim_write;
+    dev->delay_us = sim_delay_us;
+    dev->intf_ptr = sim;
+    dev->read_write_len = 46;
+
+    rslt = bmi270_init(dev);
+
+    /* The configuration upload of the init is not a CRT download */
+    sim->dl_bytes = 0;
+    sim->n_transfers = 0;
+    sim->dl_required = test->dl_required;
+    sim->dl_stuck = test->dl_stuck;
+    if (test->dl_required)
+    {
+        sim->pages[GT_PAGE][GT_BYTE] = GT_DL_REQUIRED;
+    }
+
+    return rslt;
+}
+
+/*!
+ *  @brief Runs a procedure with its blocking API.
+ */
+static int8_t run_blocking(uint8_t op, struct bmi2_dev *dev)
+{
+    int8_t rslt;
+
+    switch (op)
+    {
+        case BMI2_TEST_SM_GYRO_SELF_TEST:
+            rslt = bmi2_do_gyro_st(dev);
+            break;
+        case BMI2_TEST_SM_CRT:
+            rslt = bmi2_do_crt(dev);
+            break;
+        case BMI2_TEST_SM_ACCEL_SELF_TEST:
+            rslt = bmi2_perform_accel_self_test(dev);
+            break;
+        default:
+            rslt = bmi2_nvm_prog(dev);
+            break;
+    }
+
+    return rslt;
+}
+
+/*!
+ *  @brief Runs each case blocking and in steps.
+ */
+static int check_cases(void)
+{
+    struct sim_sensor *sim = &sensors[0];
+    struct bmi2_dev dev;
+    struct bmi2_test_sm sm;
+    uint8_t loop;
+    int8_t blocking_rslt;
+    int8_t step_rslt;
+    uint32_t n_steps;
+    uint32_t n_transfers;
+    uint32_t n_early_transfers;
+    double start_us;
+    int ok = 1;
+
+    for (loop = 0; loop < N_CASES; loop++)
+    {
+        if (sim_setup(&cases[loop], sim, &dev) != BMI2_OK)
+        {
+            printf("%s: init failed\n", cases[loop].name);
+            ok = 0;
+            continue;
+        }
+
+        start_us = time_us;
+        blocking_rslt = run_blocking(cases[loop].op, &dev);
+        blocking_us[loop] = time_us - start_us;
+
+        /* The same procedure in steps, each step run at its deadline, and once
+         * before it, which must not touch the bus
+         */
+        (void)sim_setup(&cases[loop], sim, &dev);
+        n_steps = 0;
+        n_early_transfers = 0;
+        step_rslt = bmi2_test_sm_start(cases[loop].op, (uint32_t)time_us, &sm, &dev);
+        while ((step_rslt == BMI2_OK) || (step_rslt == BMI2_W_STEP_PENDING))
+        {
+            if ((int32_t)(sm.next_us - (uint32_t)time_us) > 0)
+            {
+                n_transfers = sim->n_transfers;
+                if ((bmi2_test_sm_step(sm.next_us - 1, &sm, &dev) != BMI2_W_STEP_PENDING) ||
+                    (sim->n_transfers != n_transfers))
+                {
+                    n_early_transfers++;
+                }
+
+                time_us = sm.next_us;
+            }
+
+            step_rslt = bmi2_test_sm_step((uint32_t)time_us, &sm, &dev);
+            n_steps++;
+            if (step_rslt != BMI2_W_STEP_PENDING)
+            {
+                break;
+            }
+        }
+
+        printf("%-31s: %4d blocking in %6.1f ms, %4d in %4lu steps\n",
+               cases[loop].name,
+               blocking_rslt,
+               blocking_us[loop] / 1000,
+               step_rslt,
+               (unsigned long)n_steps);
+
+        if ((blocking_rslt != cases[loop].expected) || (step_rslt != cases[loop].expected))
+        {
+            printf("  expected %d\n", cases[loop].expected);
+            ok = 0;
+        }
+
+        if (n_early_transfers != 0)
+        {
+            printf("  %lu steps before their deadline ran\n", (unsigned long)n_early_transfers);
+            ok = 0;
+        }
+    }
+
+    return ok;
+}
+
+/*!
+ *  @brief Runs four procedures interleaved on one bus.
+ */
+static int check_interleaved(void)
+{
+    /* CRT, accel self-test, gyro self-test and a CRT with download */
+    static const uint8_t case_idx[N_SENSORS] = { 3, 6, 0, 4 };
+    struct bmi2_dev devs[N_SENSORS];
+    struct bmi2_test_sm sm[N_SENSORS];
+    int8_t rslt[N_SENSORS];
+    double sequential_us = 0;
+    double start_us;
+    double step_start_us;
+    double longest_step_us = 0;
+    uint8_t loop;
+    uint8_t n_pending;
+    int ok = 1;
+
+    for (loop = 0; loop < N_SENSORS; loop++)
+    {
+        if (sim_setup(&cases[case_idx[loop]], &sensors[loop], &devs[loop]) != BMI2_OK)
+        {
+            printf("Interleaved: init failed\n");
+
+            return 0;
+        }
+
+        sequential_us += blocking_us[case_idx[loop]];
+    }
+
+    start_us = time_us;
+    for (loop = 0; loop < N_SENSORS; loop++)
+    {
+        (void)bmi2_test_sm_start(cases[case_idx[loop]].op, (uint32_t)time_us, &sm[loop], &devs[loop]);
+    }
+
+    do
+    {
+        n_pending = 0;
+        for (loop = 0; loop < N_SENSORS; loop++)
+        {
+            step_start_us = time_us;
+            rslt[loop] = bmi2_test_sm_step((uint32_t)time_us, &sm[loop], &devs[loop]);
+            if (rslt[loop] == BMI2_W_STEP_PENDING)
+            {
+                n_pending++;
+            }
+
+            /* The accel self-test ends with a soft-reset and a configuration load */
+            if ((sm[loop].op != BMI2_TEST_SM_ACCEL_SELF_TEST) && (time_us - step_start_us > longest_step_us))
+            {
+                longest_step_us = time_us - step_start_us;
+            }
+        }
+
+        time_us += LOOP_US;
+    } while (n_pending != 0);
+
+    printf("Interleaved on %u sensors: %.1f ms against %.1f ms one after another, results %d %d %d %d, "
+           "longest CRT/gyro step %.0f us\n",
+           N_SENSORS,
+           (time_us - start_us) / 1000,
+           sequential_us / 1000,
+           rslt[0],
+           rslt[1],
+           rslt[2],
+           rslt[3],
+           longest_step_us);
+
+    for (loop = 0; loop < N_SENSORS; loop++)
+    {
+        if (rslt[loop] != cases[case_idx[loop]].expected)
+        {
+            ok = 0;
+        }
+    }
+
+    if ((time_us - start_us >= sequential_us) || (longest_step_us > MAX_STEP_US))
+    {
+        ok = 0;
+    }
+
+    if (!ok)
+    {
+        printf("  the interleaved run failed\n");
+    }
+
+    return ok;
+}
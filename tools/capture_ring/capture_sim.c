@@ -0,0 +1,388 @@
+/**\
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "capture_ring.h"
+
+/******************************************************************************/
+/*!                Macro definition                                           */
+
+/*! Block of the board: 600 words, one stereo 16 bit frame each */
+#define BLOCK_WORDS         UINT16_C(600)
+
+/*! Frame rate, a word is written by the DMA every 1/48000 s */
+#define FRAME_RATE_HZ       UINT32_C(48000)
+
+/*! Defaults: 5 ms per block, a 40 ms stall every 20 blocks, 60 s */
+#define DEFAULT_PROC_US     UINT32_C(5000)
+#define DEFAULT_STALL_US    UINT32_C(40000)
+#define DEFAULT_STALL_EVERY UINT32_C(20)
+#define DEFAULT_SECONDS     UINT32_C(60)
+
+/*! Value the DMA never writes, marks a buffer not filled yet */
+#define NOT_FILLED          UINT32_C(0xFFFFFFFF)
+
+/******************************************************************************/
+/*!           Structure Definition                                            */
+
+/*! Consumer model: proc_us per block, plus stall_us every stall_every blocks */
+struct consumer_cfg
+{
+    uint32_t proc_us;
+    uint32_t stall_us;
+    uint32_t stall_every;
+    uint32_t seconds;
+};
+
+/*! Outcome of a run */
+struct sim_result
+{
+    /*! Blocks released by the DMA */
+    uint32_t n_filled;
+
+    /*! Blocks the consumer processed, and those found overwritten meanwhile */
+    uint32_t n_consumed;
+    uint32_t n_corrupted;
+
+    /*! Blocks the consumer never saw */
+    uint32_t n_missed;
+
+    /*! Overruns counted by the ring */
+    uint32_t n_overruns;
+
+    /*! Most blocks waiting */
+    uint8_t max_waiting;
+};
+
+/******************************************************************************/
+/*!           Static Variable Definition                                      */
+
+/*! Buffer storage, as on the board */
+static uint32_t buffers[CAPTURE_RING_MAX_BUFS][BLOCK_WORDS];
+
+/******************************************************************************/
+/*!           Static Function Declaration                                     */
+
+/*!
+ *  @brief Runs the ring: a block goes back to the DMA once the consumer released it.
+ */
+static void run_ring(uint8_t n_bufs, const struct consumer_cfg *cfg, struct sim_result *result);
+
+/*!
+ *  @brief Runs the former ping-pong: the released block is handed back to the
+ *  DMA at once and the consumer is told of the latest one.
+ */
+static void run_legacy(const struct consumer_cfg *cfg, struct sim_result *result);
+
+/*!
+ *  @brief Checks that only a buffer the consumer holds can be released, once.
+ */
+static int check_release(void);
+
+/*!
+ *  @brief Time the consumer spends on block number idx, in frames.
+ */
+static uint32_t busy_frames(uint32_t idx, const struct consumer_cfg *cfg);
+
+/*!
+ *  @brief Checks that a block holds its own sequence number only.
+ */
+static int block_intact(const uint32_t *data, uint32_t seq);
+
+/*!
+ *  @brief Prints a run.
+ */
+static void print_result(const char *name, const struct consumer_cfg *cfg, const struct sim_result *result);
+
+/******************************************************************************/
+/*!            Functions                                                      */
+
+/*
+ * Simulates the I2S/TDM capture on the host: the DMA writes a word per frame
+ * and releases a block every BLOCK_WORDS frames, a consumer with a given
+ * processing time and periodic stalls takes the blocks. Every word of a block
+ * holds the sequence number of the block, so a block overwritten while the
+ * consumer works on it is found when the consumer is done.
+ *
+ *   capture_sim [proc_us] [stall_us] [stall_every] [seconds]
+ */
+int main(int argc, char *argv[])
+{
+    struct consumer_cfg cfg = { DEFAULT_PROC_US, DEFAULT_STALL_US, DEFAULT_STALL_EVERY, DEFAULT_SECONDS };
+    struct sim_result result;
+    char name[16];
+    uint8_t n_bufs;
+
+    if (argc > 1)
+    {
+        cfg.proc_us = (uint32_t)strtoul(argv[1], NULL, 0);
+    }
+
+    if (argc > 2)
+    {
+        cfg.stall_us = (uint32_t)strtoul(argv[2], NULL, 0);
+    }
+
+    if (argc > 3)
+    {
+        cfg.stall_every = (uint32_t)strtoul(argv[3], NULL, 0);
+    }
+
+    if (argc > 4)
+    {
+        cfg.seconds = (uint32_t)strtoul(argv[4], NULL, 0);
+    }
+
+    if ((cfg.stall_every == 0) || (cfg.seconds == 0))
+    {
+        printf("Usage: %s [proc_us] [stall_us] [stall_every] [seconds]\n", argv[0]);
+
+        return EXIT_FAILURE;
+    }
+
+    printf("Block of %u words every %.2f ms, consumer %lu us per block, %lu us stall every %lu blocks, %lu s\n",
+           BLOCK_WORDS,
+           1000.0 * BLOCK_WORDS / FRAME_RATE_HZ,
+           (unsigned long)cfg.proc_us,
+           (unsigned long)cfg.stall_us,
+           (unsigned long)cfg.stall_every,
+           (unsigned long)cfg.seconds);
+
+    run_legacy(&cfg, &result);
+    print_result("ping-pong", &cfg, &result);
+
+    for (n_bufs = 3; n_bufs <= CAPTURE_RING_MAX_BUFS; n_bufs++)
+    {
+        run_ring(n_bufs, &cfg, &result);
+        (void)snprintf(name, sizeof(name), "ring %u", n_bufs);
+        print_result(name, &cfg, &result);
+    }
+
+    if (!check_release())
+    {
+        printf("Release of a buffer not held by the consumer was accepted\n");
+
+        return EXIT_FAILURE;
+    }
+
+    printf("Release of a buffer not held by the consumer is refused\n");
+
+    return EXIT_SUCCESS;
+}
+
+/*!
+ *  @brief Runs the ring: a block goes back to the DMA once the consumer released it.
+ */
+static void run_ring(uint8_t n_bufs, const struct consumer_cfg *cfg, struct sim_result *result)
+{
+    struct capture_ring ring;
+    struct capture_ring_block block = { NULL, 0, 0 };
+    uint32_t n_frames = cfg->seconds * FRAME_RATE_HZ;
+    uint32_t frame;
+    uint32_t busy_until = 0;
+    uint32_t expected_seq = 0;
+    uint32_t fill_seq = 0;
+    uint32_t *current;
+    uint32_t *next;
+    uint32_t *released;
+    uint16_t word = 0;
+    int busy = 0;
+
+    memset(result, 0, sizeof(*result));
+    memset(buffers, 0xFF, sizeof(buffers));
+    (void)capture_ring_init(&buffers[0][0], BLOCK_WORDS, n_bufs, &ring);
+
+    /* Start, then the first request for the next buffer */
+    current = capture_ring_start(&ring);
+    next = capture_ring_start(&ring);
+
+    for (frame = 0; frame < n_frames; frame++)
+    {
+        current[word++] = fill_seq;
+        if (word == BLOCK_WORDS)
+        {
+            /* End of block interrupt: the DMA moves on to next, and asks for another */
+            word = 0;
+            fill_seq++;
+            result->n_filled++;
+            released = current;
+            current = next;
+            next = capture_ring_next(released, frame, &ring);
+        }
+
+        /* Consumer, the main loop */
+        if (busy && (frame >= busy_until))
+        {
+            if (!block_intact(block.data, block.seq))
+            {
+                result->n_corrupted++;
+            }
+
+            (void)capture_ring_release(block.data, &ring);
+            busy = 0;
+        }
+
+        if (!busy && (capture_ring_get(&block, &ring) == CAPTURE_RING_OK))
+        {
+            result->n_missed += block.seq - expected_seq;
+            expected_seq = block.seq + 1;
+            busy_until = frame + busy_frames(result->n_consumed, cfg);
+            result->n_consumed++;
+            busy = 1;
+        }
+    }
+
+    result->n_overruns = ring.stats.n_overruns;
+    result->max_waiting = ring.stats.max_waiting;
+}
+
+/*!
+ *  @brief Checks that only a buffer the consumer holds can be released, once.
+ */
+static int check_release(void)
+{
+    struct capture_ring ring;
+    struct capture_ring_block block = { NULL, 0, 0 };
+    uint32_t *current;
+    uint32_t *next;
+    int ok = 1;
+
+    (void)capture_ring_init(&buffers[0][0], BLOCK_WORDS, 3, &ring);
+    current = capture_ring_start(&ring);
+    next = capture_ring_start(&ring);
+
+    /* Nothing was taken yet: every buffer is free or with the DMA */
+    ok &= (capture_ring_release(&buffers[2][0], &ring) == CAPTURE_RING_E_INVALID_CFG);
+    ok &= (capture_ring_release(current, &ring) == CAPTURE_RING_E_INVALID_CFG);
+
+    (void)capture_ring_next(current, 0, &ring);
+    ok &= (capture_ring_get(&block, &ring) == CAPTURE_RING_OK);
+    ok &= (block.data == current);
+
+    /* The DMA still owns next, the consumer owns block */
+    ok &= (capture_ring_release(next, &ring) == CAPTURE_RING_E_INVALID_CFG);
+    ok &= (capture_ring_release(block.data, &ring) == CAPTURE_RING_OK);
+    ok &= (capture_ring_release(block.data, &ring) == CAPTURE_RING_E_INVALID_CFG);
+    ok &= (ring.stats.n_released == 1);
+
+    return ok;
+}
+
+/*!
+ *  @brief Runs the former ping-pong.
+ */
+static void run_legacy(const struct consumer_cfg *cfg, struct sim_result *result)
+{
+    uint32_t n_frames = cfg->seconds * FRAME_RATE_HZ;
+    uint32_t frame;
+    uint32_t busy_until = 0;
+    uint32_t expected_seq = 0;
+    uint32_t fill_seq = 0;
+    uint32_t block_seq = 0;
+    const uint32_t *block = NULL;
+    const uint32_t *latest = NULL;
+    uint32_t *current = buffers[0];
+    uint32_t *next = buffers[1];
+    uint32_t *released;
+    uint16_t word = 0;
+    int busy = 0;
+
+    memset(result, 0, sizeof(*result));
+    memset(buffers, 0xFF, sizeof(buffers));
+
+    for (frame = 0; frame < n_frames; frame++)
+    {
+        current[word++] = fill_seq;
+        if (word == BLOCK_WORDS)
+        {
+            /* End of block interrupt: the released buffer is the next one at once */
+            word = 0;
+            fill_seq++;
+            result->n_filled++;
+            released = current;
+            current = next;
+            next = released;
+            latest = released;
+        }
+
+        if (busy && (frame >= busy_until))
+        {
+            if (!block_intact(block, block_seq))
+            {
+                result->n_corrupted++;
+            }
+
+            busy = 0;
+        }
+
+        if (!busy && (latest != NULL))
+        {
+            block = latest;
+            latest = NULL;
+            block_seq = block[0];
+            result->n_missed += block_seq - expected_seq;
+            expected_seq = block_seq + 1;
+            busy_until = frame + busy_frames(result->n_consumed, cfg);
+            result->n_consumed++;
+            busy = 1;
+        }
+    }
+}
+
+/*!
+ *  @brief Time the consumer spends on block number idx, in frames.
+ */
+static uint32_t busy_frames(uint32_t idx, const struct consumer_cfg *cfg)
+{
+    uint32_t time_us = cfg->proc_us;
+
+    if ((idx % cfg->stall_every) == (cfg->stall_every - 1))
+    {
+        time_us += cfg->stall_us;
+    }
+
+    return (uint32_t)(((uint64_t)time_us * FRAME_RATE_HZ) / 1000000);
+}
+
+/*!
+ *  @brief Checks that a block holds its own sequence number only.
+ */
+static int block_intact(const uint32_t *data, uint32_t seq)
+{
+    uint16_t idx;
+
+    for (idx = 0; idx < BLOCK_WORDS; idx++)
+    {
+        if ((data[idx] != seq) || (data[idx] == NOT_FILLED))
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/*!
+ *  @brief Prints a run.
+ */
+static void print_result(const char *name, const struct consumer_cfg *cfg, const struct sim_result *result)
+{
+    uint32_t n_intact = result->n_consumed - result->n_corrupted;
+
+    printf("%-10s: %6lu filled, %6lu consumed, %6lu intact, %6lu corrupted, %6lu missed, %6lu overruns, "
+           "%u most waiting, %.1f kB/s intact\n",
+           name,
+           (unsigned long)result->n_filled,
+           (unsigned long)result->n_consumed,
+           (unsigned long)n_intact,
+           (unsigned long)result->n_corrupted,
+           (unsigned long)result->n_missed,
+           (unsigned long)result->n_overruns,
+           result->max_waiting,
+           (double)n_intact * BLOCK_WORDS * sizeof(uint32_t) / (1000.0 * cfg->seconds));
+}
@@ -0,0 +1,171 @@
+/**\
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "flash_log.h"
+
+/******************************************************************************/
+/*!                Macro definition                                           */
+
+/*! Record types, as logged on the board */
+#define REC_ACCEL           UINT8_C(1)
+#define REC_GYRO            UINT8_C(2)
+#define REC_ENV             UINT8_C(5)
+
+/*! Sensortime ticks of 39.0625 us per second, extended to 32 bits */
+#define TICKS_PER_SEC       UINT32_C(25600)
+
+/*! Defaults: 4 hours of accel and gyro at 200 Hz, environment at 1 Hz */
+#define DEFAULT_HOURS       (4.0)
+#define DEFAULT_RATE_HZ     UINT32_C(200)
+
+/******************************************************************************/
+/*!           Static Variable Definition                                      */
+
+/*! Writer */
+static struct flash_log log_writer;
+
+/******************************************************************************/
+/*!           Static Function Declaration                                     */
+
+/*!
+ *  @brief Writes a block or the index to the log file.
+ */
+static int8_t write_file(const uint8_t *data, uint16_t len, void *intf_ptr);
+
+/*!
+ *  @brief Puts a 16 bit value, little endian.
+ */
+static void put_s16(uint8_t *buf, int16_t val);
+
+/******************************************************************************/
+/*!            Functions                                                      */
+
+/*
+ * Writes a synthetic log as the board does, for benchmarking the reader:
+ *
+ *   flash_log_gen <file> [hours] [rate_hz]
+ */
+int main(int argc, char *argv[])
+{
+    FILE *fp;
+    double hours = DEFAULT_HOURS;
+    uint32_t rate_hz = DEFAULT_RATE_HZ;
+    uint64_t n_samples;
+    uint64_t idx;
+    uint32_t time;
+    uint32_t noise = 1;
+    uint8_t rec[8];
+    uint8_t axis;
+    clock_t start;
+    int8_t rslt;
+
+    if (argc < 2)
+    {
+        printf("Usage: %s <file> [hours] [rate_hz]\n", argv[0]);
+
+        return EXIT_FAILURE;
+    }
+
+    if (argc > 2)
+    {
+        hours = atof(argv[2]);
+    }
+
+    if (argc > 3)
+    {
+        rate_hz = (uint32_t)atoi(argv[3]);
+    }
+
+    /* The 32 bit time holds 46 hours of sensortime */
+    if ((hours <= 0) || (hours > 46) || (rate_hz == 0) || (rate_hz > TICKS_PER_SEC))
+    {
+        printf("Hours must be up to 46, rate_hz up to %lu\n", (unsigned long)TICKS_PER_SEC);
+
+        return EXIT_FAILURE;
+    }
+
+    fp = fopen(argv[1], "wb");
+    if (fp == NULL)
+    {
+        printf("Cannot create %s\n", argv[1]);
+
+        return EXIT_FAILURE;
+    }
+
+    (void)flash_log_init(write_file, fp, &log_writer);
+
+    start = clock();
+    n_samples = (uint64_t)(hours * 3600.0 * rate_hz);
+    for (idx = 0; idx < n_samples; idx++)
+    {
+        time = (uint32_t)((idx * TICKS_PER_SEC) / rate_hz);
+
+        /* A slow wave with a little noise, so deltas look like real data */
+        for (axis = 0; axis < 3; axis++)
+        {
+            noise = noise * 1103515245 + 12345;
+            put_s16(&rec[2 * axis], (int16_t)(((idx >> 4) & 0x3FF) * (axis + 1) + ((noise >> 16) & 0x3F)));
+        }
+
+        (void)flash_log_put(REC_ACCEL, time, rec, 6, &log_writer);
+
+        for (axis = 0; axis < 3; axis++)
+        {
+            noise = noise * 1103515245 + 12345;
+            put_s16(&rec[2 * axis], (int16_t)((noise >> 16) & 0xFF));
+        }
+
+        (void)flash_log_put(REC_GYRO, time, rec, 6, &log_writer);
+
+        if ((idx % rate_hz) == 0)
+        {
+            /* Temperature, pressure, humidity */
+            put_s16(&rec[0], 2500);
+            put_s16(&rec[2], (int16_t)(idx / rate_hz));
+            put_s16(&rec[4], 4500);
+            put_s16(&rec[6], 0);
+            (void)flash_log_put(REC_ENV, time, rec, 8, &log_writer);
+        }
+
+        /* The main loop, writing the blocks as they fill */
+        (void)flash_log_process(&log_writer);
+    }
+
+    rslt = flash_log_finish(&log_writer);
+    (void)fclose(fp);
+
+    printf("%s: %lu records, %lu dropped, %lu blocks of %d bytes, %u index entries of %lu blocks, %.1f s\n",
+           argv[1],
+           (unsigned long)log_writer.stats.n_records,
+           (unsigned long)log_writer.stats.n_dropped,
+           (unsigned long)log_writer.stats.n_blocks,
+           FLASH_LOG_BLOCK_SIZE,
+           log_writer.n_index,
+           (unsigned long)log_writer.stride,
+           (double)(clock() - start) / CLOCKS_PER_SEC);
+
+    return (rslt == FLASH_LOG_OK) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/*!
+ *  @brief Writes a block or the index to the log file.
+ */
+static int8_t write_file(const uint8_t *data, uint16_t len, void *intf_ptr)
+{
+    return (fwrite(data, 1, len, (FILE *)intf_ptr) == len) ? 0 : -1;
+}
+
+/*!
+ *  @brief Puts a 16 bit value, little endian.
+ */
+static void put_s16(uint8_t *buf, int16_t val)
+{
+    buf[0] = (uint8_t)val;
+    buf[1] = (uint8_t)((uint16_t)val >> 8);
+}
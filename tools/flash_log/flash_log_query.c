@@ -0,0 +1,193 @@
+/**\
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "flash_log.h"
+#include "flash_log_reader.h"
+
+/******************************************************************************/
+/*!                Macro definition                                           */
+
+/*! Sensortime ticks of 39.0625 us per second, extended to 32 bits */
+#define TICKS_PER_SEC   (25600.0)
+
+/******************************************************************************/
+/*!           Structure Definition                                            */
+
+/*! Range of the full scan and what it found */
+struct scan_range
+{
+    uint32_t from;
+    uint32_t to;
+    uint32_t sensor_mask;
+    uint64_t sum[2];
+};
+
+/******************************************************************************/
+/*!           Static Variable Definition                                      */
+
+/*! Log file, holds the index and a block */
+static struct flash_log_file log_file;
+
+/******************************************************************************/
+/*!           Static Function Declaration                                     */
+
+/*!
+ *  @brief Counts the records of the range, with a checksum to compare reads.
+ */
+static void count_record(uint8_t type, uint32_t time, const uint8_t *data, uint8_t len, void *cb_ptr);
+
+/*!
+ *  @brief Counts the records of the range, for the full scan.
+ */
+static void count_range(uint8_t type, uint32_t time, const uint8_t *data, uint8_t len, void *cb_ptr);
+
+/*!
+ *  @brief Reads the whole file and scans it, the way a log without index is read.
+ */
+static void full_scan(const char *path, uint32_t from, uint32_t to, uint32_t sensor_mask);
+
+/******************************************************************************/
+/*!            Functions                                                      */
+
+/*
+ * Reads a time range of a log through its index, then compares with a full scan:
+ *
+ *   flash_log_query <file> <from_s> <to_s> [sensor_mask]
+ */
+int main(int argc, char *argv[])
+{
+    uint64_t sum[2] = { 0 };
+    uint32_t sensor_mask = FLASH_LOG_ALL_TYPES;
+    uint32_t from;
+    uint32_t to;
+    clock_t start;
+    int8_t rslt;
+
+    if (argc < 4)
+    {
+        printf("Usage: %s <file> <from_s> <to_s> [sensor_mask]\n", argv[0]);
+
+        return EXIT_FAILURE;
+    }
+
+    from = (uint32_t)(atof(argv[2]) * TICKS_PER_SEC);
+    to = (uint32_t)(atof(argv[3]) * TICKS_PER_SEC);
+    if (argc > 4)
+    {
+        sensor_mask = (uint32_t)strtoul(argv[4], NULL, 0);
+    }
+
+    start = clock();
+    rslt = flash_log_file_open(argv[1], &log_file);
+    if (rslt < FLASH_LOG_OK)
+    {
+        printf("Cannot open %s as a flash log (%d)\n", argv[1], rslt);
+
+        return EXIT_FAILURE;
+    }
+
+    if (rslt == FLASH_LOG_W_NO_INDEX)
+    {
+        printf("No index, searching the block headers\n");
+    }
+    else
+    {
+        printf("Index: %u entries of %lu blocks, %lu blocks of %lu bytes\n",
+               log_file.n_index,
+               (unsigned long)log_file.stride,
+               (unsigned long)log_file.n_blocks,
+               (unsigned long)log_file.block_size);
+    }
+
+    rslt = flash_log_file_read(from, to, sensor_mask, count_record, sum, &log_file);
+    printf("Indexed : %lu records, sum %llu, %lu blocks, %lu bad, %lu reads, %lu bytes read, %.3f ms\n",
+           (unsigned long)log_file.stats.n_records,
+           (unsigned long long)sum[1],
+           (unsigned long)log_file.stats.n_blocks,
+           (unsigned long)log_file.stats.n_bad_blocks,
+           (unsigned long)log_file.stats.n_reads,
+           (unsigned long)log_file.stats.n_bytes,
+           1000.0 * (double)(clock() - start) / CLOCKS_PER_SEC);
+    flash_log_file_close(&log_file);
+
+    full_scan(argv[1], from, to, sensor_mask);
+
+    return (rslt == FLASH_LOG_OK) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/*!
+ *  @brief Counts the records of the range, with a checksum to compare reads.
+ */
+static void count_record(uint8_t type, uint32_t time, const uint8_t *data, uint8_t len, void *cb_ptr)
+{
+    uint64_t *sum = (uint64_t *)cb_ptr;
+    uint8_t idx;
+
+    sum[0]++;
+    sum[1] += type + time;
+    for (idx = 0; idx < len; idx++)
+    {
+        sum[1] += data[idx];
+    }
+}
+
+/*!
+ *  @brief Counts the records of the range, for the full scan.
+ */
+static void count_range(uint8_t type, uint32_t time, const uint8_t *data, uint8_t len, void *cb_ptr)
+{
+    struct scan_range *range = (struct scan_range *)cb_ptr;
+
+    if ((time >= range->from) && (time <= range->to) &&
+        ((range->sensor_mask & (UINT32_C(1) << ((type - 1) & 0x1F))) != 0))
+    {
+        count_record(type, time, data, len, range->sum);
+    }
+}
+
+/*!
+ *  @brief Reads the whole file and scans it, the way a log without index is read.
+ */
+static void full_scan(const char *path, uint32_t from, uint32_t to, uint32_t sensor_mask)
+{
+    struct flash_log_scan_stats stats;
+    struct scan_range range = { 0 };
+    uint8_t *data;
+    long len;
+    FILE *fp;
+    clock_t start = clock();
+
+    range.from = from;
+    range.to = to;
+    range.sensor_mask = sensor_mask;
+
+    fp = fopen(path, "rb");
+    if (fp == NULL)
+    {
+        return;
+    }
+
+    (void)fseek(fp, 0, SEEK_END);
+    len = ftell(fp);
+    (void)fseek(fp, 0, SEEK_SET);
+    data = (uint8_t *)malloc((size_t)len);
+    if ((data != NULL) && (fread(data, 1, (size_t)len, fp) == (size_t)len))
+    {
+        (void)flash_log_scan(data, (uint32_t)len, count_range, &range, &stats);
+        printf("Full    : %llu records, sum %llu, %lu blocks, %lu bytes read, %.3f ms\n",
+               (unsigned long long)range.sum[0],
+               (unsigned long long)range.sum[1],
+               (unsigned long)stats.n_blocks,
+               (unsigned long)len,
+               1000.0 * (double)(clock() - start) / CLOCKS_PER_SEC);
+    }
+
+    free(data);
+    (void)fclose(fp);
+}
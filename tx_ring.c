@@ -0,0 +1,306 @@
+/**
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @file    tx_ring.c
+ * @date    Oct 18, 2026
+ * @brief   Non-blocking transmit ring of packet-sized buffers
+ */
+
+/**********************************************************************************/
+/* system header includes */
+/**********************************************************************************/
+#include <string.h>
+
+/**********************************************************************************/
+/* own header files */
+/**********************************************************************************/
+#include "tx_ring.h"
+
+/**********************************************************************************/
+/* macro definitions */
+/**********************************************************************************/
+/*! Slot of a free running slot count */
+#define SLOT_POS(ring, count)  ((uint8_t)((count) & ((ring)->n_slots - 1)))
+
+/**********************************************************************************/
+/* static function declarations */
+/**********************************************************************************/
+
+/*!
+ * @brief Queues the slot being filled.
+ */
+static void queue_fill_slot(struct tx_ring *ring);
+
+/*!
+ * @brief Starts the transfer of the oldest queued slot, or marks the link idle.
+ */
+static void start_next(struct tx_ring *ring);
+
+/*!
+ * @brief Starts a transfer if the link is idle. Producer side only.
+ */
+static void kick_idle(struct tx_ring *ring);
+
+/**********************************************************************************/
+/* functions */
+/**********************************************************************************/
+
+/*!
+ * @brief This API initializes a ring over the given storage.
+ */
+int8_t tx_ring_init(uint8_t *buf,
+                    uint16_t slot_size,
+                    uint8_t n_slots,
+                    tx_ring_start_fptr_t start,
+                    void *intf_ptr,
+                    struct tx_ring *ring)
+{
+    int8_t rslt = TX_RING_OK;
+
+    if ((buf == NULL) || (start == NULL) || (ring == NULL))
+    {
+        rslt = TX_RING_E_NULL_PTR;
+    }
+    else if ((slot_size == 0) || (n_slots < 2) || (n_slots > TX_RING_MAX_SLOTS) ||
+             ((n_slots & (n_slots - 1)) != 0))
+    {
+        rslt = TX_RING_E_INVALID_CFG;
+    }
+    else
+    {
+        memset(ring, 0, sizeof(*ring));
+        ring->buf = buf;
+        ring->slot_size = slot_size;
+        ring->n_slots = n_slots;
+        ring->start = start;
+        ring->intf_ptr = intf_ptr;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API copies data into the ring without waiting for the link.
+ */
+int8_t tx_ring_write(const uint8_t *data, uint16_t len, uint16_t *n_written, struct tx_ring *ring)
+{
+    int8_t rslt = TX_RING_OK;
+    uint16_t done = 0;
+    uint16_t chunk;
+    uint16_t fill_len;
+    uint8_t *slot;
+
+    if ((data == NULL) || (n_written == NULL) || (ring == NULL) || (ring->buf == NULL))
+    {
+        rslt = TX_RING_E_NULL_PTR;
+    }
+    else
+    {
+        /* Keeps the interrupt off the slot being filled */
+        ring->writing = 1;
+        TX_RING_BARRIER();
+
+        fill_len = ring->fill_len;
+        while (done < len)
+        {
+            /* The slot being filled would overwrite the oldest queued slot */
+            if ((uint16_t)(ring->head - ring->tail) >= ring->n_slots)
+            {
+                ring->stats.n_backpressure++;
+                rslt = TX_RING_W_FULL;
+                break;
+            }
+
+            slot = &ring->buf[SLOT_POS(ring, ring->head) * ring->slot_size];
+            chunk = ring->slot_size - fill_len;
+            if (chunk > (len - done))
+            {
+                chunk = len - done;
+            }
+
+            memcpy(&slot[fill_len], &data[done], chunk);
+            fill_len += chunk;
+            done += chunk;
+            ring->fill_len = fill_len;
+
+            if (fill_len == ring->slot_size)
+            {
+                queue_fill_slot(ring);
+                fill_len = 0;
+            }
+        }
+
+        ring->stats.n_bytes += done;
+        *n_written = done;
+
+        TX_RING_BARRIER();
+        ring->writing = 0;
+        TX_RING_BARRIER();
+
+        /* An idle link is started right away, a busy one picks the slots up
+         * from tx_ring_tx_done. Writes made meanwhile are coalesced.
+         */
+        kick_idle(ring);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API starts a transfer if the link is idle, sending a partially
+ * filled slot.
+ */
+int8_t tx_ring_flush(struct tx_ring *ring)
+{
+    int8_t rslt = TX_RING_OK;
+
+    if ((ring == NULL) || (ring->buf == NULL))
+    {
+        rslt = TX_RING_E_NULL_PTR;
+    }
+    else
+    {
+        kick_idle(ring);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is called from the transfer complete event. It releases the
+ * sent slot and starts the next one.
+ */
+void tx_ring_tx_done(struct tx_ring *ring)
+{
+    if ((ring != NULL) && ring->in_flight)
+    {
+        ring->tail++;
+
+        /* Nothing queued: send the partial slot, unless the producer is
+         * filling it. The producer then starts it on its way out.
+         */
+        if ((ring->head == ring->tail) && (ring->writing == 0) && (ring->fill_len > 0))
+        {
+            queue_fill_slot(ring);
+        }
+
+        start_next(ring);
+    }
+}
+
+/*!
+ * @brief This API discards the queued slots, e.g. when the link is closed.
+ */
+void tx_ring_discard(struct tx_ring *ring)
+{
+    uint16_t tail;
+    uint16_t head;
+
+    if (ring != NULL)
+    {
+        head = ring->head;
+        for (tail = ring->tail; tail != head; tail++)
+        {
+            ring->stats.n_dropped += ring->slot_len[SLOT_POS(ring, tail)];
+        }
+
+        ring->tail = head;
+        ring->in_flight = 0;
+    }
+}
+
+/*!
+ * @brief This API counts bytes the producer gave up on.
+ */
+void tx_ring_drop(uint32_t len, struct tx_ring *ring)
+{
+    if (ring != NULL)
+    {
+        ring->stats.n_dropped += len;
+    }
+}
+
+/*!
+ * @brief This API tells if everything written was sent.
+ */
+uint8_t tx_ring_is_idle(const struct tx_ring *ring)
+{
+    uint8_t idle = 1;
+
+    if (ring != NULL)
+    {
+        idle = (ring->in_flight == 0) && (ring->head == ring->tail) && (ring->fill_len == 0);
+    }
+
+    return idle;
+}
+
+/*!
+ * @brief Queues the slot being filled.
+ */
+static void queue_fill_slot(struct tx_ring *ring)
+{
+    uint16_t queued;
+
+    ring->slot_len[SLOT_POS(ring, ring->head)] = ring->fill_len;
+    ring->fill_len = 0;
+
+    TX_RING_BARRIER();
+    ring->head++;
+
+    queued = (uint16_t)(ring->head - ring->tail);
+    if (queued > ring->stats.max_queued)
+    {
+        ring->stats.max_queued = (uint8_t)queued;
+    }
+}
+
+/*!
+ * @brief Starts the transfer of the oldest queued slot, or marks the link idle.
+ */
+static void start_next(struct tx_ring *ring)
+{
+    uint8_t idx;
+    uint16_t len;
+
+    if (ring->head == ring->tail)
+    {
+        ring->in_flight = 0;
+    }
+    else
+    {
+        idx = SLOT_POS(ring, ring->tail);
+        len = ring->slot_len[idx];
+
+        ring->in_flight = 1;
+        ring->stats.n_packets++;
+        if (len == ring->slot_size)
+        {
+            ring->stats.n_full_packets++;
+        }
+
+        if (ring->start(&ring->buf[idx * ring->slot_size], len, ring->intf_ptr) != TX_RING_OK)
+        {
+            /* The link is gone, whatever is queued is stale */
+            ring->stats.n_start_errors++;
+            tx_ring_discard(ring);
+        }
+    }
+}
+
+/*!
+ * @brief Starts a transfer if the link is idle. Producer side only.
+ */
+static void kick_idle(struct tx_ring *ring)
+{
+    /* While idle no transfer complete event can come in */
+    if (ring->in_flight == 0)
+    {
+        if ((ring->head == ring->tail) && (ring->fill_len > 0))
+        {
+            queue_fill_slot(ring);
+        }
+
+        start_next(ring);
+    }
+}
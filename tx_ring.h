@@ -0,0 +1,216 @@
+/**
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @file    tx_ring.h
+ * @date    Oct 18, 2026
+ * @brief   Non-blocking transmit ring of packet-sized buffers
+ *
+ * Small writes are coalesced into packet-sized slots. A slot is handed to the
+ * link when it is full, or right away when the link is idle, and the next
+ * slot is started from the transfer complete event. The ring has no platform
+ * dependency: the link is reached only through the start callback.
+ *
+ * Concurrency: one producer (main loop) calls tx_ring_write/tx_ring_flush, the
+ * transfer complete interrupt calls tx_ring_tx_done. No interrupt masking is
+ * needed, a transfer is only started by the producer while the link is idle
+ * and by the interrupt while it is busy.
+ */
+#ifndef TX_RING_H_
+#define TX_RING_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**********************************************************************************/
+/* macro definitions */
+/**********************************************************************************/
+/*! Maximum number of slots of a ring, a power of two */
+#ifndef TX_RING_MAX_SLOTS
+#define TX_RING_MAX_SLOTS     (32)
+#endif
+
+/*! Compiler barrier, orders the slot contents before the index which publishes it */
+#ifndef TX_RING_BARRIER
+#define TX_RING_BARRIER()     __asm__ volatile ("" ::: "memory")
+#endif
+
+/*! Status codes */
+#define TX_RING_OK            INT8_C(0)
+#define TX_RING_E_NULL_PTR    INT8_C(-1)
+#define TX_RING_E_INVALID_CFG INT8_C(-2)
+#define TX_RING_E_COM_FAIL    INT8_C(-3)
+
+/*! Warning: not all bytes were taken, the ring is full */
+#define TX_RING_W_FULL        INT8_C(1)
+
+/**********************************************************************************/
+/* data structure declarations  */
+/**********************************************************************************/
+
+/*!
+ * @brief Starts the transfer of one slot. Called from the producer while the
+ * link is idle and from tx_ring_tx_done. The data stays valid until the
+ * matching tx_ring_tx_done.
+ *
+ * @return TX_RING_OK when the transfer was started
+ */
+typedef int8_t (*tx_ring_start_fptr_t)(const uint8_t *data, uint16_t len, void *intf_ptr);
+
+/*!
+ * @brief Counters of a ring
+ */
+struct tx_ring_stats
+{
+    /*! Bytes taken by tx_ring_write */
+    uint32_t n_bytes;
+
+    /*! Transfers started */
+    uint32_t n_packets;
+
+    /*! Transfers of a completely filled slot */
+    uint32_t n_full_packets;
+
+    /*! Writes which found the ring full */
+    uint32_t n_backpressure;
+
+    /*! Bytes discarded, by tx_ring_discard, tx_ring_drop or a failed start */
+    uint32_t n_dropped;
+
+    /*! Transfers the link refused to start */
+    uint32_t n_start_errors;
+
+    /*! Highest number of queued slots */
+    uint8_t max_queued;
+};
+
+/*!
+ * @brief Transmit ring
+ */
+struct tx_ring
+{
+    /*! Slot storage, n_slots * slot_size bytes */
+    uint8_t *buf;
+
+    /*! Slot size, the packet size of the link */
+    uint16_t slot_size;
+
+    /*! Number of slots, a power of two */
+    uint8_t n_slots;
+
+    /*! Length of the queued slots */
+    uint16_t slot_len[TX_RING_MAX_SLOTS];
+
+    /*! Free running count of queued slots, written by the producer only, except
+     *  when the interrupt queues the partial slot of an idle producer */
+    volatile uint16_t head;
+
+    /*! Free running count of sent slots, written by the interrupt side */
+    volatile uint16_t tail;
+
+    /*! Bytes in the slot being filled */
+    volatile uint16_t fill_len;
+
+    /*! A transfer is on the link */
+    volatile uint8_t in_flight;
+
+    /*! The producer is inside tx_ring_write */
+    volatile uint8_t writing;
+
+    /*! Starts a transfer */
+    tx_ring_start_fptr_t start;
+
+    /*! Passed to start */
+    void *intf_ptr;
+
+    /*! Counters */
+    struct tx_ring_stats stats;
+};
+
+/**********************************************************************************/
+/* functions */
+/**********************************************************************************/
+
+/*!
+ * @brief This API initializes a ring over the given storage.
+ *
+ * @param[in] buf       : Slot storage of n_slots * slot_size bytes.
+ * @param[in] slot_size : Slot size, the packet size of the link.
+ * @param[in] n_slots   : Number of slots, a power of two from 2 to
+ *                        TX_RING_MAX_SLOTS.
+ * @param[in] start     : Starts the transfer of one slot.
+ * @param[in] intf_ptr  : Passed to start.
+ * @param[out] ring     : Ring to initialize.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t tx_ring_init(uint8_t *buf,
+                    uint16_t slot_size,
+                    uint8_t n_slots,
+                    tx_ring_start_fptr_t start,
+                    void *intf_ptr,
+                    struct tx_ring *ring);
+
+/*!
+ * @brief This API copies data into the ring without waiting for the link.
+ * Data is coalesced into the current slot while a transfer is on the link.
+ *
+ * @param[in] data       : Data to send.
+ * @param[in] len        : Length of data.
+ * @param[out] n_written : Bytes taken.
+ * @param[in,out] ring   : Ring.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval TX_RING_W_FULL -> Only n_written bytes were taken
+ * @retval < 0 -> Fail
+ */
+int8_t tx_ring_write(const uint8_t *data, uint16_t len, uint16_t *n_written, struct tx_ring *ring);
+
+/*!
+ * @brief This API starts a transfer if the link is idle, sending a partially
+ * filled slot.
+ *
+ * @param[in,out] ring : Ring.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+int8_t tx_ring_flush(struct tx_ring *ring);
+
+/*!
+ * @brief This API is called from the transfer complete event. It releases the
+ * sent slot and starts the next one.
+ *
+ * @param[in,out] ring : Ring.
+ */
+void tx_ring_tx_done(struct tx_ring *ring);
+
+/*!
+ * @brief This API discards the queued slots, e.g. when the link is closed.
+ * The slot being filled is kept.
+ *
+ * @param[in,out] ring : Ring.
+ */
+void tx_ring_discard(struct tx_ring *ring);
+
+/*!
+ * @brief This API counts bytes the producer gave up on.
+ *
+ * @param[in] len      : Number of bytes.
+ * @param[in,out] ring : Ring.
+ */
+void tx_ring_drop(uint32_t len, struct tx_ring *ring);
+
+/*!
+ * @brief This API tells if everything written was sent.
+ *
+ * @param[in] ring : Ring.
+ *
+ * @return 1 if nothing is queued or on the link, 0 otherwise
+ */
+uint8_t tx_ring_is_idle(const struct tx_ring *ring);
+
+#endif /* TX_RING_H_ */